@@ -167,6 +167,66 @@ int arch_dcache_flush_and_invd_range(void *start_addr, size_t size)
 	return 0;
 }
 
+enum dcache_op {
+	DCACHE_CLEAN,
+	DCACHE_INVALIDATE,
+	DCACHE_CLEAN_INVALIDATE,
+};
+
+/*
+ * Unlike the L1C_*DCacheMVA() helpers, which issue a DMB after each line, the
+ * lines of all the ranges are maintained with a single DSB at the end.
+ */
+static void dcache_ranges_op(const struct sys_cache_range *ranges, size_t num,
+			     enum dcache_op op)
+{
+	size_t line_size = arch_dcache_line_size_get();
+	uintptr_t start, end, addr;
+	size_t idx = 0;
+
+	while (z_sys_cache_ranges_next(ranges, num, line_size, &idx, &start, &end)) {
+		for (addr = start & ~(line_size - 1); addr < end; addr += line_size) {
+			/*
+			 * Clean and invalidate the partial cache lines at both
+			 * ends of an invalidated span to prevent data corruption
+			 */
+			if (op == DCACHE_INVALIDATE &&
+			    (addr < start || addr + line_size > end)) {
+				__set_DCCIMVAC((uint32_t)addr);
+			} else if (op == DCACHE_INVALIDATE) {
+				__set_DCIMVAC((uint32_t)addr);
+			} else if (op == DCACHE_CLEAN) {
+				__set_DCCMVAC((uint32_t)addr);
+			} else {
+				__set_DCCIMVAC((uint32_t)addr);
+			}
+		}
+	}
+
+	barrier_dsync_fence_full();
+}
+
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, DCACHE_CLEAN);
+
+	return 0;
+}
+
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, DCACHE_INVALIDATE);
+
+	return 0;
+}
+
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, DCACHE_CLEAN_INVALIDATE);
+
+	return 0;
+}
+
 #endif
 
 #ifdef CONFIG_ICACHE
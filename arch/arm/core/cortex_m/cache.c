@@ -67,6 +67,52 @@ int arch_dcache_flush_and_invd_range(void *start_addr, size_t size)
 	return 0;
 }
 
+/*
+ * Same sequence as the CMSIS by-address operations, with the barriers issued
+ * once for all the ranges.
+ */
+static void dcache_ranges_op(const struct sys_cache_range *ranges, size_t num,
+			     volatile uint32_t *op_reg)
+{
+	uintptr_t start, end;
+	size_t idx = 0;
+
+	__DSB();
+
+	while (z_sys_cache_ranges_next(ranges, num, __SCB_DCACHE_LINE_SIZE, &idx,
+				       &start, &end)) {
+		start &= ~(uintptr_t)(__SCB_DCACHE_LINE_SIZE - 1U);
+
+		for (; start < end; start += __SCB_DCACHE_LINE_SIZE) {
+			*op_reg = start;
+		}
+	}
+
+	__DSB();
+	__ISB();
+}
+
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, &SCB->DCCMVAC);
+
+	return 0;
+}
+
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, &SCB->DCIMVAC);
+
+	return 0;
+}
+
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t num)
+{
+	dcache_ranges_op(ranges, num, &SCB->DCCIMVAC);
+
+	return 0;
+}
+
 void arch_icache_enable(void)
 {
 	SCB_EnableICache();
@@ -16,6 +16,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/irq.h>
 #include <zephyr/pm/pm.h>
+#include <zephyr/irq_stats.h>
 #include <cmsis_core.h>
 
 /**
@@ -32,6 +33,10 @@
  */
 void _isr_wrapper(void)
 {
+#ifdef CONFIG_IRQ_STATS
+	uint32_t irq_stats_entry = z_irq_stats_now();
+#endif /* CONFIG_IRQ_STATS */
+
 #ifdef CONFIG_TRACING_ISR
 	sys_trace_isr_enter();
 #endif /* CONFIG_TRACING_ISR */
@@ -74,8 +79,16 @@ void _isr_wrapper(void)
 	irq_number -= 16;
 
 	struct _isr_table_entry *entry = &_sw_isr_table[irq_number];
+#ifdef CONFIG_IRQ_STATS
+	uint32_t irq_stats_start = z_irq_stats_now();
+#endif /* CONFIG_IRQ_STATS */
+
 	(entry->isr)(entry->arg);
 
+#ifdef CONFIG_IRQ_STATS
+	z_irq_stats_record(irq_number, irq_stats_entry, irq_stats_start);
+#endif /* CONFIG_IRQ_STATS */
+
 #if defined(CONFIG_ARM_CUSTOM_INTERRUPT_CONTROLLER)
 	z_soc_irq_eoi(irq_number);
 #endif
@@ -18,6 +18,7 @@
 #include <zephyr/sw_isr_table.h>
 #include "soc.h"
 #include <zephyr/tracing/tracing.h>
+#include <zephyr/irq_stats.h>
 #include "irq_handler.h"
 #include "board_soc.h"
 #include "nsi_cpu_if.h"
@@ -31,6 +32,11 @@ static int currently_running_irq = -1;
 
 static inline void vector_to_irq(int irq_nbr, int *may_swap)
 {
+#ifdef CONFIG_IRQ_STATS
+	uint32_t irq_stats_entry = z_irq_stats_now();
+	uint32_t irq_stats_start;
+#endif
+
 	sys_trace_isr_enter();
 
 	if (irq_vector_table[irq_nbr].func == NULL) { /* LCOV_EXCL_BR_LINE */
@@ -40,6 +46,9 @@ static inline void vector_to_irq(int irq_nbr, int *may_swap)
 					irq_nbr);
 		/* LCOV_EXCL_STOP */
 	} else {
+#ifdef CONFIG_IRQ_STATS
+		irq_stats_start = z_irq_stats_now();
+#endif
 		if (irq_vector_table[irq_nbr].flags & ISR_FLAG_DIRECT) {
 			*may_swap |= ((direct_irq_f_ptr)
 					irq_vector_table[irq_nbr].func)();
@@ -51,6 +60,9 @@ static inline void vector_to_irq(int irq_nbr, int *may_swap)
 					(irq_vector_table[irq_nbr].param);
 			*may_swap = 1;
 		}
+#ifdef CONFIG_IRQ_STATS
+		z_irq_stats_record(irq_nbr, irq_stats_entry, irq_stats_start);
+#endif
 	}
 
 	sys_trace_isr_exit();
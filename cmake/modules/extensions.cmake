@@ -1450,10 +1450,13 @@ endmacro()
 # - NOKEEP: suppress the generation of KEEP() statements in the linker script,
 #   to allow any unused code in the given files/library to be discarded.
 # - PHDR [program_header]: add program header. Used on Xtensa platforms.
+# - FUNCTIONS [func_1 func_2 ...]: only relocate the code of the given
+#   functions, which requires the files to be built with -ffunction-sections.
+#   This is typically generated by scripts/profiling/hot_relocate.py.
 function(zephyr_code_relocate)
   set(options NOCOPY NOKEEP)
   set(single_args LIBRARY LOCATION PHDR)
-  set(multi_args FILES)
+  set(multi_args FILES FUNCTIONS)
   cmake_parse_arguments(CODE_REL "${options}" "${single_args}"
     "${multi_args}" ${ARGN})
   # Argument validation
@@ -1518,6 +1521,10 @@ function(zephyr_code_relocate)
   if(CODE_REL_NOKEEP)
     list(APPEND flag_list NOKEEP)
   endif()
+  if(CODE_REL_FUNCTIONS)
+    string(JOIN "," functions ${CODE_REL_FUNCTIONS})
+    list(APPEND flag_list "FUNCTIONS=${functions}")
+  endif()
   if(CODE_REL_PHDR)
     set(CODE_REL_LOCATION "${CODE_REL_LOCATION}\ :${CODE_REL_PHDR}")
   endif()
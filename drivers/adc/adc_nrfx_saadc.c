@@ -10,6 +10,9 @@
 #include <zephyr/dt-bindings/adc/nrf-saadc-v3.h>
 #include <zephyr/dt-bindings/adc/nrf-saadc-nrf54l.h>
 #include <zephyr/linker/devicetree_regions.h>
+#ifdef CONFIG_ADC_STREAM
+#include "adc_stream.h"
+#endif
 
 #define LOG_LEVEL CONFIG_ADC_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -93,6 +96,14 @@ struct driver_data {
 	void *user_buffer;
 	uint8_t active_channels;
 #endif
+
+#ifdef CONFIG_ADC_STREAM
+	struct adc_stream stream;
+	/* Index of the stream buffer being filled */
+	uint8_t stream_buf;
+	bool streaming;
+	bool stream_sampling;
+#endif
 };
 
 static struct driver_data m_data = {
@@ -465,8 +476,8 @@ static void correct_single_ended(const struct adc_sequence *sequence)
 	}
 }
 
-static int start_read(const struct device *dev,
-		      const struct adc_sequence *sequence)
+/* Enables the channels selected for the sequence, disables the others. */
+static int setup_sequence(const struct adc_sequence *sequence, uint8_t *p_active_channels)
 {
 	int error;
 	uint32_t selected_channels = sequence->channels;
@@ -560,6 +571,22 @@ static int start_read(const struct device *dev,
 		return error;
 	}
 
+	*p_active_channels = active_channels;
+
+	return 0;
+}
+
+static int start_read(const struct device *dev,
+		      const struct adc_sequence *sequence)
+{
+	int error;
+	uint8_t active_channels;
+
+	error = setup_sequence(sequence, &active_channels);
+	if (error) {
+		return error;
+	}
+
 	error = check_buffer_size(sequence, active_channels);
 	if (error) {
 		return error;
@@ -612,8 +639,138 @@ static int adc_nrfx_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#ifdef CONFIG_ADC_STREAM
+/* Streams are paced by the internal timer of the SAADC, clocked at 16 MHz */
+#define STREAM_TIMER_TICKS_PER_US	16
+#define STREAM_TIMER_CC_MIN		80
+#define STREAM_TIMER_CC_MAX		2047
+
+#if defined(ADC_BUFFER_IN_RAM)
+#define STREAM_MEMORY_SECTION SAADC_MEMORY_SECTION
+#else
+#define STREAM_MEMORY_SECTION
+#endif
+
+static nrf_saadc_value_t stream_buffers[2][CONFIG_ADC_NRFX_SAADC_STREAM_BUF_SIZE]
+	STREAM_MEMORY_SECTION;
+
+static void stream_stop(int error)
+{
+	nrf_saadc_int_disable(NRF_SAADC, NRF_SAADC_INT_STARTED);
+	nrf_saadc_continuous_mode_disable(NRF_SAADC);
+	nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_STOP);
+	while (!nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STOPPED)) {
+	}
+	nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+	nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+	nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+	nrf_saadc_disable(NRF_SAADC);
+
+	m_data.streaming = false;
+	k_sem_give(&m_data.ctx.lock);
+
+	adc_stream_stop(&m_data.stream, error);
+}
+
+static void stream_irq_handler(void)
+{
+	int error;
+
+	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STARTED)) {
+		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+
+		/* The buffer pointer is double buffered, queue the next block */
+		nrf_saadc_buffer_pointer_set(NRF_SAADC, stream_buffers[m_data.stream_buf ^ 1]);
+
+		if (!m_data.stream_sampling) {
+			/* Starts the internal timer */
+			m_data.stream_sampling = true;
+			nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_SAMPLE);
+		}
+	}
+
+	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_END)) {
+		const nrf_saadc_value_t *block = stream_buffers[m_data.stream_buf];
+
+		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+
+		/* Switch to the queued block before handling the finished one */
+		nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+		m_data.stream_buf ^= 1;
+
+		error = adc_stream_write(&m_data.stream, block, ARRAY_SIZE(stream_buffers[0]));
+		if (error) {
+			stream_stop(error);
+		}
+	}
+}
+
+/* Implementation of the ADC driver API function: submit. */
+static void adc_nrfx_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct adc_sequence sequence = {
+		.channels = cfg->channels,
+		.resolution = cfg->resolution,
+		.oversampling = cfg->oversampling,
+	};
+	uint32_t cc = cfg->interval_us * STREAM_TIMER_TICKS_PER_US;
+	uint8_t active_channels;
+	int error;
+
+	ARG_UNUSED(dev);
+
+	if (adc_stream_resubmit(&m_data.stream, iodev_sqe)) {
+		return;
+	}
+
+	/* The internal timer only paces single channel samplings */
+	if (POPCOUNT(cfg->channels) != 1 || cfg->oversampling != 0 ||
+	    cc < STREAM_TIMER_CC_MIN || cc > STREAM_TIMER_CC_MAX) {
+		LOG_ERR("Unsupported stream configuration");
+		adc_stream_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	if (k_sem_take(&m_data.ctx.lock, K_NO_WAIT) != 0) {
+		adc_stream_err(iodev_sqe, -EBUSY);
+		return;
+	}
+
+	error = setup_sequence(&sequence, &active_channels);
+	if (!error) {
+		error = adc_stream_start(&m_data.stream, iodev_sqe,
+					 samples_to_bytes(&sequence, 1), true);
+	}
+
+	if (error) {
+		k_sem_give(&m_data.ctx.lock);
+		adc_stream_err(iodev_sqe, error);
+		return;
+	}
+
+	m_data.streaming = true;
+	m_data.stream_sampling = false;
+	m_data.stream_buf = 0;
+
+	nrf_saadc_buffer_init(NRF_SAADC, stream_buffers[0], ARRAY_SIZE(stream_buffers[0]));
+	nrf_saadc_continuous_mode_enable(NRF_SAADC, cc);
+	nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+	nrf_saadc_int_enable(NRF_SAADC, NRF_SAADC_INT_STARTED);
+	nrf_saadc_enable(NRF_SAADC);
+	nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+}
+#endif /* CONFIG_ADC_STREAM */
+
 static void saadc_irq_handler(const struct device *dev)
 {
+#ifdef CONFIG_ADC_STREAM
+	if (m_data.streaming) {
+		stream_irq_handler();
+		return;
+	}
+#endif
+
 	if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_END)) {
 		nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
 
@@ -667,6 +824,9 @@ static const struct adc_driver_api adc_nrfx_driver_api = {
 #ifdef CONFIG_ADC_ASYNC
 	.read_async    = adc_nrfx_read_async,
 #endif
+#ifdef CONFIG_ADC_STREAM
+	.submit        = adc_nrfx_submit,
+#endif
 #if defined(CONFIG_SOC_NRF54L15)
 	.ref_internal  = 900,
 #elif defined(CONFIG_NRF_PLATFORM_HALTIUM)
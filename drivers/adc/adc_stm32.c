@@ -34,6 +34,12 @@
 #include <stm32_ll_dma.h>
 #endif
 
+#ifdef CONFIG_ADC_STM32_STREAM
+#include <zephyr/drivers/counter.h>
+#include <stm32_ll_tim.h>
+#include "adc_stream.h"
+#endif
+
 #define ADC_CONTEXT_USES_KERNEL_TIMER
 #define ADC_CONTEXT_ENABLE_ON_COMPLETE
 #include "adc_context.h"
@@ -198,6 +204,13 @@ struct adc_stm32_data {
 	volatile int dma_error;
 	struct stream dma;
 #endif
+
+#ifdef CONFIG_ADC_STM32_STREAM
+	struct adc_stream stream;
+	/* Samples of the circular DMA buffer used by the stream */
+	uint32_t stream_samples;
+	bool streaming;
+#endif
 };
 
 struct adc_stm32_cfg {
@@ -211,24 +224,37 @@ struct adc_stm32_cfg {
 	int8_t num_sampling_time_common_channels;
 	int8_t sequencer_type;
 	int8_t res_table_size;
+#ifdef CONFIG_ADC_STM32_STREAM
+	/* Counter of the timer triggering the conversions of streams, NULL if none */
+	const struct device *stream_counter;
+	TIM_TypeDef *stream_timer;
+	/* External trigger selection of the timer TRGO output */
+	uint32_t stream_trigger;
+	uint16_t *stream_buf;
+#endif
 	const uint32_t res_table[];
 };
 
 #ifdef CONFIG_ADC_STM32_DMA
-static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
+static void adc_stm32_enable_dma_support(ADC_TypeDef *adc, bool circular)
 {
-	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers */
+	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers,
+	 * or to circular mode for streams.
+	 */
 
 #if defined(CONFIG_SOC_SERIES_STM32H7X)
 
 #if defined(ADC_VER_V5_V90)
 	if (adc == ADC3) {
-		LL_ADC_REG_SetDMATransferMode(adc, LL_ADC3_REG_DMA_TRANSFER_LIMITED);
+		LL_ADC_REG_SetDMATransferMode(adc, circular ? LL_ADC3_REG_DMA_TRANSFER_UNLIMITED
+							    : LL_ADC3_REG_DMA_TRANSFER_LIMITED);
 	} else {
-		LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+		LL_ADC_REG_SetDataTransferMode(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+							     : LL_ADC_REG_DMA_TRANSFER_LIMITED);
 	}
 #elif defined(ADC_VER_V5_X)
-	LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDataTransferMode(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+						     : LL_ADC_REG_DMA_TRANSFER_LIMITED);
 #else
 #error "Unsupported ADC version"
 #endif
@@ -240,15 +266,18 @@ static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
 #elif defined(CONFIG_SOC_SERIES_STM32U5X) /* DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
 
 	if (adc == ADC4) {
-		LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED_ADC4);
+		LL_ADC_REG_SetDMATransfer(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED_ADC4
+							: LL_ADC_REG_DMA_TRANSFER_LIMITED_ADC4);
 	} else {
-		LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+		LL_ADC_REG_SetDataTransferMode(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+							     : LL_ADC_REG_DMA_TRANSFER_LIMITED);
 	}
 
 #else /* defined(CONFIG_SOC_SERIES_STM32U5X) */
 
 	/* Default mechanism for other MCUs */
-	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDMATransfer(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+						: LL_ADC_REG_DMA_TRANSFER_LIMITED);
 
 #endif
 }
@@ -294,7 +323,7 @@ static int adc_stm32_dma_start(const struct device *dev,
 		return ret;
 	}
 
-	adc_stm32_enable_dma_support(adc);
+	adc_stm32_enable_dma_support(adc, false);
 
 	data->dma_error = 0;
 	ret = dma_start(data->dma.dma_dev, data->dma.channel);
@@ -780,6 +809,10 @@ static int adc_stm32_oversampling(ADC_TypeDef *adc, uint8_t ratio)
 }
 #endif /* CONFIG_SOC_SERIES_STM32xxx */
 
+#ifdef CONFIG_ADC_STM32_STREAM
+static void adc_stm32_stream_dma_callback(struct adc_stm32_data *data, int status);
+#endif
+
 #ifdef CONFIG_ADC_STM32_DMA
 static void dma_callback(const struct device *dev, void *user_data,
 			 uint32_t channel, int status)
@@ -791,6 +824,13 @@ static void dma_callback(const struct device *dev, void *user_data,
 
 	LOG_DBG("dma callback");
 
+#ifdef CONFIG_ADC_STM32_STREAM
+	if (data->streaming) {
+		adc_stm32_stream_dma_callback(data, status);
+		return;
+	}
+#endif
+
 	if (channel == data->dma.channel) {
 #if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
 		if (LL_ADC_IsActiveFlag_OVR(adc) || (status >= 0)) {
@@ -1201,6 +1241,253 @@ static int adc_stm32_read_async(const struct device *dev,
 }
 #endif
 
+#ifdef CONFIG_ADC_STM32_STREAM
+/* Select the hardware trigger of the regular conversions, on its rising edge */
+static int adc_stm32_stream_trigger(ADC_TypeDef *adc, uint32_t extsel, bool enable)
+{
+	uint32_t exten = enable ? 1U : 0U;
+
+#if defined(ADC_CFGR_EXTEN)
+	MODIFY_REG(adc->CFGR, ADC_CFGR_EXTSEL | ADC_CFGR_EXTEN,
+		   (extsel << ADC_CFGR_EXTSEL_Pos) | (exten << ADC_CFGR_EXTEN_Pos));
+#elif defined(ADC_CFGR1_EXTEN)
+	MODIFY_REG(adc->CFGR1, ADC_CFGR1_EXTSEL | ADC_CFGR1_EXTEN,
+		   (extsel << ADC_CFGR1_EXTSEL_Pos) | (exten << ADC_CFGR1_EXTEN_Pos));
+#elif defined(ADC_CR2_EXTEN)
+	MODIFY_REG(adc->CR2, ADC_CR2_EXTSEL | ADC_CR2_EXTEN,
+		   (extsel << ADC_CR2_EXTSEL_Pos) | (exten << ADC_CR2_EXTEN_Pos));
+#else
+	ARG_UNUSED(adc);
+	ARG_UNUSED(extsel);
+	ARG_UNUSED(exten);
+
+	return -ENOTSUP;
+#endif
+
+	return 0;
+}
+
+static int adc_stm32_stream_dma_start(const struct device *dev)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	struct adc_stm32_data *data = dev->data;
+	struct dma_block_config *blk_cfg = &data->dma.dma_blk_cfg;
+	int ret;
+
+	/* Circular transfer, the DMA reports each half of the buffer */
+	blk_cfg->block_size = data->stream_samples * sizeof(uint16_t);
+	blk_cfg->source_address = (uint32_t)LL_ADC_DMA_GetRegAddr(adc, LL_ADC_DMA_REG_REGULAR_DATA);
+	blk_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+	blk_cfg->source_reload_en = 1;
+	blk_cfg->dest_address = (uint32_t)config->stream_buf;
+	blk_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+	blk_cfg->dest_reload_en = 1;
+	blk_cfg->fifo_mode_control = 0;
+
+	data->dma.dma_cfg.head_block = blk_cfg;
+	data->dma.dma_cfg.user_data = data;
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
+	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
+#endif
+
+	ret = dma_config(data->dma.dma_dev, data->dma.channel, &data->dma.dma_cfg);
+	if (ret != 0) {
+		return ret;
+	}
+
+	adc_stm32_enable_dma_support(adc, true);
+
+	return dma_start(data->dma.dma_dev, data->dma.channel);
+}
+
+static void adc_stm32_stream_stop(const struct device *dev, int err)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+
+	counter_stop(config->stream_counter);
+	LL_TIM_SetTriggerOutput(config->stream_timer, LL_TIM_TRGO_RESET);
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	LL_ADC_REG_StopConversion(adc);
+	while (LL_ADC_REG_IsStopConversionOngoing(adc) == 1UL) {
+	}
+#endif
+
+	dma_stop(data->dma.dma_dev, data->dma.channel);
+	(void)adc_stm32_stream_trigger(adc, 0, false);
+	adc_context_on_complete(&data->ctx, err);
+
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	data->streaming = false;
+	k_sem_give(&data->ctx.lock);
+	adc_stream_stop(&data->stream, err);
+}
+
+static void adc_stm32_stream_dma_callback(struct adc_stm32_data *data, int status)
+{
+	const struct adc_stm32_cfg *config = data->dev->config;
+	uint32_t half = data->stream_samples / 2;
+	int err;
+
+	if (status < 0) {
+		LOG_ERR("DMA reported error %d while streaming", status);
+		adc_stm32_stream_stop(data->dev, status);
+		return;
+	}
+
+	/* Half transfer reports the first half, transfer complete the second one */
+	err = adc_stream_write(&data->stream,
+			       &config->stream_buf[status == DMA_STATUS_BLOCK ? 0 : half],
+			       half / data->channel_count);
+	if (err < 0) {
+		adc_stm32_stream_stop(data->dev, err);
+	}
+}
+
+static int adc_stm32_stream_start(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = (ADC_TypeDef *)config->base;
+	const struct adc_sequence sequence = {
+		.channels = cfg->channels,
+		.resolution = cfg->resolution,
+		.oversampling = cfg->oversampling,
+	};
+	struct counter_top_cfg top_cfg = { 0 };
+	int err;
+
+	data->channels = cfg->channels;
+	data->channel_count = POPCOUNT(cfg->channels);
+
+#if ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE)
+	if (data->channel_count > ARRAY_SIZE(table_seq_len)) {
+		return -EINVAL;
+	}
+#endif /* ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE) */
+
+	/* Whole samplings in each half of the buffer */
+	data->stream_samples = ROUND_DOWN(CONFIG_ADC_STM32_STREAM_BUF_SIZE,
+					  2 * MAX(data->channel_count, 1));
+	if (data->stream_samples == 0) {
+		return -EINVAL;
+	}
+
+	top_cfg.ticks = counter_us_to_ticks(config->stream_counter, cfg->interval_us);
+	if (top_cfg.ticks < 2 ||
+	    top_cfg.ticks - 1 > counter_get_max_top_value(config->stream_counter)) {
+		LOG_ERR("Stream interval out of range of the timer");
+		return -ENOTSUP;
+	}
+	top_cfg.ticks--;
+
+	err = set_resolution(dev, &sequence);
+	if (err < 0) {
+		return err;
+	}
+
+	err = set_sequencer(dev);
+	if (err < 0) {
+		return err;
+	}
+
+#ifdef HAS_OVERSAMPLING
+	err = adc_stm32_oversampling(adc, sequence.oversampling);
+	if (err) {
+		return err;
+	}
+#else
+	if (sequence.oversampling) {
+		return -ENOTSUP;
+	}
+#endif /* HAS_OVERSAMPLING */
+
+	adc_stm32_enable(adc);
+
+	/* Nothing is converted until the timer runs */
+	err = adc_stm32_stream_dma_start(dev);
+	if (err == 0) {
+		err = adc_stm32_stream_trigger(adc, config->stream_trigger, true);
+	}
+	if (err == 0) {
+		err = counter_set_top_value(config->stream_counter, &top_cfg);
+	}
+	if (err == 0) {
+		err = adc_stream_start(&data->stream, iodev_sqe, sizeof(uint16_t), false);
+	}
+	if (err < 0) {
+		LOG_ERR("Problem starting the stream: %d", err);
+		dma_stop(data->dma.dma_dev, data->dma.channel);
+		(void)adc_stm32_stream_trigger(adc, 0, false);
+		return err;
+	}
+
+	data->streaming = true;
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
+	LL_ADC_ClearFlag_OVR(adc);
+#endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
+
+	/* Conversions are triggered by the update events of the timer */
+	LL_TIM_SetTriggerOutput(config->stream_timer, LL_TIM_TRGO_UPDATE);
+#if !defined(ADC_CR2_EXTEN)
+	/* Arms the hardware trigger */
+	adc_stm32_start_conversion(dev);
+#endif
+	counter_start(config->stream_counter);
+
+	return 0;
+}
+
+static void adc_stm32_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	int err;
+
+	if (adc_stream_resubmit(&data->stream, iodev_sqe)) {
+		return;
+	}
+
+	if (config->stream_counter == NULL || data->dma.dma_dev == NULL) {
+		LOG_ERR("Streams need a timer and a DMA channel");
+		adc_stream_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	if (k_sem_take(&data->ctx.lock, K_NO_WAIT) != 0) {
+		adc_stream_err(iodev_sqe, -EBUSY);
+		return;
+	}
+
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	err = adc_stm32_stream_start(dev, iodev_sqe);
+	if (err < 0) {
+		adc_context_on_complete(&data->ctx, err);
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+		if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+			pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+		}
+		k_sem_give(&data->ctx.lock);
+		adc_stream_err(iodev_sqe, err);
+	}
+}
+#endif /* CONFIG_ADC_STM32_STREAM */
+
 static int adc_stm32_sampling_time_check(const struct device *dev, uint16_t acq_time)
 {
 	const struct adc_stm32_cfg *config =
@@ -1732,6 +2019,9 @@ static const struct adc_driver_api api_stm32_driver_api = {
 	.read = adc_stm32_read,
 #ifdef CONFIG_ADC_ASYNC
 	.read_async = adc_stm32_read_async,
+#endif
+#ifdef CONFIG_ADC_STM32_STREAM
+	.submit = adc_stm32_submit,
 #endif
 	.ref_internal = STM32_ADC_VREF_MV, /* VREF is usually connected to VDD */
 };
@@ -1900,6 +2190,26 @@ DT_INST_FOREACH_STATUS_OKAY(GENERATE_ISR)
 
 #endif /* CONFIG_ADC_STM32_DMA */
 
+#ifdef CONFIG_ADC_STM32_STREAM
+#define ADC_STM32_STREAM_COUNTER(index) DT_INST_PHANDLE(index, st_stream_counter)
+
+#define ADC_STM32_STREAM_BUF(index)							\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(index, st_stream_counter),			\
+		(static uint16_t adc_stm32_stream_buf_##index				\
+			[CONFIG_ADC_STM32_STREAM_BUF_SIZE] __nocache;))
+
+#define ADC_STM32_STREAM_CFG(index)							\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(index, st_stream_counter),			\
+		(.stream_counter = DEVICE_DT_GET(ADC_STM32_STREAM_COUNTER(index)),	\
+		 .stream_timer = (TIM_TypeDef *)DT_REG_ADDR(				\
+			DT_PARENT(ADC_STM32_STREAM_COUNTER(index))),			\
+		 .stream_trigger = DT_INST_PROP(index, st_stream_trigger),		\
+		 .stream_buf = adc_stm32_stream_buf_##index,))
+#else
+#define ADC_STM32_STREAM_BUF(index)
+#define ADC_STM32_STREAM_CFG(index)
+#endif /* CONFIG_ADC_STM32_STREAM */
+
 #define ADC_DMA_CHANNEL(id, src, dest)							\
 	COND_CODE_1(DT_INST_DMAS_HAS_IDX(id, 0),					\
 			(ADC_DMA_CHANNEL_INIT(id, src, dest)),				\
@@ -1914,6 +2224,8 @@ PINCTRL_DT_INST_DEFINE(index);						\
 static const struct stm32_pclken pclken_##index[] =			\
 				 STM32_DT_INST_CLOCKS(index);		\
 									\
+ADC_STM32_STREAM_BUF(index)						\
+									\
 static const struct adc_stm32_cfg adc_stm32_cfg_##index = {		\
 	.base = (ADC_TypeDef *)DT_INST_REG_ADDR(index),			\
 	ADC_STM32_IRQ_FUNC(index)					\
@@ -1927,6 +2239,7 @@ static const struct adc_stm32_cfg adc_stm32_cfg_##index = {		\
 		DT_INST_PROP_OR(index, num_sampling_time_common_channels, 0),\
 	.res_table_size = DT_INST_PROP_LEN(index, resolutions),		\
 	.res_table = DT_INST_PROP(index, resolutions),			\
+	ADC_STM32_STREAM_CFG(index)					\
 };									\
 									\
 static struct adc_stm32_data adc_stm32_data_##index = {			\
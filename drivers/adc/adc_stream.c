@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/time_units.h>
+
+#include "adc_stream.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(adc_stream, CONFIG_ADC_LOG_LEVEL);
+
+static void adc_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct adc_driver_api *api = cfg->dev->api;
+
+	if (api->submit == NULL) {
+		adc_stream_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	api->submit(cfg->dev, iodev_sqe);
+}
+
+const struct rtio_iodev_api __adc_iodev_api = {
+	.submit = adc_iodev_submit,
+};
+
+void adc_stream_err(struct rtio_iodev_sqe *iodev_sqe, int err)
+{
+	/* RTIO submits a multishot request again after an error, unless it is
+	 * cancelled. Drop the flag so the error ends the stream. A cancelled
+	 * request keeps it, for RTIO to free its buffer.
+	 */
+	if (!FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+	}
+
+	rtio_iodev_sqe_err(iodev_sqe, err);
+}
+
+int adc_stream_start(struct adc_stream *stream, struct rtio_iodev_sqe *iodev_sqe,
+		     uint8_t sample_size, bool is_signed)
+{
+	const struct adc_stream_config *cfg = iodev_sqe->sqe.iodev->data;
+
+	if (cfg->channels == 0 || cfg->samplings == 0 || cfg->interval_us == 0) {
+		return -EINVAL;
+	}
+
+	stream->sqe = iodev_sqe;
+	stream->buf = NULL;
+	stream->channel_count = POPCOUNT(cfg->channels);
+	stream->sample_size = sample_size;
+	stream->is_signed = is_signed;
+	stream->dropped = 0;
+
+	return 0;
+}
+
+bool adc_stream_resubmit(struct adc_stream *stream, struct rtio_iodev_sqe *iodev_sqe)
+{
+	if (stream->sqe == NULL || stream->sqe != iodev_sqe) {
+		return false;
+	}
+
+	stream->resubmitted = true;
+
+	return true;
+}
+
+static bool adc_stream_buf_get(struct adc_stream *stream, uint64_t timestamp_ns)
+{
+	const struct adc_stream_config *cfg = stream->sqe->sqe.iodev->data;
+	uint32_t size = adc_stream_buf_size(cfg, stream->sample_size);
+	struct adc_stream_header *hdr;
+	uint32_t len;
+	uint8_t *buf;
+
+	if (rtio_sqe_rx_buf(stream->sqe, size, size, &buf, &len) != 0) {
+		return false;
+	}
+
+	hdr = (struct adc_stream_header *)buf;
+	hdr->timestamp_ns = timestamp_ns;
+	hdr->interval_ns = cfg->interval_us * NSEC_PER_USEC;
+	hdr->channels = cfg->channels;
+	hdr->count = 0;
+	hdr->resolution = cfg->resolution;
+	hdr->sample_size = stream->sample_size;
+	hdr->is_signed = stream->is_signed;
+	stream->buf = buf;
+
+	return true;
+}
+
+static int adc_stream_complete(struct adc_stream *stream)
+{
+	struct rtio_iodev_sqe *sqe = stream->sqe;
+
+	stream->buf = NULL;
+	stream->resubmitted = false;
+
+	rtio_iodev_sqe_ok(sqe, 0);
+
+	/* RTIO does not submit the stream again once cancelled */
+	if (!stream->resubmitted) {
+		stream->sqe = NULL;
+		return -ECANCELED;
+	}
+
+	return 0;
+}
+
+int adc_stream_write(struct adc_stream *stream, const void *samples, uint32_t count)
+{
+	const struct adc_stream_config *cfg;
+	const uint8_t *src = samples;
+	uint32_t frame_size;
+	uint64_t interval_ns;
+	uint64_t timestamp_ns;
+	int rc;
+
+	if (stream->sqe == NULL) {
+		return -ECANCELED;
+	}
+
+	if (FIELD_GET(RTIO_SQE_CANCELED, stream->sqe->sqe.flags)) {
+		return -ECANCELED;
+	}
+
+	cfg = stream->sqe->sqe.iodev->data;
+	frame_size = stream->channel_count * stream->sample_size;
+	interval_ns = (uint64_t)cfg->interval_us * NSEC_PER_USEC;
+	timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks()) - (count - 1) * interval_ns;
+
+	while (count > 0) {
+		struct adc_stream_header *hdr;
+		uint32_t n;
+
+		if (stream->buf == NULL && !adc_stream_buf_get(stream, timestamp_ns)) {
+			stream->dropped += count;
+			LOG_DBG("No buffer, %u samplings dropped", stream->dropped);
+			return 0;
+		}
+
+		hdr = (struct adc_stream_header *)stream->buf;
+		n = MIN(count, cfg->samplings - hdr->count);
+
+		memcpy(stream->buf + sizeof(*hdr) + hdr->count * frame_size, src, n * frame_size);
+		hdr->count += n;
+		src += n * frame_size;
+		count -= n;
+		timestamp_ns += n * interval_ns;
+
+		if (hdr->count == cfg->samplings) {
+			rc = adc_stream_complete(stream);
+			if (rc < 0) {
+				return rc;
+			}
+		}
+	}
+
+	return 0;
+}
+
+void adc_stream_stop(struct adc_stream *stream, int err)
+{
+	struct rtio_iodev_sqe *sqe = stream->sqe;
+
+	if (sqe == NULL) {
+		return;
+	}
+
+	stream->sqe = NULL;
+	stream->buf = NULL;
+
+	adc_stream_err(sqe, err);
+}
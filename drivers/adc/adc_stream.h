@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_ADC_ADC_STREAM_H_
+#define ZEPHYR_DRIVERS_ADC_ADC_STREAM_H_
+
+#include <zephyr/drivers/adc.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Helper for drivers implementing ADC streams. The driver converts into its
+ * own DMA buffers and hands the completed blocks to adc_stream_write(), which
+ * copies them into the buffers of the stream and completes these once full.
+ * The conversions are never stopped by a slow consumer: samplings arriving
+ * while no buffer is available are dropped.
+ */
+struct adc_stream {
+	/* Submission of the running stream, NULL if none is running */
+	struct rtio_iodev_sqe *sqe;
+	/* Buffer being filled, NULL if none is available */
+	uint8_t *buf;
+	uint8_t channel_count;
+	uint8_t sample_size;
+	bool is_signed;
+	bool resubmitted;
+	/* Samplings dropped since the stream started */
+	uint32_t dropped;
+};
+
+/*
+ * Fail the submission of a stream with err, without RTIO submitting it
+ * again. To be used instead of rtio_iodev_sqe_err().
+ */
+void adc_stream_err(struct rtio_iodev_sqe *iodev_sqe, int err);
+
+/*
+ * Start a stream for iodev_sqe. Fails with -EINVAL if its configuration
+ * is invalid.
+ */
+int adc_stream_start(struct adc_stream *stream, struct rtio_iodev_sqe *iodev_sqe,
+		     uint8_t sample_size, bool is_signed);
+
+/*
+ * Multishot submissions are submitted again by RTIO each time a buffer is
+ * completed. Returns true if iodev_sqe is such a resubmission, which the
+ * driver must ignore.
+ */
+bool adc_stream_resubmit(struct adc_stream *stream, struct rtio_iodev_sqe *iodev_sqe);
+
+/*
+ * Write count samplings, the last one having just been converted. A negative
+ * return value means the stream must end: the driver stops the conversions,
+ * then calls adc_stream_stop() with that value.
+ */
+int adc_stream_write(struct adc_stream *stream, const void *samples, uint32_t count);
+
+/* End the stream with err, after the conversions are stopped. */
+void adc_stream_stop(struct adc_stream *stream, int err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_ADC_ADC_STREAM_H_ */
@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/can_sw_filter.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/util.h>
@@ -23,19 +24,15 @@ struct can_loopback_frame {
 	void *cb_arg;
 };
 
-struct can_loopback_filter {
-	can_rx_callback_t rx_cb;
-	void *cb_arg;
-	struct can_filter filter;
-};
-
 struct can_loopback_config {
 	const struct can_driver_config common;
 };
 
 struct can_loopback_data {
 	struct can_driver_data common;
-	struct can_loopback_filter filters[CONFIG_CAN_MAX_FILTER];
+	struct can_sw_filter filters;
+	struct can_sw_filter_entry filter_entries[CONFIG_CAN_MAX_FILTER];
+	uint16_t filter_masked[CONFIG_CAN_MAX_FILTER];
 	struct k_mutex mtx;
 	struct k_msgq tx_msgq;
 	char msgq_buffer[CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE * sizeof(struct can_loopback_frame)];
@@ -45,26 +42,11 @@ struct can_loopback_data {
 		      CONFIG_CAN_LOOPBACK_TX_THREAD_STACK_SIZE);
 };
 
-static void receive_frame(const struct device *dev,
-			  const struct can_frame *frame,
-			  struct can_loopback_filter *filter)
-{
-	struct can_frame frame_tmp = *frame;
-
-	LOG_DBG("Receiving %d bytes. Id: 0x%x, ID type: %s %s",
-		frame->dlc, frame->id,
-		(frame->flags & CAN_FRAME_IDE) != 0 ? "extended" : "standard",
-		(frame->flags & CAN_FRAME_RTR) != 0 ? ", RTR frame" : "");
-
-	filter->rx_cb(dev, &frame_tmp, filter->cb_arg);
-}
-
 static void tx_thread(void *arg1, void *arg2, void *arg3)
 {
 	const struct device *dev = arg1;
 	struct can_loopback_data *data = dev->data;
 	struct can_loopback_frame frame;
-	struct can_loopback_filter *filter;
 	int ret;
 
 	ARG_UNUSED(arg2);
@@ -88,16 +70,13 @@ static void tx_thread(void *arg1, void *arg2, void *arg3)
 		}
 #endif /* !CONFIG_CAN_ACCEPT_RTR */
 
-		k_mutex_lock(&data->mtx, K_FOREVER);
-
-		for (int i = 0; i < CONFIG_CAN_MAX_FILTER; i++) {
-			filter = &data->filters[i];
-			if (filter->rx_cb != NULL &&
-			    can_frame_matches_filter(&frame.frame, &filter->filter)) {
-				receive_frame(dev, &frame.frame, filter);
-			}
-		}
+		LOG_DBG("Receiving %d bytes. Id: 0x%x, ID type: %s %s",
+			frame.frame.dlc, frame.frame.id,
+			(frame.frame.flags & CAN_FRAME_IDE) != 0 ? "extended" : "standard",
+			(frame.frame.flags & CAN_FRAME_RTR) != 0 ? ", RTR frame" : "");
 
+		k_mutex_lock(&data->mtx, K_FOREVER);
+		can_sw_filter_dispatch(&data->filters, dev, &frame.frame);
 		k_mutex_unlock(&data->mtx);
 	}
 }
@@ -160,23 +139,10 @@ static int can_loopback_send(const struct device *dev,
 	return 0;
 }
 
-
-static inline int get_free_filter(struct can_loopback_filter *filters)
-{
-	for (int i = 0; i < CONFIG_CAN_MAX_FILTER; i++) {
-		if (filters[i].rx_cb == NULL) {
-			return i;
-		}
-	}
-
-	return -ENOSPC;
-}
-
 static int can_loopback_add_rx_filter(const struct device *dev, can_rx_callback_t cb,
 				      void *cb_arg, const struct can_filter *filter)
 {
 	struct can_loopback_data *data = dev->data;
-	struct can_loopback_filter *loopback_filter;
 	int filter_id;
 
 	LOG_DBG("Setting filter ID: 0x%x, mask: 0x%x", filter->id, filter->mask);
@@ -187,21 +153,14 @@ static int can_loopback_add_rx_filter(const struct device *dev, can_rx_callback_
 	}
 
 	k_mutex_lock(&data->mtx, K_FOREVER);
-	filter_id = get_free_filter(data->filters);
+	filter_id = can_sw_filter_add(&data->filters, cb, cb_arg, filter);
+	k_mutex_unlock(&data->mtx);
 
 	if (filter_id < 0) {
 		LOG_ERR("No free filter left");
-		k_mutex_unlock(&data->mtx);
 		return filter_id;
 	}
 
-	loopback_filter = &data->filters[filter_id];
-
-	loopback_filter->rx_cb = cb;
-	loopback_filter->cb_arg = cb_arg;
-	loopback_filter->filter = *filter;
-	k_mutex_unlock(&data->mtx);
-
 	LOG_DBG("Filter added. ID: %d", filter_id);
 
 	return filter_id;
@@ -211,14 +170,14 @@ static void can_loopback_remove_rx_filter(const struct device *dev, int filter_i
 {
 	struct can_loopback_data *data = dev->data;
 
-	if (filter_id < 0 || filter_id >= ARRAY_SIZE(data->filters)) {
+	if (filter_id < 0 || filter_id >= ARRAY_SIZE(data->filter_entries)) {
 		LOG_ERR("filter ID %d out-of-bounds", filter_id);
 		return;
 	}
 
 	LOG_DBG("Remove filter ID: %d", filter_id);
 	k_mutex_lock(&data->mtx, K_FOREVER);
-	data->filters[filter_id].rx_cb = NULL;
+	(void)can_sw_filter_remove(&data->filters, filter_id);
 	k_mutex_unlock(&data->mtx);
 }
 
@@ -420,9 +379,8 @@ static int can_loopback_init(const struct device *dev)
 
 	k_mutex_init(&data->mtx);
 
-	for (int i = 0; i < CONFIG_CAN_MAX_FILTER; i++) {
-		data->filters[i].rx_cb = NULL;
-	}
+	can_sw_filter_init(&data->filters, data->filter_entries, data->filter_masked,
+			   ARRAY_SIZE(data->filter_entries));
 
 	k_msgq_init(&data->tx_msgq, data->msgq_buffer, sizeof(struct can_loopback_frame),
 		    CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE);
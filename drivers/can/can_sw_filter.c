@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/can/can_sw_filter.h>
+
+static bool filter_is_exact(const struct can_filter *filter)
+{
+	uint32_t id_mask = (filter->flags & CAN_FILTER_IDE) != 0 ? CAN_EXT_ID_MASK :
+								   CAN_STD_ID_MASK;
+
+	return (filter->mask & id_mask) == id_mask;
+}
+
+static inline uint32_t key_hash(uint32_t id, bool ide)
+{
+	uint32_t key = id & (ide ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK);
+
+	if (ide) {
+		key |= BIT(31);
+	}
+
+	/* Multiplicative (Fibonacci) hashing, keeps the top bits */
+	return (key * 0x9e3779b1U) >> (32 - CONFIG_CAN_SW_FILTER_HASH_BITS);
+}
+
+static inline uint32_t filter_hash(const struct can_filter *filter)
+{
+	return key_hash(filter->id, (filter->flags & CAN_FILTER_IDE) != 0);
+}
+
+void can_sw_filter_init(struct can_sw_filter *sw, struct can_sw_filter_entry *entries,
+			uint16_t *masked, uint16_t max_filters)
+{
+	__ASSERT_NO_MSG(max_filters <= INT16_MAX);
+
+	sw->entries = entries;
+	sw->masked = masked;
+	sw->max_filters = max_filters;
+	sw->masked_count = 0U;
+
+	for (int i = 0; i < max_filters; i++) {
+		entries[i].callback = NULL;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(sw->buckets); i++) {
+		sw->buckets[i] = -1;
+	}
+}
+
+int can_sw_filter_add(struct can_sw_filter *sw, can_rx_callback_t callback, void *user_data,
+		      const struct can_filter *filter)
+{
+	struct can_sw_filter_entry *entry;
+	uint32_t hash;
+	int filter_id;
+
+	for (filter_id = 0; filter_id < sw->max_filters; filter_id++) {
+		if (sw->entries[filter_id].callback == NULL) {
+			break;
+		}
+	}
+
+	if (filter_id == sw->max_filters) {
+		return -ENOSPC;
+	}
+
+	entry = &sw->entries[filter_id];
+	entry->filter = *filter;
+	entry->callback = callback;
+	entry->user_data = user_data;
+	entry->next = -1;
+
+	if (filter_is_exact(filter)) {
+		hash = filter_hash(filter);
+		entry->next = sw->buckets[hash];
+		sw->buckets[hash] = filter_id;
+	} else {
+		sw->masked[sw->masked_count++] = filter_id;
+	}
+
+	return filter_id;
+}
+
+int can_sw_filter_remove(struct can_sw_filter *sw, int filter_id)
+{
+	struct can_sw_filter_entry *entry;
+	int16_t *link;
+
+	if (filter_id < 0 || filter_id >= sw->max_filters ||
+	    sw->entries[filter_id].callback == NULL) {
+		return -EINVAL;
+	}
+
+	entry = &sw->entries[filter_id];
+
+	if (filter_is_exact(&entry->filter)) {
+		link = &sw->buckets[filter_hash(&entry->filter)];
+		while (*link != filter_id) {
+			__ASSERT_NO_MSG(*link >= 0);
+			link = &sw->entries[*link].next;
+		}
+
+		*link = entry->next;
+	} else {
+		for (int i = 0; i < sw->masked_count; i++) {
+			if (sw->masked[i] == filter_id) {
+				/* Keep the table packed */
+				sw->masked[i] = sw->masked[--sw->masked_count];
+				break;
+			}
+		}
+	}
+
+	entry->callback = NULL;
+
+	return 0;
+}
+
+static inline void deliver(const struct can_sw_filter_entry *entry, const struct device *dev,
+			   const struct can_frame *frame)
+{
+	/* Make a temporary copy in case the user modifies the message */
+	struct can_frame tmp_frame = *frame;
+
+	entry->callback(dev, &tmp_frame, entry->user_data);
+}
+
+void can_sw_filter_dispatch(const struct can_sw_filter *sw, const struct device *dev,
+			    const struct can_frame *frame)
+{
+	const struct can_sw_filter_entry *entry;
+	int16_t i;
+
+	i = sw->buckets[key_hash(frame->id, (frame->flags & CAN_FRAME_IDE) != 0)];
+	while (i >= 0) {
+		entry = &sw->entries[i];
+		/* Buckets are shared by several identifiers */
+		if (can_frame_matches_filter(frame, &entry->filter)) {
+			deliver(entry, dev, frame);
+		}
+
+		i = entry->next;
+	}
+
+	for (int j = 0; j < sw->masked_count; j++) {
+		entry = &sw->entries[sw->masked[j]];
+		if (can_frame_matches_filter(frame, &entry->filter)) {
+			deliver(entry, dev, frame);
+		}
+	}
+}
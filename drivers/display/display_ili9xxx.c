@@ -19,6 +19,9 @@ struct ili9xxx_data {
 	uint8_t bytes_per_pixel;
 	enum display_pixel_format pixel_format;
 	enum display_orientation orientation;
+	/* Completion of the running asynchronous write */
+	display_write_cb_t write_cb;
+	void *write_user_data;
 };
 
 #ifdef CONFIG_ILI9XXX_READ
@@ -185,6 +188,75 @@ static int ili9xxx_write(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
+static void ili9xxx_write_done(const struct device *mipi_dev, int result,
+			       void *user_data)
+{
+	const struct device *dev = user_data;
+	struct ili9xxx_data *data = dev->data;
+
+	ARG_UNUSED(mipi_dev);
+
+	if (data->write_cb != NULL) {
+		data->write_cb(dev, result, data->write_user_data);
+	}
+}
+
+static int ili9xxx_write_async(const struct device *dev, const uint16_t x,
+			       const uint16_t y,
+			       const struct display_buffer_descriptor *desc,
+			       const void *buf, display_write_cb_t cb,
+			       void *user_data)
+{
+	const struct ili9xxx_config *config = dev->config;
+	struct ili9xxx_data *data = dev->data;
+	struct display_buffer_descriptor mipi_desc;
+	int r;
+
+	if (desc->pitch > desc->width) {
+		/* Rows are sent one by one, which is not worth a background transfer */
+		r = ili9xxx_write(dev, x, y, desc, buf);
+		if (r == 0 && cb != NULL) {
+			cb(dev, 0, user_data);
+		}
+		return r;
+	}
+
+	r = ili9xxx_set_mem_area(dev, x, y, desc->width, desc->height);
+	if (r < 0) {
+		return r;
+	}
+
+	r = ili9xxx_transmit(dev, ILI9XXX_RAMWR, NULL, 0);
+	if (r < 0) {
+		return r;
+	}
+
+	mipi_desc.width = desc->width;
+	mipi_desc.height = desc->height;
+	mipi_desc.pitch = desc->width;
+	mipi_desc.buf_size = desc->width * data->bytes_per_pixel * desc->height;
+
+	/* Commands of a following write wait in the MIPI DBI controller for
+	 * the end of this transfer.
+	 */
+	data->write_cb = cb;
+	data->write_user_data = user_data;
+	r = mipi_dbi_write_display_async(config->mipi_dev, &config->dbi_config, buf,
+					 &mipi_desc, data->pixel_format,
+					 ili9xxx_write_done, (void *)dev);
+	if (r != -ENOSYS && r != -ENOTSUP) {
+		return r;
+	}
+
+	r = mipi_dbi_write_display(config->mipi_dev, &config->dbi_config, buf,
+				   &mipi_desc, data->pixel_format);
+	if (r == 0 && cb != NULL) {
+		cb(dev, 0, user_data);
+	}
+
+	return r;
+}
+
 #ifdef CONFIG_ILI9XXX_READ
 
 static int ili9xxx_read(const struct device *dev, const uint16_t x,
@@ -485,6 +557,7 @@ static const struct display_driver_api ili9xxx_api = {
 	.get_capabilities = ili9xxx_get_capabilities,
 	.set_pixel_format = ili9xxx_set_pixel_format,
 	.set_orientation = ili9xxx_set_orientation,
+	.write_async = ili9xxx_write_async,
 };
 
 #ifdef CONFIG_ILI9340
@@ -11,6 +11,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/drivers/reset.h>
 #include <zephyr/cache.h>
+#include <zephyr/sys/barrier.h>
 
 LOG_MODULE_REGISTER(dma_designware_axi, CONFIG_DMA_LOG_LEVEL);
 
@@ -223,6 +224,19 @@ struct dma_dw_axi_ch_data {
 	dma_callback_t dma_blk_xfer_callback;
 	/* user data for dma callback for dma block transfer completion */
 	void *priv_data_blk_tfr;
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+	/* ctl of the descriptors of the configuration, without the lli flags */
+	uint64_t lli_ctl;
+	/* source data size of the configuration */
+	uint32_t src_data_size;
+	/* last descriptor linked in the running list */
+	struct dma_lli *lli_desc_tail;
+	/* appended descriptor to restart from when the channel ended before its link */
+	struct dma_lli *lli_desc_restart;
+	/* descriptors appended and blocks completed since the channel started */
+	uint32_t append_count;
+	uint32_t blocks_done;
+#endif
 };
 
 /* dma controller driver data structure */
@@ -329,6 +343,10 @@ static void dma_dw_axi_isr(const struct device *dev)
 		sys_write64(DMA_DW_AXI_IRQ_ALL_ERR | DMA_DW_AXI_IRQ_BLOCK_TFR,
 				reg_base + DMA_DW_AXI_CH_INTCLEARREG(channel));
 
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+		chan_data->blocks_done++;
+#endif
+
 		if (chan_data->dma_blk_xfer_callback) {
 			chan_data->dma_blk_xfer_callback(dev,
 				chan_data->priv_data_blk_tfr, channel, ret_status);
@@ -340,11 +358,26 @@ static void dma_dw_axi_isr(const struct device *dev)
 		sys_write64(DMA_DW_AXI_IRQ_ALL_ERR | DMA_DW_AXI_IRQ_DMA_TFR,
 				reg_base + DMA_DW_AXI_CH_INTCLEARREG(channel));
 
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+		/* the list ended on a descriptor fetched before a block was appended to it */
+		if (chan_data->lli_desc_restart != NULL && ret_status == 0) {
+			sys_write64((uint64_t)chan_data->lli_desc_restart,
+				    reg_base + DMA_DW_AXI_CH_LLP(channel));
+			chan_data->lli_desc_restart = NULL;
+			sys_write64(CH_EN(channel), reg_base + DMA_DW_AXI_CHENREG);
+			return;
+		}
+
+		chan_data->lli_desc_restart = NULL;
+		chan_data->append_count = 0;
+		chan_data->blocks_done = 0;
+#endif
+
 		if (chan_data->dma_xfer_callback) {
 			chan_data->dma_xfer_callback(dev, chan_data->priv_data_xfer,
 						channel, ret_status);
-			chan_data->ch_state = dma_dw_axi_get_ch_status(dev, channel);
 		}
+		chan_data->ch_state = dma_dw_axi_get_ch_status(dev, channel);
 	}
 }
 
@@ -604,6 +637,16 @@ static int dma_dw_axi_config(const struct device *dev, uint32_t channel,
 
 	chan_data->lli_desc_current = chan_data->lli_desc_base;
 
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+	chan_data->lli_ctl = chan_data->lli_desc_base->ctl &
+			     ~(DMA_DW_AXI_CTL_LLI_VALID | DMA_DW_AXI_CTL_LLI_LAST);
+	chan_data->src_data_size = cfg->source_data_size;
+	chan_data->lli_desc_tail = &chan_data->lli_desc_base[cfg->block_count - 1];
+	chan_data->lli_desc_restart = NULL;
+	chan_data->append_count = 0;
+	chan_data->blocks_done = 0;
+#endif
+
 	/* enable an interrupt depending on whether the callback is requested after dma transfer
 	 * completion or dma block transfer completion
 	 *
@@ -812,6 +855,160 @@ static int dma_dw_axi_suspend(const struct device *dev, uint32_t channel)
 	return 0;
 }
 
+static int dma_dw_axi_chain_restart(const struct device *dev, uint32_t channel)
+{
+	struct dma_dw_axi_ch_data *chan_data;
+	struct dma_lli *lli_desc;
+	struct dma_dw_axi_dev_data *const dw_dev_data = DEV_DATA(dev);
+
+	/* validate channel number */
+	if (channel > (dw_dev_data->dma_ctx.dma_channels - 1)) {
+		LOG_ERR("invalid dma channel %d", channel);
+		return -EINVAL;
+	}
+
+	chan_data = &dw_dev_data->chan[channel];
+	if (chan_data->lli_desc_count == 0) {
+		return -EINVAL;
+	}
+
+	if (dma_dw_axi_get_ch_status(dev, channel) != DMA_DW_AXI_CH_IDLE) {
+		return -EBUSY;
+	}
+
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+	/* unlink the appended descriptors from the descriptors of the configuration */
+	lli_desc = &chan_data->lli_desc_base[chan_data->lli_desc_count - 1];
+	lli_desc->ctl |= DMA_DW_AXI_CTL_LLI_LAST;
+	lli_desc->llp = 0;
+	chan_data->lli_desc_tail = lli_desc;
+	chan_data->lli_desc_restart = NULL;
+	chan_data->append_count = 0;
+	chan_data->blocks_done = 0;
+
+	for (lli_desc = chan_data->lli_desc_base; lli_desc <= chan_data->lli_desc_tail;
+	     lli_desc++) {
+		lli_desc->ctl |= DMA_DW_AXI_CTL_LLI_VALID;
+	}
+
+	arch_dcache_flush_range((void *)chan_data->lli_desc_base,
+				sizeof(struct dma_lli) * chan_data->lli_desc_count);
+#else
+	ARG_UNUSED(lli_desc);
+#endif
+
+	/* the descriptors are ready, no need to configure them again */
+	chan_data->lli_desc_current = chan_data->lli_desc_base;
+	chan_data->ch_state = DMA_DW_AXI_CH_PREPARED;
+
+	return dma_dw_axi_start(dev, channel);
+}
+
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+static int dma_dw_axi_chain_append(const struct device *dev, uint32_t channel,
+				   struct dma_block_config *block)
+{
+	struct dma_dw_axi_ch_data *chan_data;
+	struct dma_lli *lli_desc;
+	uint32_t capacity, pending, done;
+	unsigned int key;
+	int ret = 0;
+	struct dma_dw_axi_dev_data *const dw_dev_data = DEV_DATA(dev);
+	uintptr_t reg_base = DEVICE_MMIO_NAMED_GET(dev, dma_mmio);
+
+	/* validate channel number */
+	if (channel > (dw_dev_data->dma_ctx.dma_channels - 1)) {
+		LOG_ERR("invalid dma channel %d", channel);
+		return -EINVAL;
+	}
+
+	chan_data = &dw_dev_data->chan[channel];
+	if (chan_data->lli_desc_count == 0) {
+		return -EINVAL;
+	}
+
+	if ((block->block_size / chan_data->src_data_size) - 1 > CONFIG_DMA_DW_AXI_MAX_BLOCK_TS) {
+		return -ENOTSUP;
+	}
+
+	key = irq_lock();
+
+	if (chan_data->ch_state != DMA_DW_AXI_CH_ACTIVE &&
+	    chan_data->ch_state != DMA_DW_AXI_CH_SUSPENDED) {
+		/* nothing runs anymore, all the descriptors are free */
+		chan_data->append_count = 0;
+		chan_data->blocks_done = 0;
+	}
+
+	/*
+	 * The appended descriptors use the free part of the pool of the channel
+	 * as a ring. A slot is free again once its block completed, which is
+	 * counted by the block transfer interrupts.
+	 */
+	capacity = CONFIG_DMA_DW_AXI_MAX_DESC - chan_data->lli_desc_count;
+	done = chan_data->blocks_done > chan_data->lli_desc_count ?
+	       chan_data->blocks_done - chan_data->lli_desc_count : 0;
+	pending = chan_data->append_count - MIN(done, chan_data->append_count);
+	if (pending >= capacity) {
+		ret = -ENOMEM;
+		goto unlock;
+	}
+
+	lli_desc = &chan_data->lli_desc_base[chan_data->lli_desc_count +
+					     (chan_data->append_count % capacity)];
+	chan_data->append_count++;
+
+	memset(lli_desc, 0, sizeof(*lli_desc));
+	lli_desc->sar = block->source_address;
+	lli_desc->dar = block->dest_address;
+	lli_desc->block_ts_lo = (block->block_size / chan_data->src_data_size) - 1;
+	lli_desc->ctl = chan_data->lli_ctl | DMA_DW_AXI_CTL_LLI_VALID | DMA_DW_AXI_CTL_LLI_LAST;
+	arch_dcache_flush_range((void *)lli_desc, sizeof(*lli_desc));
+
+	/* count the completion of every block to free the slots */
+	if ((chan_data->irq_unmask & DMA_DW_AXI_IRQ_BLOCK_TFR) == 0) {
+		chan_data->irq_unmask |= DMA_DW_AXI_IRQ_BLOCK_TFR | DMA_DW_AXI_IRQ_DMA_TFR;
+		sys_write64(chan_data->irq_unmask,
+			    reg_base + DMA_DW_AXI_CH_INTSTATUS_ENABLEREG(channel));
+		sys_write64(chan_data->irq_unmask,
+			    reg_base + DMA_DW_AXI_CH_INTSIGNAL_ENABLEREG(channel));
+	}
+
+	if (chan_data->ch_state != DMA_DW_AXI_CH_ACTIVE &&
+	    chan_data->ch_state != DMA_DW_AXI_CH_SUSPENDED) {
+		/* the channel is idle, start it with the block */
+		chan_data->lli_desc_tail = lli_desc;
+		chan_data->lli_desc_current = lli_desc;
+		chan_data->ch_state = DMA_DW_AXI_CH_PREPARED;
+		ret = dma_dw_axi_start(dev, channel);
+		goto unlock;
+	}
+
+	/* link the block behind the last descriptor of the running list */
+	chan_data->lli_desc_tail->llp = (uint64_t)lli_desc;
+	chan_data->lli_desc_tail->ctl &= ~DMA_DW_AXI_CTL_LLI_LAST;
+	arch_dcache_flush_range((void *)chan_data->lli_desc_tail, sizeof(*lli_desc));
+	chan_data->lli_desc_tail = lli_desc;
+	barrier_dmem_fence_full();
+
+	/*
+	 * The channel holds the llp of the descriptor it runs. If that is 0, it
+	 * fetched the last descriptor before the link and stops after it: the
+	 * transfer completion interrupt restarts it from the appended block.
+	 */
+	if (chan_data->lli_desc_restart == NULL &&
+	    (dma_dw_axi_get_ch_status(dev, channel) == DMA_DW_AXI_CH_IDLE ||
+	     sys_read64(reg_base + DMA_DW_AXI_CH_LLP(channel)) == 0)) {
+		chan_data->lli_desc_restart = lli_desc;
+	}
+
+unlock:
+	irq_unlock(key);
+
+	return ret;
+}
+#endif /* CONFIG_DMA_DW_AXI_LLI_SUPPORT */
+
 static int dma_dw_axi_init(const struct device *dev)
 {
 	DEVICE_MMIO_NAMED_MAP(dev, dma_mmio, K_MEM_CACHE_NONE);
@@ -857,6 +1054,10 @@ static const struct dma_driver_api dma_dw_axi_driver_api = {
 	.stop = dma_dw_axi_stop,
 	.suspend = dma_dw_axi_suspend,
 	.resume = dma_dw_axi_resume,
+	.chain_restart = dma_dw_axi_chain_restart,
+#if defined(CONFIG_DMA_DW_AXI_LLI_SUPPORT)
+	.chain_append = dma_dw_axi_chain_append,
+#endif
 };
 
 /* enable irq lines */
@@ -102,6 +102,9 @@ struct call_back {
 	void *user_data;
 	dma_callback_t dma_callback;
 	struct dma_mcux_channel_transfer_edma_settings transfer_settings;
+	/* Blocks of the configuration, submitted again by a chain restart */
+	struct dma_block_config *chain_head;
+	uint32_t chain_count;
 	bool busy;
 };
 
@@ -316,6 +319,9 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	data->transfer_settings.direction = config->channel_direction;
 	data->transfer_settings.transfer_type = transfer_type;
 	data->transfer_settings.valid = true;
+	data->chain_head = config->head_block;
+	data->chain_count = (block_config->source_gather_en || block_config->dest_scatter_en) ?
+			    config->block_count : 1;
 
 
 	/* Lock and page in the channel configuration */
@@ -492,6 +498,34 @@ static int dma_mcux_edma_resume(const struct device *dev, uint32_t channel)
 }
 
 
+/* Queue a TCD with the settings of the configuration. Called with interrupts locked. */
+static int dma_mcux_edma_submit(const struct device *dev, uint32_t channel,
+				uint32_t src, uint32_t dst, size_t size)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+	status_t submit_status;
+
+	EDMA_PrepareTransfer(
+		&(data->transferConfig),
+		(void *)src,
+		data->transfer_settings.source_data_size,
+		(void *)dst,
+		data->transfer_settings.dest_data_size,
+		data->transfer_settings.source_burst_length,
+		size,
+		data->transfer_settings.transfer_type);
+
+	submit_status = EDMA_SubmitTransfer(DEV_EDMA_HANDLE(dev, channel), &(data->transferConfig));
+	if (submit_status == kStatus_EDMA_QueueFull) {
+		return -ENOMEM;
+	} else if (submit_status != kStatus_Success) {
+		LOG_ERR("Error submitting EDMA Transfer: 0x%x", submit_status);
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
 static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 				uint32_t src, uint32_t dst, size_t size)
 {
@@ -514,22 +548,74 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 		goto cleanup;
 	}
 
-	EDMA_PrepareTransfer(
-		&(data->transferConfig),
-		(void *)src,
-		data->transfer_settings.source_data_size,
-		(void *)dst,
-		data->transfer_settings.dest_data_size,
-		data->transfer_settings.source_burst_length,
-		size,
-		data->transfer_settings.transfer_type);
+	if (dma_mcux_edma_submit(dev, channel, src, dst, size) != 0) {
+		ret = -EFAULT;
+	}
 
-	const status_t submit_status =
-		EDMA_SubmitTransfer(DEV_EDMA_HANDLE(dev, channel), &(data->transferConfig));
+cleanup:
+	irq_unlock(key);
+	return ret;
+}
 
-	if (submit_status != kStatus_Success) {
-		LOG_ERR("Error submitting EDMA Transfer: 0x%x", submit_status);
+static int dma_mcux_edma_chain_restart(const struct device *dev, uint32_t channel)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+	struct dma_block_config *block = data->chain_head;
+	const unsigned int key = irq_lock();
+	int ret = 0;
+
+	if (!data->transfer_settings.valid || block == NULL) {
 		ret = -EFAULT;
+		goto cleanup;
+	}
+
+	if (data->busy) {
+		ret = -EBUSY;
+		goto cleanup;
+	}
+
+	/* The TCDs of the blocks are queued again, the channel keeps its configuration */
+	for (uint32_t i = 0; i < data->chain_count && block != NULL; i++) {
+		ret = dma_mcux_edma_submit(dev, channel, block->source_address,
+					   block->dest_address, block->block_size);
+		if (ret != 0) {
+			goto cleanup;
+		}
+		block = block->next_block;
+	}
+
+	data->busy = true;
+	EDMA_StartTransfer(DEV_EDMA_HANDLE(dev, channel));
+
+cleanup:
+	irq_unlock(key);
+	return ret;
+}
+
+static int dma_mcux_edma_chain_append(const struct device *dev, uint32_t channel,
+				      struct dma_block_config *block)
+{
+	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
+	const unsigned int key = irq_lock();
+	int ret;
+
+	if (!data->transfer_settings.valid) {
+		ret = -EFAULT;
+		goto cleanup;
+	}
+
+	/* Without s/g, a block can only be appended to an idle channel */
+	if (data->busy && data->edma_handle.tcdPool == NULL) {
+		ret = -EBUSY;
+		goto cleanup;
+	}
+
+	/* With s/g, the TCD is linked to the running ones by the HAL */
+	ret = dma_mcux_edma_submit(dev, channel, block->source_address,
+				   block->dest_address, block->block_size);
+	if (ret == 0 && !data->busy) {
+		data->busy = true;
+		EDMA_StartTransfer(DEV_EDMA_HANDLE(dev, channel));
 	}
 
 cleanup:
@@ -601,6 +687,8 @@ static const struct dma_driver_api dma_mcux_edma_api = {
 	.resume = dma_mcux_edma_resume,
 	.get_status = dma_mcux_edma_get_status,
 	.chan_filter = dma_mcux_edma_channel_filter,
+	.chain_restart = dma_mcux_edma_chain_restart,
+	.chain_append = dma_mcux_edma_chain_append,
 };
 
 static int dma_mcux_edma_init(const struct device *dev)
@@ -85,6 +85,58 @@ static void dma_stm32_clear_stream_irq(const struct device *dev, uint32_t id)
 	stm32_dma_clear_stream_irq(dma, id);
 }
 
+/* Program the addresses and the length of a block, the stream being disabled */
+static int dma_stm32_set_block(DMA_TypeDef *dma, uint32_t id, struct dma_stm32_stream *stream,
+			       uint32_t src, uint32_t dst, size_t size)
+{
+	switch (stream->direction) {
+	case MEMORY_TO_PERIPHERAL:
+		LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id), src);
+		LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id), dst);
+		break;
+	case MEMORY_TO_MEMORY:
+	case PERIPHERAL_TO_MEMORY:
+		LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id), src);
+		LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id), dst);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (stream->source_periph) {
+		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
+				     size / stream->src_size);
+	} else {
+		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
+				     size / stream->dst_size);
+	}
+
+	return 0;
+}
+
+/* Next block of the chain to transfer, NULL if none. Called with interrupts locked. */
+static struct dma_block_config *dma_stm32_next_block(struct dma_stm32_stream *stream)
+{
+	struct dma_block_config *block;
+
+	if (stream->chain_left > 0) {
+		block = stream->chain_next;
+		stream->chain_next = block->next_block;
+		stream->chain_left--;
+		return block;
+	}
+
+	block = stream->append_head;
+	if (block != NULL) {
+		stream->append_head = block->next_block;
+		if (stream->append_head == NULL) {
+			stream->append_tail = NULL;
+		}
+	}
+
+	return block;
+}
+
 static void dma_stm32_irq_handler(const struct device *dev, uint32_t id)
 {
 	const struct dma_stm32_config *config = dev->config;
@@ -119,14 +171,31 @@ static void dma_stm32_irq_handler(const struct device *dev, uint32_t id)
 		}
 		stream->dma_callback(dev, stream->user_data, callback_arg, DMA_STATUS_BLOCK);
 	} else if (stm32_dma_is_tc_irq_active(dma, id)) {
-		/* Circular buffer never stops receiving as long as peripheral is enabled */
-		if (!stream->cyclic) {
-			stream->busy = false;
-		}
 		/* Let HAL DMA handle flags on its own */
 		if (!stream->hal_override) {
 			dma_stm32_clear_tc(dma, id);
 		}
+
+		/* Go on with the next block of the chain, without reconfiguring the stream */
+		if (!stream->cyclic && !stream->hal_override) {
+			struct dma_block_config *block = dma_stm32_next_block(stream);
+
+			if (block != NULL &&
+			    dma_stm32_set_block(dma, id, stream, block->source_address,
+						block->dest_address, block->block_size) == 0) {
+				stm32_dma_enable_stream(dma, id);
+				if (stream->block_callback) {
+					stream->dma_callback(dev, stream->user_data, callback_arg,
+							     DMA_STATUS_BLOCK);
+				}
+				return;
+			}
+		}
+
+		/* Circular buffer never stops receiving as long as peripheral is enabled */
+		if (!stream->cyclic) {
+			stream->busy = false;
+		}
 		stream->dma_callback(dev, stream->user_data, callback_arg, DMA_STATUS_COMPLETE);
 	} else if (stm32_dma_is_unexpected_irq_happened(dma, id)) {
 		LOG_ERR("Unexpected irq happened.");
@@ -362,6 +431,13 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 	stream->src_size	= config->source_data_size;
 	stream->dst_size	= config->dest_data_size;
 	stream->cyclic		= config->head_block->source_reload_en;
+	stream->block_callback	= config->complete_callback_en;
+	stream->chain_head	= config->head_block;
+	stream->chain_count	= stream->cyclic ? 1 : MAX(config->block_count, 1);
+	stream->chain_next	= config->head_block->next_block;
+	stream->chain_left	= stream->chain_count - 1;
+	stream->append_head	= NULL;
+	stream->append_tail	= NULL;
 
 	/* Check dest or source memory address, warn if 0 */
 	if (config->head_block->source_address == 0) {
@@ -532,28 +608,10 @@ DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
 		return -EBUSY;
 	}
 
-	switch (stream->direction) {
-	case MEMORY_TO_PERIPHERAL:
-		LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id), src);
-		LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id), dst);
-		break;
-	case MEMORY_TO_MEMORY:
-	case PERIPHERAL_TO_MEMORY:
-		LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id), src);
-		LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id), dst);
-		break;
-	default:
+	if (dma_stm32_set_block(dma, id, stream, src, dst, size) != 0) {
 		return -EINVAL;
 	}
 
-	if (stream->source_periph) {
-		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
-				     size / stream->src_size);
-	} else {
-		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
-				     size / stream->dst_size);
-	}
-
 	/* When reloading the dma, the stream is busy again before enabling */
 	stream->busy = true;
 
@@ -626,12 +684,126 @@ DMA_STM32_EXPORT_API int dma_stm32_stop(const struct device *dev, uint32_t id)
 	dma_stm32_clear_stream_irq(dev, id);
 	dma_stm32_disable_stream(dma, id);
 
+	/* Drop the appended blocks not transferred */
+	stream->append_head = NULL;
+	stream->append_tail = NULL;
+	stream->chain_left = 0;
+
 	/* Finally, flag stream as free */
 	stream->busy = false;
 
 	return 0;
 }
 
+/* Start a block on the idle stream. Called with interrupts locked. */
+static int dma_stm32_start_block(const struct device *dev, uint32_t id,
+				 struct dma_block_config *block)
+{
+	const struct dma_stm32_config *config = dev->config;
+	DMA_TypeDef *dma = (DMA_TypeDef *)(config->base);
+	struct dma_stm32_stream *stream = &config->streams[id];
+	int ret;
+
+	if (dma_stm32_disable_stream(dma, id) != 0) {
+		return -EBUSY;
+	}
+
+	ret = dma_stm32_set_block(dma, id, stream, block->source_address,
+				  block->dest_address, block->block_size);
+	if (ret < 0) {
+		return ret;
+	}
+
+#if !defined(CONFIG_DMAMUX_STM32) \
+	|| defined(CONFIG_SOC_SERIES_STM32H7X) || defined(CONFIG_SOC_SERIES_STM32MP1X)
+	/* Stopping the stream disabled the interrupt */
+	LL_DMA_EnableIT_TC(dma, dma_stm32_id_to_stream(id));
+#endif
+
+	stream->busy = true;
+	dma_stm32_clear_stream_irq(dev, id);
+	stm32_dma_enable_stream(dma, id);
+
+	return 0;
+}
+
+DMA_STM32_EXPORT_API int dma_stm32_chain_restart(const struct device *dev, uint32_t id)
+{
+	const struct dma_stm32_config *config = dev->config;
+	struct dma_stm32_stream *stream;
+	unsigned int key;
+	int ret;
+
+	/* Give channel from index 0 */
+	id = id - STM32_DMA_STREAM_OFFSET;
+
+	if (id >= config->max_streams) {
+		return -EINVAL;
+	}
+
+	stream = &config->streams[id];
+	if (stream->hal_override || stream->chain_head == NULL) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (stream->busy) {
+		ret = -EBUSY;
+	} else {
+		stream->chain_next = stream->chain_head->next_block;
+		stream->chain_left = stream->chain_count - 1;
+		ret = dma_stm32_start_block(dev, id, stream->chain_head);
+	}
+
+	irq_unlock(key);
+
+	return ret;
+}
+
+DMA_STM32_EXPORT_API int dma_stm32_chain_append(const struct device *dev, uint32_t id,
+						struct dma_block_config *block)
+{
+	const struct dma_stm32_config *config = dev->config;
+	struct dma_stm32_stream *stream;
+	unsigned int key;
+	int ret = 0;
+
+	/* Give channel from index 0 */
+	id = id - STM32_DMA_STREAM_OFFSET;
+
+	if (id >= config->max_streams) {
+		return -EINVAL;
+	}
+
+	stream = &config->streams[id];
+	if (stream->hal_override || stream->cyclic || stream->chain_head == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (block->block_size > DMA_STM32_MAX_DATA_ITEMS) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (stream->busy) {
+		/* Loaded by the interrupt handler once the running blocks complete */
+		if (stream->append_tail != NULL) {
+			stream->append_tail->next_block = block;
+		} else {
+			stream->append_head = block;
+		}
+		stream->append_tail = block;
+	} else {
+		ret = dma_stm32_start_block(dev, id, block);
+	}
+
+	irq_unlock(key);
+
+	return ret;
+}
+
 static int dma_stm32_init(const struct device *dev)
 {
 	const struct dma_stm32_config *config = dev->config;
@@ -692,6 +864,8 @@ static const struct dma_driver_api dma_funcs = {
 	.start		 = dma_stm32_start,
 	.stop		 = dma_stm32_stop,
 	.get_status	 = dma_stm32_get_status,
+	.chain_restart	 = dma_stm32_chain_restart,
+	.chain_append	 = dma_stm32_chain_append,
 };
 
 #define DMA_STM32_INIT_DEV(index)					\
@@ -28,6 +28,16 @@ struct dma_stm32_stream {
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
 	bool cyclic;
+	bool block_callback;
+	/* Blocks of the configuration, the head one is loaded by dma_config() */
+	struct dma_block_config *chain_head;
+	uint32_t chain_count;
+	/* Next block of the configuration to load and blocks left to load */
+	struct dma_block_config *chain_next;
+	uint32_t chain_left;
+	/* Appended blocks waiting for their transfer, linked by next_block */
+	struct dma_block_config *append_head;
+	struct dma_block_config *append_tail;
 };
 
 struct dma_stm32_data {
@@ -113,6 +123,9 @@ int dma_stm32_start(const struct device *dev, uint32_t id);
 int dma_stm32_stop(const struct device *dev, uint32_t id);
 int dma_stm32_get_status(const struct device *dev, uint32_t id,
 				struct dma_status *stat);
+int dma_stm32_chain_restart(const struct device *dev, uint32_t id);
+int dma_stm32_chain_append(const struct device *dev, uint32_t id,
+			   struct dma_block_config *block);
 #else
 #define DMA_STM32_EXPORT_API static
 #endif /* CONFIG_DMAMUX_STM32 */
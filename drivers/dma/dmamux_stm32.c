@@ -63,6 +63,9 @@ typedef int (*dma_reload_fn)(const struct device *dev, uint32_t id,
 			uint32_t src, uint32_t dst, size_t size);
 typedef int (*dma_status_fn)(const struct device *dev, uint32_t id,
 				struct dma_status *stat);
+typedef int (*dma_chain_restart_fn)(const struct device *dev, uint32_t id);
+typedef int (*dma_chain_append_fn)(const struct device *dev, uint32_t id,
+				   struct dma_block_config *block);
 
 struct dmamux_stm32_dma_fops {
 	dma_configure_fn configure;
@@ -70,6 +73,8 @@ struct dmamux_stm32_dma_fops {
 	dma_stop_fn stop;
 	dma_reload_fn reload;
 	dma_status_fn get_status;
+	dma_chain_restart_fn chain_restart;
+	dma_chain_append_fn chain_append;
 };
 
 #if (defined(CONFIG_DMA_STM32_V1) || defined(CONFIG_DMA_STM32_V2)) && \
@@ -80,6 +85,8 @@ static const struct dmamux_stm32_dma_fops dmamux1 = {
 	dma_stm32_stop,
 	dma_stm32_reload,
 	dma_stm32_get_status,
+	dma_stm32_chain_restart,
+	dma_stm32_chain_append,
 };
 #endif
 
@@ -245,6 +252,45 @@ int dmamux_stm32_get_status(const struct device *dev, uint32_t id,
 	return 0;
 }
 
+int dmamux_stm32_chain_restart(const struct device *dev, uint32_t id)
+{
+	const struct dmamux_stm32_config *dev_config = dev->config;
+	const struct dmamux_stm32_dma_fops *dma_device = get_dma_fops(dev_config);
+
+	/* check if this channel is valid */
+	if (id >= dev_config->channel_nb) {
+		LOG_ERR("channel ID %d is too big.", id);
+		return -EINVAL;
+	}
+
+	if (dma_device->chain_restart == NULL) {
+		return -ENOSYS;
+	}
+
+	return dma_device->chain_restart(dev_config->mux_channels[id].dev_dma,
+					 dev_config->mux_channels[id].dma_id);
+}
+
+int dmamux_stm32_chain_append(const struct device *dev, uint32_t id,
+			      struct dma_block_config *block)
+{
+	const struct dmamux_stm32_config *dev_config = dev->config;
+	const struct dmamux_stm32_dma_fops *dma_device = get_dma_fops(dev_config);
+
+	/* check if this channel is valid */
+	if (id >= dev_config->channel_nb) {
+		LOG_ERR("channel ID %d is too big.", id);
+		return -EINVAL;
+	}
+
+	if (dma_device->chain_append == NULL) {
+		return -ENOSYS;
+	}
+
+	return dma_device->chain_append(dev_config->mux_channels[id].dev_dma,
+					dev_config->mux_channels[id].dma_id, block);
+}
+
 static int dmamux_stm32_init(const struct device *dev)
 {
 	const struct dmamux_stm32_config *config = dev->config;
@@ -296,6 +342,8 @@ static const struct dma_driver_api dma_funcs = {
 	.start		 = dmamux_stm32_start,
 	.stop		 = dmamux_stm32_stop,
 	.get_status	 = dmamux_stm32_get_status,
+	.chain_restart	 = dmamux_stm32_chain_restart,
+	.chain_append	 = dmamux_stm32_chain_append,
 };
 
 /*
@@ -304,7 +304,7 @@ static void dwmac_receive(struct dwmac_priv *p)
 		frag = p->rx_frags[d_idx];
 		p->rx_frags[d_idx] = NULL;
 		bytes_so_far = FIELD_GET(RDES3_PL, des3_val);
-		frag->len = bytes_so_far - p->rx_bytes;
+		net_eth_rx_dma_buf_complete(frag, bytes_so_far - p->rx_bytes);
 		p->rx_bytes = bytes_so_far;
 		net_pkt_frag_add(p->rx_pkt, frag);
 
@@ -360,15 +360,14 @@ static void dwmac_rx_refill_thread(void *arg1, void *unused1, void *unused2)
 
 		/* get a new fragment if the previous one was consumed */
 		if (!frag) {
-			frag = net_pkt_get_reserve_rx_data(RX_FRAG_SIZE, K_FOREVER);
+			frag = net_eth_rx_dma_buf_alloc(RX_FRAG_SIZE, K_FOREVER);
 			if (!frag) {
-				LOG_ERR("net_pkt_get_reserve_rx_data() returned NULL");
+				LOG_ERR("net_eth_rx_dma_buf_alloc() returned NULL");
 				k_sem_give(&p->free_rx_descs);
 				break;
 			}
 			LOG_DBG("new frag[%d] at %p", d_idx, frag->data);
 			__ASSERT(frag->size == RX_FRAG_SIZE, "");
-			sys_cache_data_invd_range(frag->data, frag->size);
 			p->rx_frags[d_idx] = frag;
 		} else {
 			LOG_DBG("reusing frag[%d] at %p", d_idx, frag->data);
@@ -19,6 +19,7 @@ LOG_MODULE_REGISTER(eth_nxp_enet_qos_mac, CONFIG_ETHERNET_LOG_LEVEL);
 static const uint32_t rx_desc_refresh_flags =
 	OWN_FLAG | RX_INTERRUPT_ON_COMPLETE_FLAG | BUF1_ADDR_VALID_FLAG;
 
+#if !defined(CONFIG_ETH_NXP_ENET_QOS_RX_POLL)
 K_THREAD_STACK_DEFINE(enet_qos_rx_stack, CONFIG_ETH_NXP_ENET_QOS_RX_THREAD_STACK_SIZE);
 static struct k_work_q rx_work_queue;
 
@@ -36,6 +37,7 @@ static int rx_queue_init(void)
 }
 
 SYS_INIT(rx_queue_init, POST_KERNEL, 0);
+#endif
 
 static void eth_nxp_enet_qos_iface_init(struct net_if *iface)
 {
@@ -159,21 +161,19 @@ static enum ethernet_hw_caps eth_nxp_enet_qos_get_capabilities(const struct devi
 	return ETHERNET_LINK_100BASE_T | ETHERNET_LINK_10BASE_T;
 }
 
-static void eth_nxp_enet_qos_rx(struct k_work *work)
+/* Receive at most budget frames, returns the number of frames handled */
+static int enet_qos_rx(struct nxp_enet_qos_mac_data *data, int budget)
 {
-	struct nxp_enet_qos_rx_data *rx_data =
-		CONTAINER_OF(work, struct nxp_enet_qos_rx_data, rx_work);
-	struct nxp_enet_qos_mac_data *data =
-		CONTAINER_OF(rx_data, struct nxp_enet_qos_mac_data, rx);
 	volatile union nxp_enet_qos_rx_desc *desc_arr = data->rx.descriptors;
 	volatile union nxp_enet_qos_rx_desc *desc;
 	struct net_pkt *pkt;
 	struct net_buf *new_buf;
 	struct net_buf *buf;
 	size_t pkt_len;
+	int count = 0;
 
 	/* We are going to find all of the descriptors we own and update them */
-	for (int i = 0; i < NUM_RX_BUFDESC; i++) {
+	for (int i = 0; i < NUM_RX_BUFDESC && count < budget; i++) {
 		desc = &desc_arr[i];
 
 		if (desc->write.control3 & OWN_FLAG) {
@@ -182,6 +182,7 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 		}
 
 		/* Otherwise, we found a packet that we need to process */
+		count++;
 		pkt = net_pkt_rx_alloc(K_NO_WAIT);
 
 		if (!pkt) {
@@ -235,12 +236,45 @@ static void eth_nxp_enet_qos_rx(struct k_work *work)
 		eth_stats_update_pkts_rx(data->iface);
 	}
 
-	return;
+	return count;
 
 error:
 	net_pkt_unref(pkt);
 	eth_stats_update_errors_rx(data->iface);
+
+	/* Give up until the next interrupt */
+	return 0;
+}
+
+#if defined(CONFIG_ETH_NXP_ENET_QOS_RX_POLL)
+static int eth_nxp_enet_qos_rx_poll(struct net_eth_rx_poll *rx_poll, int budget)
+{
+	struct nxp_enet_qos_rx_data *rx_data =
+		CONTAINER_OF(rx_poll, struct nxp_enet_qos_rx_data, rx_poll);
+	struct nxp_enet_qos_mac_data *data =
+		CONTAINER_OF(rx_data, struct nxp_enet_qos_mac_data, rx);
+	int count;
+
+	count = enet_qos_rx(data, budget);
+	if (count < budget) {
+		/* Drained, frames received from now on raise the interrupt */
+		rx_data->base->DMA_CH[0].DMA_CHX_INT_EN |=
+			ENET_QOS_REG_PREP(DMA_CH_DMA_CHX_INT_EN, RIE, 0b1);
+	}
+
+	return count;
+}
+#else
+static void eth_nxp_enet_qos_rx(struct k_work *work)
+{
+	struct nxp_enet_qos_rx_data *rx_data =
+		CONTAINER_OF(work, struct nxp_enet_qos_rx_data, rx_work);
+	struct nxp_enet_qos_mac_data *data =
+		CONTAINER_OF(rx_data, struct nxp_enet_qos_mac_data, rx);
+
+	(void)enet_qos_rx(data, NUM_RX_BUFDESC);
 }
+#endif
 
 static void eth_nxp_enet_qos_mac_isr(const struct device *dev)
 {
@@ -263,7 +297,13 @@ static void eth_nxp_enet_qos_mac_isr(const struct device *dev)
 			k_work_submit(&data->tx.tx_done_work);
 		}
 		if (ENET_QOS_REG_GET(DMA_CH_DMA_CHX_STAT, RI, dma_ch0_interrupts)) {
+#if defined(CONFIG_ETH_NXP_ENET_QOS_RX_POLL)
+			base->DMA_CH[0].DMA_CHX_INT_EN &=
+				~ENET_QOS_REG_PREP(DMA_CH_DMA_CHX_INT_EN, RIE, 0b1);
+			net_eth_rx_poll_schedule(&data->rx.rx_poll);
+#else
 			k_work_submit_to_queue(&rx_work_queue, &data->rx.rx_work);
+#endif
 		}
 	}
 }
@@ -555,7 +595,12 @@ static int eth_nxp_enet_qos_mac_init(const struct device *dev)
 	k_sem_init(&data->tx.tx_sem, 1, 1);
 
 	/* Work upon a reception of a packet to a buffer */
+#if defined(CONFIG_ETH_NXP_ENET_QOS_RX_POLL)
+	data->rx.base = base;
+	net_eth_rx_poll_init(&data->rx.rx_poll, eth_nxp_enet_qos_rx_poll, 0);
+#else
 	k_work_init(&data->rx.rx_work, eth_nxp_enet_qos_rx);
+#endif
 
 	/* Work upon a complete transmission by a channel's TX DMA */
 	k_work_init(&data->tx.tx_done_work, tx_dma_done);
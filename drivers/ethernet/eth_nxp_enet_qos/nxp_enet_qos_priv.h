@@ -103,7 +103,12 @@ struct nxp_enet_qos_tx_data {
 };
 
 struct nxp_enet_qos_rx_data {
+#if defined(CONFIG_ETH_NXP_ENET_QOS_RX_POLL)
+	struct net_eth_rx_poll rx_poll;
+	enet_qos_t *base;
+#else
 	struct k_work rx_work;
+#endif
 	volatile union nxp_enet_qos_rx_desc descriptors[NUM_RX_BUFDESC];
 	struct net_buf *reserved_bufs[NUM_RX_BUFDESC];
 };
@@ -101,7 +101,9 @@ static const struct device *eth_stm32_phy_dev = DEVICE_PHY_BY_NAME(0);
 
 static ETH_DMADescTypeDef dma_rx_desc_tab[ETH_RX_DESC_CNT] __eth_stm32_desc;
 static ETH_DMADescTypeDef dma_tx_desc_tab[ETH_TX_DESC_CNT] __eth_stm32_desc;
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 static uint8_t dma_rx_buffer[ETH_RX_DESC_CNT][ETH_MAX_PACKET_SIZE] __eth_stm32_buf;
+#endif
 static uint8_t dma_tx_buffer[ETH_TX_DESC_CNT][ETH_MAX_PACKET_SIZE] __eth_stm32_buf;
 
 #if defined(CONFIG_ETH_STM32_HAL_API_V2)
@@ -124,9 +126,66 @@ struct eth_stm32_tx_context {
 	uint16_t first_tx_buffer_index;
 };
 
-static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RX_DESC_CNT];
 static struct eth_stm32_tx_buffer_header dma_tx_buffer_header[ETH_TX_DESC_CNT];
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+
+BUILD_ASSERT(CONFIG_NET_BUF_DATA_SIZE >= ETH_MAX_PACKET_SIZE,
+	     "RX network buffers must hold a full frame");
+
+/* Network buffers posted to the RX DMA descriptors */
+static struct net_buf *dma_rx_bufs[ETH_RX_DESC_CNT];
+
+void HAL_ETH_RxAllocateCallback(uint8_t **buf)
+{
+	for (size_t i = 0; i < ETH_RX_DESC_CNT; ++i) {
+		if (dma_rx_bufs[i] == NULL) {
+			dma_rx_bufs[i] = net_eth_rx_dma_buf_alloc(ETH_MAX_PACKET_SIZE,
+								  K_NO_WAIT);
+			if (dma_rx_bufs[i] == NULL) {
+				break;
+			}
+
+			*buf = dma_rx_bufs[i]->data;
+			return;
+		}
+	}
+	*buf = NULL;
+}
+
+/* called by HAL_ETH_ReadData(), the frame is built as a chain of
+ * network buffers
+ */
+void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
+{
+	struct net_buf *buf = NULL;
+
+	for (size_t i = 0; i < ETH_RX_DESC_CNT; ++i) {
+		if (dma_rx_bufs[i] != NULL && dma_rx_bufs[i]->data == buff) {
+			buf = dma_rx_bufs[i];
+			dma_rx_bufs[i] = NULL;
+			break;
+		}
+	}
+
+	__ASSERT_NO_MSG(buf != NULL);
+
+	net_eth_rx_dma_buf_complete(buf, Length);
+
+	if (!*pStart) {
+		*pStart = buf;
+		*pEnd = buf;
+	} else {
+		__ASSERT_NO_MSG(*pEnd != NULL);
+		net_buf_frag_insert(*pEnd, buf);
+		*pEnd = buf;
+	}
+}
+
+#else /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+
+static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RX_DESC_CNT];
+
 void HAL_ETH_RxAllocateCallback(uint8_t **buf)
 {
 	for (size_t i = 0; i < ETH_RX_DESC_CNT; ++i) {
@@ -169,6 +228,8 @@ void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t
 	}
 }
 
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+
 /* Called by HAL_ETH_ReleaseTxPacket */
 void HAL_ETH_TxFreeCallback(uint32_t *buff)
 {
@@ -525,7 +586,9 @@ static struct net_pkt *eth_rx(const struct device *dev)
 	ETH_HandleTypeDef *heth;
 	struct net_pkt *pkt;
 	size_t total_len = 0;
-#if defined(CONFIG_ETH_STM32_HAL_API_V2)
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	void *appbuf = NULL;
+#elif defined(CONFIG_ETH_STM32_HAL_API_V2)
 	void *appbuf = NULL;
 	struct eth_stm32_rx_buffer_header *rx_header;
 #else
@@ -557,11 +620,15 @@ static struct net_pkt *eth_rx(const struct device *dev)
 		return NULL;
 	}
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	total_len = net_buf_frags_len(appbuf);
+#else
 	/* computing total length */
 	for (rx_header = (struct eth_stm32_rx_buffer_header *)appbuf;
 			rx_header; rx_header = rx_header->next) {
 		total_len += rx_header->size;
 	}
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 #else
 	hal_ret = HAL_ETH_GetReceivedFrame_IT(heth);
 	if (hal_ret != HAL_OK) {
@@ -592,6 +659,18 @@ static struct net_pkt *eth_rx(const struct device *dev)
 #endif /* CONFIG_ETH_STM32_HAL_API_V2 */
 #endif /* CONFIG_PTP_CLOCK_STM32_HAL */
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	pkt = net_pkt_rx_alloc_on_iface(get_iface(dev_data), K_MSEC(100));
+	if (!pkt) {
+		LOG_ERR("Failed to obtain RX packet");
+		net_buf_unref(appbuf);
+		goto out;
+	}
+
+	/* The frame is already in the network buffers */
+	net_pkt_append_buffer(pkt, appbuf);
+	ARG_UNUSED(total_len);
+#else
 	pkt = net_pkt_rx_alloc_with_buffer(get_iface(dev_data),
 					   total_len, AF_UNSPEC, 0, K_MSEC(100));
 	if (!pkt) {
@@ -622,7 +701,10 @@ static struct net_pkt *eth_rx(const struct device *dev)
 #endif /* CONFIG_ETH_STM32_HAL_API_V2 */
 
 release_desc:
-#if defined(CONFIG_ETH_STM32_HAL_API_V2)
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	/* The descriptors are given new buffers by HAL_ETH_ReadData() */
+#elif defined(CONFIG_ETH_STM32_HAL_API_V2)
 	for (rx_header = (struct eth_stm32_rx_buffer_header *)appbuf;
 			rx_header; rx_header = rx_header->next) {
 		rx_header->used = false;
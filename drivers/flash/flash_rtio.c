@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(flash_rtio, CONFIG_FLASH_LOG_LEVEL);
+
+/*
+ * A request is a transaction of two submissions: a tiny write holding the
+ * offset (32-bit little endian), followed by the read or the write of the
+ * data, or for an erase by a tiny write holding the size to erase (32-bit
+ * little endian).
+ */
+
+/* Pops the next queued request. When the queue is empty the device is
+ * marked idle, so that the next submission starts a new work item.
+ */
+static struct rtio_iodev_sqe *flash_iodev_next(struct flash_iodev_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct mpsc_node *node = mpsc_pop(&data->pending);
+
+	if (node == NULL) {
+		data->busy = false;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return node == NULL ? NULL : CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+}
+
+static int flash_iodev_exec(const struct device *dev, struct rtio_iodev_sqe *first)
+{
+	struct rtio_iodev_sqe *data = rtio_txn_next(first);
+	off_t offset;
+
+	if (first->sqe.op != RTIO_OP_TINY_TX || first->sqe.tiny_tx.buf_len != sizeof(uint32_t) ||
+	    data == NULL) {
+		return -EINVAL;
+	}
+
+	offset = sys_get_le32(first->sqe.tiny_tx.buf);
+
+	switch (data->sqe.op) {
+	case RTIO_OP_RX:
+		return flash_read(dev, offset, data->sqe.rx.buf, data->sqe.rx.buf_len);
+	case RTIO_OP_TX:
+		return flash_write(dev, offset, data->sqe.tx.buf, data->sqe.tx.buf_len);
+	case RTIO_OP_TINY_TX:
+		if (data->sqe.tiny_tx.buf_len != sizeof(uint32_t)) {
+			return -EINVAL;
+		}
+
+		return flash_erase(dev, offset, sys_get_le32(data->sqe.tiny_tx.buf));
+	default:
+		return -EINVAL;
+	}
+}
+
+static void flash_iodev_work(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct flash_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_iodev_sqe *curr;
+	int rc;
+
+	while ((curr = flash_iodev_next(data)) != NULL) {
+		rc = flash_iodev_exec(data->dev, curr);
+		if (rc != 0) {
+			LOG_DBG("%s: request %p failed (%d)", data->dev->name, (void *)curr, rc);
+			rtio_iodev_sqe_err(curr, rc);
+		} else {
+			rtio_iodev_sqe_ok(curr, 0);
+		}
+	}
+}
+
+static void flash_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct flash_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_work_req *req;
+	k_spinlock_key_t key;
+	bool start;
+
+	key = k_spin_lock(&data->lock);
+	mpsc_push(&data->pending, &iodev_sqe->q);
+	start = !data->busy;
+	data->busy = true;
+	k_spin_unlock(&data->lock, key);
+
+	if (!start) {
+		/* The running work item picks it up */
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		while ((iodev_sqe = flash_iodev_next(data)) != NULL) {
+			rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		}
+
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, flash_iodev_work);
+}
+
+const struct rtio_iodev_api flash_iodev_api = {
+	.submit = flash_iodev_submit,
+};
+
+static struct rtio_sqe *flash_rtio_prep(struct rtio *r, const struct rtio_iodev *iodev,
+					off_t offset)
+{
+	struct rtio_sqe *hdr_sqe = rtio_sqe_acquire(r);
+	struct rtio_sqe *data_sqe = rtio_sqe_acquire(r);
+	uint8_t hdr[sizeof(uint32_t)];
+
+	if (hdr_sqe == NULL || data_sqe == NULL) {
+		rtio_sqe_drop_all(r);
+		return NULL;
+	}
+
+	sys_put_le32(offset, hdr);
+	rtio_sqe_prep_tiny_write(hdr_sqe, iodev, RTIO_PRIO_NORM, hdr, sizeof(hdr), NULL);
+	hdr_sqe->flags |= RTIO_SQE_TRANSACTION | RTIO_SQE_NO_RESPONSE;
+
+	return data_sqe;
+}
+
+struct rtio_sqe *flash_rtio_read(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				 void *data, size_t len, void *userdata)
+{
+	struct rtio_sqe *sqe = flash_rtio_prep(r, iodev, offset);
+
+	if (sqe != NULL) {
+		rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, data, len, userdata);
+	}
+
+	return sqe;
+}
+
+struct rtio_sqe *flash_rtio_write(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				  const void *data, size_t len, void *userdata)
+{
+	struct rtio_sqe *sqe = flash_rtio_prep(r, iodev, offset);
+
+	if (sqe != NULL) {
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, data, len, userdata);
+	}
+
+	return sqe;
+}
+
+struct rtio_sqe *flash_rtio_erase(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				  size_t size, void *userdata)
+{
+	struct rtio_sqe *sqe = flash_rtio_prep(r, iodev, offset);
+	uint8_t size_buf[sizeof(uint32_t)];
+
+	if (sqe != NULL) {
+		sys_put_le32(size, size_buf);
+		rtio_sqe_prep_tiny_write(sqe, iodev, RTIO_PRIO_NORM, size_buf, sizeof(size_buf),
+					 userdata);
+	}
+
+	return sqe;
+}
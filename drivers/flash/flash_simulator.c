@@ -64,7 +64,8 @@
 #define ERASE_CYCLES_INC(U)						     \
 	do {								     \
 		if (U < STATS_PAGE_COUNT_THRESHOLD) {			     \
-			(*(&flash_sim_stats.erase_cycles_unit0 + (U)) += 1); \
+			STATS_INCN_IDX(flash_sim_stats,		     \
+				       erase_cycles_unit0, U, 1);    \
 		}							     \
 	} while (false)
 
@@ -183,6 +184,19 @@ static int flash_range_is_valid(const struct device *dev, off_t offset,
 	return 1;
 }
 
+#ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
+static void flash_sim_delay(uint32_t time_us)
+{
+#ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING_SLEEP
+	if (!k_is_pre_kernel() && !k_is_in_isr()) {
+		k_usleep(time_us);
+		return;
+	}
+#endif
+	k_busy_wait(time_us);
+}
+#endif
+
 static int flash_sim_read(const struct device *dev, const off_t offset,
 			  void *data,
 			  const size_t len)
@@ -206,9 +220,11 @@ static int flash_sim_read(const struct device *dev, const off_t offset,
 	FLASH_SIM_STATS_INCN(flash_sim_stats, bytes_read, len);
 
 #ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
-	k_busy_wait(CONFIG_FLASH_SIMULATOR_MIN_READ_TIME_US);
-	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_read_time_us,
-		   CONFIG_FLASH_SIMULATOR_MIN_READ_TIME_US);
+	uint32_t time_us = CONFIG_FLASH_SIMULATOR_MIN_READ_TIME_US +
+			   ((uint64_t)len * CONFIG_FLASH_SIMULATOR_READ_BYTE_TIME_NS) / 1000U;
+
+	flash_sim_delay(time_us);
+	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_read_time_us, time_us);
 #endif
 
 	return 0;
@@ -249,13 +265,13 @@ static int flash_sim_write(const struct device *dev, const off_t offset,
 #ifdef CONFIG_FLASH_SIMULATOR_STATS
 	bool data_part_ignored = false;
 
-	if (flash_sim_thresholds.max_write_calls != 0) {
-		if (flash_sim_stats.flash_write_calls >
-			flash_sim_thresholds.max_write_calls) {
+	if (STATS_GET(flash_sim_thresholds, max_write_calls) != 0) {
+		if (STATS_GET(flash_sim_stats, flash_write_calls) >
+			STATS_GET(flash_sim_thresholds, max_write_calls)) {
 			return 0;
-		} else if (flash_sim_stats.flash_write_calls ==
-				flash_sim_thresholds.max_write_calls) {
-			if (flash_sim_thresholds.max_len == 0) {
+		} else if (STATS_GET(flash_sim_stats, flash_write_calls) ==
+				STATS_GET(flash_sim_thresholds, max_write_calls)) {
+			if (STATS_GET(flash_sim_thresholds, max_len) == 0) {
 				return 0;
 			}
 
@@ -267,7 +283,7 @@ static int flash_sim_write(const struct device *dev, const off_t offset,
 	for (uint32_t i = 0; i < len; i++) {
 #ifdef CONFIG_FLASH_SIMULATOR_STATS
 		if (data_part_ignored) {
-			if (i >= flash_sim_thresholds.max_len) {
+			if (i >= STATS_GET(flash_sim_thresholds, max_len)) {
 				return 0;
 			}
 		}
@@ -288,10 +304,16 @@ static int flash_sim_write(const struct device *dev, const off_t offset,
 	FLASH_SIM_STATS_INCN(flash_sim_stats, bytes_written, len);
 
 #ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
+	/* every program page touched by the write is programmed */
+	uint32_t pages = (len == 0) ? 0 :
+			 (offset + len - 1) / CONFIG_FLASH_SIMULATOR_WRITE_PAGE_SIZE -
+			 offset / CONFIG_FLASH_SIMULATOR_WRITE_PAGE_SIZE + 1;
+	uint32_t time_us = CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US +
+			   pages * CONFIG_FLASH_SIMULATOR_WRITE_PAGE_TIME_US;
+
 	/* wait before returning */
-	k_busy_wait(CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US);
-	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_write_time_us,
-		   CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US);
+	flash_sim_delay(time_us);
+	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_write_time_us, time_us);
 #endif
 
 	return 0;
@@ -324,9 +346,9 @@ static int flash_sim_erase(const struct device *dev, const off_t offset,
 	FLASH_SIM_STATS_INC(flash_sim_stats, flash_erase_calls);
 
 #ifdef CONFIG_FLASH_SIMULATOR_STATS
-	if ((flash_sim_thresholds.max_erase_calls != 0) &&
-	    (flash_sim_stats.flash_erase_calls >=
-		flash_sim_thresholds.max_erase_calls)){
+	if ((STATS_GET(flash_sim_thresholds, max_erase_calls) != 0) &&
+	    (STATS_GET(flash_sim_stats, flash_erase_calls) >=
+		STATS_GET(flash_sim_thresholds, max_erase_calls))){
 		return 0;
 	}
 #endif
@@ -340,10 +362,13 @@ static int flash_sim_erase(const struct device *dev, const off_t offset,
 	}
 
 #ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
+	uint32_t time_us = CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US +
+			   (len / FLASH_SIMULATOR_ERASE_UNIT) *
+			   CONFIG_FLASH_SIMULATOR_ERASE_UNIT_TIME_US;
+
 	/* wait before returning */
-	k_busy_wait(CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US);
-	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_erase_time_us,
-		   CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US);
+	flash_sim_delay(time_us);
+	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_erase_time_us, time_us);
 #endif
 
 	return 0;
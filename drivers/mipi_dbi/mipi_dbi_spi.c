@@ -26,6 +26,14 @@ struct mipi_dbi_spi_data {
 	struct k_mutex lock;
 	/* Used for 3 wire mode */
 	uint16_t spi_byte;
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	/* Taken while an asynchronous display write is running */
+	struct k_sem idle;
+	struct spi_buf async_buf;
+	struct spi_buf_set async_buf_set;
+	mipi_dbi_write_cb_t async_cb;
+	void *async_user_data;
+#endif
 };
 
 /* Expands to 1 if the node does not have the `write-only` property */
@@ -46,6 +54,23 @@ uint32_t var = MIPI_DBI_SPI_READ_REQUIRED;
  */
 #define MIPI_DBI_DC_BIT BIT(8)
 
+/* Waits for the end of a running asynchronous display write, so that the
+ * command/data GPIO and the bus can be used. Called with the lock held.
+ */
+static inline void mipi_dbi_spi_wait_idle(struct mipi_dbi_spi_data *data)
+{
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	(void)k_sem_take(&data->idle, K_FOREVER);
+#endif
+}
+
+static inline void mipi_dbi_spi_set_idle(struct mipi_dbi_spi_data *data)
+{
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	k_sem_give(&data->idle);
+#endif
+}
+
 static int mipi_dbi_spi_write_helper(const struct device *dev,
 				     const struct mipi_dbi_config *dbi_config,
 				     bool cmd_present, uint8_t cmd,
@@ -65,6 +90,8 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		return ret;
 	}
 
+	mipi_dbi_spi_wait_idle(data);
+
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
 		/* 9 bit word mode must be used, as the command/data bit
@@ -72,7 +99,8 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		 */
 		if ((dbi_config->config.operation & SPI_WORD_SIZE_MASK)
 		    != SPI_WORD_SET(9)) {
-			return -ENOTSUP;
+			ret = -ENOTSUP;
+			goto out;
 		}
 		buffer.buf = &data->spi_byte;
 		buffer.len = 2;
@@ -130,6 +158,7 @@ static int mipi_dbi_spi_write_helper(const struct device *dev,
 		ret = -ENOTSUP;
 	}
 out:
+	mipi_dbi_spi_set_idle(data);
 	k_mutex_unlock(&data->lock);
 	return ret;
 }
@@ -155,6 +184,74 @@ static int mipi_dbi_spi_write_display(const struct device *dev,
 					 framebuf, desc->buf_size);
 }
 
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+
+static void mipi_dbi_spi_write_done(const struct device *spi_dev, int result,
+				    void *user_data)
+{
+	const struct device *dev = user_data;
+	struct mipi_dbi_spi_data *data = dev->data;
+	mipi_dbi_write_cb_t cb = data->async_cb;
+	void *cb_user_data = data->async_user_data;
+
+	ARG_UNUSED(spi_dev);
+
+	k_sem_give(&data->idle);
+
+	if (cb != NULL) {
+		cb(dev, result, cb_user_data);
+	}
+}
+
+static int mipi_dbi_spi_write_display_async(const struct device *dev,
+					    const struct mipi_dbi_config *dbi_config,
+					    const uint8_t *framebuf,
+					    struct display_buffer_descriptor *desc,
+					    enum display_pixel_format pixfmt,
+					    mipi_dbi_write_cb_t cb, void *user_data)
+{
+	const struct mipi_dbi_spi_config *config = dev->config;
+	struct mipi_dbi_spi_data *data = dev->data;
+	int ret;
+
+	ARG_UNUSED(pixfmt);
+
+	/* 3 wire mode packs every byte on its own, only 4 wire mode can
+	 * send the framebuffer as one transfer.
+	 */
+	if (dbi_config->mode != MIPI_DBI_MODE_SPI_4WIRE) {
+		return -ENOTSUP;
+	}
+
+	ret = k_mutex_lock(&data->lock, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	mipi_dbi_spi_wait_idle(data);
+
+	data->async_cb = cb;
+	data->async_user_data = user_data;
+	data->async_buf.buf = (void *)framebuf;
+	data->async_buf.len = desc->buf_size;
+	data->async_buf_set.buffers = &data->async_buf;
+	data->async_buf_set.count = 1;
+
+	/* Set CD pin high for data */
+	gpio_pin_set_dt(&config->cmd_data, 1);
+	ret = spi_transceive_cb(config->spi_dev, &dbi_config->config,
+				&data->async_buf_set, NULL,
+				mipi_dbi_spi_write_done, (void *)dev);
+	if (ret < 0) {
+		mipi_dbi_spi_set_idle(data);
+	}
+
+	k_mutex_unlock(&data->lock);
+	return ret;
+}
+
+#endif /* CONFIG_MIPI_DBI_SPI_ASYNC */
+
 #if MIPI_DBI_SPI_READ_REQUIRED
 
 static int mipi_dbi_spi_command_read(const struct device *dev,
@@ -176,6 +273,7 @@ static int mipi_dbi_spi_command_read(const struct device *dev,
 	if (ret < 0) {
 		return ret;
 	}
+	mipi_dbi_spi_wait_idle(data);
 	memcpy(&tmp_config, &dbi_config->config, sizeof(tmp_config));
 	if (dbi_config->mode == MIPI_DBI_MODE_SPI_3WIRE &&
 	    IS_ENABLED(CONFIG_MIPI_DBI_SPI_3WIRE)) {
@@ -240,6 +338,7 @@ static int mipi_dbi_spi_command_read(const struct device *dev,
 	}
 out:
 	spi_release(config->spi_dev, &tmp_config);
+	mipi_dbi_spi_set_idle(data);
 	k_mutex_unlock(&data->lock);
 	return ret;
 }
@@ -310,6 +409,9 @@ static int mipi_dbi_spi_init(const struct device *dev)
 	}
 
 	k_mutex_init(&data->lock);
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	k_sem_init(&data->idle, 1, 1);
+#endif
 
 	return 0;
 }
@@ -322,6 +424,9 @@ static const struct mipi_dbi_driver_api mipi_dbi_spi_driver_api = {
 #if MIPI_DBI_SPI_READ_REQUIRED
 	.command_read = mipi_dbi_spi_command_read,
 #endif
+#ifdef CONFIG_MIPI_DBI_SPI_ASYNC
+	.write_display_async = mipi_dbi_spi_write_display_async,
+#endif
 };
 
 #define MIPI_DBI_SPI_INIT(n)							\
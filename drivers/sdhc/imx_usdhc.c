@@ -663,8 +663,9 @@ static int imx_usdhc_request(const struct device *dev, struct sdhc_command *cmd,
 			host_data.txData = data->data;
 			break;
 		case SD_WRITE_MULTIPLE_BLOCK:
-			if (dev_data->host_io.timing == SDHC_TIMING_SDR104) {
-				/* Card uses UHS104, so it must support CMD23 */
+			if ((dev_data->host_io.timing == SDHC_TIMING_SDR104) ||
+			    (data->flags & SDHC_DATA_BLOCK_COUNT)) {
+				/* Card uses UHS104 or reports CMD23 support */
 				host_data.enableAutoCommand23 = true;
 			} else {
 				/* No CMD23 support */
@@ -677,8 +678,9 @@ static int imx_usdhc_request(const struct device *dev, struct sdhc_command *cmd,
 			host_data.rxData = data->data;
 			break;
 		case SD_READ_MULTIPLE_BLOCK:
-			if (dev_data->host_io.timing == SDHC_TIMING_SDR104) {
-				/* Card uses UHS104, so it must support CMD23 */
+			if ((dev_data->host_io.timing == SDHC_TIMING_SDR104) ||
+			    (data->flags & SDHC_DATA_BLOCK_COUNT)) {
+				/* Card uses UHS104 or reports CMD23 support */
 				host_data.enableAutoCommand23 = true;
 			} else {
 				/* No CMD23 support */
@@ -231,57 +231,66 @@ static inline q31_t icm42688_read_temperature_from_packet(const uint8_t *pkt)
 	return FIELD_PREP(GENMASK(31, 22), whole) | (fraction * GENMASK64(21, 0) / 1000000);
 }
 
-static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
-					 uint8_t axis_offset, q31_t *out)
+static void icm42688_get_imu_scale(bool is_accel, int fs, bool is_20b, int64_t *scale,
+				   int32_t *max)
 {
-	int32_t value;
-	int64_t scale = 0;
-	int32_t max = BIT(15);
-	int offset = 1 + (axis_offset * 2);
+	*scale = 0;
+	*max = BIT(15);
 
-	if (is_accel) {
+	if (is_20b) {
+		/* In 20 bit mode, FS can only be +/-16g and +/-2000dps */
+		*scale = is_accel ? (INT64_C(16) * BIT(8) * 9.80665) : 131;
+		*max = is_accel ? BIT(18) : BIT(19);
+	} else if (is_accel) {
 		switch (fs) {
 		case ICM42688_DT_ACCEL_FS_2:
-			scale = INT64_C(2) * BIT(31 - 5) * 9.80665;
+			*scale = INT64_C(2) * BIT(31 - 5) * 9.80665;
 			break;
 		case ICM42688_DT_ACCEL_FS_4:
-			scale = INT64_C(4) * BIT(31 - 6) * 9.80665;
+			*scale = INT64_C(4) * BIT(31 - 6) * 9.80665;
 			break;
 		case ICM42688_DT_ACCEL_FS_8:
-			scale = INT64_C(8) * BIT(31 - 7) * 9.80665;
+			*scale = INT64_C(8) * BIT(31 - 7) * 9.80665;
 			break;
 		case ICM42688_DT_ACCEL_FS_16:
-			scale = INT64_C(16) * BIT(31 - 8) * 9.80665;
+			*scale = INT64_C(16) * BIT(31 - 8) * 9.80665;
 			break;
 		}
 	} else {
 		switch (fs) {
 		case ICM42688_DT_GYRO_FS_2000:
-			scale = 164;
+			*scale = 164;
 			break;
 		case ICM42688_DT_GYRO_FS_1000:
-			scale = 328;
+			*scale = 328;
 			break;
 		case ICM42688_DT_GYRO_FS_500:
-			scale = 655;
+			*scale = 655;
 			break;
 		case ICM42688_DT_GYRO_FS_250:
-			scale = 1310;
+			*scale = 1310;
 			break;
 		case ICM42688_DT_GYRO_FS_125:
-			scale = 2620;
+			*scale = 2620;
 			break;
 		case ICM42688_DT_GYRO_FS_62_5:
-			scale = 5243;
+			*scale = 5243;
 			break;
 		case ICM42688_DT_GYRO_FS_31_25:
-			scale = 10486;
+			*scale = 10486;
 			break;
 		case ICM42688_DT_GYRO_FS_15_625:
-			scale = 20972;
+			*scale = 20972;
 			break;
 		}
 	}
+}
+
+static int icm42688_read_raw_from_packet(const uint8_t *pkt, bool is_accel, uint8_t axis_offset,
+					 int32_t *out)
+{
+	int32_t value;
+	int offset = 1 + (axis_offset * 2);
 
 	if (!is_accel && FIELD_GET(FIFO_HEADER_ACCEL, pkt[0]) == 1) {
 		offset += 7;
@@ -294,9 +303,6 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 
 		offset = 0x11 + axis_offset;
 		value = (value << 4) | FIELD_GET(mask, pkt[offset]);
-		/* In 20 bit mode, FS can only be +/-16g and +/-2000dps */
-		scale = is_accel ? (INT64_C(16) * BIT(8) * 9.80665) : 131;
-		max = is_accel ? BIT(18) : BIT(19);
 		if (value == -524288) {
 			/* Invalid 20 bit value */
 			return -ENODATA;
@@ -308,6 +314,25 @@ static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int
 		}
 	}
 
+	*out = value;
+	return 0;
+}
+
+static int icm42688_read_imu_from_packet(const uint8_t *pkt, bool is_accel, int fs,
+					 uint8_t axis_offset, q31_t *out)
+{
+	int32_t value;
+	int64_t scale;
+	int32_t max;
+	int rc;
+
+	rc = icm42688_read_raw_from_packet(pkt, is_accel, axis_offset, &value);
+	if (rc != 0) {
+		return rc;
+	}
+
+	icm42688_get_imu_scale(is_accel, fs, FIELD_GET(FIFO_HEADER_20, pkt[0]) == 1, &scale, &max);
+
 	*out = (q31_t)(value * scale / max);
 	return 0;
 }
@@ -450,6 +475,108 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 	return count;
 }
 
+/* Scales a whole array at once. The loop has no branch, so that the compiler can
+ * vectorize it or use the multiply-accumulate instructions of the target.
+ */
+static void icm42688_scale_to_q31(q31_t *values, uint16_t count, int64_t scale, int32_t max)
+{
+	for (uint16_t i = 0; i < count; i++) {
+		values[i] = (q31_t)(values[i] * scale / max);
+	}
+}
+
+static int icm42688_fifo_decode_three_axis(const uint8_t *buffer,
+					   struct sensor_chan_spec chan_spec, uint32_t *fit,
+					   uint16_t max_count,
+					   struct sensor_three_axis_soa *data_out)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	const bool is_accel = IS_ACCEL(chan_spec.chan_type);
+	const int fs = is_accel ? edata->header.accel_fs : edata->header.gyro_fs;
+	const uint32_t period_ns =
+		is_accel ? accel_period_ns[edata->accel_odr] : gyro_period_ns[edata->gyro_odr];
+	bool batch_20b = false;
+	int frame_count = 0;
+	int count = 0;
+	int64_t scale;
+	int32_t max;
+
+	if ((uintptr_t)buffer_end <= *fit || chan_spec.chan_idx != 0) {
+		return 0;
+	}
+	if (!is_accel && !IS_GYRO(chan_spec.chan_type)) {
+		return -ENOTSUP;
+	}
+
+	data_out->header.base_timestamp_ns = edata->header.timestamp;
+	icm42688_get_shift(is_accel ? SENSOR_CHAN_ACCEL_XYZ : SENSOR_CHAN_GYRO_XYZ,
+			   edata->header.accel_fs, edata->header.gyro_fs, &data_out->shift);
+
+	/* First pass: extract the raw samples of the channel into the output arrays */
+	buffer += sizeof(struct icm42688_fifo_data);
+	while (count < max_count && buffer < buffer_end) {
+		const bool is_20b = FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1;
+		const bool has_accel = FIELD_GET(FIFO_HEADER_ACCEL, buffer[0]) == 1;
+		const bool has_gyro = FIELD_GET(FIFO_HEADER_GYRO, buffer[0]) == 1;
+		const uint8_t *frame_end = buffer;
+		int rc;
+
+		if (is_20b) {
+			frame_end += 20;
+		} else if (has_accel && has_gyro) {
+			frame_end += 16;
+		} else {
+			frame_end += 8;
+		}
+
+		if (!(is_accel ? has_accel : has_gyro)) {
+			buffer = frame_end;
+			continue;
+		}
+
+		frame_count++;
+
+		if ((uintptr_t)buffer < *fit) {
+			/* This frame was already decoded, move on to the next frame */
+			buffer = frame_end;
+			continue;
+		}
+
+		/* All the samples of a batch are scaled the same way */
+		if (count == 0) {
+			batch_20b = is_20b;
+		} else if (is_20b != batch_20b) {
+			break;
+		}
+
+		rc = icm42688_read_raw_from_packet(buffer, is_accel, 0, &data_out->x[count]);
+		rc |= icm42688_read_raw_from_packet(buffer, is_accel, 1, &data_out->y[count]);
+		rc |= icm42688_read_raw_from_packet(buffer, is_accel, 2, &data_out->z[count]);
+
+		buffer = frame_end;
+		*fit = (uintptr_t)frame_end;
+
+		if (rc != 0) {
+			continue;
+		}
+
+		if (data_out->timestamp_delta != NULL) {
+			data_out->timestamp_delta[count] = (frame_count - 1) * period_ns;
+		}
+		count++;
+	}
+
+	/* Second pass: scale each axis in one go */
+	icm42688_get_imu_scale(is_accel, fs, batch_20b, &scale, &max);
+	icm42688_scale_to_q31(data_out->x, count, scale, max);
+	icm42688_scale_to_q31(data_out->y, count, scale, max);
+	icm42688_scale_to_q31(data_out->z, count, scale, max);
+
+	data_out->header.reading_count = count;
+	return count;
+}
+
 static int icm42688_one_shot_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
 				    uint32_t *fit, uint16_t max_count, void *data_out)
 {
@@ -580,6 +707,42 @@ static int icm42688_decoder_decode(const uint8_t *buffer, struct sensor_chan_spe
 	return icm42688_one_shot_decode(buffer, chan_spec, fit, max_count, data_out);
 }
 
+static int icm42688_decoder_decode_three_axis(const uint8_t *buffer,
+					      struct sensor_chan_spec chan_spec, uint32_t *fit,
+					      uint16_t max_count,
+					      struct sensor_three_axis_soa *data_out)
+{
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+	struct sensor_three_axis_data frame;
+	int rc;
+
+	if (header->is_fifo) {
+		return icm42688_fifo_decode_three_axis(buffer, chan_spec, fit, max_count,
+						       data_out);
+	}
+
+	if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP) {
+		return -ENOTSUP;
+	}
+
+	rc = icm42688_one_shot_decode(buffer, chan_spec, fit, max_count, &frame);
+	if (rc <= 0) {
+		return rc;
+	}
+
+	data_out->header = frame.header;
+	data_out->shift = frame.shift;
+	if (data_out->timestamp_delta != NULL) {
+		data_out->timestamp_delta[0] = 0;
+	}
+	data_out->x[0] = frame.readings[0].x;
+	data_out->y[0] = frame.readings[0].y;
+	data_out->z[0] = frame.readings[0].z;
+
+	return rc;
+}
+
 static int icm42688_decoder_get_frame_count(const uint8_t *buffer,
 					    struct sensor_chan_spec chan_spec,
 					    uint16_t *frame_count)
@@ -689,6 +852,7 @@ SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_frame_count = icm42688_decoder_get_frame_count,
 	.get_size_info = icm42688_decoder_get_size_info,
 	.decode = icm42688_decoder_decode,
+	.decode_three_axis = icm42688_decoder_decode_three_axis,
 	.has_trigger = icm24688_decoder_has_trigger,
 };
 
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/drivers/serial/uart_async_dma.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(uart_async_dma, CONFIG_UART_LOG_LEVEL);
+
+/*
+ * Reception is double buffered: while the DMA fills the current buffer, the
+ * next one is already provided by the user. Completion of a block releases the
+ * buffer and reloads the channel with the next one. Data received so far is
+ * reported when the receive counter has not moved for the timeout, or when
+ * the UART reports an idle line.
+ */
+
+static void async_evt(struct uart_async_dma *adma, struct uart_event *evt)
+{
+	if (adma->callback != NULL) {
+		adma->callback(adma->dev, evt, adma->user_data);
+	}
+}
+
+static void async_evt_rx_rdy(struct uart_async_dma *adma, uint8_t *buf, size_t offset,
+			     size_t len)
+{
+	struct uart_event evt = {
+		.type = UART_RX_RDY,
+		.data.rx = {
+			.buf = buf,
+			.offset = offset,
+			.len = len,
+		},
+	};
+
+	async_evt(adma, &evt);
+}
+
+static void async_evt_rx_buf(struct uart_async_dma *adma, enum uart_event_type type,
+			     uint8_t *buf)
+{
+	struct uart_event evt = {
+		.type = type,
+		.data.rx_buf.buf = buf,
+	};
+
+	async_evt(adma, &evt);
+}
+
+static void async_evt_tx(struct uart_async_dma *adma, enum uart_event_type type,
+			 const uint8_t *buf, size_t len)
+{
+	struct uart_event evt = {
+		.type = type,
+		.data.tx = {
+			.buf = buf,
+			.len = len,
+		},
+	};
+
+	async_evt(adma, &evt);
+}
+
+static size_t async_dma_pending(const struct uart_async_dma_channel *ch)
+{
+	struct dma_status stat;
+
+	if (dma_get_status(ch->dma_dev, ch->channel, &stat) != 0) {
+		return 0;
+	}
+
+	return stat.pending_length;
+}
+
+static int async_dma_start(struct uart_async_dma *adma, const struct uart_async_dma_channel *ch,
+			   bool tx, uint8_t *buf, size_t len, dma_callback_t callback)
+{
+	struct dma_block_config blk = {
+		.block_size = len,
+	};
+	struct dma_config cfg = {
+		.dma_slot = ch->slot,
+		.channel_direction = tx ? MEMORY_TO_PERIPHERAL : PERIPHERAL_TO_MEMORY,
+		.complete_callback_en = 0,
+		.source_data_size = 1,
+		.dest_data_size = 1,
+		.source_burst_length = 1,
+		.dest_burst_length = 1,
+		.block_count = 1,
+		.head_block = &blk,
+		.user_data = adma,
+		.dma_callback = callback,
+	};
+	int err;
+
+	if (tx) {
+		blk.source_address = (uintptr_t)buf;
+		blk.source_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+		blk.dest_address = ch->reg_addr;
+		blk.dest_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+	} else {
+		blk.source_address = ch->reg_addr;
+		blk.source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+		blk.dest_address = (uintptr_t)buf;
+		blk.dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
+	}
+
+	err = dma_config(ch->dma_dev, ch->channel, &cfg);
+	if (err < 0) {
+		return err;
+	}
+
+	adma->config->dma_req_enable(adma->dev, tx, true);
+
+	return dma_start(ch->dma_dev, ch->channel);
+}
+
+static void async_dma_stop(struct uart_async_dma *adma, const struct uart_async_dma_channel *ch,
+			   bool tx)
+{
+	adma->config->dma_req_enable(adma->dev, tx, false);
+	(void)dma_stop(ch->dma_dev, ch->channel);
+}
+
+/* Reports the bytes received since the last report. */
+static void rx_flush(struct uart_async_dma *adma)
+{
+	k_spinlock_key_t key = k_spin_lock(&adma->lock);
+	uint8_t *buf = adma->rx.buf;
+	size_t offset = adma->rx.offset;
+	size_t received = 0;
+
+	if (adma->rx.enabled) {
+		received = adma->rx.len - async_dma_pending(&adma->config->rx);
+		adma->rx.offset = MAX(received, offset);
+		adma->rx.counter = adma->rx.offset;
+	}
+
+	k_spin_unlock(&adma->lock, key);
+
+	if (received > offset) {
+		async_evt_rx_rdy(adma, buf, offset, received - offset);
+	}
+}
+
+/* Releases the buffers and reports the end of reception. */
+static void rx_finish(struct uart_async_dma *adma)
+{
+	k_spinlock_key_t key = k_spin_lock(&adma->lock);
+	uint8_t *buf = adma->rx.buf;
+	uint8_t *next_buf = adma->rx.next_buf;
+
+	adma->rx.buf = NULL;
+	adma->rx.next_buf = NULL;
+	k_spin_unlock(&adma->lock, key);
+
+	(void)k_work_cancel_delayable(&adma->rx.timeout_work);
+
+	if (buf != NULL) {
+		async_evt_rx_buf(adma, UART_RX_BUF_RELEASED, buf);
+	}
+
+	if (next_buf != NULL) {
+		async_evt_rx_buf(adma, UART_RX_BUF_RELEASED, next_buf);
+	}
+
+	async_evt(adma, &(struct uart_event){ .type = UART_RX_DISABLED });
+}
+
+static void rx_dma_callback(const struct device *dma_dev, void *user_data, uint32_t channel,
+			    int status)
+{
+	struct uart_async_dma *adma = user_data;
+	const struct uart_async_dma_channel *ch = &adma->config->rx;
+	k_spinlock_key_t key;
+	uint8_t *buf;
+	size_t offset;
+	size_t len;
+	int err;
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+
+	if (status < 0) {
+		LOG_ERR("%s: RX DMA error (%d)", adma->dev->name, status);
+		async_dma_stop(adma, ch, false);
+		rx_flush(adma);
+		adma->rx.enabled = false;
+		async_evt(adma, &(struct uart_event){
+			.type = UART_RX_STOPPED,
+			.data.rx_stop.reason = UART_ERROR_OVERRUN,
+		});
+		rx_finish(adma);
+		return;
+	}
+
+	key = k_spin_lock(&adma->lock);
+	buf = adma->rx.buf;
+	offset = adma->rx.offset;
+	len = adma->rx.len;
+
+	/* Switch to the next buffer first to keep the gap short */
+	adma->rx.buf = adma->rx.next_buf;
+	adma->rx.len = adma->rx.next_len;
+	adma->rx.offset = 0;
+	adma->rx.counter = 0;
+	adma->rx.next_buf = NULL;
+	err = 0;
+	if (adma->rx.buf != NULL) {
+		err = dma_reload(ch->dma_dev, ch->channel, ch->reg_addr,
+				 (uintptr_t)adma->rx.buf, adma->rx.len);
+		if (err == 0) {
+			err = dma_start(ch->dma_dev, ch->channel);
+		}
+	}
+
+	if (adma->rx.buf == NULL || err != 0) {
+		adma->rx.enabled = false;
+	}
+
+	k_spin_unlock(&adma->lock, key);
+
+	if (len > offset) {
+		async_evt_rx_rdy(adma, buf, offset, len - offset);
+	}
+
+	async_evt_rx_buf(adma, UART_RX_BUF_RELEASED, buf);
+
+	if (adma->rx.enabled) {
+		async_evt(adma, &(struct uart_event){ .type = UART_RX_BUF_REQUEST });
+		return;
+	}
+
+	if (err != 0) {
+		LOG_ERR("%s: RX DMA reload failed (%d)", adma->dev->name, err);
+	}
+
+	async_dma_stop(adma, ch, false);
+	rx_finish(adma);
+}
+
+static void rx_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct uart_async_dma *adma = CONTAINER_OF(dwork, struct uart_async_dma,
+						   rx.timeout_work);
+	k_spinlock_key_t key;
+	size_t received;
+	bool idle;
+
+	key = k_spin_lock(&adma->lock);
+	if (!adma->rx.enabled) {
+		k_spin_unlock(&adma->lock, key);
+		return;
+	}
+
+	received = adma->rx.len - async_dma_pending(&adma->config->rx);
+	idle = (received == adma->rx.counter);
+	adma->rx.counter = received;
+	k_spin_unlock(&adma->lock, key);
+
+	/* Data is reported once the receiver stayed idle for a whole period */
+	if (idle) {
+		rx_flush(adma);
+	}
+
+	(void)k_work_reschedule(dwork, K_USEC(adma->rx.timeout));
+}
+
+void uart_async_dma_rx_idle(struct uart_async_dma *adma)
+{
+	rx_flush(adma);
+}
+
+static void tx_dma_callback(const struct device *dma_dev, void *user_data, uint32_t channel,
+			    int status)
+{
+	struct uart_async_dma *adma = user_data;
+	k_spinlock_key_t key;
+	const uint8_t *buf;
+	size_t len;
+
+	ARG_UNUSED(dma_dev);
+	ARG_UNUSED(channel);
+
+	if (status < 0) {
+		LOG_ERR("%s: TX DMA error (%d)", adma->dev->name, status);
+		(void)uart_async_dma_tx_abort(adma);
+		return;
+	}
+
+	(void)k_work_cancel_delayable(&adma->tx.timeout_work);
+	adma->config->dma_req_enable(adma->dev, true, false);
+
+	key = k_spin_lock(&adma->lock);
+	buf = adma->tx.buf;
+	len = adma->tx.len;
+	adma->tx.buf = NULL;
+	k_spin_unlock(&adma->lock, key);
+
+	if (buf != NULL) {
+		async_evt_tx(adma, UART_TX_DONE, buf, len);
+	}
+}
+
+static void tx_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct uart_async_dma *adma = CONTAINER_OF(dwork, struct uart_async_dma,
+						   tx.timeout_work);
+
+	(void)uart_async_dma_tx_abort(adma);
+}
+
+int uart_async_dma_callback_set(struct uart_async_dma *adma, uart_callback_t callback,
+				void *user_data)
+{
+	adma->callback = callback;
+	adma->user_data = user_data;
+
+	return 0;
+}
+
+int uart_async_dma_tx(struct uart_async_dma *adma, const uint8_t *buf, size_t len,
+		      int32_t timeout)
+{
+	const struct uart_async_dma_channel *ch = &adma->config->tx;
+	k_spinlock_key_t key;
+	int err;
+
+	if (ch->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+
+	key = k_spin_lock(&adma->lock);
+	if (adma->tx.buf != NULL) {
+		k_spin_unlock(&adma->lock, key);
+		return -EBUSY;
+	}
+
+	adma->tx.buf = buf;
+	adma->tx.len = len;
+	k_spin_unlock(&adma->lock, key);
+
+	err = async_dma_start(adma, ch, true, (uint8_t *)buf, len, tx_dma_callback);
+	if (err < 0) {
+		LOG_ERR("%s: TX DMA start failed (%d)", adma->dev->name, err);
+		adma->tx.buf = NULL;
+		return err;
+	}
+
+	if (timeout != SYS_FOREVER_US) {
+		(void)k_work_schedule(&adma->tx.timeout_work, K_USEC(timeout));
+	}
+
+	return 0;
+}
+
+int uart_async_dma_tx_abort(struct uart_async_dma *adma)
+{
+	const struct uart_async_dma_channel *ch = &adma->config->tx;
+	k_spinlock_key_t key;
+	const uint8_t *buf;
+	size_t sent;
+
+	if (ch->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+
+	(void)k_work_cancel_delayable(&adma->tx.timeout_work);
+
+	key = k_spin_lock(&adma->lock);
+	buf = adma->tx.buf;
+	if (buf == NULL) {
+		k_spin_unlock(&adma->lock, key);
+		return -EFAULT;
+	}
+
+	sent = adma->tx.len - async_dma_pending(ch);
+	async_dma_stop(adma, ch, true);
+	adma->tx.buf = NULL;
+	k_spin_unlock(&adma->lock, key);
+
+	async_evt_tx(adma, UART_TX_ABORTED, buf, sent);
+
+	return 0;
+}
+
+int uart_async_dma_rx_enable(struct uart_async_dma *adma, uint8_t *buf, size_t len,
+			     int32_t timeout)
+{
+	const struct uart_async_dma_channel *ch = &adma->config->rx;
+	int err;
+
+	if (ch->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (adma->rx.enabled || adma->rx.buf != NULL) {
+		return -EBUSY;
+	}
+
+	adma->rx.buf = buf;
+	adma->rx.len = len;
+	adma->rx.offset = 0;
+	adma->rx.counter = 0;
+	adma->rx.next_buf = NULL;
+	adma->rx.timeout = timeout;
+	adma->rx.enabled = true;
+
+	err = async_dma_start(adma, ch, false, buf, len, rx_dma_callback);
+	if (err < 0) {
+		LOG_ERR("%s: RX DMA start failed (%d)", adma->dev->name, err);
+		adma->rx.buf = NULL;
+		adma->rx.enabled = false;
+		return err;
+	}
+
+	if (timeout != SYS_FOREVER_US) {
+		(void)k_work_schedule(&adma->rx.timeout_work, K_USEC(timeout));
+	}
+
+	async_evt(adma, &(struct uart_event){ .type = UART_RX_BUF_REQUEST });
+
+	return 0;
+}
+
+int uart_async_dma_rx_buf_rsp(struct uart_async_dma *adma, uint8_t *buf, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&adma->lock);
+	int err = 0;
+
+	if (!adma->rx.enabled) {
+		err = -EACCES;
+	} else if (adma->rx.next_buf != NULL) {
+		err = -EBUSY;
+	} else {
+		adma->rx.next_buf = buf;
+		adma->rx.next_len = len;
+	}
+
+	k_spin_unlock(&adma->lock, key);
+
+	return err;
+}
+
+int uart_async_dma_rx_disable(struct uart_async_dma *adma)
+{
+	const struct uart_async_dma_channel *ch = &adma->config->rx;
+
+	if (ch->dma_dev == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (!adma->rx.enabled) {
+		return -EFAULT;
+	}
+
+	async_dma_stop(adma, ch, false);
+	rx_flush(adma);
+	adma->rx.enabled = false;
+	rx_finish(adma);
+
+	return 0;
+}
+
+int uart_async_dma_init(struct uart_async_dma *adma, const struct device *dev,
+			const struct uart_async_dma_config *config)
+{
+	if ((config->tx.dma_dev != NULL && !device_is_ready(config->tx.dma_dev)) ||
+	    (config->rx.dma_dev != NULL && !device_is_ready(config->rx.dma_dev))) {
+		return -ENODEV;
+	}
+
+	adma->dev = dev;
+	adma->config = config;
+	k_work_init_delayable(&adma->tx.timeout_work, tx_timeout);
+	k_work_init_delayable(&adma->rx.timeout_work, rx_timeout);
+
+	return 0;
+}
@@ -27,6 +27,9 @@
 #if defined(CONFIG_CLOCK_CONTROL)
 #include <zephyr/drivers/clock_control.h>
 #endif
+#ifdef CONFIG_UART_ASYNC_API
+#include <zephyr/drivers/serial/uart_async_dma.h>
+#endif
 
 #ifdef CONFIG_CPU_CORTEX_M
 #include <cmsis_compiler.h>
@@ -60,6 +63,10 @@ struct pl011_config {
 #endif
 #ifdef CONFIG_UART_INTERRUPT_DRIVEN
 	uart_irq_config_func_t irq_config_func;
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	/* NULL if the instance has no DMA channels */
+	const struct uart_async_dma_config *async_config;
 #endif
 	int (*clk_enable_func)(const struct device *dev, uint32_t clk);
 	int (*pwr_on_func)(void);
@@ -76,6 +83,9 @@ struct pl011_data {
 	uart_irq_callback_user_data_t irq_cb;
 	void *irq_cb_data;
 #endif
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_async_dma async;
+#endif
 };
 
 static void pl011_enable(const struct device *dev)
@@ -441,6 +451,92 @@ static void pl011_irq_callback_set(const struct device *dev,
 }
 #endif /* CONFIG_UART_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_UART_ASYNC_API
+static void pl011_dma_req_enable(const struct device *dev, bool tx, bool enable)
+{
+	uint32_t mask = tx ? PL011_DMACR_TXDMAE : PL011_DMACR_RXDMAE;
+
+	if (enable) {
+		get_uart(dev)->dmacr |= mask;
+	} else {
+		get_uart(dev)->dmacr &= ~mask;
+	}
+}
+
+static int pl011_callback_set(const struct device *dev, uart_callback_t callback,
+			      void *user_data)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_callback_set(&data->async, callback, user_data);
+}
+
+static int pl011_tx(const struct device *dev, const uint8_t *buf, size_t len, int32_t timeout)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_tx(&data->async, buf, len, timeout);
+}
+
+static int pl011_tx_abort(const struct device *dev)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_tx_abort(&data->async);
+}
+
+static int pl011_rx_enable(const struct device *dev, uint8_t *buf, size_t len, int32_t timeout)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_rx_enable(&data->async, buf, len, timeout);
+}
+
+static int pl011_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_rx_buf_rsp(&data->async, buf, len);
+}
+
+static int pl011_rx_disable(const struct device *dev)
+{
+	const struct pl011_config *config = dev->config;
+	struct pl011_data *data = dev->data;
+
+	if (config->async_config == NULL) {
+		return -ENOTSUP;
+	}
+
+	return uart_async_dma_rx_disable(&data->async);
+}
+#endif /* CONFIG_UART_ASYNC_API */
+
 static const struct uart_driver_api pl011_driver_api = {
 	.poll_in = pl011_poll_in,
 	.poll_out = pl011_poll_out,
@@ -465,6 +561,14 @@ static const struct uart_driver_api pl011_driver_api = {
 	.irq_update = pl011_irq_update,
 	.irq_callback_set = pl011_irq_callback_set,
 #endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+#ifdef CONFIG_UART_ASYNC_API
+	.callback_set = pl011_callback_set,
+	.tx = pl011_tx,
+	.tx_abort = pl011_tx_abort,
+	.rx_enable = pl011_rx_enable,
+	.rx_buf_rsp = pl011_rx_buf_rsp,
+	.rx_disable = pl011_rx_disable,
+#endif /* CONFIG_UART_ASYNC_API */
 };
 
 static int pl011_init(const struct device *dev)
@@ -543,6 +647,14 @@ static int pl011_init(const struct device *dev)
 #ifdef CONFIG_UART_INTERRUPT_DRIVEN
 	config->irq_config_func(dev);
 	data->sw_call_txdrdy = true;
+#endif
+#ifdef CONFIG_UART_ASYNC_API
+	if (config->async_config != NULL) {
+		ret = uart_async_dma_init(&data->async, dev, config->async_config);
+		if (ret) {
+			return ret;
+		}
+	}
 #endif
 	if (!data->sbsa) {
 		pl011_enable(dev);
@@ -603,6 +715,32 @@ static int pl011_init(const struct device *dev)
 		     .clock_id = (clock_control_subsys_t)DT_INST_CLOCKS_CELL(n,                    \
 				  COMPAT_SPECIFIC_CLOCK_CTLR_SUBSYS_CELL(n)),))
 
+#ifdef CONFIG_UART_ASYNC_API
+#define PL011_DMA_CHANNEL(n, dir)                                                                  \
+	COND_CODE_1(DT_INST_DMAS_HAS_NAME(n, dir),                                                 \
+		    ({                                                                             \
+			    .dma_dev = DEVICE_DT_GET(DT_INST_DMAS_CTLR_BY_NAME(n, dir)),           \
+			    .channel = DT_INST_PHA_BY_NAME_OR(n, dmas, dir, channel, 0),           \
+			    .slot = DT_INST_PHA_BY_NAME_OR(n, dmas, dir, slot, 0),                 \
+			    .reg_addr = DT_INST_REG_ADDR(n) + offsetof(struct pl011_regs, dr),     \
+		    }),                                                                            \
+		    ({0}))
+
+#define PL011_ASYNC_DEFINE(n)                                                                      \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(n, dmas),                                                 \
+		   (static const struct uart_async_dma_config pl011_async_cfg_##n = {              \
+			    .tx = PL011_DMA_CHANNEL(n, tx),                                        \
+			    .rx = PL011_DMA_CHANNEL(n, rx),                                        \
+			    .dma_req_enable = pl011_dma_req_enable,                                \
+		    };))
+
+#define PL011_ASYNC_INIT(n)                                                                        \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(n, dmas), (.async_config = &pl011_async_cfg_##n,))
+#else
+#define PL011_ASYNC_DEFINE(n)
+#define PL011_ASYNC_INIT(n)
+#endif /* CONFIG_UART_ASYNC_API */
+
 #define ARM_PL011_DEFINE(n)                                                                        \
 	static inline int pwr_on_arm_pl011_##n(void)                                               \
 	{                                                                                          \
@@ -647,6 +785,7 @@ void pl011_isr(const struct device *dev)
 		DEVICE_MMIO_ROM_INIT(DT_DRV_INST(n)),					\
 		CLOCK_INIT(n)                                                           \
 		PINCTRL_INIT(n)	                                                        \
+		PL011_ASYNC_INIT(n)							\
 		.irq_config_func = pl011_irq_config_func_##n,				\
 		.clk_enable_func = COMPAT_SPECIFIC_CLK_ENABLE_FUNC(n),		        \
 		.pwr_on_func = COMPAT_SPECIFIC_PWR_ON_FUNC(n),			        \
@@ -657,12 +796,14 @@ void pl011_isr(const struct device *dev)
 		DEVICE_MMIO_ROM_INIT(DT_DRV_INST(n)),					\
 		CLOCK_INIT(n)                                                           \
 		PINCTRL_INIT(n)	                                                        \
+		PL011_ASYNC_INIT(n)							\
 	};
 #endif /* CONFIG_UART_INTERRUPT_DRIVEN */
 
 #define PL011_INIT(n)                                                                              \
 	PINCTRL_DEFINE(n)                                                                          \
 	COMPAT_SPECIFIC_DEFINE(n)                                                                  \
+	PL011_ASYNC_DEFINE(n)                                                                      \
 	PL011_CONFIG_PORT(n)                                                                       \
                                                                                                    \
 	static struct pl011_data pl011_data_port_##n = {                                           \
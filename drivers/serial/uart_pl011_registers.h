@@ -145,6 +145,10 @@ volatile struct pl011_regs *get_uart(const struct device *dev)
 		PL011_IMSC_RXIM | PL011_IMSC_TXIM | \
 		PL011_IMSC_RTIM)
 
+/* PL011 DMA Control Register */
+#define PL011_DMACR_RXDMAE	BIT(0)	/* receive DMA enable */
+#define PL011_DMACR_TXDMAE	BIT(1)	/* transmit DMA enable */
+
 /* PL011 Raw Interrupt Status Register */
 #define PL011_RIS_TXRIS		BIT(5)	/* Transmit interrupt status */
 
@@ -53,6 +53,15 @@ struct spi_nrfx_data {
 	uint8_t ppi_ch;
 	uint8_t gpiote_ch;
 #endif
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+	struct spi_rtio *rtio_ctx;
+	/* Last configuration used by a blocking transfer */
+	struct spi_config rtio_config;
+	struct spi_buf rtio_tx_buf;
+	struct spi_buf rtio_rx_buf;
+	struct spi_buf_set rtio_tx_bufs;
+	struct spi_buf_set rtio_rx_bufs;
+#endif
 };
 
 struct spi_nrfx_config {
@@ -73,6 +82,9 @@ struct spi_nrfx_config {
 };
 
 static void event_handler(const nrfx_spim_evt_t *p_event, void *p_context);
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+static void spi_nrfx_iodev_complete(const struct device *dev, int status);
+#endif
 
 static inline void finalize_spi_transaction(const struct device *dev, bool deactivate_cs)
 {
@@ -317,6 +329,12 @@ static void finish_transaction(const struct device *dev, int error)
 
 	LOG_DBG("Transaction finished with status %d", error);
 
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+	/* All transfers go through the RTIO context */
+	spi_nrfx_iodev_complete(dev, error);
+	return;
+#endif
+
 	spi_context_complete(ctx, dev, error);
 	dev_data->busy = false;
 
@@ -444,6 +462,7 @@ static void event_handler(const nrfx_spim_evt_t *p_event, void *p_context)
 	}
 }
 
+#ifndef CONFIG_SPI_NRFX_SPIM_RTIO
 static int transceive(const struct device *dev,
 		      const struct spi_config *spi_cfg,
 		      const struct spi_buf_set *tx_bufs,
@@ -517,13 +536,146 @@ static int transceive(const struct device *dev,
 
 	return error;
 }
+#endif /* !CONFIG_SPI_NRFX_SPIM_RTIO */
+
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+static void spi_nrfx_iodev_start(const struct device *dev)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct rtio_sqe *sqe = &dev_data->rtio_ctx->txn_curr->sqe;
+	const struct spi_buf_set *tx_bufs = NULL;
+	const struct spi_buf_set *rx_bufs = NULL;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		dev_data->rtio_rx_buf.buf = sqe->rx.buf;
+		dev_data->rtio_rx_buf.len = sqe->rx.buf_len;
+		rx_bufs = &dev_data->rtio_rx_bufs;
+		break;
+	case RTIO_OP_TX:
+		dev_data->rtio_tx_buf.buf = (void *)sqe->tx.buf;
+		dev_data->rtio_tx_buf.len = sqe->tx.buf_len;
+		tx_bufs = &dev_data->rtio_tx_bufs;
+		break;
+	case RTIO_OP_TINY_TX:
+		dev_data->rtio_tx_buf.buf = sqe->tiny_tx.buf;
+		dev_data->rtio_tx_buf.len = sqe->tiny_tx.buf_len;
+		tx_bufs = &dev_data->rtio_tx_bufs;
+		break;
+	case RTIO_OP_TXRX:
+		dev_data->rtio_tx_buf.buf = (void *)sqe->txrx.tx_buf;
+		dev_data->rtio_tx_buf.len = sqe->txrx.buf_len;
+		dev_data->rtio_rx_buf.buf = sqe->txrx.rx_buf;
+		dev_data->rtio_rx_buf.len = sqe->txrx.buf_len;
+		tx_bufs = &dev_data->rtio_tx_bufs;
+		rx_bufs = &dev_data->rtio_rx_bufs;
+		break;
+	default:
+		LOG_ERR("Invalid op code %d for submission %p", sqe->op, (void *)sqe);
+		spi_nrfx_iodev_complete(dev, -EINVAL);
+		return;
+	}
+
+	/* Transfers longer than the EasyDMA limit are still split in chunks,
+	 * finish_transaction() is called once the whole submission is done.
+	 */
+	spi_context_buffers_setup(&dev_data->ctx, tx_bufs, rx_bufs, 1);
+	transfer_next_chunk(dev);
+}
+
+static void spi_nrfx_iodev_prepare_start(const struct device *dev)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	const struct spi_nrfx_config *dev_config = dev->config;
+	struct spi_rtio *rtio_ctx = dev_data->rtio_ctx;
+	struct spi_dt_spec *spi_dt_spec = rtio_ctx->txn_curr->sqe.iodev->data;
+	struct spi_config *spi_cfg = &spi_dt_spec->config;
+	void *reg = dev_config->spim.p_reg;
+	int error;
+
+	/* Blocking transfers all use the configuration held by the context,
+	 * so configure() cannot tell a change from the pointer alone.
+	 */
+	if (spi_dt_spec == &rtio_ctx->dt_spec &&
+	    memcmp(spi_cfg, &dev_data->rtio_config, sizeof(*spi_cfg)) != 0) {
+		dev_data->rtio_config = *spi_cfg;
+		dev_data->ctx.config = NULL;
+	}
+
+	error = configure(dev, spi_cfg);
+	if (error != 0) {
+		if (spi_rtio_complete(rtio_ctx, error)) {
+			spi_nrfx_iodev_prepare_start(dev);
+		}
+		return;
+	}
+
+	dev_data->busy = true;
+
+	if (dev_config->wake_pin != WAKE_PIN_NOT_USED &&
+	    spi_nrfx_wake_request(&dev_config->wake_gpiote,
+				  dev_config->wake_pin) == -ETIMEDOUT) {
+		LOG_WRN("Waiting for WAKE acknowledgment timed out");
+	}
+
+	if (NRF_SPIM_IS_320MHZ_SPIM(reg)) {
+		nrfy_spim_enable(reg);
+	}
+	spi_context_cs_control(&dev_data->ctx, true);
+
+	spi_nrfx_iodev_start(dev);
+}
+
+static void spi_nrfx_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct spi_rtio *rtio_ctx = dev_data->rtio_ctx;
+
+	if (status == 0 && (rtio_ctx->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		/* Keep CS asserted and go on with the next part of the
+		 * transaction straight from the interrupt.
+		 */
+		rtio_ctx->txn_curr = rtio_txn_next(rtio_ctx->txn_curr);
+		spi_nrfx_iodev_start(dev);
+		return;
+	}
+
+	dev_data->busy = false;
+	finalize_spi_transaction(dev, true);
+
+	if (spi_rtio_complete(rtio_ctx, status)) {
+		spi_nrfx_iodev_prepare_start(dev);
+	}
+}
+
+static void spi_nrfx_iodev_submit(const struct device *dev,
+				  struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+
+	if (spi_rtio_submit(dev_data->rtio_ctx, iodev_sqe)) {
+		spi_nrfx_iodev_prepare_start(dev);
+	}
+}
+#endif /* CONFIG_SPI_NRFX_SPIM_RTIO */
 
 static int spi_nrfx_transceive(const struct device *dev,
 			       const struct spi_config *spi_cfg,
 			       const struct spi_buf_set *tx_bufs,
 			       const struct spi_buf_set *rx_bufs)
 {
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+	struct spi_nrfx_data *dev_data = dev->data;
+	int error;
+
+	spi_context_lock(&dev_data->ctx, false, NULL, NULL, spi_cfg);
+	error = spi_rtio_transceive(dev_data->rtio_ctx, spi_cfg, tx_bufs, rx_bufs);
+	spi_context_release(&dev_data->ctx, error);
+
+	return error;
+#else
 	return transceive(dev, spi_cfg, tx_bufs, rx_bufs, false, NULL, NULL);
+#endif
 }
 
 #ifdef CONFIG_SPI_ASYNC
@@ -543,7 +695,12 @@ static int spi_nrfx_release(const struct device *dev,
 {
 	struct spi_nrfx_data *dev_data = dev->data;
 
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+	/* Blocking transfers are configured from a copy of spi_cfg */
+	if (memcmp(spi_cfg, &dev_data->rtio_config, sizeof(*spi_cfg)) != 0) {
+#else
 	if (!spi_context_configured(&dev_data->ctx, spi_cfg)) {
+#endif
 		return -EINVAL;
 	}
 
@@ -562,7 +719,9 @@ static const struct spi_driver_api spi_nrfx_driver_api = {
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_nrfx_transceive_async,
 #endif
-#ifdef CONFIG_SPI_RTIO
+#if defined(CONFIG_SPI_NRFX_SPIM_RTIO)
+	.iodev_submit = spi_nrfx_iodev_submit,
+#elif defined(CONFIG_SPI_RTIO)
 	.iodev_submit = spi_rtio_iodev_default_submit,
 #endif
 	.release = spi_nrfx_release,
@@ -642,6 +801,14 @@ static int spi_nrfx_init(const struct device *dev)
 
 	spi_context_unlock_unconditionally(&dev_data->ctx);
 
+#ifdef CONFIG_SPI_NRFX_SPIM_RTIO
+	dev_data->rtio_tx_bufs.buffers = &dev_data->rtio_tx_buf;
+	dev_data->rtio_tx_bufs.count = 1;
+	dev_data->rtio_rx_bufs.buffers = &dev_data->rtio_rx_buf;
+	dev_data->rtio_rx_bufs.count = 1;
+	spi_rtio_init(dev_data->rtio_ctx, dev);
+#endif
+
 #ifdef CONFIG_SOC_NRF52832_ALLOW_SPIM_DESPITE_PAN_58
 	return anomaly_58_workaround_init(dev);
 #else
@@ -688,6 +855,10 @@ static int spi_nrfx_init(const struct device *dev)
 		 static uint8_t spim_##idx##_rx_buffer			       \
 			[CONFIG_SPI_NRFX_RAM_BUFFER_SIZE]		       \
 			SPIM_MEMORY_SECTION(idx);))			       \
+	IF_ENABLED(CONFIG_SPI_NRFX_SPIM_RTIO,				       \
+		(SPI_RTIO_DEFINE(spi_##idx##_rtio,			       \
+				 CONFIG_SPI_NRFX_SPIM_RTIO_SQ_SIZE,	       \
+				 CONFIG_SPI_NRFX_SPIM_RTIO_SQ_SIZE)))	       \
 	static struct spi_nrfx_data spi_##idx##_data = {		       \
 		SPI_CONTEXT_INIT_LOCK(spi_##idx##_data, ctx),		       \
 		SPI_CONTEXT_INIT_SYNC(spi_##idx##_data, ctx),		       \
@@ -695,6 +866,8 @@ static int spi_nrfx_init(const struct device *dev)
 		IF_ENABLED(SPI_BUFFER_IN_RAM,				       \
 			(.tx_buffer = spim_##idx##_tx_buffer,		       \
 			 .rx_buffer = spim_##idx##_rx_buffer,))		       \
+		IF_ENABLED(CONFIG_SPI_NRFX_SPIM_RTIO,			       \
+			(.rtio_ctx = &spi_##idx##_rtio,))		       \
 		.dev  = DEVICE_DT_GET(SPIM(idx)),			       \
 		.busy = false,						       \
 	};								       \
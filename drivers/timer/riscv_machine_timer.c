@@ -110,6 +110,12 @@ static uint64_t last_count;
 static uint64_t last_ticks;
 static uint32_t last_elapsed;
 
+#ifdef CONFIG_HRTIMER
+/* Comparator values wanted for the tick timeout and the high-resolution timer */
+static uint64_t tick_cmp;
+static uint64_t hrtimer_cmp = UINT64_MAX;
+#endif
+
 #if defined(CONFIG_TEST)
 const int32_t z_sys_timer_irq_for_test = TIMER_IRQN;
 #endif
@@ -138,6 +144,16 @@ static void set_mtimecmp(uint64_t time)
 #endif
 }
 
+/* Programs the tick timeout, or the high-resolution timer if it is earlier */
+static void set_tick_cmp(uint64_t time)
+{
+#ifdef CONFIG_HRTIMER
+	tick_cmp = time;
+	time = MIN(time, hrtimer_cmp);
+#endif
+	set_mtimecmp(time);
+}
+
 static void set_divider(void)
 {
 #ifdef MTIMER_HAS_DIVIDER
@@ -178,13 +194,30 @@ static void timer_isr(const void *arg)
 	last_ticks += dticks;
 	last_elapsed = 0;
 
+#ifdef CONFIG_HRTIMER
+	bool hrtimer_expired = now >= hrtimer_cmp;
+
+	if (hrtimer_expired) {
+		/* Consumed, rearm the comparator for the tick timeout */
+		hrtimer_cmp = UINT64_MAX;
+		set_mtimecmp(tick_cmp);
+	}
+#endif
+
 	if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
 		uint64_t next = last_count + CYC_PER_TICK;
 
-		set_mtimecmp(next);
+		set_tick_cmp(next);
 	}
 
 	k_spin_unlock(&lock, key);
+
+#ifdef CONFIG_HRTIMER
+	if (hrtimer_expired) {
+		sys_clock_hrtimer_announce();
+	}
+#endif
+
 	sys_clock_announce(dticks);
 }
 
@@ -207,7 +240,7 @@ void sys_clock_set_timeout(int32_t ticks, bool idle)
 			cyc = last_count + CYCLES_MAX;
 		}
 	}
-	set_mtimecmp(cyc);
+	set_tick_cmp(cyc);
 
 	k_spin_unlock(&lock, key);
 }
@@ -228,6 +261,26 @@ uint32_t sys_clock_elapsed(void)
 	return dticks;
 }
 
+#ifdef CONFIG_HRTIMER
+void sys_clock_hrtimer_set(uint64_t cycles)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint64_t mask = BIT64(CONFIG_RISCV_MACHINE_TIMER_SYSTEM_CLOCK_DIVIDER) - 1;
+
+	if (cycles == UINT64_MAX) {
+		hrtimer_cmp = UINT64_MAX;
+	} else {
+		/* Rounded up to a timer count, never expire early */
+		hrtimer_cmp = (cycles >> CONFIG_RISCV_MACHINE_TIMER_SYSTEM_CLOCK_DIVIDER) +
+			      ((cycles & mask) != 0 ? 1 : 0);
+	}
+
+	set_mtimecmp(MIN(tick_cmp, hrtimer_cmp));
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_HRTIMER */
+
 uint32_t sys_clock_cycle_get_32(void)
 {
 	return ((uint32_t)mtime()) << CONFIG_RISCV_MACHINE_TIMER_SYSTEM_CLOCK_DIVIDER;
@@ -246,7 +299,7 @@ static int sys_clock_driver_init(void)
 	IRQ_CONNECT(TIMER_IRQN, 0, timer_isr, NULL, 0);
 	last_ticks = mtime() / CYC_PER_TICK;
 	last_count = last_ticks * CYC_PER_TICK;
-	set_mtimecmp(last_count + CYC_PER_TICK);
+	set_tick_cmp(last_count + CYC_PER_TICK);
 	irq_enable(TIMER_IRQN);
 	return 0;
 }
@@ -5,7 +5,13 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/cache.h>
 #include <zephyr/drivers/video.h>
+#include <zephyr/sys/atomic.h>
+
+#if defined(CONFIG_VIDEO_BUFFER_NET_BUF)
+#include <zephyr/net_buf.h>
+#endif
 
 #if defined(CONFIG_VIDEO_BUFFER_USE_SHARED_MULTI_HEAP)
 #include <zephyr/multi_heap/shared_multi_heap.h>
@@ -24,26 +30,44 @@ static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
 struct mem_block {
 	void *data;
+	atomic_t refcount;
+	bool imported;
 };
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
-struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
+static struct video_buffer *video_buffer_get(struct mem_block *block, size_t size,
+					     bool imported)
 {
-	struct video_buffer *vbuf = NULL;
-	struct mem_block *block;
-	int i;
+	struct video_buffer *vbuf = &video_buf[ARRAY_INDEX(video_block, block)];
 
+	atomic_set(&block->refcount, 1);
+	block->imported = imported;
+
+	vbuf->buffer = block->data;
+	vbuf->size = size;
+	vbuf->bytesused = 0;
+
+	return vbuf;
+}
+
+static struct mem_block *video_block_find_free(void)
+{
 	/* find available video buffer */
-	for (i = 0; i < ARRAY_SIZE(video_buf); i++) {
+	for (int i = 0; i < ARRAY_SIZE(video_buf); i++) {
 		if (video_buf[i].buffer == NULL) {
-			vbuf = &video_buf[i];
-			block = &video_block[i];
-			break;
+			return &video_block[i];
 		}
 	}
 
-	if (vbuf == NULL) {
+	return NULL;
+}
+
+struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
+{
+	struct mem_block *block = video_block_find_free();
+
+	if (block == NULL) {
 		return NULL;
 	}
 
@@ -53,11 +77,20 @@ struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
 		return NULL;
 	}
 
-	vbuf->buffer = block->data;
-	vbuf->size = size;
-	vbuf->bytesused = 0;
+	return video_buffer_get(block, size, false);
+}
 
-	return vbuf;
+struct video_buffer *video_buffer_import(void *mem, size_t size)
+{
+	struct mem_block *block = video_block_find_free();
+
+	if (block == NULL || mem == NULL) {
+		return NULL;
+	}
+
+	block->data = mem;
+
+	return video_buffer_get(block, size, true);
 }
 
 struct video_buffer *video_buffer_alloc(size_t size)
@@ -78,8 +111,63 @@ void video_buffer_release(struct video_buffer *vbuf)
 		}
 	}
 
+	/* the buffer is still used by a consumer */
+	if (block && atomic_dec(&block->refcount) > 1) {
+		return;
+	}
+
 	vbuf->buffer = NULL;
-	if (block) {
+	if (block && !block->imported) {
 		VIDEO_COMMON_FREE(block->data);
 	}
 }
+
+struct video_buffer *video_buffer_ref(struct video_buffer *vbuf)
+{
+	atomic_inc(&video_block[ARRAY_INDEX(video_buf, vbuf)].refcount);
+
+	return vbuf;
+}
+
+void video_buffer_sync_for_device(struct video_buffer *vbuf)
+{
+	sys_cache_data_flush_range(vbuf->buffer, vbuf->bytesused);
+}
+
+void video_buffer_sync_for_cpu(struct video_buffer *vbuf)
+{
+	sys_cache_data_invd_range(vbuf->buffer, vbuf->bytesused);
+}
+
+#if defined(CONFIG_VIDEO_BUFFER_NET_BUF)
+static void video_net_buf_destroy(struct net_buf *buf)
+{
+	struct video_buffer *vbuf = *(struct video_buffer **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	video_buffer_release(vbuf);
+}
+
+NET_BUF_POOL_DEFINE(video_net_buf_pool, CONFIG_VIDEO_BUFFER_NET_BUF_COUNT, 0,
+		    sizeof(struct video_buffer *), video_net_buf_destroy);
+
+struct net_buf *video_buffer_to_net_buf(struct video_buffer *vbuf, size_t offset, size_t len,
+					k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	if (offset + len > vbuf->size) {
+		return NULL;
+	}
+
+	buf = net_buf_alloc_with_data(&video_net_buf_pool, vbuf->buffer + offset, len, timeout);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	*(struct video_buffer **)net_buf_user_data(buf) = video_buffer_ref(vbuf);
+	sys_cache_data_flush_range(vbuf->buffer + offset, len);
+
+	return buf;
+}
+#endif /* CONFIG_VIDEO_BUFFER_NET_BUF */
@@ -157,6 +157,64 @@ int arch_dcache_flush_and_invd_range(void *addr, size_t size);
 #define cache_data_flush_and_invd_range(addr, size) \
 	arch_dcache_flush_and_invd_range(addr, size)
 
+#if defined(CONFIG_CACHE_HAS_RANGES) || defined(__DOXYGEN__)
+
+struct sys_cache_range;
+
+/**
+ * @brief Flush a set of address ranges in the d-cache
+ *
+ * Flush the cache lines covering each of the @p num ranges, with a single
+ * barrier sequence. Ranges sharing or adjoining cache lines are coalesced.
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_ranges(const struct sys_cache_range *ranges, size_t num);
+
+#define cache_data_flush_ranges(ranges, num) arch_dcache_flush_ranges(ranges, num)
+
+/**
+ * @brief Invalidate a set of address ranges in the d-cache
+ *
+ * Invalidate the cache lines covering each of the @p num ranges, with a single
+ * barrier sequence. Ranges sharing or adjoining cache lines are coalesced.
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_invd_ranges(const struct sys_cache_range *ranges, size_t num);
+
+#define cache_data_invd_ranges(ranges, num) arch_dcache_invd_ranges(ranges, num)
+
+/**
+ * @brief Flush and Invalidate a set of address ranges in the d-cache
+ *
+ * Flush and Invalidate the cache lines covering each of the @p num ranges,
+ * with a single barrier sequence. Ranges sharing or adjoining cache lines are
+ * coalesced.
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int arch_dcache_flush_and_invd_ranges(const struct sys_cache_range *ranges, size_t num);
+
+#define cache_data_flush_and_invd_ranges(ranges, num) arch_dcache_flush_and_invd_ranges(ranges, num)
+
+#endif /* CONFIG_CACHE_HAS_RANGES */
+
 #if defined(CONFIG_DCACHE_LINE_SIZE_DETECT) || defined(__DOXYGEN__)
 
 /**
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API header file for audio pipelines
+ */
+
+#ifndef ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+#define ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_
+
+/**
+ * @brief Audio pipelines passing memory slab blocks between stages
+ *
+ * @defgroup audio_pipeline_interface Audio Pipeline
+ * @ingroup audio_interface
+ *
+ * A pipeline moves blocks of audio samples from a source stage, through
+ * processing stages, to a sink stage. Blocks are passed by reference: a stage
+ * processes a block in place, or replaces it with a block of its own and
+ * frees the input block. The pipeline copies nothing.
+ *
+ * The sink is primed with a fixed number of blocks of silence before it is
+ * started. Since each processed block then replaces one played block, the
+ * number of blocks queued at the sink, and so the latency, stays constant:
+ * one block to capture, the processing time, and @p depth blocks queued at
+ * the sink.
+ *
+ * A pipeline is not thread safe, it is run from a single thread, usually of
+ * high priority, calling audio_pipeline_process() in a loop.
+ *
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Block of audio samples. */
+struct audio_block {
+	/** Samples, in a block of @p slab. NULL if there is no block. */
+	void *data;
+	/** Number of bytes of samples. */
+	size_t size;
+	/** Memory slab of the block. */
+	struct k_mem_slab *slab;
+	/** k_cycle_get_32() when the source produced the block. */
+	uint32_t timestamp;
+};
+
+struct audio_pipeline_stage;
+
+/**
+ * @brief Stage function.
+ *
+ * A source stage fills @p block, which has no data on entry. A processing
+ * stage updates @p block in place, or frees it and replaces it with another
+ * block. A sink stage takes ownership of the block and sets its data to NULL,
+ * otherwise the pipeline frees it.
+ *
+ * @param stage Stage.
+ * @param block Block.
+ *
+ * @retval 0 If successful.
+ * @retval -errno Negative errno code, the block is dropped.
+ */
+typedef int (*audio_pipeline_stage_fn)(struct audio_pipeline_stage *stage,
+				       struct audio_block *block);
+
+/**
+ * @brief Processing time of a stage.
+ *
+ * For the source stage, this includes the time waiting for a block.
+ */
+struct audio_pipeline_stage_stats {
+	/** Number of blocks processed. */
+	uint32_t blocks;
+	/** Number of blocks dropped on error. */
+	uint32_t errors;
+	/** Cycles spent on the last block. */
+	uint32_t last_cycles;
+	/** Most cycles spent on a block. */
+	uint32_t max_cycles;
+	/** Cycles spent on all blocks. */
+	uint64_t total_cycles;
+};
+
+/** @brief Pipeline stage. */
+struct audio_pipeline_stage {
+	/** Stage name, for diagnostics. */
+	const char *name;
+	/** Stage function. */
+	audio_pipeline_stage_fn fn;
+	/** Stage specific data. */
+	void *user_data;
+	/** Processing time of the stage. */
+	struct audio_pipeline_stage_stats stats;
+};
+
+/**
+ * @brief Statically initialize a pipeline stage.
+ *
+ * @param _name      Stage name.
+ * @param _fn        Stage function.
+ * @param _user_data Stage specific data.
+ */
+#define AUDIO_PIPELINE_STAGE_INIT(_name, _fn, _user_data)			\
+	{									\
+		.name = _name,							\
+		.fn = _fn,							\
+		.user_data = _user_data,					\
+	}
+
+/** @brief End-to-end latency of a pipeline. */
+struct audio_pipeline_stats {
+	/** Latency of the last block in microseconds. */
+	uint32_t last_us;
+	/** Largest latency of a block in microseconds. */
+	uint32_t max_us;
+	/** Number of blocks that reached the sink. */
+	uint32_t blocks;
+	/** Number of blocks dropped by a stage. */
+	uint32_t dropped;
+};
+
+/** @brief Pipeline. */
+struct audio_pipeline {
+	/** Source stage. */
+	struct audio_pipeline_stage *source;
+	/** Processing stages, in order. */
+	struct audio_pipeline_stage **stages;
+	/** Number of processing stages. */
+	size_t num_stages;
+	/** Sink stage. */
+	struct audio_pipeline_stage *sink;
+	/** Number of blocks queued at the sink, 2 for ping-pong buffering. */
+	uint8_t depth;
+	/** Duration of a block in microseconds. */
+	uint32_t block_us;
+	/** End-to-end latency. */
+	struct audio_pipeline_stats stats;
+};
+
+/**
+ * @brief Statically define a pipeline.
+ *
+ * @param _name     Pipeline name.
+ * @param _source   Source stage.
+ * @param _sink     Sink stage.
+ * @param _depth    Number of blocks queued at the sink.
+ * @param _block_us Duration of a block in microseconds.
+ * @param ...       Processing stages, in order.
+ */
+#define AUDIO_PIPELINE_DEFINE(_name, _source, _sink, _depth, _block_us, ...)	\
+	static struct audio_pipeline_stage *_name##_stages[] = {		\
+		__VA_ARGS__							\
+	};									\
+	static struct audio_pipeline _name = {					\
+		.source = _source,						\
+		.stages = _name##_stages,					\
+		.num_stages = ARRAY_SIZE(_name##_stages),			\
+		.sink = _sink,							\
+		.depth = _depth,						\
+		.block_us = _block_us,						\
+	}
+
+/**
+ * @brief Prime the sink of a pipeline.
+ *
+ * Passes @p depth blocks of silence of @p size bytes from @p slab to the sink.
+ * Call before starting the sink, for instance before triggering I2S TX.
+ *
+ * @param pipeline Pipeline.
+ * @param slab     Memory slab of the blocks.
+ * @param size     Number of bytes of each block.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOMEM If a block could not be allocated.
+ * @retval -errno Negative errno code returned by the sink.
+ */
+int audio_pipeline_prime(struct audio_pipeline *pipeline, struct k_mem_slab *slab, size_t size);
+
+/**
+ * @brief Move one block through a pipeline.
+ *
+ * Gets a block from the source, passes it to each processing stage and then
+ * to the sink. Waits for the source as long as it blocks.
+ *
+ * @param pipeline Pipeline.
+ *
+ * @retval 0 If the block reached the sink.
+ * @retval -errno Negative errno code returned by the stage that dropped the
+ *         block.
+ */
+int audio_pipeline_process(struct audio_pipeline *pipeline);
+
+/**
+ * @brief Reset the statistics of a pipeline and its stages.
+ *
+ * @param pipeline Pipeline.
+ */
+void audio_pipeline_stats_reset(struct audio_pipeline *pipeline);
+
+#if defined(CONFIG_I2S) || defined(__DOXYGEN__)
+/**
+ * @brief Source stage function reading blocks from I2S RX.
+ *
+ * The stage data is the I2S device. The blocks are the RX blocks of the
+ * driver, they are passed on without copy.
+ */
+int audio_pipeline_i2s_source(struct audio_pipeline_stage *stage, struct audio_block *block);
+
+/**
+ * @brief Sink stage function writing blocks to I2S TX.
+ *
+ * The stage data is the I2S device. Blocks from the TX memory slab are queued
+ * without copy, which is the case for the whole pipeline when I2S RX and TX
+ * use the same memory slab. Other blocks are copied into a TX block.
+ */
+int audio_pipeline_i2s_sink(struct audio_pipeline_stage *stage, struct audio_block *block);
+
+/**
+ * @brief Statically initialize an I2S RX source stage.
+ *
+ * @param _name Stage name.
+ * @param _dev  I2S device.
+ */
+#define AUDIO_PIPELINE_I2S_SOURCE_INIT(_name, _dev)				\
+	AUDIO_PIPELINE_STAGE_INIT(_name, audio_pipeline_i2s_source, (void *)(_dev))
+
+/**
+ * @brief Statically initialize an I2S TX sink stage.
+ *
+ * @param _name Stage name.
+ * @param _dev  I2S device.
+ */
+#define AUDIO_PIPELINE_I2S_SINK_INIT(_name, _dev)				\
+	AUDIO_PIPELINE_STAGE_INIT(_name, audio_pipeline_i2s_sink, (void *)(_dev))
+#endif /* CONFIG_I2S */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_AUDIO_PIPELINE_H_ */
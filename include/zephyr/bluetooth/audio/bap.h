@@ -870,6 +870,9 @@ struct bt_bap_stream_ops {
 	 *               linked to the lifetime of the net_buf. Metadata such as sequence number and
 	 *               timestamp can be provided by the bluetooth controller.
 	 * @param buf    Buffer containing incoming audio data.
+	 *
+	 * The buffer may be kept after the callback returns by taking a reference with
+	 * net_buf_ref(), so that it can be handed to a decoder without copying it.
 	 */
 	void (*recv)(struct bt_bap_stream *stream, const struct bt_iso_recv_info *info,
 		     struct net_buf *buf);
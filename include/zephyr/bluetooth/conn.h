@@ -1160,6 +1160,23 @@ int bt_conn_le_subrate_set_defaults(const struct bt_conn_le_subrate_param *param
 int bt_conn_le_subrate_request(struct bt_conn *conn,
 			       const struct bt_conn_le_subrate_param *params);
 
+/** @brief Set the transmit weight of a connection.
+ *
+ *  Connections that have data to send share the controller buffers in
+ *  proportion to their weight, and send up to their weight in fragments
+ *  before the next connection gets its turn. Connections start with a weight
+ *  of 1.
+ *
+ *  @note To use this API @kconfig{CONFIG_BT_CONN_TX_WEIGHTED} must be set.
+ *
+ *  @param conn   Connection object.
+ *  @param weight Transmit weight, from 1 to 255.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ *  @return -EINVAL if @p weight is 0.
+ */
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight);
+
 /** @brief Update the connection parameters.
  *
  *  If the local device is in the peripheral role then updating the connection
@@ -1858,6 +1858,14 @@ struct bt_gatt_write_params {
 #if defined(CONFIG_BT_EATT)
 	enum bt_att_chan_opt chan_opt;
 #endif /* CONFIG_BT_EATT */
+#if CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH > 0
+	/** Internal */
+	uint16_t _offset;
+	/** Internal */
+	uint8_t _pending;
+	/** Internal */
+	uint8_t _err;
+#endif /* CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH > 0 */
 };
 
 /** @brief Write Attribute Value by handle
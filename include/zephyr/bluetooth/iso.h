@@ -710,6 +710,10 @@ struct bt_iso_chan_ops {
 	 *             pointer is linked to the lifetime of the net_buf.
 	 *             Metadata such as sequence number and timestamp can be
 	 *             provided by the bluetooth controller.
+	 *
+	 * The buffer may be kept after the callback returns by taking a
+	 * reference with net_buf_ref(), e.g. to decode the SDU later without
+	 * copying it.
 	 */
 	void (*recv)(struct bt_iso_chan *chan, const struct bt_iso_recv_info *info,
 		     struct net_buf *buf);
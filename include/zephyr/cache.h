@@ -442,6 +442,179 @@ static ALWAYS_INLINE size_t sys_cache_instr_line_size_get(void)
 #endif
 }
 
+/**
+ * @brief Address range of a batched d-cache operation
+ */
+struct sys_cache_range {
+	/** Starting address */
+	void *addr;
+	/** Range size */
+	size_t size;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ *
+ */
+
+/*
+ * Get in [*start, *end) the next span covering ranges[*idx] and the ranges
+ * following it that share or adjoin its cache lines, and move *idx past them.
+ * Empty ranges are skipped. Returns false once all the ranges are consumed.
+ */
+static ALWAYS_INLINE bool z_sys_cache_ranges_next(const struct sys_cache_range *ranges,
+						  size_t num, size_t line_size, size_t *idx,
+						  uintptr_t *start, uintptr_t *end)
+{
+	uintptr_t mask = line_size - 1;
+
+	while (*idx < num && ranges[*idx].size == 0) {
+		(*idx)++;
+	}
+
+	if (*idx == num) {
+		return false;
+	}
+
+	*start = (uintptr_t)ranges[*idx].addr;
+	*end = *start + ranges[*idx].size;
+
+	for ((*idx)++; *idx < num; (*idx)++) {
+		uintptr_t r_start = (uintptr_t)ranges[*idx].addr;
+		uintptr_t r_end = r_start + ranges[*idx].size;
+
+		if (ranges[*idx].size == 0) {
+			continue;
+		}
+
+		if ((r_start & ~mask) > ((*end + mask) & ~mask) ||
+		    ((r_end + mask) & ~mask) < (*start & ~mask)) {
+			break;
+		}
+
+		*start = MIN(*start, r_start);
+		*end = MAX(*end, r_end);
+	}
+
+	return true;
+}
+
+#if !defined(CONFIG_CACHE_HAS_RANGES)
+#define Z_SYS_CACHE_RANGES_OP(ranges, num, op)					\
+	({									\
+		size_t _line = MAX(sys_cache_data_line_size_get(), 1);		\
+		uintptr_t _start, _end;						\
+		size_t _idx = 0;						\
+		int _ret = 0;							\
+										\
+		while (_ret == 0 &&						\
+		       z_sys_cache_ranges_next(ranges, num, _line, &_idx,	\
+					       &_start, &_end)) {		\
+			_ret = op((void *)_start, _end - _start);		\
+		}								\
+		_ret;								\
+	})
+#endif
+
+/** @endcond */
+
+/**
+ * @brief Flush a set of address ranges in the d-cache
+ *
+ * Flush the cache lines covering each of the @p num ranges. This is meant for
+ * drivers maintaining many small buffers at once, such as the descriptors and
+ * buffers of a DMA ring: ranges sharing or adjoining cache lines are coalesced
+ * and, when the backend supports it (@kconfig{CONFIG_CACHE_HAS_RANGES}), the
+ * barriers are issued once for all the ranges instead of once per range.
+ *
+ * Ranges are coalesced with the ranges following them in the array, so sorting
+ * the ranges by address gives the fewest operations.
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_flush_ranges(const struct sys_cache_range *ranges,
+						     size_t num)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+#if defined(CONFIG_CACHE_HAS_RANGES)
+	return cache_data_flush_ranges(ranges, num);
+#else
+	return Z_SYS_CACHE_RANGES_OP(ranges, num, cache_data_flush_range);
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(num);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Invalidate a set of address ranges in the d-cache
+ *
+ * Invalidate the cache lines covering each of the @p num ranges, see
+ * sys_cache_data_flush_ranges().
+ *
+ * @note As for sys_cache_data_invd_range(), all the data sharing a cache line
+ *       with a range is invalidated as well, including the data between two
+ *       ranges sharing a line.
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_invd_ranges(const struct sys_cache_range *ranges,
+						    size_t num)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+#if defined(CONFIG_CACHE_HAS_RANGES)
+	return cache_data_invd_ranges(ranges, num);
+#else
+	return Z_SYS_CACHE_RANGES_OP(ranges, num, cache_data_invd_range);
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(num);
+
+	return -ENOTSUP;
+}
+
+/**
+ * @brief Flush and Invalidate a set of address ranges in the d-cache
+ *
+ * Flush and Invalidate the cache lines covering each of the @p num ranges, see
+ * sys_cache_data_flush_ranges().
+ *
+ * @param ranges Address ranges.
+ * @param num Number of ranges.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+static ALWAYS_INLINE int sys_cache_data_flush_and_invd_ranges(const struct sys_cache_range *ranges,
+							      size_t num)
+{
+#if defined(CONFIG_CACHE_MANAGEMENT) && defined(CONFIG_DCACHE)
+#if defined(CONFIG_CACHE_HAS_RANGES)
+	return cache_data_flush_and_invd_ranges(ranges, num);
+#else
+	return Z_SYS_CACHE_RANGES_OP(ranges, num, cache_data_flush_and_invd_range);
+#endif
+#endif
+	ARG_UNUSED(ranges);
+	ARG_UNUSED(num);
+
+	return -ENOTSUP;
+}
+
 /**
  * @brief Test if a pointer is in cached region.
  *
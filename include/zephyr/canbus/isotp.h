@@ -250,6 +250,38 @@ int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
 	       const struct isotp_fc_opts *opts,
 	       k_timeout_t timeout);
 
+/**
+ * @brief Bind an address to a receiving context using a caller-supplied buffer.
+ *
+ * This function is similar to isotp_bind, but the received messages are
+ * assembled directly in @p buf instead of in chains of net-buffers. No buffer
+ * is allocated during reception, so the block size given in @p opts is only
+ * used to pace the sender, and messages are received without WAIT frames. A
+ * first frame announcing a message larger than @p size is rejected with an
+ * overflow flow control frame.
+ *
+ * The messages are read with isotp_recv_buf. Once a message is complete, the
+ * buffer holds it until the next call to isotp_recv_buf, and new messages are
+ * ignored meanwhile.
+ *
+ * @param rctx    Context to store the internal states.
+ * @param can_dev The CAN device to be used for sending and receiving.
+ * @param rx_addr Identifier for incoming data.
+ * @param tx_addr Identifier for FC frames.
+ * @param opts    Flow control options.
+ * @param buf     Buffer receiving the messages. Must be valid until unbind.
+ * @param size    Size of the buffer, the largest message that can be received.
+ * @param timeout Timeout for FF SF buffer allocation.
+ *
+ * @retval ISOTP_N_OK on success
+ * @retval ISOTP_NO_FREE_FILTER if CAN device has no filters left.
+ */
+int isotp_bind_buf(struct isotp_recv_ctx *rctx, const struct device *can_dev,
+		   const struct isotp_msg_id *rx_addr,
+		   const struct isotp_msg_id *tx_addr,
+		   const struct isotp_fc_opts *opts,
+		   uint8_t *buf, size_t size, k_timeout_t timeout);
+
 /**
  * @brief Unbind a context from the interface
  *
@@ -281,6 +313,22 @@ void isotp_unbind(struct isotp_recv_ctx *rctx);
  */
 int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout_t timeout);
 
+/**
+ * @brief Wait for a message in the buffer given to isotp_bind_buf.
+ *
+ * This function blocks until a complete message has been received in the
+ * buffer or an error occurred. Calling it again releases the buffer for the
+ * next message.
+ *
+ * @param rctx    Context that is bound with isotp_bind_buf.
+ * @param timeout Timeout for incoming data.
+ *
+ * @retval Length of the message on success
+ * @retval ISOTP_RECV_TIMEOUT when "timeout" timed out
+ * @retval ISOTP_N_* on error
+ */
+int isotp_recv_buf(struct isotp_recv_ctx *rctx, k_timeout_t timeout);
+
 /**
  * @brief Get the net buffer on data reception
  *
@@ -464,6 +512,13 @@ struct isotp_recv_ctx {
 	struct isotp_msg_id rx_addr;
 	struct isotp_msg_id tx_addr;
 	struct isotp_fc_opts opts;
+	/* caller-supplied buffer, see isotp_bind_buf */
+	uint8_t *user_buf;
+	size_t user_buf_size;
+	size_t user_buf_len;
+	struct k_sem user_buf_sem;
+	bool user_buf_busy;
+	bool user_buf_taken;
 	uint8_t state;
 	uint8_t bs;
 	uint8_t wft;
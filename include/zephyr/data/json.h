@@ -672,6 +672,117 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+#if defined(CONFIG_JSON_LIBRARY_STREAM) || defined(__DOXYGEN__)
+
+/** @cond INTERNAL_HIDDEN */
+struct json_obj_stream_frame {
+	const struct json_obj_descr *descr;
+	void *field;
+	union {
+		struct {
+			int64_t decoded;
+			size_t descr_len;
+			int key;
+			int next;
+		} obj;
+		struct {
+			void *val;
+			void *last_elem;
+			size_t *elements;
+			ptrdiff_t elem_size;
+		} arr;
+	};
+	uint8_t type;
+	uint8_t state;
+};
+/** @endcond */
+
+/**
+ * @brief State of an incremental object parser
+ *
+ * All fields are private, see json_obj_stream_init().
+ */
+struct json_obj_stream {
+	/** @cond INTERNAL_HIDDEN */
+	struct json_obj_stream_frame frames[CONFIG_JSON_LIBRARY_STREAM_DEPTH];
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *val;
+	char *buf;
+	size_t buf_size;
+	size_t used;
+	size_t tok_len;
+	struct json_obj_token *raw;
+	const char *literal;
+	int64_t result;
+	int error;
+	uint16_t skip;
+	uint16_t raw_depth;
+	uint8_t depth;
+	uint8_t lex;
+	uint8_t lex_arg;
+	uint8_t literal_tok;
+	bool done;
+	/** @endcond */
+};
+
+/**
+ * @brief Start parsing a JSON-encoded object incrementally
+ *
+ * Unlike json_obj_parse(), the object is then fed in chunks of any size
+ * with json_obj_stream_feed(), e.g. straight from network buffers, and
+ * values are stored in @a val as soon as they are complete.  The same
+ * descriptors and liberties as json_obj_parse() apply.
+ *
+ * As the input is not kept, all strings are copied to @a buf, which
+ * must outlive their use: JSON_TOK_STRING fields end up pointing to
+ * NUL-terminated copies in it, and JSON_TOK_OPAQUE, JSON_TOK_FLOAT and
+ * JSON_TOK_OBJ_ARRAY tokens to copies of their text.  @a buf also
+ * holds the token being parsed, so it must fit the longest key or
+ * number of interest on top of all the strings stored.
+ *
+ * @param stream Parser state, used until json_obj_stream_finish()
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be
+ * less than 63.
+ * @param val Pointer to the struct to hold the decoded values
+ * @param buf Buffer for the strings and the token being parsed
+ * @param buf_size Size of @a buf
+ */
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val, char *buf, size_t buf_size);
+
+/**
+ * @brief Parse the next chunk of an object
+ *
+ * @param stream Parser state
+ * @param data Next bytes of the JSON-encoded object
+ * @param len Number of bytes in @a data
+ *
+ * @retval 0 All of @a data was parsed, the object is not complete yet.
+ * @retval 1 The object is complete, any data left after it is ignored.
+ * @retval -EINVAL The input is not valid, or does not match the
+ * descriptors.
+ * @retval -ENOMEM @a buf is too small for a string or a key, or the
+ * object too deeply nested.
+ * @retval -ENOSPC An array has more elements than its descriptor allows.
+ * @retval -ERANGE A number does not fit in its field.
+ */
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Finish parsing an object
+ *
+ * @param stream Parser state
+ *
+ * @return < 0 if error, including -EINVAL if the object is not
+ * complete, bitmap of decoded fields on success (bit 0 is set if first
+ * field in the descriptor has been properly decoded, etc).
+ */
+int64_t json_obj_stream_finish(struct json_obj_stream *stream);
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -141,9 +141,13 @@ struct coredump_cmd_copy_arg {
 #include <zephyr/toolchain.h>
 #include <zephyr/arch/cpu.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util_macro.h>
 
 #define COREDUMP_HDR_VER		2
 
+/* Everything after the coredump header is a stream of compressed blocks */
+#define COREDUMP_HDR_FLAG_COMPRESSED	BIT(0)
+
 #define	COREDUMP_ARCH_HDR_ID		'A'
 
 #define THREADS_META_HDR_ID		'T'
@@ -183,6 +187,17 @@ struct coredump_hdr_t {
 	unsigned int	reason;
 } __packed;
 
+/* Compressed block header, only present with COREDUMP_HDR_FLAG_COMPRESSED */
+struct coredump_compress_blk_hdr_t {
+	/* Number of bytes after decompression */
+	uint16_t	raw_len;
+
+	/* Number of LZ4 compressed bytes following the header,
+	 * 0 if raw_len bytes are stored uncompressed.
+	 */
+	uint16_t	comp_len;
+} __packed;
+
 /* Architecture-specific block header */
 struct coredump_arch_hdr_t {
 	/* COREDUMP_ARCH_HDR_ID */
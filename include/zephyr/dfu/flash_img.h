@@ -17,6 +17,14 @@
 
 #include <zephyr/storage/stream_flash.h>
 
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+#include <psa/crypto.h>
+#else
+#include <mbedtls/sha256.h>
+#endif
+#endif
+
 /**
  * @brief Abstraction layer to write firmware images to flash
  *
@@ -33,6 +41,18 @@ struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	psa_hash_operation_t hash_ctx;
+#else
+	mbedtls_sha256_context hash_ctx;
+#endif
+	uint8_t hash[32];	/* SHA-256 of the image, once flushed */
+	size_t hash_len;	/* Number of bytes hashed */
+	uint8_t hash_area_id;	/* Flash area the image is written to */
+	bool hash_running;	/* Hash is updated by the writes */
+	bool hash_done;		/* Hash holds the digest of the image */
+#endif
 };
 
 /**
@@ -100,6 +120,10 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
  *
  * The function is enabled via CONFIG_IMG_ENABLE_IMAGE_CHECK Kconfig options.
  *
+ * With CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL, the hash computed while the
+ * image was written through @p ctx is used when @p fic covers exactly the
+ * written image, so the flash is not read back.
+ *
  * @param[in] ctx context.
  * @param[in] fic flash img check data.
  * @param[in] area_id flash area id of partition where the image should be
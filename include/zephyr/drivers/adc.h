@@ -16,6 +16,9 @@
 #include <zephyr/device.h>
 #include <zephyr/dt-bindings/adc/adc.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_ADC_STREAM
+#include <zephyr/rtio/rtio.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -694,6 +697,15 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  const struct adc_sequence *sequence,
 				  struct k_poll_signal *async);
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Type definition of ADC API function for starting a stream.
+ * See adc_stream() for the description of the stream.
+ */
+typedef void (*adc_api_submit)(const struct device *dev,
+			       struct rtio_iodev_sqe *iodev_sqe);
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief ADC driver API
  *
@@ -704,6 +716,9 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_STREAM
+	adc_api_submit        submit;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -977,6 +992,213 @@ static inline bool adc_is_ready_dt(const struct adc_dt_spec *spec)
 	return device_is_ready(spec->dev);
 }
 
+#if defined(CONFIG_ADC_STREAM) || defined(__DOXYGEN__)
+
+/**
+ * @brief Configuration of an ADC stream.
+ *
+ * The selected channels are sampled every @p interval_us microseconds, the
+ * conversions being triggered by hardware. Each buffer of the stream holds an
+ * @ref adc_stream_header followed by @p samplings samplings.
+ */
+struct adc_stream_config {
+	/** ADC device. */
+	const struct device *dev;
+
+	/**
+	 * Bit-mask of the channels sampled, as in @ref adc_sequence.channels.
+	 * All channels must be configured with adc_channel_setup().
+	 */
+	uint32_t channels;
+
+	/** ADC resolution, as in @ref adc_sequence.resolution. */
+	uint8_t resolution;
+
+	/** Oversampling setting, as in @ref adc_sequence.oversampling. */
+	uint8_t oversampling;
+
+	/** Number of samplings in each buffer. */
+	uint16_t samplings;
+
+	/** Interval between samplings, in microseconds. */
+	uint32_t interval_us;
+};
+
+/**
+ * @brief Header of a buffer produced by an ADC stream.
+ *
+ * The header is followed by the samples, @p sample_size bytes each. The
+ * samples of a sampling are stored from the channel with the lowest ID, like
+ * in the buffer of an @ref adc_sequence.
+ */
+struct adc_stream_header {
+	/** Time of the first sampling of the buffer, in nanoseconds. */
+	uint64_t timestamp_ns;
+
+	/** Interval between samplings, in nanoseconds. */
+	uint32_t interval_ns;
+
+	/** Bit-mask of the channels sampled. */
+	uint32_t channels;
+
+	/** Number of samplings in the buffer. */
+	uint16_t count;
+
+	/** ADC resolution of the samples. */
+	uint8_t resolution;
+
+	/** Size of a sample in bytes, 1 or 2. */
+	uint8_t sample_size;
+
+	/** Whether the samples are signed. */
+	bool is_signed;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api __adc_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define a stream instance of an ADC
+ *
+ * Use this macro to generate a @ref rtio_iodev for streaming samples of
+ * channels of an ADC. Example:
+ *
+ * @code(.c)
+ * ADC_DT_STREAM_IODEV(vibration, DT_NODELABEL(adc), BIT(0), 12, 20, 256);
+ * RTIO_DEFINE_WITH_MEMPOOL(rtio, 4, 4, 8, 1024, 4);
+ *
+ * int main(void) {
+ *   struct rtio_sqe *handle;
+ *   adc_stream(&vibration, &rtio, NULL, &handle);
+ *   k_msleep(1000);
+ *   rtio_sqe_cancel(handle);
+ * }
+ * @endcode
+ *
+ * @param name Name of the I/O device.
+ * @param dt_node Devicetree node of the ADC.
+ * @param _channels Bit-mask of the channels sampled.
+ * @param _resolution ADC resolution.
+ * @param _interval_us Interval between samplings, in microseconds.
+ * @param _samplings Number of samplings in each buffer.
+ */
+#define ADC_DT_STREAM_IODEV(name, dt_node, _channels, _resolution, _interval_us, _samplings)     \
+	static struct adc_stream_config _CONCAT(__adc_stream_config_, name) = {                    \
+		.dev = DEVICE_DT_GET(dt_node),                                                     \
+		.channels = (_channels),                                                           \
+		.resolution = (_resolution),                                                       \
+		.samplings = (_samplings),                                                         \
+		.interval_us = (_interval_us),                                                     \
+	};                                                                                         \
+	RTIO_IODEV_DEFINE(name, &__adc_iodev_api, &_CONCAT(__adc_stream_config_, name))
+
+/**
+ * @brief Get the size of a buffer of a stream.
+ *
+ * @param cfg Configuration of the stream.
+ * @param sample_size Size of a sample in bytes.
+ *
+ * @return Size in bytes the memory pool blocks must provide.
+ */
+static inline size_t adc_stream_buf_size(const struct adc_stream_config *cfg,
+					 uint8_t sample_size)
+{
+	return sizeof(struct adc_stream_header) +
+	       (size_t)cfg->samplings * POPCOUNT(cfg->channels) * sample_size;
+}
+
+/**
+ * @brief Start a stream of samples from an ADC.
+ *
+ * The stream runs until the returned @p handle is cancelled. Each completion
+ * holds a buffer of the memory pool of @p ctx, which must be large enough
+ * for adc_stream_buf_size(). Samplings occurring while no buffer is available
+ * are dropped, the conversions are not interrupted.
+ *
+ * @param iodev I/O device defined by ADC_DT_STREAM_IODEV().
+ * @param ctx RTIO context, defined with RTIO_DEFINE_WITH_MEMPOOL().
+ * @param userdata User data of the completions.
+ * @param handle Optional pointer set to the submission, for cancelling it.
+ *
+ * @retval 0 On success.
+ * @retval -ENOMEM If no submission is available in @p ctx.
+ */
+static inline int adc_stream(struct rtio_iodev *iodev, struct rtio *ctx, void *userdata,
+			     struct rtio_sqe **handle)
+{
+	if (IS_ENABLED(CONFIG_USERSPACE)) {
+		struct rtio_sqe sqe;
+
+		rtio_sqe_prep_read_multishot(&sqe, iodev, RTIO_PRIO_NORM, userdata);
+		rtio_sqe_copy_in_get_handles(ctx, &sqe, handle, 1);
+	} else {
+		struct rtio_sqe *sqe = rtio_sqe_acquire(ctx);
+
+		if (sqe == NULL) {
+			return -ENOMEM;
+		}
+		if (handle != NULL) {
+			*handle = sqe;
+		}
+		rtio_sqe_prep_read_multishot(sqe, iodev, RTIO_PRIO_NORM, userdata);
+	}
+	rtio_submit(ctx, 0);
+	return 0;
+}
+
+/**
+ * @brief Decode the samples of a channel from a buffer of a stream.
+ *
+ * @param[in] buf Buffer of a completion of the stream.
+ * @param[in] channel ID of the channel.
+ * @param[in,out] fit Index of the next sampling to decode, start from 0.
+ * @param[in] max_count Maximum number of samples to decode.
+ * @param[out] values Raw values of the samples.
+ * @param[out] timestamps_ns Optional times of the samplings, in nanoseconds.
+ *
+ * @return Number of samples decoded, 0 once all samplings are decoded.
+ * @retval -EINVAL If the channel is not part of the stream.
+ */
+static inline int adc_stream_decode(const uint8_t *buf, uint8_t channel, uint32_t *fit,
+				    uint16_t max_count, int32_t *values,
+				    uint64_t *timestamps_ns)
+{
+	const struct adc_stream_header *hdr = (const struct adc_stream_header *)buf;
+	const uint8_t *samples = buf + sizeof(*hdr);
+	uint32_t stride = POPCOUNT(hdr->channels);
+	uint32_t pos;
+	int count = 0;
+
+	if (channel >= 32 || (hdr->channels & BIT(channel)) == 0) {
+		return -EINVAL;
+	}
+
+	pos = POPCOUNT(hdr->channels & BIT_MASK(channel));
+
+	for (uint32_t i = *fit; i < hdr->count && count < max_count; i++, count++) {
+		uint32_t idx = i * stride + pos;
+
+		if (hdr->sample_size == 1) {
+			values[count] = hdr->is_signed ? (int8_t)samples[idx] : samples[idx];
+		} else {
+			uint16_t raw = ((const uint16_t *)samples)[idx];
+
+			values[count] = hdr->is_signed ? (int16_t)raw : raw;
+		}
+
+		if (timestamps_ns != NULL) {
+			timestamps_ns[count] = hdr->timestamp_ns + (uint64_t)i * hdr->interval_ns;
+		}
+	}
+
+	*fit += count;
+
+	return count;
+}
+
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @}
  */
@@ -1598,7 +1598,7 @@ __syscall uint32_t can_stats_get_bit_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_bit_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).bit_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), bit_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1621,7 +1621,7 @@ __syscall uint32_t can_stats_get_bit0_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_bit0_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).bit0_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), bit0_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1644,7 +1644,7 @@ __syscall uint32_t can_stats_get_bit1_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_bit1_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).bit1_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), bit1_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1665,7 +1665,7 @@ __syscall uint32_t can_stats_get_stuff_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_stuff_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).stuff_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), stuff_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1686,7 +1686,7 @@ __syscall uint32_t can_stats_get_crc_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_crc_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).crc_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), crc_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1707,7 +1707,7 @@ __syscall uint32_t can_stats_get_form_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_form_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).form_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), form_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1728,7 +1728,7 @@ __syscall uint32_t can_stats_get_ack_errors(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_ack_errors(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).ack_error;
+	return STATS_GET(Z_CAN_GET_STATS(dev), ack_error);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -1750,7 +1750,7 @@ __syscall uint32_t can_stats_get_rx_overruns(const struct device *dev);
 #ifdef CONFIG_CAN_STATS
 static inline uint32_t z_impl_can_stats_get_rx_overruns(const struct device *dev)
 {
-	return Z_CAN_GET_STATS(dev).rx_overrun;
+	return STATS_GET(Z_CAN_GET_STATS(dev), rx_overrun);
 }
 #endif /* CONFIG_CAN_STATS */
 
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Software CAN RX filtering for drivers without hardware filters.
+ *
+ * Filters matching exactly one identifier are kept in a hash table, all other
+ * filters in a compact table scanned on each frame. With many exact filters,
+ * as in a gateway, a frame is dispatched without walking the whole filter set.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_
+#define ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_
+
+#include <zephyr/drivers/can.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+#define CAN_SW_FILTER_BUCKETS BIT(CONFIG_CAN_SW_FILTER_HASH_BITS)
+/** @endcond */
+
+/** @brief Filter slot, one per filter ID of the driver. */
+struct can_sw_filter_entry {
+	struct can_filter filter;
+	/* NULL if the slot is free. */
+	can_rx_callback_t callback;
+	void *user_data;
+	/* Next exact filter in the same bucket, -1 for the last one. */
+	int16_t next;
+};
+
+/** @brief Filter set, part of the driver data. */
+struct can_sw_filter {
+	struct can_sw_filter_entry *entries;
+	/* Slots of the filters that are not exact, packed at the start. */
+	uint16_t *masked;
+	uint16_t max_filters;
+	uint16_t masked_count;
+	/* First exact filter of each bucket, -1 if empty. */
+	int16_t buckets[CAN_SW_FILTER_BUCKETS];
+};
+
+/**
+ * @brief Initialize a filter set.
+ *
+ * The filter set does no locking, the driver serializes the calls.
+ *
+ * @param sw          Filter set.
+ * @param entries     Array of @p max_filters slots.
+ * @param masked      Array of @p max_filters slot numbers.
+ * @param max_filters Number of filters, at most INT16_MAX.
+ */
+void can_sw_filter_init(struct can_sw_filter *sw, struct can_sw_filter_entry *entries,
+			uint16_t *masked, uint16_t max_filters);
+
+/**
+ * @brief Add a filter.
+ *
+ * @param sw        Filter set.
+ * @param callback  Receive callback.
+ * @param user_data User data passed to the callback.
+ * @param filter    Filter.
+ *
+ * @return Filter ID, the slot of the filter, or -ENOSPC if all slots are used.
+ */
+int can_sw_filter_add(struct can_sw_filter *sw, can_rx_callback_t callback, void *user_data,
+		      const struct can_filter *filter);
+
+/**
+ * @brief Remove a filter.
+ *
+ * @param sw        Filter set.
+ * @param filter_id Filter ID returned by @ref can_sw_filter_add.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the filter ID is out of bounds or not in use.
+ */
+int can_sw_filter_remove(struct can_sw_filter *sw, int filter_id);
+
+/**
+ * @brief Pass a received frame to the callbacks of the matching filters.
+ *
+ * Each callback gets its own copy of the frame.
+ *
+ * @param sw    Filter set.
+ * @param dev   Device passed to the callbacks.
+ * @param frame Received frame.
+ */
+void can_sw_filter_dispatch(const struct can_sw_filter *sw, const struct device *dev,
+			    const struct can_frame *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_CAN_CAN_SW_FILTER_H_ */
@@ -83,6 +83,20 @@ extern "C" {
 
 struct disk_operations;
 
+/**
+ * @brief Disk block cache statistics
+ */
+struct disk_cache_stats {
+	/** Sectors read from the cache */
+	uint32_t hits;
+	/** Sectors read from the disk */
+	uint32_t misses;
+	/** Sectors read ahead into the cache */
+	uint32_t read_ahead;
+	/** Dirty sectors written back to the disk */
+	uint32_t write_backs;
+};
+
 /**
  * @brief Disk info
  */
@@ -97,6 +111,12 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_ACCESS_CACHE) || defined(__DOXYGEN__)
+	/** Internally used sector count of a cached disk, 0 if not cached */
+	uint32_t cache_sectors;
+	/** Internally used block cache statistics */
+	struct disk_cache_stats cache_stats;
+#endif
 };
 
 /**
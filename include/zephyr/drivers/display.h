@@ -153,6 +153,30 @@ typedef int (*display_write_api)(const struct device *dev, const uint16_t x,
 				 const struct display_buffer_descriptor *desc,
 				 const void *buf);
 
+/**
+ * @typedef display_write_cb_t
+ * @brief Completion callback of display_write_async()
+ *
+ * May be called from interrupt context.
+ *
+ * @param dev Pointer to device structure
+ * @param result 0 on success else negative errno code
+ * @param user_data User data passed to display_write_async()
+ */
+typedef void (*display_write_cb_t)(const struct device *dev, int result,
+				   void *user_data);
+
+/**
+ * @typedef display_write_async_api
+ * @brief Callback API for writing data to the display without blocking
+ * See display_write_async() for argument description
+ */
+typedef int (*display_write_async_api)(const struct device *dev,
+				       const uint16_t x, const uint16_t y,
+				       const struct display_buffer_descriptor *desc,
+				       const void *buf, display_write_cb_t cb,
+				       void *user_data);
+
 /**
  * @typedef display_read_api
  * @brief Callback API for reading data from the display
@@ -228,6 +252,7 @@ __subsystem struct display_driver_api {
 	display_get_capabilities_api get_capabilities;
 	display_set_pixel_format_api set_pixel_format;
 	display_set_orientation_api set_orientation;
+	display_write_async_api write_async;
 };
 
 /**
@@ -252,6 +277,47 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write data to display without blocking on the transfer
+ *
+ * Starts the write and returns, the transfer of the buffer, typically by
+ * DMA, completes in the background. The buffer must not be modified before
+ * @p cb is called, a second buffer can be drawn in the meantime. Displays
+ * without an asynchronous write perform a synchronous write and call @p cb
+ * before returning.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Pointer to a structure describing the buffer layout
+ * @param buf Pointer to buffer array
+ * @param cb Called once the buffer has been sent, only if 0 is returned
+ * @param user_data User data passed to @p cb
+ *
+ * @retval 0 on success else negative errno code.
+ */
+static inline int display_write_async(const struct device *dev, const uint16_t x,
+				      const uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf, display_write_cb_t cb,
+				      void *user_data)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+	int ret;
+
+	if (api->write_async != NULL) {
+		return api->write_async(dev, x, y, desc, buf, cb, user_data);
+	}
+
+	ret = api->write(dev, x, y, desc, buf);
+	if (ret == 0 && cb != NULL) {
+		cb(dev, 0, user_data);
+	}
+
+	return ret;
+}
+
 /**
  * @brief Read data from display
  *
@@ -306,6 +306,29 @@ struct dma_context {
 /** Magic code to identify context content */
 #define DMA_MAGIC 0x47494749
 
+/**
+ * @brief Prebuilt transfer list of a DMA channel.
+ *
+ * A chain is prepared once with dma_chain_prepare(), which configures the
+ * channel and lets the driver build its descriptors from the blocks of the
+ * configuration. dma_chain_submit() then starts the transfer list as many
+ * times as needed without configuring the channel again, and
+ * dma_chain_append() queues more blocks behind the running ones, so that a
+ * stream of buffers is transferred without reconfiguration gaps.
+ *
+ * The configuration and its blocks must stay valid while the chain is used.
+ */
+struct dma_chain {
+	/** DMA controller */
+	const struct device *dev;
+	/** Channel of the controller */
+	uint32_t channel;
+	/** Configuration given to dma_chain_prepare() */
+	struct dma_config *config;
+	/** Whether the chain has been started since it was prepared */
+	bool started;
+};
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -336,6 +359,11 @@ typedef int (*dma_api_get_status)(const struct device *dev, uint32_t channel,
 
 typedef int (*dma_api_get_attribute)(const struct device *dev, uint32_t type, uint32_t *value);
 
+typedef int (*dma_api_chain_restart)(const struct device *dev, uint32_t channel);
+
+typedef int (*dma_api_chain_append)(const struct device *dev, uint32_t channel,
+				    struct dma_block_config *block);
+
 /**
  * @typedef dma_chan_filter
  * @brief channel filter function call
@@ -362,6 +390,8 @@ __subsystem struct dma_driver_api {
 	dma_api_get_status get_status;
 	dma_api_get_attribute get_attribute;
 	dma_api_chan_filter chan_filter;
+	dma_api_chain_restart chain_restart;
+	dma_api_chain_append chain_append;
 };
 /**
  * @endcond
@@ -692,6 +722,108 @@ static inline int dma_get_attribute(const struct device *dev, uint32_t type, uin
 	return -ENOSYS;
 }
 
+/**
+ * @brief Prepare a chain of DMA transfers.
+ *
+ * Configures @p channel with @p config, see dma_config(). The transfer list
+ * is not started.
+ *
+ * @param chain   Chain to prepare.
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to use.
+ * @param config  Configuration of the transfer list. It and its blocks must
+ *                stay valid while the chain is used.
+ *
+ * @retval 0 if successful.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_chain_prepare(struct dma_chain *chain, const struct device *dev,
+				    uint32_t channel, struct dma_config *config)
+{
+	chain->dev = dev;
+	chain->channel = channel;
+	chain->config = config;
+	chain->started = false;
+
+	return dma_config(dev, channel, config);
+}
+
+/**
+ * @brief Start the transfer list of a chain.
+ *
+ * The channel must be idle, which it is once the completion of the previous
+ * submission has been reported. Drivers supporting it restart the
+ * descriptors built when the chain was prepared; for the others the channel
+ * is configured again. After dma_stop(), prepare the chain again.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param chain Prepared chain.
+ *
+ * @retval 0 if successful.
+ * @retval Negative errno code if failure.
+ */
+static inline int dma_chain_submit(struct dma_chain *chain)
+{
+	const struct dma_driver_api *api = (const struct dma_driver_api *)chain->dev->api;
+	int ret;
+
+	if (chain->started) {
+		if (api->chain_restart) {
+			ret = api->chain_restart(chain->dev, chain->channel);
+			if (ret != -ENOSYS) {
+				return ret;
+			}
+		}
+
+		ret = dma_config(chain->dev, chain->channel, chain->config);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	chain->started = true;
+
+	return dma_start(chain->dev, chain->channel);
+}
+
+/**
+ * @brief Append a block to a chain.
+ *
+ * The block is transferred once, after the blocks already queued on the
+ * channel. It is queued while the transfer runs, without stopping it; if the
+ * channel is idle, the transfer starts with this block. Its completion is
+ * reported as the completion of the transfer list, or of a block with
+ * complete_callback_en set, like the blocks of the configuration.
+ *
+ * The block uses the settings of the configuration of the chain. It must stay
+ * valid until its transfer completes, and it is not part of the transfer list
+ * started again by dma_chain_submit().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param chain Prepared chain.
+ * @param block Block to transfer.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if not supported by the driver.
+ * @retval -ENOMEM if no descriptor is available for the block.
+ * @retval Negative errno code if other failure.
+ */
+static inline int dma_chain_append(struct dma_chain *chain, struct dma_block_config *block)
+{
+	const struct dma_driver_api *api = (const struct dma_driver_api *)chain->dev->api;
+
+	if (api->chain_append == NULL) {
+		return -ENOSYS;
+	}
+
+	block->next_block = NULL;
+	chain->started = true;
+
+	return api->chain_append(chain->dev, chain->channel, block);
+}
+
 /**
  * @brief Look-up generic width index to be used in registers
  *
@@ -27,6 +27,10 @@
 #include <sys/types.h>
 #include <zephyr/device.h>
 
+#if defined(CONFIG_FLASH_RTIO)
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -662,6 +666,104 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_RTIO) || defined(__DOXYGEN__)
+
+/**
+ * @brief Data of a flash RTIO device, defined by @ref FLASH_IODEV_DEFINE
+ */
+struct flash_iodev_data {
+	/** Flash device */
+	const struct device *dev;
+	/** @cond INTERNAL_HIDDEN */
+	struct k_spinlock lock;
+	struct mpsc pending;
+	bool busy;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api flash_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO device for a flash device
+ *
+ * Requests submitted to the device are processed in order on the RTIO
+ * work queue, so that the submitting thread is not blocked by long erase
+ * or program operations. Completions are reported through the RTIO
+ * context, a callback can be chained to a request with
+ * rtio_sqe_prep_callback().
+ *
+ * @param name Symbolic name of the iodev to define
+ * @param flash_dev Flash device
+ */
+#define FLASH_IODEV_DEFINE(name, flash_dev)						\
+	static struct flash_iodev_data _flash_iodev_data_##name = {			\
+		.dev = flash_dev,							\
+		.pending = MPSC_INIT(_flash_iodev_data_##name.pending),			\
+	};										\
+	RTIO_IODEV_DEFINE(name, &flash_iodev_api, &_flash_iodev_data_##name)
+
+/**
+ * @brief Queue a flash read in an RTIO context
+ *
+ * Two submissions are acquired, the request completes with a single
+ * completion carrying @p userdata.
+ *
+ * @param r RTIO context
+ * @param iodev Flash RTIO device
+ * @param offset Offset (byte aligned) to read
+ * @param data Buffer to store read data
+ * @param len Number of bytes to read
+ * @param userdata User data returned in the completion
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough submissions available in the context
+ */
+struct rtio_sqe *flash_rtio_read(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				 void *data, size_t len, void *userdata);
+
+/**
+ * @brief Queue a flash write in an RTIO context
+ *
+ * Two submissions are acquired, the request completes with a single
+ * completion carrying @p userdata. The same requirements as for
+ * flash_write() apply.
+ *
+ * @param r RTIO context
+ * @param iodev Flash RTIO device
+ * @param offset Starting offset for the write
+ * @param data Data to write, must remain valid until the request completes
+ * @param len Number of bytes to write
+ * @param userdata User data returned in the completion
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough submissions available in the context
+ */
+struct rtio_sqe *flash_rtio_write(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				  const void *data, size_t len, void *userdata);
+
+/**
+ * @brief Queue a flash erase in an RTIO context
+ *
+ * Two submissions are acquired, the request completes with a single
+ * completion carrying @p userdata. The same requirements as for
+ * flash_erase() apply.
+ *
+ * @param r RTIO context
+ * @param iodev Flash RTIO device
+ * @param offset Erase area starting offset
+ * @param size Size of area to be erased
+ * @param userdata User data returned in the completion
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough submissions available in the context
+ */
+struct rtio_sqe *flash_rtio_erase(struct rtio *r, const struct rtio_iodev *iodev, off_t offset,
+				  size_t size, void *userdata);
+
+#endif /* CONFIG_FLASH_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
@@ -125,6 +125,18 @@ struct mipi_dbi_config {
 };
 
 
+/**
+ * @brief Completion callback of mipi_dbi_write_display_async()
+ *
+ * May be called from interrupt context.
+ *
+ * @param dev mipi dbi controller
+ * @param result 0 on success else negative errno code
+ * @param user_data user data passed to mipi_dbi_write_display_async()
+ */
+typedef void (*mipi_dbi_write_cb_t)(const struct device *dev, int result,
+				    void *user_data);
+
 /** MIPI-DBI host driver API */
 __subsystem struct mipi_dbi_driver_api {
 	int (*command_write)(const struct device *dev,
@@ -141,6 +153,12 @@ __subsystem struct mipi_dbi_driver_api {
 	int (*reset)(const struct device *dev, k_timeout_t delay);
 	int (*release)(const struct device *dev,
 		       const struct mipi_dbi_config *config);
+	int (*write_display_async)(const struct device *dev,
+				   const struct mipi_dbi_config *config,
+				   const uint8_t *framebuf,
+				   struct display_buffer_descriptor *desc,
+				   enum display_pixel_format pixfmt,
+				   mipi_dbi_write_cb_t cb, void *user_data);
 };
 
 /**
@@ -242,6 +260,43 @@ static inline int mipi_dbi_write_display(const struct device *dev,
 	return api->write_display(dev, config, framebuf, desc, pixfmt);
 }
 
+/**
+ * @brief Write a display buffer to the display controller without blocking.
+ *
+ * Same as @ref mipi_dbi_write_display, but returns once the transfer is
+ * started. The framebuffer must stay valid until @p cb is called. Commands
+ * written in the meantime wait for the end of the transfer.
+ *
+ * @param dev mipi dbi controller
+ * @param config MIPI DBI configuration
+ * @param framebuf: framebuffer to write to display
+ * @param desc: descriptor of framebuffer to write, see
+ *   @ref mipi_dbi_write_display
+ * @param pixfmt: pixel format of framebuffer data
+ * @param cb: called at the end of the transfer, only if 0 is returned
+ * @param user_data: user data passed to @p cb
+ * @retval 0 buffer write started.
+ * @retval -EIO I/O error
+ * @retval -ENOTSUP not supported in this mode
+ * @retval -ENOSYS not implemented
+ */
+static inline int mipi_dbi_write_display_async(const struct device *dev,
+					       const struct mipi_dbi_config *config,
+					       const uint8_t *framebuf,
+					       struct display_buffer_descriptor *desc,
+					       enum display_pixel_format pixfmt,
+					       mipi_dbi_write_cb_t cb, void *user_data)
+{
+	const struct mipi_dbi_driver_api *api =
+		(const struct mipi_dbi_driver_api *)dev->api;
+
+	if (api->write_display_async == NULL) {
+		return -ENOSYS;
+	}
+	return api->write_display_async(dev, config, framebuf, desc, pixfmt,
+					cb, user_data);
+}
+
 /**
  * @brief Resets attached display controller
  *
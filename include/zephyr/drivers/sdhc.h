@@ -55,6 +55,18 @@ struct sdhc_command {
 #define SDHC_NATIVE_RESPONSE_MASK 0xF
 #define SDHC_SPI_RESPONSE_TYPE_MASK 0xF0
 
+/**
+ * @brief SD host controller data transfer flags
+ */
+enum sdhc_data_flags {
+	/**
+	 * Card supports SET_BLOCK_COUNT (CMD23). Multi-block transfers may be
+	 * sent with a predefined block count instead of being stopped with
+	 * STOP_TRANSMISSION (CMD12).
+	 */
+	SDHC_DATA_BLOCK_COUNT = BIT(0),
+};
+
 /**
  * @brief SD host controller data structure
  *
@@ -68,6 +80,7 @@ struct sdhc_data {
 	unsigned int bytes_xfered; /*!< populated with number of bytes sent by SDHC */
 	void *data; /*!< Data to transfer or receive */
 	int timeout_ms; /*!< data timeout in milliseconds */
+	uint32_t flags; /*!< Transfer flags, see @ref sdhc_data_flags */
 };
 
 /**
@@ -527,6 +527,26 @@ struct sensor_decoder_api {
 	 * @return Whether the trigger is present in the buffer
 	 */
 	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode up to @p max_count three-axis samples into separate arrays
+	 *
+	 * Optional, same as @ref sensor_decoder_api.decode but each axis is written to its
+	 * own array of @p data_out. Decoders implement it to convert a whole FIFO buffer in
+	 * one call.
+	 *
+	 * @param[in]     buffer The buffer provided on the @ref rtio context
+	 * @param[in]     channel The channel to decode
+	 * @param[in,out] fit The current frame iterator
+	 * @param[in]     max_count The maximum number of samples to decode
+	 * @param[out]    data_out The decoded data
+	 * @return 0 no more samples to decode
+	 * @return >0 the number of decoded samples
+	 * @return <0 on error
+	 */
+	int (*decode_three_axis)(const uint8_t *buffer, struct sensor_chan_spec channel,
+				 uint32_t *fit, uint16_t max_count,
+				 struct sensor_three_axis_soa *data_out);
 };
 
 /**
@@ -584,6 +604,59 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 	return ctx->decoder->decode(ctx->buffer, ctx->channel, &ctx->fit, max_count, out);
 }
 
+/**
+ * @brief Decode N three-axis samples into separate arrays using a sensor_decode_context
+ *
+ * The decoder's @ref sensor_decoder_api.decode_three_axis is used when available,
+ * otherwise the samples are decoded one at a time.
+ *
+ * @param[in,out] ctx The context to use for decoding
+ * @param[out]    out The output arrays
+ * @param[in]     max_count Maximum number of samples to decode
+ * @return 0 no more samples to decode
+ * @return >0 the number of decoded samples
+ * @return <0 on error
+ */
+static inline int sensor_decode_three_axis(struct sensor_decode_context *ctx,
+					   struct sensor_three_axis_soa *out, uint16_t max_count)
+{
+	struct sensor_three_axis_data frame;
+	int count = 0;
+	int rc;
+
+	if (ctx->decoder->decode_three_axis != NULL) {
+		return ctx->decoder->decode_three_axis(ctx->buffer, ctx->channel, &ctx->fit,
+						       max_count, out);
+	}
+
+	while (count < max_count) {
+		rc = ctx->decoder->decode(ctx->buffer, ctx->channel, &ctx->fit, 1, &frame);
+		if (rc <= 0) {
+			if (count == 0) {
+				return rc;
+			}
+			break;
+		}
+
+		if (count == 0) {
+			out->header = frame.header;
+			out->shift = frame.shift;
+		}
+		if (out->timestamp_delta != NULL) {
+			out->timestamp_delta[count] = frame.header.base_timestamp_ns +
+						      frame.readings[0].timestamp_delta -
+						      out->header.base_timestamp_ns;
+		}
+		out->x[count] = frame.readings[0].x;
+		out->y[count] = frame.readings[0].y;
+		out->z[count] = frame.readings[0].z;
+		count++;
+	}
+
+	out->header.reading_count = count;
+	return count;
+}
+
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
@@ -66,6 +66,23 @@ struct sensor_three_axis_data {
 	} readings[1];
 };
 
+/**
+ * Data for a sensor channel which reports on three axes, with each axis decoded
+ * into its own array. This is the output of :c:func:`sensor_decode_three_axis`,
+ * used for the same channels as :c:struct:`sensor_three_axis_data`.
+ *
+ * The arrays are provided by the caller and must hold as many samples as
+ * requested. Timestamps are only written when @p timestamp_delta is not NULL.
+ */
+struct sensor_three_axis_soa {
+	struct sensor_data_header header;
+	int8_t shift;
+	uint32_t *timestamp_delta;
+	q31_t *x;
+	q31_t *y;
+	q31_t *z;
+};
+
 #define PRIsensor_three_axis_data PRIu64 "ns, (%" PRIq(6) ", %" PRIq(6) ", %" PRIq(6) ")"
 
 #define PRIsensor_three_axis_data_arg(data_, readings_offset_)                                     \
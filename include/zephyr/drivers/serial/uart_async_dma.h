@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Generic UART Asynchronous API implementation using the DMA API.
+ */
+
+#ifndef ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_DMA_H_
+#define ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_DMA_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief DMA channel used for one direction of the UART. */
+struct uart_async_dma_channel {
+	/* DMA controller, NULL if the direction is not supported. */
+	const struct device *dma_dev;
+
+	/* Channel of the DMA controller. */
+	uint32_t channel;
+
+	/* Request line (slot) of the UART on the DMA controller. */
+	uint32_t slot;
+
+	/* Address of the UART data register. */
+	uintptr_t reg_addr;
+};
+
+/** @brief Configuration provided by the UART driver. Must be persistent. */
+struct uart_async_dma_config {
+	struct uart_async_dma_channel tx;
+	struct uart_async_dma_channel rx;
+
+	/* Enable or disable the DMA requests of the UART for a direction. */
+	void (*dma_req_enable)(const struct device *dev, bool tx, bool enable);
+};
+
+/** @brief State of the implementation, part of the UART driver data. */
+struct uart_async_dma {
+	const struct device *dev;
+	const struct uart_async_dma_config *config;
+	uart_callback_t callback;
+	void *user_data;
+	struct k_spinlock lock;
+
+	struct {
+		const uint8_t *buf;
+		size_t len;
+		struct k_work_delayable timeout_work;
+	} tx;
+
+	struct {
+		uint8_t *buf;
+		size_t len;
+		/* Bytes of the buffer already reported. */
+		size_t offset;
+		/* Bytes received at the last inactivity check. */
+		size_t counter;
+		uint8_t *next_buf;
+		size_t next_len;
+		int32_t timeout;
+		bool enabled;
+		struct k_work_delayable timeout_work;
+	} rx;
+};
+
+/** @brief Initialize the instance.
+ *
+ * @param adma   Instance, part of the UART driver data.
+ * @param dev    UART device.
+ * @param config Configuration. Must be persistent.
+ *
+ * @retval 0 on success.
+ * @retval -ENODEV if a DMA controller is not ready.
+ */
+int uart_async_dma_init(struct uart_async_dma *adma, const struct device *dev,
+			const struct uart_async_dma_config *config);
+
+/** @brief Implementation of @ref uart_callback_set. */
+int uart_async_dma_callback_set(struct uart_async_dma *adma, uart_callback_t callback,
+				void *user_data);
+
+/** @brief Implementation of @ref uart_tx. */
+int uart_async_dma_tx(struct uart_async_dma *adma, const uint8_t *buf, size_t len,
+		      int32_t timeout);
+
+/** @brief Implementation of @ref uart_tx_abort. */
+int uart_async_dma_tx_abort(struct uart_async_dma *adma);
+
+/** @brief Implementation of @ref uart_rx_enable.
+ *
+ * Received data is reported once the line has been idle for @p timeout
+ * microseconds, when a buffer is full or when reception is disabled.
+ */
+int uart_async_dma_rx_enable(struct uart_async_dma *adma, uint8_t *buf, size_t len,
+			     int32_t timeout);
+
+/** @brief Implementation of @ref uart_rx_buf_rsp. */
+int uart_async_dma_rx_buf_rsp(struct uart_async_dma *adma, uint8_t *buf, size_t len);
+
+/** @brief Implementation of @ref uart_rx_disable. */
+int uart_async_dma_rx_disable(struct uart_async_dma *adma);
+
+/** @brief Report an idle line detected by the UART.
+ *
+ * Optional, for UARTs with an idle line or receive timeout interrupt. Called
+ * from the UART interrupt, it reports the received data right away instead of
+ * at the next inactivity check.
+ *
+ * @param adma Instance.
+ */
+void uart_async_dma_rx_idle(struct uart_async_dma *adma);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_DMA_H_ */
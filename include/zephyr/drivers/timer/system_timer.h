@@ -160,6 +160,32 @@ uint32_t sys_clock_cycle_get_32(void);
  */
 uint64_t sys_clock_cycle_get_64(void);
 
+/**
+ * @brief Program the high-resolution timer comparator
+ *
+ * Requests an interrupt once sys_clock_cycle_get_64() reaches @p cycles,
+ * in addition to the one programmed by sys_clock_set_timeout(). The driver
+ * then calls sys_clock_hrtimer_announce() from its interrupt handler, with
+ * its own lock released. A time in the past requests an interrupt as soon
+ * as possible, UINT64_MAX cancels the request.
+ *
+ * Only implemented by drivers selecting
+ * @kconfig{CONFIG_SYSTEM_TIMER_HAS_HRTIMER_SUPPORT}, called by the kernel
+ * with @kconfig{CONFIG_HRTIMER}.
+ *
+ * @param cycles Time of the interrupt, in 64 bit cycles
+ */
+void sys_clock_hrtimer_set(uint64_t cycles);
+
+/**
+ * @brief Announce a high-resolution timer interrupt to the kernel
+ *
+ * Called by the driver once the time programmed with
+ * sys_clock_hrtimer_set() is reached. The request is consumed, the kernel
+ * programs the next one.
+ */
+void sys_clock_hrtimer_announce(void);
+
 /**
  * @}
  */
@@ -749,10 +749,82 @@ struct video_buffer *video_buffer_alloc(size_t size);
 /**
  * @brief Release a video buffer.
  *
+ * Drops a reference to the buffer. The buffer is freed, or given back to its
+ * owner if imported, once the last reference is dropped.
+ *
  * @param buf Pointer to the video buffer to release.
  */
 void video_buffer_release(struct video_buffer *buf);
 
+/**
+ * @brief Take a reference to a video buffer.
+ *
+ * Lets a consumer, e.g. a display write or a network send, use the data of
+ * the buffer without copying it. The consumer calls video_buffer_release()
+ * once done with it. The buffer must not be enqueued again before all the
+ * references taken are dropped.
+ *
+ * @param buf Pointer to the video buffer.
+ *
+ * @retval buf
+ */
+struct video_buffer *video_buffer_ref(struct video_buffer *buf);
+
+/**
+ * @brief Wrap memory owned by the caller in a video buffer.
+ *
+ * Lets a frame be captured directly into a buffer of another subsystem,
+ * e.g. a display framebuffer. The memory is not freed on release.
+ *
+ * @param mem Pointer to the memory, must suit the DMA of the driver.
+ * @param size Size of the memory (in bytes).
+ *
+ * @retval pointer to the video buffer, NULL if none is available
+ */
+struct video_buffer *video_buffer_import(void *mem, size_t size);
+
+/**
+ * @brief Make the data of a video buffer visible to a DMA device.
+ *
+ * Flushes the data cache over the used part of the buffer, to call after
+ * the CPU wrote into it and before another device reads it.
+ *
+ * @param buf Pointer to the video buffer.
+ */
+void video_buffer_sync_for_device(struct video_buffer *buf);
+
+/**
+ * @brief Make the data written by a DMA device visible to the CPU.
+ *
+ * Invalidates the data cache over the used part of the buffer, to call
+ * before the CPU reads data written by a device.
+ *
+ * @param buf Pointer to the video buffer.
+ */
+void video_buffer_sync_for_cpu(struct video_buffer *buf);
+
+#if defined(CONFIG_VIDEO_BUFFER_NET_BUF) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Wrap a part of a video buffer in a network buffer.
+ *
+ * The network buffer points to the video buffer data and holds a reference
+ * to the video buffer until it is freed, so that the fragment can be added
+ * to a packet and sent without copying the frame. The data is flushed from
+ * the cache for the DMA of the network interface.
+ *
+ * @param buf Pointer to the video buffer.
+ * @param offset Offset of the data in the buffer (in bytes).
+ * @param len Length of the data (in bytes).
+ * @param timeout Time to wait for a network buffer.
+ *
+ * @retval pointer to the network buffer, NULL on failure
+ */
+struct net_buf *video_buffer_to_net_buf(struct video_buffer *buf, size_t offset, size_t len,
+					k_timeout_t timeout);
+#endif
+
 /* fourcc - four-character-code */
 #define video_fourcc(a, b, c, d)                                                                   \
 	((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
@@ -0,0 +1,210 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/filtering.h
+ *
+ * @brief Public APIs for DSP filtering
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_FILTERING_H_
+#define ZEPHYR_INCLUDE_DSP_FILTERING_H_
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_DSP_BACKEND_HAS_FILTERING
+#define DSP_FILTERING_FUNC_SCOPE static
+#else
+#define DSP_FILTERING_FUNC_SCOPE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_filtering Filtering Functions
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_fir FIR Filters
+ *
+ * Finite impulse response filters processing a block of samples at a time.
+ * <pre>
+ *     dst[n] = b[0] * src[n] + b[1] * src[n-1] + ... + b[num_taps-1] * src[n-num_taps+1]
+ * </pre>
+ * The coefficients are stored in time reversed order,
+ * <code>{b[num_taps-1], ..., b[1], b[0]}</code>. The state holds the last
+ * <code>num_taps - 1</code> input samples between calls, it must have room for
+ * @ref ZDSP_FIR_STATE_LEN samples and be zeroed before the first call.
+ * @{
+ */
+
+/**
+ * @brief Length of the state buffer of a FIR filter, in samples.
+ *
+ * @param num_taps   number of filter coefficients
+ * @param block_size largest number of samples processed per call
+ */
+#define ZDSP_FIR_STATE_LEN(num_taps, block_size) ((num_taps) + ROUND_UP(block_size, 4) - 1)
+
+/** @brief Instance of a Q15 FIR filter. */
+struct zdsp_fir_q15 {
+	/** Number of coefficients, even and at least 4. */
+	uint16_t num_taps;
+	/** State buffer of @ref ZDSP_FIR_STATE_LEN samples. */
+	DSP_DATA q15_t *state;
+	/** Coefficients, in time reversed order. */
+	const DSP_DATA q15_t *coeffs;
+};
+
+/** @brief Instance of a Q31 FIR filter. */
+struct zdsp_fir_q31 {
+	/** Number of coefficients. */
+	uint16_t num_taps;
+	/** State buffer of @ref ZDSP_FIR_STATE_LEN samples. */
+	DSP_DATA q31_t *state;
+	/** Coefficients, in time reversed order. */
+	const DSP_DATA q31_t *coeffs;
+};
+
+/** @brief Instance of a floating-point FIR filter. */
+struct zdsp_fir_f32 {
+	/** Number of coefficients. */
+	uint16_t num_taps;
+	/** State buffer of @ref ZDSP_FIR_STATE_LEN samples. */
+	DSP_DATA float32_t *state;
+	/** Coefficients, in time reversed order. */
+	const DSP_DATA float32_t *coeffs;
+};
+
+/**
+ * @brief Q15 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are in 2.30 format and accumulated in a 64-bit accumulator. The result is
+ *   truncated to 1.15 format by discarding the low 15 bits and saturated.
+ *
+ * @param[in]  inst       points to the filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FILTERING_FUNC_SCOPE void zdsp_fir_q15(const struct zdsp_fir_q15 *inst,
+					   const DSP_DATA q15_t *src, DSP_DATA q15_t *dst,
+					   uint32_t block_size);
+
+/**
+ * @brief Q31 FIR filter.
+ *
+ * @par Scaling and Overflow Behavior
+ *   The products are in 2.62 format and accumulated in a 64-bit accumulator without saturation.
+ *   The result is truncated to 1.31 format by discarding the low 31 bits. To avoid overflows,
+ *   scale down the input by log2(num_taps) bits.
+ *
+ * @param[in]  inst       points to the filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FILTERING_FUNC_SCOPE void zdsp_fir_q31(const struct zdsp_fir_q31 *inst,
+					   const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+					   uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter.
+ *
+ * @param[in]  inst       points to the filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FILTERING_FUNC_SCOPE void zdsp_fir_f32(const struct zdsp_fir_f32 *inst,
+					   const DSP_DATA float32_t *src, DSP_DATA float32_t *dst,
+					   uint32_t block_size);
+
+/**
+ * @}
+ */
+
+/**
+ * @ingroup math_dsp_filtering
+ * @addtogroup math_dsp_filtering_biquad Biquad Cascade IIR Filters
+ *
+ * Cascades of second order sections. Each stage has the five coefficients
+ * <code>{b0, b1, b2, a1, a2}</code> and computes
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * The feedback coefficients have the opposite sign of the usual difference
+ * equation. The state must be zeroed before the first call.
+ * @{
+ */
+
+/** @brief Instance of a Q31 biquad cascade filter, direct form I. */
+struct zdsp_biquad_df1_q31 {
+	/** Number of second order stages. */
+	uint8_t num_stages;
+	/** Left shift of the accumulator, the coefficients are scaled by 2^-post_shift. */
+	int8_t post_shift;
+	/** State buffer of 4 * num_stages samples. */
+	DSP_DATA q31_t *state;
+	/** Coefficients, 5 * num_stages values. */
+	const DSP_DATA q31_t *coeffs;
+};
+
+/** @brief Instance of a floating-point biquad cascade filter, direct form II transposed. */
+struct zdsp_biquad_df2t_f32 {
+	/** Number of second order stages. */
+	uint8_t num_stages;
+	/** State buffer of 2 * num_stages values. */
+	DSP_DATA float32_t *state;
+	/** Coefficients, 5 * num_stages values. */
+	const DSP_DATA float32_t *coeffs;
+};
+
+/**
+ * @brief Q31 biquad cascade filter, direct form I.
+ *
+ * @par Scaling and Overflow Behavior
+ *   Each stage accumulates the products in a 64-bit accumulator in 2.62 format, shifts it left by
+ *   @p post_shift bits and truncates it to 1.31 format without saturation.
+ *
+ * @param[in]  inst       points to the filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FILTERING_FUNC_SCOPE void zdsp_biquad_df1_q31(const struct zdsp_biquad_df1_q31 *inst,
+						  const DSP_DATA q31_t *src, DSP_DATA q31_t *dst,
+						  uint32_t block_size);
+
+/**
+ * @brief Floating-point biquad cascade filter, direct form II transposed.
+ *
+ * @param[in]  inst       points to the filter instance
+ * @param[in]  src        points to the block of input samples
+ * @param[out] dst        points to the block of output samples
+ * @param[in]  block_size number of samples to process
+ */
+DSP_FILTERING_FUNC_SCOPE void zdsp_biquad_df2t_f32(const struct zdsp_biquad_df2t_f32 *inst,
+						   const DSP_DATA float32_t *src,
+						   DSP_DATA float32_t *dst, uint32_t block_size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef CONFIG_DSP_BACKEND_HAS_FILTERING
+#include "zdsp_backend_filtering.h"
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_FILTERING_H_ */
@@ -0,0 +1,69 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/transform.h
+ *
+ * @brief Public APIs for DSP transforms
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_TRANSFORM_H_
+#define ZEPHYR_INCLUDE_DSP_TRANSFORM_H_
+
+#include <stdbool.h>
+#include <zephyr/dsp/dsp.h>
+
+#ifdef CONFIG_DSP_BACKEND_HAS_TRANSFORM
+#define DSP_TRANSFORM_FUNC_SCOPE static
+#else
+#define DSP_TRANSFORM_FUNC_SCOPE
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_transform Transform Functions
+ */
+
+/**
+ * @ingroup math_dsp_transform
+ * @addtogroup math_dsp_transform_cfft Complex FFT
+ *
+ * In-place complex fast Fourier transform. The buffer holds @p fft_len
+ * complex values as interleaved <code>{real, imag}</code> pairs.
+ * @{
+ */
+
+/**
+ * @brief Floating-point complex FFT.
+ *
+ * The inverse transform is scaled by 1 / @p fft_len, so that a forward
+ * transform followed by an inverse one returns the input.
+ *
+ * @param[in,out] buf     points to the 2 * @p fft_len values to transform
+ * @param[in]     fft_len number of complex values, a power of 2 from 16 to 4096
+ * @param[in]     inverse true for the inverse transform
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p fft_len is not supported.
+ */
+DSP_TRANSFORM_FUNC_SCOPE int zdsp_cfft_f32(DSP_DATA float32_t *buf, uint32_t fft_len,
+					   bool inverse);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef CONFIG_DSP_BACKEND_HAS_TRANSFORM
+#include "zdsp_backend_transform.h"
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_TRANSFORM_H_ */
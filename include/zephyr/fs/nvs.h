@@ -62,6 +62,12 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	/** Work item running the background garbage collection */
+	struct k_work gc_work;
+	/** Sector the background garbage collection has been requested for */
+	uint16_t gc_sector;
+#endif
 };
 
 /**
@@ -68,6 +68,18 @@ struct zms_fs {
 	/** Lookup table used to cache ATE address of a written ID */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_ZMS_LOOKUP_CACHE_FULL
+	/** ID of each lookup table entry */
+	uint32_t lookup_cache_id[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	/** Set when an ID could not be added to the full lookup table */
+	bool lookup_cache_incomplete;
+#endif
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	/** Work item running the background garbage collection */
+	struct k_work gc_work;
+	/** Sector the background garbage collection has been requested for */
+	uint32_t gc_sector;
+#endif
 };
 
 /**
@@ -158,6 +158,76 @@ struct input_callback {
 #define INPUT_CALLBACK_DEFINE(_dev, _callback, _user_data)                     \
 	INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
 
+/**
+ * @brief Input batch callback structure.
+ */
+struct input_batch_callback {
+	/** @ref device pointer or NULL. */
+	const struct device *dev;
+	/** The callback function. */
+	void (*callback)(const struct input_event *evts, size_t count, void *user_data);
+	/** User data pointer. */
+	void *user_data;
+};
+
+/**
+ * @brief Register a callback structure for batches of input events.
+ *
+ * Requires @kconfig{CONFIG_INPUT_BATCH}. The events reported by a device are
+ * grouped up to and including the one with the sync flag set, and delivered
+ * to the callback as one array from the input thread, after the per-event
+ * callbacks. A batch is delivered before its sync event if another device
+ * reports in the meantime or if @kconfig{CONFIG_INPUT_BATCH_MAX_EVENTS} events
+ * are pending.
+ *
+ * The @p _dev field can be used to only invoke callback for events generated
+ * by a specific device. Setting dev to NULL causes callback to be invoked for
+ * batches of any device.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _callback The callback function.
+ * @param _user_data Pointer to user specified data.
+ */
+#define INPUT_BATCH_CALLBACK_DEFINE(_dev, _callback, _user_data)               \
+	static const STRUCT_SECTION_ITERABLE(input_batch_callback,             \
+					     _input_batch_callback__##_callback) = { \
+		.dev = _dev,                                                   \
+		.callback = _callback,                                         \
+		.user_data = _user_data,                                       \
+	}
+
+/**
+ * @brief Input queue statistics.
+ */
+struct input_queue_stats {
+	/** Highest number of events pending in the queue. */
+	uint32_t max_used;
+	/** Number of events dropped because the queue was full. */
+	uint32_t dropped;
+	/** Number of batches delivered (see @ref INPUT_BATCH_CALLBACK_DEFINE). */
+	uint32_t batches;
+	/** Largest batch delivered. */
+	uint32_t batch_max;
+};
+
+/**
+ * @brief Get the input queue statistics.
+ *
+ * Requires @kconfig{CONFIG_INPUT_QUEUE_STATS}.
+ *
+ * @param stats Where to store the statistics.
+ *
+ * @retval 0 on success.
+ */
+int input_queue_stats_get(struct input_queue_stats *stats);
+
+/**
+ * @brief Reset the input queue statistics.
+ *
+ * Requires @kconfig{CONFIG_INPUT_QUEUE_STATS}.
+ */
+void input_queue_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,16 @@ struct icmsg_data_t {
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
 	struct k_mutex tx_lock;
 #endif
+	/* Tx buffer allocated in shared memory, NULL if there is none. */
+	char *tx_buf;
+
+	/* Rx packet handed to the endpoint, held until released if rx_held. */
+	char *rx_buf;
+	uint16_t rx_len;
+	bool rx_claimed;
+	atomic_t rx_held;
+	/* Copy of a received packet wrapping around the end of the buffer. */
+	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
 
 	/* Callbacks for an endpoint. */
 	const struct ipc_service_cb *cb;
@@ -125,6 +135,107 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	       struct icmsg_data_t *dev_data,
 	       const void *msg, size_t len);
 
+/** @brief Get the maximal size of a buffer returned by @ref icmsg_get_tx_buffer.
+ *
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *
+ *  @retval Maximal TX buffer size.
+ */
+int icmsg_get_tx_buffer_size(struct icmsg_data_t *dev_data);
+
+/** @brief Get a TX buffer in the shared memory to be sent with @ref icmsg_send_nocopy.
+ *
+ *  Only one TX buffer can be allocated at a time. Until it is sent or dropped,
+ *  other messages can not be sent by the instance. The buffer must be sent or
+ *  dropped by the thread that allocated it.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[out] data Pointer to the TX buffer.
+ *  @param[inout] size Requested buffer size, 0 for the maximal size available.
+ *                     On return, size of the TX buffer or, if the requested
+ *                     size is too big, the maximal size currently available.
+ *  @param[in] wait Timeout waiting for the access to the shared memory. Waiting
+ *                  for free space in the shared memory is not supported.
+ *
+ *  @retval 0 on success.
+ *  @retval -EBUSY when the instance has not finished handshake with the remote
+ *                 instance.
+ *  @retval -EALREADY when a TX buffer is already allocated.
+ *  @retval -ENOBUFS when the shared memory can not be accessed.
+ *  @retval -ENOMEM when the requested size is too big.
+ */
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, uint32_t *size, k_timeout_t wait);
+
+/** @brief Drop a TX buffer allocated by @ref icmsg_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the TX buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY when no TX buffer is allocated.
+ *  @retval -ENXIO when @p data is not the allocated TX buffer.
+ */
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data);
+
+/** @brief Send a message filled in the TX buffer allocated by @ref icmsg_get_tx_buffer.
+ *
+ *  On success the TX buffer is released. On failure it stays allocated and
+ *  can be sent again or dropped.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the icmsg
+ *                  instance.
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] msg Pointer to the TX buffer.
+ *  @param[in] len Size of the message in the TX buffer.
+ *
+ *  @retval Number of sent bytes.
+ *  @retval -ENXIO when @p msg is not the allocated TX buffer.
+ *  @retval -ENODATA when the requested data to send is empty.
+ *  @retval -EBADMSG when the message is bigger than the TX buffer.
+ *  @retval other errno codes from dependent modules.
+ */
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *msg, size_t len);
+
+/** @brief Hold the received message after the receive callback returns.
+ *
+ *  Must be called from the receive callback. Further messages are not
+ *  received until the held one is released with @ref icmsg_release_rx_buffer.
+ *
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the received message.
+ *
+ *  @retval 0 on success.
+ *  @retval -ENXIO when @p data is not the message being received.
+ */
+int icmsg_hold_rx_buffer(struct icmsg_data_t *dev_data, const void *data);
+
+/** @brief Release a message held by @ref icmsg_hold_rx_buffer.
+ *
+ *  @param[inout] dev_data Structure containing run-time data used by the icmsg
+ *                         instance.
+ *  @param[in] data Pointer to the held message.
+ *
+ *  @retval 0 on success.
+ *  @retval -EALREADY when no message is held.
+ *  @retval -ENXIO when @p data is not the held message.
+ */
+int icmsg_release_rx_buffer(struct icmsg_data_t *dev_data, const void *data);
+
 /**
  * @}
  */
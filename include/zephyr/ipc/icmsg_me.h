@@ -247,6 +247,91 @@ int icmsg_me_send(const struct icmsg_config_t *conf,
 		  struct icmsg_me_data_t *data, icmsg_me_ept_id_t id,
 		  const void *msg, size_t len);
 
+/** @brief Get the maximal size of a buffer returned by @ref icmsg_me_get_tx_buffer.
+ *
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *
+ *  @retval Maximal TX buffer size.
+ */
+int icmsg_me_get_tx_buffer_size(struct icmsg_me_data_t *data);
+
+/** @brief Get a TX buffer to be sent with @ref icmsg_me_send_nocopy.
+ *
+ *  The buffer is allocated in the shared memory of the underlying icmsg
+ *  instance, see @ref icmsg_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the
+ *                  underlying icmsg instance.
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *  @param[out] buf Pointer to the TX buffer.
+ *  @param[inout] size Requested buffer size, 0 for the maximal size available.
+ *                     On return, size of the TX buffer or the maximal size
+ *                     currently available.
+ *  @param[in] wait Timeout waiting for the access to the shared memory.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes from @ref icmsg_get_tx_buffer.
+ */
+int icmsg_me_get_tx_buffer(const struct icmsg_config_t *conf,
+			   struct icmsg_me_data_t *data,
+			   void **buf, uint32_t *size, k_timeout_t wait);
+
+/** @brief Drop a TX buffer allocated by @ref icmsg_me_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the
+ *                  underlying icmsg instance.
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *  @param[in] buf Pointer to the TX buffer.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes from @ref icmsg_drop_tx_buffer.
+ */
+int icmsg_me_drop_tx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_me_data_t *data,
+			    const void *buf);
+
+/** @brief Send a message filled in the TX buffer allocated by @ref icmsg_me_get_tx_buffer.
+ *
+ *  @param[in] conf Structure containing configuration parameters for the
+ *                  underlying icmsg instance.
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *  @param[in] id Id of the endpoint to use.
+ *  @param[in] msg Pointer to the TX buffer.
+ *  @param[in] len Size of the message in the TX buffer.
+ *
+ *  @retval Number of sent bytes.
+ *  @retval other errno codes from @ref icmsg_send_nocopy.
+ */
+int icmsg_me_send_nocopy(const struct icmsg_config_t *conf,
+			 struct icmsg_me_data_t *data, icmsg_me_ept_id_t id,
+			 const void *msg, size_t len);
+
+/** @brief Hold the received message after the receive callback returns.
+ *
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *  @param[in] buf Pointer to the received message.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes from @ref icmsg_hold_rx_buffer.
+ */
+int icmsg_me_hold_rx_buffer(struct icmsg_me_data_t *data, const void *buf);
+
+/** @brief Release a message held by @ref icmsg_me_hold_rx_buffer.
+ *
+ *  @param[inout] data Structure containing run-time data used by the icmsg_me
+ *                     instance.
+ *  @param[in] buf Pointer to the held message.
+ *
+ *  @retval 0 on success.
+ *  @retval other errno codes from @ref icmsg_release_rx_buffer.
+ */
+int icmsg_me_release_rx_buffer(struct icmsg_me_data_t *data, const void *buf);
+
 /**
  * @}
  */
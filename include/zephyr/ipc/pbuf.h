@@ -223,6 +223,78 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Claim the next packet in the packet buffer without copying it.
+ *
+ * The packet stays in the buffer, where its data can be accessed until it
+ * is freed with @ref pbuf_free, as long as it is in continuous memory. A
+ * packet that wraps around the end of the buffer must be read with
+ * @ref pbuf_read instead.
+ *
+ * @note If data cache is used, cache is invalidated on the packet.
+ *
+ * @param[in] pb	A buffer from which the packet will be claimed.
+ * @param[out] buf	A location where the packet address is written.
+ *			It is 32 bit word aligned.
+ * @retval int	Packet length, negative error code on fail.
+ *		0, if the buffer is empty.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-EAGAIN, if not whole message is ready yet.
+ *		-ENOTSUP, if the packet wraps around the end of the buffer.
+ */
+int pbuf_claim(struct pbuf *pb, char **buf);
+
+/**
+ * @brief Free the packet claimed from the packet buffer.
+ *
+ * Hand the space of the packet claimed by @ref pbuf_claim back to the
+ * writer. Its data must no longer be accessed.
+ *
+ * @param pb	A buffer from which the packet was claimed.
+ * @param len	Claimed packet length.
+ * @retval 0 on success.
+ * @retval -EINVAL when the input parameter is incorrect.
+ */
+int pbuf_free(struct pbuf *pb, uint16_t len);
+
+/**
+ * @brief Allocate space for a packet in the packet buffer.
+ *
+ * The returned space is in continuous memory, where the writer can fill the
+ * packet in place before committing it with @ref pbuf_commit. Nothing is
+ * visible to the reader until then. When the free space is split by the end
+ * of the buffer, the packet may be allocated at the front of the buffer, in
+ * which case @ref pbuf_commit moves it into place.
+ *
+ * @param[in] pb	A buffer in which the packet will be allocated.
+ * @param[in] len	Requested packet length, or 0 for the longest packet
+ *			that can be allocated.
+ * @param[out] buf	A location where the packet address is written.
+ *			It is 32 bit word aligned.
+ * @retval int	Number of bytes that can be written to the packet (at least
+ *		@p len), negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENOMEM, if the packet does not fit in the buffer.
+ */
+int pbuf_alloc(struct pbuf *pb, uint16_t len, char **buf);
+
+/**
+ * @brief Commit the packet allocated in the packet buffer.
+ *
+ * The packet allocated by @ref pbuf_alloc is handed over to the reader. No
+ * other packet can be written between the allocation and the commit.
+ *
+ * @note If data cache is used, cache is flushed on the packet.
+ *
+ * @param pb	A buffer in which the packet was allocated.
+ * @param buf	Packet address returned by @ref pbuf_alloc.
+ * @param len	Packet length, must not exceed the allocated length.
+ * @retval int	Number of bytes committed, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENOMEM, if the packet does not fit in the buffer.
+ */
+int pbuf_commit(struct pbuf *pb, const char *buf, uint16_t len);
+
 /**
  * @}
  */
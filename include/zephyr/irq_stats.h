@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Interrupt statistics
+ */
+
+#ifndef ZEPHYR_INCLUDE_IRQ_STATS_H_
+#define ZEPHYR_INCLUDE_IRQ_STATS_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Interrupt statistics
+ * @defgroup irq_stats_apis Interrupt statistics
+ * @ingroup kernel_apis
+ * @{
+ */
+
+#if defined(CONFIG_NUM_IRQS) || defined(__DOXYGEN__)
+/** Number of interrupt lines with statistics */
+#define IRQ_STATS_NUM_IRQS CONFIG_NUM_IRQS
+#else
+/* Size of the interrupt controller model of the POSIX boards */
+#define IRQ_STATS_NUM_IRQS 32
+#endif
+
+/**
+ * @brief Statistics of an interrupt line
+ *
+ * Times are in cycles. Histogram bucket N counts times from 2^N to
+ * 2^(N+1)-1 cycles, bucket 0 also counting those that took no time. The
+ * last bucket counts every longer time.
+ */
+struct irq_stats {
+	/** Number of times the handler was called */
+	uint32_t count;
+	/** Sum of the handler durations */
+	uint64_t duration_total;
+	/** Longest handler duration */
+	uint32_t duration_max;
+	/** Longest entry latency */
+	uint32_t latency_max;
+	/** Histogram of the handler durations */
+	uint32_t duration[CONFIG_IRQ_STATS_BUCKETS];
+	/** Histogram of the entry latencies, from the interrupt wrapper entry to the handler */
+	uint32_t latency[CONFIG_IRQ_STATS_BUCKETS];
+};
+
+/**
+ * @brief Get the statistics of an interrupt line
+ *
+ * @param irq Interrupt line, as used by the software ISR table
+ * @param stats Where to copy the statistics
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a irq is out of range
+ */
+int irq_stats_query(unsigned int irq, struct irq_stats *stats);
+
+/**
+ * @brief Reset the statistics of an interrupt line
+ *
+ * @param irq Interrupt line, as used by the software ISR table
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a irq is out of range
+ */
+int irq_stats_reset(unsigned int irq);
+
+/** @} */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Time stamp taken by the interrupt wrappers */
+static inline uint32_t z_irq_stats_now(void)
+{
+	return k_cycle_get_32();
+}
+
+/* Account for a handler started at start, the wrapper being entered at entry */
+void z_irq_stats_record(unsigned int irq, uint32_t entry, uint32_t start);
+
+/*
+ * For wrappers written in assembly: z_irq_stats_enter() is called on entry,
+ * and z_irq_stats_isr() calls the handler from _sw_isr_table in place of the
+ * wrapper.
+ */
+void z_irq_stats_enter(void);
+void z_irq_stats_isr(unsigned int irq);
+
+/**
+ * @endcond
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_IRQ_STATS_H_ */
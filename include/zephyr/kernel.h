@@ -358,6 +358,32 @@ __syscall k_thread_stack_t *k_thread_stack_alloc(size_t size, int flags);
  */
 __syscall int k_thread_stack_free(k_thread_stack_t *stack);
 
+#if defined(CONFIG_DYNAMIC_THREAD_STACK_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Thread stack cache statistics
+ *
+ * @see k_thread_stack_cache_stats_get()
+ */
+struct k_thread_stack_cache_stats {
+	/** Heap stack allocations served from the cache */
+	uint32_t hits;
+	/** Heap stack allocations that had to use the heap */
+	uint32_t misses;
+	/** Stacks currently held in the cache */
+	uint32_t cached;
+};
+
+/**
+ * @brief Get thread stack cache statistics
+ *
+ * @note You should enable @kconfig{CONFIG_DYNAMIC_THREAD_STACK_CACHE} in your
+ * project configuration.
+ *
+ * @param stats Where to store the statistics.
+ */
+void k_thread_stack_cache_stats_get(struct k_thread_stack_cache_stats *stats);
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE */
+
 /**
  * @brief Create a thread.
  *
@@ -958,6 +984,38 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  *
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Give a deadline thread a constant bandwidth server reservation
+ *
+ * The thread may then run for at most @a budget cycles in each
+ * @a period cycles before its deadline is pushed back.  Whenever the
+ * budget runs out, it is refilled and the thread's deadline is
+ * postponed by @a period, so that other threads of the same priority
+ * with earlier deadlines get to run.  When the thread wakes up with
+ * more budget left than its reserved bandwidth allows before its
+ * current deadline, it gets a full budget and a deadline @a period
+ * cycles from now.  The reservation replaces any deadline previously
+ * set with k_thread_deadline_set().
+ *
+ * Budgets are only enforced among threads of the same static
+ * priority, with tick granularity, and apply to preemptible threads.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_CBS} in your
+ * project configuration.
+ *
+ * @param thread Thread on which to set the reservation
+ * @param budget Cycles of execution per period, or 0 to remove the
+ *        reservation
+ * @param period Reservation period, in cycles
+ *
+ * @retval 0 on success
+ * @retval -EINVAL @a budget is larger than @a period, or @a period is
+ *         zero or does not fit a signed 32 bit deadline delta
+ */
+__syscall int k_thread_cbs_set(k_tid_t thread, uint32_t budget, uint32_t period);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 #endif
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -1650,6 +1708,26 @@ void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     k_timeout_t duration, k_timeout_t period);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set how late a timer may expire.
+ *
+ * Allows each expiry of the timer to be delayed by up to @a slack, so
+ * that it can be handled by the same system timer interrupt as other
+ * timeouts due around the same time.  Periods of a periodic timer are
+ * still counted from the nominal expiry, so the slack does not
+ * accumulate.  The slack stays in effect until changed or the timer is
+ * reinitialized, and should be set while the timer is stopped.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @param timer     Address of timer.
+ * @param slack     Maximum expiry delay, or K_NO_WAIT to expire exactly.
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Stop a timer.
  *
@@ -3184,6 +3262,144 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Reader-Writer Lock Structure
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock {
+	/** Threads waiting for read access */
+	_wait_q_t rd_wait_q;
+	/** Threads waiting for write access */
+	_wait_q_t wr_wait_q;
+	/** Thread holding write access */
+	struct k_thread *writer;
+	/** Number of threads holding read access */
+	uint32_t readers;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+
+	SYS_PORT_TRACING_TRACKING_FIELD(k_rwlock)
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj) \
+	{ \
+	.rd_wait_q = Z_WAIT_Q_INIT(&(obj).rd_wait_q), \
+	.wr_wait_q = Z_WAIT_Q_INIT(&(obj).wr_wait_q), \
+	.writer = NULL, \
+	.readers = 0, \
+	.writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) = \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader-writer lock.
+ *
+ * This routine initializes a reader-writer lock, prior to its first use.
+ *
+ * Upon completion, the lock is available for reading and writing.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading.
+ *
+ * Any number of threads may hold a reader-writer lock for reading at the
+ * same time, but not while a thread holds it for writing.  Writers are
+ * preferred: a thread asking for read access waits as long as a thread
+ * waits for write access, so a steady stream of readers cannot starve
+ * writers.  As a consequence a thread that already holds read access
+ * must not ask for it again, as it may wait for a writer that waits for
+ * it.
+ *
+ * A thread holding write access inherits the priority of the highest
+ * priority thread waiting for the lock, as with a mutex.  Threads
+ * holding read access do not.
+ *
+ * @funcprops \isr_ok{false}
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock held for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Lock a reader-writer lock for writing.
+ *
+ * Write access is exclusive: it is only granted once no other thread holds
+ * the lock.  It is not recursive.
+ *
+ * @funcprops \isr_ok{false}
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock held for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock.
+ *
+ * Releases the write access the calling thread holds, or else one read
+ * access.  When the last access is released, the lock goes to the highest
+ * priority thread waiting for write access, unless a thread waiting for
+ * read access has a strictly higher priority, in which case all threads
+ * waiting for read access get it.
+ *
+ * @funcprops \isr_ok{false}
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock unlocked.
+ * @retval -EPERM The lock is held for writing by another thread.
+ * @retval -EINVAL The lock is not held.
+ */
+__syscall int k_rwlock_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3600,6 +3816,89 @@ int k_work_queue_drain(struct k_work_q *queue, bool plug);
  */
 int k_work_queue_unplug(struct k_work_q *queue);
 
+struct k_work_q_pool;
+struct k_work_queue_pool_config;
+
+/** @brief Statically define a work queue pool.
+ *
+ * This defines the worker queues and their thread stacks.  The pool must
+ * still be started with k_work_queue_pool_start().
+ *
+ * @param name name of the pool object.
+ * @param n_workers number of worker threads, at most 255.
+ * @param size size of each worker thread stack, in bytes.
+ */
+#define K_WORK_QUEUE_POOL_DEFINE(name, n_workers, size)			\
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_work_q_pool_stacks_##name,	\
+					   n_workers, size);			\
+	static struct k_work_q _k_work_q_pool_workers_##name[n_workers];	\
+	struct k_work_q_pool name = {						\
+		.workers = _k_work_q_pool_workers_##name,			\
+		.stacks = (k_thread_stack_t *)_k_work_q_pool_stacks_##name,	\
+		.stack_stride = sizeof(_k_work_q_pool_stacks_##name[0]),	\
+		.stack_size = K_THREAD_STACK_SIZEOF(				\
+				_k_work_q_pool_stacks_##name[0]),		\
+		.num_workers = n_workers,					\
+	}
+
+/** @brief Start the worker threads of a work queue pool.
+ *
+ * Every worker is an ordinary work queue with its own thread and pending
+ * list.  Work submitted to any of them (see k_work_queue_pool_queue()) is
+ * dispatched to an idle worker if there is one, and a worker that runs out
+ * of its own work steals pending items from its siblings before going to
+ * sleep.  Work submitted from a worker's own handler stays on that worker.
+ *
+ * A work item never runs concurrently with itself, but distinct items
+ * submitted to a pool may run concurrently and in any order.
+ *
+ * @param pool pointer to a pool defined with K_WORK_QUEUE_POOL_DEFINE().
+ *
+ * @param prio initial priority of every worker thread
+ *
+ * @param cfg optional configuration applied to every worker.  Pass @c NULL
+ * to use the defaults documented in k_work_queue_pool_config.
+ */
+void k_work_queue_pool_start(struct k_work_q_pool *pool, int prio,
+			     const struct k_work_queue_pool_config *cfg);
+
+/** @brief Get the work queue that submits to a pool.
+ *
+ * The returned queue can be used anywhere a work queue is expected, e.g. in
+ * k_work_submit_to_queue() or k_work_schedule_for_queue().
+ *
+ * @param pool pointer to the pool.
+ *
+ * @return a queue that dispatches submitted work across the pool.
+ */
+static inline struct k_work_q *k_work_queue_pool_queue(struct k_work_q_pool *pool);
+
+/** @brief Wait until every worker of a pool has drained.
+ *
+ * This invokes k_work_queue_drain() on each worker in turn.
+ *
+ * @param pool pointer to the pool.
+ *
+ * @param plug if true the workers will continue to block new submissions
+ * after all items have drained, until k_work_queue_pool_unplug() is invoked.
+ *
+ * @retval 1 if call had to wait for the drain to complete
+ * @retval 0 if call did not have to wait
+ * @retval negative if wait was interrupted or failed
+ */
+int k_work_queue_pool_drain(struct k_work_q_pool *pool, bool plug);
+
+/** @brief Release every worker of a pool to accept new submissions.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pool pointer to the pool.
+ *
+ * @retval 0 if successfully unplugged
+ * @retval -EALREADY if the pool was not plugged.
+ */
+int k_work_queue_pool_unplug(struct k_work_q_pool *pool);
+
 /** @brief Initialize a delayable work structure.
  *
  * This must be invoked before scheduling a delayable work structure for the
@@ -3616,6 +3915,27 @@ int k_work_queue_unplug(struct k_work_q *queue);
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			   k_work_handler_t handler);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/** @brief Set how late a delayable work item may be submitted.
+ *
+ * Allows the delay of the work item to run over by up to @a slack, so
+ * that its timeout can be handled by the same system timer interrupt as
+ * other timeouts due around the same time.  The slack applies to all
+ * later k_work_schedule() and k_work_reschedule() calls, until changed
+ * or the work item is reinitialized.  It should be set while the work
+ * item is idle.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ * @param slack maximum extra delay, or K_NO_WAIT for none.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork, k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Get the parent delayable work structure from a work pointer.
  *
@@ -4105,6 +4425,25 @@ struct k_work_queue_config {
 	bool essential;
 };
 
+/** @brief A structure holding optional configuration items for a work
+ * queue pool.
+ *
+ * This structure, and values it references, are not retained by
+ * k_work_queue_pool_start().
+ */
+struct k_work_queue_pool_config {
+	/** Configuration applied to every worker thread. */
+	struct k_work_queue_config worker;
+
+	/** Pin worker @c i to CPU @c i modulo the number of CPUs.
+	 *
+	 * Requires CONFIG_SCHED_CPU_MASK, ignored otherwise.  Work
+	 * submitted from a CPU then preferably goes to the worker on
+	 * that same CPU.
+	 */
+	bool per_cpu;
+};
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4125,6 +4464,31 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Pool the queue is a worker of, or NULL. */
+	struct k_work_q_pool *pool;
+#endif /* CONFIG_WORKQUEUE_POOL */
+};
+
+/** @brief A set of work queues sharing submitted work. */
+struct k_work_q_pool {
+	/* Worker queues, each animated by its own thread. */
+	struct k_work_q *workers;
+
+	/* Stack areas of the workers, stack_stride bytes apart. */
+	k_thread_stack_t *stacks;
+	size_t stack_stride;
+	size_t stack_size;
+
+	uint8_t num_workers;
+
+	/* Worker receiving new work when none is idle.  Accessed only
+	 * while the work module spinlock is held.
+	 */
+	uint8_t cursor;
+
+	bool per_cpu;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4163,6 +4527,11 @@ static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue)
 	return &queue->thread;
 }
 
+static inline struct k_work_q *k_work_queue_pool_queue(struct k_work_q_pool *pool)
+{
+	return &pool->workers[0];
+}
+
 /** @} */
 
 struct k_work_user;
@@ -4520,6 +4889,13 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#ifdef CONFIG_MSGQ_SPSC
+	/** Number of used messages, in single producer single consumer mode */
+	atomic_t spsc_used;
+	/** Non-zero if the producer or the consumer may be waiting */
+	atomic_t spsc_waiting;
+#endif
+
 	Z_DECL_POLL_EVENT
 
 	/** Message queue */
@@ -4555,6 +4931,7 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_SPSC	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -4611,6 +4988,29 @@ struct k_msgq_attrs {
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs);
 
+/**
+ * @brief Initialize a single producer single consumer message queue.
+ *
+ * Same as k_msgq_init(), except that the message queue may only have one
+ * producer and one consumer, e.g. an ISR putting messages and a thread
+ * getting them.  In exchange, k_msgq_put() and k_msgq_get() only update
+ * atomic counters, and only take the queue lock when the caller has to
+ * wait or has to wake up the other side.
+ *
+ * k_msgq_peek(), k_msgq_peek_at() and k_msgq_purge() may only be called
+ * by the consumer.  Message queues initialized this way cannot be used
+ * with k_poll().
+ *
+ * @kconfig_dep{CONFIG_MSGQ_SPSC}
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ */
+void k_msgq_init_spsc(struct k_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs);
+
 /**
  * @brief Initialize a message queue.
  *
@@ -4758,9 +5158,21 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 				 struct k_msgq_attrs *attrs);
 
 
+/** @cond INTERNAL_HIDDEN */
+static inline uint32_t z_msgq_used(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_SPSC
+	if ((msgq->flags & K_MSGQ_FLAG_SPSC) != 0U) {
+		return (uint32_t)atomic_get(&msgq->spsc_used);
+	}
+#endif
+	return msgq->used_msgs;
+}
+/** @endcond */
+
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - z_msgq_used(msgq);
 }
 
 /**
@@ -4776,7 +5188,7 @@ __syscall uint32_t k_msgq_num_used_get(struct k_msgq *msgq);
 
 static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 {
-	return msgq->used_msgs;
+	return z_msgq_used(msgq);
 }
 
 /** @} */
@@ -5160,13 +5572,33 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Small stack of free blocks owned by one CPU */
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	uint32_t count;
+	char *blocks[CONFIG_MEM_SLAB_CPU_CACHE_SIZE];
+};
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
+	/* With CONFIG_MEM_SLAB_CPU_CACHE, info.num_used also counts the
+	 * blocks sitting in the per-CPU caches.
+	 */
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct k_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Number of threads on the allocation slow path; while non-zero,
+	 * frees bypass the caches so that waiters are served.
+	 */
+	atomic_t cache_bypass;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5174,6 +5606,26 @@ struct k_mem_slab {
 #endif
 };
 
+/* Number of blocks of @a slab handed out to users */
+static inline uint32_t z_mem_slab_num_used(struct k_mem_slab *slab)
+{
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t used = slab->info.num_used;
+	uint32_t cached = 0U;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cpu_cache[i].count;
+	}
+
+	/* The counts are sampled unlocked and may be from slightly
+	 * different instants.
+	 */
+	return (used > cached) ? (used - cached) : 0U;
+#else
+	return slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+}
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
@@ -5320,7 +5772,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_used;
+	return z_mem_slab_num_used(slab);
 }
 
 /**
@@ -5355,7 +5807,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - z_mem_slab_num_used(slab);
 }
 
 /**
@@ -5394,10 +5846,26 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+/** @cond INTERNAL_HIDDEN */
+#define Z_KHEAP_CACHE_CLASSES (LOG2CEIL(CONFIG_KHEAP_CPU_CACHE_MAX_SIZE) - 3)
+
+struct z_kheap_cpu_cache {
+	struct k_spinlock lock;
+	uint8_t count[Z_KHEAP_CACHE_CLASSES];
+	void *blocks[Z_KHEAP_CACHE_CLASSES][CONFIG_KHEAP_CPU_CACHE_DEPTH];
+};
+/** @endcond */
+#endif /* CONFIG_KHEAP_CPU_CACHE */
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	atomic_t waiters;
+	struct z_kheap_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 /**
@@ -5504,7 +5972,14 @@ void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
-#define Z_HEAP_MIN_SIZE ((sizeof(void *) > 4) ? 56 : 44)
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* Room for the slab free lists in the heap header, see lib/heap/heap.h */
+#define Z_HEAP_SLABS_SIZE \
+	ROUND_UP(((CONFIG_SYS_HEAP_SLAB_MAX_SIZE + 15U) / 8U + 1U) * 4U, 8U)
+#else
+#define Z_HEAP_SLABS_SIZE 0
+#endif
+#define Z_HEAP_MIN_SIZE (((sizeof(void *) > 4) ? 56 : 44) + Z_HEAP_SLABS_SIZE)
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5973,6 +6448,86 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps poll events registered with their objects between
+ * waits, and collects the events that become ready on a list, so that
+ * waiting costs time proportional to the number of ready events rather
+ * than to the number of events in the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t returned;
+
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add a poll event to a poll set.
+ *
+ * The event, initialized with k_poll_event_init(), stays registered with
+ * its object until it is removed with k_poll_set_remove().  The event
+ * must not be passed to k_poll() or added to another set meanwhile, and
+ * must stay valid until it is removed.
+ *
+ * @param set The poll set.
+ * @param event The poll event to add.
+ *
+ * @retval 0 The event was added.
+ * @retval -EALREADY The event already belongs to a poll set.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The poll event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event does not belong to @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * On success, pointers to up to @a max_events ready events are stored in
+ * @a ready and their state fields tell which conditions were met, as
+ * with k_poll().  The set is level-triggered: an event returned by one
+ * call is checked again at the start of the next call, and is returned
+ * again if its condition still holds.  Ready events not returned because
+ * @a ready was full are returned by the next call.
+ *
+ * Only one thread may wait on a given poll set at a time.
+ *
+ * @param set The poll set.
+ * @param ready Array receiving pointers to the ready events.
+ * @param max_events Size of the @a ready array.
+ * @param timeout Waiting period for an event to become ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a ready, or -EAGAIN if none became
+ * ready before the timeout expired.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout);
+
 /** @} */
 
 /**
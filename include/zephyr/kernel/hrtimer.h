@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_
+#define ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_
+
+/**
+ * @file
+ * @brief High-resolution timers
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup hrtimer_apis High-resolution timer APIs
+ * @ingroup kernel_apis
+ *
+ * High-resolution timers expire at a given hardware cycle count rather than
+ * at a system tick, independently of CONFIG_SYS_CLOCK_TICKS_PER_SEC. The
+ * system timer driver programs its comparator for the earliest of the next
+ * tick timeout and the next high-resolution timer, so that a few precise
+ * timers do not require a high tick rate.
+ *
+ * Times are in cycles of k_cycle_get_64(), see k_us_to_cyc_ceil64() and
+ * friends for conversions. The expiry function is called from the timer
+ * interrupt and must be short. It may start or stop any high-resolution
+ * timer, including its own.
+ *
+ * @{
+ */
+
+struct k_hrtimer;
+
+/**
+ * @brief High-resolution timer expiry function
+ *
+ * Called from the timer interrupt.
+ *
+ * @param timer Expired timer
+ */
+typedef void (*k_hrtimer_expiry_t)(struct k_hrtimer *timer);
+
+/**
+ * @brief High-resolution timer
+ *
+ * The fields are private.
+ */
+struct k_hrtimer {
+	/** @cond INTERNAL_HIDDEN */
+	sys_dnode_t node;
+	uint64_t expiry;
+	uint64_t period;
+	k_hrtimer_expiry_t expiry_fn;
+	uint32_t overruns;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a high-resolution timer.
+ *
+ * @param timer     Timer
+ * @param expiry_fn Function called at each expiry
+ */
+void k_hrtimer_init(struct k_hrtimer *timer, k_hrtimer_expiry_t expiry_fn);
+
+/**
+ * @brief Start a high-resolution timer at an absolute cycle count.
+ *
+ * Restarts the timer if it is running. A time in the past expires the
+ * timer as soon as possible.
+ *
+ * @param timer  Timer
+ * @param cycles Expiry time, in k_cycle_get_64() cycles
+ * @param period Period in cycles for a periodic timer, 0 for a one-shot
+ *               timer
+ */
+void k_hrtimer_start_at(struct k_hrtimer *timer, uint64_t cycles, uint64_t period);
+
+/**
+ * @brief Start a high-resolution timer.
+ *
+ * Restarts the timer if it is running.
+ *
+ * @param timer  Timer
+ * @param delay  Delay before the first expiry, in cycles
+ * @param period Period in cycles for a periodic timer, 0 for a one-shot
+ *               timer
+ */
+static inline void k_hrtimer_start(struct k_hrtimer *timer, uint64_t delay, uint64_t period)
+{
+	k_hrtimer_start_at(timer, k_cycle_get_64() + delay, period);
+}
+
+/**
+ * @brief Stop a high-resolution timer.
+ *
+ * Does nothing if the timer is not running. The expiry function may still
+ * be running on another CPU when this returns.
+ *
+ * @param timer Timer
+ */
+void k_hrtimer_stop(struct k_hrtimer *timer);
+
+/**
+ * @brief Next expiry time of a high-resolution timer.
+ *
+ * @param timer Timer
+ *
+ * @return Expiry time in k_cycle_get_64() cycles, 0 if the timer is not
+ *         running.
+ */
+uint64_t k_hrtimer_expires_cyc(struct k_hrtimer *timer);
+
+/**
+ * @brief Get and clear the overrun count of a periodic timer.
+ *
+ * Periods that already ended when the timer expiry was processed, because
+ * interrupts were locked too long, are skipped rather than expired late.
+ * Their number is counted here.
+ *
+ * @param timer Timer
+ *
+ * @return Number of skipped periods since the last call.
+ */
+uint32_t k_hrtimer_overruns_get(struct k_hrtimer *timer);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_HRTIMER_H_ */
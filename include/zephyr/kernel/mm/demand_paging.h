@@ -59,6 +59,16 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) || defined(__DOXYGEN__)
+	struct {
+		/** Number of data pages paged in by read-ahead */
+		unsigned long			pages;
+
+		/** Number of read-ahead data pages found accessed when evicted */
+		unsigned long			hits;
+	} read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
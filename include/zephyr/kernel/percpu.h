@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_PERCPU_H_
+#define ZEPHYR_INCLUDE_KERNEL_PERCPU_H_
+
+/**
+ * @file
+ * @brief Per-CPU variables
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup percpu_apis Per-CPU variables
+ * @ingroup kernel_apis
+ *
+ * A per-CPU variable has one instance of its type for each CPU, each in
+ * its own cache line on SMP, so that CPUs updating their own instance
+ * never contend for the same line.  It is typically used for counters
+ * that are updated often and read rarely: each CPU updates its own
+ * instance and readers sum all of them.
+ *
+ * The instance of the current CPU must only be accessed while the
+ * calling context cannot migrate to another CPU, e.g. with interrupts
+ * locked or from an ISR.  K_PERCPU_ADD() takes care of that for simple
+ * counters.
+ *
+ * @{
+ */
+
+/**
+ * @brief Alignment of each CPU's instance of a per-CPU variable
+ *
+ * The d-cache line size when known, 64 bytes otherwise on SMP.
+ */
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define K_PERCPU_ALIGN CONFIG_DCACHE_LINE_SIZE
+#elif defined(CONFIG_SMP)
+#define K_PERCPU_ALIGN 64
+#else
+#define K_PERCPU_ALIGN sizeof(void *)
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_PERCPU_STRUCT(name) struct z_percpu_##name
+
+#ifdef CONFIG_SMP
+#define Z_PERCPU_CPU_ID() (arch_curr_cpu()->id)
+#else
+#define Z_PERCPU_CPU_ID() 0
+#endif /* CONFIG_SMP */
+/** @endcond */
+
+/**
+ * @brief Declare a per-CPU variable
+ *
+ * Makes a per-CPU variable defined with K_PERCPU_DEFINE() available,
+ * typically from a header.  The defining file must see the declaration
+ * too.
+ *
+ * @param type Type of each CPU's instance
+ * @param name Name of the variable
+ */
+#define K_PERCPU_DECLARE(type, name)						\
+	Z_PERCPU_STRUCT(name) {							\
+		type val;							\
+	} __aligned(K_PERCPU_ALIGN);						\
+	extern Z_PERCPU_STRUCT(name) name[CONFIG_MP_MAX_NUM_CPUS]
+
+/**
+ * @brief Define a per-CPU variable declared with K_PERCPU_DECLARE()
+ *
+ * Every instance is zero initialized.
+ *
+ * @param name Name of the variable
+ */
+#define K_PERCPU_DEFINE(name)							\
+	Z_PERCPU_STRUCT(name) name[CONFIG_MP_MAX_NUM_CPUS]
+
+/**
+ * @brief Define a per-CPU variable private to one file
+ *
+ * @param type Type of each CPU's instance
+ * @param name Name of the variable
+ */
+#define K_PERCPU_DEFINE_STATIC(type, name)					\
+	Z_PERCPU_STRUCT(name) {							\
+		type val;							\
+	} __aligned(K_PERCPU_ALIGN);						\
+	static Z_PERCPU_STRUCT(name) name[CONFIG_MP_MAX_NUM_CPUS]
+
+/**
+ * @brief Declare a per-CPU member of a structure
+ *
+ * For per-CPU data embedded in another object rather than defined on its
+ * own.  The member is used with the accessors below like a per-CPU
+ * variable, e.g. K_PERCPU_PTR(obj->member).
+ *
+ * @param type Type of each CPU's instance
+ * @param name Name of the member
+ */
+#define K_PERCPU_MEMBER(type, name)						\
+	struct {								\
+		type val;							\
+	} __aligned(K_PERCPU_ALIGN) name[CONFIG_MP_MAX_NUM_CPUS]
+
+/**
+ * @brief Pointer to the instance of a per-CPU variable of a given CPU
+ *
+ * @param name Name of the variable
+ * @param cpu CPU index, below arch_num_cpus()
+ */
+#define K_PERCPU_CPU_PTR(name, cpu) (&(name)[(cpu)].val)
+
+/**
+ * @brief Pointer to the instance of a per-CPU variable of the current CPU
+ *
+ * Only valid while the caller cannot migrate to another CPU.
+ *
+ * @param name Name of the variable
+ */
+#define K_PERCPU_PTR(name) K_PERCPU_CPU_PTR(name, Z_PERCPU_CPU_ID())
+
+/**
+ * @brief Add to the current CPU's instance of a per-CPU counter
+ *
+ * Safe from any context: interrupts are locked on the local CPU only,
+ * for the duration of the update.
+ *
+ * @param name Name of a per-CPU variable of integer type
+ * @param delta Value to add
+ */
+#define K_PERCPU_ADD(name, delta)						\
+	do {									\
+		unsigned int z_percpu_key = arch_irq_lock();			\
+										\
+		*K_PERCPU_PTR(name) += (delta);					\
+		arch_irq_unlock(z_percpu_key);					\
+	} while (false)
+
+/**
+ * @brief Sum of all CPUs' instances of a per-CPU counter
+ *
+ * The result is not a snapshot: instances may be updated while they
+ * are summed.
+ *
+ * @param name Name of a per-CPU variable of integer type
+ *
+ * @return Sum, of the type of the variable
+ */
+#define K_PERCPU_SUM(name)							\
+	({									\
+		__typeof__((name)[0].val) z_percpu_sum = 0;			\
+										\
+		for (unsigned int z_percpu_i = 0;				\
+		     z_percpu_i < arch_num_cpus(); z_percpu_i++) {		\
+			z_percpu_sum += *(volatile __typeof__((name)[0].val) *)	\
+				K_PERCPU_CPU_PTR(name, z_percpu_i);		\
+		}								\
+		z_percpu_sum;							\
+	})
+
+/**
+ * @brief Iterate over the CPUs a per-CPU variable has instances for
+ *
+ * @param cpu Name of an unsigned int loop variable
+ */
+#define K_PERCPU_FOREACH_CPU(cpu)						\
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++)
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_PERCPU_H_ */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_RCU_H_
+#define ZEPHYR_INCLUDE_KERNEL_RCU_H_
+
+/**
+ * @file
+ * @brief Read-copy-update synchronization
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rcu_apis Read-copy-update APIs
+ * @ingroup kernel_apis
+ *
+ * Read-copy-update (RCU) lets readers of a shared structure run without
+ * taking any lock, while writers update it by publishing a modified
+ * copy with K_RCU_ASSIGN_POINTER().  The previous version may still be
+ * in use by readers, so it is only reclaimed after a grace period, once
+ * every reader that could have seen it is done: k_rcu_synchronize()
+ * waits for one, and k_rcu_call() runs a callback after one.
+ *
+ * Readers bracket their accesses with k_rcu_read_lock() and
+ * k_rcu_read_unlock(), and load published pointers with
+ * K_RCU_DEREFERENCE().  A read-side section keeps the thread from
+ * being preempted, which is what allows a grace period to be detected
+ * from context switches and idle CPUs alone.  It must therefore be
+ * short and must not block.  Read-side sections may nest and may be
+ * used in ISRs.
+ *
+ * Writers still have to serialize with each other, e.g. with a mutex.
+ *
+ * @{
+ */
+
+struct k_rcu_head;
+
+/**
+ * @brief RCU callback
+ *
+ * @param head Head passed to k_rcu_call(), usually embedded in the
+ *        object to reclaim
+ */
+typedef void (*k_rcu_callback_t)(struct k_rcu_head *head);
+
+/**
+ * @brief RCU callback record
+ *
+ * To be embedded in objects reclaimed with k_rcu_call().
+ */
+struct k_rcu_head {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	k_rcu_callback_t cb;
+	uint32_t seq;
+	/** @endcond */
+};
+
+/**
+ * @brief Load a pointer published with K_RCU_ASSIGN_POINTER()
+ *
+ * Only valid in a read-side critical section, or while holding the
+ * lock writers use to serialize updates.
+ *
+ * @param p Pointer to load
+ */
+#define K_RCU_DEREFERENCE(p) (*(volatile __typeof__(p) *)&(p))
+
+/**
+ * @brief Publish a pointer to readers
+ *
+ * All stores initializing @a v are visible to other CPUs before the
+ * pointer is.
+ *
+ * @param p Pointer to update
+ * @param v New value
+ */
+#define K_RCU_ASSIGN_POINTER(p, v)						\
+	do {									\
+		barrier_dmem_fence_full();					\
+		*(volatile __typeof__(p) *)&(p) = (v);				\
+	} while (false)
+
+/**
+ * @brief Enter an RCU read-side critical section
+ *
+ * Prevents the calling thread from being preempted until the matching
+ * k_rcu_read_unlock().
+ */
+void k_rcu_read_lock(void);
+
+/**
+ * @brief Leave an RCU read-side critical section
+ *
+ * Leaving the outermost section lets any preemption that was held off
+ * take place.
+ */
+void k_rcu_read_unlock(void);
+
+/**
+ * @brief Wait for a grace period
+ *
+ * Returns once every read-side critical section that was active when
+ * it was called has been left.  Must be called from a thread, outside
+ * any read-side critical section and not from the system workqueue.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @brief Run a callback after a grace period
+ *
+ * @a cb is called from the system workqueue once every read-side
+ * critical section that was active when k_rcu_call() was called has
+ * been left.  May be called from any context.
+ *
+ * @param head Callback record, untouched by the caller until @a cb runs
+ * @param cb Callback
+ */
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t cb);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_RCU_H_ */
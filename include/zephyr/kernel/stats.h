@@ -27,6 +27,11 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_USAGE_LATENCY) || defined(__DOXYGEN__)
+	/** Wakeup latency histogram, bucket N being 2^N to 2^(N+1)-1 cycles */
+	uint32_t  latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	uint32_t  latency_max;  /**< longest wakeup latency in cycles */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
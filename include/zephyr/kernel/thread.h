@@ -105,6 +105,23 @@ struct _thread_base {
 	int prio_deadline;
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Constant bandwidth server budget and period, in cycles, and
+	 * what is left of the budget in the current period
+	 */
+	uint32_t cbs_budget;
+	uint32_t cbs_period;
+	int32_t cbs_remaining;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
+#ifdef CONFIG_RCU
+	/* Set when a preemption was refused because the thread had the
+	 * scheduler locked, so that k_rcu_read_unlock() knows it must
+	 * reschedule
+	 */
+	bool preempt_deferred;
+#endif /* CONFIG_RCU */
+
 	uint32_t order_key;
 
 #ifdef CONFIG_SMP
@@ -117,6 +134,11 @@ struct _thread_base {
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* CPU index whose run queue holds the thread while queued */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_SCHED_CPU_MASK
@@ -145,6 +167,11 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/* Cycle count when last made ready, 0 once switched in */
+	uint32_t ready_stamp;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -172,6 +199,18 @@ struct _thread_stack_info {
 	 */
 	size_t delta;
 
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+	/* Highest stack usage found so far by the incremental thread
+	 * analyzer, in bytes counted from the top of the stack buffer.
+	 */
+	size_t watermark;
+
+	/* Offset from the bottom of the stack buffer where the next
+	 * incremental scan resumes.
+	 */
+	size_t scan_pos;
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+
 #if defined(CONFIG_THREAD_STACK_MEM_MAPPED)
 	struct {
 		/** Base address of the memory mapped thread stack */
@@ -237,6 +276,25 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	/*
+	 * Histogram of the cycles between being made ready and being
+	 * switched in, bucket N counting latencies from 2^N to 2^(N+1)-1
+	 * cycles and the last one every longer latency. For CPUs, this
+	 * covers every thread switched in on the CPU.
+	 */
+	uint32_t wakeup_latency[CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS];
+	uint32_t peak_wakeup_latency;  /* longest wakeup latency in cycles */
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	/*
+	 * Stack high watermark in bytes as last measured by the incremental
+	 * thread analyzer. Always zero for CPUs.
+	 */
+	size_t stack_used;
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
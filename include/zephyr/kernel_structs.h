@@ -154,7 +154,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -210,7 +210,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -296,12 +296,19 @@ typedef void (*_timeout_func_t)(struct _timeout *t);
 struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
+	/* Ticks after the previous timeout in the queue, or the absolute
+	 * expiry tick with CONFIG_TIMEOUT_QUEUE_WHEEL
+	 */
 #ifdef CONFIG_TIMEOUT_64BIT
 	/* Can't use k_ticks_t for header dependency reasons */
 	int64_t dticks;
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be delayed by to coalesce announcements */
+	int32_t slack;
+#endif /* CONFIG_TIMEOUT_SLACK */
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -46,6 +46,22 @@ static inline bool linker_is_in_rodata(const void *addr)
 	#define RO_END 0
 #endif
 
+#if defined(CONFIG_XIP) && \
+	(defined(CONFIG_ARM) || defined(CONFIG_ARC) || defined(CONFIG_X86) || \
+	defined(CONFIG_ARM64) || defined(CONFIG_NIOS2) || \
+	defined(CONFIG_RISCV) || defined(CONFIG_SPARC))
+	/* With XIP, everything in the ROM region, including constants that
+	 * the toolchain placed with the code, is immutable.
+	 */
+	extern char __rom_region_start[];
+	extern char __rom_region_end[];
+
+	if (((const char *)addr >= (const char *)__rom_region_start) &&
+	    ((const char *)addr < (const char *)__rom_region_end)) {
+		return true;
+	}
+#endif
+
 	return (((const char *)addr >= (const char *)RO_START) &&
 		((const char *)addr < (const char *)RO_END));
 
@@ -11,6 +11,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/util.h>
 
 /* This header file keeps all macros and functions needed for creating logging
@@ -271,6 +272,43 @@ static inline char z_log_minimal_level_to_char(int level)
 #define LOG_STRING_WARNING(_mode, _src, ...)
 #endif
 
+/** @brief Token bucket of a call site, used with CONFIG_LOG_RATE_LIMIT. */
+struct log_rate_limit {
+	/* Time of the last refill, in system clock ticks. */
+	atomic_t last;
+	/* Number of tokens taken out of the bucket since it was full. */
+	atomic_t taken;
+	/* Number of messages dropped since the last one let through. */
+	atomic_t suppressed;
+};
+
+/** @brief Take a token from the bucket of a call site.
+ *
+ * When messages were suppressed, a message with their number is created
+ * before the one let through.
+ *
+ * @param rl Token bucket of the call site.
+ * @param domain_id Domain ID.
+ * @param source Source of the message.
+ * @param level Log message severity level.
+ *
+ * @retval true Continue with log message creation.
+ * @retval false Drop that message.
+ */
+bool z_log_rate_limit_take(struct log_rate_limit *rl, uint8_t domain_id,
+			   const void *source, uint8_t level);
+
+/** @brief Drop the message if its call site exceeded its rate.
+ *
+ * The check is placed in a do/while(false) block, before the message is allocated.
+ */
+#define Z_LOG_RATE_LIMIT_CHECK(_level, _source)                                                    \
+	COND_CODE_1(CONFIG_LOG_RATE_LIMIT, (                                                       \
+		static struct log_rate_limit _log_rl;                                              \
+		if (!z_log_rate_limit_take(&_log_rl, Z_LOG_LOCAL_DOMAIN_ID, _source, _level)) {    \
+			break;                                                                     \
+		}), ())
+
 /*****************************************************************************/
 /****************** Macros for standard logging ******************************/
 /*****************************************************************************/
@@ -294,6 +332,7 @@ static inline char z_log_minimal_level_to_char(int level)
 		if (!Z_LOG_LEVEL_ALL_CHECK(_level, _inst, _source)) {                              \
 			break;                                                                     \
 		}                                                                                  \
+		Z_LOG_RATE_LIMIT_CHECK(_level, _source)                                            \
 		if (IS_ENABLED(CONFIG_LOG_MODE_MINIMAL)) {                                         \
 			Z_LOG_TO_PRINTK(_level, __VA_ARGS__);                                      \
 			break;                                                                     \
@@ -347,6 +386,7 @@ static inline char z_log_minimal_level_to_char(int level)
 		if (!Z_LOG_LEVEL_ALL_CHECK(_level, _inst, _source)) {                              \
 			break;                                                                     \
 		}                                                                                  \
+		Z_LOG_RATE_LIMIT_CHECK(_level, _source)                                            \
 		const char *_str = GET_ARG_N(1, __VA_ARGS__);                                      \
 		if (IS_ENABLED(CONFIG_LOG_MODE_MINIMAL)) {                                         \
 			Z_LOG_TO_PRINTK(_level, "%s", _str);                                       \
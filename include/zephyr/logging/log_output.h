@@ -90,6 +90,11 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	/* Timestamp and format string of the last compact dictionary message. */
+	log_timestamp_t dict_timestamp;
+	uintptr_t dict_fmt;
+#endif
 };
 
 /** @brief Log_output instance structure. */
@@ -23,6 +23,7 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
 };
 
 /**
@@ -38,6 +39,29 @@ struct log_dict_output_normal_msg_hdr_t {
 	log_timestamp_t timestamp;
 } __packed;
 
+/**
+ * @brief Compact encoding of one dictionary based log message.
+ *
+ * Used instead of @ref log_dict_output_normal_msg_hdr_t with
+ * CONFIG_LOG_DICTIONARY_COMPACT. Variable length integers are unsigned
+ * LEB128, signed ones zigzag encoded first. The message consists of:
+ *
+ * - type, @ref MSG_NORMAL_COMPACT (1 byte)
+ * - domain in bits 0-3 and level in bits 4-7 (1 byte)
+ * - source ID (varint)
+ * - timestamp, as the difference with the previous message (signed varint)
+ * - package length of the message, before encoding (varint)
+ * - data length (varint)
+ * - package: its descriptor (4 bytes), then each 32 bit word of the
+ *   arguments as a varint, except the format string pointer which is the
+ *   difference with the one of the previous message (signed varint), then
+ *   the string indexes and appended strings as they are
+ * - data, as it is
+ *
+ * Timestamps and format string pointers of the first message are relative
+ * to 0, so a stream must be decoded from its start.
+ */
+
 /**
  * Output for one dictionary based log message about
  * dropped messages.
@@ -25,12 +25,16 @@ extern "C" {
 /** @cond INTERNAL_HIDDEN */
 
 #define __MEM_ATTR	zephyr_memory_attr
+#define __MEM_CPUS	zephyr_memory_cpus
 
 #define _FILTER(node_id, fn)						\
 	COND_CODE_1(DT_NODE_HAS_PROP(node_id, __MEM_ATTR),		\
 		    (fn(node_id)),					\
 		    ())
 
+#define _CPU_BIT(node_id, prop, idx)					\
+	BIT(DT_PROP_BY_IDX(node_id, prop, idx))
+
 /** @endcond */
 
 /**
@@ -47,6 +51,21 @@ extern "C" {
 #define DT_MEMORY_ATTR_FOREACH_STATUS_OKAY_NODE(fn)			\
 	DT_FOREACH_STATUS_OKAY_NODE_VARGS(_FILTER, fn)
 
+/**
+ * @brief Get the mask of the CPUs a memory region is local to
+ *
+ * Each logical CPU ID listed in the `zephyr,memory-cpus` property of the node
+ * sets the corresponding bit of the mask.
+ *
+ * @param node_id node identifier
+ * @return mask of the local CPUs, 0 when the region is shared by all CPUs
+ */
+#define DT_MEMORY_ATTR_CPUS(node_id)					\
+	COND_CODE_1(DT_NODE_HAS_PROP(node_id, __MEM_CPUS),		\
+		    ((DT_FOREACH_PROP_ELEM_SEP(node_id, __MEM_CPUS,	\
+					       _CPU_BIT, (|)))),	\
+		    (0))
+
 /**
  * @brief memory-attr region structure.
  *
@@ -62,6 +81,8 @@ struct mem_attr_region_t {
 	size_t dt_size;
 	/** Memory region attributes */
 	uint32_t dt_attr;
+	/** Mask of the CPUs the region is local to, 0 if shared by all CPUs */
+	uint32_t dt_cpus;
 };
 
 /**
@@ -37,6 +37,11 @@ struct modem_backend_uart_async {
 	struct k_spinlock receive_rb_lock;
 	uint8_t *transmit_buf;
 	uint32_t transmit_buf_size;
+#ifdef CONFIG_MODEM_BACKEND_UART_ASYNC
+	struct modem_pipe_buf transmit_bufs[CONFIG_MODEM_BACKEND_UART_ASYNC_TRANSMIT_BUFS];
+	uint8_t transmit_bufs_count;
+	uint8_t transmit_bufs_next;
+#endif
 	struct k_work rx_disabled_work;
 	atomic_t state;
 };
@@ -203,6 +203,23 @@ enum modem_chat_script_send_state {
 	MODEM_CHAT_SCRIPT_SEND_STATE_DELIMITER,
 };
 
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+/**
+ * @brief Node of the unsolicited matches trie
+ * @warning Do not modify
+ */
+struct modem_chat_trie_node {
+	/* Index of first child node, 0 if none */
+	uint16_t child;
+	/* Index of next sibling node, 0 if none */
+	uint16_t sibling;
+	/* Index of unsolicited match ending at this node plus one, 0 if none */
+	uint16_t match;
+	/* Byte leading to this node from its parent */
+	uint8_t byte;
+};
+#endif
+
 /**
  * @brief Chat instance internal context
  * @warning Do not modify any members of this struct directly
@@ -245,6 +262,14 @@ struct modem_chat {
 	const struct modem_chat_match *matches[3];
 	uint16_t matches_size[3];
 
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+	/* Unsolicited matches trie, node 0 is the root */
+	struct modem_chat_trie_node unsol_trie[CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES];
+	uint16_t unsol_trie_size;
+	uint16_t unsol_trie_node;
+	bool unsol_trie_wildcards;
+#endif
+
 	/* Script execution */
 	const struct modem_chat_script *script;
 	const struct modem_chat_script *pending_script;
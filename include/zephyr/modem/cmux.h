@@ -96,6 +96,7 @@ struct modem_cmux_dlci {
 	/* Receive buffer */
 	struct ring_buf receive_rb;
 	struct k_mutex receive_rb_lock;
+	bool receive_claimed;
 
 	/* Work */
 	struct k_work_delayable open_work;
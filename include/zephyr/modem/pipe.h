@@ -42,6 +42,14 @@ struct modem_pipe;
 typedef void (*modem_pipe_api_callback)(struct modem_pipe *pipe, enum modem_pipe_event event,
 					void *user_data);
 
+/** Buffer of a scatter list transmitted through a pipe */
+struct modem_pipe_buf {
+	/** Data to transmit */
+	const uint8_t *buf;
+	/** Number of bytes to transmit */
+	size_t size;
+};
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -54,11 +62,22 @@ typedef int (*modem_pipe_api_receive)(void *data, uint8_t *buf, size_t size);
 
 typedef int (*modem_pipe_api_close)(void *data);
 
+typedef int (*modem_pipe_api_transmit_bufs)(void *data, const struct modem_pipe_buf *bufs,
+					    size_t count);
+
+typedef int (*modem_pipe_api_receive_claim)(void *data, uint8_t **buf);
+
+typedef int (*modem_pipe_api_receive_release)(void *data, size_t size);
+
 struct modem_pipe_api {
 	modem_pipe_api_open open;
 	modem_pipe_api_transmit transmit;
 	modem_pipe_api_receive receive;
 	modem_pipe_api_close close;
+	/* Optional, buffer lending */
+	modem_pipe_api_transmit_bufs transmit_bufs;
+	modem_pipe_api_receive_claim receive_claim;
+	modem_pipe_api_receive_release receive_release;
 };
 
 struct modem_pipe {
@@ -153,6 +172,57 @@ int modem_pipe_transmit(struct modem_pipe *pipe, const uint8_t *buf, size_t size
  */
 int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size);
 
+/**
+ * @brief Transmit a scatter list through pipe without copying it
+ *
+ * @param pipe Pipe to transmit through
+ * @param bufs Buffers to transmit, in order
+ * @param count Number of buffers
+ *
+ * @retval Number of bytes placed in pipe, taken from the start of the scatter list
+ * @retval -ENOTSUP if the pipe does not lend buffers, use modem_pipe_transmit() instead
+ * @retval -EPERM if pipe is closed
+ * @retval -errno code on error
+ *
+ * @note The buffers are transmitted in place, they must not be modified until the
+ * MODEM_PIPE_EVENT_TRANSMIT_IDLE event. They may need to be in RAM reachable by DMA.
+ *
+ * @warning This call must be non-blocking
+ */
+int modem_pipe_transmit_bufs(struct modem_pipe *pipe, const struct modem_pipe_buf *bufs,
+			     size_t count);
+
+/**
+ * @brief Claim received data in the buffer of the pipe
+ *
+ * @param pipe Pipe to receive from
+ * @param buf Set to the received data
+ *
+ * @retval Number of contiguous bytes available at @p buf
+ * @retval -ENOTSUP if the pipe does not lend buffers, use modem_pipe_receive() instead
+ * @retval -EPERM if pipe is closed
+ * @retval -EBUSY if received data is already claimed
+ * @retval -errno code on error
+ *
+ * @note The data must be given back with modem_pipe_receive_release() before claiming
+ * again or closing the pipe.
+ *
+ * @warning This call must be non-blocking
+ */
+int modem_pipe_receive_claim(struct modem_pipe *pipe, uint8_t **buf);
+
+/**
+ * @brief Release received data claimed with modem_pipe_receive_claim()
+ *
+ * @param pipe Pipe the data was claimed from
+ * @param size Number of bytes consumed, the remaining ones are received again
+ *
+ * @retval 0 on success
+ * @retval -ENOTSUP if the pipe does not lend buffers
+ * @retval -EINVAL if nothing is claimed or @p size is larger than the claimed data
+ */
+int modem_pipe_receive_release(struct modem_pipe *pipe, size_t size);
+
 /**
  * @brief Clear callback
  *
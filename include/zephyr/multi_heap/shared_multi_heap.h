@@ -58,6 +58,11 @@ extern "C" {
  *    take care of selecting the correct heap (thus memory region) to carve
  *    memory from, based on the opaque parameter and the runtime state of the
  *    heaps (available memory, heap state, etc...)
+ *
+ *  - Among the regions with the requested attribute, the regions local to the
+ *    calling CPU are tried first, then the regions shared by all CPUs and the
+ *    regions local to other CPUs last. Each region has its own lock, so CPUs
+ *    allocating from different regions do not contend.
  */
 
 /**
@@ -98,6 +103,13 @@ struct shared_multi_heap_region {
 
 	/** Memory heap size in bytes */
 	size_t size;
+
+	/**
+	 * Mask of the CPUs the region is local to, for instance
+	 * @ref DT_MEMORY_ATTR_CPUS of the region node. 0 if the region is
+	 * shared by all CPUs.
+	 */
+	uint32_t cpus;
 };
 
 /**
@@ -121,7 +133,8 @@ int shared_multi_heap_pool_init(void);
  *
  * Allocates a block of memory of the specified size in bytes and with a
  * specified capability / attribute. The opaque attribute parameter is used
- * by the backend to select the correct heap to allocate memory from.
+ * by the backend to select the correct heap to allocate memory from,
+ * preferring the heaps local to the calling CPU.
  *
  * @param attr		capability / attribute requested for the memory block.
  * @param bytes		requested size of the allocation in bytes.
@@ -34,6 +34,7 @@ extern "C" {
 struct net_if;
 struct net_pkt;
 struct device;
+struct net_capture_filter;
 
 struct net_capture_interface_api {
 	/** Cleanup the setup. This will also disable capturing. After this
@@ -53,10 +54,28 @@ struct net_capture_interface_api {
 
 	/** Send captured data */
 	int (*send)(const struct device *dev, struct net_if *iface, struct net_pkt *pkt);
+
+	/** Set the filter selecting the captured packets */
+	int (*set_filter)(const struct device *dev, const struct net_capture_filter *prog,
+			  size_t len);
 };
 
 /** @endcond */
 
+/**
+ * @brief Classic BPF instruction of a capture filter.
+ *
+ * The layout is the one of the Linux struct sock_filter, so a program can be
+ * generated with "tcpdump -ddd <expression>" for the link type of the
+ * captured interface.
+ */
+struct net_capture_filter {
+	uint16_t code; /**< Operation */
+	uint8_t jt;    /**< Jump offset if the condition is true */
+	uint8_t jf;    /**< Jump offset if the condition is false */
+	uint32_t k;    /**< Generic field, like a constant or a packet offset */
+};
+
 /**
  * @brief Setup network packet capturing support.
  *
@@ -179,6 +198,40 @@ static inline int net_capture_disable(const struct device *dev)
 #endif
 }
 
+/**
+ * @brief Set the filter selecting the packets to capture.
+ *
+ * @details The filter is run on every packet of the captured interface
+ * before the packet is cloned, and the packet is captured only if the
+ * filter returns a non-zero value. The program must end with a return
+ * instruction and can only jump forward.
+ *
+ * @param dev Network capture device
+ * @param prog Classic BPF program, NULL to capture all the packets
+ * @param len Number of instructions in @p prog, at most
+ *        CONFIG_NET_CAPTURE_FILTER_MAX_LEN
+ *
+ * @return 0 if ok, -EINVAL if the program is not valid, -ENOTSUP if
+ *         filtering is not supported
+ */
+static inline int net_capture_set_filter(const struct device *dev,
+					 const struct net_capture_filter *prog,
+					 size_t len)
+{
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	const struct net_capture_interface_api *api =
+		(const struct net_capture_interface_api *)dev->api;
+
+	return api->set_filter(dev, prog, len);
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(prog);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 /** @cond INTERNAL_HIDDEN */
 
 /**
@@ -340,6 +393,7 @@ struct net_capture_info {
 	struct sockaddr *peer;
 	struct sockaddr *local;
 	bool is_enabled;
+	size_t filter_len;
 };
 
 /**
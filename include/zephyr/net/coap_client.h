@@ -35,7 +35,9 @@
  * This callback is called for responses to CoAP client requests.
  * It is used to indicate errors, response codes from server or to deliver payload.
  * Blockwise transfers cause this callback to be called sequentially with increasing payload offset
- * and only partial content in buffer pointed by payload parameter.
+ * and only partial content in buffer pointed by payload parameter. When
+ * CONFIG_COAP_CLIENT_BLOCK_WINDOW is greater than 1, the blocks of a response may be given out of
+ * order, last_block being set on the call that completes the transfer.
  *
  * @param result_code Result code of the response. Negative if there was a failure in send.
  *                    @ref coap_response_code for positive.
@@ -85,6 +87,16 @@ struct coap_client_option {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+struct coap_client_block_slot {
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	struct coap_pending pending;
+	uint32_t num;
+	uint16_t id;
+	bool active;
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -102,6 +114,14 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+	/* Block2 requests in flight, once the number of blocks is known */
+	struct coap_client_block_slot window[CONFIG_COAP_CLIENT_BLOCK_WINDOW];
+	uint32_t window_blocks;
+	uint32_t window_next;
+	uint32_t window_received;
+#endif
 };
 
 struct coap_client {
@@ -45,7 +45,14 @@ extern "C" {
 struct coap_service_data {
 	int sock_fd;
 	struct coap_observer observers[CONFIG_COAP_SERVICE_OBSERVERS];
+	struct coap_resource *observer_res[CONFIG_COAP_SERVICE_OBSERVERS];
 	struct coap_pending pending[CONFIG_COAP_SERVICE_PENDING_MESSAGES];
+#if CONFIG_COAP_SERVICE_RESOURCE_INDEX_SIZE > 0
+	uint16_t res_index[CONFIG_COAP_SERVICE_RESOURCE_INDEX_SIZE];
+	uint16_t res_wildcard_begin;
+	uint16_t res_wildcard_end;
+	bool res_indexed;
+#endif
 };
 
 struct coap_service {
@@ -210,6 +210,12 @@ enum ethernet_hw_caps {
 
 	/** 5 Gbits link supported */
 	ETHERNET_LINK_5000BASE_T	= BIT(22),
+
+	/** TCP segmentation offload, see net_pkt_gso_size() */
+	ETHERNET_HW_TSO			= BIT(23),
+
+	/** UDP segmentation offload, see net_pkt_gso_size() */
+	ETHERNET_HW_USO			= BIT(24),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1273,6 +1279,90 @@ void net_eth_carrier_on(struct net_if *iface);
  */
 void net_eth_carrier_off(struct net_if *iface);
 
+/**
+ * @brief Get a network buffer to post to an RX DMA descriptor
+ *
+ * The buffer comes from the RX data pool, so that the DMA fills it in
+ * place and it is passed to the network stack without copying the frame.
+ * Its data area is invalidated from the data cache, so that no dirty
+ * line is written back over it while the DMA is writing. The data pool
+ * must be reachable by the DMA and its buffers should be aligned to the
+ * cache lines.
+ *
+ * @param size Min size of the buffer
+ * @param timeout Time to wait for a free buffer
+ *
+ * @return Network buffer, or NULL if none of @p size bytes is available
+ */
+struct net_buf *net_eth_rx_dma_buf_alloc(size_t size, k_timeout_t timeout);
+
+/**
+ * @brief Take back a network buffer filled by the RX DMA
+ *
+ * Invalidates the received bytes from the data cache, in case they were
+ * speculatively loaded while the DMA was writing, and sets the length of
+ * the buffer. The buffer can then be added to a received packet.
+ *
+ * @param buf Buffer from net_eth_rx_dma_buf_alloc()
+ * @param len Number of bytes written by the DMA
+ */
+void net_eth_rx_dma_buf_complete(struct net_buf *buf, size_t len);
+
+struct net_eth_rx_poll;
+
+/**
+ * @typedef net_eth_rx_poll_cb_t
+ * @brief Driver callback receiving frames in polled RX mode
+ *
+ * The callback passes at most @p budget received frames to the network
+ * stack. If it receives fewer frames than @p budget, the RX ring has been
+ * drained and the callback must re-enable the RX interrupt before
+ * returning. Otherwise the interrupt stays disabled and the callback is
+ * called again after the other pending polls have run.
+ *
+ * @param rx_poll Polled RX context of the device
+ * @param budget Max number of frames to receive
+ *
+ * @return Number of frames received
+ */
+typedef int (*net_eth_rx_poll_cb_t)(struct net_eth_rx_poll *rx_poll, int budget);
+
+/** Polled RX context of an Ethernet device */
+struct net_eth_rx_poll {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	net_eth_rx_poll_cb_t cb;
+	int budget;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the polled RX context of an Ethernet device
+ *
+ * A driver using polled RX disables its RX interrupt in the interrupt
+ * handler and calls net_eth_rx_poll_schedule(). The frames are then
+ * received by @p cb from the Ethernet RX poll thread, in batches of at
+ * most @p budget frames, until the RX ring is empty. This bounds the
+ * interrupt load under high packet rates.
+ *
+ * @param rx_poll Polled RX context
+ * @param cb Driver callback receiving the frames
+ * @param budget Max number of frames received per call of @p cb, 0 to use
+ *        CONFIG_NET_ETHERNET_RX_POLL_BUDGET
+ */
+void net_eth_rx_poll_init(struct net_eth_rx_poll *rx_poll,
+			  net_eth_rx_poll_cb_t cb, int budget);
+
+/**
+ * @brief Schedule the polled RX of an Ethernet device
+ *
+ * Can be called from an interrupt handler, after the RX interrupt of the
+ * device has been disabled.
+ *
+ * @param rx_poll Polled RX context
+ */
+void net_eth_rx_poll_schedule(struct net_eth_rx_poll *rx_poll);
+
 /**
  * @brief Set promiscuous mode either ON or OFF.
  *
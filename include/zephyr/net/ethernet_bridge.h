@@ -40,6 +40,37 @@ extern "C" {
 #define NET_ETHERNET_BRIDGE_ETH_INTERFACE_COUNT 1
 #endif
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+#define NET_ETHERNET_BRIDGE_FDB_COUNT CONFIG_NET_ETHERNET_BRIDGE_FDB_COUNT
+#define NET_ETHERNET_BRIDGE_FDB_HASH_SIZE CONFIG_NET_ETHERNET_BRIDGE_FDB_HASH_SIZE
+#endif
+
+struct net_eth_addr;
+
+/** @endcond */
+
+/** Forwarding database entry of a bridge */
+struct eth_bridge_fdb_entry {
+	/** @cond INTERNAL_HIDDEN */
+	/* Node in a hash bucket or in the free list */
+	sys_snode_t node;
+	/** @endcond */
+
+	/** MAC address */
+	uint8_t addr[6];
+
+	/** Bridged interface the address is reached through */
+	struct net_if *iface;
+
+	/** Uptime in milliseconds when the address was last seen */
+	int64_t last_seen;
+
+	/** Static entries are added by the user and do not age */
+	bool is_static;
+};
+
+/** @cond INTERNAL_HIDDEN */
+
 struct eth_bridge_iface_context {
 	/* Lock to protect access to interface array below */
 	struct k_mutex lock;
@@ -53,6 +84,17 @@ struct eth_bridge_iface_context {
 	/* How many interfaces are bridged atm */
 	size_t count;
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	/* Forwarding database, protected by the lock above */
+	struct eth_bridge_fdb_entry fdb[NET_ETHERNET_BRIDGE_FDB_COUNT];
+
+	/* Entries in use, hashed by MAC address */
+	sys_slist_t fdb_hash[NET_ETHERNET_BRIDGE_FDB_HASH_SIZE];
+
+	/* Unused entries */
+	sys_slist_t fdb_free;
+#endif
+
 	/* Bridge instance id */
 	int id;
 
@@ -136,6 +178,56 @@ typedef void (*eth_bridge_cb_t)(struct eth_bridge_iface_context *br, void *user_
  */
 void net_eth_bridge_foreach(eth_bridge_cb_t cb, void *user_data);
 
+/**
+ * @brief Add a static entry to the forwarding database of a bridge
+ *
+ * Frames sent to @p addr are then forwarded only to @p iface. A learned
+ * entry of the same address is replaced.
+ *
+ * @param br A pointer to a bridge interface
+ * @param addr Unicast MAC address
+ * @param iface Bridged interface the address is reached through
+ *
+ * @return 0 if OK, -EINVAL if @p iface is not bridged by @p br or @p addr
+ *         is not a unicast address, -ENOMEM if the database is full,
+ *         -ENOTSUP if the forwarding database is not enabled.
+ */
+int eth_bridge_fdb_add(struct net_if *br, const struct net_eth_addr *addr,
+		       struct net_if *iface);
+
+/**
+ * @brief Remove an entry from the forwarding database of a bridge
+ *
+ * @param br A pointer to a bridge interface
+ * @param addr MAC address of a static or learned entry
+ *
+ * @return 0 if OK, -ENOENT if there is no entry for @p addr,
+ *         -ENOTSUP if the forwarding database is not enabled.
+ */
+int eth_bridge_fdb_del(struct net_if *br, const struct net_eth_addr *addr);
+
+/**
+ * @typedef eth_bridge_fdb_cb_t
+ * @brief Callback used while iterating over forwarding database entries
+ * @param entry Forwarding database entry
+ * @param user_data User supplied data
+ */
+typedef void (*eth_bridge_fdb_cb_t)(const struct eth_bridge_fdb_entry *entry,
+				    void *user_data);
+
+/**
+ * @brief Go through the forwarding database entries of a bridge
+ *
+ * Learned entries that have aged out are skipped. The callback is called
+ * with the bridge locked, so it must not call other bridge functions.
+ *
+ * @param br A pointer to a bridge interface
+ * @param cb Callback to call for each entry
+ * @param user_data User supplied data
+ */
+void eth_bridge_fdb_foreach(struct net_if *br, eth_bridge_fdb_cb_t cb,
+			    void *user_data);
+
 /**
  * @}
  */
@@ -24,6 +24,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
+#include <zephyr/net/tls_credentials.h>
 #include <zephyr/net/http/parser.h>
 
 #ifdef __cplusplus
@@ -330,6 +331,72 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Pipeline several HTTP requests on one connection. All the requests
+ * are sent before waiting for the responses, which are then received in
+ * order, each one into the buffer of its request.
+ *
+ * Only idempotent requests should be pipelined, as the server may close
+ * the connection before answering all of them (RFC 7230, 6.3.2).
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of HTTP requests
+ * @param count Number of requests in @p reqs
+ * @param timeout Max timeout in milliseconds to send all the requests and
+ *        receive all the responses.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_req_pipeline(int sock, struct http_request **reqs, size_t count,
+			     int32_t timeout, void *user_data);
+
+/**
+ * @brief Do a HTTP request on a pooled connection. A kept-alive connection
+ * to the same server is reused if one is idle, otherwise a new connection
+ * is created and kept for the next requests if the server allows it.
+ * Idle connections are closed after CONFIG_HTTP_CLIENT_POOL_IDLE_TIMEOUT
+ * seconds.
+ *
+ * @param addr Address of the server.
+ * @param addrlen Length of @p addr.
+ * @param sec_tag TLS credential used for the connection, or a negative
+ *        value for plain TCP.
+ * @param req HTTP request information. The host field also selects the
+ *        TLS hostname of the connection.
+ * @param timeout Max timeout to wait for the data, in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(const struct sockaddr *addr, socklen_t addrlen,
+			 sec_tag_t sec_tag, struct http_request *req,
+			 int32_t timeout, void *user_data);
+
+/**
+ * @brief Pipeline several HTTP requests on a pooled connection, see
+ * http_client_req_pipeline() and http_client_pool_req().
+ *
+ * @param addr Address of the server.
+ * @param addrlen Length of @p addr.
+ * @param sec_tag TLS credential used for the connection, or a negative
+ *        value for plain TCP.
+ * @param reqs Array of HTTP requests
+ * @param count Number of requests in @p reqs
+ * @param timeout Max timeout in milliseconds for all the requests.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req_pipeline(const struct sockaddr *addr, socklen_t addrlen,
+				  sec_tag_t sec_tag, struct http_request **reqs,
+				  size_t count, int32_t timeout, void *user_data);
+
+/**
+ * @brief Close all the idle pooled connections.
+ */
+void http_client_pool_close_all(void);
+
 #ifdef __cplusplus
 }
 #endif
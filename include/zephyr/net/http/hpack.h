@@ -12,6 +12,7 @@
 #ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 #define ZEPHYR_INCLUDE_NET_HTTP_SERVER_HPACK_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -104,6 +105,17 @@ enum http_hpack_static_key {
 #define HTTP_SERVER_HUFFMAN_DECODE_BUFFER_SIZE 0
 #endif
 
+#if defined(CONFIG_HTTP_SERVER)
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE
+#else
+#define HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE 0
+#endif
+
+/* Size overhead of a dynamic table entry, RFC7541 ch 4.1. */
+#define HTTP_HPACK_ENTRY_OVERHEAD 32
+#define HTTP_HPACK_DYNAMIC_TABLE_ENTRIES \
+	(HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE / HTTP_HPACK_ENTRY_OVERHEAD)
+
 /** @endcond */
 
 /** HTTP2 header field with decoding buffer. */
@@ -127,16 +139,48 @@ struct http_hpack_header_buf {
 	size_t datalen;
 };
 
+/** HPACK dynamic table, kept for one direction of a connection. */
+struct http_hpack_table {
+	/** Entry names and values, oldest entry first. */
+	uint8_t data[HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE];
+
+	/** Name and value lengths of the entries, oldest entry first. */
+	struct {
+		uint16_t name_len;
+		uint16_t value_len;
+	} entries[HTTP_HPACK_DYNAMIC_TABLE_ENTRIES];
+
+	/** Number of entries in the table. */
+	uint16_t count;
+
+	/** Length of the data in the data buffer. */
+	uint16_t datalen;
+
+	/** Table size, including the per entry overhead. */
+	uint16_t size;
+
+	/** Maximum table size currently in effect. */
+	uint16_t max_size;
+
+	/** Encoder only, maximum size change to signal to the decoder. */
+	bool size_update;
+};
+
 /** @cond INTERNAL_HIDDEN */
 
+void http_hpack_table_init(struct http_hpack_table *table, size_t max_size);
+void http_hpack_table_set_max_size(struct http_hpack_table *table,
+				   size_t max_size);
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_decode_header(const uint8_t *buf, size_t datalen,
-			     struct http_hpack_header_buf *header);
+			     struct http_hpack_header_buf *header,
+			     struct http_hpack_table *table);
 int http_hpack_encode_header(uint8_t *buf, size_t buflen,
-			     struct http_hpack_header_buf *header);
+			     struct http_hpack_header_buf *header,
+			     struct http_hpack_table *table);
 
 /** @endcond */
 
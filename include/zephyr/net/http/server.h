@@ -112,6 +112,11 @@ struct http_resource_detail_static {
 
 	/** Size of the static resource. */
 	size_t static_data_len;
+
+/** @cond INTERNAL_HIDDEN */
+	/** Entity tag of the resource, computed when first served. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_STATIC_ETAG, (uint32_t etag;))
+/** @endcond */
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -312,6 +317,7 @@ enum http1_parser_state {
 };
 
 #define HTTP_SERVER_INITIAL_WINDOW_SIZE 65536
+#define HTTP2_DEFAULT_HEADER_TABLE_SIZE 4096
 #define HTTP_SERVER_WS_MAX_SEC_KEY_LEN 32
 
 /** @endcond */
@@ -406,6 +412,12 @@ struct http_client_ctx {
 	/** HTTP/2 header parser context. */
 	struct http_hpack_header_buf header_field;
 
+	/** HTTP/2 HPACK dynamic table used to decode request headers. */
+	struct http_hpack_table decoder_table;
+
+	/** HTTP/2 HPACK dynamic table used to encode response headers. */
+	struct http_hpack_table encoder_table;
+
 	/** HTTP/2 streams context. */
 	struct http2_stream_ctx streams[HTTP_SERVER_MAX_STREAMS];
 
@@ -451,6 +463,10 @@ struct http_client_ctx {
 /** @cond INTERNAL_HIDDEN */
 	/** Websocket security key. */
 	IF_ENABLED(CONFIG_WEBSOCKET, (uint8_t ws_sec_key[HTTP_SERVER_WS_MAX_SEC_KEY_LEN]));
+
+	/** Value of the If-None-Match request header (HTTP/1 only). */
+	IF_ENABLED(CONFIG_HTTP_SERVER_STATIC_ETAG,
+		   (char if_none_match[HTTP_SERVER_MAX_HEADER_LEN]));
 /** @endcond */
 
 	/** Flag indicating that HTTP2 preface was sent. */
@@ -473,6 +489,15 @@ struct http_client_ctx {
 
 	/** The next frame on the stream is expectd to be a continuation frame. */
 	bool expect_continuation : 1;
+
+	/** Flag indicating If-None-Match header is being processed. */
+	bool if_none_match_next : 1;
+
+	/** Flag indicating Accept-Encoding header is being processed. */
+	bool accept_encoding_next : 1;
+
+	/** Flag indicating the client accepts gzip encoded content (HTTP/1 only). */
+	bool accept_gzip : 1;
 };
 
 #if defined(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)
@@ -30,6 +30,7 @@
 #include <zephyr/net/net_ip.h>
 #include <zephyr/sys/mutex.h>
 #include <zephyr/net/websocket.h>
+#include <zephyr/net_buf.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -485,6 +486,14 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if CONFIG_MQTT_PUBLISH_INFLIGHT_MAX > 0
+	/** Internal. Message IDs of the unacknowledged QoS 1 and 2 publishes. */
+	uint16_t inflight[CONFIG_MQTT_PUBLISH_INFLIGHT_MAX];
+
+	/** Internal. Number of used entries in the in-flight table. */
+	uint8_t inflight_count;
+#endif
 };
 
 /**
@@ -627,6 +636,26 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish a message with its payload held in a net_buf.
+ *
+ * Same as @ref mqtt_publish, but the payload is sent directly from the
+ * fragments of @p payload, without copying. The payload fields of
+ * @p param are ignored.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL.
+ * @param[in] payload Message payload, can be fragmented. Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -EMSGSIZE if the payload has too many fragments.
+ */
+int mqtt_publish_net_buf(struct mqtt_client *client,
+			 const struct mqtt_publish_param *param,
+			 struct net_buf *payload);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
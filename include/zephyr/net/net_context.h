@@ -288,6 +288,16 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_ZVFS_EPOLL)
+	/** Event poll entry to notify when the socket becomes readable */
+	struct zvfs_epoll_entry *epoll_entry;
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	/** Memory-mapped receive ring of a packet socket */
+	struct zpacket_rx_ring *rx_ring;
+#endif
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
@@ -365,6 +375,10 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
 		/** Enable RX, TX or both timestamps of packets send through sockets. */
 		uint8_t timestamping;
+#endif
+#if defined(CONFIG_NET_UDP_GSO)
+		/** Payload size of the datagrams large UDP sends are split into */
+		uint16_t udp_segment;
 #endif
 	} options;
 
@@ -1292,6 +1306,7 @@ enum net_context_option {
 	NET_OPT_TTL               = 16, /**< IPv4 unicast TTL */
 	NET_OPT_ADDR_PREFERENCES  = 17, /**< IPv6 address preference */
 	NET_OPT_TIMESTAMPING      = 18, /**< Packet timestamping */
+	NET_OPT_UDP_SEGMENT       = 19, /**< UDP segmentation size */
 };
 
 /**
@@ -607,6 +607,14 @@ struct net_traffic_class {
 
 	/** Stack for this handler */
 	k_thread_stack_t *stack;
+
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+	/** Bytes of the Tx packets queued or being sent */
+	atomic_t queued_bytes;
+
+	/** Signaled when queued packets have been sent */
+	struct k_sem space;
+#endif
 };
 
 /**
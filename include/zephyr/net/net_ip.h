@@ -257,6 +257,12 @@ struct msghdr {
 	int           msg_flags;      /**< Flags on received message */
 };
 
+/** Message struct for sending or receiving several messages in one call */
+struct mmsghdr {
+	struct msghdr msg_hdr;        /**< Message header */
+	unsigned int  msg_len;        /**< Number of bytes sent or received */
+};
+
 /** Control message ancillary data */
 struct cmsghdr {
 	socklen_t cmsg_len;    /**< Number of bytes, including header */
@@ -1732,6 +1738,21 @@ int net_bytes_from_str(uint8_t *buf, int buf_len, const char *src);
  */
 int net_tx_priority2tc(enum net_priority prio);
 
+/**
+ * @brief Map the Tx traffic class of a packet priority to a hardware Tx queue.
+ *
+ * Meant for drivers with several hardware Tx queues (DMA rings). The Tx
+ * traffic classes are spread over the hardware queues in order, so that
+ * packets of a higher class are never stuck behind bulk traffic of a lower
+ * class in the same ring, and each Tx thread can feed its own ring.
+ *
+ * @param prio Network priority
+ * @param queue_count Number of hardware Tx queues, must be greater than 0
+ *
+ * @return Hardware Tx queue index, from 0 to @p queue_count - 1.
+ */
+int net_tx_priority2queue(enum net_priority prio, int queue_count);
+
 /**
  * @brief Convert Rx network packet priority to traffic class so we can place
  * the packet into correct Rx queue.
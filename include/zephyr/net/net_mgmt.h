@@ -176,6 +176,8 @@ struct net_mgmt_event_callback {
 		 * be made of an exact match. This means that in order to
 		 * receive events from multiple layers, one must have multiple
 		 * listeners registered, one for each layer being listened.
+		 * The layer and layer code must not be changed while the
+		 * callback is registered.
 		 */
 		uint32_t event_mask;
 		/** Internal place holder when a synchronous event wait is
@@ -264,6 +266,26 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb);
 #define net_mgmt_add_event_callback(...)
 #endif
 
+/**
+ * @brief Add a user callback run from the context notifying the event
+ *
+ * Unlike the callbacks added with net_mgmt_add_event_callback(), the
+ * handler is not deferred to the network event thread or work queue. It is
+ * called by net_mgmt_event_notify_with_info() itself, before the event is
+ * queued for the other callbacks, so it is meant for latency critical
+ * listeners. The handler must be short and must not block, as it runs with
+ * whatever locks the notifier holds. The info of the event is not copied,
+ * it is only valid during the call. Use net_mgmt_del_event_callback() to
+ * delete the callback.
+ *
+ * @param cb A valid pointer on user's callback to add.
+ */
+#ifdef CONFIG_NET_MGMT_EVENT
+void net_mgmt_add_direct_event_callback(struct net_mgmt_event_callback *cb);
+#else
+#define net_mgmt_add_direct_event_callback(...)
+#endif
+
 /**
  * @brief Delete a user callback
  * @param cb A valid pointer on user's callback to delete.
@@ -292,8 +292,23 @@ struct net_pkt {
 	/** IPv4/IPv6 Explicit Congestion Notification value. */
 	uint8_t ip_ecn : 2;
 #endif /* CONFIG_NET_IP_DSCP_ECN */
+
+#if defined(CONFIG_NET_GSO)
+	/* Payload size of the TCP segments or UDP datagrams this packet
+	 * is to be split into by the L2 or the device, 0 if no segmentation
+	 * is needed.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_GSO */
 #endif /* CONFIG_NET_IP */
 
+#if defined(CONFIG_NET_RX_RSS)
+	/* Flow hash of a received packet given by the driver, for example
+	 * the RSS hash computed by the device, 0 if not known.
+	 */
+	uint32_t rx_hash;
+#endif /* CONFIG_NET_RX_RSS */
+
 #if defined(CONFIG_NET_VLAN)
 	/* VLAN TCI (Tag Control Information). This contains the Priority
 	 * Code Point (PCP), Drop Eligible Indicator (DEI) and VLAN
@@ -511,6 +526,48 @@ static inline void net_pkt_set_chksum_done(struct net_pkt *pkt,
 	pkt->chksum_done = is_chksum_done;
 }
 
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_GSO)
+	return pkt->gso_size;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+#if defined(CONFIG_NET_GSO)
+	pkt->gso_size = size;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+#endif
+}
+
+static inline uint32_t net_pkt_rx_hash(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_RX_RSS)
+	return pkt->rx_hash;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_rx_hash(struct net_pkt *pkt, uint32_t hash)
+{
+#if defined(CONFIG_NET_RX_RSS)
+	pkt->rx_hash = hash;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(hash);
+#endif
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -1682,6 +1739,17 @@ struct net_buf *net_pkt_get_frag(struct net_pkt *pkt, size_t min_len,
 void net_pkt_unref(struct net_pkt *pkt);
 #endif
 
+/**
+ * @brief Release a batch of packets
+ *
+ * Same as calling net_pkt_unref() on each packet of the array, NULL
+ * entries are skipped.
+ *
+ * @param pkts Array of network packets to release.
+ * @param count Number of entries in @p pkts.
+ */
+void net_pkt_unref_bulk(struct net_pkt **pkts, size_t count);
+
 #if !defined(NET_PKT_DEBUG_ENABLED)
 /**
  * @brief Increase the packet ref count
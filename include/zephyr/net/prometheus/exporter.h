@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROMETHEUS_EXPORTER_H_
+#define ZEPHYR_INCLUDE_PROMETHEUS_EXPORTER_H_
+
+/**
+ * @file
+ *
+ * @brief Prometheus exporter for built-in system metrics.
+ *
+ * @addtogroup prometheus
+ * @{
+ */
+
+#include <zephyr/net/prometheus/collector.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+
+#include <stddef.h>
+
+/**
+ * @brief Context of an incremental exposition of the system metrics
+ */
+struct prometheus_exporter_ctx {
+	/** Metric family being formatted */
+	size_t family;
+	/** Next sample of the family, -1 for its HELP and TYPE lines */
+	int sample;
+};
+
+/**
+ * @brief Start a new exposition of the system metrics
+ *
+ * Resets the context and takes a snapshot of the statistics that are
+ * read as a whole, like the network statistics.
+ *
+ * @param ctx Exposition context.
+ */
+void prometheus_exporter_format_start(struct prometheus_exporter_ctx *ctx);
+
+/**
+ * @brief Format the next chunk of the system metrics
+ *
+ * Formats as many whole samples as fit into the buffer. Kernel objects are
+ * looked up one at a time, so the whole exposition never has to fit into
+ * one buffer.
+ *
+ * @param ctx Exposition context, see @ref prometheus_exporter_format_start.
+ * @param buffer Pointer to the buffer where the formatted data will be stored.
+ * @param buffer_size Size of the buffer.
+ *
+ * @return Number of bytes written, 0 when all metrics were formatted,
+ *         negative errno on error.
+ * @retval -ENOMEM A single line does not fit into the buffer.
+ */
+int prometheus_exporter_format_next(struct prometheus_exporter_ctx *ctx, char *buffer,
+				    size_t buffer_size);
+
+/**
+ * @brief HTTP dynamic resource callback serving the metrics
+ *
+ * Sends the metrics of the collector passed as user data, if any, followed
+ * by the system metrics. The response is sent in chunks of
+ * CONFIG_PROMETHEUS_EXPORTER_CHUNK_SIZE bytes.
+ *
+ * See @ref http_resource_dynamic_cb_t for the parameters.
+ */
+int prometheus_exporter_http_handler(struct http_client_ctx *client, enum http_data_status status,
+				     uint8_t *buffer, size_t len,
+				     struct http_response_ctx *response_ctx, void *user_data);
+
+/**
+ * @brief Define an HTTP resource serving the metrics
+ *
+ * @param _name Name of the resource.
+ * @param _service HTTP service to attach the resource to.
+ * @param _path URL path of the resource, usually "/metrics".
+ * @param _collector Collector with application metrics, or NULL.
+ */
+#define PROMETHEUS_EXPORTER_HTTP_RESOURCE_DEFINE(_name, _service, _path, _collector)              \
+	static struct http_resource_detail_dynamic _name##_detail = {                              \
+		.common = {                                                                        \
+			.type = HTTP_RESOURCE_TYPE_DYNAMIC,                                        \
+			.bitmask_of_supported_http_methods = BIT(HTTP_GET),                        \
+			.content_type = "text/plain; version=0.0.4",                               \
+		},                                                                                 \
+		.cb = prometheus_exporter_http_handler,                                            \
+		.user_data = (void *)(_collector),                                                 \
+	};                                                                                         \
+	HTTP_RESOURCE_DEFINE(_name, _service, _path, &_name##_detail)
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_PROMETHEUS_EXPORTER_H_ */
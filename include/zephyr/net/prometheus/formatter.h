@@ -33,6 +33,27 @@
 int prometheus_format_exposition(const struct prometheus_collector *collector, char *buffer,
 				 size_t buffer_size);
 
+/**
+ * @brief Format exposition data for Prometheus in chunks
+ *
+ * Formats as many whole metrics of the collector as fit into the buffer,
+ * starting at the metric index stored in @p next, and advances @p next past
+ * them. Calling this until it returns 0 produces the same output as
+ * @ref prometheus_format_exposition without needing one buffer for the
+ * whole exposition.
+ *
+ * @param collector Pointer to the collector containing the data to format.
+ * @param next Index of the next metric to format, start with 0.
+ * @param buffer Pointer to the buffer where the formatted exposition data will be stored.
+ * @param buffer_size Size of the buffer.
+ *
+ * @return Number of bytes written, 0 when all metrics were formatted,
+ *         negative errno on error.
+ * @retval -ENOMEM A single metric does not fit into the buffer.
+ */
+int prometheus_format_exposition_next(const struct prometheus_collector *collector,
+				      size_t *next, char *buffer, size_t buffer_size);
+
 /**
  * @}
  */
@@ -236,6 +236,28 @@ extern "C" {
  *  will take place in consecutive send()/recv() call.
  */
 #define TLS_DTLS_HANDSHAKE_ON_CONNECT 18
+/** Socket option to control RFC 5077 session tickets on a TLS/DTLS server
+ *  socket. When enabled, the server issues session tickets to its clients and
+ *  resumes the sessions of the tickets presented to it, without keeping any
+ *  per-session state. Clients use tickets as part of @ref TLS_SESSION_CACHE.
+ *  Effective when set before the handshake. Accepted values:
+ *  - 0 - Disabled.
+ *  - 1 - Enabled.
+ */
+#define TLS_SESSION_TICKETS 19
+/** Socket option to coalesce small writes on a TLS socket into larger TLS
+ *  records. The option accepts an integer, the amount of data in bytes
+ *  accumulated before a record is written, up to
+ *  CONFIG_NET_SOCKETS_TLS_TX_COALESCE_SIZE. 0 (default) disables coalescing.
+ *  Coalesced data is also written out when the socket is read from, polled for
+ *  input or closed, and when @ref TLS_TX_FLUSH is set.
+ *  Not supported on DTLS sockets.
+ */
+#define TLS_TX_COALESCE 20
+/** Write-only socket option to write out the data coalesced on a TLS socket
+ *  immediately. This option accepts any value.
+ */
+#define TLS_TX_FLUSH 21
 
 /* Valid values for @ref TLS_PEER_VERIFY option */
 #define TLS_PEER_VERIFY_NONE 0     /**< Peer verification disabled. */
@@ -254,6 +276,10 @@ extern "C" {
 #define TLS_SESSION_CACHE_DISABLED 0 /**< Disable TLS session caching. */
 #define TLS_SESSION_CACHE_ENABLED 1 /**< Enable TLS session caching. */
 
+/* Valid values for @ref TLS_SESSION_TICKETS option */
+#define TLS_SESSION_TICKETS_DISABLED 0 /**< Do not issue session tickets. */
+#define TLS_SESSION_TICKETS_ENABLED 1 /**< Issue session tickets. */
+
 /* Valid values for @ref TLS_DTLS_CID (Connection ID) option */
 #define TLS_DTLS_CID_DISABLED		0 /**< CID is disabled  */
 #define TLS_DTLS_CID_SUPPORTED		1 /**< CID is supported */
@@ -496,6 +522,28 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages in one call
+ *
+ * @details
+ * Sends the messages of @p msgvec in order, as if @ref zsock_sendmsg was
+ * called for each of them, but the socket is looked up and locked only
+ * once. The number of bytes sent for each message is stored into its
+ * @c msg_len field. Sending stops at the first message that fails.
+ * This function is also exposed as ``sendmmsg()``
+ * if :kconfig:option:`CONFIG_POSIX_API` is defined.
+ *
+ * @param sock Socket descriptor.
+ * @param msgvec Array of messages.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags, as for @ref zsock_sendmsg.
+ *
+ * @return Number of messages sent, or -1 with errno set if not even the
+ *         first one could be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -526,6 +574,69 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages in one call
+ *
+ * @details
+ * Receives up to @p vlen messages into @p msgvec, as if @ref zsock_recvmsg
+ * was called for each of them, but the socket is looked up and locked only
+ * once. Only the first message is waited for according to @p flags, the
+ * following ones are received with ZSOCK_MSG_DONTWAIT, so the call returns
+ * once the queued messages are consumed. The number of bytes received for
+ * each message is stored into its @c msg_len field.
+ * This function is also exposed as ``recvmmsg()``
+ * if :kconfig:option:`CONFIG_POSIX_API` is defined.
+ *
+ * @param sock Socket descriptor.
+ * @param msgvec Array of messages.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Flags, as for @ref zsock_recvmsg.
+ *
+ * @return Number of messages received, or -1 with errno set if not even
+ *         the first one could be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+struct net_pkt;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Takes the next received packet of the socket instead of copying its data
+ * into a user buffer. The packet cursor points to the first byte of data,
+ * the data is in the fragments from @c pkt->cursor.buf onwards. The packet
+ * must be given back with @ref zsock_recv_pkt_release once the data has
+ * been consumed, until then its buffers are not available to the network
+ * stack.
+ *
+ * For datagram sockets one packet is one datagram. For stream sockets the
+ * packet holds the next segment of the stream, the receive window is
+ * updated as soon as it is taken.
+ *
+ * Only callable from supervisor mode, as the network buffers are not
+ * accessible from user mode.
+ *
+ * @param sock Socket descriptor.
+ * @param pkt Where to store the packet, NULL at the end of the stream.
+ * @param flags Only ZSOCK_MSG_DONTWAIT is supported.
+ * @param src_addr Source address of a datagram, can be NULL.
+ * @param addrlen Length of @p src_addr, value-result argument.
+ *
+ * @return Number of data bytes in the packet, 0 at the end of the stream,
+ *         or -1 with errno set.
+ */
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **pkt, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release a packet returned by @ref zsock_recv_pkt
+ *
+ * @param pkt Packet to release, can be NULL.
+ */
+void zsock_recv_pkt_release(struct net_pkt *pkt);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -946,6 +1057,13 @@ static inline ssize_t sendmsg(int sock, const struct msghdr *message,
 	return zsock_sendmsg(sock, message, flags);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			   int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_recvfrom */
 static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 			       struct sockaddr *src_addr, socklen_t *addrlen)
@@ -959,6 +1077,18 @@ static inline ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
 	return zsock_recvmsg(sock, msg, flags);
 }
 
+/** POSIX wrapper for @ref zsock_recvmmsg, the timeout is not supported */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			   int flags, struct timespec *timeout)
+{
+	if (timeout != NULL) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
@@ -1214,6 +1344,83 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Name of the congestion control algorithm (string) */
+#define TCP_CONGESTION 13
+
+/** @} */
+
+/**
+ * @name UDP level options (IPPROTO_UDP)
+ * @{
+ */
+/* Socket options for IPPROTO_UDP level */
+/** Split large sends into datagrams of this payload size (int, 0 disables) */
+#define UDP_SEGMENT 103
+
+/** @} */
+
+/**
+ * @name Packet socket level options (SOL_PACKET)
+ * @{
+ */
+/** Socket option level for packet sockets */
+#define SOL_PACKET 263
+
+/* Socket options for SOL_PACKET level */
+/** Set up a memory-mapped receive ring (struct tpacket_req), kept until close() */
+#define PACKET_RX_RING 5
+/** Read and reset the receive ring counters (struct tpacket_stats) */
+#define PACKET_STATISTICS 6
+
+/** Receive ring frame is owned by the network stack */
+#define TP_STATUS_KERNEL 0
+/** Receive ring frame holds a packet for the application */
+#define TP_STATUS_USER   BIT(0)
+/** Packet was truncated to fit in the frame */
+#define TP_STATUS_COPY   BIT(1)
+/** Packets were dropped before this one because the ring was full */
+#define TP_STATUS_LOSING BIT(2)
+
+/** Alignment of the frames and of the data within a frame */
+#define TPACKET_ALIGNMENT 16
+/** Align a frame offset to @ref TPACKET_ALIGNMENT */
+#define TPACKET_ALIGN(x) (((x) + TPACKET_ALIGNMENT - 1) & ~(TPACKET_ALIGNMENT - 1))
+
+/**
+ * Receive ring layout, given to the PACKET_RX_RING socket option.
+ * The ring consists of tp_block_nr blocks of tp_block_size bytes, each
+ * holding a whole number of frames of tp_frame_size bytes.
+ */
+struct tpacket_req {
+	unsigned int tp_block_size; /**< Size of a block in bytes */
+	unsigned int tp_block_nr;   /**< Number of blocks */
+	unsigned int tp_frame_size; /**< Size of a frame in bytes */
+	unsigned int tp_frame_nr;   /**< Total number of frames */
+};
+
+/**
+ * Header at the start of every receive ring frame. It is followed by the
+ * struct sockaddr_ll of the packet source, the packet data starts at
+ * tp_mac bytes from the frame start.
+ */
+struct tpacket_hdr {
+	unsigned long tp_status;  /**< TP_STATUS_* flags, owner of the frame */
+	unsigned int tp_len;      /**< Length of the packet */
+	unsigned int tp_snaplen;  /**< Length of the data stored in the frame */
+	unsigned short tp_mac;    /**< Offset of the link layer header */
+	unsigned short tp_net;    /**< Offset of the network layer header */
+	unsigned int tp_sec;      /**< Reception time, seconds */
+	unsigned int tp_usec;     /**< Reception time, microseconds */
+};
+
+/** Size of the headers at the start of every receive ring frame */
+#define TPACKET_HDRLEN (TPACKET_ALIGN(sizeof(struct tpacket_hdr)) + sizeof(struct sockaddr_ll))
+
+/** Receive ring counters, read with the PACKET_STATISTICS socket option */
+struct tpacket_stats {
+	unsigned int tp_packets; /**< Number of packets received */
+	unsigned int tp_drops;   /**< Number of packets dropped as the ring was full */
+};
 
 /** @} */
 
@@ -26,6 +26,7 @@
 
 #include <sys/types.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/net/socket.h>
 
 #ifdef __cplusplus
@@ -55,6 +56,10 @@ struct net_socket_service_event {
 	void *user_data;
 	/** Service back pointer */
 	struct net_socket_service_desc *svc;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	/** Node in the queue of the events waiting for a worker thread */
+	sys_snode_t node;
+#endif
 };
 
 /**
@@ -79,8 +84,14 @@ struct net_socket_service_desc {
 	struct net_socket_service_event *pev;
 	/** Length of the pollable socket array for this service. */
 	int pev_len;
-	/** Where are my pollfd entries in the global list */
+	/** Where are my pollfd entries in the global list, or whether the
+	 * handler is running when the handlers are run in worker threads.
+	 */
 	int *idx;
+	/** Priority of the handler when it is queued for a worker thread,
+	 * a lower value runs first.
+	 */
+	int priority;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -95,7 +106,7 @@ struct net_socket_service_desc {
 #define NET_SOCKET_SERVICE_OWNER
 #endif
 
-#define __z_net_socket_service_define(_name, _cb, _count, ...) \
+#define __z_net_socket_service_define(_name, _cb, _count, _prio, ...) \
 	static int __z_net_socket_svc_get_idx(_name);			\
 	static struct net_socket_service_event				\
 			__z_net_socket_svc_get_name(_name)[_count] = {	\
@@ -110,6 +121,7 @@ struct net_socket_service_desc {
 		.pev = __z_net_socket_svc_get_name(_name),		\
 		.pev_len = (_count),					\
 		.idx = &__z_net_socket_svc_get_idx(_name),		\
+		.priority = (_prio),					\
 	}
 
 /** @endcond */
@@ -133,7 +145,7 @@ struct net_socket_service_desc {
  * @param count How many pollable sockets is needed for this service.
  */
 #define NET_SOCKET_SERVICE_SYNC_DEFINE(name, cb, count)	\
-	__z_net_socket_service_define(name, cb, count)
+	__z_net_socket_service_define(name, cb, count, 0)
 
 /**
  * @brief Statically define a network socket service in a private (static) scope.
@@ -146,7 +158,34 @@ struct net_socket_service_desc {
  * @param count How many pollable sockets is needed for this service.
  */
 #define NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(name, cb, count)	\
-	__z_net_socket_service_define(name, cb, count, static)
+	__z_net_socket_service_define(name, cb, count, 0, static)
+
+/**
+ * @brief Statically define a network socket service with a priority.
+ *        When CONFIG_NET_SOCKETS_SERVICE_DISPATCHER is enabled, the services
+ *        waiting for a worker thread are run in the order of their priority.
+ *        Otherwise this is the same as NET_SOCKET_SERVICE_SYNC_DEFINE.
+ *
+ * @param name Name of the service.
+ * @param cb Callback function that is called for socket activity.
+ * @param count How many pollable sockets is needed for this service.
+ * @param prio Priority of the service, a lower value runs first. The services
+ *        defined with NET_SOCKET_SERVICE_SYNC_DEFINE have priority 0.
+ */
+#define NET_SOCKET_SERVICE_PRIO_DEFINE(name, cb, count, prio)	\
+	__z_net_socket_service_define(name, cb, count, prio)
+
+/**
+ * @brief Statically define a network socket service with a priority in a
+ *        private (static) scope.
+ *
+ * @param name Name of the service.
+ * @param cb Callback function that is called for socket activity.
+ * @param count How many pollable sockets is needed for this service.
+ * @param prio Priority of the service, a lower value runs first.
+ */
+#define NET_SOCKET_SERVICE_PRIO_DEFINE_STATIC(name, cb, count, prio)	\
+	__z_net_socket_service_define(name, cb, count, prio, static)
 
 /**
  * @brief Register pollable sockets.
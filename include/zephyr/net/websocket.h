@@ -154,6 +154,32 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout);
 
+struct net_buf;
+
+/**
+ * @brief Send websocket msg to peer without copying the data.
+ *
+ * @details Same as websocket_send_msg(), but the payload is taken from the
+ * fragments of a network buffer, which are masked in place if @p mask is
+ * set. The content of the buffer must not be used after the call in that
+ * case. At most 8 non-empty fragments are supported.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param buf Network buffer holding the data to send, may be NULL.
+ * @param opcode Operation code (text, binary, ping, pong, close)
+ * @param mask Mask the data, see RFC 6455 for details
+ * @param final Is this final message for this message send.
+ * @param timeout How long to try to send the message. The value is in
+ *        milliseconds. Value SYS_FOREVER_MS means to wait forever.
+ *
+ * @retval >=0 amount of bytes sent.
+ * @retval -EMSGSIZE if the buffer has too many fragments.
+ * @retval -errno other negative errno value in case of failure.
+ */
+int websocket_send_net_buf(int ws_sock, struct net_buf *buf,
+			   enum websocket_opcode opcode, bool mask, bool final,
+			   int32_t timeout);
+
 /**
  * @brief Receive websocket msg from peer.
  *
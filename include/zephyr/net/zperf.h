@@ -40,6 +40,7 @@ struct zperf_upload_params {
 	uint32_t duration_ms;
 	uint32_t rate_kbps;
 	uint16_t packet_size;
+	uint8_t num_streams;
 	char if_name[IFNAMSIZ];
 	struct {
 		uint8_t tos;
@@ -69,6 +70,9 @@ struct zperf_results {
 	uint64_t client_time_in_us;   /**< Client connection time in microseconds */
 	uint32_t packet_size;         /**< Packet size */
 	uint32_t nb_packets_errors;   /**< Number of packet errors */
+	uint32_t latency_p50_us;      /**< Median packet delay variation in microseconds */
+	uint32_t latency_p99_us;      /**< 99th percentile of the delay variation */
+	uint32_t latency_p999_us;     /**< 99.9th percentile of the delay variation */
 };
 
 /**
@@ -86,6 +90,9 @@ typedef void (*zperf_callback)(enum zperf_status status,
  * @brief Synchronous UDP upload operation. The function blocks until the upload
  *        is complete.
  *
+ * If @p param requests more than one stream, each stream sends at the given
+ * rate from its own socket and the results are summed up.
+ *
  * @param param Upload parameters.
  * @param result Session results.
  *
@@ -98,6 +105,9 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
  * @brief Synchronous TCP upload operation. The function blocks until the upload
  *        is complete.
  *
+ * If @p param requests more than one stream, each stream uses its own
+ * connection and the results are summed up.
+ *
  * @param param Upload parameters.
  * @param result Session results.
  *
@@ -1396,6 +1396,24 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate a batch of new buffers from a pool.
+ *
+ * Allocates up to @p count buffers of at least @p size bytes. Only the
+ * allocation of the first buffer waits, the others are done with
+ * K_NO_WAIT, so that a batch never blocks with buffers already taken.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array receiving the buffers.
+ * @param count Number of buffers to allocate.
+ * @param timeout How long to wait for the first buffer.
+ *
+ * @return Number of buffers stored into @p bufs.
+ */
+int net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+		       struct net_buf **bufs, int count, k_timeout_t timeout);
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -130,6 +130,23 @@ typedef int (*pm_device_action_cb_t)(const struct device *dev,
 typedef bool (*pm_device_action_failed_cb_t)(const struct device *dev,
 					 int err);
 
+/**
+ * @brief Device runtime PM statistics
+ *
+ * Resume latencies are measured around the PM action callback, in hardware
+ * cycles (see k_cycle_get_32()).
+ */
+struct pm_device_runtime_stats {
+	/** Number of runtime resumes */
+	uint32_t resume_count;
+	/** Duration of the last resume */
+	uint32_t resume_last_cyc;
+	/** Duration of the longest resume */
+	uint32_t resume_max_cyc;
+	/** Sum of all resume durations */
+	uint64_t resume_total_cyc;
+};
+
 /**
  * @brief Device PM info
  *
@@ -147,6 +164,10 @@ struct pm_device_base {
 	/** Device usage count */
 	uint32_t usage;
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
+#if defined(CONFIG_PM_DEVICE_RUNTIME_STATS) || defined(__DOXYGEN__)
+	/** Runtime PM statistics */
+	struct pm_device_runtime_stats stats;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
 	const struct device *domain;
@@ -22,6 +22,9 @@ extern "C" {
  * @{
  */
 
+/** Maximum number of devices in a batched runtime PM transition. */
+#define PM_DEVICE_RUNTIME_BATCH_MAX 32
+
 #if defined(CONFIG_PM_DEVICE_RUNTIME) || defined(__DOXYGEN__)
 /**
  * @brief Automatically enable device runtime based on devicetree properties
@@ -169,6 +172,62 @@ bool pm_device_runtime_is_enabled(const struct device *dev);
  */
 int pm_device_runtime_usage(const struct device *dev);
 
+/**
+ * @brief Resume a group of devices.
+ *
+ * Equivalent to calling pm_device_runtime_get() on every device of the group.
+ * With @kconfig{CONFIG_PM_DEVICE_RUNTIME_BATCH_THREADS} set, the devices are
+ * resumed in parallel by the calling thread and a set of helper threads, so
+ * that the resume latency of independent devices overlaps. Devices sharing a
+ * power domain are serialized on the domain, which is resumed once by the
+ * first of them; dependency chains are hence resumed in a single pass.
+ *
+ * If any device fails to resume, the devices of the group that were resumed
+ * are put back, leaving all usage counts unchanged.
+ *
+ * @param devs Devices to resume.
+ * @param count Number of devices, at most @ref PM_DEVICE_RUNTIME_BATCH_MAX.
+ *
+ * @retval 0 If it succeeds.
+ * @retval -EINVAL If @p count is too large.
+ * @retval -errno Error of the first device that failed to resume.
+ *
+ * @see pm_device_runtime_get()
+ */
+int pm_device_runtime_get_batch(const struct device *const *devs, size_t count);
+
+/**
+ * @brief Suspend a group of devices based on usage count.
+ *
+ * Equivalent to calling pm_device_runtime_put() on every device of the group,
+ * in parallel as for pm_device_runtime_get_batch(). All devices are put even
+ * if some of them fail.
+ *
+ * @param devs Devices to suspend.
+ * @param count Number of devices, at most @ref PM_DEVICE_RUNTIME_BATCH_MAX.
+ *
+ * @retval 0 If it succeeds.
+ * @retval -EINVAL If @p count is too large.
+ * @retval -errno Error of the first device that failed to suspend.
+ *
+ * @see pm_device_runtime_put()
+ */
+int pm_device_runtime_put_batch(const struct device *const *devs, size_t count);
+
+#if defined(CONFIG_PM_DEVICE_RUNTIME_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the runtime PM statistics of a device.
+ *
+ * @param dev Device instance.
+ * @param stats Where to store the statistics.
+ *
+ * @retval 0 If it succeeds.
+ * @retval -ENOTSUP If the device is not using runtime PM.
+ */
+int pm_device_runtime_stats_get(const struct device *dev,
+				struct pm_device_runtime_stats *stats);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
 #else
 
 static inline int pm_device_runtime_auto_enable(const struct device *dev)
@@ -221,6 +280,22 @@ static inline int pm_device_runtime_usage(const struct device *dev)
 	return -ENOSYS;
 }
 
+static inline int pm_device_runtime_get_batch(const struct device *const *devs,
+					      size_t count)
+{
+	ARG_UNUSED(devs);
+	ARG_UNUSED(count);
+	return 0;
+}
+
+static inline int pm_device_runtime_put_batch(const struct device *const *devs,
+					      size_t count)
+{
+	ARG_UNUSED(devs);
+	ARG_UNUSED(count);
+	return 0;
+}
+
 #endif
 
 /** @} */
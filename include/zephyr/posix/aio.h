@@ -25,6 +25,20 @@ struct aiocb {
 	int aio_lio_opcode;
 };
 
+/* aio_cancel() return values */
+#define AIO_CANCELED    0
+#define AIO_NOTCANCELED 1
+#define AIO_ALLDONE     2
+
+/* lio_listio() operations */
+#define LIO_READ  0
+#define LIO_WRITE 1
+#define LIO_NOP   2
+
+/* lio_listio() modes */
+#define LIO_WAIT   0
+#define LIO_NOWAIT 1
+
 #if _POSIX_C_SOURCE >= 200112L
 
 int aio_cancel(int fildes, struct aiocb *aiocbp);
@@ -43,6 +43,38 @@ int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 		 unsigned int msg_prio, const struct timespec *abstime);
 int mq_notify(mqd_t mqdes, const struct sigevent *notification);
 
+/**
+ * @brief Receive a message from a message queue without copying it.
+ *
+ * Like mq_timedreceive(), but instead of copying the message, return a
+ * pointer to it inside the queue. The message stays valid and its slot
+ * stays unavailable to senders until it is given back with
+ * mq_release_np().
+ *
+ * This is a Zephyr extension.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Set to the message.
+ * @param msg_prio If not NULL, set to the message priority.
+ * @param abstime Absolute timeout, NULL to wait forever.
+ *
+ * @return Message length on success, -1 with errno set on error.
+ */
+int mq_borrow_np(mqd_t mqdes, const char **msg_ptr, unsigned int *msg_prio,
+		 const struct timespec *abstime);
+
+/**
+ * @brief Give back a message obtained with mq_borrow_np().
+ *
+ * This is a Zephyr extension.
+ *
+ * @param mqdes Message queue descriptor.
+ * @param msg_ptr Message returned by mq_borrow_np().
+ *
+ * @return 0 on success, -1 with errno set on error.
+ */
+int mq_release_np(mqd_t mqdes, const char *msg_ptr);
+
 #ifdef __cplusplus
 }
 #endif
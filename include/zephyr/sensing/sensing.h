@@ -273,6 +273,28 @@ int sensing_get_config(
 		sensing_sensor_handle_t handle,
 		struct sensing_sensor_config *configs, int count);
 
+/**
+ * @brief Keep a sensor data buffer after the data event callback returns.
+ *
+ * Must be called from the @ref sensing_data_event_t callback @p buf was passed
+ * to. Every successful call must be balanced by @ref sensing_data_unref.
+ * Requires CONFIG_SENSING_DISPATCH_DATA_REFS.
+ *
+ * @param buf The data buffer passed to the callback.
+ * @return 0 on success.
+ * @return -EINVAL if @p buf is not a sensor data buffer in use.
+ */
+int sensing_data_ref(const void *buf);
+
+/**
+ * @brief Drop a reference taken with @ref sensing_data_ref.
+ *
+ * The buffer must not be used anymore once the reference is dropped.
+ *
+ * @param buf The data buffer.
+ */
+void sensing_data_unref(const void *buf);
+
 /**
  * @brief Get sensor information from sensor instance handle.
  *
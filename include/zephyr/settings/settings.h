@@ -383,6 +383,55 @@ int settings_commit(void);
  */
 int settings_commit_subtree(const char *subtree);
 
+/**
+ * Start a transaction. Values saved with @ref settings_txn_save until
+ * @ref settings_txn_commit are written together.
+ *
+ * Requires CONFIG_SETTINGS_TXN.
+ *
+ * @return 0 on success, -EBUSY if a transaction is already in progress.
+ */
+int settings_txn_begin(void);
+
+/**
+ * Stage a single serialized value in the current transaction. Staging a
+ * name twice keeps the last value.
+ *
+ * @param name Name/key of the settings item.
+ * @param value Pointer to the value of the settings item.
+ * @param val_len Length of the value.
+ *
+ * @return 0 on success, -EINVAL if no transaction is in progress,
+ * -ENOMEM if CONFIG_SETTINGS_TXN_BUF_SIZE is exceeded.
+ */
+int settings_txn_save(const char *name, const void *value, size_t val_len);
+
+/**
+ * Stage the deletion of a single serialized value in the current
+ * transaction.
+ *
+ * @param name Name/key of the settings item.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int settings_txn_delete(const char *name);
+
+/**
+ * Write all the values staged in the current transaction and end it.
+ *
+ * The staged values are first saved as a single journal record, which is
+ * replayed by the next load if the commit is interrupted. If the back-end
+ * cannot store the journal, the values are written without it.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int settings_txn_commit(void);
+
+/**
+ * Drop the values staged in the current transaction and end it.
+ */
+void settings_txn_abort(void);
+
 /**
  * @} settings
  */
@@ -41,6 +41,121 @@
 	IF_ENABLED(CONFIG_SMF_INITIAL_TRANSITION, (.initial = _initial,))  \
 }
 
+/**
+ * @brief Macro to define a table of hierarchical states with precomputed
+ *        ancestors.
+ *
+ * Defines <tt>static const struct smf_state _name[]</tt>, indexed by the
+ * IDs of its states. Every state lists its ancestors, from the topmost one,
+ * in a constant array built at compile time. Transitions between such
+ * states find the least common ancestor by comparing these arrays and the
+ * states to enter by indexing them, instead of walking parent pointers.
+ *
+ * Each state is described by @ref SMF_TABLE_STATE. Its parent and initial
+ * transition are given by ID, or SMF_NONE, and parents must come before
+ * their children in the list. For example:
+ *
+ * @code{.c}
+ * enum demo_state { S0, S1, S2 };
+ *
+ * SMF_STATE_TABLE_DEFINE(demo_states,
+ *	SMF_TABLE_STATE(S0, s0_entry, s0_run, s0_exit, SMF_NONE, S2),
+ *	SMF_TABLE_STATE(S1, s1_entry, s1_run, s1_exit, S0, SMF_NONE),
+ *	SMF_TABLE_STATE(S2, s2_entry, s2_run, s2_exit, S0, SMF_NONE));
+ * @endcode
+ *
+ * @note Requires @kconfig{CONFIG_SMF_STATE_TABLES}. The IDs must be
+ *       enumerators from 0 to the number of states minus one, and a state
+ *       can have at most @kconfig{CONFIG_SMF_STATE_TABLES_MAX_DEPTH} - 1
+ *       ancestors.
+ *
+ * @param _name Name of the table
+ * @param ...   States, in @ref SMF_TABLE_STATE form
+ */
+#define SMF_STATE_TABLE_DEFINE(_name, ...)                                                         \
+	static const struct smf_state _name[NUM_VA_ARGS(__VA_ARGS__)];                             \
+	enum {                                                                                     \
+		Z_SMF_TBL_NONE_ENUMS(_name),                                                       \
+		FOR_EACH_FIXED_ARG(Z_SMF_TBL_ENUMS, (,), _name, __VA_ARGS__)                       \
+	};                                                                                         \
+	FOR_EACH_FIXED_ARG(Z_SMF_TBL_PATH, (;), _name, __VA_ARGS__);                               \
+	static const struct smf_state _name[NUM_VA_ARGS(__VA_ARGS__)] = {                          \
+		FOR_EACH_FIXED_ARG(Z_SMF_TBL_STATE, (,), _name, __VA_ARGS__)                       \
+	}
+
+/**
+ * @brief Macro to describe a state of @ref SMF_STATE_TABLE_DEFINE.
+ *
+ * @param _id      State ID
+ * @param _entry   State entry function or NULL
+ * @param _run     State run function or NULL
+ * @param _exit    State exit function or NULL
+ * @param _parent  State parent ID or SMF_NONE
+ * @param _initial State initial transition ID or SMF_NONE
+ */
+#define SMF_TABLE_STATE(_id, _entry, _run, _exit, _parent, _initial)                               \
+	(_id, _entry, _run, _exit, _parent, _initial)
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Enumerator of property _prop of state _id, SMF_NONE being -1 everywhere */
+#define Z_SMF_TBL(_name, _id, _prop) _smf_##_name##_##_id##_##_prop
+
+/* Index of the ancestor of state _id at level _lvl, -1 if it is not that deep */
+#define Z_SMF_TBL_ANC(_name, _id, _lvl) _smf_##_name##_##_id##_anc_##_lvl
+
+#define Z_SMF_TBL_REF(_name, _idx)                                                                 \
+	(((_idx) < 0) ? NULL : &_name[((_idx) < 0) ? 0 : (_idx)])
+
+#define Z_SMF_TBL_NONE_ANC_ENUM(_lvl, _name)                                                       \
+	Z_SMF_TBL_ANC(_name, SMF_NONE, _lvl) = -1
+
+#define Z_SMF_TBL_NONE_ENUMS(_name)                                                                \
+	Z_SMF_TBL(_name, SMF_NONE, idx) = -1,                                                      \
+	Z_SMF_TBL(_name, SMF_NONE, depth) = -1,                                                    \
+	LISTIFY(CONFIG_SMF_STATE_TABLES_MAX_DEPTH, Z_SMF_TBL_NONE_ANC_ENUM, (,), _name)
+
+#define Z_SMF_TBL_ANC_ENUM(_lvl, _name, _id, _parent)                                              \
+	Z_SMF_TBL_ANC(_name, _id, _lvl) = (Z_SMF_TBL(_name, _id, depth) == (_lvl)) ?               \
+		Z_SMF_TBL(_name, _id, idx) : Z_SMF_TBL_ANC(_name, _parent, _lvl)
+
+#define Z_SMF_TBL_ENUMS(_state, _name) Z_SMF_TBL_ENUMS_I(_name, __DEBRACKET _state)
+#define Z_SMF_TBL_ENUMS_I(...) Z_SMF_TBL_ENUMS_II(__VA_ARGS__)
+#define Z_SMF_TBL_ENUMS_II(_name, _id, _entry, _run, _exit, _parent, _initial)                     \
+	Z_SMF_TBL(_name, _id, idx) = (_id),                                                        \
+	Z_SMF_TBL(_name, _id, depth) = Z_SMF_TBL(_name, _parent, depth) + 1,                       \
+	LISTIFY(CONFIG_SMF_STATE_TABLES_MAX_DEPTH, Z_SMF_TBL_ANC_ENUM, (,),                        \
+		_name, _id, _parent)
+
+#define Z_SMF_TBL_PATH_ENTRY(_lvl, _name, _id)                                                     \
+	Z_SMF_TBL_REF(_name, Z_SMF_TBL_ANC(_name, _id, _lvl))
+
+#define Z_SMF_TBL_PATH(_state, _name) Z_SMF_TBL_PATH_I(_name, __DEBRACKET _state)
+#define Z_SMF_TBL_PATH_I(...) Z_SMF_TBL_PATH_II(__VA_ARGS__)
+#define Z_SMF_TBL_PATH_II(_name, _id, ...)                                                         \
+	BUILD_ASSERT(Z_SMF_TBL(_name, _id, depth) < CONFIG_SMF_STATE_TABLES_MAX_DEPTH,             \
+		     "State " #_id " is deeper than CONFIG_SMF_STATE_TABLES_MAX_DEPTH");           \
+	static const struct smf_state *const Z_SMF_TBL(_name, _id, path)[] = {                     \
+		LISTIFY(CONFIG_SMF_STATE_TABLES_MAX_DEPTH, Z_SMF_TBL_PATH_ENTRY, (,),              \
+			_name, _id)                                                                \
+	}
+
+#define Z_SMF_TBL_STATE(_state, _name) Z_SMF_TBL_STATE_I(_name, __DEBRACKET _state)
+#define Z_SMF_TBL_STATE_I(...) Z_SMF_TBL_STATE_II(__VA_ARGS__)
+#define Z_SMF_TBL_STATE_II(_name, _id, _entry, _run, _exit, _parent, _initial)                     \
+	[_id] = {                                                                                  \
+		.entry = _entry,                                                                   \
+		.run = _run,                                                                       \
+		.exit = _exit,                                                                     \
+		.parent = Z_SMF_TBL_REF(_name, Z_SMF_TBL(_name, _parent, idx)),                    \
+		IF_ENABLED(CONFIG_SMF_INITIAL_TRANSITION, (.initial =                              \
+			Z_SMF_TBL_REF(_name, Z_SMF_TBL(_name, _initial, idx)),))                   \
+		.path = Z_SMF_TBL(_name, _id, path),                                               \
+		.depth = Z_SMF_TBL(_name, _id, depth),                                             \
+	}
+
+/** @endcond */
+
 /**
  * @brief Macro to cast user defined object to state machine
  *        context.
@@ -92,6 +207,16 @@ struct smf_state {
 	 */
 	const struct smf_state *initial;
 #endif /* CONFIG_SMF_INITIAL_TRANSITION */
+
+#ifdef CONFIG_SMF_STATE_TABLES
+	/**
+	 * Ancestors of the state from the topmost one, ending with the state
+	 * itself. NULL if not defined with SMF_STATE_TABLE_DEFINE().
+	 */
+	const struct smf_state *const *path;
+	/** Number of ancestors of the state */
+	uint8_t depth;
+#endif /* CONFIG_SMF_STATE_TABLES */
 #endif /* CONFIG_SMF_ANCESTOR_SUPPORT */
 };
 
@@ -151,6 +151,39 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Spin lock contention statistics of a CPU
+ */
+struct k_spin_stats {
+	/** Acquisitions that found the lock held */
+	uint32_t contended;
+	/** Cycles spent waiting for held locks */
+	uint64_t wait_cycles;
+};
+
+/**
+ * @brief Get the spin lock contention statistics of a CPU
+ *
+ * Only with @kconfig{CONFIG_SPIN_LOCK_STATS}.
+ *
+ * @param cpu CPU index
+ * @param stats Filled with the statistics
+ * @retval 0 on success
+ * @retval -EINVAL if @p cpu is out of range
+ */
+int k_spin_stats_get(unsigned int cpu, struct k_spin_stats *stats);
+
+/**
+ * @brief Reset the spin lock contention statistics of all CPUs
+ */
+void k_spin_stats_reset(void);
+
+/** @cond INTERNAL_HIDDEN */
+void z_spin_lock_stats_add(uint32_t cycles);
+/** @endcond */
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Lock a spinlock
  *
@@ -183,6 +216,10 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
 	k_spinlock_key_t k;
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Start of the wait, with bit 0 set once waiting */
+	uint32_t spin_start = 0U;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 
 	/* Note that we need to use the underlying arch-specific lock
 	 * implementation.  The "irq_lock()" API in SMP context is
@@ -200,13 +237,28 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	atomic_val_t ticket = atomic_inc(&l->tail);
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
+#ifdef CONFIG_SPIN_LOCK_STATS
+		if (spin_start == 0U) {
+			spin_start = sys_clock_cycle_get_32() | 1U;
+		}
+#endif /* CONFIG_SPIN_LOCK_STATS */
 		arch_spin_relax();
 	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+#ifdef CONFIG_SPIN_LOCK_STATS
+		if (spin_start == 0U) {
+			spin_start = sys_clock_cycle_get_32() | 1U;
+		}
+#endif /* CONFIG_SPIN_LOCK_STATS */
 		arch_spin_relax();
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
+#ifdef CONFIG_SPIN_LOCK_STATS
+	if (spin_start != 0U) {
+		z_spin_lock_stats_add(sys_clock_cycle_get_32() - spin_start);
+	}
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
 
@@ -46,14 +46,24 @@
  *     s<stat-idx>
  *
  * E.g., "s0", "s1", etc.
+ *
+ * When CONFIG_STATS_PER_CPU is defined, each group holds one copy of its
+ * entries per CPU.  Increments only touch the copy of the current CPU, and
+ * the copies are summed up when the statistics are read with stats_get() or
+ * STATS_GET().
  */
 
 #ifndef ZEPHYR_INCLUDE_STATS_STATS_H_
 #define ZEPHYR_INCLUDE_STATS_STATS_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <zephyr/types.h>
 
+#ifdef CONFIG_STATS_PER_CPU
+#include <zephyr/kernel/percpu.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -83,11 +93,6 @@ struct stats_hdr {
 #define STATS_SECT_DECL(group__) \
 	struct stats_ ## group__
 
-/**
- * @brief Ends a stats group struct definition.
- */
-#define STATS_SECT_END }
-
 /* The following macros depend on whether CONFIG_STATS is defined.  If it is
  * not defined, then invocations of these macros get compiled out.
  */
@@ -98,10 +103,52 @@ struct stats_hdr {
  *
  * @param group__               The stats group struct name.
  */
+#ifdef CONFIG_STATS_PER_CPU
+
+/* The entries are the type of the K_PERCPU_MEMBER() s_cpu, which is spread
+ * over STATS_SECT_START and STATS_SECT_END so that the entries can be
+ * declared in between.
+ */
+#define STATS_SECT_START(group__)  \
+	STATS_SECT_DECL(group__) { \
+		struct stats_hdr s_hdr; \
+		struct {		\
+			struct {
+
+/**
+ * @brief Ends a stats group struct definition.
+ *
+ * The entries of each CPU are kept in their own cache line(s).
+ */
+#define STATS_SECT_END \
+			} val; \
+		} __aligned(K_PERCPU_ALIGN) s_cpu[CONFIG_MP_MAX_NUM_CPUS]; }
+
+/* Entries of the CPU the caller runs on */
+#define STATS_SECT_LOCAL(group__) (*K_PERCPU_PTR((group__).s_cpu))
+
+/* Entries of a given CPU, STATS_SET() and STATS_CLEAR() update the first */
+#define STATS_SECT_CPU(group__, cpu__) (*K_PERCPU_CPU_PTR((group__).s_cpu, cpu__))
+
+/* Size of the entries of one CPU, without padding */
+#define STATS_SECT_SIZE(group__) (sizeof(STATS_SECT_CPU(group__, 0)))
+
+#else /* CONFIG_STATS_PER_CPU */
+
 #define STATS_SECT_START(group__)  \
 	STATS_SECT_DECL(group__) { \
 		struct stats_hdr s_hdr;
 
+/**
+ * @brief Ends a stats group struct definition.
+ */
+#define STATS_SECT_END }
+
+#define STATS_SECT_SIZE(group__) \
+	(sizeof(group__) - sizeof(struct stats_hdr))
+
+#endif /* CONFIG_STATS_PER_CPU */
+
 /**
  * @brief Declares a 32-bit stat entry inside a group struct.
  *
@@ -140,8 +187,44 @@ struct stats_hdr {
  * @param var__                 The statistic entry to increase.
  * @param n__                   The amount to increase the statistic entry by.
  */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_INCN(group__, var__, n__)				\
+	do {							\
+		unsigned int key__ = arch_irq_lock();		\
+								\
+		STATS_SECT_LOCAL(group__).var__ += (n__);	\
+		arch_irq_unlock(key__);				\
+	} while (false)
+#else
 #define STATS_INCN(group__, var__, n__)	\
 	((group__).var__ += (n__))
+#endif
+
+/**
+ * @brief Increases a statistic entry, selected by index, by the specified
+ * amount.
+ *
+ * Increases the entry @p idx__ places after @p first__ in the group.  All
+ * entries in between must be part of the group.  Compiled out if
+ * CONFIG_STATS is not defined.
+ *
+ * @param group__               The group containing the entry to increase.
+ * @param first__               The statistic entry the index is relative to.
+ * @param idx__                 The index of the entry to increase.
+ * @param n__                   The amount to increase the statistic entry by.
+ */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_INCN_IDX(group__, first__, idx__, n__)			\
+	do {								\
+		unsigned int key__ = arch_irq_lock();			\
+									\
+		(&STATS_SECT_LOCAL(group__).first__)[idx__] += (n__);	\
+		arch_irq_unlock(key__);					\
+	} while (false)
+#else
+#define STATS_INCN_IDX(group__, first__, idx__, n__) \
+	((&(group__).first__)[idx__] += (n__))
+#endif
 
 /**
  * @brief Increments a statistic entry.
@@ -165,8 +248,18 @@ struct stats_hdr {
  * @param var__                 The statistic entry to increase.
  * @param n__                   The amount to set the statistic entry to.
  */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_SET(group__, var__, n__)					\
+	do {								\
+		for (int i__ = 1; i__ < CONFIG_MP_MAX_NUM_CPUS; i__++) {	\
+			STATS_SECT_CPU(group__, i__).var__ = 0;		\
+		}							\
+		STATS_SECT_CPU(group__, 0).var__ = (n__);		\
+	} while (false)
+#else
 #define STATS_SET(group__, var__, n__)	\
 	((group__).var__ = (n__))
+#endif
 
 /**
  * @brief Sets a statistic entry to zero.
@@ -178,7 +271,30 @@ struct stats_hdr {
  * @param var__                 The statistic entry to clear.
  */
 #define STATS_CLEAR(group__, var__) \
-	((group__).var__ = 0)
+	STATS_SET(group__, var__, 0)
+
+/**
+ * @brief Reads a statistic entry.
+ *
+ * Reads a statistic entry.  With CONFIG_STATS_PER_CPU, this is the sum of
+ * the copies of all CPUs.  Evaluates to 0 if CONFIG_STATS is not defined.
+ *
+ * @param group__               The group containing the entry to read.
+ * @param var__                 The statistic entry to read.
+ */
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_GET(group__, var__)					\
+	({								\
+		uint64_t sum__ = 0;					\
+									\
+		K_PERCPU_FOREACH_CPU(i__) {				\
+			sum__ += STATS_SECT_CPU(group__, i__).var__;	\
+		}							\
+		sum__;							\
+	})
+#else
+#define STATS_GET(group__, var__) ((group__).var__)
+#endif
 
 #define STATS_SIZE_16 (sizeof(uint16_t))
 #define STATS_SIZE_32 (sizeof(uint32_t))
@@ -186,7 +302,7 @@ struct stats_hdr {
 
 #define STATS_SIZE_INIT_PARMS(group__, size__) \
 	(size__),			       \
-	((sizeof(group__)) - sizeof(struct stats_hdr)) / (size__)
+	STATS_SECT_SIZE(group__) / (size__)
 
 /**
  * @brief Initializes and registers a statistics group.
@@ -206,7 +322,7 @@ struct stats_hdr {
 	stats_init_and_reg(						 \
 		&(group__).s_hdr,					 \
 		(size__),						 \
-		(sizeof(group__) - sizeof(struct stats_hdr)) / (size__), \
+		STATS_SECT_SIZE(group__) / (size__),			 \
 		STATS_NAME_INIT_PARMS(group__),				 \
 		(name__))
 
@@ -279,6 +395,19 @@ int stats_init_and_reg(struct stats_hdr *hdr, uint8_t size, uint16_t cnt,
  */
 void stats_reset(struct stats_hdr *shdr);
 
+/**
+ * @brief Reads a statistic entry.
+ *
+ * With CONFIG_STATS_PER_CPU, the copies of all CPUs are summed up.
+ *
+ * @param hdr                   The group containing the stat entry.
+ * @param off                   The offset of the entry, from `hdr`, as
+ *                                  passed to a @ref stats_walk_fn.
+ *
+ * @return                      The value of the entry.
+ */
+uint64_t stats_get(const struct stats_hdr *hdr, uint16_t off);
+
 /** @typedef stats_walk_fn
  * @brief Function that gets applied to every stat entry during a walk.
  *
@@ -354,6 +483,8 @@ struct stats_hdr *stats_group_find(const char *name);
 #define STATS_SECT_START(group__) \
 	STATS_SECT_DECL(group__) {
 
+#define STATS_SECT_END }
+
 #define STATS_SECT_ENTRY(var__)
 #define STATS_SECT_ENTRY16(var__)
 #define STATS_SECT_ENTRY32(var__)
@@ -362,8 +493,10 @@ struct stats_hdr *stats_group_find(const char *name);
 #define STATS_SIZE_INIT_PARMS(group__, size__)
 #define STATS_INCN(group__, var__, n__)
 #define STATS_INC(group__, var__)
+#define STATS_INCN_IDX(group__, first__, idx__, n__)
 #define STATS_SET(group__, var__)
 #define STATS_CLEAR(group__, var__)
+#define STATS_GET(group__, var__) (0)
 #define STATS_INIT_AND_REG(group__, size__, name__) (0)
 
 #endif /* !CONFIG_STATS */
@@ -375,8 +508,13 @@ struct stats_hdr *stats_group_find(const char *name);
 #define STATS_NAME_START(sectname__) \
 	static const struct stats_name_map STATS_NAME_MAP_NAME(sectname__)[] = {
 
+#ifdef CONFIG_STATS_PER_CPU
+#define STATS_NAME(sectname__, entry__)	\
+	{ offsetof(STATS_SECT_DECL(sectname__), s_cpu[0].s.entry__), #entry__ },
+#else
 #define STATS_NAME(sectname__, entry__)	\
 	{ offsetof(STATS_SECT_DECL(sectname__), entry__), #entry__ },
+#endif
 
 #define STATS_NAME_END(sectname__) }
 
@@ -31,6 +31,10 @@
 
 #include <zephyr/drivers/disk.h>
 
+#if defined(CONFIG_DISK_ACCESS_RTIO) || defined(__DOXYGEN__)
+#include <zephyr/rtio/rtio.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -113,6 +117,97 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/**
+ * @brief Get the block cache statistics of a disk
+ *
+ * Available with @kconfig{CONFIG_DISK_ACCESS_CACHE}. The statistics are kept
+ * since the disk was registered.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[out] stats        Block cache statistics
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_access_cache_stats_get(const char *pdrv, struct disk_cache_stats *stats);
+
+#if defined(CONFIG_DISK_ACCESS_RTIO) || defined(__DOXYGEN__)
+
+/**
+ * @brief Data of a disk RTIO device, defined by @ref DISK_ACCESS_IODEV_DEFINE
+ */
+struct disk_access_iodev_data {
+	/** Disk name */
+	const char *pdrv;
+	/** @cond INTERNAL_HIDDEN */
+	struct k_spinlock lock;
+	struct mpsc pending;
+	bool busy;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api disk_access_iodev_api;
+/** @endcond */
+
+/**
+ * @brief Define an RTIO device for a disk
+ *
+ * Requests submitted to the device are processed in order on the RTIO
+ * work queue. Consecutive requests of the same kind that continue each
+ * other on the disk and in memory are merged into one disk access.
+ *
+ * @param name Symbolic name of the iodev to define
+ * @param disk_name Disk name
+ */
+#define DISK_ACCESS_IODEV_DEFINE(name, disk_name)					\
+	static struct disk_access_iodev_data _disk_access_iodev_data_##name = {		\
+		.pdrv = disk_name,							\
+		.pending = MPSC_INIT(_disk_access_iodev_data_##name.pending),		\
+	};										\
+	RTIO_IODEV_DEFINE(name, &disk_access_iodev_api, &_disk_access_iodev_data_##name)
+
+/**
+ * @brief Queue a read of disk sectors in an RTIO context
+ *
+ * Two submissions are acquired, the request completes with a single
+ * completion carrying @p userdata.
+ *
+ * @param r RTIO context
+ * @param iodev Disk RTIO device
+ * @param data_buf Pointer to the memory buffer to put data
+ * @param start_sector Start disk sector to read from
+ * @param buf_len Length of the buffer, a multiple of the sector size
+ * @param userdata User data returned in the completion
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough submissions available in the context
+ */
+struct rtio_sqe *disk_access_rtio_read(struct rtio *r, const struct rtio_iodev *iodev,
+				       uint8_t *data_buf, uint32_t start_sector,
+				       uint32_t buf_len, void *userdata);
+
+/**
+ * @brief Queue a write of disk sectors in an RTIO context
+ *
+ * Two submissions are acquired, the request completes with a single
+ * completion carrying @p userdata.
+ *
+ * @param r RTIO context
+ * @param iodev Disk RTIO device
+ * @param data_buf Pointer to the memory buffer
+ * @param start_sector Start disk sector to write to
+ * @param buf_len Length of the buffer, a multiple of the sector size
+ * @param userdata User data returned in the completion
+ *
+ * @retval sqe Last submission in the queue added
+ * @retval NULL Not enough submissions available in the context
+ */
+struct rtio_sqe *disk_access_rtio_write(struct rtio *r, const struct rtio_iodev *iodev,
+					const uint8_t *data_buf, uint32_t start_sector,
+					uint32_t buf_len, void *userdata);
+
+#endif /* CONFIG_DISK_ACCESS_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
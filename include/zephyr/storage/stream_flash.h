@@ -25,6 +25,7 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +65,12 @@ struct stream_flash_ctx {
 	stream_flash_callback_t callback; /* Callback invoked after write op */
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
+#endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	struct k_work erase_work; /* Erase of the page following the written one */
+	off_t erase_ahead_page; /* Page erased ahead, -1 if none */
+	size_t erase_ahead_size; /* Size of the page erased ahead */
+	bool erase_ahead_done; /* Page erased ahead successfully */
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
@@ -39,9 +39,29 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	/* One bit per bundle, set if the bundle is all set. Can be NULL. */
+	uint32_t *summary;
+#endif
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
+
+#define Z_SYS_BITARRAY_NUM_BUNDLES(total_bits)				\
+	DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t))
+
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+#define Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)	\
+	sba_mod uint32_t _sys_bitarray_summary_##name			\
+		[DIV_ROUND_UP(Z_SYS_BITARRAY_NUM_BUNDLES(total_bits),	\
+			      32)] = {0};
+#define Z_SYS_BITARRAY_SUMMARY_INIT(name)				\
+	.summary = _sys_bitarray_summary_##name,
+#else
+#define Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)
+#define Z_SYS_BITARRAY_SUMMARY_INIT(name)
+#endif
 /** @endcond */
 
 /** Bitarray structure */
@@ -56,13 +76,13 @@ typedef struct sys_bitarray sys_bitarray_t;
  */
 #define _SYS_BITARRAY_DEFINE(name, total_bits, sba_mod)			\
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
-		[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),		\
-			       sizeof(uint32_t))] = {0};		\
+		[Z_SYS_BITARRAY_NUM_BUNDLES(total_bits)] = {0};		\
+	Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)	\
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = (total_bits),				\
-		.num_bundles = DIV_ROUND_UP(				\
-			DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t)),	\
+		.num_bundles = Z_SYS_BITARRAY_NUM_BUNDLES(total_bits),	\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		Z_SYS_BITARRAY_SUMMARY_INIT(name)			\
 	}
 
 /**
@@ -256,6 +256,8 @@ enum {
 	ZFD_IOCTL_STAT,
 	ZFD_IOCTL_TRUNCATE,
 	ZFD_IOCTL_MMAP,
+	ZFD_IOCTL_RECV_PKT,
+	ZFD_IOCTL_EPOLL_WATCH,
 
 	/* Codes above 0x5400 and below 0x5500 are reserved for termios, FIO, etc */
 	ZFD_IOCTL_FIONREAD = 0x541B,
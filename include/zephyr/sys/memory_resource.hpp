@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_MEMORY_RESOURCE_HPP_
+#define ZEPHYR_INCLUDE_SYS_MEMORY_RESOURCE_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+
+/**
+ * @defgroup memory_resource_apis Polymorphic Memory Resources
+ * @ingroup memory_management
+ * @brief C++ memory resources backed by Zephyr allocators
+ *
+ * Implementations of @c std::pmr::memory_resource that make the
+ * allocator-aware containers of the C++ standard library, such as
+ * @c std::pmr::vector or @c std::pmr::map, allocate from a @ref k_heap, a
+ * @ref sys_heap, a @ref k_mem_slab or a fixed buffer.
+ *
+ * As with any memory resource, a request that cannot be served does not
+ * return @c nullptr: it is passed on to an upstream resource where there
+ * is one, or to @c std::pmr::null_memory_resource(), which throws
+ * @c std::bad_alloc, or aborts without @kconfig{CONFIG_CPP_EXCEPTIONS}.
+ *
+ * @{
+ */
+
+namespace zephyr::pmr
+{
+
+/**
+ * @brief Memory resource allocating from a @ref k_heap
+ *
+ * Can be used from several threads at once, as the heap itself.
+ */
+class k_heap_resource : public std::pmr::memory_resource
+{
+public:
+	/**
+	 * @param heap Initialized heap to allocate from
+	 * @param timeout How long to wait for memory to be freed in the heap
+	 *		  when it is not enough for a request
+	 */
+	explicit k_heap_resource(struct k_heap *heap, k_timeout_t timeout = K_NO_WAIT) noexcept
+		: heap_(heap), timeout_(timeout)
+	{
+	}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	struct k_heap *heap_;
+	k_timeout_t timeout_;
+};
+
+/**
+ * @brief Memory resource allocating from a @ref sys_heap
+ *
+ * Like the heap itself, it must not be used from several threads at once.
+ */
+class sys_heap_resource : public std::pmr::memory_resource
+{
+public:
+	/**
+	 * @param heap Initialized heap to allocate from
+	 */
+	explicit sys_heap_resource(struct sys_heap *heap) noexcept : heap_(heap)
+	{
+	}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	struct sys_heap *heap_;
+};
+
+/**
+ * @brief Memory resource allocating blocks of a @ref k_mem_slab
+ *
+ * Each allocation takes a block of the slab, as long as it fits in it,
+ * which suits node-based containers such as @c std::pmr::list or
+ * @c std::pmr::map. Larger, more aligned or failed requests go upstream.
+ * Can be used from several threads at once, as the slab itself.
+ */
+class mem_slab_resource : public std::pmr::memory_resource
+{
+public:
+	/**
+	 * @param slab Initialized memory slab to allocate from
+	 * @param timeout How long to wait for a block to be freed when there
+	 *		  is none left
+	 * @param upstream Resource that gets the requests the slab cannot serve
+	 */
+	explicit mem_slab_resource(struct k_mem_slab *slab, k_timeout_t timeout = K_NO_WAIT,
+				   std::pmr::memory_resource *upstream =
+					   std::pmr::null_memory_resource()) noexcept
+		: slab_(slab), timeout_(timeout), upstream_(upstream)
+	{
+	}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	struct k_mem_slab *slab_;
+	k_timeout_t timeout_;
+	std::pmr::memory_resource *upstream_;
+};
+
+/**
+ * @brief Memory resource bumping a pointer through a fixed buffer
+ *
+ * Allocating is a matter of aligning and moving a pointer, deallocating
+ * does nothing: the memory is only reclaimed all at once by release(),
+ * for instance once a message is processed. Unlike
+ * @c std::pmr::monotonic_buffer_resource, it never allocates buffers of
+ * its own: once the buffer is full, requests go upstream. Must not be
+ * used from several threads at once.
+ */
+class monotonic_arena_resource : public std::pmr::memory_resource
+{
+public:
+	/**
+	 * @param buffer Memory to allocate from
+	 * @param size Size of the buffer in bytes
+	 * @param upstream Resource that gets the requests the buffer cannot
+	 *		   serve, which is not released with it
+	 */
+	monotonic_arena_resource(void *buffer, std::size_t size,
+				 std::pmr::memory_resource *upstream =
+					 std::pmr::null_memory_resource()) noexcept
+		: start_(static_cast<char *>(buffer)), end_(start_ + size), next_(start_),
+		  upstream_(upstream)
+	{
+	}
+
+	monotonic_arena_resource(const monotonic_arena_resource &) = delete;
+	monotonic_arena_resource &operator=(const monotonic_arena_resource &) = delete;
+
+	/**
+	 * @brief Make the whole buffer available again
+	 *
+	 * Whatever was allocated from the buffer must no longer be used.
+	 */
+	void release() noexcept
+	{
+		next_ = start_;
+	}
+
+	/** @return Number of bytes of the buffer in use, padding included */
+	std::size_t used() const noexcept
+	{
+		return next_ - start_;
+	}
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+	char *start_;
+	char *end_;
+	char *next_;
+	std::pmr::memory_resource *upstream_;
+};
+
+} /* namespace zephyr::pmr */
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_SYS_MEMORY_RESOURCE_HPP_ */
@@ -11,8 +11,8 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
+ * With CONFIG_SYS_MUTEX_FAST, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
  * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
  */
 
@@ -25,14 +25,26 @@ extern "C" {
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+#include <zephyr/kernel.h>
+#endif
+
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST, 0 when unlocked, otherwise the owning
+	 * thread, or'ed with Z_SYS_MUTEX_KERNEL once the kernel mutex backing
+	 * this one tracks the ownership because of contention.  Unused
+	 * otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FAST
+	/* Recursive lock count, only ever touched by the owner */
+	uint32_t count;
+#endif
 };
 
+/* Flag in sys_mutex::val: ownership is tracked by the kernel */
+#define Z_SYS_MUTEX_KERNEL BIT(0)
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -101,8 +113,30 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int ret;
+
+	if (atomic_cas(&mutex->val, 0, self)) {
+		mutex->count = 1U;
+		return 0;
+	}
+
+	if ((atomic_get(&mutex->val) & ~Z_SYS_MUTEX_KERNEL) == self) {
+		mutex->count++;
+		return 0;
+	}
+
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		mutex->count = 1U;
+	}
+
+	return ret;
+#else
 	/* For now, make the syscall unconditionally */
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif
 }
 
 /**
@@ -124,8 +158,34 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FAST
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t val = atomic_get(&mutex->val);
+
+	if (val == 0) {
+		return -EINVAL;
+	}
+
+	if ((val & ~Z_SYS_MUTEX_KERNEL) != self) {
+		return -EPERM;
+	}
+
+	if (mutex->count > 1U) {
+		mutex->count--;
+		return 0;
+	}
+
+	mutex->count = 0U;
+	if (atomic_cas(&mutex->val, self, 0)) {
+		return 0;
+	}
+
+	/* Contended: the kernel hands the mutex over to a waiter */
+	return z_sys_mutex_kernel_unlock(mutex);
+#else
 	/* For now, make the syscall unconditionally */
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif
 }
 
 #include <zephyr/syscalls/mutex.h>
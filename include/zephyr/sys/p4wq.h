@@ -46,6 +46,7 @@ struct k_p4wq_work {
 #define K_P4WQ_QUEUE_PER_THREAD		BIT(0)
 #define K_P4WQ_DELAYED_START		BIT(1)
 #define K_P4WQ_USER_CPU_MASK		BIT(2)
+#define K_P4WQ_WORK_STEALING		BIT(3)
 
 /**
  * @brief P4 Queue
@@ -74,6 +75,12 @@ struct k_p4wq {
 
 	/* K_P4WQ_* flags above */
 	uint32_t flags;
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	/* Queues whose threads take items from each other, this one included */
+	struct k_p4wq *peers;
+	uint32_t num_peers;
+#endif
 };
 
 struct k_p4wq_initparam {
@@ -118,6 +125,10 @@ struct k_p4wq_initparam {
  * number of threads which will be initialized at boot and ready for use on
  * entry to main().
  *
+ * With @kconfig{CONFIG_P4WQ_WORK_STEALING}, the K_P4WQ_WORK_STEALING flag
+ * lets the thread of each queue run the items of the other queues of the
+ * array when its own queue is empty, see k_p4wq_enable_stealing().
+ *
  * @param name Symbol name of the struct k_p4wq array that will be defined
  * @param n_threads Number of threads and work queues
  * @param stack_sz Requested stack size of each thread, in bytes
@@ -188,6 +199,22 @@ void k_p4wq_add_thread(struct k_p4wq *queue, struct k_thread *thread,
  */
 void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item);
 
+/**
+ * @brief Submit several work items to a P4 queue
+ *
+ * Submits the specified work items to the queue as k_p4wq_submit() would
+ * one after the other, but taking the queue lock and rescheduling only
+ * once, and their deadlines being relative to the same time. The items
+ * must be distinct.
+ *
+ * @note This call is a scheduling point, see k_p4wq_submit().
+ *
+ * @param queue P4 Queue to which to submit
+ * @param items Array of pointers to the P4 work items to be submitted
+ * @param count Number of work items
+ */
+void k_p4wq_submit_batch(struct k_p4wq *queue, struct k_p4wq_work **items, size_t count);
+
 /**
  * @brief Cancel submitted P4 work item
  *
@@ -208,4 +235,25 @@ int k_p4wq_wait(struct k_p4wq_work *work, k_timeout_t timeout);
 void k_p4wq_enable_static_thread(struct k_p4wq *queue, struct k_thread *thread,
 				 uint32_t cpu_mask);
 
+/**
+ * @brief Let the threads of P4 queues take work items from each other
+ *
+ * Once its own queue is empty, a thread of any of the queues runs the
+ * highest priority work item of the next queue that has any before
+ * waiting. When a queue runs out of threads, it wakes up idle threads of
+ * the other queues to take its work items. This suits queues whose
+ * threads are pinned to different CPUs. Stolen items run with their
+ * priority and deadline, and are canceled, waited for and resubmitted
+ * through the queue they were submitted to, as any other.
+ *
+ * Must be called before threads are added to the queues, this is done by
+ * K_P4WQ_ARRAY_DEFINE() with the K_P4WQ_WORK_STEALING flag.
+ *
+ * @kconfig_dep{CONFIG_P4WQ_WORK_STEALING}
+ *
+ * @param queues Array of initialized P4 queues
+ * @param num Number of queues
+ */
+void k_p4wq_enable_stealing(struct k_p4wq *queues, uint32_t num);
+
 #endif /* ZEPHYR_INCLUDE_SYS_P4WQ_H_ */
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_RING_BUFFER_MP_H_
+#define ZEPHYR_INCLUDE_SYS_RING_BUFFER_MP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @defgroup ring_buffer_mp_apis Multi-Producer Ring Buffer APIs
+ * @ingroup datastructure_apis
+ *
+ * @brief Lock-free ring buffer for multiple producers and consumers.
+ *
+ * Unlike @ref ring_buffer_apis, any number of threads, ISRs and CPUs may
+ * put data into and get data from the same ring buffer without any lock,
+ * through the same zero-copy claim/finish style of API.
+ *
+ * The buffer is split into blocks of a fixed size and data is stored in
+ * chunks of whole blocks: every put claim of up to a few blocks is a chunk
+ * that consumers get whole when it is finished, in the order in which the
+ * claims were made. A claim that is not finished yet holds back consumers,
+ * but never other producers.
+ *
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+struct ring_buf_mp_chunk {
+	/* state of the chunk starting at this block, with its position */
+	atomic_t seq;
+	/* number of blocks of the chunk */
+	uint16_t blocks;
+	/* number of bytes in the chunk */
+	uint16_t len;
+};
+
+#define Z_RING_BUF_MP_SIZE_ASSERT_MSG                                                              \
+	"Block size must be in 1..65535, number of blocks a power of 2 in 2..2^30"
+
+#define Z_RING_BUF_MP_SIZE_OK(block_size, n_blocks)                                                \
+	(((block_size) > 0) && ((block_size) <= UINT16_MAX) && ((n_blocks) >= 2) &&                \
+	 ((n_blocks) <= BIT(30)) && IS_POWER_OF_TWO(n_blocks))
+/** @endcond */
+
+/**
+ * @brief A multi-producer ring buffer
+ */
+struct ring_buf_mp {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *buffer;
+	struct ring_buf_mp_chunk *chunks;
+	uint32_t block_size;
+	uint32_t mask;
+	/* blocks claimed by producers */
+	atomic_t put_head;
+	/* blocks claimed by consumers */
+	atomic_t get_head;
+	/* blocks given back to producers */
+	atomic_t get_tail;
+	/** @endcond */
+};
+
+/**
+ * @brief Define and initialize a multi-producer ring buffer.
+ *
+ * The ring buffer can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct ring_buf_mp <name>; @endcode
+ *
+ * @param name Name of the ring buffer.
+ * @param buf_block_size Size of a block, in bytes, up to 65535. A multiple
+ *			 of the alignment the data needs.
+ * @param buf_n_blocks Number of blocks, a power of 2 of at least 2.
+ */
+#define RING_BUF_MP_DECLARE(name, buf_block_size, buf_n_blocks)                                    \
+	BUILD_ASSERT(Z_RING_BUF_MP_SIZE_OK(buf_block_size, buf_n_blocks),                          \
+		     Z_RING_BUF_MP_SIZE_ASSERT_MSG);                                               \
+	static uint8_t __noinit __aligned(sizeof(void *))                                          \
+		_ring_buffer_mp_data_##name[(buf_block_size) * (buf_n_blocks)];                    \
+	static struct ring_buf_mp_chunk _ring_buffer_mp_chunks_##name[buf_n_blocks];               \
+	struct ring_buf_mp name = {                                                                \
+		.buffer = _ring_buffer_mp_data_##name,                                             \
+		.chunks = _ring_buffer_mp_chunks_##name,                                           \
+		.block_size = (buf_block_size),                                                    \
+		.mask = (buf_n_blocks) - 1,                                                        \
+	}
+
+/**
+ * @brief Initialize a multi-producer ring buffer.
+ *
+ * This routine initializes a ring buffer, prior to its first use. It is only
+ * used for ring buffers not defined using RING_BUF_MP_DECLARE.
+ *
+ * @param buf Address of ring buffer.
+ * @param block_size Size of a block, in bytes, up to 65535.
+ * @param n_blocks Number of blocks, a power of 2 of at least 2.
+ * @param data Ring buffer data area (uint8_t data[block_size * n_blocks]).
+ * @param chunks Ring buffer bookkeeping area (struct ring_buf_mp_chunk
+ *		 chunks[n_blocks]).
+ */
+void ring_buf_mp_init(struct ring_buf_mp *buf, uint32_t block_size, uint32_t n_blocks,
+		      uint8_t *data, struct ring_buf_mp_chunk *chunks);
+
+/**
+ * @brief Return ring buffer capacity.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer capacity (in bytes).
+ */
+static inline uint32_t ring_buf_mp_capacity_get(const struct ring_buf_mp *buf)
+{
+	return buf->block_size * (buf->mask + 1);
+}
+
+/**
+ * @brief Determine if a ring buffer is empty.
+ *
+ * With concurrent users, this is only a snapshot of the state of the ring
+ * buffer: anything may have changed by the time it is returned.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return true if no data is put nor claimed by producers, or false if not.
+ */
+static inline bool ring_buf_mp_is_empty(struct ring_buf_mp *buf)
+{
+	return atomic_get(&buf->get_head) == atomic_get(&buf->put_head);
+}
+
+/**
+ * @brief Determine free space in a ring buffer.
+ *
+ * With concurrent users, this is only a snapshot of the state of the ring
+ * buffer: anything may have changed by the time it is returned.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space, in bytes of whole blocks.
+ */
+static inline uint32_t ring_buf_mp_space_get(struct ring_buf_mp *buf)
+{
+	uint32_t tail = (uint32_t)atomic_get(&buf->get_tail);
+	uint32_t head = (uint32_t)atomic_get(&buf->put_head);
+
+	return buf->block_size * (buf->mask + 1 - (head - tail));
+}
+
+/**
+ * @brief Allocate buffer for writing data to a ring buffer.
+ *
+ * Claim up to @p size bytes of free space, in whole blocks that are
+ * contiguous in memory. Once data is written to it, it must be handed
+ * over to consumers with @ref ring_buf_mp_put_finish. A producer may have
+ * several claims in progress.
+ *
+ * This routine may be called from any context, concurrently with any
+ * other routine of this API.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space, the buffer wraps, or the size
+ *	   exceeds 65535 bytes. 0 if the ring buffer is full.
+ */
+uint32_t ring_buf_mp_put_claim(struct ring_buf_mp *buf, uint8_t **data, uint32_t size);
+
+/**
+ * @brief Hand the data written to a claimed buffer over to consumers.
+ *
+ * Consumers get the data as a single chunk of @p size bytes, once all
+ * the chunks claimed before it are finished too. The blocks claimed but
+ * not used are only freed with the chunk.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address returned by @ref ring_buf_mp_put_claim.
+ * @param size Number of valid bytes in the claimed buffer, 0 to cancel
+ *	       the claim.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL @p data is not a claimed buffer or @p size exceeds it.
+ */
+int ring_buf_mp_put_finish(struct ring_buf_mp *buf, uint8_t *data, uint32_t size);
+
+/**
+ * @brief Write (copy) data to a ring buffer.
+ *
+ * The data is split in several chunks if it does not fit in a single
+ * claim, in which case chunks of other producers may get in between.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes written.
+ */
+uint32_t ring_buf_mp_put(struct ring_buf_mp *buf, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Get address of the next chunk of data in a ring buffer.
+ *
+ * Claim the oldest chunk that producers finished. Once it is processed,
+ * its space must be given back with @ref ring_buf_mp_get_finish. Chunks
+ * claimed by several consumers may be finished in any order.
+ *
+ * This routine may be called from any context, concurrently with any
+ * other routine of this API.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ *
+ * @return Number of bytes in the chunk, 0 if there is no finished chunk.
+ */
+uint32_t ring_buf_mp_get_claim(struct ring_buf_mp *buf, uint8_t **data);
+
+/**
+ * @brief Give the space of a claimed chunk back to producers.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address returned by @ref ring_buf_mp_get_claim.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL @p data is not a claimed chunk.
+ */
+int ring_buf_mp_get_finish(struct ring_buf_mp *buf, uint8_t *data);
+
+/**
+ * @brief Read data from a ring buffer.
+ *
+ * Copy whole chunks, as many as fit in @p size bytes. If even the first
+ * chunk does not fit, its first @p size bytes are copied and the rest of
+ * it is dropped.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of the output buffer.
+ * @param size Size of the output buffer (in bytes).
+ *
+ * @return Number of bytes read.
+ */
+uint32_t ring_buf_mp_get(struct ring_buf_mp *buf, uint8_t *data, uint32_t size);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_RING_BUFFER_MP_H_ */
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SEQLOCK_H_
+#define ZEPHYR_INCLUDE_SYS_SEQLOCK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/barrier.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sequence Lock APIs
+ * @defgroup seqlock_apis Sequence Lock APIs
+ * @ingroup kernel_apis
+ *
+ * A sequence lock protects small data that is written rarely but read
+ * often, e.g. a snapshot updated from an ISR.  Readers never block the
+ * writer and do not write to any shared memory: they take a copy of the
+ * data and retry if a write happened meanwhile.
+ *
+ * Writers serialize with each other through a spinlock, so they may run
+ * in any context, ISRs included.  Readers may run in any context too,
+ * but must only copy the protected data: what they read may be torn
+ * until sys_seqlock_read_retry() says otherwise.
+ *
+ * @code
+ * uint32_t seq;
+ *
+ * do {
+ *	seq = sys_seqlock_read_begin(&lock);
+ *	copy = shared;
+ * } while (sys_seqlock_read_retry(&lock, seq));
+ * @endcode
+ *
+ * @{
+ */
+
+/**
+ * @brief Sequence lock
+ */
+struct sys_seqlock {
+	/** @cond INTERNAL_HIDDEN */
+	uint32_t seq;
+	struct k_spinlock lock;
+	/** @endcond */
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_SEQLOCK_INITIALIZER {}
+/** @endcond */
+
+/**
+ * @brief Statically define and initialize a sequence lock
+ *
+ * @param name Name of the sequence lock
+ */
+#define SYS_SEQLOCK_DEFINE(name) struct sys_seqlock name = Z_SEQLOCK_INITIALIZER
+
+/**
+ * @brief Initialize a sequence lock
+ *
+ * @param sl Sequence lock
+ */
+static inline void sys_seqlock_init(struct sys_seqlock *sl)
+{
+	*sl = (struct sys_seqlock)Z_SEQLOCK_INITIALIZER;
+}
+
+/**
+ * @brief Start reading data protected by a sequence lock
+ *
+ * Waits for a write in progress on another CPU to complete.
+ *
+ * @param sl Sequence lock
+ *
+ * @return Sequence number to pass to sys_seqlock_read_retry()
+ */
+static inline uint32_t sys_seqlock_read_begin(const struct sys_seqlock *sl)
+{
+	uint32_t seq;
+
+	while (((seq = *(const volatile uint32_t *)&sl->seq) & 1U) != 0U) {
+#ifdef CONFIG_SMP
+		arch_spin_relax();
+#endif
+	}
+
+	barrier_dmem_fence_full();
+
+	return seq;
+}
+
+/**
+ * @brief Check whether data read since sys_seqlock_read_begin() is valid
+ *
+ * @param sl Sequence lock
+ * @param seq Value returned by sys_seqlock_read_begin()
+ *
+ * @retval true A write happened meanwhile, the data must be read again
+ * @retval false The data read is consistent
+ */
+static inline bool sys_seqlock_read_retry(const struct sys_seqlock *sl, uint32_t seq)
+{
+	barrier_dmem_fence_full();
+
+	return *(const volatile uint32_t *)&sl->seq != seq;
+}
+
+/**
+ * @brief Start writing data protected by a sequence lock
+ *
+ * Locks interrupts on the current CPU until sys_seqlock_write_unlock(),
+ * which keeps readers on this CPU from spinning on a write they
+ * interrupted.  Writes must thus be short.
+ *
+ * @param sl Sequence lock
+ *
+ * @return Key to pass to sys_seqlock_write_unlock()
+ */
+static inline k_spinlock_key_t sys_seqlock_write_lock(struct sys_seqlock *sl)
+{
+	k_spinlock_key_t key = k_spin_lock(&sl->lock);
+
+	*(volatile uint32_t *)&sl->seq = sl->seq + 1U;
+	barrier_dmem_fence_full();
+
+	return key;
+}
+
+/**
+ * @brief Finish writing data protected by a sequence lock
+ *
+ * @param sl Sequence lock
+ * @param key Value returned by sys_seqlock_write_lock()
+ */
+static inline void sys_seqlock_write_unlock(struct sys_seqlock *sl, k_spinlock_key_t key)
+{
+	barrier_dmem_fence_full();
+	*(volatile uint32_t *)&sl->seq = sl->seq + 1U;
+
+	k_spin_unlock(&sl->lock, key);
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SEQLOCK_H_ */
@@ -58,6 +58,9 @@ struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	struct sys_heap_profile *profile;
+#endif
 };
 
 struct z_heap_stress_result {
@@ -98,6 +101,165 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap);
 
 #endif
 
+#if defined(CONFIG_SYS_HEAP_PROFILE) || defined(__DOXYGEN__)
+
+/** Number of request size histogram buckets */
+#define SYS_HEAP_PROFILE_SIZE_BUCKETS 16
+
+/** Number of block lifetime histogram buckets */
+#define SYS_HEAP_PROFILE_LIFETIME_BUCKETS 24
+
+/** @brief Allocations of one call site, from the sampled ones */
+struct sys_heap_profile_site {
+	/** Return address of the allocation call */
+	uintptr_t caller;
+	/** Sampled allocations */
+	uint32_t allocs;
+	/** Sampled allocations freed */
+	uint32_t frees;
+	/** Bytes requested by sampled allocations */
+	size_t bytes;
+	/** Bytes of sampled allocations not freed yet */
+	size_t live_bytes;
+	/** Peak of live_bytes */
+	size_t peak_live_bytes;
+};
+
+/** @cond INTERNAL_HIDDEN */
+struct z_heap_profile_live {
+	void *mem;
+	uint32_t bytes;
+	uint32_t start;
+	uint16_t site;
+};
+/** @endcond */
+
+/**
+ * @brief Allocation profile of a sys_heap
+ *
+ * Counters and the request size histogram cover every allocation.
+ * One allocation in CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE is sampled:
+ * it is accounted to its call site, and its lifetime is recorded in the
+ * lifetime histogram when it is freed.
+ */
+struct sys_heap_profile {
+	/** Successful allocations */
+	uint32_t allocs;
+	/** Frees */
+	uint32_t frees;
+	/** Failed allocations */
+	uint32_t failures;
+	/** Sampled allocations that could not be tracked, tables being full */
+	uint32_t dropped;
+	/** Allocations of 2^i to 2^(i+1)-1 bytes, the last bucket takes larger ones */
+	uint32_t size_hist[SYS_HEAP_PROFILE_SIZE_BUCKETS];
+	/** Sampled blocks freed after 2^(i-1) to 2^i-1 ticks, 0 ticks in bucket 0 */
+	uint32_t lifetime_hist[SYS_HEAP_PROFILE_LIFETIME_BUCKETS];
+	/** Call sites seen by the sampled allocations, in order of appearance */
+	struct sys_heap_profile_site sites[CONFIG_SYS_HEAP_PROFILE_SITES];
+	/** Number of valid entries in @a sites */
+	uint16_t nsites;
+	/** @cond INTERNAL_HIDDEN */
+	uint16_t nlive;
+	uint32_t countdown;
+	void *caller;
+	struct z_heap_profile_live live[CONFIG_SYS_HEAP_PROFILE_LIVE];
+	/** @endcond */
+};
+
+/** @brief Fragmentation of the free memory of a sys_heap */
+struct sys_heap_frag_stats {
+	/** Total free bytes */
+	size_t free_bytes;
+	/** Size of the largest free block */
+	size_t largest_free_bytes;
+	/** Number of free blocks */
+	size_t free_blocks;
+};
+
+/**
+ * @brief Callback receiving a binary profile export
+ *
+ * @param data Next bytes of the export
+ * @param len Number of bytes
+ * @param arg Argument passed to sys_heap_profile_export()
+ *
+ * @return 0 to go on, a negative value to abort the export with
+ */
+typedef int (*sys_heap_profile_export_cb_t)(const uint8_t *data, size_t len, void *arg);
+
+/**
+ * @brief Start or stop profiling a sys_heap
+ *
+ * Clears the profile and records further operations on the heap into
+ * it.  Like all sys_heap operations, this must be serialized with the
+ * other ones on the heap.  The profile may be read or exported once
+ * detached, or after copying it with the heap operations serialized.
+ *
+ * @param heap Heap to profile
+ * @param profile Profile to record into, or NULL to stop profiling
+ */
+void sys_heap_profile_attach(struct sys_heap *heap, struct sys_heap_profile *profile);
+
+/**
+ * @brief Get the fragmentation of a sys_heap
+ *
+ * Walks the whole heap: this takes time linear in the number of blocks.
+ *
+ * @param heap Heap to inspect
+ * @param stats Where to store the result
+ */
+void sys_heap_frag_stats_get(struct sys_heap *heap, struct sys_heap_frag_stats *stats);
+
+/**
+ * @brief Export a profile in binary form
+ *
+ * The export is a sequence of little-endian 32-bit words: a header with
+ * the magic value 0x46525048 ("HPRF"), the format version, the sampling
+ * rate, the tick rate and the histogram and site counts, followed by
+ * the counters, histograms, sites and, if @a frag is not NULL, the
+ * fragmentation of the heap.  Call site addresses take two words, low
+ * one first.
+ *
+ * @param profile Profile to export, not attached to a heap or a copy
+ * @param frag Fragmentation to add to the export, or NULL
+ * @param cb Callback receiving the export
+ * @param arg Argument passed to @a cb
+ *
+ * @return 0 on success, or the error returned by @a cb
+ */
+int sys_heap_profile_export(const struct sys_heap_profile *profile,
+			    const struct sys_heap_frag_stats *frag,
+			    sys_heap_profile_export_cb_t cb, void *arg);
+
+/** @cond INTERNAL_HIDDEN */
+#define SYS_HEAP_PROFILE_MAGIC 0x46525048U
+#define SYS_HEAP_PROFILE_VERSION 1U
+
+/* Wrappers around sys_heap pass their own caller down to the profile */
+#define Z_HEAP_CALLER() __builtin_return_address(0)
+
+static inline void z_sys_heap_profile_caller_set(struct sys_heap *heap, void *caller)
+{
+	if (heap->profile != NULL) {
+		heap->profile->caller = caller;
+	}
+}
+/** @endcond */
+
+#else
+
+/** @cond INTERNAL_HIDDEN */
+#define Z_HEAP_CALLER() NULL
+static inline void z_sys_heap_profile_caller_set(struct sys_heap *heap, void *caller)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(caller);
+}
+/** @endcond */
+
+#endif /* CONFIG_SYS_HEAP_PROFILE */
+
 /** @brief Initialize sys_heap
  *
  * Initializes a sys_heap struct to manage the specified memory.
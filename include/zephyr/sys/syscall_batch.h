@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/syscall_list.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis System call batching APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief One system call of a batch
+ *
+ * The arguments are laid out exactly as the system call's marshalling
+ * function expects them: one word per argument, except that on 32-bit
+ * targets 64-bit arguments (including k_timeout_t with
+ * CONFIG_TIMEOUT_64BIT) take two consecutive words, and that a seventh
+ * and further arguments are passed through a pointer in the last word.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID, one of the K_SYSCALL_* constants */
+	uintptr_t id;
+	/** System call arguments */
+	uintptr_t args[6];
+	/** System call return value, filled in by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Initializer for a batch entry
+ *
+ * @code
+ * struct k_syscall_batch_entry batch[] = {
+ *	K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&sem),
+ *	K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_EVENT_POST, (uintptr_t)&event, 0x1),
+ * };
+ * @endcode
+ *
+ * @param _id System call ID.
+ * @param ... System call arguments, as uintptr_t words.
+ */
+#define K_SYSCALL_BATCH_ENTRY(_id, ...) \
+	{ .id = (_id), .args = { __VA_ARGS__ } }
+
+/**
+ * @brief Run several system calls with a single trap
+ *
+ * Runs the system calls described by @a entries in order, storing each
+ * return value in its entry. Every call is verified exactly as if it
+ * had been made on its own, so an invalid argument to any of them has
+ * the usual effect, be it an error return or a kernel oops. Calls that
+ * block do so in turn, delaying the rest of the batch.
+ *
+ * This saves the trap and return overhead of all but one call, and is
+ * only meant for user mode threads; supervisor threads call the kernel
+ * APIs directly.
+ *
+ * @param entries Array of batch entries, writable by the caller
+ * @param count Number of entries, at most CONFIG_SYSCALL_BATCH_MAX_ENTRIES
+ *
+ * @retval 0 All entries were run.
+ * @retval -EINVAL Too many entries.
+ * @retval -ENOTSUP Called from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
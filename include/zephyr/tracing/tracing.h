@@ -865,6 +865,78 @@
 
 /** @} */ /* end of subsys_tracing_apis_condvar */
 
+/**
+ * @brief Reader-Writer Lock Tracing APIs
+ * @defgroup subsys_tracing_apis_rwlock Reader-Writer Lock Tracing APIs
+ * @{
+ */
+
+/**
+ * @brief Trace initialization of Reader-Writer Lock
+ * @param rwlock Reader-Writer Lock object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_rwlock_init(rwlock, ret)
+
+/**
+ * @brief Trace Reader-Writer Lock read lock attempt start
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_rwlock_read_lock_enter(rwlock, timeout)
+
+/**
+ * @brief Trace Reader-Writer Lock read lock attempt blocking
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_rwlock_read_lock_blocking(rwlock, timeout)
+
+/**
+ * @brief Trace Reader-Writer Lock read lock attempt outcome
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_rwlock_read_lock_exit(rwlock, timeout, ret)
+
+/**
+ * @brief Trace Reader-Writer Lock write lock attempt start
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_rwlock_write_lock_enter(rwlock, timeout)
+
+/**
+ * @brief Trace Reader-Writer Lock write lock attempt blocking
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_rwlock_write_lock_blocking(rwlock, timeout)
+
+/**
+ * @brief Trace Reader-Writer Lock write lock attempt outcome
+ * @param rwlock Reader-Writer Lock object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_rwlock_write_lock_exit(rwlock, timeout, ret)
+
+/**
+ * @brief Trace Reader-Writer Lock unlock entry
+ * @param rwlock Reader-Writer Lock object
+ */
+#define sys_port_trace_k_rwlock_unlock_enter(rwlock)
+
+/**
+ * @brief Trace Reader-Writer Lock unlock exit
+ * @param rwlock Reader-Writer Lock object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_rwlock_unlock_exit(rwlock, ret)
+
+/** @} */ /* end of subsys_tracing_apis_rwlock */
+
 /**
  * @brief Queue Tracing APIs
  * @defgroup subsys_tracing_apis_queue Queue Tracing APIs
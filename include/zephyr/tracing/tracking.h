@@ -76,6 +76,7 @@ extern struct k_event *_track_list_k_event;
 #define sys_port_track_k_pipe_init(pipe) \
 	sys_track_k_pipe_init(pipe)
 #define sys_port_track_k_condvar_init(condvar, ret)
+#define sys_port_track_k_rwlock_init(rwlock, ret)
 #define sys_port_track_k_stack_init(stack) \
 	sys_track_k_stack_init(stack)
 #define sys_port_track_k_thread_name_set(thread, ret)
@@ -134,6 +135,7 @@ void sys_track_socket_init(int sock, int family, int type, int proto);
 #define sys_port_track_k_queue_init(queue)
 #define sys_port_track_k_pipe_init(pipe)
 #define sys_port_track_k_condvar_init(condvar, ret)
+#define sys_port_track_k_rwlock_init(rwlock, ret)
 #define sys_port_track_k_stack_init(stack)
 #define sys_port_track_k_thread_name_set(thread, ret)
 #define sys_port_track_k_sem_reset(sem)
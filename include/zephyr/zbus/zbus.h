@@ -43,6 +43,13 @@ struct zbus_channel_data {
 	 */
 	struct k_sem sem;
 
+#if (CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE > 0) || defined(__DOXYGEN__)
+	/** Message sequence counter. Odd while a writer changes the message, allowing readers to
+	 * detect that they raced with it.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE */
+
 #if defined(CONFIG_ZBUS_PRIORITY_BOOST)
 	/** Highest observer priority. Indicates the priority that the VDED will use to boost the
 	 * notification process avoiding preemptions.
@@ -545,6 +552,9 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  *
  * This routine reads a message from a channel.
  *
+ * @note With @kconfig{CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE}, channels with small messages are read
+ * without waiting for the channel, unless it is claimed or the read keeps racing with a writer.
+ *
  * @param[in] chan The channel's reference.
  * @param[out] msg Reference to the message where the read function copies the channel's
  * message data to.
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZVFS_EPOLLIN  ZVFS_POLLIN
+#define ZVFS_EPOLLPRI ZVFS_POLLPRI
+#define ZVFS_EPOLLOUT ZVFS_POLLOUT
+#define ZVFS_EPOLLERR ZVFS_POLLERR
+#define ZVFS_EPOLLHUP ZVFS_POLLHUP
+
+#define ZVFS_EPOLL_CTL_ADD 1
+#define ZVFS_EPOLL_CTL_DEL 2
+#define ZVFS_EPOLL_CTL_MOD 3
+
+typedef union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zvfs_epoll_data_t;
+
+struct zvfs_epoll_event {
+	uint32_t events;
+	zvfs_epoll_data_t data;
+};
+
+struct zvfs_epoll_entry;
+
+/**
+ * @brief Create a ZVFS event poll instance
+ *
+ * An event poll instance keeps a persistent list of file descriptors of
+ * interest. File descriptors that can report their events, like native
+ * sockets waiting for input, are put on a ready list by the object itself,
+ * so @ref zvfs_epoll_wait only looks at the file descriptors that had an
+ * event. The other ones are polled on every wait, and count against
+ * CONFIG_ZVFS_POLL_MAX.
+ *
+ * Events are level-triggered.
+ *
+ * @param flags Must be 0.
+ *
+ * @return New ZVFS event poll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(int flags);
+
+/**
+ * @brief Add, modify or remove a file descriptor of an event poll instance
+ *
+ * @param epfd Event poll file descriptor
+ * @param op ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD or ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor
+ * @param event Events of interest and user data, unused for ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for events on an event poll instance
+ *
+ * @param epfd Event poll file descriptor
+ * @param events Array receiving the events
+ * @param maxevents Size of @p events, must be greater than 0
+ * @param timeout Timeout in milliseconds, -1 to wait forever
+ *
+ * @return Number of events stored into @p events, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout);
+
+/**
+ * @brief Put an entry on the ready list of its event poll instance
+ *
+ * Called by the object of a watched file descriptor when it may have become
+ * ready, see ZFD_IOCTL_EPOLL_WATCH. Can be called from any context.
+ *
+ * @param entry Entry given to the object by ZFD_IOCTL_EPOLL_WATCH
+ */
+void zvfs_epoll_notify(struct zvfs_epoll_entry *entry);
+
+/**
+ * @brief Remove the entry of a file descriptor that is being closed
+ *
+ * @param entry Entry given to the object by ZFD_IOCTL_EPOLL_WATCH
+ */
+void zvfs_epoll_detach(struct zvfs_epoll_entry *entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
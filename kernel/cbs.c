@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Constant bandwidth server reservations for deadline threads.
+ *
+ * A reserved thread is charged for the cycles it runs, from the
+ * moment it is switched in on a CPU until it is switched out or its
+ * budget runs out, which a per-CPU timeout catches.  An exhausted
+ * budget is refilled and the deadline postponed by one period, as
+ * many times as needed to bring the budget back above zero, so the
+ * thread keeps running only if nothing of its priority has an earlier
+ * deadline.  On wakeup the usual CBS rule applies: if the remaining
+ * budget cannot be consumed at the reserved bandwidth before the
+ * current deadline, the thread gets a fresh budget and deadline.
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <ksched.h>
+#include <ipi.h>
+#include <timeout_q.h>
+
+static struct _timeout cbs_timeouts[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Reserved thread being charged on each CPU, and since when */
+static struct k_thread *cbs_thread[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t cbs_stamp[CONFIG_MP_MAX_NUM_CPUS];
+
+static void cbs_timeout(struct _timeout *timeout);
+
+static inline bool has_reservation(struct k_thread *thread)
+{
+	return thread->base.cbs_budget != 0U;
+}
+
+static void cbs_charge(int cpu, uint32_t now)
+{
+	cbs_thread[cpu]->base.cbs_remaining -= (int32_t)(now - cbs_stamp[cpu]);
+	cbs_stamp[cpu] = now;
+}
+
+static void cbs_replenish(struct k_thread *thread, bool resched)
+{
+	uint32_t postpone = 0U;
+
+	if (!has_reservation(thread)) {
+		return;
+	}
+
+	while (thread->base.cbs_remaining <= 0) {
+		thread->base.cbs_remaining += (int32_t)thread->base.cbs_budget;
+		postpone += thread->base.cbs_period;
+	}
+
+	if (postpone != 0U) {
+		z_sched_deadline_update(thread, thread->base.prio_deadline + postpone, resched);
+	}
+}
+
+static void cbs_arm(int cpu)
+{
+	z_abort_timeout(&cbs_timeouts[cpu]);
+	z_add_timeout(&cbs_timeouts[cpu], cbs_timeout,
+		      K_CYC(cbs_thread[cpu]->base.cbs_remaining));
+}
+
+static void cbs_timeout(struct _timeout *timeout)
+{
+	int cpu = ARRAY_INDEX(cbs_timeouts, timeout);
+
+	K_SPINLOCK(&_sched_spinlock) {
+		struct k_thread *thread = cbs_thread[cpu];
+
+		if (thread == NULL) {
+			K_SPINLOCK_BREAK;
+		}
+
+		/* Reservation removed while the thread was running */
+		if (!has_reservation(thread)) {
+			cbs_thread[cpu] = NULL;
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_charge(cpu, k_cycle_get_32());
+		cbs_replenish(thread, true);
+
+		/* The postponed deadline may already have switched
+		 * another thread in; otherwise keep charging this one.
+		 */
+		if (cbs_thread[cpu] == thread) {
+			cbs_arm(cpu);
+		}
+
+		if (cpu != _current_cpu->id) {
+			flag_ipi(IPI_CPU_MASK(cpu));
+		}
+	}
+}
+
+void z_cbs_switch(struct k_thread *thread)
+{
+	int cpu = _current_cpu->id;
+	struct k_thread *prev = cbs_thread[cpu];
+	uint32_t now;
+
+	if (prev == thread) {
+		return;
+	}
+
+	now = k_cycle_get_32();
+
+	if (prev != NULL) {
+		cbs_charge(cpu, now);
+		z_abort_timeout(&cbs_timeouts[cpu]);
+		cbs_thread[cpu] = NULL;
+		cbs_replenish(prev, false);
+	}
+
+	if (has_reservation(thread)) {
+		cbs_thread[cpu] = thread;
+		cbs_stamp[cpu] = now;
+		cbs_arm(cpu);
+	}
+}
+
+void z_cbs_wakeup(struct k_thread *thread)
+{
+	if (!has_reservation(thread)) {
+		return;
+	}
+
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)((uint32_t)thread->base.prio_deadline - now);
+
+	/* remaining / left >= budget / period, cross-multiplied */
+	if ((left <= 0) ||
+	    ((int64_t)thread->base.cbs_remaining * thread->base.cbs_period >=
+	     (int64_t)left * thread->base.cbs_budget)) {
+		thread->base.cbs_remaining = (int32_t)thread->base.cbs_budget;
+		thread->base.prio_deadline = now + thread->base.cbs_period;
+	}
+}
+
+int z_impl_k_thread_cbs_set(k_tid_t thread, uint32_t budget, uint32_t period)
+{
+	if ((budget > period) || (period > (uint32_t)INT32_MAX)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&_sched_spinlock) {
+		int cpu = _current_cpu->id;
+
+		/* Stop charging under the old parameters */
+		if (cbs_thread[cpu] == thread) {
+			z_abort_timeout(&cbs_timeouts[cpu]);
+			cbs_thread[cpu] = NULL;
+		}
+
+		thread->base.cbs_budget = budget;
+		thread->base.cbs_period = period;
+		thread->base.cbs_remaining = (int32_t)budget;
+
+		if (budget != 0U) {
+			z_sched_deadline_update(thread, k_cycle_get_32() + period, false);
+		}
+
+		if (thread == _current) {
+			z_cbs_switch(thread);
+		}
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_cbs_set(k_tid_t thread, uint32_t budget, uint32_t period)
+{
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_cbs_set(thread, budget, period);
+}
+#include <zephyr/syscalls/k_thread_cbs_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
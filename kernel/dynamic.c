@@ -36,6 +36,132 @@ static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 	return z_thread_aligned_alloc(align, size);
 }
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CACHE
+#define CACHE_CLASSES CONFIG_DYNAMIC_THREAD_STACK_CACHE_CLASSES
+#define CACHE_CLASS_SIZE(cls) ((size_t)CONFIG_DYNAMIC_THREAD_STACK_CACHE_MIN_SIZE << (cls))
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DYNAMIC_THREAD_STACK_CACHE_MIN_SIZE),
+	     "stack cache size classes must be powers of two");
+
+/* Tracks one class-sized heap stack, whether in use or cached */
+struct stack_cache_ent {
+	sys_snode_t node;
+	k_thread_stack_t *stack;
+	uint8_t cls;
+};
+
+static struct k_spinlock stack_cache_lock;
+static sys_slist_t stack_cache_used;
+static sys_slist_t stack_cache_free[CACHE_CLASSES];
+static uint8_t stack_cache_depth[CACHE_CLASSES];
+static struct k_thread_stack_cache_stats stack_cache_stats;
+
+static int stack_cache_class(size_t size)
+{
+	for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+		if (size <= CACHE_CLASS_SIZE(cls)) {
+			return cls;
+		}
+	}
+
+	return -1;
+}
+
+static k_thread_stack_t *stack_cache_alloc(size_t size)
+{
+	int cls = stack_cache_class(size);
+	struct stack_cache_ent *ent = NULL;
+	sys_snode_t *node;
+
+	if (cls < 0) {
+		return z_thread_stack_alloc_dyn(Z_KERNEL_STACK_OBJ_ALIGN,
+						K_KERNEL_STACK_LEN(size));
+	}
+
+	K_SPINLOCK(&stack_cache_lock) {
+		node = sys_slist_get(&stack_cache_free[cls]);
+		if (node != NULL) {
+			ent = CONTAINER_OF(node, struct stack_cache_ent, node);
+			sys_slist_append(&stack_cache_used, &ent->node);
+			stack_cache_depth[cls]--;
+			stack_cache_stats.cached--;
+			stack_cache_stats.hits++;
+		} else {
+			stack_cache_stats.misses++;
+		}
+	}
+
+	if (ent != NULL) {
+		return ent->stack;
+	}
+
+	ent = z_thread_malloc(sizeof(*ent));
+	if (ent == NULL) {
+		return NULL;
+	}
+
+	ent->stack = z_thread_stack_alloc_dyn(Z_KERNEL_STACK_OBJ_ALIGN,
+					      K_KERNEL_STACK_LEN(CACHE_CLASS_SIZE(cls)));
+	if (ent->stack == NULL) {
+		k_free(ent);
+		return NULL;
+	}
+	ent->cls = cls;
+
+	K_SPINLOCK(&stack_cache_lock) {
+		sys_slist_append(&stack_cache_used, &ent->node);
+	}
+
+	return ent->stack;
+}
+
+/* Returns false if @a stack was not allocated through the cache */
+static bool stack_cache_free_stack(k_thread_stack_t *stack)
+{
+	struct stack_cache_ent *ent;
+	bool found = false;
+	bool release = false;
+
+	K_SPINLOCK(&stack_cache_lock) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&stack_cache_used, ent, node) {
+			if (ent->stack == stack) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found) {
+			K_SPINLOCK_BREAK;
+		}
+
+		(void)sys_slist_find_and_remove(&stack_cache_used, &ent->node);
+
+		if (stack_cache_depth[ent->cls] < CONFIG_DYNAMIC_THREAD_STACK_CACHE_DEPTH) {
+			/* Most recently freed first, it is likelier to be cache hot */
+			sys_slist_prepend(&stack_cache_free[ent->cls], &ent->node);
+			stack_cache_depth[ent->cls]++;
+			stack_cache_stats.cached++;
+		} else {
+			release = true;
+		}
+	}
+
+	if (release) {
+		k_free(ent->stack);
+		k_free(ent);
+	}
+
+	return found;
+}
+
+void k_thread_stack_cache_stats_get(struct k_thread_stack_cache_stats *stats)
+{
+	K_SPINLOCK(&stack_cache_lock) {
+		*stats = stack_cache_stats;
+	}
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE */
+
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 {
 	int rv;
@@ -74,8 +200,12 @@ static k_thread_stack_t *stack_alloc_dyn(size_t size, int flags)
 #endif /* CONFIG_DYNAMIC_OBJECTS */
 	}
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CACHE
+	return stack_cache_alloc(size);
+#else
 	return z_thread_stack_alloc_dyn(Z_KERNEL_STACK_OBJ_ALIGN,
 					K_KERNEL_STACK_LEN(size));
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE */
 }
 
 k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
@@ -146,6 +276,11 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 	}
 
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_ALLOC)) {
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CACHE
+		if (stack_cache_free_stack(stack)) {
+			return 0;
+		}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE */
 #ifdef CONFIG_USERSPACE
 		if (k_object_find(stack)) {
 			k_object_free(stack);
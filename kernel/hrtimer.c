@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/hrtimer.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <zephyr/spinlock.h>
+
+/* Running timers, sorted by expiry. Only a few precise timers are expected,
+ * so a sorted list is good enough.
+ */
+static sys_dlist_t hrtimers = SYS_DLIST_STATIC_INIT(&hrtimers);
+static struct k_spinlock lock;
+
+/* Time last passed to the driver, UINT64_MAX if none is pending */
+static uint64_t programmed = UINT64_MAX;
+
+static void hrtimer_add(struct k_hrtimer *timer)
+{
+	struct k_hrtimer *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&hrtimers, t, node) {
+		if (timer->expiry < t->expiry) {
+			sys_dlist_insert(&t->node, &timer->node);
+			return;
+		}
+	}
+
+	sys_dlist_append(&hrtimers, &timer->node);
+}
+
+static void hrtimer_program(void)
+{
+	struct k_hrtimer *first = SYS_DLIST_PEEK_HEAD_CONTAINER(&hrtimers, first, node);
+	uint64_t expiry = first != NULL ? first->expiry : UINT64_MAX;
+
+	if (expiry != programmed) {
+		programmed = expiry;
+		sys_clock_hrtimer_set(expiry);
+	}
+}
+
+void k_hrtimer_init(struct k_hrtimer *timer, k_hrtimer_expiry_t expiry_fn)
+{
+	sys_dnode_init(&timer->node);
+	timer->expiry = 0;
+	timer->period = 0;
+	timer->expiry_fn = expiry_fn;
+	timer->overruns = 0;
+}
+
+void k_hrtimer_start_at(struct k_hrtimer *timer, uint64_t cycles, uint64_t period)
+{
+	K_SPINLOCK(&lock) {
+		if (sys_dnode_is_linked(&timer->node)) {
+			sys_dlist_remove(&timer->node);
+		}
+
+		timer->expiry = cycles;
+		timer->period = period;
+		timer->overruns = 0;
+		hrtimer_add(timer);
+		hrtimer_program();
+	}
+}
+
+void k_hrtimer_stop(struct k_hrtimer *timer)
+{
+	K_SPINLOCK(&lock) {
+		if (sys_dnode_is_linked(&timer->node)) {
+			sys_dlist_remove(&timer->node);
+			hrtimer_program();
+		}
+	}
+}
+
+uint64_t k_hrtimer_expires_cyc(struct k_hrtimer *timer)
+{
+	uint64_t expiry = 0;
+
+	K_SPINLOCK(&lock) {
+		if (sys_dnode_is_linked(&timer->node)) {
+			expiry = timer->expiry;
+		}
+	}
+
+	return expiry;
+}
+
+uint32_t k_hrtimer_overruns_get(struct k_hrtimer *timer)
+{
+	uint32_t overruns;
+
+	K_SPINLOCK(&lock) {
+		overruns = timer->overruns;
+		timer->overruns = 0;
+	}
+
+	return overruns;
+}
+
+void sys_clock_hrtimer_announce(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_hrtimer *timer;
+	uint64_t now = k_cycle_get_64();
+	uint64_t missed;
+
+	/* The driver consumed the request */
+	programmed = UINT64_MAX;
+
+	while ((timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&hrtimers, timer, node)) != NULL &&
+	       timer->expiry <= now) {
+		sys_dlist_remove(&timer->node);
+
+		if (timer->period != 0) {
+			/* Rearmed before the call, so that it can be stopped */
+			timer->expiry += timer->period;
+			if (timer->expiry <= now) {
+				missed = (now - timer->expiry) / timer->period + 1;
+				timer->overruns += missed;
+				timer->expiry += missed * timer->period;
+			}
+
+			hrtimer_add(timer);
+		}
+
+		k_spin_unlock(&lock, key);
+		timer->expiry_fn(timer);
+		key = k_spin_lock(&lock);
+
+		now = k_cycle_get_64();
+	}
+
+	hrtimer_program();
+
+	k_spin_unlock(&lock, key);
+}
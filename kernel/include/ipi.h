@@ -25,6 +25,7 @@ atomic_val_t ipi_mask_create(struct k_thread *thread);
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
+#define ipi_mask_create(thread) ((atomic_val_t)0)
 #endif /* CONFIG_SMP */
 
 
@@ -110,6 +110,14 @@ static inline void *z_thread_malloc(size_t size)
 	return z_thread_aligned_alloc(0, size);
 }
 
+/* k_heap_aligned_alloc() and k_heap_realloc() on behalf of a wrapper,
+ * caller being what heap profiles should record as call site.
+ */
+void *z_kheap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
+			    k_timeout_t timeout, void *caller);
+void *z_kheap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t timeout,
+		      void *caller);
+
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -277,6 +285,16 @@ int z_kernel_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_kernel_stats_query(struct k_obj_core *obj_core, void *stats);
 #endif /* CONFIG_OBJ_CORE_STATS_SYSTEM */
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+/*
+ * Contended paths of sys_mutex_lock() and sys_mutex_unlock(), with @a mutex
+ * the kernel mutex backing the sys_mutex whose state word is @a val.
+ */
+int z_sys_mutex_lock_slow(struct k_mutex *mutex, atomic_t *val,
+			  k_timeout_t timeout);
+int z_sys_mutex_unlock_slow(struct k_mutex *mutex, atomic_t *val);
+#endif /* CONFIG_SYS_MUTEX_FAST */
+
 #if defined(CONFIG_THREAD_ABORT_NEED_CLEANUP)
 /**
  * Perform cleanup at the end of k_thread_abort().
@@ -74,6 +74,25 @@ void z_thread_abort(struct k_thread *thread);
 void move_thread_to_end_of_prio_q(struct k_thread *thread);
 bool thread_is_sliceable(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_DEADLINE
+/* Set the absolute deadline of a thread, requeueing it if needed and
+ * optionally updating the cached scheduling decision.  Must be called
+ * with the scheduler lock held.
+ */
+void z_sched_deadline_update(struct k_thread *thread, uint32_t deadline, bool resched);
+#endif /* CONFIG_SCHED_DEADLINE */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth server hooks, called with the scheduler lock held */
+void z_cbs_switch(struct k_thread *thread);
+void z_cbs_wakeup(struct k_thread *thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
+#ifdef CONFIG_RCU
+void z_rcu_qs(void);
+void z_sched_preempt_deferred(void);
+#endif /* CONFIG_RCU */
+
 static inline void z_reschedule_unlocked(void)
 {
 	(void) z_reschedule_irqlock(arch_irq_lock());
@@ -121,6 +140,11 @@ static inline bool z_is_prio_lower_or_equal(int prio1, int prio2)
 
 int32_t z_sched_prio_cmp(struct k_thread *thread_1, struct k_thread *thread_2);
 
+/* True if @a thread is running on a CPU other than the caller's.  Must
+ * be called with interrupts locked.
+ */
+bool z_thread_active_elsewhere(struct k_thread *thread);
+
 static inline bool _is_valid_prio(int prio, void *entry_point)
 {
 	if ((prio == K_IDLE_PRIO) && z_is_idle_thread_entry(entry_point)) {
@@ -242,27 +266,29 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Same as calling z_sched_wake() until the queue is empty, except that
+ * all threads are made ready in a single pass with the scheduler lock
+ * held once, and at most one IPI gets flagged per CPU.
  *
- * @param wait_q Wait queue to wake up the highest prio thread
- * @param swap_retval Swap return value for woken thread
+ * @param wait_q Wait queue to wake up the threads of
+ * @param swap_retval Swap return value for woken threads
  * @param swap_data Data return value to supplement swap_retval. May be NULL.
- * @retval true If any threads were woken up
- * @retval false If the wait_q was empty
+ * @return Number of threads woken up
  */
-static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
-				    void *swap_data)
-{
-	bool woken = false;
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
-	/* True if we woke at least one thread up */
-	return woken;
-}
+#ifdef CONFIG_EVENTS
+/**
+ * Wake up a list of threads whose event wait conditions are met
+ *
+ * The threads are linked through their next_event_link field, and their
+ * timeouts must already have been aborted.  They are all made ready in
+ * a single pass, as with z_sched_wake_all().
+ *
+ * @param head First thread of the list
+ */
+void z_sched_wake_event_threads(struct k_thread *head);
+#endif /* CONFIG_EVENTS */
 
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
@@ -329,6 +355,13 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+/**
+ * @brief Start measuring the wakeup latency of a thread just made ready
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -139,6 +139,12 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 #ifdef CONFIG_TIMESLICING
 		z_reset_time_slice(new_thread);
 #endif /* CONFIG_TIMESLICING */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		z_cbs_switch(new_thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+#ifdef CONFIG_RCU
+		z_rcu_qs();
+#endif /* CONFIG_RCU */
 
 #ifdef CONFIG_SPIN_VALIDATE
 		z_spin_lock_set_owner(&_sched_spinlock);
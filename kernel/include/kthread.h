@@ -221,6 +221,12 @@ static ALWAYS_INLINE bool should_preempt(struct k_thread *thread,
 		return true;
 	}
 
+#ifdef CONFIG_RCU
+	if ((thread != _current) && (_current->base.sched_locked != 0U)) {
+		_current->base.preempt_deferred = true;
+	}
+#endif /* CONFIG_RCU */
+
 	return false;
 }
 
@@ -158,6 +158,11 @@
  */
 #define K_MEM_PAGE_FRAME_BACKED		BIT(5)
 
+/**
+ * This page frame was paged in by read-ahead and hasn't been evicted since
+ */
+#define K_MEM_PAGE_FRAME_READ_AHEAD	BIT(6)
+
 /**
  * Data structure for physical page frames
  *
@@ -220,6 +225,11 @@ static inline bool k_mem_page_frame_is_backed(struct k_mem_page_frame *pf)
 	return (pf->va_and_flags & K_MEM_PAGE_FRAME_BACKED) != 0U;
 }
 
+static inline bool k_mem_page_frame_is_read_ahead(struct k_mem_page_frame *pf)
+{
+	return (pf->va_and_flags & K_MEM_PAGE_FRAME_READ_AHEAD) != 0U;
+}
+
 static inline bool k_mem_page_frame_is_evictable(struct k_mem_page_frame *pf)
 {
 	return (!k_mem_page_frame_is_free(pf) &&
@@ -25,8 +25,19 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static inline void z_set_timeout_slack(struct _timeout *to, k_timeout_t slack)
+{
+	to->slack = K_TIMEOUT_EQ(slack, K_FOREVER) ? INT32_MAX
+						   : (int32_t)CLAMP(slack.ticks, 0, INT32_MAX);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout);
 
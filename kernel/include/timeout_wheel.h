@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+#define ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+
+/**
+ * @file
+ * @brief Hierarchical timing wheel backend for the kernel timeout queue
+ *
+ * Internal to kernel/timeout.c.  All functions must be called with the
+ * timeout lock held.  Timeouts handed to the wheel store their absolute
+ * expiry tick in the dticks field.
+ */
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Insert @a to, whose dticks holds its absolute expiry tick */
+void z_timeout_wheel_add(struct _timeout *to);
+
+/* Remove a pending timeout from the wheel */
+void z_timeout_wheel_remove(struct _timeout *to);
+
+/* Absolute expiry tick of the earliest pending timeout, or INT64_MAX */
+int64_t z_timeout_wheel_next(void);
+
+/*
+ * Remove and return the earliest timeout expiring at or before tick
+ * @a limit, advancing the wheel's notion of "now" to its expiry.  If
+ * there is none, the wheel is advanced to @a limit and NULL returned.
+ */
+struct _timeout *z_timeout_wheel_pop(int64_t limit);
+
+/* Move the wheel's notion of "now" to @a tick, shifting every pending
+ * timeout by the same amount.  Only used by sys_clock_tick_set().
+ */
+void z_timeout_wheel_rebase(int64_t tick);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_ */
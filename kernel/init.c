@@ -333,6 +333,161 @@ static int do_device_init(const struct init_entry *entry)
 	return rc;
 }
 
+static void run_init_entry(const struct init_entry *entry, enum init_level level)
+{
+	int result;
+
+	sys_trace_sys_init_enter(entry, level);
+	if (entry->dev != NULL) {
+		result = do_device_init(entry);
+	} else {
+		result = entry->init_fn.sys();
+	}
+	sys_trace_sys_init_exit(entry, level, result);
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/*
+ * Parallel device initialization.  Entries keep their link order, which
+ * already places every device after the devices it requires, but an
+ * entry may start before earlier ones have finished if it does not
+ * depend on them.  Only a window of entries starting at the first one
+ * not yet finished is considered, so the bookkeeping fits in two
+ * bitmaps instead of needing per-device state.
+ */
+#define PINIT_WINDOW 32
+
+static struct {
+	struct k_mutex lock;
+	struct k_condvar cond;
+	/* Entries before low have finished, bit N refers to low + N */
+	const struct init_entry *low;
+	const struct init_entry *end;
+	uint32_t started;
+	uint32_t done;
+	enum init_level level;
+} pinit;
+
+static K_KERNEL_STACK_ARRAY_DEFINE(pinit_stacks, CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread pinit_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+/* Whether entry low + idx may start, must be locked */
+static bool pinit_ready(unsigned int idx)
+{
+	const struct init_entry *entry = &pinit.low[idx];
+	const device_handle_t *deps;
+	size_t count = 0;
+
+	/* SYS_INIT() hooks have no dependency data, they may rely on
+	 * anything that precedes them.
+	 */
+	if (entry->dev == NULL) {
+		return (pinit.done & BIT_MASK(idx)) == BIT_MASK(idx);
+	}
+
+	deps = device_required_handles_get(entry->dev, &count);
+	for (size_t d = 0; d < count; d++) {
+		const struct device *dep = device_from_handle(deps[d]);
+
+		for (unsigned int k = 0; k < idx; k++) {
+			if ((pinit.low[k].dev == dep) && ((pinit.done & BIT(k)) == 0U)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/* Claim the first entry of the window that may start, must be locked */
+static const struct init_entry *pinit_claim(void)
+{
+	unsigned int n = MIN(PINIT_WINDOW, pinit.end - pinit.low);
+
+	for (unsigned int i = 0; i < n; i++) {
+		if (((pinit.started & BIT(i)) == 0U) && pinit_ready(i)) {
+			pinit.started |= BIT(i);
+			return &pinit.low[i];
+		}
+
+		/* Nothing after a SYS_INIT() hook starts before it is done */
+		if ((pinit.low[i].dev == NULL) && ((pinit.done & BIT(i)) == 0U)) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void pinit_finish(const struct init_entry *entry)
+{
+	pinit.done |= BIT(entry - pinit.low);
+
+	while ((pinit.low < pinit.end) && ((pinit.done & BIT(0)) != 0U)) {
+		pinit.done >>= 1;
+		pinit.started >>= 1;
+		pinit.low++;
+	}
+
+	k_condvar_broadcast(&pinit.cond);
+}
+
+static void pinit_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&pinit.lock, K_FOREVER);
+
+	while (pinit.low < pinit.end) {
+		const struct init_entry *entry = pinit_claim();
+
+		if (entry == NULL) {
+			(void)k_condvar_wait(&pinit.cond, &pinit.lock, K_FOREVER);
+			continue;
+		}
+
+		k_mutex_unlock(&pinit.lock);
+		run_init_entry(entry, pinit.level);
+		k_mutex_lock(&pinit.lock, K_FOREVER);
+
+		pinit_finish(entry);
+	}
+
+	k_mutex_unlock(&pinit.lock);
+}
+
+static void run_level_parallel(const struct init_entry *start,
+			       const struct init_entry *end,
+			       enum init_level level)
+{
+	k_mutex_init(&pinit.lock);
+	k_condvar_init(&pinit.cond);
+	pinit.low = start;
+	pinit.end = end;
+	pinit.started = 0U;
+	pinit.done = 0U;
+	pinit.level = level;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(pinit_threads); i++) {
+		k_thread_create(&pinit_threads[i], pinit_stacks[i],
+				K_KERNEL_STACK_SIZEOF(pinit_stacks[i]),
+				pinit_worker, NULL, NULL, NULL,
+				k_thread_priority_get(_current), 0, K_NO_WAIT);
+		k_thread_name_set(&pinit_threads[i], "device_init");
+	}
+
+	/* The calling thread takes part too */
+	pinit_worker(NULL, NULL, NULL);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(pinit_threads); i++) {
+		(void)k_thread_join(&pinit_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -360,17 +515,15 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-		int result;
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if ((level == INIT_LEVEL_POST_KERNEL) || (level == INIT_LEVEL_APPLICATION)) {
+		run_level_parallel(levels[level], levels[level + 1], level);
+		return;
+	}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
 
-		sys_trace_sys_init_enter(entry, level);
-		if (dev != NULL) {
-			result = do_device_init(entry);
-		} else {
-			result = entry->init_fn.sys();
-		}
-		sys_trace_sys_init_exit(entry, level, result);
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		run_init_entry(entry, level);
 	}
 }
 
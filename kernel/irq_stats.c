@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_stats.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sw_isr_table.h>
+#include <zephyr/sys/math_extras.h>
+#include <string.h>
+
+static struct k_spinlock irq_stats_lock;
+static struct irq_stats irq_stats[IRQ_STATS_NUM_IRQS];
+
+static void hist_record(uint32_t *hist, uint32_t cycles)
+{
+	unsigned int bucket = (cycles < 2U) ? 0U : (31U - u32_count_leading_zeros(cycles));
+
+	hist[MIN(bucket, CONFIG_IRQ_STATS_BUCKETS - 1)]++;
+}
+
+void z_irq_stats_record(unsigned int irq, uint32_t entry, uint32_t start)
+{
+	uint32_t duration = z_irq_stats_now() - start;
+	uint32_t latency = start - entry;
+	struct irq_stats *stats;
+	k_spinlock_key_t key;
+
+	if (irq >= IRQ_STATS_NUM_IRQS) {
+		return;
+	}
+
+	stats = &irq_stats[irq];
+
+	/* The lock only matters for per-CPU interrupts with SMP */
+	key = k_spin_lock(&irq_stats_lock);
+
+	stats->count++;
+	stats->duration_total += duration;
+	stats->duration_max = MAX(stats->duration_max, duration);
+	stats->latency_max = MAX(stats->latency_max, latency);
+	hist_record(stats->duration, duration);
+	hist_record(stats->latency, latency);
+
+	k_spin_unlock(&irq_stats_lock, key);
+}
+
+#ifdef CONFIG_GEN_SW_ISR_TABLE
+/* Deepest nesting level with its own wrapper entry time stamp */
+#define IRQ_STATS_NESTING 8
+
+/* Wrapper entry time stamps of the assembly wrappers, per nesting level */
+static uint32_t irq_stats_entry[CONFIG_MP_MAX_NUM_CPUS][IRQ_STATS_NESTING];
+
+static uint32_t *entry_slot(void)
+{
+	struct _cpu *cpu = _current_cpu;
+
+	/* The wrappers count the running interrupt in nested already */
+	return &irq_stats_entry[cpu->id][MIN(cpu->nested, IRQ_STATS_NESTING) - 1];
+}
+
+void z_irq_stats_enter(void)
+{
+	*entry_slot() = z_irq_stats_now();
+}
+
+void z_irq_stats_isr(unsigned int irq)
+{
+	const struct _isr_table_entry *entry = &_sw_isr_table[irq];
+	uint32_t start = z_irq_stats_now();
+
+	entry->isr(entry->arg);
+
+	z_irq_stats_record(irq, *entry_slot(), start);
+}
+#endif /* CONFIG_GEN_SW_ISR_TABLE */
+
+int irq_stats_query(unsigned int irq, struct irq_stats *stats)
+{
+	if (irq >= IRQ_STATS_NUM_IRQS) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&irq_stats_lock) {
+		*stats = irq_stats[irq];
+	}
+
+	return 0;
+}
+
+int irq_stats_reset(unsigned int irq)
+{
+	if (irq >= IRQ_STATS_NUM_IRQS) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&irq_stats_lock) {
+		(void)memset(&irq_stats[irq], 0, sizeof(irq_stats[irq]));
+	}
+
+	return 0;
+}
@@ -8,15 +8,157 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/kernel/percpu.h>
+#include <zephyr/sys/barrier.h>
+#include <string.h>
 /* private kernel APIs */
+#include <kernel_internal.h>
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+/*
+ * Per-CPU block caches.
+ *
+ * Each CPU keeps a few free blocks per power of two size class, from
+ * 16 bytes up, which it takes and gives back under a lock of its own,
+ * instead of the heap lock shared by all CPUs.  Cached blocks remain
+ * allocated as far as the underlying sys_heap is concerned.
+ *
+ * They are flushed back to the heap, under the heap lock, whenever an
+ * allocation fails.  A thread about to wait for memory counts itself
+ * in the waiters of the heap before flushing.  A freeing CPU checks
+ * that count after caching its block, and wakes the waiters if it is
+ * not zero for them to flush again: either the waiter's flush saw the
+ * block, or the freeing CPU sees the waiter.
+ */
+#define CACHE_MIN_SHIFT 4U
+
+static struct z_kheap_cpu_cache *cpu_cache_get(struct k_heap *heap)
+{
+	/* Migrating after reading the CPU ID is harmless: the cache
+	 * picked is locked anyway, just not uncontended.
+	 */
+	return &heap->cpu_cache[Z_PERCPU_CPU_ID()];
+}
+
+/* Class of an allocation of the given size, if it is cached */
+static int alloc_class(size_t align, size_t bytes)
+{
+	if ((align > sizeof(void *)) || (bytes == 0U) ||
+	    (bytes > CONFIG_KHEAP_CPU_CACHE_MAX_SIZE)) {
+		return -1;
+	}
+
+	if (bytes <= BIT(CACHE_MIN_SHIFT)) {
+		return 0;
+	}
+
+	return LOG2CEIL(bytes) - CACHE_MIN_SHIFT;
+}
+
+/* Largest class a block of the given usable size can serve */
+static int free_class(size_t usable)
+{
+	if (usable < BIT(CACHE_MIN_SHIFT)) {
+		return -1;
+	}
+
+	return MIN(LOG2(usable) - CACHE_MIN_SHIFT, Z_KHEAP_CACHE_CLASSES - 1);
+}
+
+static void *cache_get(struct k_heap *heap, int class)
+{
+	struct z_kheap_cpu_cache *cache;
+	k_spinlock_key_t key;
+	void *mem = NULL;
+
+	cache = cpu_cache_get(heap);
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count[class] != 0U) {
+		mem = cache->blocks[class][--cache->count[class]];
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return mem;
+}
+
+static bool cache_put(struct k_heap *heap, void *mem)
+{
+	int class = free_class(sys_heap_usable_size(&heap->heap, mem));
+	struct z_kheap_cpu_cache *cache;
+	k_spinlock_key_t key;
+	bool cached = false;
+
+	if (class < 0) {
+		return false;
+	}
+
+	cache = cpu_cache_get(heap);
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count[class] < CONFIG_KHEAP_CPU_CACHE_DEPTH) {
+		cache->blocks[class][cache->count[class]++] = mem;
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return cached;
+}
+
+/* Give all cached blocks back to the heap, with the heap lock held */
+static bool cache_flush(struct k_heap *heap)
+{
+	bool flushed = false;
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_kheap_cpu_cache *cache = &heap->cpu_cache[cpu];
+
+		K_SPINLOCK(&cache->lock) {
+			for (int class = 0; class < Z_KHEAP_CACHE_CLASSES; class++) {
+				while (cache->count[class] != 0U) {
+					sys_heap_free(&heap->heap,
+						      cache->blocks[class][--cache->count[class]]);
+					flushed = true;
+				}
+			}
+		}
+	}
+
+	return flushed;
+}
+#endif /* CONFIG_KHEAP_CPU_CACHE */
+
+/* Allocate from the underlying heap, with the heap lock held */
+static void *heap_alloc(struct k_heap *heap, size_t align, size_t bytes, void *caller)
+{
+	z_sys_heap_profile_caller_set(&heap->heap, caller);
+
+	void *ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	if ((ret == NULL) && cache_flush(heap)) {
+		z_sys_heap_profile_caller_set(&heap->heap, caller);
+		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+	}
+#endif
+
+	return ret;
+}
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	atomic_clear(&heap->waiters);
+	(void)memset(heap->cpu_cache, 0, sizeof(heap->cpu_cache));
+#endif
+
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
 
@@ -62,12 +204,29 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
-void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
-			k_timeout_t timeout)
+void *z_kheap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
+			    k_timeout_t timeout, void *caller)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t alloc_bytes = bytes;
 	void *ret = NULL;
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	int class = alloc_class(align, bytes);
+
+	if (class >= 0) {
+		ret = cache_get(heap, class);
+		if (ret != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
+			return ret;
+		}
+
+		/* Make the block fit any request of its class once freed */
+		alloc_bytes = BIT(class + CACHE_MIN_SHIFT);
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
@@ -77,7 +236,10 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+		ret = heap_alloc(heap, align, alloc_bytes, caller);
+		if ((ret == NULL) && (alloc_bytes != bytes)) {
+			ret = heap_alloc(heap, align, bytes, caller);
+		}
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -88,6 +250,14 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			blocked_alloc = true;
 
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_heap, aligned_alloc, heap, timeout);
+
+#ifdef CONFIG_KHEAP_CPU_CACHE
+			/* Blocks cached from now on get flushed by their
+			 * freeing CPU, flush those cached until now.
+			 */
+			atomic_inc(&heap->waiters);
+			continue;
+#endif
 		} else {
 			/**
 			 * @todo	Trace attempt to avoid empty trace segments
@@ -99,24 +269,38 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	if (blocked_alloc) {
+		atomic_dec(&heap->waiters);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
 
+void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
+			k_timeout_t timeout)
+{
+	return z_kheap_aligned_alloc(heap, align, bytes, timeout, Z_HEAP_CALLER());
+}
+
 void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
-	void *ret = k_heap_aligned_alloc(heap, sizeof(void *), bytes, timeout);
+	void *ret = z_kheap_aligned_alloc(heap, sizeof(void *), bytes, timeout,
+					  Z_HEAP_CALLER());
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
 	return ret;
 }
 
-void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t timeout)
+void *z_kheap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t timeout,
+		      void *caller)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
@@ -128,8 +312,16 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	while (ret == NULL) {
+		z_sys_heap_profile_caller_set(&heap->heap, caller);
 		ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+		if ((ret == NULL) && cache_flush(heap)) {
+			z_sys_heap_profile_caller_set(&heap->heap, caller);
+			ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -146,8 +338,27 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	return ret;
 }
 
+void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t timeout)
+{
+	return z_kheap_realloc(heap, ptr, bytes, timeout, Z_HEAP_CALLER());
+}
+
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	if ((mem != NULL) && cache_put(heap, mem)) {
+		/* Pairs with the barrier of atomic_inc() in the waiter */
+		barrier_dmem_fence_full();
+		if (atomic_get(&heap->waiters) == 0) {
+			SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+			return;
+		}
+
+		/* Just wake the waiters, they flush the caches on retry */
+		mem = NULL;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
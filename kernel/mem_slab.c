@@ -33,6 +33,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = z_mem_slab_num_used(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +49,9 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	ptr->free_bytes = (slab->info.num_blocks - z_mem_slab_num_used(slab)) *
 			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->allocated_bytes = z_mem_slab_num_used(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -183,6 +184,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+	atomic_clear(&slab->cache_bypass);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -216,12 +222,119 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 }
 #endif
 
-int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/*
+ * Per-CPU caches.
+ *
+ * Blocks in a cache have been taken off the free list and are counted in
+ * info.num_used, so the slab lock is only needed to move a batch between
+ * a cache and the free list.  A cache's lock is always taken before the
+ * slab lock.  The caller's CPU is pinned by locking interrupts across the
+ * whole cache operation.
+ */
+#define CACHE_BATCH MAX(CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2, 1)
+
+/* Move up to @a n blocks from the free list into @a cache */
+static void cache_refill(struct k_mem_slab *slab, struct k_mem_slab_cpu_cache *cache,
+			 uint32_t n)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
-	int result;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+	while ((n > 0U) && (slab->free_list != NULL)) {
+		cache->blocks[cache->count++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+		slab->info.num_used++;
+		n--;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+/* Move up to @a n blocks from @a cache back onto the free list */
+static void cache_flush(struct k_mem_slab *slab, struct k_mem_slab_cpu_cache *cache,
+			uint32_t n)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	while ((n > 0U) && (cache->count > 0U)) {
+		char *block = cache->blocks[--cache->count];
+
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+		slab->info.num_used--;
+		n--;
+	}
+
+	k_spin_unlock(&slab->lock, key);
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool ret = false;
+
+	if (cache->count == 0U) {
+		cache_refill(slab, cache, CACHE_BATCH);
+	}
+
+	if (cache->count > 0U) {
+		*mem = cache->blocks[--cache->count];
+		ret = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return ret;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool ret = false;
+
+	/* Checked under the cache lock: a thread entering the slow path
+	 * raises cache_bypass before reclaiming this cache, so either it
+	 * reclaims this block or this free sees the flag.
+	 */
+	if (atomic_get(&slab->cache_bypass) == 0) {
+		if (cache->count == CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+			cache_flush(slab, cache, CACHE_BATCH);
+		}
+		cache->blocks[cache->count++] = mem;
+		ret = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq);
+
+	return ret;
+}
+
+/* Return the blocks of every CPU's cache to the free list */
+static void cache_reclaim_all(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		if (cache->count > 0U) {
+			cache_flush(slab, cache, cache->count);
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+static int slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	int result;
 
 	if (slab->free_list != NULL) {
 		/* take a free block */
@@ -253,25 +366,62 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
-		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
-
 		return result;
 	}
 
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
-
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
 }
 
-void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	/* The free list is empty: fall back to the slab itself, with the
+	 * blocks cached on other CPUs returned to it and further frees
+	 * kept out of the caches until this allocation completes.
+	 */
+	atomic_inc(&slab->cache_bypass);
+	cache_reclaim_all(slab);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	result = slab_alloc(slab, mem, timeout);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_dec(&slab->cache_bypass);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
 	__ASSERT(slab_ptr_is_good(slab, mem), "Invalid memory pointer provided");
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
 	if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
 		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
 
@@ -301,8 +451,8 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = z_mem_slab_num_used(slab) * slab->info.block_size;
+	stats->free_bytes = (slab->info.num_blocks - z_mem_slab_num_used(slab)) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
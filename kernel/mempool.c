@@ -8,8 +8,10 @@
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
 
-static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size)
+static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size,
+				  void *caller)
 {
 	void *mem;
 	struct k_heap **heap_ref;
@@ -26,7 +28,7 @@ static void *z_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t size
 	}
 	__align = align | sizeof(heap_ref);
 
-	mem = k_heap_aligned_alloc(heap, __align, size, K_NO_WAIT);
+	mem = z_kheap_aligned_alloc(heap, __align, size, K_NO_WAIT, caller);
 	if (mem == NULL) {
 		return NULL;
 	}
@@ -62,7 +64,7 @@ void k_free(void *ptr)
 K_HEAP_DEFINE(_system_heap, K_HEAP_MEM_POOL_SIZE);
 #define _SYSTEM_HEAP (&_system_heap)
 
-void *k_aligned_alloc(size_t align, size_t size)
+static void *aligned_alloc_at(size_t align, size_t size, void *caller)
 {
 	__ASSERT(align / sizeof(void *) >= 1
 		&& (align % sizeof(void *)) == 0,
@@ -73,24 +75,34 @@ void *k_aligned_alloc(size_t align, size_t size)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
-	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size);
+	void *ret = z_heap_aligned_alloc(_SYSTEM_HEAP, align, size, caller);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
-void *k_malloc(size_t size)
+void *k_aligned_alloc(size_t align, size_t size)
+{
+	return aligned_alloc_at(align, size, Z_HEAP_CALLER());
+}
+
+static void *malloc_at(size_t size, void *caller)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_malloc, _SYSTEM_HEAP);
 
-	void *ret = k_aligned_alloc(sizeof(void *), size);
+	void *ret = aligned_alloc_at(sizeof(void *), size, caller);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_malloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
+void *k_malloc(size_t size)
+{
+	return malloc_at(size, Z_HEAP_CALLER());
+}
+
 void *k_calloc(size_t nmemb, size_t size)
 {
 	void *ret;
@@ -104,7 +116,7 @@ void *k_calloc(size_t nmemb, size_t size)
 		return NULL;
 	}
 
-	ret = k_malloc(bounds);
+	ret = malloc_at(bounds, Z_HEAP_CALLER());
 	if (ret != NULL) {
 		(void)memset(ret, 0, bounds);
 	}
@@ -124,7 +136,7 @@ void *k_realloc(void *ptr, size_t size)
 		return NULL;
 	}
 	if (ptr == NULL) {
-		return k_malloc(size);
+		return malloc_at(size, Z_HEAP_CALLER());
 	}
 	heap_ref = ptr;
 	ptr = --heap_ref;
@@ -137,7 +149,7 @@ void *k_realloc(void *ptr, size_t size)
 		return NULL;
 	}
 
-	ret = k_heap_realloc(heap, ptr, size, K_NO_WAIT);
+	ret = z_kheap_realloc(heap, ptr, size, K_NO_WAIT, Z_HEAP_CALLER());
 
 	if (ret != NULL) {
 		heap_ref = ret;
@@ -169,7 +181,7 @@ void *z_thread_aligned_alloc(size_t align, size_t size)
 	}
 
 	if (heap != NULL) {
-		ret = z_heap_aligned_alloc(heap, align, size);
+		ret = z_heap_aligned_alloc(heap, align, size, Z_HEAP_CALLER());
 	} else {
 		ret = NULL;
 	}
@@ -1309,6 +1309,25 @@ static void virt_region_foreach(void *addr, size_t size,
  *
  * Returns -ENOMEM if the backing store is full
  */
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+/* Account for a data page brought in by read-ahead leaving its page frame */
+static void read_ahead_release(struct k_mem_page_frame *pf)
+{
+	if (!k_mem_page_frame_is_read_ahead(pf)) {
+		return;
+	}
+
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_READ_AHEAD);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+
+	if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+		paging_stats.read_ahead.hits++;
+	}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_ptr,
 				     bool page_fault, uintptr_t *location_ptr)
 {
@@ -1346,6 +1365,9 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 			LOG_ERR("out of backing store memory");
 			return -ENOMEM;
 		}
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+		read_ahead_release(pf);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 		arch_mem_page_out(k_mem_page_frame_to_virt(pf), *location_ptr);
 		k_mem_paging_eviction_remove(pf);
 	} else {
@@ -1602,6 +1624,60 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+/* Page in the data pages following the faulting one at @p addr while they
+ * are paged out. Only free page frames are used: read-ahead never evicts.
+ *
+ * Called and returns with z_mm_lock held, @p key is updated when the lock
+ * is released around the backing store accesses.
+ */
+static void do_read_ahead(void *addr, k_spinlock_key_t *key)
+{
+	uint8_t *pos = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						  CONFIG_MMU_PAGE_SIZE));
+	struct k_mem_page_frame *pf;
+	uintptr_t page_in_location, page_out_location;
+	bool dirty;
+	int ret;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_READ_AHEAD; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= K_MEM_VIRT_RAM_END ||
+		    arch_page_location_get(pos, &page_in_location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+
+		dirty = false;
+		ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+		__ASSERT(ret == 0 && !dirty, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key = k_spin_lock(&z_mm_lock);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		frame_mapped_set(pf, pos);
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_READ_AHEAD);
+
+		arch_mem_page_in(pos, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+		k_mem_paging_eviction_add(pf);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		paging_stats.read_ahead.pages++;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1741,6 +1817,9 @@ static bool do_page_fault(void *addr, bool pin)
 	if (!pin) {
 		k_mem_paging_eviction_add(pf);
 	}
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+	do_read_ahead(addr, &key);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
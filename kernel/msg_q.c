@@ -62,6 +62,167 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	k_object_init(msgq);
 }
 
+#ifdef CONFIG_MSGQ_SPSC
+void k_msgq_init_spsc(struct k_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs)
+{
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+
+	msgq->flags = K_MSGQ_FLAG_SPSC;
+	atomic_clear(&msgq->spsc_used);
+	atomic_clear(&msgq->spsc_waiting);
+}
+
+/*
+ * In single producer single consumer mode, the producer owns write_ptr,
+ * the consumer owns read_ptr, and both update spsc_used atomically.  The
+ * queue lock is only taken to wait, or to wake up the other side.
+ *
+ * A side about to wait sets spsc_waiting with the lock held, then checks
+ * the queue again before pending.  The other side updates spsc_used
+ * before checking spsc_waiting.  Both accesses being sequentially
+ * consistent atomics, either the side about to wait sees the update, or
+ * the other side sees spsc_waiting set and wakes it up.  The producer
+ * and the consumer can never both wait, as the queue cannot be full and
+ * empty at the same time.
+ */
+
+static void spsc_wake(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+
+	if (likely(atomic_get(&msgq->spsc_waiting) == 0)) {
+		return;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	atomic_clear(&msgq->spsc_waiting);
+
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (pending_thread != NULL) {
+		/* the woken thread comes back for the message or the space */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+}
+
+static bool spsc_try_put(struct k_msgq *msgq, const void *data)
+{
+	if ((uint32_t)atomic_get(&msgq->spsc_used) == msgq->max_msgs) {
+		return false;
+	}
+
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	msgq->write_ptr += msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+
+	/* publishes the message */
+	(void)atomic_inc(&msgq->spsc_used);
+
+	return true;
+}
+
+static bool spsc_try_get(struct k_msgq *msgq, void *data)
+{
+	if (atomic_get(&msgq->spsc_used) == 0) {
+		return false;
+	}
+
+	(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+
+	/* gives the slot back to the producer */
+	(void)atomic_dec(&msgq->spsc_used);
+
+	return true;
+}
+
+/* Wait for the other side to make progress.  Returns 0 once the caller
+ * should try again, or -EAGAIN if the timeout expired.
+ */
+static int spsc_wait(struct k_msgq *msgq, bool put, k_timepoint_t end)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	atomic_val_t used;
+	int result;
+
+	atomic_set(&msgq->spsc_waiting, 1);
+
+	used = atomic_get(&msgq->spsc_used);
+	if (put ? ((uint32_t)used < msgq->max_msgs) : (used != 0)) {
+		k_spin_unlock(&msgq->lock, key);
+		return 0;
+	}
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, sys_timepoint_timeout(end));
+	if (result != 0) {
+		K_SPINLOCK(&msgq->lock) {
+			if (z_waitq_head(&msgq->wait_q) == NULL) {
+				atomic_clear(&msgq->spsc_waiting);
+			}
+		}
+	}
+
+	return result;
+}
+
+static int spsc_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int result = 0;
+
+	while (!spsc_try_put(msgq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+		result = spsc_wait(msgq, true, end);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	spsc_wake(msgq);
+
+	return result;
+}
+
+static int spsc_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int result = 0;
+
+	while (!spsc_try_get(msgq, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		result = spsc_wait(msgq, false, end);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	spsc_wake(msgq);
+
+	return result;
+}
+#endif /* CONFIG_MSGQ_SPSC */
+
 int z_impl_k_msgq_alloc_init(struct k_msgq *msgq, size_t msg_size,
 			    uint32_t max_msgs)
 {
@@ -129,6 +290,18 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_SPSC
+	if ((msgq->flags & K_MSGQ_FLAG_SPSC) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+		result = spsc_put(msgq, data, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_SPSC */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
@@ -199,7 +372,7 @@ void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
-	attrs->used_msgs = msgq->used_msgs;
+	attrs->used_msgs = z_msgq_used(msgq);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -221,6 +394,18 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	struct k_thread *pending_thread;
 	int result;
 
+#ifdef CONFIG_MSGQ_SPSC
+	if ((msgq->flags & K_MSGQ_FLAG_SPSC) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+
+		result = spsc_get(msgq, data, timeout);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_SPSC */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
@@ -300,7 +485,7 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 
 	key = k_spin_lock(&msgq->lock);
 
-	if (msgq->used_msgs > 0U) {
+	if (z_msgq_used(msgq) > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
 		result = 0;
@@ -337,7 +522,7 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 
 	key = k_spin_lock(&msgq->lock);
 
-	if (msgq->used_msgs > idx) {
+	if (z_msgq_used(msgq) > idx) {
 		bytes_to_end = (msgq->buffer_end - msgq->read_ptr);
 		byte_offset = idx * msgq->msg_size;
 		start_addr = msgq->read_ptr;
@@ -389,6 +574,28 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 		z_ready_thread(pending_thread);
 	}
 
+#ifdef CONFIG_MSGQ_SPSC
+	if ((msgq->flags & K_MSGQ_FLAG_SPSC) != 0U) {
+		/* the producer may be putting messages meanwhile: only drop
+		 * the ones seen here, leaving write_ptr to the producer
+		 */
+		atomic_val_t used = atomic_get(&msgq->spsc_used);
+
+		if (used != 0) {
+			size_t offset = (msgq->read_ptr - msgq->buffer_start) +
+					((size_t)used * msgq->msg_size);
+
+			msgq->read_ptr = msgq->buffer_start +
+					 (offset % (msgq->buffer_end - msgq->buffer_start));
+			(void)atomic_sub(&msgq->spsc_used, used);
+		}
+		atomic_clear(&msgq->spsc_waiting);
+
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+#endif /* CONFIG_MSGQ_SPSC */
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
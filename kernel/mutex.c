@@ -37,6 +37,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/mutex.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
@@ -102,11 +103,43 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Wait for a mutex owned by another thread to be released, for as long
+ * as its owner keeps running on another CPU and at most
+ * CONFIG_MUTEX_ADAPTIVE_SPIN_US.  The mutex state is polled without the
+ * lock so the owner can unlock meanwhile; the lock is held again on
+ * return and the caller re-checks the mutex.
+ */
+static void mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	struct k_thread *owner = mutex->owner;
+	bool running = true;
+
+	k_spin_unlock(&lock, *key);
+
+	while (running && (owner != NULL) &&
+	       ((k_cycle_get_32() - start) < limit)) {
+		unsigned int irq = arch_irq_lock();
+
+		arch_spin_relax();
+		owner = *(struct k_thread *volatile *)&mutex->owner;
+		running = (owner != NULL) && z_thread_active_elsewhere(owner);
+		arch_irq_unlock(irq);
+	}
+
+	*key = k_spin_lock(&lock);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+static int mutex_lock_locked(struct k_mutex *mutex, k_timeout_t timeout,
+			     k_spinlock_key_t key);
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
-	int new_prio;
 	k_spinlock_key_t key;
-	bool resched = false;
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -114,6 +147,26 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    z_thread_active_elsewhere(mutex->owner)) {
+		mutex_spin(mutex, &key);
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+	return mutex_lock_locked(mutex, timeout, key);
+}
+
+/* Lock or wait for @a mutex, with the module lock held.  The lock is
+ * released on return.
+ */
+static int mutex_lock_locked(struct k_mutex *mutex, k_timeout_t timeout,
+			     k_spinlock_key_t key)
+{
+	int new_prio;
+	bool resched = false;
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -208,10 +261,52 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+/* Hand @a mutex over to its first waiter, if any, with the module lock
+ * held, then release the lock.  @a user_val is the state word of the
+ * sys_mutex backed by @a mutex, or NULL.
+ */
+static void mutex_release_locked(struct k_mutex *mutex, k_spinlock_key_t key,
+				 atomic_t *user_val)
 {
 	struct k_thread *new_owner;
 
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	/* Get the new owner, if any */
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+
+	mutex->owner = new_owner;
+
+	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
+		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
+
+#ifdef CONFIG_SYS_MUTEX_FAST
+	if (user_val != NULL) {
+		(void)atomic_set(user_val, (new_owner != NULL) ?
+				 ((atomic_val_t)new_owner | Z_SYS_MUTEX_KERNEL) : 0);
+	}
+#else
+	ARG_UNUSED(user_val);
+#endif /* CONFIG_SYS_MUTEX_FAST */
+
+	if (unlikely(new_owner != NULL)) {
+		/*
+		 * new owner is already of higher or equal prio than first
+		 * waiter since the wait queue is priority-based: no need to
+		 * adjust its priority
+		 */
+		mutex->owner_orig_prio = new_owner->base.prio;
+		arch_thread_return_value_set(new_owner, 0);
+		z_ready_thread(new_owner);
+		z_reschedule(&lock, key);
+	} else {
+		mutex->lock_count = 0U;
+		k_spin_unlock(&lock, key);
+	}
+}
+
+int z_impl_k_mutex_unlock(struct k_mutex *mutex)
+{
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, unlock, mutex);
@@ -249,33 +344,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
-
-	adjust_owner_prio(mutex, mutex->owner_orig_prio);
-
-	/* Get the new owner, if any */
-	new_owner = z_unpend_first_thread(&mutex->wait_q);
-
-	mutex->owner = new_owner;
-
-	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
-		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
-
-	if (unlikely(new_owner != NULL)) {
-		/*
-		 * new owner is already of higher or equal prio than first
-		 * waiter since the wait queue is priority-based: no need to
-		 * adjust its priority
-		 */
-		mutex->owner_orig_prio = new_owner->base.prio;
-		arch_thread_return_value_set(new_owner, 0);
-		z_ready_thread(new_owner);
-		z_reschedule(&lock, key);
-	} else {
-		mutex->lock_count = 0U;
-		k_spin_unlock(&lock, key);
-	}
-
+	mutex_release_locked(mutex, k_spin_lock(&lock), NULL);
 
 k_mutex_unlock_return:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, 0);
@@ -292,6 +361,100 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FAST
+static bool is_thread_object(struct k_thread *thread)
+{
+	struct k_object *ko = k_object_find(thread);
+
+	return (ko != NULL) && (ko->type == K_OBJ_THREAD) &&
+	       ((ko->flags & K_OBJ_FLAG_INITIALIZED) != 0U);
+}
+
+int z_sys_mutex_lock_slow(struct k_mutex *mutex, atomic_t *val,
+			  k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t self = (atomic_val_t)_current;
+	atomic_val_t v;
+
+	for (;;) {
+		v = atomic_get(val);
+
+		if (v == 0) {
+			if (atomic_cas(val, 0, self)) {
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		if ((v & Z_SYS_MUTEX_KERNEL) != 0) {
+			break;
+		}
+
+		/* Locked from user space, which the kernel mutex doesn't know
+		 * about yet.  The owner in the user-writable word is only
+		 * trusted once it is known to be a live thread.
+		 */
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		if ((v == self) || !is_thread_object((struct k_thread *)v)) {
+			k_spin_unlock(&lock, key);
+			return -EINVAL;
+		}
+
+		/* From here on the owner's unlock fails its atomic fast path
+		 * and comes through z_sys_mutex_unlock_slow().
+		 */
+		if (atomic_cas(val, v, v | Z_SYS_MUTEX_KERNEL)) {
+			__ASSERT_NO_MSG(mutex->lock_count == 0U);
+
+			mutex->owner = (struct k_thread *)v;
+			mutex->owner_orig_prio = mutex->owner->base.prio;
+			mutex->lock_count = 1U;
+			break;
+		}
+	}
+
+	/* The kernel mutex is owned by another thread: wait for it, with
+	 * priority inheritance.  mutex_release_locked() updates the word
+	 * when handing it over.
+	 */
+	return mutex_lock_locked(mutex, timeout, key);
+}
+
+int z_sys_mutex_unlock_slow(struct k_mutex *mutex, atomic_t *val)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t v = atomic_get(val);
+
+	if (v == 0) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if ((v & ~Z_SYS_MUTEX_KERNEL) != (atomic_val_t)_current) {
+		k_spin_unlock(&lock, key);
+		return -EPERM;
+	}
+
+	if ((v & Z_SYS_MUTEX_KERNEL) == 0) {
+		(void)atomic_set(val, 0);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	__ASSERT_NO_MSG((mutex->owner == _current) && (mutex->lock_count == 1U));
+
+	mutex_release_locked(mutex, key, val);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -109,22 +110,32 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no thread of their own: their events queue up behind
+ * those of polling threads, in registration order.
+ */
+static inline bool is_poll_set_event(struct k_poll_event *event)
+{
+	return event->poller->mode == MODE_SET;
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	if ((pending == NULL) || (poller->mode == MODE_SET) ||
+		(!is_poll_set_event(pending) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+							   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (is_poll_set_event(pending) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -152,6 +163,8 @@ static inline void register_event(struct k_poll_event *event,
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
 		__ASSERT(event->msgq != NULL, "invalid message queue\n");
+		__ASSERT((event->msgq->flags & K_MSGQ_FLAG_SPSC) == 0U,
+			 "single producer single consumer message queue\n");
 		add_event(&event->msgq->poll_events, event, poller);
 		break;
 #ifdef CONFIG_PIPES
@@ -448,6 +461,9 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			/* The event stays owned by its poll set */
+			return signal_poll_set(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -813,3 +829,136 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set, poller);
+
+	/* The object has just unlinked the event: reuse its node to put it
+	 * on the ready list until the next wait.
+	 */
+	event->state |= state;
+	if (!sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_append(&set->ready, &event->_node);
+	}
+
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+/* must be called with interrupts locked */
+static void poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	if (is_condition_met(event, &state)) {
+		event->state = state;
+		event->poller = &set->poller;
+		sys_dlist_append(&set->ready, &event->_node);
+	} else {
+		event->state = K_POLL_STATE_NOT_READY;
+		register_event(event, &set->poller);
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->returned);
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY,
+		 "only NOTIFY_ONLY mode is supported\n");
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EALREADY;
+	}
+
+	poll_set_arm(set, event);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* Linked into its object, the ready list or the returned list */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	int n = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+	__ASSERT(max_events > 0, "<=0 events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Re-check the events handed out last time, which are no longer
+	 * registered with their objects.
+	 */
+	while ((node = sys_dlist_get(&set->returned)) != NULL) {
+		poll_set_arm(set, CONTAINER_OF(node, struct k_poll_event, _node));
+		k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		int rc;
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+
+		if ((rc != 0) && sys_dlist_is_empty(&set->ready)) {
+			k_spin_unlock(&lock, key);
+			return rc;
+		}
+
+		/* Woken, but the event may have been removed since */
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	while ((n < max_events) && ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		ready[n++] = CONTAINER_OF(node, struct k_poll_event, _node);
+		sys_dlist_append(&set->returned, node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return n;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Read-copy-update.
+ *
+ * Read-side sections lock the scheduler, so a reader stays the current
+ * thread of its CPU until it is done.  A CPU has thus left every
+ * section it was in when a grace period started once it has switched
+ * context, which the scheduler counts in rcu_qs_count, or once it is
+ * seen running outside of any section: no ISR and a current thread that
+ * is idle or does not have the scheduler locked.
+ *
+ * Grace periods are driven from the system workqueue, which polls
+ * every tick while one is in progress.  Callbacks are queued in order
+ * and tagged with the number of completed grace periods after which
+ * they may run: one more than now if no grace period is in progress,
+ * two more if one is, as it may have started before the caller's
+ * update was published.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/percpu.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/sys/barrier.h>
+#include <ksched.h>
+#include <kthread.h>
+
+static struct k_spinlock rcu_lock;
+static sys_slist_t rcu_cbs = SYS_SLIST_STATIC_INIT(&rcu_cbs);
+
+static uint32_t rcu_completed;
+static bool rcu_gp_active;
+
+/* CPUs still to pass a quiescent state, and their switch count then */
+static uint32_t rcu_pending;
+static uint32_t rcu_snap[CONFIG_MP_MAX_NUM_CPUS];
+
+K_PERCPU_DEFINE_STATIC(uint32_t, rcu_qs_count);
+
+static void rcu_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(rcu_work, rcu_work_fn);
+
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32);
+
+void k_rcu_read_lock(void)
+{
+	if (!arch_is_in_isr()) {
+		z_sched_lock();
+	}
+}
+
+void k_rcu_read_unlock(void)
+{
+	if (arch_is_in_isr()) {
+		return;
+	}
+
+	__ASSERT(_current->base.sched_locked != 0U, "");
+
+	compiler_barrier();
+	++_current->base.sched_locked;
+
+	if ((_current->base.sched_locked == 0U) && _current->base.preempt_deferred) {
+		z_sched_preempt_deferred();
+	}
+}
+
+void z_rcu_qs(void)
+{
+	(*K_PERCPU_PTR(rcu_qs_count))++;
+}
+
+static bool cpu_quiescent(unsigned int cpu)
+{
+	struct _cpu *c = &_kernel.cpus[cpu];
+	struct k_thread *thread;
+
+	if (*(volatile uint32_t *)K_PERCPU_CPU_PTR(rcu_qs_count, cpu) != rcu_snap[cpu]) {
+		return true;
+	}
+
+	if (*(volatile uint32_t *)&c->nested != 0U) {
+		return false;
+	}
+
+	thread = *(struct k_thread *volatile *)&c->current;
+
+	return (thread == c->idle_thread) ||
+	       (*(volatile uint8_t *)&thread->base.sched_locked == 0U);
+}
+
+static void gp_start(void)
+{
+	/* Get the updates being waited for out before sampling CPUs */
+	barrier_dmem_fence_full();
+
+	rcu_pending = 0U;
+	K_PERCPU_FOREACH_CPU(cpu) {
+		rcu_snap[cpu] = *(volatile uint32_t *)K_PERCPU_CPU_PTR(rcu_qs_count, cpu);
+		rcu_pending |= BIT(cpu);
+	}
+	rcu_gp_active = true;
+}
+
+/* Progress the grace period in progress, starting the next one if
+ * callbacks wait for it.  Returns true if the grace period completed.
+ */
+static bool gp_advance(void)
+{
+	K_PERCPU_FOREACH_CPU(cpu) {
+		if (((rcu_pending & BIT(cpu)) != 0U) && cpu_quiescent(cpu)) {
+			rcu_pending &= ~BIT(cpu);
+		}
+	}
+
+	if (rcu_pending != 0U) {
+		return false;
+	}
+
+	barrier_dmem_fence_full();
+
+	rcu_completed++;
+	rcu_gp_active = false;
+
+	if (!sys_slist_is_empty(&rcu_cbs)) {
+		struct k_rcu_head *last = CONTAINER_OF(sys_slist_peek_tail(&rcu_cbs),
+						       struct k_rcu_head, node);
+
+		if ((int32_t)(last->seq - rcu_completed) > 0) {
+			gp_start();
+		}
+	}
+
+	return true;
+}
+
+static void rcu_work_fn(struct k_work *work)
+{
+	sys_slist_t ready;
+	sys_snode_t *node;
+	bool more;
+
+	ARG_UNUSED(work);
+
+	sys_slist_init(&ready);
+
+	K_SPINLOCK(&rcu_lock) {
+		while (rcu_gp_active) {
+			if (!gp_advance()) {
+				break;
+			}
+		}
+
+		while ((node = sys_slist_peek_head(&rcu_cbs)) != NULL) {
+			struct k_rcu_head *head = CONTAINER_OF(node, struct k_rcu_head, node);
+
+			if ((int32_t)(head->seq - rcu_completed) > 0) {
+				break;
+			}
+			(void)sys_slist_get_not_empty(&rcu_cbs);
+			sys_slist_append(&ready, node);
+		}
+
+		more = rcu_gp_active;
+	}
+
+	while ((node = sys_slist_get(&ready)) != NULL) {
+		struct k_rcu_head *head = CONTAINER_OF(node, struct k_rcu_head, node);
+
+		head->cb(head);
+	}
+
+	if (more) {
+		(void)k_work_schedule(&rcu_work, K_TICKS(1));
+	}
+}
+
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t cb)
+{
+	head->cb = cb;
+
+	K_SPINLOCK(&rcu_lock) {
+		head->seq = rcu_completed + (rcu_gp_active ? 2U : 1U);
+		sys_slist_append(&rcu_cbs, &head->node);
+
+		if (!rcu_gp_active) {
+			gp_start();
+		}
+	}
+
+	(void)k_work_reschedule(&rcu_work, K_NO_WAIT);
+}
+
+struct rcu_sync {
+	struct k_rcu_head head;
+	struct k_sem sem;
+};
+
+static void rcu_sync_cb(struct k_rcu_head *head)
+{
+	struct rcu_sync *sync = CONTAINER_OF(head, struct rcu_sync, head);
+
+	k_sem_give(&sync->sem);
+}
+
+void k_rcu_synchronize(void)
+{
+	struct rcu_sync sync;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(k_current_get() != k_work_queue_thread_get(&k_sys_work_q),
+		 "would wait on itself");
+
+	k_sem_init(&sync.sem, 0, 1);
+	k_rcu_call(&sync.head, rcu_sync_cb);
+	(void)k_sem_take(&sync.sem, K_FOREVER);
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader-writer lock kernel services
+ *
+ * Readers share the lock, writers own it exclusively.  Readers and
+ * writers wait on separate priority-ordered queues; a reader only gets
+ * the lock right away if no writer holds it or waits for it.  When the
+ * lock becomes free it goes to the first waiting writer, unless the
+ * first waiting reader has a strictly higher priority, in which case
+ * every waiting reader gets it.
+ *
+ * The writer holding the lock inherits the priority of the highest
+ * priority waiter, following the same nesting rules as mutexes.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <ksched.h>
+#include <kthread.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/tracing/tracing.h>
+#include <zephyr/sys/check.h>
+
+/* Global for the same reason as the mutex lock: priority inheritance
+ * touches the priority of threads outside of the rwlock.
+ */
+static struct k_spinlock lock;
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	rwlock->writer = NULL;
+	rwlock->readers = 0U;
+
+	z_waitq_init(&rwlock->rd_wait_q);
+	z_waitq_init(&rwlock->wr_wait_q);
+
+	k_object_init(rwlock);
+
+	SYS_PORT_TRACING_OBJ_INIT(k_rwlock, rwlock, 0);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	return z_get_new_prio_with_ceiling(new_prio);
+}
+
+/* Bring the writer's priority in line with the current waiters */
+static bool adjust_writer_prio(struct k_rwlock *rwlock)
+{
+	int32_t new_prio = rwlock->writer_orig_prio;
+	struct k_thread *waiter;
+
+	if (rwlock->writer == NULL) {
+		return false;
+	}
+
+	waiter = z_waitq_head(&rwlock->wr_wait_q);
+	if (waiter != NULL) {
+		new_prio = new_prio_for_inheritance(waiter->base.prio, new_prio);
+	}
+
+	waiter = z_waitq_head(&rwlock->rd_wait_q);
+	if (waiter != NULL) {
+		new_prio = new_prio_for_inheritance(waiter->base.prio, new_prio);
+	}
+
+	if (rwlock->writer->base.prio != new_prio) {
+		return z_thread_prio_set(rwlock->writer, new_prio);
+	}
+
+	return false;
+}
+
+/* Let the writer inherit the priority of the current thread, about to wait */
+static void boost_writer(struct k_rwlock *rwlock)
+{
+	int32_t new_prio;
+
+	if (rwlock->writer == NULL) {
+		return;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio, rwlock->writer->base.prio);
+
+	if (z_is_prio_higher(new_prio, rwlock->writer->base.prio)) {
+		(void)z_thread_prio_set(rwlock->writer, new_prio);
+	}
+}
+
+/* Give read access to every waiting reader.  Returns true if there was any. */
+static bool wake_readers(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread;
+	bool woken = false;
+
+	while ((thread = z_unpend_first_thread(&rwlock->rd_wait_q)) != NULL) {
+		rwlock->readers++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Give the free lock to the waiters next in line.  Returns true if any
+ * thread was woken up.
+ */
+static bool hand_over(struct k_rwlock *rwlock)
+{
+	struct k_thread *writer = z_waitq_head(&rwlock->wr_wait_q);
+	struct k_thread *reader = z_waitq_head(&rwlock->rd_wait_q);
+
+	__ASSERT_NO_MSG((rwlock->writer == NULL) && (rwlock->readers == 0U));
+
+	if ((writer != NULL) &&
+	    ((reader == NULL) || !z_is_prio_higher(reader->base.prio, writer->base.prio))) {
+		z_unpend_thread(writer);
+		rwlock->writer = writer;
+		rwlock->writer_orig_prio = writer->base.prio;
+		arch_thread_return_value_set(writer, 0);
+		z_ready_thread(writer);
+		(void)adjust_writer_prio(rwlock);
+		return true;
+	}
+
+	return wake_readers(rwlock);
+}
+
+/* Clean up after a waiter timed out, with the module lock held */
+static int lock_timed_out(struct k_rwlock *rwlock, k_spinlock_key_t key)
+{
+	bool resched = adjust_writer_prio(rwlock);
+
+	/* Readers may have been held back by a writer that gave up */
+	if ((rwlock->writer == NULL) && (z_waitq_head(&rwlock->wr_wait_q) == NULL)) {
+		resched = wake_readers(rwlock) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_rwlock, read_lock, rwlock, timeout);
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) && (z_waitq_head(&rwlock->wr_wait_q) == NULL))) {
+		rwlock->readers++;
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, read_lock, rwlock, timeout, 0);
+
+		return 0;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, read_lock, rwlock, timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_rwlock, read_lock, rwlock, timeout);
+
+	boost_writer(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->rd_wait_q, timeout);
+
+	if (ret != 0) {
+		ret = lock_timed_out(rwlock, k_spin_lock(&lock));
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, read_lock, rwlock, timeout, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_rwlock, write_lock, rwlock, timeout);
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) && (rwlock->readers == 0U))) {
+		rwlock->writer = _current;
+		rwlock->writer_orig_prio = _current->base.prio;
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, write_lock, rwlock, timeout, 0);
+
+		return 0;
+	}
+
+	if (unlikely(rwlock->writer == _current)) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, write_lock, rwlock, timeout, -EDEADLK);
+
+		return -EDEADLK;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, write_lock, rwlock, timeout, -EBUSY);
+
+		return -EBUSY;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_rwlock, write_lock, rwlock, timeout);
+
+	boost_writer(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->wr_wait_q, timeout);
+
+	if (ret != 0) {
+		ret = lock_timed_out(rwlock, k_spin_lock(&lock));
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, write_lock, rwlock, timeout, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_rwlock, unlock, rwlock);
+
+	key = k_spin_lock(&lock);
+
+	if (rwlock->writer == _current) {
+		(void)z_thread_prio_set(_current, rwlock->writer_orig_prio);
+		rwlock->writer = NULL;
+	} else {
+		CHECKIF(rwlock->writer != NULL) {
+			k_spin_unlock(&lock, key);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, unlock, rwlock, -EPERM);
+
+			return -EPERM;
+		}
+
+		CHECKIF(rwlock->readers == 0U) {
+			k_spin_unlock(&lock, key);
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, unlock, rwlock, -EINVAL);
+
+			return -EINVAL;
+		}
+
+		rwlock->readers--;
+	}
+
+	if ((rwlock->readers == 0U) && hand_over(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_rwlock, unlock, rwlock, 0);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
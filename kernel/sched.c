@@ -101,6 +101,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -109,17 +111,69 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
+}
+
+#ifdef CONFIG_SCHED_CPU_RUNQ
+/* Pick the CPU whose run queue a thread joins when it becomes
+ * runnable: the one it last ran on, as its working set is most
+ * likely still cached there, unless the affinity mask no longer
+ * allows it.
+ */
+static ALWAYS_INLINE uint8_t runq_pick_cpu(struct k_thread *thread)
+{
+	uint8_t cpu = thread->base.cpu;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	uint32_t m = thread->base.cpu_mask;
+
+	if ((m != 0) && ((m & BIT(cpu)) == 0)) {
+		cpu = u32_count_trailing_zeros(m);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	return (cpu < arch_num_cpus()) ? cpu : 0;
+}
+
+/* Given the best thread in the current CPU's own run queue (or NULL),
+ * return the best thread this CPU should run next, stealing it from
+ * another CPU's queue if that one holds a strictly higher priority
+ * thread.  Ties stay local to preserve affinity.
+ */
+static ALWAYS_INLINE struct k_thread *runq_steal(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	uint8_t currcpu = _current_cpu->id;
+
+	for (uint8_t i = 0; i < num_cpus; i++) {
+		struct k_thread *t;
+
+		if (i == currcpu) {
+			continue;
+		}
+
+		t = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((t != NULL) &&
+		    ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+			thread = t;
+		}
+	}
+
+	return thread;
 }
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	thread->base.runq_cpu = runq_pick_cpu(thread);
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 	_priq_run_add(thread_runq(thread), thread);
 }
 
@@ -132,7 +186,11 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	return runq_steal(_priq_run_best(curr_cpu_runq()));
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -331,6 +389,9 @@ static ALWAYS_INLINE void update_cache(int preempt_ok)
 			z_reset_time_slice(thread);
 		}
 #endif /* CONFIG_TIMESLICING */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		z_cbs_switch(thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 		update_metairq_preempt(thread);
 		_kernel.ready_q.cache = thread;
 	} else {
@@ -370,7 +431,15 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
-static void ready_thread(struct k_thread *thread)
+bool z_thread_active_elsewhere(struct k_thread *thread)
+{
+	return thread_active_elsewhere(thread) != NULL;
+}
+
+/* Put a thread that became ready on the run queue, leaving the cache
+ * update and the IPI to the caller.  Returns true if it was queued.
+ */
+static bool queue_ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -382,13 +451,59 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		if (thread != _current) {
+			z_sched_usage_ready(thread);
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		if (thread != _current) {
+			z_cbs_wakeup(thread);
+		}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 		queue_thread(thread);
+		return true;
+	}
+
+	return false;
+}
+
+static void ready_thread(struct k_thread *thread)
+{
+	if (queue_ready_thread(thread)) {
 		update_cache(0);
 
 		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
+/* Readying several threads at once only updates the cache and flags
+ * IPIs once at the end, so that each target CPU gets a single IPI.
+ */
+struct ready_batch {
+	uint32_t ipi_mask;
+	bool queued;
+};
+
+static void ready_batch_add(struct ready_batch *batch, struct k_thread *thread)
+{
+	if (queue_ready_thread(thread)) {
+		batch->queued = true;
+		batch->ipi_mask |= (uint32_t)ipi_mask_create(thread);
+	}
+}
+
+static void ready_batch_done(struct ready_batch *batch)
+{
+	if (batch->queued) {
+		update_cache(0);
+
+		flag_ipi(batch->ipi_mask);
+	}
+}
+
 void z_ready_thread(struct k_thread *thread)
 {
 	K_SPINLOCK(&_sched_spinlock) {
@@ -611,36 +726,63 @@ void z_unpend_thread_no_timeout(struct k_thread *thread)
 	}
 }
 
-void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
+static bool wake_thread(struct k_thread *thread, bool is_timeout)
 {
-	K_SPINLOCK(&_sched_spinlock) {
-		bool killed = (thread->base.thread_state &
-				(_THREAD_DEAD | _THREAD_ABORTING));
+	bool killed = (thread->base.thread_state &
+			(_THREAD_DEAD | _THREAD_ABORTING));
 
 #ifdef CONFIG_EVENTS
-		bool do_nothing = thread->no_wake_on_timeout && is_timeout;
+	bool do_nothing = thread->no_wake_on_timeout && is_timeout;
 
-		thread->no_wake_on_timeout = false;
+	thread->no_wake_on_timeout = false;
 
-		if (do_nothing) {
-			continue;
-		}
+	if (do_nothing) {
+		return false;
+	}
 #endif /* CONFIG_EVENTS */
 
-		if (!killed) {
-			/* The thread is not being killed */
-			if (thread->base.pended_on != NULL) {
-				unpend_thread_no_timeout(thread);
-			}
-			z_mark_thread_as_started(thread);
-			if (is_timeout) {
-				z_mark_thread_as_not_suspended(thread);
-			}
+	if (killed) {
+		return false;
+	}
+
+	/* The thread is not being killed */
+	if (thread->base.pended_on != NULL) {
+		unpend_thread_no_timeout(thread);
+	}
+	z_mark_thread_as_started(thread);
+	if (is_timeout) {
+		z_mark_thread_as_not_suspended(thread);
+	}
+
+	return true;
+}
+
+void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		if (wake_thread(thread, is_timeout)) {
 			ready_thread(thread);
 		}
 	}
+}
+
+#ifdef CONFIG_EVENTS
+void z_sched_wake_event_threads(struct k_thread *head)
+{
+	struct ready_batch batch = {};
+
+	K_SPINLOCK(&_sched_spinlock) {
+		for (struct k_thread *thread = head; thread != NULL;
+		     thread = thread->next_event_link) {
+			if (wake_thread(thread, false)) {
+				ready_batch_add(&batch, thread);
+			}
+		}
 
+		ready_batch_done(&batch);
+	}
 }
+#endif /* CONFIG_EVENTS */
 
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 /* Timeout handler for *_thread_timeout() APIs */
@@ -819,6 +961,18 @@ void k_sched_unlock(void)
 	z_reschedule_unlocked();
 }
 
+#ifdef CONFIG_RCU
+void z_sched_preempt_deferred(void)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		_current->base.preempt_deferred = false;
+		update_cache(0);
+	}
+
+	z_reschedule_unlocked();
+}
+#endif /* CONFIG_RCU */
+
 struct k_thread *z_swap_next_thread(void)
 {
 #ifdef CONFIG_SMP
@@ -908,6 +1062,12 @@ void *z_get_next_switch_handle(void *interrupted)
 #ifdef CONFIG_TIMESLICING
 			z_reset_time_slice(new_thread);
 #endif /* CONFIG_TIMESLICING */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+			z_cbs_switch(new_thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+#ifdef CONFIG_RCU
+			z_rcu_qs();
+#endif /* CONFIG_RCU */
 
 #ifdef CONFIG_SPIN_VALIDATE
 			/* Changed _current!  Update the spinlock
@@ -954,16 +1114,24 @@ void *z_get_next_switch_handle(void *interrupted)
 
 int z_unpend_all(_wait_q_t *wait_q)
 {
-	int need_sched = 0;
+	struct ready_batch batch = {};
 	struct k_thread *thread;
+	int woken = 0;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&_sched_spinlock) {
+		while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			if (thread_active_elsewhere(thread) == NULL) {
+				ready_batch_add(&batch, thread);
+			}
+			woken++;
+		}
+
+		ready_batch_done(&batch);
 	}
 
-	return need_sched;
+	return woken;
 }
 
 void init_ready_q(struct _ready_q *ready_q)
@@ -975,7 +1143,7 @@ void init_ready_q(struct _ready_q *ready_q)
 		}
 	};
 #elif defined(CONFIG_SCHED_MULTIQ)
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
+	for (int i = 0; i < ARRAY_SIZE(ready_q->runq.queues); i++) {
 		sys_dlist_init(&ready_q->runq.queues[i]);
 	}
 #else
@@ -985,13 +1153,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -1027,6 +1195,20 @@ static inline void z_vrfy_k_thread_priority_set(k_tid_t thread, int prio)
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_SCHED_DEADLINE
+void z_sched_deadline_update(struct k_thread *thread, uint32_t deadline, bool resched)
+{
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+		thread->base.prio_deadline = deadline;
+		queue_thread(thread);
+		if (resched) {
+			update_cache(0);
+		}
+	} else {
+		thread->base.prio_deadline = deadline;
+	}
+}
+
 void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 {
 
@@ -1042,13 +1224,7 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	 * sorting!)
 	 */
 	K_SPINLOCK(&_sched_spinlock) {
-		if (z_is_thread_queued(thread)) {
-			dequeue_thread(thread);
-			thread->base.prio_deadline = newdl;
-			queue_thread(thread);
-		} else {
-			thread->base.prio_deadline = newdl;
-		}
+		z_sched_deadline_update(thread, newdl, false);
 	}
 }
 
@@ -1527,6 +1703,29 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	struct ready_batch batch = {};
+	struct k_thread *thread;
+	int woken = 0;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		while ((thread = _priq_wait_best(&wait_q->waitq)) != NULL) {
+			z_thread_return_value_set_with_data(thread,
+							    swap_retval,
+							    swap_data);
+			unpend_thread_no_timeout(thread);
+			(void)z_abort_thread_timeout(thread);
+			ready_batch_add(&batch, thread);
+			woken++;
+		}
+
+		ready_batch_done(&batch);
+	}
+
+	return woken;
+}
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
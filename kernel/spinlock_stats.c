@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+
+/* Only updated by their own CPU, with interrupts locked */
+static struct k_spin_stats spin_stats[CONFIG_MP_MAX_NUM_CPUS];
+
+void z_spin_lock_stats_add(uint32_t cycles)
+{
+	struct k_spin_stats *stats = &spin_stats[_current_cpu->id];
+
+	stats->contended++;
+	stats->wait_cycles += cycles;
+}
+
+int k_spin_stats_get(unsigned int cpu, struct k_spin_stats *stats)
+{
+	if (cpu >= arch_num_cpus()) {
+		return -EINVAL;
+	}
+
+	*stats = spin_stats[cpu];
+
+	return 0;
+}
+
+void k_spin_stats_reset(void)
+{
+	memset(spin_stats, 0, sizeof(spin_stats));
+}
@@ -507,6 +507,10 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	new_thread->stack_info.watermark = 0;
+	new_thread->stack_info.scan_pos = 0;
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
 #endif /* CONFIG_THREAD_STACK_INFO */
 	stack_ptr -= delta;
 
@@ -643,6 +647,14 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_DEADLINE
 	new_thread->base.prio_deadline = 0;
 #endif /* CONFIG_SCHED_DEADLINE */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	new_thread->base.cbs_budget = 0U;
+	new_thread->base.cbs_period = 0U;
+	new_thread->base.cbs_remaining = 0;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+#ifdef CONFIG_RCU
+	new_thread->base.preempt_deferred = false;
+#endif /* CONFIG_RCU */
 	new_thread->resource_pool = _current->resource_pool;
 
 #ifdef CONFIG_SMP
@@ -655,6 +667,10 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	new_thread->base.ready_stamp = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
 	return stack_ptr;
@@ -999,6 +1015,13 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+		for (int b = 0; b < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; b++) {
+			stats->wakeup_latency[b] += tmp_stats.wakeup_latency[b];
+		}
+		stats->peak_wakeup_latency = MAX(stats->peak_wakeup_latency,
+						 tmp_stats.peak_wakeup_latency);
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
@@ -11,10 +11,15 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+#include <timeout_wheel.h>
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +41,7 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -59,6 +65,35 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Ticks from curr_tick to the earliest point at which some pending
+ * timeout would exceed its slack.  Only timeouts due before that
+ * point can lower it, so the walk stops at the first one due after.
+ */
+static k_ticks_t coalesced_expiry(struct _timeout *to)
+{
+	k_ticks_t due = to->dticks;
+	k_ticks_t limit = due + to->slack;
+
+	for (to = next(to); to != NULL; to = next(to)) {
+		due += to->dticks;
+		if (due > limit) {
+			break;
+		}
+		limit = MIN(limit, due + to->slack);
+	}
+
+	return limit;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#else
+/* With the timing wheel, dticks holds the absolute expiry tick */
+static void remove_timeout(struct _timeout *t)
+{
+	z_timeout_wheel_remove(t);
+}
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -82,16 +117,32 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(void)
 {
-	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	int64_t expiry = z_timeout_wheel_next();
+
+	if ((expiry == INT64_MAX) ||
+	    ((expiry - (int64_t)curr_tick - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, expiry - (int64_t)curr_tick - ticks_elapsed);
+	}
+#else
+	struct _timeout *to = first();
+#ifdef CONFIG_TIMEOUT_SLACK
+	k_ticks_t expiry = (to == NULL) ? 0 : coalesced_expiry(to);
+#else
+	k_ticks_t expiry = (to == NULL) ? 0 : to->dticks;
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(expiry - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, expiry - ticks_elapsed);
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	return ret;
 }
@@ -111,7 +162,9 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 		struct _timeout *t;
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
@@ -122,6 +175,18 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+		to->dticks += curr_tick;
+		z_timeout_wheel_add(to);
+
+		if ((z_timeout_wheel_next() == to->dticks) && (announce_remaining == 0)) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#else
+#ifdef CONFIG_TIMEOUT_SLACK
+		k_ticks_t due = to->dticks;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 		for (t = first(); t != NULL; t = next(t)) {
 			if (t->dticks > to->dticks) {
 				t->dticks -= to->dticks;
@@ -135,9 +200,20 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* A timeout due within the coalescing window may end it
+		 * sooner with a smaller slack.
+		 */
+		if ((to == first() || due <= coalesced_expiry(first())) &&
+		    announce_remaining == 0) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#else
 		if (to == first() && announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
+#endif /* CONFIG_TIMEOUT_SLACK */
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 	}
 }
 
@@ -158,6 +234,9 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	return timeout->dticks - (k_ticks_t)curr_tick;
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -168,6 +247,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -227,6 +307,21 @@ void sys_clock_announce(int32_t ticks)
 
 	struct _timeout *t;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	for (t = z_timeout_wheel_pop(curr_tick + announce_remaining);
+	     t != NULL;
+	     t = z_timeout_wheel_pop(curr_tick + announce_remaining)) {
+		int dt = t->dticks - curr_tick;
+
+		curr_tick += dt;
+		t->dticks = 0;
+
+		k_spin_unlock(&timeout_lock, key);
+		t->fn(t);
+		key = k_spin_lock(&timeout_lock);
+		announce_remaining -= dt;
+	}
+#else
 	for (t = first();
 	     (t != NULL) && (t->dticks <= announce_remaining);
 	     t = first()) {
@@ -245,6 +340,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -330,6 +426,9 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	z_timeout_wheel_rebase(tick);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 	curr_tick = tick;
 }
 
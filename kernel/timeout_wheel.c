@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * Level L has 64 slots, each covering 64^L ticks.  A timeout expiring
+ * at tick E that is D ticks away is stored in the lowest level L for
+ * which D < 64^(L+1), in slot (E >> 6L) & 63.  Timeouts further away
+ * than the top level can represent live in an unsorted overflow list.
+ *
+ * Level 0 slots each hold timeouts for exactly one tick.  A slot of a
+ * higher level is "cascaded" (its timeouts re-inserted, landing on a
+ * lower level) once "now" reaches the first tick it covers, so every
+ * timeout reaches level 0 before it expires and expires on its exact
+ * tick.  A per-level bitmap of non-empty slots lets both expiry and
+ * cascading jump straight to the next interesting tick, which keeps
+ * long tickless idle periods cheap.
+ *
+ * A slot's list head is only valid while its bitmap bit is set: it is
+ * (re)initialized when the first timeout is added, so no runtime init
+ * of the wheel is needed.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
+#include <timeout_wheel.h>
+
+#define SLOT_BITS 6
+#define NUM_SLOTS BIT(SLOT_BITS)
+#define SLOT_MASK (NUM_SLOTS - 1)
+#define NUM_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+/* Width in ticks of one slot of a level / of the whole top level */
+#define LEVEL_SHIFT(l) ((l) * SLOT_BITS)
+#define WHEEL_SPAN BIT64(NUM_LEVELS * SLOT_BITS)
+
+static sys_dlist_t wheel[NUM_LEVELS][NUM_SLOTS];
+static uint64_t occupied[NUM_LEVELS];
+static sys_dlist_t overflow = SYS_DLIST_STATIC_INIT(&overflow);
+
+/* The wheel's notion of "now", kept equal to curr_tick by timeout.c */
+static int64_t wheel_tick;
+
+/* Cached earliest expiry, valid when next_valid is set */
+static int64_t next_expiry;
+static bool next_valid;
+
+static inline struct _timeout *to_timeout(sys_dnode_t *n)
+{
+	return CONTAINER_OF(n, struct _timeout, node);
+}
+
+/* Index of the first set bit of @a map at or after bit @a start, going
+ * round the ring, expressed as a distance from @a start.
+ */
+static inline unsigned int ring_distance(uint64_t map, unsigned int start)
+{
+	uint64_t rot = (start == 0U) ? map : ((map >> start) | (map << (NUM_SLOTS - start)));
+
+	return u64_count_trailing_zeros(rot);
+}
+
+static void insert(struct _timeout *to)
+{
+	uint64_t delta;
+	unsigned int level = 0U;
+
+	/* Already due: expire on the next announcement */
+	if (to->dticks < wheel_tick) {
+		to->dticks = wheel_tick;
+	}
+
+	delta = (uint64_t)(to->dticks - wheel_tick);
+
+	while ((level < NUM_LEVELS) && ((delta >> LEVEL_SHIFT(level + 1)) != 0U)) {
+		level++;
+	}
+
+	if (level == NUM_LEVELS) {
+		sys_dlist_append(&overflow, &to->node);
+		return;
+	}
+
+	unsigned int slot = ((uint64_t)to->dticks >> LEVEL_SHIFT(level)) & SLOT_MASK;
+
+	if ((occupied[level] & BIT64(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		occupied[level] |= BIT64(slot);
+	}
+	sys_dlist_append(&wheel[level][slot], &to->node);
+}
+
+/* Unlink a node, clearing the owning slot's bit if it was the last one.
+ * A lone node's next and prev both point at the list head, which
+ * identifies the slot without storing it in every timeout.
+ */
+static void unlink(struct _timeout *to)
+{
+	sys_dnode_t *head = to->node.next;
+	bool last = (to->node.next == to->node.prev);
+
+	sys_dlist_remove(&to->node);
+
+	if (last && (head != &overflow)) {
+		size_t idx = (sys_dlist_t *)head - &wheel[0][0];
+
+		occupied[idx / NUM_SLOTS] &= ~BIT64(idx % NUM_SLOTS);
+	}
+}
+
+/* First slot boundary of @a level at or after "now".  Every pending
+ * timeout of the level is due to cascade on one of the 64 boundaries
+ * starting there, so that is where searching the ring begins.
+ */
+static inline uint64_t level_base(unsigned int level)
+{
+	return ((uint64_t)wheel_tick + BIT64(LEVEL_SHIFT(level)) - 1U) >> LEVEL_SHIFT(level);
+}
+
+/* Tick at which the first occupied slot of @a level must be cascaded */
+static int64_t cascade_tick(unsigned int level)
+{
+	uint64_t base = level_base(level);
+	unsigned int dist = ring_distance(occupied[level], base & SLOT_MASK);
+
+	return (int64_t)((base + dist) << LEVEL_SHIFT(level));
+}
+
+static sys_dlist_t *cascade_slot(unsigned int level)
+{
+	uint64_t base = level_base(level);
+	unsigned int dist = ring_distance(occupied[level], base & SLOT_MASK);
+
+	return &wheel[level][(base + dist) & SLOT_MASK];
+}
+
+static int64_t overflow_min(void)
+{
+	int64_t min = INT64_MAX;
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&overflow, t, node) {
+		min = MIN(min, t->dticks);
+	}
+
+	return min;
+}
+
+/* Earliest expiry on level 0, which is exact: one slot per tick */
+static int64_t level0_next(void)
+{
+	if (occupied[0] == 0U) {
+		return INT64_MAX;
+	}
+
+	return wheel_tick + ring_distance(occupied[0], (uint64_t)wheel_tick & SLOT_MASK);
+}
+
+/* Earliest tick at which some timeout must move down a level */
+static int64_t next_cascade(void)
+{
+	int64_t ret = INT64_MAX;
+
+	for (unsigned int l = 1U; l < NUM_LEVELS; l++) {
+		if (occupied[l] != 0U) {
+			ret = MIN(ret, cascade_tick(l));
+		}
+	}
+
+	if (!sys_dlist_is_empty(&overflow)) {
+		ret = MIN(ret, overflow_min() - (int64_t)WHEEL_SPAN + 1);
+	}
+
+	return ret;
+}
+
+static void reinsert_list(sys_dlist_t *list)
+{
+	sys_dlist_t tmp;
+	sys_dnode_t *n;
+
+	/* Detach the whole list first: overflow timeouts that still
+	 * don't fit in the wheel go straight back onto the same list.
+	 */
+	sys_dlist_init(&tmp);
+	while ((n = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&tmp, n);
+	}
+
+	while ((n = sys_dlist_get(&tmp)) != NULL) {
+		insert(to_timeout(n));
+	}
+}
+
+/* Cascade every level whose next slot is due at wheel_tick, top down */
+static void cascade(void)
+{
+	if (!sys_dlist_is_empty(&overflow) &&
+	    ((overflow_min() - wheel_tick) < (int64_t)WHEEL_SPAN)) {
+		reinsert_list(&overflow);
+	}
+
+	for (unsigned int l = NUM_LEVELS - 1U; l > 0U; l--) {
+		if ((occupied[l] != 0U) && (cascade_tick(l) == wheel_tick)) {
+			sys_dlist_t *slot = cascade_slot(l);
+
+			occupied[l] &= ~BIT64(slot - &wheel[l][0]);
+			reinsert_list(slot);
+		}
+	}
+}
+
+void z_timeout_wheel_add(struct _timeout *to)
+{
+	insert(to);
+
+	if (next_valid && (to->dticks < next_expiry)) {
+		next_expiry = to->dticks;
+	}
+}
+
+void z_timeout_wheel_remove(struct _timeout *to)
+{
+	unlink(to);
+
+	if (next_valid && (to->dticks == next_expiry)) {
+		next_valid = false;
+	}
+}
+
+int64_t z_timeout_wheel_next(void)
+{
+	if (next_valid) {
+		return next_expiry;
+	}
+
+	/* Slots of one level cover disjoint, ordered tick ranges, so the
+	 * earliest timeout of a level lives in its first occupied slot.
+	 */
+	int64_t ret = level0_next();
+
+	for (unsigned int l = 1U; l < NUM_LEVELS; l++) {
+		if (occupied[l] != 0U) {
+			struct _timeout *t;
+
+			SYS_DLIST_FOR_EACH_CONTAINER(cascade_slot(l), t, node) {
+				ret = MIN(ret, t->dticks);
+			}
+		}
+	}
+
+	if (!sys_dlist_is_empty(&overflow)) {
+		ret = MIN(ret, overflow_min());
+	}
+
+	next_expiry = ret;
+	next_valid = true;
+
+	return ret;
+}
+
+struct _timeout *z_timeout_wheel_pop(int64_t limit)
+{
+	for (;;) {
+		int64_t expiry = level0_next();
+		int64_t casc = next_cascade();
+
+		if ((casc <= expiry) && (casc <= limit)) {
+			wheel_tick = MAX(wheel_tick, casc);
+			cascade();
+			continue;
+		}
+
+		if (expiry <= limit) {
+			unsigned int slot = (uint64_t)expiry & SLOT_MASK;
+			struct _timeout *t = to_timeout(sys_dlist_peek_head(&wheel[0][slot]));
+
+			wheel_tick = expiry;
+			unlink(t);
+			next_valid = false;
+			return t;
+		}
+
+		wheel_tick = MAX(wheel_tick, limit);
+		return NULL;
+	}
+}
+
+void z_timeout_wheel_rebase(int64_t tick)
+{
+	sys_dlist_t all;
+	sys_dnode_t *n;
+	int64_t shift = tick - wheel_tick;
+
+	sys_dlist_init(&all);
+
+	for (unsigned int l = 0U; l < NUM_LEVELS; l++) {
+		for (unsigned int s = 0U; s < NUM_SLOTS; s++) {
+			if ((occupied[l] & BIT64(s)) == 0U) {
+				continue;
+			}
+			while ((n = sys_dlist_get(&wheel[l][s])) != NULL) {
+				sys_dlist_append(&all, n);
+			}
+		}
+		occupied[l] = 0U;
+	}
+
+	while ((n = sys_dlist_get(&overflow)) != NULL) {
+		sys_dlist_append(&all, n);
+	}
+
+	wheel_tick = tick;
+	next_valid = false;
+
+	while ((n = sys_dlist_get(&all)) != NULL) {
+		struct _timeout *t = to_timeout(n);
+
+		t->dticks += shift;
+		insert(t);
+	}
+}
@@ -191,6 +191,24 @@ static inline void z_vrfy_k_timer_start(struct k_timer *timer,
 #include <zephyr/syscalls/k_timer_start_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	K_SPINLOCK(&lock) {
+		z_set_timeout_slack(&timer->timeout, slack);
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	K_OOPS(K_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <zephyr/syscalls/k_timer_slack_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 void z_impl_k_timer_stop(struct k_timer *timer)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_timer, stop, timer);
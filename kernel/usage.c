@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,6 +72,60 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	thread->base.ready_stamp = usage_now();
+}
+
+static void latency_record(struct k_cycle_stats *stats, uint32_t cycles)
+{
+	unsigned int bucket = (cycles < 2U) ? 0U : (31U - u32_count_leading_zeros(cycles));
+
+	stats->latency[MIN(bucket, CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS - 1)]++;
+	stats->latency_max = MAX(stats->latency_max, cycles);
+}
+
+/*
+ * Account for the wakeup latency of a thread being switched in.  Like
+ * the cycle counts, each histogram only has a single writer: the CPU
+ * switching the thread in, or the CPU itself.
+ */
+static void sched_latency_update(struct _cpu *cpu, struct k_thread *thread,
+				 uint32_t now)
+{
+	uint32_t stamp = thread->base.ready_stamp;
+
+	if (stamp == 0U) {
+		return;
+	}
+
+	thread->base.ready_stamp = 0U;
+
+	if (thread->base.usage.track_usage) {
+		latency_record(&thread->base.usage, now - stamp);
+	}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage) {
+		latency_record(cpu->usage, now - stamp);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+
+static void latency_copy(const struct k_cycle_stats *usage,
+			 struct k_thread_runtime_stats *stats)
+{
+	memcpy(stats->wakeup_latency, usage->latency, sizeof(stats->wakeup_latency));
+	stats->peak_wakeup_latency = usage->latency_max;
+}
+#else
+#define sched_latency_update(cpu, thread, now)   do { } while (0)
+#define latency_copy(usage, stats)   do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -80,6 +135,8 @@ void z_sched_usage_start(struct k_thread *thread)
 
 	_current_cpu->usage0 = usage_now();   /* Always update */
 
+	sched_latency_update(_current_cpu, thread, _current_cpu->usage0);
+
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
 		thread->base.usage.current = 0;
@@ -93,6 +150,8 @@ void z_sched_usage_start(struct k_thread *thread)
 	 */
 
 	_current_cpu->usage0 = usage_now();
+
+	sched_latency_update(_current_cpu, thread, _current_cpu->usage0);
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
@@ -161,6 +220,12 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+	latency_copy(_kernel.cpus[cpu_id].usage, stats);
+
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	stats->stack_used = 0;
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
@@ -221,6 +286,12 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+	latency_copy(&thread->base.usage, stats);
+
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	stats->stack_used = thread->stack_info.watermark;
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -382,6 +453,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	(void)memset(stats->latency, 0, sizeof(stats->latency));
+	stats->latency_max = 0U;
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
 
 	if (thread != _current_cpu->current) {
 
@@ -47,7 +47,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj dlist */
+static struct k_spinlock lists_lock;       /* kobj dlist and hash table */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 
 #ifdef CONFIG_GEN_PRIV_STACKS
@@ -168,6 +168,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+	sys_snode_t hash_node;
 
 	/* The object itself */
 	void *data;
@@ -184,8 +185,39 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
 /*
- * TODO: Write some hash table code that will replace obj_list.
+ * Hash table of allocated kernel objects, keyed by object address, for
+ * k_object_find().  An empty sys_slist_t is all zeroes, so no runtime
+ * initialization is needed.
  */
+#define OBJ_HASH_BUCKETS BIT(CONFIG_DYNAMIC_OBJECTS_HASH_BITS)
+
+static sys_slist_t obj_hash[OBJ_HASH_BUCKETS];
+
+static inline sys_slist_t *obj_hash_bucket(const void *obj)
+{
+	/* Fibonacci hashing: the low bits of object addresses are mostly
+	 * alignment, the multiply mixes the significant ones into the top
+	 * bits, which are the ones kept.
+	 */
+	uint32_t h = (uint32_t)((uintptr_t)obj >> 2) * 2654435769U;
+
+	return &obj_hash[h >> (32 - CONFIG_DYNAMIC_OBJECTS_HASH_BITS)];
+}
+
+/* Must be called with lists_lock held */
+static void dyn_obj_link(struct dyn_obj *dyn)
+{
+	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	sys_slist_prepend(obj_hash_bucket(dyn->kobj.name), &dyn->hash_node);
+}
+
+/* Must be called with lists_lock held */
+static void dyn_obj_unlink(struct dyn_obj *dyn)
+{
+	sys_dlist_remove(&dyn->dobj_list);
+	(void)sys_slist_find_and_remove(obj_hash_bucket(dyn->kobj.name),
+					&dyn->hash_node);
+}
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -226,14 +258,9 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 	struct dyn_obj *node;
 	k_spinlock_key_t key;
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the containing struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
 	key = k_spin_lock(&lists_lock);
 
-	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
+	SYS_SLIST_FOR_EACH_CONTAINER(obj_hash_bucket(obj), node, hash_node) {
 		if (node->kobj.name == obj) {
 			goto end;
 		}
@@ -375,7 +402,7 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	dyn_obj_link(dyn);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -469,7 +496,10 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		sys_dlist_remove(&dyn->dobj_list);
+		k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+		dyn_obj_unlink(dyn);
+		k_spin_unlock(&lists_lock, lists_key);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -579,7 +609,11 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 		break;
 	}
 
-	sys_dlist_remove(&dyn->dobj_list);
+	k_spinlock_key_t lists_key = k_spin_lock(&lists_lock);
+
+	dyn_obj_unlink(dyn);
+	k_spin_unlock(&lists_lock, lists_key);
+
 	k_free(dyn->data);
 	k_free(dyn);
 out:
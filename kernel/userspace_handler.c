@@ -8,6 +8,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/syscall_batch.h>
 
 static struct k_object *validate_kernel_object(const void *obj,
 					       enum k_objects otype,
@@ -87,3 +88,49 @@ static inline void *z_vrfy_k_object_alloc_size(enum k_objects otype, size_t size
 	return z_impl_k_object_alloc_size(otype, size);
 }
 #include <zephyr/syscalls/k_object_alloc_size_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	/* Supervisor threads have no trap overhead to save */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	void *ssf = _current->syscall_frame;
+
+	if (count > CONFIG_SYSCALL_BATCH_MAX_ENTRIES) {
+		return -EINVAL;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Work on a copy, the entries stay writable from user mode */
+		struct k_syscall_batch_entry e = entries[i];
+		uintptr_t ret;
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG((e.id < K_SYSCALL_LIMIT) &&
+					    (e.id != K_SYSCALL_K_SYSCALL_BATCH),
+					    "bad system call id in batch entry %zu", i));
+
+		/* Go through the marshalling function, which verifies the
+		 * arguments as the system call would on its own, and clears
+		 * the syscall frame on return.
+		 */
+		ret = _k_syscall_table[e.id](e.args[0], e.args[1], e.args[2],
+					     e.args[3], e.args[4], e.args[5], ssf);
+		_current->syscall_frame = ssf;
+
+		entries[i].ret = ret;
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
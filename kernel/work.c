@@ -298,6 +298,137 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Test whether a pool worker is asleep with nothing to do and would
+ * accept a new submission.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool pool_worker_available_locked(struct k_work_q *queue)
+{
+	return ((flags_get(&queue->flags)
+		 & (K_WORK_QUEUE_STARTED | K_WORK_QUEUE_BUSY
+		    | K_WORK_QUEUE_DRAIN | K_WORK_QUEUE_PLUGGED))
+		== K_WORK_QUEUE_STARTED)
+		&& sys_slist_is_empty(&queue->pending);
+}
+
+/* Wake one sleeping worker of a pool so it can steal work that is being
+ * queued to a busy sibling.
+ *
+ * Invoked with work lock held.
+ */
+static void pool_wake_idle_locked(struct k_work_q_pool *pool)
+{
+	for (uint8_t i = 0; i < pool->num_workers; i++) {
+		struct k_work_q *queue = &pool->workers[i];
+
+		if (pool_worker_available_locked(queue) &&
+		    notify_queue_locked(queue)) {
+			return;
+		}
+	}
+}
+
+/* Select the worker of a pool that new work should be queued to.
+ *
+ * Work submitted by a worker's own handler stays on that worker, and a
+ * sleeping sibling is woken to steal it if the worker is still busy
+ * when the sibling gets to run.  Otherwise the first available worker is used, starting at the
+ * submitting CPU's worker for per-CPU pools and at the round-robin
+ * cursor for others.  If every worker is busy the starting worker
+ * gets the work, and will lose it to whichever sibling runs dry first.
+ *
+ * Invoked with work lock held.
+ *
+ * @param pool the pool work is being submitted to.
+ *
+ * @return the selected worker queue.
+ */
+static struct k_work_q *pool_select_locked(struct k_work_q_pool *pool)
+{
+	uint8_t n = pool->num_workers;
+	uint8_t start = pool->cursor;
+
+	if (!k_is_in_isr()) {
+		for (uint8_t i = 0; i < n; i++) {
+			if (_current == &pool->workers[i].thread) {
+				pool_wake_idle_locked(pool);
+				return &pool->workers[i];
+			}
+		}
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (pool->per_cpu) {
+		start = _current_cpu->id % n;
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	for (uint8_t i = 0; i < n; i++) {
+		uint8_t idx = (start + i) % n;
+
+		if (pool_worker_available_locked(&pool->workers[idx])) {
+			start = idx;
+			break;
+		}
+	}
+
+	pool->cursor = (start + 1) % n;
+
+	return &pool->workers[start];
+}
+
+/* Take the oldest pending item of a sibling worker.
+ *
+ * A flush marker must run on the queue of the item it waits for, after
+ * that item, so neither a flusher nor an item followed by one is taken.
+ * An item resubmitted while running is queued to the worker running it
+ * to prevent handler re-entrancy, so it is not taken either.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the idle worker looking for work.
+ *
+ * @return the node of the stolen item, now owned by @p queue, or NULL.
+ */
+static sys_snode_t *pool_steal_locked(struct k_work_q *queue)
+{
+	struct k_work_q_pool *pool = queue->pool;
+	uint8_t n = pool->num_workers;
+	uint8_t self = queue - pool->workers;
+
+	for (uint8_t i = 1; i < n; i++) {
+		struct k_work_q *victim = &pool->workers[(self + i) % n];
+		sys_snode_t *node = sys_slist_peek_head(&victim->pending);
+		sys_snode_t *next;
+		struct k_work *work;
+
+		if (node == NULL) {
+			continue;
+		}
+
+		work = CONTAINER_OF(node, struct k_work, node);
+		next = sys_slist_peek_next(node);
+
+		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT) ||
+		    flag_test(&work->flags, K_WORK_RUNNING_BIT) ||
+		    ((next != NULL) &&
+		     flag_test(&CONTAINER_OF(next, struct k_work, node)->flags,
+			       K_WORK_FLUSHING_BIT))) {
+			continue;
+		}
+
+		(void)sys_slist_get(&victim->pending);
+		work->queue = queue;
+
+		return node;
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Attempt to submit work to a queue.
  *
  * The submission can fail if:
@@ -351,6 +482,12 @@ static int submit_to_queue_locked(struct k_work *work,
 			*queuep = work->queue;
 			ret = 2;
 		}
+#ifdef CONFIG_WORKQUEUE_POOL
+		else if ((*queuep != NULL) && ((*queuep)->pool != NULL)) {
+			/* Let the pool pick the worker */
+			*queuep = pool_select_locked((*queuep)->pool);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 		int rc = queue_submit_locked(*queuep, work);
 
@@ -629,6 +766,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 
 		/* Check for and prepare any new work. */
 		node = sys_slist_get(&queue->pending);
+#ifdef CONFIG_WORKQUEUE_POOL
+		if ((node == NULL) && (queue->pool != NULL) &&
+		    !flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT)) {
+			node = pool_steal_locked(queue);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
@@ -726,11 +869,12 @@ void k_work_queue_init(struct k_work_q *queue)
 	SYS_PORT_TRACING_OBJ_INIT(k_work_queue, queue);
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+static void work_queue_start(struct k_work_q *queue,
+			     k_thread_stack_t *stack,
+			     size_t stack_size,
+			     int prio,
+			     const struct k_work_queue_config *cfg,
+			     int cpu)
 {
 	__ASSERT_NO_MSG(queue);
 	__ASSERT_NO_MSG(stack);
@@ -765,11 +909,28 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(&queue->thread, cpu);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	work_queue_start(queue, stack, stack_size, prio, cfg, -1);
+}
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -822,6 +983,65 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_pool_start(struct k_work_q_pool *pool, int prio,
+			     const struct k_work_queue_pool_config *cfg)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+	__ASSERT_NO_MSG(pool->num_workers > 0U);
+
+	const struct k_work_queue_config *wcfg = (cfg != NULL) ? &cfg->worker : NULL;
+	bool per_cpu = IS_ENABLED(CONFIG_SCHED_CPU_MASK) && (cfg != NULL) && cfg->per_cpu;
+
+	pool->cursor = 0U;
+	pool->per_cpu = per_cpu;
+
+	for (uint8_t i = 0; i < pool->num_workers; i++) {
+		struct k_work_q *queue = &pool->workers[i];
+		k_thread_stack_t *stack = (k_thread_stack_t *)
+			((uint8_t *)pool->stacks + (i * pool->stack_stride));
+
+		k_work_queue_init(queue);
+		queue->pool = pool;
+		work_queue_start(queue, stack, pool->stack_size, prio, wcfg,
+				 per_cpu ? (int)(i % arch_num_cpus()) : -1);
+	}
+}
+
+int k_work_queue_pool_drain(struct k_work_q_pool *pool, bool plug)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	int ret = 0;
+
+	for (uint8_t i = 0; i < pool->num_workers; i++) {
+		int rc = k_work_queue_drain(&pool->workers[i], plug);
+
+		if (rc < 0) {
+			return rc;
+		}
+		ret |= rc;
+	}
+
+	return ret;
+}
+
+int k_work_queue_pool_unplug(struct k_work_q_pool *pool)
+{
+	__ASSERT_NO_MSG(pool != NULL);
+
+	int ret = -EALREADY;
+
+	for (uint8_t i = 0; i < pool->num_workers; i++) {
+		if (k_work_queue_unplug(&pool->workers[i]) == 0) {
+			ret = 0;
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /* Timeout handler for delayable work.
@@ -870,6 +1090,17 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork, k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	K_SPINLOCK(&lock) {
+		z_set_timeout_slack(&dwork->timeout, slack);
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
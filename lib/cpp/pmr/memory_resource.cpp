@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdint>
+#include <zephyr/sys/memory_resource.hpp>
+#include <zephyr/sys/util.h>
+
+namespace zephyr::pmr
+{
+
+/* Allocators return NULL for 0 bytes, resources a pointer */
+static inline std::size_t alloc_size(std::size_t bytes)
+{
+	return MAX(bytes, 1);
+}
+
+static inline bool in_range(const void *p, const void *start, std::size_t size)
+{
+	return (uintptr_t)p - (uintptr_t)start < size;
+}
+
+void *k_heap_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	void *mem = k_heap_aligned_alloc(heap_, alignment, alloc_size(bytes), timeout_);
+
+	return (mem != nullptr) ? mem : std::pmr::null_memory_resource()->allocate(bytes, alignment);
+}
+
+void k_heap_resource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+	ARG_UNUSED(bytes);
+	ARG_UNUSED(alignment);
+
+	k_heap_free(heap_, p);
+}
+
+bool k_heap_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+void *sys_heap_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	void *mem = sys_heap_aligned_alloc(heap_, alignment, alloc_size(bytes));
+
+	return (mem != nullptr) ? mem : std::pmr::null_memory_resource()->allocate(bytes, alignment);
+}
+
+void sys_heap_resource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+	ARG_UNUSED(bytes);
+	ARG_UNUSED(alignment);
+
+	sys_heap_free(heap_, p);
+}
+
+bool sys_heap_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+void *mem_slab_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	std::size_t block_size = slab_->info.block_size;
+	void *mem;
+
+	/* Blocks are as aligned as the buffer and their size allow */
+	if (bytes <= block_size && (((uintptr_t)slab_->buffer | block_size) & (alignment - 1)) == 0 &&
+	    k_mem_slab_alloc(slab_, &mem, timeout_) == 0) {
+		return mem;
+	}
+
+	return upstream_->allocate(bytes, alignment);
+}
+
+void mem_slab_resource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+	if (in_range(p, slab_->buffer, (std::size_t)slab_->info.num_blocks * slab_->info.block_size)) {
+		k_mem_slab_free(slab_, p);
+	} else {
+		upstream_->deallocate(p, bytes, alignment);
+	}
+}
+
+bool mem_slab_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+void *monotonic_arena_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	uintptr_t mem = ROUND_UP((uintptr_t)next_, alignment);
+
+	if (mem > (uintptr_t)end_ || bytes > (uintptr_t)end_ - mem) {
+		return upstream_->allocate(bytes, alignment);
+	}
+
+	next_ = (char *)mem + bytes;
+
+	return (void *)mem;
+}
+
+void monotonic_arena_resource::do_deallocate(void *p, std::size_t bytes, std::size_t alignment)
+{
+	/* Memory of the buffer is only reclaimed by release() */
+	if (!in_range(p, start_, end_ - start_)) {
+		upstream_->deallocate(p, bytes, alignment);
+	}
+}
+
+bool monotonic_arena_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+	return this == &other;
+}
+
+} /* namespace zephyr::pmr */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Building blocks shared by the bit-reflected CRC32 implementations.
+ * They all work on the raw CRC register: initial and final XORs are up
+ * to the caller.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+#define ZEPHYR_LIB_CRC_CRC32_PRIV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_ARCH_INSN) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define CRC32_ACLE 1
+#elif defined(CONFIG_CRC32_ARCH_INSN) && defined(__riscv_zbc)
+#define CRC32_CLMUL 1
+#endif
+
+/* The CRC32 instructions of ARM handle any length without tables */
+#if defined(CONFIG_CRC32_SLICING_BY_8) && !defined(CRC32_ACLE)
+#define CRC32_SLICES 8
+#elif defined(CONFIG_CRC32_SLICING_BY_4) && !defined(CRC32_ACLE)
+#define CRC32_SLICES 4
+#endif
+
+#ifdef CRC32_SLICES
+/*
+ * Slicing-by-4/8: table[k][i] is the CRC of byte i followed by k zero
+ * bytes, so a whole word of data is folded in with one lookup per byte,
+ * all independent of each other.
+ */
+static inline uint32_t crc32_slicing_update(uint32_t crc, const uint8_t *data, size_t len,
+					    const uint32_t table[CRC32_SLICES][256])
+{
+	for (; len >= CRC32_SLICES; len -= CRC32_SLICES, data += CRC32_SLICES) {
+		crc ^= sys_get_le32(data);
+#if CRC32_SLICES > 4
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][crc & 0xff] ^ table[6][(crc >> 8) & 0xff] ^
+		      table[5][(crc >> 16) & 0xff] ^ table[4][crc >> 24] ^
+		      table[3][hi & 0xff] ^ table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^ table[0][hi >> 24];
+#else
+		crc = table[3][crc & 0xff] ^ table[2][(crc >> 8) & 0xff] ^
+		      table[1][(crc >> 16) & 0xff] ^ table[0][crc >> 24];
+#endif
+	}
+
+	for (; len > 0; len--) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return crc;
+}
+#endif /* CRC32_SLICES */
+
+#ifdef CRC32_CLMUL
+/*
+ * Fold a register of data, already XORed with the CRC, by Barrett
+ * reduction on carry-less products.  mu is the bit-reflected quotient
+ * of x^(XLEN + 32) by the polynomial, without its top bit, and poly the
+ * bit-reflected polynomial in the upper 32 bits of a register.
+ */
+static inline uint32_t crc32_clmul_fold(unsigned long s, unsigned long mu, unsigned long poly)
+{
+	unsigned long crc;
+
+	__asm__("clmul %0, %1, %2\n\t"
+		"slli %0, %0, 1\n\t"
+		"xor %0, %0, %1\n\t"
+		"clmulr %0, %0, %3\n\t"
+		"srli %0, %0, %4"
+		: "=&r"(crc)
+		: "r"(s), "r"(mu), "r"(poly), "i"(__riscv_xlen - 32));
+
+	return crc;
+}
+
+static inline unsigned long crc32_clmul_load(const uint8_t *data)
+{
+#if __riscv_xlen == 64
+	return sys_get_le64(data);
+#else
+	return sys_get_le32(data);
+#endif
+}
+
+#if __riscv_xlen == 64
+#define CRC32_CLMUL_CONST(c64, c32) (c64)
+#else
+#define CRC32_CLMUL_CONST(c64, c32) (c32)
+#endif
+#endif /* CRC32_CLMUL */
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_PRIV_H_ */
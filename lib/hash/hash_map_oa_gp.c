@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_gp.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * The table is a single allocation: one control byte per slot, followed by
+ * the slots themselves. A control byte is either one of the markers below,
+ * which all have their top bit set, or the low 7 bits of the hash of the
+ * key in a used slot. Slots are probed a group at a time, a group being
+ * read as one 64-bit word of control bytes.
+ *
+ * A table smaller than a group is padded to a whole group with slots that
+ * are never used.
+ */
+#define GROUP_WIDTH 8
+
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xfe
+#define CTRL_PAD     0xff
+
+#define LSBS 0x0101010101010101ULL
+#define MSBS 0x8080808080808080ULL
+
+struct oagp_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, buckets) ==
+	     offsetof(struct sys_hashmap_data, buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, n_buckets) ==
+	     offsetof(struct sys_hashmap_data, n_buckets));
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, size) ==
+	     offsetof(struct sys_hashmap_data, size));
+/* sys_hashmap_should_rehash() reads the number of tombstones of Open Addressing maps */
+BUILD_ASSERT(offsetof(struct sys_hashmap_oa_gp_data, n_tombstones) ==
+	     offsetof(struct sys_hashmap_oa_lp_data, n_tombstones));
+
+static inline size_t n_slots(size_t n_buckets)
+{
+	return ROUND_UP(n_buckets, GROUP_WIDTH);
+}
+
+static inline uint8_t *ctrl_bytes(const struct sys_hashmap_data *data)
+{
+	return data->buckets;
+}
+
+static inline struct oagp_entry *entries(const struct sys_hashmap_data *data)
+{
+	return (struct oagp_entry *)(ctrl_bytes(data) + n_slots(data->n_buckets));
+}
+
+static inline uint8_t ctrl_hash(uint32_t hash)
+{
+	return hash & 0x7f;
+}
+
+static inline uint64_t group_load(const uint8_t *ctrl)
+{
+	uint64_t group;
+
+	memcpy(&group, ctrl, sizeof(group));
+
+	/* control byte i must be byte i of the word, whatever the endianness */
+	return sys_le64_to_cpu(group);
+}
+
+/* Top bit of every byte equal to h, with rare false positives right above a match */
+static inline uint64_t group_match(uint64_t group, uint8_t h)
+{
+	uint64_t x = group ^ (LSBS * h);
+
+	return (x - LSBS) & ~x & MSBS;
+}
+
+/* Top bit of every CTRL_EMPTY byte, the only marker with bit 1 clear */
+static inline uint64_t group_match_empty(uint64_t group)
+{
+	return group & ~(group << 6) & MSBS;
+}
+
+/* Top bit of every CTRL_EMPTY or CTRL_DELETED byte, the markers with bit 0 clear */
+static inline uint64_t group_match_free(uint64_t group)
+{
+	return group & ~(group << 7) & MSBS;
+}
+
+static inline size_t group_first(uint64_t mask)
+{
+	return u64_count_trailing_zeros(mask) / 8;
+}
+
+/*
+ * Find the slot of @p key. If it is not in the map and @p avail is not NULL,
+ * store there the first slot on its probe sequence that a new entry can use.
+ */
+static bool sys_hashmap_oa_gp_find(const struct sys_hashmap *map, uint64_t key, uint32_t hash,
+				   size_t *slot, size_t *avail)
+{
+	const uint8_t *const ctrl = ctrl_bytes(map->data);
+	const struct oagp_entry *const slots = entries(map->data);
+	const size_t n_groups = n_slots(map->data->n_buckets) / GROUP_WIDTH;
+	const uint8_t h = ctrl_hash(hash);
+	size_t g = (hash >> 7) & (n_groups - 1);
+	uint64_t group;
+	uint64_t mask;
+	size_t j;
+
+	/* triangular numbers visit every group once when their number is a power of 2 */
+	for (size_t i = 1; i <= n_groups; g = (g + i) & (n_groups - 1), ++i) {
+		group = group_load(&ctrl[g * GROUP_WIDTH]);
+
+		for (mask = group_match(group, h); mask != 0; mask &= mask - 1) {
+			j = g * GROUP_WIDTH + group_first(mask);
+			if (slots[j].key == key) {
+				*slot = j;
+				return true;
+			}
+		}
+
+		mask = group_match_free(group);
+		if (avail != NULL && mask != 0) {
+			*avail = g * GROUP_WIDTH + group_first(mask);
+			avail = NULL;
+		}
+
+		/* the probe sequence of any key stops at the first group with an empty slot */
+		if (group_match_empty(group) != 0) {
+			break;
+		}
+	}
+
+	return false;
+}
+
+static int sys_hashmap_oa_gp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					      uint64_t *old_value)
+{
+	size_t slot = SIZE_MAX;
+	uint8_t *const ctrl = ctrl_bytes(map->data);
+	struct oagp_entry *const slots = entries(map->data);
+	const uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+
+	if (sys_hashmap_oa_gp_find(map, key, hash, &slot, &slot)) {
+		if (old_value != NULL) {
+			*old_value = slots[slot].value;
+		}
+
+		slots[slot].value = value;
+
+		return 0;
+	}
+
+	__ASSERT_NO_MSG(slot < n_slots(data->n_buckets));
+
+	if (ctrl[slot] == CTRL_DELETED) {
+		--data->n_tombstones;
+	}
+
+	ctrl[slot] = ctrl_hash(hash);
+	slots[slot].key = key;
+	slots[slot].value = value;
+	++data->size;
+
+	return 1;
+}
+
+static int sys_hashmap_oa_gp_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_slots;
+	size_t new_n_slots;
+	size_t new_n_buckets = 0;
+	uint8_t *old_ctrl;
+	uint8_t *new_ctrl;
+	struct oagp_entry *old_slots;
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* extract all entries from the hashmap */
+	old_size = data->size;
+	old_n_slots = n_slots(data->n_buckets);
+	old_ctrl = ctrl_bytes(map->data);
+	old_slots = entries(map->data);
+
+	new_n_slots = n_slots(new_n_buckets);
+	new_ctrl = map->alloc_func(NULL, new_n_slots * (1 + sizeof(struct oagp_entry)));
+	if (new_ctrl == NULL && new_n_slots != 0) {
+		return -ENOMEM;
+	}
+
+	if (new_ctrl != NULL) {
+		memset(new_ctrl, CTRL_EMPTY, new_n_buckets);
+		memset(&new_ctrl[new_n_buckets], CTRL_PAD, new_n_slots - new_n_buckets);
+	}
+
+	data->size = 0;
+	data->n_tombstones = 0;
+	data->buckets = new_ctrl;
+	data->n_buckets = new_n_buckets;
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_slots && j < old_size; ++i) {
+		if ((old_ctrl[i] & CTRL_EMPTY) == 0) {
+			sys_hashmap_oa_gp_insert_no_rehash(map, old_slots[i].key, old_slots[i].value,
+							   NULL);
+			++j;
+		}
+	}
+
+	/* free the old Hashmap */
+	map->alloc_func(old_ctrl, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_oa_gp_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	const uint8_t *const ctrl = ctrl_bytes(map->data);
+	const struct oagp_entry *const slots = entries(map->data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = (void *)ctrl;
+	}
+
+	i = (const uint8_t *)it->state - ctrl;
+	__ASSERT(i < n_slots(map->data->n_buckets), "Invalid iterator state %p", it->state);
+
+	for (; i < n_slots(map->data->n_buckets); ++i) {
+		if ((ctrl[i] & CTRL_EMPTY) == 0) {
+			it->state = (void *)&ctrl[i + 1];
+			it->key = slots[i].key;
+			it->value = slots[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Open Addressing / Group Probe Hashmap API
+ */
+
+static void sys_hashmap_oa_gp_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_gp_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_gp_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+	const uint8_t *const ctrl = ctrl_bytes(map->data);
+	const struct oagp_entry *const slots = entries(map->data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < n_slots(data->n_buckets) && j < data->size;
+	     ++i) {
+		if ((ctrl[i] & CTRL_EMPTY) == 0) {
+			cb(slots[i].key, slots[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+	data->n_tombstones = 0;
+}
+
+static inline int sys_hashmap_oa_gp_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+					   uint64_t *old_value)
+{
+	int ret;
+
+	ret = sys_hashmap_oa_gp_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sys_hashmap_oa_gp_insert_no_rehash(map, key, value, old_value);
+}
+
+static bool sys_hashmap_oa_gp_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t slot;
+	uint8_t *ctrl;
+	struct sys_hashmap_oa_gp_data *data = (struct sys_hashmap_oa_gp_data *)map->data;
+
+	if (data->n_buckets == 0 ||
+	    !sys_hashmap_oa_gp_find(map, key, map->hash_func(&key, sizeof(key)), &slot, NULL)) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entries(map->data)[slot].value;
+	}
+
+	/*
+	 * A group that has an empty slot has never been full since the last
+	 * rehash, so no probe sequence went past it and the slot can be made
+	 * empty again. Otherwise it must stay in the way of lookups.
+	 */
+	ctrl = ctrl_bytes(map->data);
+	if (group_match_empty(group_load(&ctrl[ROUND_DOWN(slot, GROUP_WIDTH)])) != 0) {
+		ctrl[slot] = CTRL_EMPTY;
+	} else {
+		ctrl[slot] = CTRL_DELETED;
+		++data->n_tombstones;
+	}
+
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_oa_gp_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_oa_gp_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t slot;
+
+	if (map->data->n_buckets == 0 ||
+	    !sys_hashmap_oa_gp_find(map, key, map->hash_func(&key, sizeof(key)), &slot, NULL)) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entries(map->data)[slot].value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_gp_api = {
+	.iter = sys_hashmap_oa_gp_iter,
+	.clear = sys_hashmap_oa_gp_clear,
+	.insert = sys_hashmap_oa_gp_insert,
+	.remove = sys_hashmap_oa_gp_remove,
+	.get = sys_hashmap_oa_gp_get,
+};
@@ -148,6 +148,55 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/*
+ * Small chunks are not merged back into the heap when freed, but
+ * cached on a free list of their exact size, linked through their
+ * FREE_NEXT field, from which they are allocated again in constant
+ * time.  They stay marked used meanwhile, so that their neighbors
+ * never merge with them, but are accounted as free in the runtime
+ * statistics.
+ */
+BUILD_ASSERT(sizeof(((struct z_heap *)0)->slab_next) <= Z_HEAP_SLABS_SIZE);
+
+static void slab_push(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	CHECK(sz < ARRAY_SIZE(h->slab_next));
+
+	set_next_free_chunk(h, c, h->slab_next[sz]);
+	h->slab_next[sz] = c;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+}
+
+/* Give all cached chunks back to the heap.  Returns true if there was any. */
+static bool slab_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 0; sz < ARRAY_SIZE(h->slab_next); sz++) {
+		chunkid_t c;
+
+		while ((c = h->slab_next[sz]) != 0U) {
+			h->slab_next[sz] = next_free_chunk(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+			h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#endif /* CONFIG_SYS_HEAP_SLABS */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -160,7 +209,7 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
-void sys_heap_free(struct sys_heap *heap, void *mem)
+static void heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
 		return; /* ISO C free() semantics */
@@ -184,7 +233,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +242,14 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if (slab_sized(h, chunk_size(h, c))) {
+		slab_push(h, c);
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -260,7 +316,68 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+/* Allocate a chunk of exactly sz units, splitting off any remainder */
+static chunkid_t alloc_exact_chunk(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = alloc_chunk(h, sz);
+
+	if (c == 0U) {
+		return 0;
+	}
+
+	/* Split off remainder if any */
+	if (chunk_size(h, c) > sz) {
+		split_chunks(h, c, c + sz);
+		free_list_add(h, c + sz);
+	}
+
+	return c;
+}
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+/*
+ * Take a chunk of size sz from its slab free list.  An empty list is
+ * refilled with CONFIG_SYS_HEAP_SLAB_BATCH chunks carved from a single
+ * one, to keep small chunks of one size together.  Returns 0 if even
+ * that failed, for the caller to fall back to a regular allocation.
+ */
+static chunkid_t slab_alloc(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = h->slab_next[sz];
+
+	if (c != 0U) {
+		h->slab_next[sz] = next_free_chunk(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+		return c;
+	}
+
+	if (CONFIG_SYS_HEAP_SLAB_BATCH == 1) {
+		return 0;
+	}
+
+	c = alloc_exact_chunk(h, sz * CONFIG_SYS_HEAP_SLAB_BATCH);
+	if (c == 0U) {
+		return 0;
+	}
+
+	for (int i = 1; i < CONFIG_SYS_HEAP_SLAB_BATCH; i++) {
+		split_chunks(h, c + (i - 1) * sz, c + i * sz);
+	}
+
+	/* Hand out the first one, cache the others */
+	for (int i = CONFIG_SYS_HEAP_SLAB_BATCH - 1; i > 0; i--) {
+		set_chunk_used(h, c + i * sz, true);
+		slab_push(h, c + i * sz);
+	}
+
+	return c;
+}
+#endif /* CONFIG_SYS_HEAP_SLABS */
+
+static void *heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -270,15 +387,26 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = 0;
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if (slab_sized(h, chunk_sz)) {
+		c = slab_alloc(h, chunk_sz);
+	}
+#endif
+
 	if (c == 0U) {
-		return NULL;
+		c = alloc_exact_chunk(h, chunk_sz);
 	}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if ((c == 0U) && slab_flush(h)) {
+		c = alloc_exact_chunk(h, chunk_sz);
+	}
+#endif
+
+	if (c == 0U) {
+		return NULL;
 	}
 
 	set_chunk_used(h, c, true);
@@ -298,7 +426,7 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
-void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+static void *heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
@@ -316,7 +444,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		gap = MIN(rew, chunk_header_bytes(h));
 	} else {
 		if (align <= chunk_header_bytes(h)) {
-			return sys_heap_alloc(heap, bytes);
+			return heap_alloc(heap, bytes);
 		}
 		rew = 0;
 		gap = chunk_header_bytes(h);
@@ -335,6 +463,12 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	if ((c0 == 0) && slab_flush(h)) {
+		c0 = alloc_chunk(h, padded_sz);
+	}
+#endif
+
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -376,17 +510,17 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	return mem;
 }
 
-void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
-			       size_t align, size_t bytes)
+static void *heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+				  size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 
 	/* special realloc semantics */
 	if (ptr == NULL) {
-		return sys_heap_aligned_alloc(heap, align, bytes);
+		return heap_aligned_alloc(heap, align, bytes);
 	}
 	if (bytes == 0) {
-		sys_heap_free(heap, ptr);
+		heap_free(heap, ptr);
 		return NULL;
 	}
 
@@ -471,19 +605,89 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	 * The calls to allocation and free functions generate
 	 * notification already, so there is no need to those here.
 	 */
-	void *ptr2 = sys_heap_aligned_alloc(heap, align, bytes);
+	void *ptr2 = heap_aligned_alloc(heap, align, bytes);
 
 	if (ptr2 != NULL) {
 		size_t prev_size = chunksz_to_bytes(h, chunk_size(h, c)) - align_gap;
 
 		memcpy(ptr2, ptr, MIN(prev_size, bytes));
-		sys_heap_free(heap, ptr);
+		heap_free(heap, ptr);
+	}
+	return ptr2;
+}
+
+/*
+ * The public entry points wrap the implementation to report to the
+ * profile, if any, only once per call and with the caller's address.
+ */
+#ifdef CONFIG_SYS_HEAP_PROFILE
+#define PROFILE_ALLOC(heap, mem, bytes) do {					\
+		if (unlikely((heap)->profile != NULL)) {			\
+			z_heap_profile_alloc((heap), (mem), (bytes),		\
+					     __builtin_return_address(0));	\
+		}								\
+	} while (false)
+#define PROFILE_FREE(heap, mem) do {						\
+		if (unlikely((heap)->profile != NULL)) {			\
+			z_heap_profile_free((heap), (mem));			\
+		}								\
+	} while (false)
+#else
+#define PROFILE_ALLOC(heap, mem, bytes) do { } while (false)
+#define PROFILE_FREE(heap, mem) do { } while (false)
+#endif
+
+void sys_heap_free(struct sys_heap *heap, void *mem)
+{
+	if (mem != NULL) {
+		PROFILE_FREE(heap, mem);
+	}
+
+	heap_free(heap, mem);
+}
+
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	void *mem = heap_alloc(heap, bytes);
+
+	PROFILE_ALLOC(heap, mem, bytes);
+
+	return mem;
+}
+
+void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	void *mem = heap_aligned_alloc(heap, align, bytes);
+
+	PROFILE_ALLOC(heap, mem, bytes);
+
+	return mem;
+}
+
+void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+			       size_t align, size_t bytes)
+{
+	void *ptr2 = heap_aligned_realloc(heap, ptr, align, bytes);
+
+	/* Reported as a free of the old block and an allocation of the
+	 * new one, as long as the old block is gone
+	 */
+	if ((ptr != NULL) && ((ptr2 != NULL) || (bytes == 0U))) {
+		PROFILE_FREE(heap, ptr);
 	}
+	if (bytes != 0U) {
+		PROFILE_ALLOC(heap, ptr2, bytes);
+	}
+
 	return ptr2;
 }
 
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	heap->profile = NULL;
+#endif
+
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
 
 	if (IS_ENABLED(CONFIG_SYS_HEAP_SMALL_ONLY)) {
@@ -527,6 +731,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+	for (int i = 0; i < ARRAY_SIZE(h->slab_next); i++) {
+		h->slab_next[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
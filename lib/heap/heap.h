@@ -65,6 +65,14 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* One free list per chunk size up to that of the largest slab
+ * allocation, indexed by chunk size, for either header size
+ */
+#define Z_HEAP_SLAB_LISTS \
+	((CONFIG_SYS_HEAP_SLAB_MAX_SIZE + 8U + CHUNK_UNIT - 1U) / CHUNK_UNIT + 1U)
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +81,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SLABS
+	chunkid_t slab_next[Z_HEAP_SLAB_LISTS];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -237,6 +248,14 @@ static inline chunksz_t bytes_to_chunksz(struct z_heap *h, size_t bytes)
 	return chunksz(chunk_header_bytes(h) + bytes);
 }
 
+#ifdef CONFIG_SYS_HEAP_SLABS
+/* Chunks of this size go to the slab free lists when freed */
+static inline bool slab_sized(struct z_heap *h, chunksz_t sz)
+{
+	return sz <= bytes_to_chunksz(h, CONFIG_SYS_HEAP_SLAB_MAX_SIZE);
+}
+#endif
+
 static inline chunksz_t min_chunk_size(struct z_heap *h)
 {
 	return bytes_to_chunksz(h, 1);
@@ -277,6 +296,21 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+	/* Chunks cached on slab free lists are marked used but free */
+	for (chunksz_t sz = 0; sz < ARRAY_SIZE(h->slab_next); sz++) {
+		for (c = h->slab_next[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			*alloc_bytes -= chunksz_to_bytes(h, sz);
+			*free_bytes += chunksz_to_bytes(h, sz);
+		}
+	}
+#endif
 }
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+void z_heap_profile_alloc(struct sys_heap *heap, void *mem, size_t bytes, void *caller);
+void z_heap_profile_free(struct sys_heap *heap, void *mem);
+#endif
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
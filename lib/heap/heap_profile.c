@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+
+/*
+ * Allocation profiling.
+ *
+ * Every allocation updates the counters and the size histogram, which
+ * takes a few instructions.  Only one in CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE
+ * is looked up in the call site table and added to the table of live
+ * sampled blocks, which frees search to measure lifetimes.  Both tables
+ * are small and searched linearly.
+ */
+
+void sys_heap_profile_attach(struct sys_heap *heap, struct sys_heap_profile *profile)
+{
+	if (profile != NULL) {
+		(void)memset(profile, 0, sizeof(*profile));
+		profile->countdown = 1U;
+	}
+
+	heap->profile = profile;
+}
+
+/* Index of a value in a power of two histogram of n buckets */
+static unsigned int log2_bucket(uint32_t val, unsigned int n)
+{
+	return MIN((val == 0U) ? 0U : (unsigned int)LOG2(val), n - 1U);
+}
+
+static struct sys_heap_profile_site *site_get(struct sys_heap_profile *prof,
+					      uintptr_t caller)
+{
+	for (unsigned int i = 0; i < prof->nsites; i++) {
+		if (prof->sites[i].caller == caller) {
+			return &prof->sites[i];
+		}
+	}
+
+	if (prof->nsites == ARRAY_SIZE(prof->sites)) {
+		return NULL;
+	}
+
+	prof->sites[prof->nsites].caller = caller;
+
+	return &prof->sites[prof->nsites++];
+}
+
+static void sample(struct sys_heap_profile *prof, void *mem, size_t bytes, uintptr_t caller)
+{
+	struct sys_heap_profile_site *site = site_get(prof, caller);
+	struct z_heap_profile_live *live;
+
+	if ((site == NULL) || (prof->nlive == ARRAY_SIZE(prof->live))) {
+		prof->dropped++;
+		return;
+	}
+
+	site->allocs++;
+	site->bytes += bytes;
+	site->live_bytes += bytes;
+	site->peak_live_bytes = MAX(site->peak_live_bytes, site->live_bytes);
+
+	live = &prof->live[prof->nlive++];
+	live->mem = mem;
+	live->bytes = (uint32_t)bytes;
+	live->start = (uint32_t)k_uptime_ticks();
+	live->site = (uint16_t)(site - prof->sites);
+}
+
+void z_heap_profile_alloc(struct sys_heap *heap, void *mem, size_t bytes, void *caller)
+{
+	struct sys_heap_profile *prof = heap->profile;
+
+	/* Take the caller of the wrapper around the heap, if any */
+	if (prof->caller != NULL) {
+		caller = prof->caller;
+		prof->caller = NULL;
+	}
+
+	if (mem == NULL) {
+		prof->failures++;
+		return;
+	}
+
+	prof->allocs++;
+	prof->size_hist[log2_bucket((uint32_t)MIN(bytes, UINT32_MAX),
+				    SYS_HEAP_PROFILE_SIZE_BUCKETS)]++;
+
+	if (--prof->countdown == 0U) {
+		prof->countdown = CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE;
+		sample(prof, mem, bytes, (uintptr_t)caller);
+	}
+}
+
+void z_heap_profile_free(struct sys_heap *heap, void *mem)
+{
+	struct sys_heap_profile *prof = heap->profile;
+
+	prof->frees++;
+
+	for (unsigned int i = 0; i < prof->nlive; i++) {
+		struct z_heap_profile_live *live = &prof->live[i];
+
+		if (live->mem == mem) {
+			struct sys_heap_profile_site *site = &prof->sites[live->site];
+			uint32_t lifetime = (uint32_t)k_uptime_ticks() - live->start;
+
+			prof->lifetime_hist[(lifetime == 0U) ? 0U :
+					    log2_bucket(lifetime, SYS_HEAP_PROFILE_LIFETIME_BUCKETS - 1U) + 1U]++;
+			site->frees++;
+			site->live_bytes -= live->bytes;
+
+			*live = prof->live[--prof->nlive];
+			break;
+		}
+	}
+}
+
+void sys_heap_frag_stats_get(struct sys_heap *heap, struct sys_heap_frag_stats *stats)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t c;
+
+	(void)memset(stats, 0, sizeof(*stats));
+
+	for (c = right_chunk(h, 0); c < h->end_chunk; c = right_chunk(h, c)) {
+		if (!chunk_used(h, c) && !solo_free_header(h, c)) {
+			size_t bytes = chunksz_to_bytes(h, chunk_size(h, c));
+
+			stats->free_bytes += bytes;
+			stats->largest_free_bytes = MAX(stats->largest_free_bytes, bytes);
+			stats->free_blocks++;
+		}
+	}
+
+#ifdef CONFIG_SYS_HEAP_SLABS
+	for (chunksz_t sz = 0; sz < ARRAY_SIZE(h->slab_next); sz++) {
+		for (c = h->slab_next[sz]; c != 0U; c = next_free_chunk(h, c)) {
+			size_t bytes = chunksz_to_bytes(h, sz);
+
+			stats->free_bytes += bytes;
+			stats->largest_free_bytes = MAX(stats->largest_free_bytes, bytes);
+			stats->free_blocks++;
+		}
+	}
+#endif
+}
+
+struct export_ctx {
+	sys_heap_profile_export_cb_t cb;
+	void *arg;
+	int err;
+};
+
+static void put_words(struct export_ctx *ctx, const uint32_t *words, size_t n)
+{
+	uint8_t buf[4 * 8];
+
+	while ((ctx->err == 0) && (n != 0U)) {
+		size_t chunk = MIN(n, sizeof(buf) / 4U);
+
+		for (size_t i = 0; i < chunk; i++) {
+			sys_put_le32(words[i], &buf[4 * i]);
+		}
+		ctx->err = ctx->cb(buf, 4U * chunk, ctx->arg);
+
+		words += chunk;
+		n -= chunk;
+	}
+}
+
+static void put_word(struct export_ctx *ctx, uint32_t word)
+{
+	put_words(ctx, &word, 1U);
+}
+
+static void put_addr(struct export_ctx *ctx, uintptr_t addr)
+{
+	put_word(ctx, (uint32_t)addr);
+	put_word(ctx, (uint32_t)((uint64_t)addr >> 32));
+}
+
+int sys_heap_profile_export(const struct sys_heap_profile *profile,
+			    const struct sys_heap_frag_stats *frag,
+			    sys_heap_profile_export_cb_t cb, void *arg)
+{
+	struct export_ctx ctx = {
+		.cb = cb,
+		.arg = arg,
+	};
+	const uint32_t hdr[] = {
+		SYS_HEAP_PROFILE_MAGIC,
+		SYS_HEAP_PROFILE_VERSION,
+		CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE,
+		CONFIG_SYS_CLOCK_TICKS_PER_SEC,
+		SYS_HEAP_PROFILE_SIZE_BUCKETS,
+		SYS_HEAP_PROFILE_LIFETIME_BUCKETS,
+		profile->nsites,
+		(frag != NULL) ? 1U : 0U,
+		profile->allocs,
+		profile->frees,
+		profile->failures,
+		profile->dropped,
+	};
+
+	put_words(&ctx, hdr, ARRAY_SIZE(hdr));
+	put_words(&ctx, profile->size_hist, ARRAY_SIZE(profile->size_hist));
+	put_words(&ctx, profile->lifetime_hist, ARRAY_SIZE(profile->lifetime_hist));
+
+	for (unsigned int i = 0; i < profile->nsites; i++) {
+		const struct sys_heap_profile_site *site = &profile->sites[i];
+
+		put_addr(&ctx, site->caller);
+		put_word(&ctx, site->allocs);
+		put_word(&ctx, site->frees);
+		put_word(&ctx, (uint32_t)site->bytes);
+		put_word(&ctx, (uint32_t)site->live_bytes);
+		put_word(&ctx, (uint32_t)site->peak_live_bytes);
+	}
+
+	if (frag != NULL) {
+		put_word(&ctx, (uint32_t)frag->free_bytes);
+		put_word(&ctx, (uint32_t)frag->largest_free_bytes);
+		put_word(&ctx, (uint32_t)frag->free_blocks);
+	}
+
+	return ctx.err;
+}
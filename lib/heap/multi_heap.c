@@ -40,15 +40,39 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+/* Make the heap the choice function allocates from record the caller */
+static void *choice_at(struct sys_multi_heap *mheap, void *cfg, size_t align,
+		       size_t bytes, void *caller)
+{
+	void *ret;
+
+	for (int i = 0; i < mheap->nheaps; i++) {
+		z_sys_heap_profile_caller_set(mheap->heaps[i].heap, caller);
+	}
+
+	ret = mheap->choice(mheap, cfg, align, bytes);
+
+	for (int i = 0; i < mheap->nheaps; i++) {
+		z_sys_heap_profile_caller_set(mheap->heaps[i].heap, NULL);
+	}
+
+	return ret;
+}
+#else
+#define choice_at(mheap, cfg, align, bytes, caller) \
+	((mheap)->choice((mheap), (cfg), (align), (bytes)))
+#endif
+
 void *sys_multi_heap_alloc(struct sys_multi_heap *mheap, void *cfg, size_t bytes)
 {
-	return mheap->choice(mheap, cfg, 0, bytes);
+	return choice_at(mheap, cfg, 0, bytes, Z_HEAP_CALLER());
 }
 
 void *sys_multi_heap_aligned_alloc(struct sys_multi_heap *mheap,
 				   void *cfg, size_t align, size_t bytes)
 {
-	return mheap->choice(mheap, cfg, align, bytes);
+	return choice_at(mheap, cfg, align, bytes, Z_HEAP_CALLER());
 }
 
 const struct sys_multi_heap_rec *sys_multi_heap_get_heap(const struct sys_multi_heap *mheap,
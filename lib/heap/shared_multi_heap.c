@@ -13,15 +13,40 @@
 
 static struct sys_multi_heap shared_multi_heap;
 
+struct smh_heap {
+	struct sys_heap heap;
+	struct k_spinlock lock;
+	uint32_t cpus;
+};
+
 static struct {
-	struct sys_heap heap_pool[MAX_MULTI_HEAPS];
+	struct smh_heap heap_pool[MAX_MULTI_HEAPS];
 	unsigned int heap_cnt;
 } smh_data[MAX_SHARED_MULTI_HEAP_ATTR];
 
+/* Heaps local to the CPU first, then the shared heaps, then the remote heaps */
+enum smh_locality {
+	SMH_LOCAL,
+	SMH_SHARED,
+	SMH_REMOTE,
+	SMH_LOCALITY_NUM,
+};
+
+static enum smh_locality smh_locality(struct smh_heap *h, uint32_t cpu)
+{
+	if (h->cpus == 0) {
+		return SMH_SHARED;
+	}
+
+	return (h->cpus & BIT(cpu)) ? SMH_LOCAL : SMH_REMOTE;
+}
+
 static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
 {
-	struct sys_heap *h;
 	enum shared_multi_heap_attr attr;
+	k_spinlock_key_t key;
+	struct smh_heap *h;
+	uint32_t cpu;
 	void *block;
 
 	attr = (enum shared_multi_heap_attr)(long) cfg;
@@ -30,29 +55,41 @@ static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, s
 		return NULL;
 	}
 
-	/* Set in case the user requested a non-existing attr */
-	block = NULL;
+	/*
+	 * The thread may migrate once the CPU is read, which only costs
+	 * locality.
+	 */
+	cpu = arch_curr_cpu()->id;
 
-	for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
-		h = &smh_data[attr].heap_pool[hdx];
+	for (enum smh_locality loc = SMH_LOCAL; loc < SMH_LOCALITY_NUM; loc++) {
+		for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
+			h = &smh_data[attr].heap_pool[hdx];
 
-		if (h->heap == NULL) {
-			return NULL;
-		}
+			if (h->heap.heap == NULL) {
+				return NULL;
+			}
+
+			if (smh_locality(h, cpu) != loc) {
+				continue;
+			}
 
-		block = sys_heap_aligned_alloc(h, align, size);
-		if (block != NULL) {
-			break;
+			key = k_spin_lock(&h->lock);
+			block = sys_heap_aligned_alloc(&h->heap, align, size);
+			k_spin_unlock(&h->lock, key);
+
+			if (block != NULL) {
+				return block;
+			}
 		}
 	}
 
-	return block;
+	return NULL;
 }
 
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data)
 {
 	enum shared_multi_heap_attr attr;
-	struct sys_heap *h;
+	struct smh_heap *h;
 	unsigned int slot;
 
 	attr = region->attr;
@@ -69,8 +106,9 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 	slot = smh_data[attr].heap_cnt;
 	h = &smh_data[attr].heap_pool[slot];
 
-	sys_heap_init(h, (void *) region->addr, region->size);
-	sys_multi_heap_add_heap(&shared_multi_heap, h, user_data);
+	h->cpus = region->cpus;
+	sys_heap_init(&h->heap, (void *) region->addr, region->size);
+	sys_multi_heap_add_heap(&shared_multi_heap, &h->heap, user_data);
 
 	smh_data[attr].heap_cnt++;
 
@@ -79,7 +117,20 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 
 void shared_multi_heap_free(void *block)
 {
-	sys_multi_heap_free(&shared_multi_heap, block);
+	const struct sys_multi_heap_rec *rec;
+	k_spinlock_key_t key;
+	struct smh_heap *h;
+
+	if (block == NULL) {
+		return;
+	}
+
+	rec = sys_multi_heap_get_heap(&shared_multi_heap, block);
+	h = CONTAINER_OF(rec->heap, struct smh_heap, heap);
+
+	key = k_spin_lock(&h->lock);
+	sys_heap_free(&h->heap, block);
+	k_spin_unlock(&h->lock, key);
 }
 
 void *shared_multi_heap_alloc(enum shared_multi_heap_attr attr, size_t bytes)
@@ -7,9 +7,39 @@
  */
 
 #include <string.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <sys/types.h>
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+#define WORD_SIZE sizeof(mem_word_t)
+#define WORD_MASK (sizeof(mem_word_t) - 1)
+
+/* 0x01 and 0x80 repeated in every byte of a word */
+#define WORD_LSBS ((mem_word_t)-1 / 0xff)
+#define WORD_MSBS (WORD_LSBS << 7)
+
+static inline bool word_aligned(const void *p)
+{
+	return ((uintptr_t)p & WORD_MASK) == 0;
+}
+
+static inline bool same_alignment(const void *p1, const void *p2)
+{
+	return (((uintptr_t)p1 ^ (uintptr_t)p2) & WORD_MASK) == 0;
+}
+
+/*
+ * Non-zero if any byte of the word is zero. Whole aligned words never
+ * cross a page or memory region boundary, so the word-at-a-time loops
+ * below may read the bytes following the end of a string or buffer.
+ */
+static inline mem_word_t word_has_zero(mem_word_t w)
+{
+	return (w - WORD_LSBS) & ~w & WORD_MSBS;
+}
+#endif
+
 /**
  *
  * @brief Copy a string
@@ -106,14 +136,30 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *p = s;
 
-	while (*s != '\0') {
-		s++;
-		n++;
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	while (!word_aligned(p)) {
+		if (*p == '\0') {
+			return p - s;
+		}
+		p++;
 	}
 
-	return n;
+	const mem_word_t *w = (const mem_word_t *)p;
+
+	while (word_has_zero(*w) == 0) {
+		w++;
+	}
+
+	p = (const char *)w;
+#endif
+
+	while (*p != '\0') {
+		p++;
+	}
+
+	return p - s;
 }
 
 /**
@@ -125,6 +171,29 @@ size_t strlen(const char *s)
 
 int strcmp(const char *s1, const char *s2)
 {
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	if (same_alignment(s1, s2)) {
+		while (!word_aligned(s1) && (*s1 == *s2) && (*s1 != '\0')) {
+			s1++;
+			s2++;
+		}
+
+		if (word_aligned(s1)) {
+			const mem_word_t *w1 = (const mem_word_t *)s1;
+			const mem_word_t *w2 = (const mem_word_t *)s2;
+
+			/* the bytes up to a difference or the end are compared below */
+			while ((*w1 == *w2) && (word_has_zero(*w1) == 0)) {
+				w1++;
+				w2++;
+			}
+
+			s1 = (const char *)w1;
+			s2 = (const char *)w2;
+		}
+	}
+#endif
+
 	while ((*s1 == *s2) && (*s1 != '\0')) {
 		s1++;
 		s2++;
@@ -222,6 +291,30 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	const char *c1 = m1;
 	const char *c2 = m2;
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	if (same_alignment(c1, c2)) {
+		while (!word_aligned(c1) && (n > 0) && (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if (word_aligned(c1)) {
+			const mem_word_t *w1 = (const mem_word_t *)c1;
+			const mem_word_t *w2 = (const mem_word_t *)c2;
+
+			while ((n >= WORD_SIZE) && (*w1 == *w2)) {
+				w1++;
+				w2++;
+				n -= WORD_SIZE;
+			}
+
+			c1 = (const char *)w1;
+			c2 = (const char *)w2;
+		}
+	}
+#endif
+
 	if (!n) {
 		return 0;
 	}
@@ -278,38 +371,71 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
-
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
+	if (n >= WORD_SIZE) {
 
-		/* do byte-sized copying until word-aligned or finished */
+		/* do byte-sized copying until the destination is word-aligned */
 
-		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
+		while (!word_aligned(d_byte)) {
 			*(d_byte++) = *(s_byte++);
 			n--;
 		}
 
-		/* do word-sized copying as long as possible */
-
+		unsigned char *d_start = d_byte;
 		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+		if (word_aligned(s_byte)) {
+			const mem_word_t *s_word = (const mem_word_t *)s_byte;
+
+			/* copy four words at a time, allowing loads and stores to pipeline */
+
+			while (n >= 4 * WORD_SIZE) {
+				mem_word_t w0 = s_word[0];
+				mem_word_t w1 = s_word[1];
+				mem_word_t w2 = s_word[2];
+				mem_word_t w3 = s_word[3];
+
+				d_word[0] = w0;
+				d_word[1] = w1;
+				d_word[2] = w2;
+				d_word[3] = w3;
+				d_word += 4;
+				s_word += 4;
+				n -= 4 * WORD_SIZE;
+			}
+
+			while (n >= WORD_SIZE) {
+				*(d_word++) = *(s_word++);
+				n -= WORD_SIZE;
+			}
+		} else {
+			/*
+			 * Build every destination word out of the two aligned
+			 * source words it straddles, so that all accesses are
+			 * word-aligned.
+			 */
+			const unsigned int shift = 8 * ((uintptr_t)s_byte & WORD_MASK);
+			const mem_word_t *s_word = (const mem_word_t *)(s_byte - shift / 8);
+			mem_word_t lo = *(s_word++);
+			mem_word_t hi;
+
+			while (n >= WORD_SIZE) {
+				hi = *(s_word++);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+				*(d_word++) = (lo << shift) | (hi >> (8 * WORD_SIZE - shift));
+#else
+				*(d_word++) = (lo >> shift) | (hi << (8 * WORD_SIZE - shift));
+#endif
+				lo = hi;
+				n -= WORD_SIZE;
+			}
 		}
 
 		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
+		s_byte += d_byte - d_start;
 	}
 #endif
 
@@ -357,6 +483,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -384,15 +519,35 @@ void *memset(void *buf, int c, size_t n)
 
 void *memchr(const void *s, int c, size_t n)
 {
-	if (n != 0) {
-		const unsigned char *p = s;
+	const unsigned char *p = s;
+	const unsigned char c_byte = (unsigned char)c;
 
-		do {
-			if (*p++ == (unsigned char)c) {
-				return ((void *)(p - 1));
-			}
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	while (!word_aligned(p) && (n > 0)) {
+		if (*p == c_byte) {
+			return (void *)p;
+		}
+		p++;
+		n--;
+	}
+
+	const mem_word_t *w = (const mem_word_t *)p;
+	const mem_word_t c_word = WORD_LSBS * c_byte;
 
-		} while (--n != 0);
+	while ((n >= WORD_SIZE) && (word_has_zero(*w ^ c_word) == 0)) {
+		w++;
+		n -= WORD_SIZE;
+	}
+
+	p = (const unsigned char *)w;
+#endif
+
+	while (n > 0) {
+		if (*p == c_byte) {
+			return (void *)p;
+		}
+		p++;
+		n--;
 	}
 
 	return NULL;
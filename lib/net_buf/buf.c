@@ -364,6 +364,21 @@ struct net_buf *net_buf_alloc_fixed(struct net_buf_pool *pool,
 }
 #endif
 
+int net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+		       struct net_buf **bufs, int count, k_timeout_t timeout)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		bufs[i] = net_buf_alloc_len(pool, size, i == 0 ? timeout : K_NO_WAIT);
+		if (!bufs[i]) {
+			break;
+		}
+	}
+
+	return i;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_with_data_debug(struct net_buf_pool *pool,
 					      void *data, size_t size,
@@ -14,6 +14,8 @@
 #include <sys/types.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/syscall.h>
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(cbprintf_package, CONFIG_CBPRINTF_PACKAGE_LOG_LEVEL);
 
@@ -42,6 +44,67 @@ static inline bool ptr_in_rodata(const char *addr)
 #endif
 }
 
+#if (CONFIG_CBPRINTF_PACKAGE_FMT_CACHE > 0) && !defined(CBPRINTF_VIA_UNIT_TEST)
+/*
+ * A format string in read-only memory never changes, so the argument sizes
+ * found by parsing it once can be remembered, keyed by its address, and
+ * replayed the next time it is packaged. Entries are filled once and never
+ * evicted. Formats with floating point arguments or more than
+ * FMT_CACHE_MAX_ARGS arguments are not cached.
+ */
+#define FMT_CACHE 1
+#define FMT_CACHE_MAX_ARGS 8
+#define FMT_CACHE_BUSY ((atomic_ptr_val_t)1)
+
+struct fmt_cache_arg {
+	uint8_t size;
+	uint8_t align;
+	int8_t idx;
+	bool is_str;
+};
+
+struct fmt_cache_entry {
+	/* NULL if free, FMT_CACHE_BUSY while being filled. */
+	atomic_ptr_t fmt;
+	uint8_t num_args;
+	struct fmt_cache_arg args[FMT_CACHE_MAX_ARGS];
+};
+
+static struct fmt_cache_entry fmt_cache[CONFIG_CBPRINTF_PACKAGE_FMT_CACHE];
+
+static inline struct fmt_cache_entry *fmt_cache_slot(const char *fmt)
+{
+	/* Multiplicative hashing, format strings are not word aligned. */
+	uint32_t hash = (uint32_t)(uintptr_t)fmt * 0x9e3779b1U;
+
+	return &fmt_cache[(hash >> 8) % CONFIG_CBPRINTF_PACKAGE_FMT_CACHE];
+}
+
+static inline const struct fmt_cache_entry *fmt_cache_get(const char *fmt)
+{
+	const struct fmt_cache_entry *entry = fmt_cache_slot(fmt);
+
+	return (atomic_ptr_get(&entry->fmt) == fmt) ? entry : NULL;
+}
+
+static void fmt_cache_put(const char *fmt, const struct fmt_cache_arg *args,
+			  unsigned int num_args)
+{
+	struct fmt_cache_entry *entry = fmt_cache_slot(fmt);
+
+	if (!atomic_ptr_cas(&entry->fmt, NULL, FMT_CACHE_BUSY)) {
+		/* Slot taken by another format. */
+		return;
+	}
+
+	memcpy(entry->args, args, num_args * sizeof(args[0]));
+	entry->num_args = num_args;
+
+	/* Readers only use the entry once it is complete. */
+	atomic_ptr_set(&entry->fmt, (atomic_ptr_val_t)fmt);
+}
+#endif /* CONFIG_CBPRINTF_PACKAGE_FMT_CACHE > 0 */
+
 /*
  * va_list creation
  */
@@ -268,6 +331,15 @@ int cbvprintf_package(void *packaged, size_t len, uint32_t flags,
 	int fros_cnt = 1 + Z_CBPRINTF_PACKAGE_FIRST_RO_STR_CNT_GET(flags);
 	bool is_str_arg = false;
 	union cbprintf_package_hdr *pkg_hdr = packaged;
+#ifdef FMT_CACHE
+	const char *fmt_start = fmt;
+	/* Cached arguments of fmt, if found. */
+	const struct fmt_cache_entry *cached = NULL;
+	/* Otherwise the arguments are recorded to cache them. */
+	struct fmt_cache_arg recorded[FMT_CACHE_MAX_ARGS];
+	bool recording = false;
+	unsigned int cache_idx = 0;
+#endif
 
 	/* Buffer must be aligned at least to size of a pointer. */
 	if ((uintptr_t)packaged % sizeof(void *)) {
@@ -328,6 +400,14 @@ int cbvprintf_package(void *packaged, size_t len, uint32_t flags,
 		return -ENOSPC;
 	}
 
+#ifdef FMT_CACHE
+	if (!(flags & CBPRINTF_PACKAGE_ARGS_ARE_TAGGED) && !k_is_user_context() &&
+	    ptr_in_rodata(fmt)) {
+		cached = fmt_cache_get(fmt);
+		recording = (cached == NULL);
+	}
+#endif
+
 	/*
 	 * Then process the format string itself.
 	 * Here we branch directly into the code processing strings
@@ -343,6 +423,22 @@ int cbvprintf_package(void *packaged, size_t len, uint32_t flags,
 
 	while (true) {
 
+#ifdef FMT_CACHE
+		if (cached != NULL) {
+			/* Skip parsing, the argument sizes are known. */
+			if (cache_idx == cached->num_args) {
+				break;
+			}
+
+			size = cached->args[cache_idx].size;
+			align = cached->args[cache_idx].align;
+			arg_idx = cached->args[cache_idx].idx;
+			is_str_arg = cached->args[cache_idx].is_str;
+			cache_idx++;
+			goto store_arg;
+		}
+#endif
+
 #if defined(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
 		if ((flags & CBPRINTF_PACKAGE_ARGS_ARE_TAGGED)
 		    == CBPRINTF_PACKAGE_ARGS_ARE_TAGGED) {
@@ -567,6 +663,9 @@ int cbvprintf_package(void *packaged, size_t len, uint32_t flags,
 				 */
 				union { double d; long double ld; } v;
 
+#ifdef FMT_CACHE
+				recording = false;
+#endif
 				if (fmt[-1] == 'L') {
 					v.ld = va_arg(ap, long double);
 					align = VA_STACK_ALIGN(long double);
@@ -602,6 +701,22 @@ int cbvprintf_package(void *packaged, size_t len, uint32_t flags,
 			}
 		}
 
+#ifdef FMT_CACHE
+		if (recording) {
+			if (cache_idx < FMT_CACHE_MAX_ARGS && arg_idx <= INT8_MAX) {
+				recorded[cache_idx] = (struct fmt_cache_arg){
+					.size = size,
+					.align = align,
+					.idx = arg_idx,
+					.is_str = is_str_arg,
+				};
+				cache_idx++;
+			} else {
+				recording = false;
+			}
+		}
+store_arg:
+#endif
 		/* align destination buffer location */
 		buf = ROUND_UP(buf, align);
 
@@ -723,6 +838,12 @@ process_string:
 		return -EINVAL;
 	}
 
+#ifdef FMT_CACHE
+	if (recording) {
+		fmt_cache_put(fmt_start, recorded, cache_idx);
+	}
+#endif
+
 	/*
 	 * If all we wanted was to count required buffer size
 	 * then we have it now.
@@ -16,11 +16,16 @@ LOG_MODULE_REGISTER(p4wq, CONFIG_LOG_DEFAULT_LEVEL);
 
 struct device;
 
-static void set_prio(struct k_thread *th, struct k_p4wq_work *item)
+static void set_thread_prio(struct k_thread *th, int32_t priority, int32_t deadline)
 {
 	__ASSERT_NO_MSG(!IS_ENABLED(CONFIG_SMP) || !z_is_thread_queued(th));
-	th->base.prio = item->priority;
-	th->base.prio_deadline = item->deadline;
+	th->base.prio = priority;
+	th->base.prio_deadline = deadline;
+}
+
+static void set_prio(struct k_thread *th, struct k_p4wq_work *item)
+{
+	set_thread_prio(th, item->priority, item->deadline);
 }
 
 static bool rb_lessthan(struct rbnode *a, struct rbnode *b)
@@ -72,6 +77,131 @@ static inline bool item_lessthan(struct k_p4wq_work *a, struct k_p4wq_work *b)
 	return false;
 }
 
+/* Move the highest priority item of the queue to its active list, to be
+ * run by the current thread. Called with the queue lock held.
+ */
+static struct k_p4wq_work *item_start(struct k_p4wq *queue)
+{
+	struct rbnode *r = rb_get_max(&queue->queue);
+	struct k_p4wq_work *w;
+
+	if (r == NULL) {
+		return NULL;
+	}
+
+	w = CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+	rb_remove(&queue->queue, r);
+	w->thread = _current;
+	sys_dlist_append(&queue->active, &w->dlnode);
+	set_prio(_current, w);
+	thread_clear_requeued(_current);
+
+	return w;
+}
+
+/* Called with the lock of the queue the item was started from held */
+static void item_finish(struct k_p4wq_work *w)
+{
+	/* Remove from the active list only if it
+	 * wasn't resubmitted already
+	 */
+	if (!thread_was_requeued(_current)) {
+		sys_dlist_remove(&w->dlnode);
+		w->thread = NULL;
+		k_sem_give(&w->done_sem);
+	}
+}
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+/* Run the highest priority item of the first peer queue that has any,
+ * starting from the next one. The queue lock is released meanwhile:
+ * returns true if an item was run or the queue got one, false with the
+ * queue still empty. Peer locks are never taken together, nor with the
+ * queue lock.
+ */
+static bool p4wq_steal(struct k_p4wq *queue, k_spinlock_key_t *k)
+{
+	struct k_p4wq_work *w = NULL;
+	struct k_p4wq *peer = NULL;
+	k_spinlock_key_t pk;
+	uint32_t idx;
+
+	if (queue->num_peers < 2) {
+		return false;
+	}
+
+	idx = queue - queue->peers;
+
+	k_spin_unlock(&queue->lock, *k);
+
+	for (uint32_t i = 1; i < queue->num_peers && w == NULL; i++) {
+		peer = &queue->peers[(idx + i) % queue->num_peers];
+
+		pk = k_spin_lock(&peer->lock);
+		/* The item stays on the active list of its queue, so that
+		 * resubmissions and priority decisions there account for it
+		 */
+		w = item_start(peer);
+		k_spin_unlock(&peer->lock, pk);
+	}
+
+	if (w != NULL) {
+		w->handler(w);
+
+		pk = k_spin_lock(&peer->lock);
+		item_finish(w);
+		k_spin_unlock(&peer->lock, pk);
+	}
+
+	*k = k_spin_lock(&queue->lock);
+
+	return w != NULL || rb_get_max(&queue->queue) != NULL;
+}
+
+/* Wake up to n idle threads of peer queues, that steal from this one */
+static uint32_t p4wq_kick_peers(struct k_p4wq *queue, uint32_t n, int32_t priority,
+				int32_t deadline)
+{
+	uint32_t woken = 0;
+	uint32_t idx;
+
+	if (queue->num_peers < 2) {
+		return 0;
+	}
+
+	idx = queue - queue->peers;
+	for (uint32_t i = 1; i < queue->num_peers && woken < n; i++) {
+		struct k_p4wq *peer = &queue->peers[(idx + i) % queue->num_peers];
+		k_spinlock_key_t pk = k_spin_lock(&peer->lock);
+		struct k_thread *th = z_unpend_first_thread(&peer->waitq);
+
+		if (th != NULL) {
+			set_thread_prio(th, priority, deadline);
+			z_ready_thread(th);
+			woken++;
+		}
+		k_spin_unlock(&peer->lock, pk);
+	}
+
+	if (woken > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return woken;
+}
+#else
+static inline bool p4wq_steal(struct k_p4wq *queue, k_spinlock_key_t *k)
+{
+	return false;
+}
+
+static inline uint32_t p4wq_kick_peers(struct k_p4wq *queue, uint32_t n, int32_t priority,
+				       int32_t deadline)
+{
+	return 0;
+}
+#endif /* CONFIG_P4WQ_WORK_STEALING */
+
 static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 {
 	ARG_UNUSED(p1);
@@ -80,33 +210,17 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
 
 	while (true) {
-		struct rbnode *r = rb_get_max(&queue->queue);
-
-		if (r) {
-			struct k_p4wq_work *w
-				= CONTAINER_OF(r, struct k_p4wq_work, rbnode);
-
-			rb_remove(&queue->queue, r);
-			w->thread = _current;
-			sys_dlist_append(&queue->active, &w->dlnode);
-			set_prio(_current, w);
-			thread_clear_requeued(_current);
+		struct k_p4wq_work *w = item_start(queue);
 
+		if (w) {
 			k_spin_unlock(&queue->lock, k);
 
 			w->handler(w);
 
 			k = k_spin_lock(&queue->lock);
 
-			/* Remove from the active list only if it
-			 * wasn't resubmitted already
-			 */
-			if (!thread_was_requeued(_current)) {
-				sys_dlist_remove(&w->dlnode);
-				w->thread = NULL;
-				k_sem_give(&w->done_sem);
-			}
-		} else {
+			item_finish(w);
+		} else if (!p4wq_steal(queue, &k)) {
 			z_pend_curr(&queue->lock, k, &queue->waitq, K_FOREVER);
 			k = k_spin_lock(&queue->lock);
 		}
@@ -131,6 +245,16 @@ void k_p4wq_init(struct k_p4wq *queue)
 	sys_dlist_init(&queue->active);
 }
 
+#ifdef CONFIG_P4WQ_WORK_STEALING
+void k_p4wq_enable_stealing(struct k_p4wq *queues, uint32_t num)
+{
+	for (uint32_t i = 0; i < num; i++) {
+		queues[i].peers = queues;
+		queues[i].num_peers = num;
+	}
+}
+#endif
+
 void k_p4wq_add_thread(struct k_p4wq *queue, struct k_thread *thread,
 			k_thread_stack_t *stack,
 			size_t stack_size)
@@ -145,12 +269,26 @@ static int static_init(void)
 {
 
 	STRUCT_SECTION_FOREACH(k_p4wq_initparam, pp) {
+		bool stealing = IS_ENABLED(CONFIG_P4WQ_WORK_STEALING) &&
+				(pp->flags & K_P4WQ_QUEUE_PER_THREAD) &&
+				(pp->flags & K_P4WQ_WORK_STEALING);
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+		/* Threads steal from all queues as soon as they start */
+		if (stealing) {
+			for (int i = 0; i < pp->num; i++) {
+				k_p4wq_init(pp->queue + i);
+			}
+			k_p4wq_enable_stealing(pp->queue, pp->num);
+		}
+#endif
+
 		for (int i = 0; i < pp->num; i++) {
 			uintptr_t ssz = K_THREAD_STACK_LEN(pp->stack_size);
 			struct k_p4wq *q = pp->flags & K_P4WQ_QUEUE_PER_THREAD ?
 				pp->queue + i : pp->queue;
 
-			if (!i || (pp->flags & K_P4WQ_QUEUE_PER_THREAD)) {
+			if ((!i || (pp->flags & K_P4WQ_QUEUE_PER_THREAD)) && !stealing) {
 				k_p4wq_init(q);
 			}
 
@@ -217,15 +355,14 @@ void k_p4wq_enable_static_thread(struct k_p4wq *queue, struct k_thread *thread,
  */
 SYS_INIT(static_init, APPLICATION, 99);
 
-void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
+/* Called with the queue lock held */
+static void item_insert(struct k_p4wq *queue, struct k_p4wq_work *item, uint32_t now)
 {
-	k_spinlock_key_t k = k_spin_lock(&queue->lock);
-
 	/* Input is a delta time from now (to match
 	 * k_thread_deadline_set()), but we store and use the absolute
 	 * cycle count.
 	 */
-	item->deadline += k_cycle_get_32();
+	item->deadline += now;
 
 	/* Resubmission from within handler?  Remove from active list */
 	if (item->thread == _current) {
@@ -239,59 +376,113 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 
 	rb_insert(&queue->queue, &item->rbnode);
 	item->queue = queue;
+}
 
-	/* If there were other items already ahead of it in the queue,
-	 * then we don't need to revisit active thread state and can
-	 * return.
-	 */
-	if (rb_get_max(&queue->queue) != &item->rbnode) {
-		goto out;
-	}
+/* Highest priority item of the batch that has a lower priority than @p prev,
+ * or any if NULL, with the total order of the queue.
+ */
+static struct k_p4wq_work *batch_next(struct k_p4wq_work **items, size_t count,
+				      struct k_p4wq_work *prev)
+{
+	struct k_p4wq_work *next = NULL;
 
-	/* Check the list of active (running or preempted) items, if
-	 * there are at least an "active target" of those that are
-	 * higher priority than the new item, then no one needs to be
-	 * preempted and we can return.
-	 */
-	struct k_p4wq_work *wi;
-	uint32_t n_beaten_by = 0, active_target = arch_num_cpus();
-
-	SYS_DLIST_FOR_EACH_CONTAINER(&queue->active, wi, dlnode) {
-		/*
-		 * item_lessthan(a, b) == true means a has lower priority than b
-		 * !item_lessthan(a, b) counts all work items with higher or
-		 * equal priority
-		 */
-		if (!item_lessthan(wi, item)) {
-			n_beaten_by++;
+	for (size_t i = 0; i < count; i++) {
+		struct k_p4wq_work *item = items[i];
+
+		if ((prev == NULL || rb_lessthan(&item->rbnode, &prev->rbnode)) &&
+		    (next == NULL || rb_lessthan(&next->rbnode, &item->rbnode))) {
+			next = item;
 		}
 	}
 
-	if (n_beaten_by >= active_target) {
-		/* Too many already have higher priority, not preempting */
-		goto out;
+	return next;
+}
+
+void k_p4wq_submit_batch(struct k_p4wq *queue, struct k_p4wq_work **items, size_t count)
+{
+	k_spinlock_key_t k = k_spin_lock(&queue->lock);
+	struct rbnode *prev_max = rb_get_max(&queue->queue);
+	uint32_t now = k_cycle_get_32();
+	uint32_t n_woken = 0, n_needed = 0, active_target = arch_num_cpus();
+	struct k_p4wq_work *item = NULL;
+	int32_t priority = 0, deadline = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		item_insert(queue, items[i], now);
 	}
 
-	/* Grab a thread, set its priority and queue it.  If there are
-	 * no threads available to unpend, this is a soft runtime
-	 * error: we are breaking our promise about run order.
-	 * Complain.
+	/* Go through the new items from the highest priority one, as long
+	 * as they would run now: a thread needs to be readied for each one
+	 * that is ahead of the items which were already in the queue, and
+	 * of all but "active target" minus one of the active (running or
+	 * preempted) items and of the new items handed a thread before it.
 	 */
-	struct k_thread *th = z_unpend_first_thread(&queue->waitq);
+	while ((item = batch_next(items, count, item)) != NULL) {
+		struct k_p4wq_work *wi;
+		uint32_t n_beaten_by = n_woken + n_needed;
+
+		if (prev_max != NULL && !rb_lessthan(prev_max, &item->rbnode)) {
+			break;
+		}
+
+		SYS_DLIST_FOR_EACH_CONTAINER(&queue->active, wi, dlnode) {
+			/*
+			 * item_lessthan(a, b) == true means a has lower priority than b
+			 * !item_lessthan(a, b) counts all work items with higher or
+			 * equal priority
+			 */
+			if (!item_lessthan(wi, item)) {
+				n_beaten_by++;
+			}
+		}
+
+		if (n_beaten_by >= active_target) {
+			/* Too many already have higher priority, not preempting */
+			break;
+		}
+
+		/* Grab a thread, set its priority and queue it */
+		struct k_thread *th = z_unpend_first_thread(&queue->waitq);
 
-	if (th == NULL) {
-		LOG_WRN("Out of worker threads, priority guarantee violated");
-		goto out;
+		if (th == NULL) {
+			/* Remember the highest of the priorities left without a thread */
+			if (n_needed++ == 0) {
+				priority = item->priority;
+				deadline = item->deadline;
+			}
+			continue;
+		}
+
+		set_prio(th, item);
+		z_ready_thread(th);
+		n_woken++;
 	}
 
-	set_prio(th, item);
-	z_ready_thread(th);
-	z_reschedule(&queue->lock, k);
+	if (n_needed > 0) {
+		k_spin_unlock(&queue->lock, k);
 
-	return;
+		/* If there are no threads available to unpend, this is a
+		 * soft runtime error: we are breaking our promise about run
+		 * order, unless idle threads of other queues take the items.
+		 * Complain.
+		 */
+		if (p4wq_kick_peers(queue, n_needed, priority, deadline) < n_needed) {
+			LOG_WRN("Out of worker threads, priority guarantee violated");
+		}
 
-out:
-	k_spin_unlock(&queue->lock, k);
+		if (n_woken > 0) {
+			z_reschedule_unlocked();
+		}
+	} else if (n_woken > 0) {
+		z_reschedule(&queue->lock, k);
+	} else {
+		k_spin_unlock(&queue->lock, k);
+	}
+}
+
+void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
+{
+	k_p4wq_submit_batch(queue, &item, 1);
 }
 
 bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item)
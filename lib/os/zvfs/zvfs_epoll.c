@@ -0,0 +1,637 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+#define ZVFS_EPOLL_EVENTS                                                                          \
+	(ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT | ZVFS_EPOLLERR | ZVFS_EPOLLHUP)
+
+/* Number of file descriptors checked with one zvfs_poll_internal() call */
+#define ZVFS_EPOLL_CHUNK CONFIG_ZVFS_POLL_MAX
+
+struct zvfs_epoll;
+
+struct zvfs_epoll_entry {
+	/* Node in the ready list if watched, in the polled list otherwise */
+	sys_dnode_t node;
+	struct zvfs_epoll *ep;
+	/* Object of the file descriptor, NULL if the entry is free */
+	void *obj;
+	int fd;
+	uint32_t events;
+	zvfs_epoll_data_t data;
+	/* The object puts the entry on the ready list by itself */
+	bool watched;
+};
+
+struct zvfs_epoll {
+	/* Raised when an entry is put on the ready list */
+	struct k_poll_signal signal;
+	/* Protects the ready list against zvfs_epoll_notify() */
+	struct k_spinlock lock;
+	/* Serializes the changes of the interest list and the waits */
+	struct k_mutex mutex;
+	sys_dlist_t ready;
+	sys_dlist_t polled;
+	size_t polled_count;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	int fd;
+};
+
+int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout);
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static void epoll_ready_add(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	k_spinlock_key_t key = k_spin_lock(&ep->lock);
+
+	if (entry->obj != NULL && !sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_append(&ep->ready, &entry->node);
+	}
+
+	k_spin_unlock(&ep->lock, key);
+
+	k_poll_signal_raise(&ep->signal, 0);
+}
+
+static int epoll_watch(struct zvfs_epoll_entry *entry, bool watch)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	/* The file descriptor may have been closed and reused already */
+	obj = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (obj == NULL || obj != entry->obj) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_EPOLL_WATCH,
+				      watch ? entry : NULL);
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+static void epoll_entry_unlink(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	k_spinlock_key_t key = k_spin_lock(&ep->lock);
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+
+	if (!entry->watched && entry->obj != NULL) {
+		ep->polled_count--;
+	}
+
+	k_spin_unlock(&ep->lock, key);
+}
+
+static void epoll_entry_free(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	k_spinlock_key_t key;
+
+	if (entry->watched) {
+		(void)epoll_watch(entry, false);
+	}
+
+	epoll_entry_unlink(ep, entry);
+
+	key = k_spin_lock(&ep->lock);
+	entry->obj = NULL;
+	k_spin_unlock(&ep->lock, key);
+}
+
+/* Watch the entry if the object supports it, poll it on every wait otherwise */
+static void epoll_entry_link(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	/* Only the input events are reported by the objects */
+	entry->watched = !(entry->events & ZVFS_EPOLLOUT) && epoll_watch(entry, true) == 0;
+
+	if (entry->watched) {
+		/* The object may have become ready before being watched */
+		epoll_ready_add(ep, entry);
+	} else {
+		sys_dlist_append(&ep->polled, &entry->node);
+		ep->polled_count++;
+	}
+}
+
+static struct zvfs_epoll_entry *epoll_entry_find(struct zvfs_epoll *ep, int fd)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].obj != NULL && ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int epoll_ctl_add(struct zvfs_epoll *ep, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_entry *entry = NULL;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+
+	obj = zvfs_get_fd_obj_and_vtable(fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	if (obj == ep) {
+		return -EINVAL;
+	}
+
+	if (epoll_entry_find(ep, fd) != NULL) {
+		return -EEXIST;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].obj == NULL) {
+			entry = &ep->entries[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_dnode_init(&entry->node);
+	entry->ep = ep;
+	entry->fd = fd;
+	entry->events = event->events;
+	entry->data = event->data;
+	entry->obj = obj;
+
+	epoll_entry_link(ep, entry);
+
+	/* Polled entries are waited for with one zvfs_poll_internal() call,
+	 * together with the event poll file descriptor itself.
+	 */
+	if (!entry->watched && ep->polled_count >= ZVFS_EPOLL_CHUNK) {
+		epoll_entry_free(ep, entry);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static int epoll_ctl_mod(struct zvfs_epoll *ep, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_entry *entry;
+	uint32_t events;
+
+	entry = epoll_entry_find(ep, fd);
+	if (entry == NULL) {
+		return -ENOENT;
+	}
+
+	if (entry->watched) {
+		(void)epoll_watch(entry, false);
+	}
+
+	epoll_entry_unlink(ep, entry);
+
+	events = entry->events;
+	entry->events = event->events;
+	entry->data = event->data;
+
+	epoll_entry_link(ep, entry);
+
+	if (!entry->watched && ep->polled_count >= ZVFS_EPOLL_CHUNK) {
+		/* Keep the previous events, they did fit */
+		epoll_entry_unlink(ep, entry);
+		entry->events = events;
+		epoll_entry_link(ep, entry);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+/* Check the readiness of a chunk of entries, store the events of the ready ones */
+static int epoll_check(struct zvfs_epoll *ep, struct zvfs_epoll_entry **chunk, int count,
+		       struct zvfs_epoll_event *events, int maxevents, int n)
+{
+	struct zvfs_pollfd fds[ZVFS_EPOLL_CHUNK];
+	int ret;
+
+	for (int i = 0; i < count; i++) {
+		fds[i].fd = chunk[i]->fd;
+		fds[i].events = chunk[i]->events & ZVFS_EPOLL_EVENTS;
+		fds[i].revents = 0;
+	}
+
+	ret = zvfs_poll_internal(fds, count, K_NO_WAIT);
+	if (ret < 0) {
+		ret = -errno;
+
+		/* Do not lose the events of the watched entries */
+		for (int i = 0; i < count; i++) {
+			if (chunk[i]->watched) {
+				epoll_ready_add(ep, chunk[i]);
+			}
+		}
+
+		return ret;
+	}
+
+	for (int i = 0; i < count; i++) {
+		struct zvfs_epoll_entry *entry = chunk[i];
+
+		if (fds[i].revents & ZVFS_POLLNVAL) {
+			/* Closed without being removed first */
+			epoll_entry_free(ep, entry);
+			continue;
+		}
+
+		if (fds[i].revents == 0) {
+			continue;
+		}
+
+		if (n < maxevents) {
+			events[n].events = fds[i].revents;
+			events[n].data = entry->data;
+			n++;
+		}
+
+		/* Level-triggered, check it again on the next wait */
+		if (entry->watched) {
+			epoll_ready_add(ep, entry);
+		}
+	}
+
+	return n;
+}
+
+static int epoll_collect(struct zvfs_epoll *ep, struct zvfs_epoll_event *events, int maxevents)
+{
+	struct zvfs_epoll_entry *chunk[ZVFS_EPOLL_CHUNK];
+	struct zvfs_epoll_entry *entry;
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	int count;
+	int n = 0;
+
+	/* Take the whole ready list, the entries that are still ready are
+	 * put back by epoll_check().
+	 */
+	sys_dlist_init(&pending);
+
+	key = k_spin_lock(&ep->lock);
+
+	while ((node = sys_dlist_get(&ep->ready)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	k_spin_unlock(&ep->lock, key);
+
+	do {
+		count = 0;
+
+		key = k_spin_lock(&ep->lock);
+
+		while (count < ZVFS_EPOLL_CHUNK && (node = sys_dlist_get(&pending)) != NULL) {
+			chunk[count++] = CONTAINER_OF(node, struct zvfs_epoll_entry, node);
+		}
+
+		k_spin_unlock(&ep->lock, key);
+
+		if (count > 0) {
+			n = epoll_check(ep, chunk, count, events, maxevents, n);
+			if (n < 0) {
+				return n;
+			}
+		}
+	} while (count > 0);
+
+	count = 0;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, entry, node) {
+		chunk[count++] = entry;
+	}
+
+	if (count > 0) {
+		n = epoll_check(ep, chunk, count, events, maxevents, n);
+	}
+
+	return n;
+}
+
+static int epoll_block(struct zvfs_epoll *ep, k_timeout_t timeout)
+{
+	struct zvfs_pollfd fds[ZVFS_EPOLL_CHUNK];
+	struct zvfs_epoll_entry *entry;
+	struct k_poll_event event;
+	int count = 0;
+	int ret;
+
+	if (ep->polled_count == 0) {
+		k_mutex_unlock(&ep->mutex);
+
+		k_poll_event_init(&event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &ep->signal);
+
+		ret = k_poll(&event, 1, timeout);
+		if (ret == -EAGAIN) {
+			ret = 0;
+		}
+
+		goto out;
+	}
+
+	/* Wait for the ready list together with the polled entries */
+	fds[count].fd = ep->fd;
+	fds[count].events = ZVFS_POLLIN;
+	count++;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->polled, entry, node) {
+		fds[count].fd = entry->fd;
+		fds[count].events = entry->events & ZVFS_EPOLL_EVENTS;
+		count++;
+	}
+
+	k_mutex_unlock(&ep->mutex);
+
+	ret = zvfs_poll_internal(fds, count, timeout);
+	if (ret < 0) {
+		ret = -errno;
+	}
+
+out:
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	return ret < 0 ? ret : 0;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].obj != NULL) {
+			epoll_entry_free(ep, &ep->entries[i]);
+		}
+	}
+
+	k_mutex_unlock(&ep->mutex);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	struct zvfs_epoll *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zvfs_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zvfs_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (!(pfd->events & ZVFS_POLLIN)) {
+			return 0;
+		}
+
+		if (*pev == pev_end) {
+			return -ENOMEM;
+		}
+
+		k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+				  &ep->signal);
+		(*pev)++;
+
+		return sys_dlist_is_empty(&ep->ready) ? 0 : -EALREADY;
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zvfs_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zvfs_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (!(pfd->events & ZVFS_POLLIN)) {
+			return 0;
+		}
+
+		if (!sys_dlist_is_empty(&ep->ready)) {
+			pfd->revents |= ZVFS_POLLIN;
+		}
+
+		(*pev)++;
+
+		return 0;
+	}
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	memset(ep->entries, 0, sizeof(ep->entries));
+	k_poll_signal_init(&ep->signal);
+	k_mutex_init(&ep->mutex);
+	sys_dlist_init(&ep->ready);
+	sys_dlist_init(&ep->polled);
+	ep->polled_count = 0;
+	ep->fd = fd;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_entry *entry;
+	struct zvfs_epoll *ep;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL && (event == NULL || (event->events & ~ZVFS_EPOLL_EVENTS))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		ret = epoll_ctl_add(ep, fd, event);
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		ret = epoll_ctl_mod(ep, fd, event);
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		entry = epoll_entry_find(ep, fd);
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_entry_free(ep, entry);
+		ret = 0;
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->mutex);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	(void)k_mutex_lock(&ep->mutex, K_FOREVER);
+
+	while (true) {
+		/* Reset before collecting, so that a notification arriving
+		 * in between is not lost.
+		 */
+		k_poll_signal_reset(&ep->signal);
+
+		ret = epoll_collect(ep, events, maxevents);
+		if (ret != 0) {
+			break;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			break;
+		}
+
+		ret = epoll_block(ep, sys_timepoint_timeout(end));
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(&ep->mutex);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return ret;
+}
+
+void zvfs_epoll_notify(struct zvfs_epoll_entry *entry)
+{
+	if (entry != NULL) {
+		epoll_ready_add(entry->ep, entry);
+	}
+}
+
+void zvfs_epoll_detach(struct zvfs_epoll_entry *entry)
+{
+	struct zvfs_epoll *ep;
+	k_spinlock_key_t key;
+
+	if (entry == NULL) {
+		return;
+	}
+
+	ep = entry->ep;
+
+	key = k_spin_lock(&ep->lock);
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+
+	entry->obj = NULL;
+
+	k_spin_unlock(&ep->lock, key);
+}
@@ -6,77 +6,548 @@
 
 #include <errno.h>
 #include <signal.h>
+#include <stdio.h>
 
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/posix/aio.h>
+#include <zephyr/posix/unistd.h>
+#include <zephyr/sys/util.h>
+
+/* prototypes for external, not-yet-public, functions in fdtable.c */
+ssize_t zvfs_read(int fd, void *buf, size_t sz, const size_t *from_offset);
+ssize_t zvfs_write(int fd, const void *buf, size_t sz, const size_t *from_offset);
+off_t zvfs_lseek(int fd, off_t offset, int whence);
+int zvfs_fsync(int fd);
+
+/* Operation of a request, after the lio_listio() ones */
+#define AIO_OP_FSYNC (LIO_NOP + 1)
+
+/* Completion notification shared by the operations of a lio_listio() call */
+struct aio_lio {
+	struct sigevent sigev;
+	int pending;
+	bool in_use;
+};
+
+struct aio_req {
+	struct k_work work;
+	struct aiocb *aiocbp;
+	struct aio_lio *lio;
+	struct sigevent sigev;
+	ssize_t ret;
+	/* EINPROGRESS until the operation completes */
+	int error;
+	int op;
+	bool in_use;
+};
+
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+static struct aio_lio aio_lios[CONFIG_POSIX_AIO_MAX];
+
+/* Protects the requests and the groups, aio_cond is broadcast on completions */
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_cond);
+
+/*
+ * The file descriptors only offer synchronous I/O: the operations are run by
+ * worker threads. The operations on a file descriptor always go to the same
+ * worker so that they are executed in submission order.
+ */
+static struct k_work_q aio_workq[CONFIG_POSIX_AIO_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(aio_workq_stack, CONFIG_POSIX_AIO_WORKERS,
+				   CONFIG_POSIX_AIO_WORKER_STACK_SIZE);
+
+static struct aio_req *aio_req_find(const struct aiocb *aiocbp)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (aio_reqs[i].in_use && aio_reqs[i].aiocbp == aiocbp) {
+			return &aio_reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct aio_req *aio_req_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		if (!aio_reqs[i].in_use) {
+			return &aio_reqs[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool aio_sigevent_is_valid(const struct sigevent *sigev)
+{
+	switch (sigev->sigev_notify) {
+	case SIGEV_NONE:
+	case SIGEV_SIGNAL:
+	case SIGEV_THREAD:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* Like for POSIX timers, signals are delivered by calling the notification function */
+static void aio_notify(const struct sigevent *sigev)
+{
+	if (sigev->sigev_notify == SIGEV_NONE || sigev->sigev_notify_function == NULL) {
+		return;
+	}
+
+	sigev->sigev_notify_function(sigev->sigev_value);
+}
+
+static ssize_t aio_rw(struct aiocb *aiocbp, bool is_write)
+{
+	int fd = aiocbp->aio_fildes;
+	void *buf = (void *)aiocbp->aio_buf;
+	size_t off = (size_t)aiocbp->aio_offset;
+	ssize_t ret;
+
+	/* Positioned access, as with pread() and pwrite() */
+	ret = is_write ? zvfs_write(fd, buf, aiocbp->aio_nbytes, &off)
+		       : zvfs_read(fd, buf, aiocbp->aio_nbytes, &off);
+	if (ret >= 0 || errno != ENOTSUP) {
+		return ret;
+	}
+
+	/* Seek files without positioned access. The offset is ignored when the
+	 * file descriptor isn't seekable, e.g. for a socket.
+	 */
+	(void)zvfs_lseek(fd, aiocbp->aio_offset, SEEK_SET);
+
+	return is_write ? zvfs_write(fd, buf, aiocbp->aio_nbytes, NULL)
+			: zvfs_read(fd, buf, aiocbp->aio_nbytes, NULL);
+}
+
+/* Completes a request with aio_lock held, returns the group to notify if any */
+static struct aio_lio *aio_req_complete_locked(struct aio_req *req, ssize_t ret, int error)
+{
+	struct aio_lio *lio = req->lio;
+
+	req->ret = ret;
+	req->error = error;
+	req->lio = NULL;
+	k_condvar_broadcast(&aio_cond);
+
+	if (lio == NULL || --lio->pending > 0) {
+		return NULL;
+	}
+
+	lio->in_use = false;
+
+	return lio;
+}
+
+static void aio_req_complete(struct aio_req *req, ssize_t ret, int error)
+{
+	struct sigevent sigev = req->sigev;
+	struct sigevent lio_sigev;
+	struct aio_lio *lio;
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	lio = aio_req_complete_locked(req, ret, error);
+	if (lio != NULL) {
+		lio_sigev = lio->sigev;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	aio_notify(&sigev);
+	if (lio != NULL) {
+		aio_notify(&lio_sigev);
+	}
+}
+
+static void aio_work_handler(struct k_work *work)
+{
+	struct aio_req *req = CONTAINER_OF(work, struct aio_req, work);
+	ssize_t ret;
+
+	switch (req->op) {
+	case LIO_READ:
+		ret = aio_rw(req->aiocbp, false);
+		break;
+	case LIO_WRITE:
+		ret = aio_rw(req->aiocbp, true);
+		break;
+	default:
+		ret = zvfs_fsync(req->aiocbp->aio_fildes);
+		break;
+	}
+
+	aio_req_complete(req, ret, ret < 0 ? errno : 0);
+}
+
+/* Queues an operation with aio_lock held, returns an errno value on failure */
+static int aio_submit_locked(struct aiocb *aiocbp, int op, struct aio_lio *lio)
+{
+	struct aio_req *req;
+
+	if (aiocbp->aio_fildes < 0) {
+		return EBADF;
+	}
+
+	if ((op == LIO_READ || op == LIO_WRITE) && aiocbp->aio_offset < 0) {
+		return EINVAL;
+	}
+
+	if (aiocbp->aio_reqprio < 0 || aiocbp->aio_reqprio > AIO_PRIO_DELTA_MAX ||
+	    !aio_sigevent_is_valid(&aiocbp->aio_sigevent)) {
+		return EINVAL;
+	}
+
+	req = aio_req_find(aiocbp);
+	if (req != NULL && req->error == EINPROGRESS) {
+		/* The control block is still in use */
+		return EINVAL;
+	}
+
+	/* A completed request whose status was never retrieved is recycled */
+	if (req == NULL) {
+		req = aio_req_alloc();
+	}
+
+	if (req == NULL) {
+		return EAGAIN;
+	}
+
+	req->in_use = true;
+	req->aiocbp = aiocbp;
+	req->lio = lio;
+	req->sigev = aiocbp->aio_sigevent;
+	req->op = op;
+	req->ret = -1;
+	req->error = EINPROGRESS;
+	k_work_init(&req->work, aio_work_handler);
+
+	(void)k_work_submit_to_queue(&aio_workq[aiocbp->aio_fildes % ARRAY_SIZE(aio_workq)],
+				     &req->work);
+
+	return 0;
+}
+
+static int aio_submit(struct aiocb *aiocbp, int op)
+{
+	int err;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	err = aio_submit_locked(aiocbp, op, NULL);
+	k_mutex_unlock(&aio_lock);
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return 0;
+}
 
 int aio_cancel(int fildes, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	/* Notifications of the canceled operations and of their lio_listio() calls */
+	struct sigevent notify[2 * CONFIG_POSIX_AIO_MAX];
+	size_t num_notify = 0;
+	struct aio_lio *lio;
+	bool not_canceled = false;
+	bool found = false;
+
+	if (aiocbp != NULL && aiocbp->aio_fildes != fildes) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_reqs); i++) {
+		struct aio_req *req = &aio_reqs[i];
+
+		if (!req->in_use || req->error != EINPROGRESS ||
+		    req->aiocbp->aio_fildes != fildes ||
+		    (aiocbp != NULL && req->aiocbp != aiocbp)) {
+			continue;
+		}
+
+		found = true;
+
+		/* Only operations still queued can be canceled */
+		if (k_work_cancel(&req->work) != 0) {
+			not_canceled = true;
+			continue;
+		}
+
+		lio = aio_req_complete_locked(req, -1, ECANCELED);
+		notify[num_notify++] = req->sigev;
+		if (lio != NULL) {
+			notify[num_notify++] = lio->sigev;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	for (size_t i = 0; i < num_notify; i++) {
+		aio_notify(&notify[i]);
+	}
 
-	errno = ENOSYS;
-	return -1;
+	if (!found) {
+		return AIO_ALLDONE;
+	}
+
+	return not_canceled ? AIO_NOTCANCELED : AIO_CANCELED;
 }
 
 int aio_error(const struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	struct aio_req *req;
+	int ret;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_req_find(aiocbp);
+	ret = req == NULL ? -1 : req->error;
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = EINVAL;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return ret;
 }
 
-int aio_fsync(int fildes, struct aiocb *aiocbp)
+int aio_fsync(int op, struct aiocb *aiocbp)
 {
-	ARG_UNUSED(fildes);
-	ARG_UNUSED(aiocbp);
+	/* Synchronized I/O data and file integrity completions are the same */
+	ARG_UNUSED(op);
 
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, AIO_OP_FSYNC);
 }
 
 int aio_read(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, LIO_READ);
 }
 
 ssize_t aio_return(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
+	struct aio_req *req;
+	ssize_t ret = -1;
+	int err = EINVAL;
+
+	if (aiocbp == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_req_find(aiocbp);
+	if (req != NULL && req->error != EINPROGRESS) {
+		/* The status is retrieved once, the request is released */
+		ret = req->ret;
+		err = req->error;
+		req->in_use = false;
+		req->aiocbp = NULL;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = err;
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return ret;
 }
 
 int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
 {
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(timeout);
+	k_timeout_t wait = K_FOREVER;
+	k_timepoint_t end;
+	int ret = -1;
+
+	if (nent <= 0 || nent > AIO_LISTIO_MAX) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout != NULL) {
+		if (timeout->tv_sec < 0 || timeout->tv_nsec < 0 ||
+		    timeout->tv_nsec >= NSEC_PER_SEC) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		wait = K_MSEC(timeout->tv_sec * MSEC_PER_SEC +
+			      DIV_ROUND_UP(timeout->tv_nsec, NSEC_PER_MSEC));
+	}
+
+	end = sys_timepoint_calc(wait);
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	while (ret != 0) {
+		for (int i = 0; i < nent; i++) {
+			struct aio_req *req;
+
+			if (list[i] == NULL) {
+				continue;
+			}
 
-	errno = ENOSYS;
-	return -1;
+			req = aio_req_find(list[i]);
+			if (req == NULL || req->error != EINPROGRESS) {
+				ret = 0;
+				break;
+			}
+		}
+
+		if (ret != 0 &&
+		    k_condvar_wait(&aio_cond, &aio_lock, sys_timepoint_timeout(end)) != 0) {
+			break;
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret != 0) {
+		errno = EAGAIN;
+	}
+
+	return ret;
 }
 
 int aio_write(struct aiocb *aiocbp)
 {
-	ARG_UNUSED(aiocbp);
-
-	errno = ENOSYS;
-	return -1;
+	return aio_submit(aiocbp, LIO_WRITE);
 }
 
 int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
 	       struct sigevent *ZRESTRICT sig)
 {
-	ARG_UNUSED(mode);
-	ARG_UNUSED(list);
-	ARG_UNUSED(nent);
-	ARG_UNUSED(sig);
+	struct aio_lio *lio = NULL;
+	struct sigevent lio_sigev;
+	bool failed = false;
+	int err;
+
+	if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || nent <= 0 || nent > AIO_LISTIO_MAX ||
+	    (sig != NULL && !aio_sigevent_is_valid(sig))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&aio_lock, K_FOREVER);
+
+	if (mode == LIO_NOWAIT && sig != NULL && sig->sigev_notify != SIGEV_NONE) {
+		for (size_t i = 0; i < ARRAY_SIZE(aio_lios); i++) {
+			if (!aio_lios[i].in_use) {
+				lio = &aio_lios[i];
+				break;
+			}
+		}
+
+		if (lio == NULL) {
+			k_mutex_unlock(&aio_lock);
+			errno = EAGAIN;
+			return -1;
+		}
+
+		lio->in_use = true;
+		lio->sigev = *sig;
+		/* Held until all the operations are queued */
+		lio->pending = 1;
+	}
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] == NULL || list[i]->aio_lio_opcode == LIO_NOP) {
+			continue;
+		}
+
+		if (list[i]->aio_lio_opcode != LIO_READ && list[i]->aio_lio_opcode != LIO_WRITE) {
+			err = EINVAL;
+		} else {
+			err = aio_submit_locked(list[i], list[i]->aio_lio_opcode, lio);
+		}
+
+		if (err != 0) {
+			/* Reported by aio_error() unless the control block is in use */
+			struct aio_req *req = aio_req_find(list[i]);
+
+			if (req != NULL && req->error != EINPROGRESS) {
+				req->ret = -1;
+				req->error = err;
+			}
+
+			failed = true;
+			continue;
+		}
+
+		if (lio != NULL) {
+			lio->pending++;
+		}
+	}
+
+	if (mode == LIO_WAIT) {
+		for (int i = 0; i < nent; i++) {
+			struct aio_req *req;
+
+			if (list[i] == NULL || list[i]->aio_lio_opcode == LIO_NOP) {
+				continue;
+			}
+
+			req = aio_req_find(list[i]);
+			while (req != NULL && req->error == EINPROGRESS) {
+				(void)k_condvar_wait(&aio_cond, &aio_lock, K_FOREVER);
+			}
+
+			if (req == NULL || req->error != 0) {
+				failed = true;
+			}
+		}
+	}
+
+	if (lio != NULL && --lio->pending == 0) {
+		/* Every operation already completed or failed */
+		lio_sigev = lio->sigev;
+		lio->in_use = false;
+	} else {
+		lio = NULL;
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (lio != NULL) {
+		aio_notify(&lio_sigev);
+	}
+
+	if (failed) {
+		errno = mode == LIO_WAIT ? EIO : EAGAIN;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int aio_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "aio_workq",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(aio_workq); i++) {
+		k_work_queue_start(&aio_workq[i], aio_workq_stack[i],
+				   K_THREAD_STACK_SIZEOF(aio_workq_stack[i]),
+				   CONFIG_POSIX_AIO_WORKER_PRIORITY, &cfg);
+	}
 
-	errno = ENOSYS;
-	return -1;
+	return 0;
 }
+SYS_INIT(aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
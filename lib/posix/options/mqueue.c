@@ -13,11 +13,37 @@
 
 #define SIGEV_MASK (SIGEV_NONE | SIGEV_SIGNAL | SIGEV_THREAD)
 
+#define PRIO_WORDS DIV_ROUND_UP(CONFIG_POSIX_MQ_PRIO_MAX, 32)
+
+/* Message slot, followed by msg_size bytes of data */
+struct mq_msg {
+	sys_snode_t node;
+	uint32_t len;
+	uint32_t prio;
+	char data[];
+};
+
+/*
+ * Messages are kept in one FIFO per priority. A bitmap of the non-empty
+ * FIFOs gives the highest priority message in constant time. Free slots
+ * are kept in a list, and two semaphores count the queued messages and
+ * the free slots for the blocking calls.
+ */
 typedef struct mqueue_object {
 	sys_snode_t snode;
 	char *mem_buffer;
 	char *mem_obj;
-	struct k_msgq queue;
+	struct k_spinlock lock;
+	sys_slist_t free_msgs;
+	sys_slist_t prio_msgs[CONFIG_POSIX_MQ_PRIO_MAX];
+	uint32_t prio_bitmap[PRIO_WORDS];
+	struct k_sem used_sem;
+	struct k_sem free_sem;
+	size_t msg_size;
+	size_t slot_size;
+	long max_msgs;
+	long used_msgs;
+	atomic_t waiting;
 	atomic_t ref_count;
 	char *name;
 	struct sigevent not;
@@ -37,9 +63,11 @@ sys_slist_t mq_list = SYS_SLIST_STATIC_INIT(&mq_list);
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 static mqueue_object *find_in_list(const char *name);
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout);
+			    unsigned int msg_prio, k_timeout_t timeout);
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			   k_timeout_t timeout);
+			       unsigned int *msg_prio, k_timeout_t timeout);
+static struct mq_msg *take_message(mqueue_desc *mqd, k_timeout_t timeout);
+static void free_message(mqueue_object *msg_queue, struct mq_msg *msg);
 static void remove_notification(mqueue_object *msg_queue);
 static void remove_mq(mqueue_object *msg_queue);
 static void *mq_notify_thread(void *arg);
@@ -143,19 +171,25 @@ mqd_t mq_open(const char *name, int oflags, ...)
 
 		strcpy(msg_queue->name, name);
 
-		mq_buf_ptr = k_malloc(msg_size * max_msgs * sizeof(uint8_t));
+		msg_queue->slot_size = ROUND_UP(sizeof(struct mq_msg) + msg_size,
+						sizeof(void *));
+		mq_buf_ptr = k_malloc(msg_queue->slot_size * max_msgs);
 		if (mq_buf_ptr != NULL) {
-			(void)memset(mq_buf_ptr, 0,
-				     msg_size * max_msgs * sizeof(uint8_t));
+			(void)memset(mq_buf_ptr, 0, msg_queue->slot_size * max_msgs);
 			msg_queue->mem_buffer = mq_buf_ptr;
 		} else {
 			goto free_mq_buffer;
 		}
 
 		(void)atomic_set(&msg_queue->ref_count, 1);
-		/* initialize zephyr message queue */
-		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
-			    max_msgs);
+		msg_queue->msg_size = msg_size;
+		msg_queue->max_msgs = max_msgs;
+		for (long i = 0; i < max_msgs; i++) {
+			sys_slist_append(&msg_queue->free_msgs,
+					 (sys_snode_t *)(mq_buf_ptr + i * msg_queue->slot_size));
+		}
+		k_sem_init(&msg_queue->used_sem, 0, max_msgs);
+		k_sem_init(&msg_queue->free_sem, max_msgs, max_msgs);
 		k_sem_take(&mq_sem, K_FOREVER);
 		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
@@ -232,7 +266,8 @@ int mq_unlink(const char *name)
 /**
  * @brief Send a message to a message queue.
  *
- * All messages in message queue are of equal priority.
+ * Messages are received in decreasing priority order, and in sending
+ * order within a priority.
  *
  * See IEEE 1003.1
  */
@@ -241,13 +276,14 @@ int mq_send(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return send_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return send_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
  * @brief Send message to a message queue within abstime time.
  *
- * All messages in message queue are of equal priority.
+ * Messages are received in decreasing priority order, and in sending
+ * order within a priority.
  *
  * See IEEE 1003.1
  */
@@ -257,13 +293,13 @@ int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 	int32_t timeout = (int32_t) timespec_to_timeoutms(abstime);
 
-	return send_message(mqd, msg_ptr, msg_len, K_MSEC(timeout));
+	return send_message(mqd, msg_ptr, msg_len, msg_prio, K_MSEC(timeout));
 }
 
 /**
  * @brief Receive a message from a message queue.
  *
- * All messages in message queue are of equal priority.
+ * Receives the oldest of the highest priority messages.
  *
  * See IEEE 1003.1
  */
@@ -272,13 +308,13 @@ int mq_receive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return receive_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
  * @brief Receive message from a message queue within abstime time.
  *
- * All messages in message queue are of equal priority.
+ * Receives the oldest of the highest priority messages.
  *
  * See IEEE 1003.1
  */
@@ -288,7 +324,78 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 	int32_t timeout = (int32_t) timespec_to_timeoutms(abstime);
 
-	return receive_message(mqd, msg_ptr, msg_len, K_MSEC(timeout));
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio, K_MSEC(timeout));
+}
+
+/**
+ * @brief Receive a message from a message queue without copying it.
+ *
+ * Zephyr extension.
+ */
+int mq_borrow_np(mqd_t mqdes, const char **msg_ptr, unsigned int *msg_prio,
+		 const struct timespec *abstime)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	k_timeout_t timeout = K_FOREVER;
+	struct mq_msg *msg;
+
+	if (msg_ptr == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (abstime != NULL) {
+		timeout = K_MSEC((int32_t)timespec_to_timeoutms(abstime));
+	}
+
+	msg = take_message(mqd, timeout);
+	if (msg == NULL) {
+		return -1;
+	}
+
+	if (msg_prio != NULL) {
+		*msg_prio = msg->prio;
+	}
+
+	*msg_ptr = msg->data;
+
+	return msg->len;
+}
+
+/**
+ * @brief Give back a message obtained with mq_borrow_np().
+ *
+ * Zephyr extension.
+ */
+int mq_release_np(mqd_t mqdes, const char *msg_ptr)
+{
+	mqueue_desc *mqd = (mqueue_desc *)mqdes;
+	mqueue_object *msg_queue;
+	size_t offset;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (msg_ptr == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	msg_queue = mqd->mqueue;
+	offset = (uintptr_t)msg_ptr - offsetof(struct mq_msg, data) -
+		 (uintptr_t)msg_queue->mem_buffer;
+
+	if ((offset >= msg_queue->slot_size * msg_queue->max_msgs) ||
+	    ((offset % msg_queue->slot_size) != 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	free_message(msg_queue, (struct mq_msg *)(msg_queue->mem_buffer + offset));
+
+	return 0;
 }
 
 /**
@@ -299,19 +406,23 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
-	struct k_msgq_attrs attrs;
+	mqueue_object *msg_queue;
+	k_spinlock_key_t key;
 
 	if (mqd == NULL) {
 		errno = EBADF;
 		return -1;
 	}
 
+	msg_queue = mqd->mqueue;
+
 	k_sem_take(&mq_sem, K_FOREVER);
-	k_msgq_get_attrs(&mqd->mqueue->queue, &attrs);
 	mqstat->mq_flags = mqd->flags;
-	mqstat->mq_maxmsg = attrs.max_msgs;
-	mqstat->mq_msgsize = attrs.msg_size;
-	mqstat->mq_curmsgs = attrs.used_msgs;
+	mqstat->mq_maxmsg = msg_queue->max_msgs;
+	mqstat->mq_msgsize = msg_queue->msg_size;
+	key = k_spin_lock(&msg_queue->lock);
+	mqstat->mq_curmsgs = msg_queue->used_msgs;
+	k_spin_unlock(&msg_queue->lock, key);
 	k_sem_give(&mq_sem);
 	return 0;
 }
@@ -435,74 +546,167 @@ static mqueue_object *find_in_list(const char *name)
 }
 
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout)
+			    unsigned int msg_prio, k_timeout_t timeout)
 {
 	int32_t ret = -1;
+	mqueue_object *msg_queue;
+	struct mq_msg *msg;
+	k_spinlock_key_t key;
+	bool was_empty;
 
 	if (mqd == NULL) {
 		errno = EBADF;
 		return ret;
 	}
 
+	msg_queue = mqd->mqueue;
+
 	if ((mqd->flags & O_NONBLOCK) != 0U) {
 		timeout = K_NO_WAIT;
 	}
 
-	if (msg_len >  mqd->mqueue->queue.msg_size) {
+	if (msg_len > msg_queue->msg_size) {
 		errno = EMSGSIZE;
 		return ret;
 	}
 
-	uint32_t msgq_num = k_msgq_num_used_get(&mqd->mqueue->queue);
+	if (msg_prio >= CONFIG_POSIX_MQ_PRIO_MAX) {
+		errno = EINVAL;
+		return ret;
+	}
 
-	if (k_msgq_put(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
+	if (k_sem_take(&msg_queue->free_sem, timeout) != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
 		return ret;
 	}
 
-	if (k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
-		struct sigevent *sevp = &mqd->mqueue->not;
+	key = k_spin_lock(&msg_queue->lock);
+	msg = (struct mq_msg *)sys_slist_get_not_empty(&msg_queue->free_msgs);
+	k_spin_unlock(&msg_queue->lock, key);
+
+	/* The slot is ours, copy outside of the lock */
+	memcpy(msg->data, msg_ptr, msg_len);
+	msg->len = msg_len;
+	msg->prio = msg_prio;
+
+	key = k_spin_lock(&msg_queue->lock);
+	sys_slist_append(&msg_queue->prio_msgs[msg_prio], &msg->node);
+	msg_queue->prio_bitmap[msg_prio / 32] |= BIT(msg_prio % 32);
+	was_empty = (msg_queue->used_msgs++ == 0);
+	k_spin_unlock(&msg_queue->lock, key);
+
+	k_sem_give(&msg_queue->used_sem);
+
+	/* Notify arrivals on an empty queue that no receiver waits for */
+	if (was_empty && atomic_get(&msg_queue->waiting) == 0) {
+		struct sigevent *sevp = &msg_queue->not;
 
 		if (sevp->sigev_notify == SIGEV_NONE) {
-			sevp->sigev_notify_function(sevp->sigev_value);
+			if (sevp->sigev_notify_function != NULL) {
+				sevp->sigev_notify_function(sevp->sigev_value);
+			}
 		} else if (sevp->sigev_notify == SIGEV_THREAD) {
 			pthread_t th;
 
 			ret = pthread_create(&th,
 					     sevp->sigev_notify_attributes,
 					     mq_notify_thread,
-					     mqd->mqueue);
+					     msg_queue);
 		}
 	}
 
 	return 0;
 }
 
-static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			     k_timeout_t timeout)
+static struct mq_msg *take_message(mqueue_desc *mqd, k_timeout_t timeout)
 {
-	int ret = -1;
+	mqueue_object *msg_queue;
+	struct mq_msg *msg;
+	k_spinlock_key_t key;
+	unsigned int prio = 0;
+	int rc;
 
 	if (mqd == NULL) {
 		errno = EBADF;
-		return ret;
+		return NULL;
 	}
 
-	if (msg_len < mqd->mqueue->queue.msg_size) {
-		errno = EMSGSIZE;
-		return ret;
-	}
+	msg_queue = mqd->mqueue;
 
 	if ((mqd->flags & O_NONBLOCK) != 0U) {
 		timeout = K_NO_WAIT;
 	}
 
-	if (k_msgq_get(&mqd->mqueue->queue, (void *)msg_ptr, timeout) != 0) {
+	atomic_inc(&msg_queue->waiting);
+	rc = k_sem_take(&msg_queue->used_sem, timeout);
+	atomic_dec(&msg_queue->waiting);
+
+	if (rc != 0) {
 		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
-	} else {
-		ret = mqd->mqueue->queue.msg_size;
+		return NULL;
+	}
+
+	key = k_spin_lock(&msg_queue->lock);
+
+	for (int i = PRIO_WORDS - 1; ; i--) {
+		__ASSERT_NO_MSG(i >= 0);
+		if (msg_queue->prio_bitmap[i] != 0U) {
+			prio = i * 32 + find_msb_set(msg_queue->prio_bitmap[i]) - 1;
+			break;
+		}
+	}
+
+	msg = (struct mq_msg *)sys_slist_get_not_empty(&msg_queue->prio_msgs[prio]);
+	if (sys_slist_is_empty(&msg_queue->prio_msgs[prio])) {
+		msg_queue->prio_bitmap[prio / 32] &= ~BIT(prio % 32);
+	}
+	msg_queue->used_msgs--;
+
+	k_spin_unlock(&msg_queue->lock, key);
+
+	return msg;
+}
+
+static void free_message(mqueue_object *msg_queue, struct mq_msg *msg)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&msg_queue->lock);
+	sys_slist_prepend(&msg_queue->free_msgs, &msg->node);
+	k_spin_unlock(&msg_queue->lock, key);
+
+	k_sem_give(&msg_queue->free_sem);
+}
+
+static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
+			       unsigned int *msg_prio, k_timeout_t timeout)
+{
+	struct mq_msg *msg;
+	int32_t ret;
+
+	if (mqd == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (msg_len < mqd->mqueue->msg_size) {
+		errno = EMSGSIZE;
+		return -1;
 	}
 
+	msg = take_message(mqd, timeout);
+	if (msg == NULL) {
+		return -1;
+	}
+
+	memcpy(msg_ptr, msg->data, msg->len);
+	ret = msg->len;
+	if (msg_prio != NULL) {
+		*msg_prio = msg->prio;
+	}
+
+	free_message(mqd->mqueue, msg);
+
 	return ret;
 }
 
@@ -13,13 +13,8 @@
 #include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/sem.h>
 
-#define CONCURRENT_READER_LIMIT  (CONFIG_POSIX_THREAD_THREADS_MAX + 1)
-
 struct posix_rwlock {
-	struct sys_sem rd_sem;
-	struct sys_sem wr_sem;
-	struct sys_sem reader_active; /* blocks WR till reader has acquired lock */
-	k_tid_t wr_owner;
+	struct k_rwlock rwlock;
 };
 
 struct posix_rwlockattr {
@@ -28,8 +23,6 @@ struct posix_rwlockattr {
 };
 
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
 
 LOG_MODULE_REGISTER(pthread_rwlock, CONFIG_PTHREAD_RWLOCK_LOG_LEVEL);
 
@@ -124,10 +117,7 @@ int pthread_rwlock_init(pthread_rwlock_t *rwlock,
 		return ENOMEM;
 	}
 
-	sys_sem_init(&rwl->rd_sem, CONCURRENT_READER_LIMIT, CONCURRENT_READER_LIMIT);
-	sys_sem_init(&rwl->wr_sem, 1, 1);
-	sys_sem_init(&rwl->reader_active, 1, 1);
-	rwl->wr_owner = NULL;
+	k_rwlock_init(&rwl->rwlock);
 
 	LOG_DBG("Initialized rwlock %p", rwl);
 
@@ -153,7 +143,7 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 			SYS_SEM_LOCK_BREAK;
 		}
 
-		if (rwl->wr_owner != NULL) {
+		if ((rwl->rwlock.writer != NULL) || (rwl->rwlock.readers != 0U)) {
 			ret = EBUSY;
 			SYS_SEM_LOCK_BREAK;
 		}
@@ -167,16 +157,29 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 	return ret;
 }
 
-/**
- * @brief Lock a read-write lock object for reading.
- *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
- * See IEEE 1003.1
- */
-int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
+static int read_lock_acquire(pthread_rwlock_t *rwlock, k_timeout_t timeout)
+{
+	int ret;
+	struct posix_rwlock *rwl;
+
+	rwl = get_posix_rwlock(*rwlock);
+	if (rwl == NULL) {
+		return EINVAL;
+	}
+
+	ret = k_rwlock_read_lock(&rwl->rwlock, timeout);
+	if (ret == -EBUSY) {
+		return EBUSY;
+	} else if (ret == -EAGAIN) {
+		return ETIMEDOUT;
+	}
+
+	return 0;
+}
+
+static int write_lock_acquire(pthread_rwlock_t *rwlock, k_timeout_t timeout)
 {
+	int ret;
 	struct posix_rwlock *rwl;
 
 	rwl = get_posix_rwlock(*rwlock);
@@ -184,14 +187,34 @@ int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	return read_lock_acquire(rwl, SYS_FOREVER_MS);
+	ret = k_rwlock_write_lock(&rwl->rwlock, timeout);
+	if (ret == -EBUSY) {
+		return EBUSY;
+	} else if (ret == -EAGAIN) {
+		return ETIMEDOUT;
+	} else if (ret == -EDEADLK) {
+		return EDEADLK;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Lock a read-write lock object for reading.
+ *
+ * Readers wait while a writer holds or waits for the lock.
+ *
+ * See IEEE 1003.1
+ */
+int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
+{
+	return read_lock_acquire(rwlock, K_FOREVER);
 }
 
 /**
  * @brief Lock a read-write lock object for reading within specific time.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Readers wait while a writer holds or waits for the lock.
  *
  * See IEEE 1003.1
  */
@@ -199,8 +222,6 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
-	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
 		return EINVAL;
@@ -208,63 +229,39 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 
 	timeout = (int32_t) timespec_to_timeoutms(abstime);
 
-	rwl = get_posix_rwlock(*rwlock);
-	if (rwl == NULL) {
-		return EINVAL;
-	}
-
-	if (read_lock_acquire(rwl, timeout) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return read_lock_acquire(rwlock, SYS_TIMEOUT_MS(timeout));
 }
 
 /**
  * @brief Lock a read-write lock object for reading immediately.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * Fails while a writer holds or waits for the lock.
  *
  * See IEEE 1003.1
  */
 int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
 {
-	struct posix_rwlock *rwl;
-
-	rwl = get_posix_rwlock(*rwlock);
-	if (rwl == NULL) {
-		return EINVAL;
-	}
-
-	return read_lock_acquire(rwl, 0);
+	return read_lock_acquire(rwlock, K_NO_WAIT);
 }
 
 /**
  * @brief Lock a read-write lock object for writing.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Waiting writers have priority over readers arriving after them, and
+ * the writer holding the lock inherits the priority of its waiters.
  *
  * See IEEE 1003.1
  */
 int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
 {
-	struct posix_rwlock *rwl;
-
-	rwl = get_posix_rwlock(*rwlock);
-	if (rwl == NULL) {
-		return EINVAL;
-	}
-
-	return write_lock_acquire(rwl, SYS_FOREVER_MS);
+	return write_lock_acquire(rwlock, K_FOREVER);
 }
 
 /**
  * @brief Lock a read-write lock object for writing within specific time.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Waiting writers have priority over readers arriving after them, and
+ * the writer holding the lock inherits the priority of its waiters.
  *
  * See IEEE 1003.1
  */
@@ -272,8 +269,6 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
-	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
 		return EINVAL;
@@ -281,36 +276,17 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 
 	timeout = (int32_t) timespec_to_timeoutms(abstime);
 
-	rwl = get_posix_rwlock(*rwlock);
-	if (rwl == NULL) {
-		return EINVAL;
-	}
-
-	if (write_lock_acquire(rwl, timeout) != 0U) {
-		ret = ETIMEDOUT;
-	}
-
-	return ret;
+	return write_lock_acquire(rwlock, SYS_TIMEOUT_MS(timeout));
 }
 
 /**
  * @brief Lock a read-write lock object for writing immediately.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
 {
-	struct posix_rwlock *rwl;
-
-	rwl = get_posix_rwlock(*rwlock);
-	if (rwl == NULL) {
-		return EINVAL;
-	}
-
-	return write_lock_acquire(rwl, 0);
+	return write_lock_acquire(rwlock, K_NO_WAIT);
 }
 
 /**
@@ -321,6 +297,7 @@ int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
  */
 int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 {
+	int ret;
 	struct posix_rwlock *rwl;
 
 	rwl = get_posix_rwlock(*rwlock);
@@ -328,69 +305,14 @@ int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	if (k_current_get() == rwl->wr_owner) {
-		/* Write unlock */
-		rwl->wr_owner = NULL;
-		sys_sem_give(&rwl->reader_active);
-		sys_sem_give(&rwl->wr_sem);
-	} else {
-		/* Read unlock */
-		sys_sem_give(&rwl->rd_sem);
-
-		if (sys_sem_count_get(&rwl->rd_sem) == CONCURRENT_READER_LIMIT) {
-			/* Last read lock, unlock writer */
-			sys_sem_give(&rwl->reader_active);
-		}
-	}
-	return 0;
-}
-
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
-{
-	uint32_t ret = 0U;
-
-	if (sys_sem_take(&rwl->wr_sem, SYS_TIMEOUT_MS(timeout)) == 0) {
-		sys_sem_take(&rwl->reader_active, K_NO_WAIT);
-		sys_sem_take(&rwl->rd_sem, K_NO_WAIT);
-		sys_sem_give(&rwl->wr_sem);
-	} else {
-		ret = EBUSY;
+	ret = k_rwlock_unlock(&rwl->rwlock);
+	if (ret == -EPERM) {
+		return EPERM;
+	} else if (ret == -EINVAL) {
+		return EINVAL;
 	}
 
-	return ret;
-}
-
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
-{
-	uint32_t ret = 0U;
-	int64_t elapsed_time, st_time = k_uptime_get();
-	k_timeout_t k_timeout;
-
-	k_timeout = SYS_TIMEOUT_MS(timeout);
-
-	/* waiting for release of write lock */
-	if (sys_sem_take(&rwl->wr_sem, k_timeout) == 0) {
-		/* update remaining timeout time for 2nd sem */
-		if (timeout != SYS_FOREVER_MS) {
-			elapsed_time = k_uptime_get() - st_time;
-			timeout = timeout <= elapsed_time ? 0 :
-				  timeout - elapsed_time;
-		}
-
-		k_timeout = SYS_TIMEOUT_MS(timeout);
-
-		/* waiting for reader to complete operation */
-		if (sys_sem_take(&rwl->reader_active, k_timeout) == 0) {
-			rwl->wr_owner = k_current_get();
-		} else {
-			sys_sem_give(&rwl->wr_sem);
-			ret = EBUSY;
-		}
-
-	} else {
-		ret = EBUSY;
-	}
-	return ret;
+	return 0;
 }
 
 int pthread_rwlockattr_getpshared(const pthread_rwlockattr_t *ZRESTRICT attr,
@@ -78,6 +78,60 @@ static const struct smf_state *get_lca_of(const struct smf_state *source,
 	return NULL;
 }
 
+#ifdef CONFIG_SMF_STATE_TABLES
+/**
+ * @brief Find the deepest state that two states from tables are or descend from
+ *
+ * Ancestors being listed from the topmost one, this is the last entry that
+ * both paths share. Transitions to self, to an ancestor or to a descendant
+ * find it at the first comparison and transitions between siblings at the
+ * second one.
+ *
+ * @param source transition source
+ * @param dest transition destination
+ * @return common state, or NULL if states have no common ancestor.
+ */
+static const struct smf_state *get_common_of(const struct smf_state *source,
+					     const struct smf_state *dest)
+{
+	int depth = MIN(source->depth, dest->depth);
+
+	while (depth >= 0 && source->path[depth] != dest->path[depth]) {
+		depth--;
+	}
+
+	return (depth >= 0) ? dest->path[depth] : NULL;
+}
+#endif /* CONFIG_SMF_STATE_TABLES */
+
+/**
+ * @brief Find the state a transition exits to and enters from
+ *
+ * @param source transition source
+ * @param dest transition destination
+ * @return topmost state, whose entry and exit actions are not executed
+ */
+static const struct smf_state *get_topmost_of(const struct smf_state *source,
+					      const struct smf_state *dest)
+{
+#ifdef CONFIG_SMF_STATE_TABLES
+	if (source->path != NULL && dest->path != NULL) {
+		return get_common_of(source, dest);
+	}
+#endif
+
+	if (share_paren(source, dest)) {
+		/* new state is a parent of where we are now*/
+		return dest;
+	} else if (share_paren(dest, source)) {
+		/* we are a parent of the new state */
+		return source;
+	}
+
+	/* not directly related, find LCA */
+	return get_lca_of(source, dest);
+}
+
 /**
  * @brief Executes all entry actions from the direct child of topmost to the new state
  *
@@ -97,6 +151,29 @@ static bool smf_execute_all_entry_actions(struct smf_ctx *const ctx,
 		return false;
 	}
 
+#ifdef CONFIG_SMF_STATE_TABLES
+	if (new_state->path != NULL) {
+		/* Execute every entry action EXCEPT that of the topmost state */
+		for (int depth = (topmost != NULL) ? topmost->depth + 1 : 0;
+		     depth <= new_state->depth; depth++) {
+			/* Keep track of the executing entry action in case it calls
+			 * smf_set_state()
+			 */
+			ctx->executing = new_state->path[depth];
+			if (ctx->executing->entry) {
+				ctx->executing->entry(ctx);
+
+				/* No need to continue if terminate was set */
+				if (internal->terminate) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+#endif
+
 	for (const struct smf_state *to_execute = get_child_of(new_state, topmost);
 	     to_execute != NULL && to_execute != new_state;
 	     to_execute = get_child_of(new_state, to_execute)) {
@@ -278,18 +355,7 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 	}
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
-	const struct smf_state *topmost;
-
-	if (share_paren(ctx->executing, new_state)) {
-		/* new state is a parent of where we are now*/
-		topmost = new_state;
-	} else if (share_paren(new_state, ctx->executing)) {
-		/* we are a parent of the new state */
-		topmost = ctx->executing;
-	} else {
-		/* not directly related, find LCA */
-		topmost = get_lca_of(ctx->executing, new_state);
-	}
+	const struct smf_state *topmost = get_topmost_of(ctx->executing, new_state);
 
 	internal->is_exit = true;
 	internal->new_state = true;
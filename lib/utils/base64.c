@@ -22,6 +22,7 @@
  *  - Reworked coding style
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 #include <zephyr/sys/base64.h>
@@ -54,6 +55,39 @@ static const uint8_t base64_dec_map[128] = {
 
 #define BASE64_SIZE_T_MAX	((size_t) -1) /* SIZE_T_MAX is not standard */
 
+/*
+ * Decode four characters to three bytes, unless one of them is not a data
+ * character: padding, line breaks and spaces are left to the caller.
+ */
+static inline bool base64_decode_quad(uint8_t *dst, const uint8_t *src)
+{
+	uint32_t a, b, c, d;
+
+	if (((src[0] | src[1] | src[2] | src[3]) & 0x80) != 0U) {
+		return false;
+	}
+
+	a = base64_dec_map[src[0]];
+	b = base64_dec_map[src[1]];
+	c = base64_dec_map[src[2]];
+	d = base64_dec_map[src[3]];
+
+	/* Invalid characters are 127 and padding is 64 */
+	if (((a | b | c | d) & 0xC0) != 0U) {
+		return false;
+	}
+
+	if (dst != NULL) {
+		uint32_t x = (a << 18) | (b << 12) | (c << 6) | d;
+
+		dst[0] = (uint8_t)(x >> 16);
+		dst[1] = (uint8_t)(x >> 8);
+		dst[2] = (uint8_t)x;
+	}
+
+	return true;
+}
+
 /*
  * Encode a buffer into base64 format
  */
@@ -130,6 +164,16 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 
 	/* First pass: check for validity and get output length */
 	for (i = n = j = 0U; i < slen; i++) {
+		/* Whole groups of data characters, until padding */
+		while (j == 0U && (slen - i) >= 4 && base64_decode_quad(NULL, &src[i])) {
+			i += 4;
+			n += 4;
+		}
+
+		if (i == slen) {
+			break;
+		}
+
 		/* Skip spaces before checking for EOL */
 		x = 0U;
 		while (i < slen && src[i] == ' ') {
@@ -188,6 +232,16 @@ int base64_decode(uint8_t *dst, size_t dlen, size_t *olen, const uint8_t *src,
 	}
 
 	for (j = 3U, n = x = 0U, p = dst; i > 0; i--, src++) {
+		/* Whole groups of data characters, between line breaks */
+		while (n == 0U && i >= 4 && base64_decode_quad(p, src)) {
+			i -= 4;
+			src += 4;
+			p += 3;
+		}
+
+		if (i == 0) {
+			break;
+		}
 
 		if (*src == '\r' || *src == '\n' || *src == ' ') {
 			continue;
@@ -45,6 +45,123 @@ static void setup_bundle_data(sys_bitarray_t *bitarray,
 	}
 }
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+/*
+ * Refresh the summary bits of bundles sidx to eidx, after they changed.
+ */
+static void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	if (bitarray->summary == NULL) {
+		return;
+	}
+
+	for (size_t idx = sidx; idx <= eidx; idx++) {
+		uint32_t *word = &bitarray->summary[idx / 32];
+
+		if (~bitarray->bundles[idx] == 0U) {
+			*word |= BIT(idx % 32);
+		} else {
+			*word &= ~BIT(idx % 32);
+		}
+	}
+}
+
+/*
+ * Find the first bundle, from idx onward, which is not all set.
+ * Return num_bundles if there is none.
+ */
+static size_t next_free_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+	size_t widx = idx / 32;
+	uint32_t word;
+
+	if (bitarray->summary == NULL || idx >= bitarray->num_bundles) {
+		return idx;
+	}
+
+	word = ~bitarray->summary[widx] & ~(BIT(idx % 32) - 1);
+	while (word == 0U) {
+		widx++;
+		if (widx * 32 >= bitarray->num_bundles) {
+			return bitarray->num_bundles;
+		}
+		word = ~bitarray->summary[widx];
+	}
+
+	return MIN(widx * 32 + find_lsb_set(word) - 1, bitarray->num_bundles);
+}
+#else
+static inline void update_summary(sys_bitarray_t *bitarray, size_t sidx, size_t eidx)
+{
+	ARG_UNUSED(bitarray);
+	ARG_UNUSED(sidx);
+	ARG_UNUSED(eidx);
+}
+
+static inline size_t next_free_bundle(sys_bitarray_t *bitarray, size_t idx)
+{
+	ARG_UNUSED(bitarray);
+
+	return idx;
+}
+#endif /* CONFIG_SYS_BITARRAY_SUMMARY */
+
+/*
+ * Find the first cleared bit at or after a bit location.
+ *
+ * @param bitarray Bitarray struct
+ * @param bit      Starting bit location
+ *
+ * @return Offset of the cleared bit, num_bits if there is none
+ */
+static size_t find_next_clear(sys_bitarray_t *bitarray, size_t bit)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (bit >= bitarray->num_bits) {
+		return bitarray->num_bits;
+	}
+
+	bundle = ~bitarray->bundles[idx] & ~(BIT(bit % bundle_bitness(bitarray)) - 1);
+	while (bundle == 0U) {
+		idx = next_free_bundle(bitarray, idx + 1);
+		if (idx >= bitarray->num_bundles) {
+			return bitarray->num_bits;
+		}
+		bundle = ~bitarray->bundles[idx];
+	}
+
+	return MIN(idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1,
+		   bitarray->num_bits);
+}
+
+/*
+ * Find the first set bit in [bit, limit).
+ *
+ * @param bitarray Bitarray struct
+ * @param bit      Starting bit location
+ * @param limit    End of the search, at most num_bits
+ *
+ * @return Offset of the set bit, limit if there is none
+ */
+static size_t find_next_set(sys_bitarray_t *bitarray, size_t bit, size_t limit)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	bundle = bitarray->bundles[idx] & ~(BIT(bit % bundle_bitness(bitarray)) - 1);
+	while (bundle == 0U) {
+		idx++;
+		if (idx * bundle_bitness(bitarray) >= limit) {
+			return limit;
+		}
+		bundle = bitarray->bundles[idx];
+	}
+
+	return MIN(idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1, limit);
+}
+
 /*
  * Find out if the bits in a region is all set or all clear.
  *
@@ -208,6 +325,8 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+	update_summary(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
@@ -309,6 +428,7 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	update_summary(dst, bd.sidx, bd.eidx);
 	ret = 0;
 
 out:
@@ -337,6 +457,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -365,6 +486,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -441,6 +563,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -480,6 +603,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	update_summary(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -492,11 +616,8 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
+	size_t bit_idx, run_end, off_end;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -513,46 +634,21 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
-
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
+	/* Look at whole bundles for the start of each free region,
+	 * then for its end.
 	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
-
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
-
-		break;
-	}
-
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
+	for (bit_idx = find_next_clear(bitarray, 0); bit_idx <= off_end;
+	     bit_idx = find_next_clear(bitarray, run_end)) {
+		run_end = find_next_set(bitarray, bit_idx, bit_idx + num_bits);
+		if (run_end == bit_idx + num_bits) {
+			set_region(bitarray, bit_idx, num_bits, true, NULL);
 
 			*offset = bit_idx;
 			ret = 0;
 			break;
 		}
-
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
 	}
 
 out:
@@ -738,12 +738,53 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
+/*
+ * Index of the descriptor of a key not decoded yet, or -1 if there is
+ * none.  Objects tend to list their keys in the order of the
+ * descriptors: the search starts with the descriptor following the one
+ * found last, so that each key then takes a single comparison.  A NULL
+ * key stands for one too long to be compared, only -ENOMEM when there
+ * could be a match.
+ */
+static int find_field(const struct json_obj_descr *descr, size_t descr_len, int64_t decoded,
+		      const char *key, size_t key_len, size_t start)
+{
+	size_t i = start;
+
+	for (size_t n = 0; n < descr_len; n++, i++) {
+		if (i == descr_len) {
+			i = 0;
+		}
+
+		/* Field has been decoded already, skip */
+		if (decoded & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		/* Check if it's the i-th field */
+		if (key_len != descr[i].field_name_len) {
+			continue;
+		}
+
+		if (key == NULL) {
+			return -ENOMEM;
+		}
+
+		if (memcmp(key, descr[i].field_name, key_len) == 0) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
 static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 			 size_t descr_len, void *val)
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t next = 0;
+	int i;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -751,42 +792,27 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
-
-			/* Field has been decoded already, skip */
-			if (decoded_fields & ((int64_t)1 << i)) {
-				continue;
-			}
-
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
-			}
-
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
-				continue;
-			}
+		i = find_field(descr, descr_len, decoded_fields, kv.key, kv.key_len, next);
 
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
+		/* Skip field, if no descriptor was found */
+		if (i < 0) {
+			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
 			}
 
-			decoded_fields |= (int64_t)1<<i;
-			break;
+			continue;
 		}
 
-		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
-			ret = skip_field(obj, &kv);
-			if (ret < 0) {
-				return ret;
-			}
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value,
+				   (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
 		}
+
+		decoded_fields |= (int64_t)1 << i;
+		next = i + 1;
 	}
 
 	return -EINVAL;
@@ -856,6 +882,626 @@ int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_
 	return obj_parse(json, descr, descr_len, val);
 }
 
+#ifdef CONFIG_JSON_LIBRARY_STREAM
+
+enum json_stream_lex {
+	STREAM_LEX_IDLE,
+	STREAM_LEX_STRING,
+	STREAM_LEX_ESCAPE,
+	STREAM_LEX_UNICODE,
+	STREAM_LEX_MINUS,
+	STREAM_LEX_NUMBER,
+	STREAM_LEX_LITERAL,
+	STREAM_LEX_RAW,
+	STREAM_LEX_RAW_STRING,
+	STREAM_LEX_RAW_ESCAPE,
+};
+
+enum json_stream_state {
+	STREAM_KEY_OR_END,
+	STREAM_KEY,
+	STREAM_COLON,
+	STREAM_VALUE_OR_END,
+	STREAM_VALUE,
+	STREAM_COMMA_OR_END,
+};
+
+/* The token being parsed follows the strings stored in the buffer.  Its
+ * length keeps counting when it does not fit, for keys to be matched
+ * by length at least.
+ */
+static void stream_append(struct json_obj_stream *stream, char chr)
+{
+	if (stream->used + stream->tok_len + 1 < stream->buf_size) {
+		stream->buf[stream->used + stream->tok_len] = chr;
+	}
+
+	stream->tok_len++;
+}
+
+static void stream_start(struct json_obj_stream *stream, enum json_stream_lex lex)
+{
+	stream->lex = lex;
+	stream->tok_len = 0;
+}
+
+static bool stream_tok_fits(const struct json_obj_stream *stream)
+{
+	return stream->used + stream->tok_len < stream->buf_size;
+}
+
+/* Keep the current token, NUL-terminated, in the buffer */
+static char *stream_commit(struct json_obj_stream *stream)
+{
+	char *str = &stream->buf[stream->used];
+
+	str[stream->tok_len] = '\0';
+	stream->used += stream->tok_len + 1;
+
+	return str;
+}
+
+static int stream_push(struct json_obj_stream *stream, enum json_tokens type,
+		       const struct json_obj_descr *descr, void *field)
+{
+	struct json_obj_stream_frame *frame;
+
+	if (stream->depth == ARRAY_SIZE(stream->frames)) {
+		return -ENOMEM;
+	}
+
+	frame = &stream->frames[stream->depth++];
+	frame->type = type;
+	frame->descr = descr;
+	frame->field = field;
+	frame->state = (type == JSON_TOK_OBJECT_START) ? STREAM_KEY_OR_END : STREAM_VALUE_OR_END;
+
+	return 0;
+}
+
+static int stream_push_obj(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			   size_t descr_len, void *val)
+{
+	struct json_obj_stream_frame *frame;
+	int ret;
+
+	ret = stream_push(stream, JSON_TOK_OBJECT_START, descr, val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+	frame->obj.decoded = 0;
+	frame->obj.descr_len = descr_len;
+	frame->obj.key = -1;
+	frame->obj.next = 0;
+
+	return 0;
+}
+
+/* Same layout rules as arr_parse() */
+static int stream_push_arr(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			   void *field, void *val)
+{
+	const struct json_obj_descr *elem_descr = descr->array.element_descr;
+	struct json_obj_stream_frame *frame;
+	size_t *elements = (size_t *)((char *)val + elem_descr->offset);
+	ptrdiff_t elem_size;
+	int ret;
+
+	if (elem_descr->type == JSON_TOK_ARRAY_START) {
+		elem_descr = elem_descr->array.element_descr;
+	}
+
+	elem_size = get_elem_size(elem_descr);
+	__ASSERT_NO_MSG(elem_size > 0);
+
+	ret = stream_push(stream, JSON_TOK_ARRAY_START, elem_descr, field);
+	if (ret < 0) {
+		return ret;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+	frame->arr.val = val;
+	frame->arr.last_elem = (char *)field + elem_size * descr->array.n_elements;
+	frame->arr.elements = elements;
+	frame->arr.elem_size = elem_size;
+	*elements = 0;
+
+	return 0;
+}
+
+/* Account for a complete value in the innermost object or array */
+static int stream_value_done(struct json_obj_stream *stream)
+{
+	struct json_obj_stream_frame *frame;
+
+	if (stream->depth == 0) {
+		stream->done = true;
+		return 0;
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+
+	if (frame->type == JSON_TOK_OBJECT_START) {
+		if (frame->obj.key >= 0) {
+			frame->obj.decoded |= (int64_t)1 << frame->obj.key;
+			frame->obj.next = frame->obj.key + 1;
+		}
+	} else {
+		(*frame->arr.elements)++;
+		frame->field = (char *)frame->field + frame->arr.elem_size;
+	}
+
+	return 0;
+}
+
+static int stream_pop(struct json_obj_stream *stream)
+{
+	struct json_obj_stream_frame *frame = &stream->frames[--stream->depth];
+
+	if (stream->depth == 0) {
+		stream->result = frame->obj.decoded;
+	}
+
+	return stream_value_done(stream);
+}
+
+static int stream_decode(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			 enum json_tokens type, void *field, void *val)
+{
+	struct json_token tok = {
+		.type = type,
+		.start = &stream->buf[stream->used],
+		.end = &stream->buf[stream->used + stream->tok_len],
+	};
+	int ret = 0;
+
+	if (!equivalent_types(type, descr->type)) {
+		return -EINVAL;
+	}
+
+	switch (descr->type) {
+	case JSON_TOK_OBJECT_START:
+		return stream_push_obj(stream, descr->object.sub_descr,
+				       descr->object.sub_descr_len, field);
+	case JSON_TOK_ARRAY_START:
+		return stream_push_arr(stream, descr, field, val);
+	case JSON_TOK_OBJ_ARRAY:
+		/* Copied as is up to the matching ']', by the lexer */
+		stream->raw = field;
+		stream->raw_depth = 1;
+		stream_start(stream, STREAM_LEX_RAW);
+		stream_append(stream, '[');
+		return 0;
+	case JSON_TOK_FALSE:
+	case JSON_TOK_TRUE: {
+		bool *v = field;
+
+		*v = type == JSON_TOK_TRUE;
+		break;
+	}
+	case JSON_TOK_NUMBER:
+	case JSON_TOK_INT64:
+	case JSON_TOK_UINT64:
+		if (!stream_tok_fits(stream)) {
+			return -ENOMEM;
+		}
+
+		if (descr->type == JSON_TOK_NUMBER) {
+			ret = decode_num(&tok, field);
+		} else if (descr->type == JSON_TOK_INT64) {
+			ret = decode_int64(&tok, field);
+		} else {
+			ret = decode_uint64(&tok, field);
+		}
+		break;
+	case JSON_TOK_OPAQUE:
+	case JSON_TOK_FLOAT: {
+		struct json_obj_token *obj_token = field;
+
+		if (!stream_tok_fits(stream)) {
+			return -ENOMEM;
+		}
+
+		obj_token->length = stream->tok_len;
+		obj_token->start = stream_commit(stream);
+		break;
+	}
+	case JSON_TOK_STRING: {
+		char **str = field;
+
+		if (!stream_tok_fits(stream)) {
+			return -ENOMEM;
+		}
+
+		*str = stream_commit(stream);
+		break;
+	}
+	default:
+		return -EINVAL;
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return stream_value_done(stream);
+}
+
+static int stream_obj_token(struct json_obj_stream *stream, struct json_obj_stream_frame *frame,
+			    enum json_tokens type)
+{
+	const struct json_obj_descr *descr;
+
+	switch (frame->state) {
+	case STREAM_KEY_OR_END:
+		if (type == JSON_TOK_OBJECT_END) {
+			return stream_pop(stream);
+		}
+
+		__fallthrough;
+	case STREAM_KEY:
+		if (type != JSON_TOK_STRING) {
+			return -EINVAL;
+		}
+
+		frame->obj.key = find_field(frame->descr, frame->obj.descr_len, frame->obj.decoded,
+					    stream_tok_fits(stream) ? &stream->buf[stream->used] : NULL,
+					    stream->tok_len, frame->obj.next);
+		if (frame->obj.key == -ENOMEM) {
+			return -ENOMEM;
+		}
+
+		frame->state = STREAM_COLON;
+		return 0;
+	case STREAM_COLON:
+		if (type != JSON_TOK_COLON) {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_VALUE;
+		return 0;
+	case STREAM_VALUE:
+		if (element_token(type) < 0) {
+			return -EINVAL;
+		}
+
+		frame->state = STREAM_COMMA_OR_END;
+
+		/* Skip field, if no descriptor was found */
+		if (frame->obj.key < 0) {
+			if (type == JSON_TOK_OBJECT_START || type == JSON_TOK_ARRAY_START) {
+				stream->skip = 1;
+				return 0;
+			}
+
+			return stream_value_done(stream);
+		}
+
+		descr = &frame->descr[frame->obj.key];
+
+		return stream_decode(stream, descr, type, (char *)frame->field + descr->offset,
+				     frame->field);
+	default:
+		if (type == JSON_TOK_COMMA) {
+			frame->state = STREAM_KEY;
+			return 0;
+		}
+
+		if (type == JSON_TOK_OBJECT_END) {
+			return stream_pop(stream);
+		}
+
+		return -EINVAL;
+	}
+}
+
+static int stream_arr_token(struct json_obj_stream *stream, struct json_obj_stream_frame *frame,
+			    enum json_tokens type)
+{
+	switch (frame->state) {
+	case STREAM_VALUE_OR_END:
+		if (type == JSON_TOK_ARRAY_END) {
+			return stream_pop(stream);
+		}
+
+		__fallthrough;
+	case STREAM_VALUE:
+		if (element_token(type) < 0) {
+			return -EINVAL;
+		}
+
+		if (frame->field == frame->arr.last_elem) {
+			return -ENOSPC;
+		}
+
+		/* For nested arrays, update value to current field,
+		 * so it matches descriptor's offset to length field
+		 */
+		if (frame->descr->type == JSON_TOK_ARRAY_START) {
+			frame->arr.val = frame->field;
+		}
+
+		frame->state = STREAM_COMMA_OR_END;
+
+		return stream_decode(stream, frame->descr, type, frame->field, frame->arr.val);
+	default:
+		if (type == JSON_TOK_COMMA) {
+			frame->state = STREAM_VALUE;
+			return 0;
+		}
+
+		if (type == JSON_TOK_ARRAY_END) {
+			return stream_pop(stream);
+		}
+
+		return -EINVAL;
+	}
+}
+
+static int stream_parse(struct json_obj_stream *stream, enum json_tokens type)
+{
+	struct json_obj_stream_frame *frame;
+
+	if (stream->skip > 0) {
+		switch (type) {
+		case JSON_TOK_OBJECT_START:
+		case JSON_TOK_ARRAY_START:
+			if (stream->skip == UINT16_MAX) {
+				return -ENOMEM;
+			}
+
+			stream->skip++;
+			return 0;
+		case JSON_TOK_OBJECT_END:
+		case JSON_TOK_ARRAY_END:
+			if (--stream->skip == 0) {
+				return stream_value_done(stream);
+			}
+
+			return 0;
+		default:
+			return 0;
+		}
+	}
+
+	if (stream->depth == 0) {
+		if (type != JSON_TOK_OBJECT_START) {
+			return -EINVAL;
+		}
+
+		return stream_push_obj(stream, stream->descr, stream->descr_len, stream->val);
+	}
+
+	frame = &stream->frames[stream->depth - 1];
+
+	if (frame->type == JSON_TOK_OBJECT_START) {
+		return stream_obj_token(stream, frame, type);
+	}
+
+	return stream_arr_token(stream, frame, type);
+}
+
+static int stream_literal(struct json_obj_stream *stream, const char *rest,
+			  enum json_tokens type)
+{
+	stream->literal = rest;
+	stream->literal_tok = type;
+	stream->lex = STREAM_LEX_LITERAL;
+
+	return 0;
+}
+
+static int stream_raw(struct json_obj_stream *stream, char chr)
+{
+	stream_append(stream, chr);
+
+	switch (stream->lex) {
+	case STREAM_LEX_RAW_STRING:
+		if (chr == '\\') {
+			stream->lex = STREAM_LEX_RAW_ESCAPE;
+		} else if (chr == '"') {
+			stream->lex = STREAM_LEX_RAW;
+		}
+		return 0;
+	case STREAM_LEX_RAW_ESCAPE:
+		stream->lex = STREAM_LEX_RAW_STRING;
+		return 0;
+	default:
+		break;
+	}
+
+	if (chr == '"') {
+		stream->lex = STREAM_LEX_RAW_STRING;
+	} else if (chr == '[') {
+		stream->raw_depth++;
+	} else if (chr == ']' && --stream->raw_depth == 0) {
+		if (!stream_tok_fits(stream)) {
+			return -ENOMEM;
+		}
+
+		stream->lex = STREAM_LEX_IDLE;
+		stream->raw->length = stream->tok_len;
+		stream->raw->start = stream_commit(stream);
+
+		return stream_value_done(stream);
+	}
+
+	return 0;
+}
+
+static int stream_char(struct json_obj_stream *stream, char chr)
+{
+	int uchr = (unsigned char)chr;
+	int ret;
+
+	switch (stream->lex) {
+	case STREAM_LEX_IDLE:
+		switch (chr) {
+		case '}':
+		case '{':
+		case '[':
+		case ']':
+		case ',':
+		case ':':
+			return stream_parse(stream, (enum json_tokens)chr);
+		case '"':
+			stream_start(stream, STREAM_LEX_STRING);
+			return 0;
+		case 'n':
+			return stream_literal(stream, "ull", JSON_TOK_NULL);
+		case 't':
+			return stream_literal(stream, "rue", JSON_TOK_TRUE);
+		case 'f':
+			return stream_literal(stream, "alse", JSON_TOK_FALSE);
+		case '-':
+			stream_start(stream, STREAM_LEX_MINUS);
+			stream_append(stream, chr);
+			return 0;
+		default:
+			if (isspace(uchr) != 0) {
+				return 0;
+			}
+
+			if (isdigit(uchr) != 0) {
+				stream_start(stream, STREAM_LEX_NUMBER);
+				stream_append(stream, chr);
+				return 0;
+			}
+
+			return -EINVAL;
+		}
+	case STREAM_LEX_STRING:
+		if (chr == '"') {
+			stream->lex = STREAM_LEX_IDLE;
+			return stream_parse(stream, JSON_TOK_STRING);
+		}
+
+		if (chr == '\0') {
+			return -EINVAL;
+		}
+
+		if (chr == '\\') {
+			stream->lex = STREAM_LEX_ESCAPE;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_ESCAPE:
+		switch (chr) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			stream->lex = STREAM_LEX_STRING;
+			break;
+		case 'u':
+			stream->lex = STREAM_LEX_UNICODE;
+			stream->lex_arg = 4;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_UNICODE:
+		if (isxdigit(uchr) == 0) {
+			return -EINVAL;
+		}
+
+		if (--stream->lex_arg == 0) {
+			stream->lex = STREAM_LEX_STRING;
+		}
+
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_MINUS:
+		if (isdigit(uchr) == 0) {
+			return -EINVAL;
+		}
+
+		stream->lex = STREAM_LEX_NUMBER;
+		stream_append(stream, chr);
+		return 0;
+	case STREAM_LEX_NUMBER:
+		if (isdigit(uchr) != 0 || chr == '.') {
+			stream_append(stream, chr);
+			return 0;
+		}
+
+		stream->lex = STREAM_LEX_IDLE;
+		ret = stream_parse(stream, JSON_TOK_NUMBER);
+		if (ret < 0 || stream->done) {
+			return ret;
+		}
+
+		/* The character ending the number starts the next token */
+		return stream_char(stream, chr);
+	case STREAM_LEX_LITERAL:
+		if (chr != *stream->literal) {
+			return -EINVAL;
+		}
+
+		if (*++stream->literal == '\0') {
+			stream->lex = STREAM_LEX_IDLE;
+			return stream_parse(stream, stream->literal_tok);
+		}
+
+		return 0;
+	default:
+		return stream_raw(stream, chr);
+	}
+}
+
+void json_obj_stream_init(struct json_obj_stream *stream, const struct json_obj_descr *descr,
+			  size_t descr_len, void *val, char *buf, size_t buf_size)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(stream->result) * CHAR_BIT - 1));
+
+	*stream = (struct json_obj_stream){
+		.descr = descr,
+		.descr_len = descr_len,
+		.val = val,
+		.buf = buf,
+		.buf_size = buf_size,
+		.lex = STREAM_LEX_IDLE,
+	};
+}
+
+int json_obj_stream_feed(struct json_obj_stream *stream, const char *data, size_t len)
+{
+	for (size_t i = 0; i < len && stream->error == 0 && !stream->done; i++) {
+		stream->error = stream_char(stream, data[i]);
+	}
+
+	if (stream->error < 0) {
+		return stream->error;
+	}
+
+	return stream->done ? 1 : 0;
+}
+
+int64_t json_obj_stream_finish(struct json_obj_stream *stream)
+{
+	if (stream->error < 0) {
+		return stream->error;
+	}
+
+	if (!stream->done) {
+		return -EINVAL;
+	}
+
+	return stream->result;
+}
+
+#endif /* CONFIG_JSON_LIBRARY_STREAM */
+
 static char escape_as(char chr)
 {
 	switch (chr) {
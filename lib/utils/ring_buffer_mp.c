@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Multi-producer, multi-consumer ring buffer.
+ *
+ * Producers and consumers each claim blocks by moving a free-running
+ * block counter with a compare-and-swap: put_head for producers, get_head
+ * for consumers. The header of the first block of a chunk tells where
+ * the chunk stands through its sequence number: 2 * pos + 1 once the
+ * producer finished it and 2 * pos + 2 once the consumer did, pos being
+ * the value of the counters at the chunk. Previous uses of a block never
+ * match, and neither do zero-initialized headers. get_tail follows the
+ * chunks given back in order, whoever gives them back.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/ring_buffer_mp.h>
+
+static inline uint32_t pos_get(atomic_t *pos)
+{
+	return (uint32_t)atomic_get(pos);
+}
+
+static inline bool pos_cas(atomic_t *pos, uint32_t old_pos, uint32_t new_pos)
+{
+	return atomic_cas(pos, (atomic_val_t)old_pos, (atomic_val_t)new_pos);
+}
+
+static inline uint32_t seq_get(struct ring_buf_mp_chunk *chunk)
+{
+	return (uint32_t)atomic_get(&chunk->seq);
+}
+
+static inline void seq_set(struct ring_buf_mp_chunk *chunk, uint32_t seq)
+{
+	(void)atomic_set(&chunk->seq, (atomic_val_t)seq);
+}
+
+/* Index of the block at @p data, or -1 if it is not the start of a block */
+static int32_t block_idx(const struct ring_buf_mp *buf, const uint8_t *data)
+{
+	uintptr_t offset = (uintptr_t)data - (uintptr_t)buf->buffer;
+
+	if (offset >= (uintptr_t)buf->block_size * (buf->mask + 1) ||
+	    offset % buf->block_size != 0) {
+		return -1;
+	}
+
+	return offset / buf->block_size;
+}
+
+/*
+ * Position of the block at @p idx entered last by @p head: chunks that are
+ * claimed but not finished are less than a buffer behind.
+ */
+static inline uint32_t block_pos(const struct ring_buf_mp *buf, uint32_t head, uint32_t idx)
+{
+	return head - 1 - ((head - 1 - idx) & buf->mask);
+}
+
+void ring_buf_mp_init(struct ring_buf_mp *buf, uint32_t block_size, uint32_t n_blocks,
+		      uint8_t *data, struct ring_buf_mp_chunk *chunks)
+{
+	__ASSERT(Z_RING_BUF_MP_SIZE_OK(block_size, n_blocks), Z_RING_BUF_MP_SIZE_ASSERT_MSG);
+
+	memset(chunks, 0, n_blocks * sizeof(*chunks));
+
+	buf->buffer = data;
+	buf->chunks = chunks;
+	buf->block_size = block_size;
+	buf->mask = n_blocks - 1;
+	(void)atomic_set(&buf->put_head, 0);
+	(void)atomic_set(&buf->get_head, 0);
+	(void)atomic_set(&buf->get_tail, 0);
+}
+
+uint32_t ring_buf_mp_put_claim(struct ring_buf_mp *buf, uint8_t **data, uint32_t size)
+{
+	uint32_t n_blocks = buf->mask + 1;
+	uint32_t head, idx, blocks;
+
+	if (size == 0) {
+		return 0;
+	}
+
+	do {
+		uint32_t tail;
+
+		head = pos_get(&buf->put_head);
+		tail = pos_get(&buf->get_tail);
+		idx = head & buf->mask;
+
+		/* tail is never ahead of an up to date head; if it is, the CAS fails */
+		blocks = n_blocks - (head - tail);
+		if (blocks == 0) {
+			return 0;
+		}
+		blocks = MIN(blocks, DIV_ROUND_UP(size, buf->block_size));
+		blocks = MIN(blocks, n_blocks - idx);
+		blocks = MIN(blocks, UINT16_MAX / buf->block_size);
+	} while (!pos_cas(&buf->put_head, head, head + blocks));
+
+	/* read by consumers only once the chunk is finished */
+	buf->chunks[idx].blocks = blocks;
+
+	*data = &buf->buffer[idx * buf->block_size];
+
+	return MIN(size, blocks * buf->block_size);
+}
+
+int ring_buf_mp_put_finish(struct ring_buf_mp *buf, uint8_t *data, uint32_t size)
+{
+	int32_t idx = block_idx(buf, data);
+	struct ring_buf_mp_chunk *chunk;
+	uint32_t pos;
+
+	if (idx < 0) {
+		return -EINVAL;
+	}
+
+	chunk = &buf->chunks[idx];
+	pos = block_pos(buf, pos_get(&buf->put_head), idx);
+
+	if (size > chunk->blocks * buf->block_size || seq_get(chunk) == 2 * pos + 1) {
+		return -EINVAL;
+	}
+
+	chunk->len = size;
+	seq_set(chunk, 2 * pos + 1);
+
+	return 0;
+}
+
+uint32_t ring_buf_mp_put(struct ring_buf_mp *buf, const uint8_t *data, uint32_t size)
+{
+	uint32_t total = 0;
+	uint8_t *dst;
+	uint32_t len;
+	int err;
+
+	while (total < size) {
+		len = ring_buf_mp_put_claim(buf, &dst, size - total);
+		if (len == 0) {
+			break;
+		}
+
+		memcpy(dst, &data[total], len);
+		err = ring_buf_mp_put_finish(buf, dst, len);
+		__ASSERT_NO_MSG(err == 0);
+		total += len;
+	}
+
+	return total;
+}
+
+/* Give the chunk at @p pos back and move get_tail over what is given back */
+static void release(struct ring_buf_mp *buf, uint32_t pos)
+{
+	seq_set(&buf->chunks[pos & buf->mask], 2 * pos + 2);
+
+	for (;;) {
+		uint32_t tail = pos_get(&buf->get_tail);
+		struct ring_buf_mp_chunk *chunk = &buf->chunks[tail & buf->mask];
+
+		if (seq_get(chunk) != 2 * tail + 2) {
+			break;
+		}
+
+		/* if chunk was given back and reused meanwhile, tail moved and the CAS fails */
+		(void)pos_cas(&buf->get_tail, tail, tail + chunk->blocks);
+	}
+}
+
+/* Claim next chunk, unless it is larger than @p limit */
+static bool claim(struct ring_buf_mp *buf, uint32_t limit, uint32_t *pos, uint32_t *len)
+{
+	for (;;) {
+		uint32_t head = pos_get(&buf->get_head);
+		struct ring_buf_mp_chunk *chunk = &buf->chunks[head & buf->mask];
+		uint32_t blocks;
+
+		if (seq_get(chunk) != 2 * head + 1) {
+			return false;
+		}
+
+		blocks = chunk->blocks;
+		*len = chunk->len;
+		if (*len > limit) {
+			return false;
+		}
+
+		if (!pos_cas(&buf->get_head, head, head + blocks)) {
+			continue;
+		}
+
+		if (*len == 0) {
+			/* cancelled claim */
+			release(buf, head);
+			continue;
+		}
+
+		*pos = head;
+
+		return true;
+	}
+}
+
+uint32_t ring_buf_mp_get_claim(struct ring_buf_mp *buf, uint8_t **data)
+{
+	uint32_t pos, len;
+
+	if (!claim(buf, UINT32_MAX, &pos, &len)) {
+		return 0;
+	}
+
+	*data = &buf->buffer[(pos & buf->mask) * buf->block_size];
+
+	return len;
+}
+
+int ring_buf_mp_get_finish(struct ring_buf_mp *buf, uint8_t *data)
+{
+	int32_t idx = block_idx(buf, data);
+	uint32_t pos;
+
+	if (idx < 0) {
+		return -EINVAL;
+	}
+
+	pos = block_pos(buf, pos_get(&buf->get_head), idx);
+	if (seq_get(&buf->chunks[idx]) != 2 * pos + 1) {
+		return -EINVAL;
+	}
+
+	release(buf, pos);
+
+	return 0;
+}
+
+uint32_t ring_buf_mp_get(struct ring_buf_mp *buf, uint8_t *data, uint32_t size)
+{
+	uint32_t total = 0;
+	uint32_t pos, len;
+
+	while (claim(buf, size - total, &pos, &len)) {
+		memcpy(&data[total], &buf->buffer[(pos & buf->mask) * buf->block_size], len);
+		release(buf, pos);
+		total += len;
+	}
+
+	if (total == 0 && size > 0 && claim(buf, UINT32_MAX, &pos, &len)) {
+		/* a chunk that fits may have been taken by another consumer */
+		total = MIN(len, size);
+		memcpy(data, &buf->buffer[(pos & buf->mask) * buf->block_size], total);
+		release(buf, pos);
+	}
+
+	return total;
+}
@@ -183,8 +183,6 @@ static void send_data(struct broadcast_source_stream *source_stream)
 
 	net_buf_reserve(buf, BT_ISO_CHAN_SEND_RESERVE);
 #if defined(CONFIG_LIBLC3)
-	uint8_t lc3_encoded_buffer[preset_active.qos.sdu];
-
 	if (source_stream->lc3_encoder == NULL) {
 		printk("LC3 encoder not setup, cannot encode data.\n");
 		net_buf_unref(buf);
@@ -203,15 +201,14 @@ static void send_data(struct broadcast_source_stream *source_stream)
 	}
 #endif
 
+	/* Encode straight into the ISO buffer, so the frame is not copied again */
 	ret = lc3_encode(source_stream->lc3_encoder, LC3_PCM_FORMAT_S16, send_pcm_data, 1,
-			 octets_per_frame, lc3_encoded_buffer);
+			 octets_per_frame, net_buf_add(buf, preset_active.qos.sdu));
 	if (ret == -1) {
 		printk("LC3 encoder failed - wrong parameters?: %d", ret);
 		net_buf_unref(buf);
 		return;
 	}
-
-	net_buf_add_mem(buf, lc3_encoded_buffer, preset_active.qos.sdu);
 #else
 	net_buf_add_mem(buf, send_pcm_data, preset_active.qos.sdu);
 #endif /* defined(CONFIG_LIBLC3) */
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+/* First byte of every message, telling the remote what to do with it */
+enum bench_op {
+	/* Send the message back, copying it through ipc_service_send() */
+	BENCH_OP_ECHO = 1,
+	/* Send the message back, holding it and using a no-copy TX buffer */
+	BENCH_OP_ECHO_NOCOPY,
+	/* Drop the message */
+	BENCH_OP_SINK,
+	/* Drop the message and reply with a BENCH_OP_SINK_END */
+	BENCH_OP_SINK_END,
+};
+
+#define BENCH_MSG_MAX		(1024)
+
+#endif /* __BENCH_H__ */
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include <zephyr/ipc/ipc_service.h>
+#include <string.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(remote, LOG_LEVEL_INF);
+
+struct echo_req {
+	const void *data;
+	size_t len;
+	/* The data is the received buffer, held until the reply is sent */
+	bool held;
+};
+
+K_MSGQ_DEFINE(echo_msgq, sizeof(struct echo_req), 4, 4);
+
+static struct ipc_ept ep;
+static uint8_t echo_msg[BENCH_MSG_MAX];
+
+static void ep_bound(void *priv)
+{
+	LOG_INF("Ep bounded");
+}
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	const uint8_t *msg = data;
+	struct echo_req req = {
+		.data = echo_msg,
+		.len = len,
+	};
+
+	switch (msg[0]) {
+	case BENCH_OP_ECHO:
+		req.len = MIN(len, sizeof(echo_msg));
+		memcpy(echo_msg, data, req.len);
+		break;
+	case BENCH_OP_ECHO_NOCOPY:
+		if (ipc_service_hold_rx_buffer(&ep, (void *)data) < 0) {
+			return;
+		}
+
+		req.data = data;
+		req.held = true;
+		break;
+	case BENCH_OP_SINK_END:
+		echo_msg[0] = msg[0];
+		req.len = 1;
+		break;
+	default:
+		return;
+	}
+
+	if (k_msgq_put(&echo_msgq, &req, K_NO_WAIT) != 0) {
+		LOG_ERR("Echo queue full");
+		if (req.held) {
+			ipc_service_release_rx_buffer(&ep, (void *)data);
+		}
+	}
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+static int echo(const struct echo_req *req)
+{
+	uint32_t size;
+	void *buf;
+	int ret;
+
+	while (true) {
+		if (req->held) {
+			size = req->len;
+			ret = ipc_service_get_tx_buffer(&ep, &buf, &size, K_NO_WAIT);
+			if (ret == 0) {
+				memcpy(buf, req->data, req->len);
+				ret = ipc_service_send_nocopy(&ep, buf, req->len);
+			}
+		} else {
+			ret = ipc_service_send(&ep, req->data, req->len);
+		}
+
+		if (ret != -ENOMEM && ret != -ENOBUFS) {
+			break;
+		}
+
+		k_yield();
+	}
+
+	if (req->held) {
+		ipc_service_release_rx_buffer(&ep, (void *)req->data);
+	}
+
+	return MIN(ret, 0);
+}
+
+int main(void)
+{
+	const struct device *ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+	struct echo_req req;
+	int ret;
+
+	LOG_INF("IPC-service benchmark remote started");
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		LOG_ERR("ipc_service_open_instance() failure");
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		LOG_ERR("ipc_service_register_endpoint() failure");
+		return ret;
+	}
+
+	while (true) {
+		k_msgq_get(&echo_msgq, &req, K_FOREVER);
+
+		ret = echo(&req);
+		if (ret < 0) {
+			LOG_ERR("Echo failed (%d)", ret);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#include <zephyr/ipc/ipc_service.h>
+#include <string.h>
+
+#include "bench.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(host, LOG_LEVEL_INF);
+
+#define ROUND_TRIPS		(1000)
+#define STREAM_BYTES		(256 * 1024)
+#define REPLY_TIMEOUT		K_MSEC(1000)
+
+static const uint16_t msg_sizes[] = {16, 64, 128, 256, 512, 1024};
+
+static K_SEM_DEFINE(bound_sem, 0, 1);
+static K_SEM_DEFINE(reply_sem, 0, 1);
+
+static uint8_t tx_msg[BENCH_MSG_MAX];
+static uint8_t rx_msg[BENCH_MSG_MAX];
+static bool rx_copy;
+static size_t rx_len;
+
+static void ep_bound(void *priv)
+{
+	k_sem_give(&bound_sem);
+	LOG_INF("Ep bounded");
+}
+
+static void ep_recv(const void *data, size_t len, void *priv)
+{
+	/* Without no-copy the reply is copied out of the callback */
+	if (rx_copy) {
+		memcpy(rx_msg, data, MIN(len, sizeof(rx_msg)));
+	}
+
+	rx_len = len;
+	k_sem_give(&reply_sem);
+}
+
+static struct ipc_ept_cfg ep_cfg = {
+	.name = "bench",
+	.cb = {
+		.bound    = ep_bound,
+		.received = ep_recv,
+	},
+};
+
+/* Sends a message, retrying while the backend is out of TX buffers. */
+static int bench_send(struct ipc_ept *ep, uint8_t op, size_t len, bool nocopy)
+{
+	uint8_t *msg;
+	uint32_t size;
+	int ret;
+
+	while (true) {
+		if (nocopy) {
+			size = len;
+			ret = ipc_service_get_tx_buffer(ep, (void **)&msg, &size, K_NO_WAIT);
+			if (ret == 0) {
+				msg[0] = op;
+				memset(&msg[1], 0xa5, len - 1);
+				ret = ipc_service_send_nocopy(ep, msg, len);
+			}
+		} else {
+			tx_msg[0] = op;
+			memset(&tx_msg[1], 0xa5, len - 1);
+			ret = ipc_service_send(ep, tx_msg, len);
+		}
+
+		if (ret != -ENOMEM && ret != -ENOBUFS) {
+			return MIN(ret, 0);
+		}
+
+		k_yield();
+	}
+}
+
+static int bench_round_trip(struct ipc_ept *ep, size_t len, bool nocopy, uint32_t *avg_ns)
+{
+	uint64_t cycles = 0;
+	uint32_t start;
+	int ret;
+
+	rx_copy = !nocopy;
+
+	for (int i = 0; i < ROUND_TRIPS; i++) {
+		start = k_cycle_get_32();
+
+		ret = bench_send(ep, nocopy ? BENCH_OP_ECHO_NOCOPY : BENCH_OP_ECHO, len, nocopy);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (k_sem_take(&reply_sem, REPLY_TIMEOUT) != 0) {
+			return -ETIMEDOUT;
+		}
+
+		cycles += k_cycle_get_32() - start;
+
+		if (rx_len != len) {
+			return -EBADMSG;
+		}
+	}
+
+	*avg_ns = k_cyc_to_ns_floor64(cycles) / ROUND_TRIPS;
+
+	return 0;
+}
+
+static int bench_stream(struct ipc_ept *ep, size_t len, bool nocopy, uint32_t *kbps)
+{
+	size_t count = STREAM_BYTES / len;
+	uint64_t ns;
+	uint32_t start;
+	int ret;
+
+	rx_copy = false;
+	start = k_cycle_get_32();
+
+	for (size_t i = 0; i < count; i++) {
+		ret = bench_send(ep, i == count - 1 ? BENCH_OP_SINK_END : BENCH_OP_SINK, len,
+				 nocopy);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* The remote acknowledges the last message once it has received all of them */
+	if (k_sem_take(&reply_sem, REPLY_TIMEOUT) != 0) {
+		return -ETIMEDOUT;
+	}
+
+	ns = MAX(k_cyc_to_ns_floor64(k_cycle_get_32() - start), 1);
+	*kbps = (uint64_t)count * len * NSEC_PER_SEC / 1024 / ns;
+
+	return 0;
+}
+
+int main(void)
+{
+	const struct device *ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+	struct ipc_ept ep;
+	uint32_t avg_ns, kbps;
+	int max_len;
+	int ret;
+
+	LOG_INF("IPC-service benchmark started");
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	if ((ret < 0) && (ret != -EALREADY)) {
+		LOG_ERR("ipc_service_open_instance() failure");
+		return ret;
+	}
+
+	ret = ipc_service_register_endpoint(ipc0_instance, &ep, &ep_cfg);
+	if (ret < 0) {
+		LOG_ERR("ipc_service_register_endpoint() failure");
+		return ret;
+	}
+
+	k_sem_take(&bound_sem, K_FOREVER);
+
+	max_len = ipc_service_get_tx_buffer_size(&ep);
+
+	for (int nocopy = 0; nocopy < 2; nocopy++) {
+		for (size_t i = 0; i < ARRAY_SIZE(msg_sizes); i++) {
+			size_t len = msg_sizes[i];
+
+			if (max_len > 0 && len > (size_t)max_len) {
+				LOG_INF("%-6s %4zu bytes: larger than the TX buffers, skipped",
+					nocopy ? "nocopy" : "copy", len);
+				continue;
+			}
+
+			ret = bench_round_trip(&ep, len, nocopy, &avg_ns);
+			if (ret == 0) {
+				ret = bench_stream(&ep, len, nocopy, &kbps);
+			}
+
+			if (ret < 0) {
+				LOG_ERR("%-6s %4zu bytes: failed (%d)", nocopy ? "nocopy" : "copy",
+					len, ret);
+				continue;
+			}
+
+			LOG_INF("%-6s %4zu bytes: round trip %u ns, throughput %u kB/s",
+				nocopy ? "nocopy" : "copy", len, avg_ns, kbps);
+		}
+	}
+
+	LOG_INF("IPC-service benchmark ended");
+
+	return 0;
+}
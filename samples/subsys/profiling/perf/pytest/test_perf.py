@@ -37,3 +37,21 @@ def test_shell_perf(dut: DeviceAdapter, shell: Shell):
     while i < length:
         i += int(lines[i], 16) + 1
         assert i <= length, 'one of the samples is not true to size'
+
+
+def test_shell_perf_stream(dut: DeviceAdapter, shell: Shell):
+
+    shell.base_timeout=10
+
+    logger.info('send "perf stream 99" command')
+    lines = shell.exec_command('perf stream 99')
+    assert 'Enabled perf stream' in lines, 'expected response not found'
+    lines = dut.readlines_until(regex=r'.*perf( [0-9a-f]+)+', print_output=True)
+
+    logger.info('send "perf stop" command')
+    shell.exec_command('perf stop')
+    lines = dut.readlines_until(regex='.*Perf stream done!', print_output=True)
+
+    samples = [line for line in lines if re.search(r'perf( [0-9a-f]+)+\s*$', line)]
+    assert len(samples) != 0, 'no sample streamed'
+    logger.info('response is valid')
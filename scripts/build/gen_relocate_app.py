@@ -35,6 +35,9 @@ Configuration that needs to be sent to the python script.
   code_relocation.c or not
 - NOKEEP will suppress the default behavior of marking every relocated symbol
   with KEEP() in the generated linker script.
+- FUNCTIONS=<func_1>,<func_2>... restricts the relocation to the code
+  sections of the given functions. The files must be built with
+  -ffunction-sections.
 
 Multiple regions can be appended together like SRAM2_DATA_BSS
 this will place data and bss inside SRAM2.
@@ -225,12 +228,31 @@ def region_is_default_ram(region_name: str) -> bool:
     return region_name == args.default_ram_region
 
 
-def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
+def section_of_functions(section_name: str, functions: 'list[str]') -> bool:
+    """
+    Whether the section holds the code of one of the given functions.
+
+    >>> section_of_functions(".text.k_sem_give", ["k_sem_give"])
+    True
+    >>> section_of_functions(".text.unlikely.k_sem_give", ["k_sem_give"])
+    True
+    >>> section_of_functions(".rodata.k_sem_give", ["k_sem_give"])
+    False
+    """
+    if SectionKind.for_section_named(section_name) not in (SectionKind.TEXT, SectionKind.LITERAL):
+        return False
+
+    return any(section_name.endswith("." + func) for func in functions)
+
+
+def find_sections(filename: str, functions: 'list[str] | None' = None
+                  ) -> 'dict[SectionKind, list[OutputSection]]':
     """
     Locate relocatable sections in the given object file.
 
     The output value maps categories of sections to the list of actual sections
-    located in the object file that fit in that category.
+    located in the object file that fit in that category. If functions are
+    given, only their code sections are located.
     """
     obj_file_path = Path(filename)
 
@@ -247,6 +269,9 @@ def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
             if section_kind is None:
                 continue
 
+            if functions is not None and not section_of_functions(section.name, functions):
+                continue
+
             out[section_kind].append(
                 OutputSection(obj_file_path.name, section.name)
             )
@@ -519,7 +544,8 @@ def parse_input_string(line):
     return mem_region, phdr, flag_list, file_list
 
 
-# Create a dict with key as memory type and files as a list of values.
+# Create a dict with key as memory type and a list of (file, functions) as
+# values, functions being None when the whole file is relocated.
 # Also, return another dict with program headers for memory regions
 def create_dict_wrt_mem():
     # need to support wild card *
@@ -535,6 +561,12 @@ def create_dict_wrt_mem():
 
         mem_region, phdr, flag_list, file_list = parse_input_string(line)
 
+        functions = None
+        for flag in flag_list:
+            if flag.startswith("FUNCTIONS="):
+                functions = flag.split("=", 1)[1].split(",")
+        flag_list = [flag for flag in flag_list if not flag.startswith("FUNCTIONS=")]
+
         # Handle any program header
         if phdr != '':
             phdrs[mem_region] = f':{phdr}'
@@ -555,13 +587,13 @@ def create_dict_wrt_mem():
             continue
         if args.verbose:
             print("Memory region ", mem_region, " Selected for files:", file_name_list)
+            if functions is not None:
+                print("Functions selected:", functions)
 
         mem_region = "|".join((mem_region, *flag_list))
 
-        if mem_region in rel_dict:
-            rel_dict[mem_region].extend(file_name_list)
-        else:
-            rel_dict[mem_region] = file_name_list
+        rel_dict.setdefault(mem_region, []).extend(
+            (file_name, functions) for file_name in file_name_list)
 
     return rel_dict, phdrs
 
@@ -585,13 +617,13 @@ def main():
     for memory_type, files in rel_dict.items():
         full_list_of_sections: 'dict[SectionKind, list[OutputSection]]' = defaultdict(list)
 
-        for filename in files:
+        for filename, functions in files:
             obj_filename = get_obj_filename(searchpath, filename)
             # the obj file wasn't found. Probably not compiled.
             if not obj_filename:
                 continue
 
-            file_sections = find_sections(obj_filename)
+            file_sections = find_sections(obj_filename, functions)
             # Merge sections from file into collection of sections for all files
             for category, sections in file_sections.items():
                 full_list_of_sections[category].extend(sections)
@@ -4,6 +4,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0
 
+import io
 import logging
 import struct
 
@@ -14,6 +15,10 @@ COREDUMP_HDR_VER = 2
 LOG_HDR_STRUCT = "<ccHHBBI"
 LOG_HDR_SIZE = struct.calcsize(LOG_HDR_STRUCT)
 
+COREDUMP_HDR_FLAG_COMPRESSED = 0x01
+LOG_COMPRESS_BLK_HDR_STRUCT = "<HH"
+LOG_COMPRESS_BLK_HDR_SIZE = struct.calcsize(LOG_COMPRESS_BLK_HDR_STRUCT)
+
 COREDUMP_ARCH_HDR_ID = b'A'
 LOG_ARCH_HDR_STRUCT = "<cHH"
 LOG_ARCH_HDR_SIZE = struct.calcsize(LOG_ARCH_HDR_STRUCT)
@@ -49,6 +54,60 @@ def reason_string(reason):
     return ret
 
 
+def lz4_block_decompress(src, raw_len):
+    """
+    Decompress one LZ4 block as produced by coredump_compress.c.
+    """
+    dst = bytearray()
+    idx = 0
+
+    while idx < len(src):
+        token = src[idx]
+        idx += 1
+
+        lit_len = token >> 4
+        if lit_len == 15:
+            while True:
+                val = src[idx]
+                idx += 1
+                lit_len += val
+                if val != 255:
+                    break
+
+        dst += src[idx:idx + lit_len]
+        idx += lit_len
+
+        if idx >= len(src):
+            # Last sequence has literals only
+            break
+
+        offset = src[idx] | (src[idx + 1] << 8)
+        idx += 2
+
+        match_len = token & 0xf
+        if match_len == 15:
+            while True:
+                val = src[idx]
+                idx += 1
+                match_len += val
+                if val != 255:
+                    break
+        match_len += 4
+
+        if offset == 0 or offset > len(dst):
+            raise ValueError(f"Invalid match offset {offset}")
+
+        # Matches may overlap the bytes they produce
+        start = len(dst) - offset
+        for i in range(match_len):
+            dst.append(dst[start + i])
+
+    if len(dst) != raw_len:
+        raise ValueError(f"Decompressed {len(dst)} bytes, expected {raw_len}")
+
+    return bytes(dst)
+
+
 class CoredumpLogFile:
     """
     Process the binary coredump file for register block
@@ -78,6 +137,47 @@ class CoredumpLogFile:
     def get_threads_metadata(self):
         return self.threads_metadata
 
+    def decompress(self):
+        data = bytearray()
+
+        while True:
+            hdr = self.fd.read(LOG_COMPRESS_BLK_HDR_SIZE)
+            if not hdr:
+                break
+
+            if len(hdr) != LOG_COMPRESS_BLK_HDR_SIZE:
+                logger.error("Truncated compressed block header")
+                return False
+
+            raw_len, comp_len = struct.unpack(LOG_COMPRESS_BLK_HDR_STRUCT, hdr)
+
+            if comp_len == 0:
+                block = self.fd.read(raw_len)
+                if len(block) != raw_len:
+                    logger.error("Truncated stored block")
+                    return False
+                data += block
+                continue
+
+            block = self.fd.read(comp_len)
+            if len(block) != comp_len:
+                logger.error("Truncated compressed block")
+                return False
+
+            try:
+                data += lz4_block_decompress(block, raw_len)
+            except (IndexError, ValueError) as e:
+                logger.error(f"Cannot decompress block: {e}")
+                return False
+
+        logger.info(f"Decompressed coredump to {len(data)} bytes")
+
+        # Parse the sections from the decompressed stream from here on
+        self.fd.close()
+        self.fd = io.BytesIO(bytes(data))
+
+        return True
+
     def parse_arch_section(self):
         hdr = self.fd.read(LOG_ARCH_HDR_SIZE)
         _, hdr_ver, num_bytes = struct.unpack(LOG_ARCH_HDR_STRUCT, hdr)
@@ -159,7 +259,14 @@ class CoredumpLogFile:
         logger.info("Reason: {0}".format(reason_string(reason)))
         logger.info(f"Pointer size {ptr_size}")
 
-        del id1, id2, hdr_ver, tgt_code, ptr_size, flags, reason
+        del id1, id2, hdr_ver, tgt_code, ptr_size, reason
+
+        if flags & COREDUMP_HDR_FLAG_COMPRESSED:
+            if not self.decompress():
+                logger.error("Cannot decompress coredump")
+                return False
+
+        del flags
 
         while True:
             section_id = self.fd.read(1)
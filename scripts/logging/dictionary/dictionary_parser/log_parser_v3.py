@@ -55,6 +55,7 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -63,6 +64,29 @@ FMT_DROPPED_CNT = "H"
 logger = logging.getLogger("parser")
 
 
+def get_varint(logdata, offset):
+    """Decode an unsigned LEB128 varint, return it with the offset after it"""
+    val = 0
+    shift = 0
+
+    while True:
+        one_byte = logdata[offset]
+        offset += 1
+
+        val |= (one_byte & 0x7F) << shift
+        shift += 7
+
+        if (one_byte & 0x80) == 0:
+            return val, offset
+
+
+def get_svarint(logdata, offset):
+    """Decode a zigzag encoded signed varint"""
+    val, offset = get_varint(logdata, offset)
+
+    return (val >> 1) ^ -(val & 1), offset
+
+
 class LogParserV3(LogParser):
     """Log Parser V1"""
     def __init__(self, database):
@@ -88,6 +112,15 @@ class LogParserV3(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        # Compact messages: words of packages and previous values of
+        # the fields encoded as differences
+        self.fmt_word = endian + "I"
+        self.fmt_ptr = self.data_types.get_formatter(DataTypes.PTR)
+        self.ptr_mask = (1 << (self.data_types.get_sizeof(DataTypes.PTR) * 8)) - 1
+        self.timestamp_mask = (1 << (struct.calcsize(self.fmt_msg_timestamp) * 8)) - 1
+        self.prev_timestamp = 0
+        self.prev_fmt_ptr = 0
+
 
     def __get_string(self, arg, arg_offset, string_tbl):
         one_str = self.database.find_string(arg)
@@ -282,37 +315,103 @@ class LogParserV3(LogParser):
             domain_id = domain_lvl & 0x0F
             level = (domain_lvl >> 4) & 0x0F
 
+        # Skip over data to point to next message (save as return value)
+        next_msg_offset = offset + pkg_len + data_len
+
+        package = logdata[offset:(offset + pkg_len)]
+
+        # Extra data after packaged log
+        extra_data = logdata[(offset + pkg_len):next_msg_offset]
+
+        if not self.print_one_msg(domain_id, level, source_id, timestamp, package, extra_data):
+            return None
+
+        # Point to next message
+        return next_msg_offset
+
+
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        domain_lvl = logdata[offset]
+        offset += 1
+
+        domain_id = domain_lvl & 0x0F
+        level = (domain_lvl >> 4) & 0x0F
+
+        source_id, offset = get_varint(logdata, offset)
+
+        delta, offset = get_svarint(logdata, offset)
+        self.prev_timestamp = (self.prev_timestamp + delta) & self.timestamp_mask
+        timestamp = self.prev_timestamp
+
+        pkg_len, offset = get_varint(logdata, offset)
+        data_len, offset = get_varint(logdata, offset)
+
+        # Rebuild the package as it was on the target
+        package = b''
+        if pkg_len > 0:
+            args_end = min(logdata[offset] * self.data_types.get_sizeof(DataTypes.INT),
+                           pkg_len)
+            fmt_offset = self.data_types.get_sizeof(DataTypes.PTR)
+            ptr_size = self.data_types.get_sizeof(DataTypes.PTR)
+
+            package = logdata[offset:(offset + 4)]
+            offset += 4
+
+            while len(package) + 4 <= args_end:
+                if len(package) == fmt_offset and len(package) + ptr_size <= args_end:
+                    delta, offset = get_svarint(logdata, offset)
+                    self.prev_fmt_ptr = (self.prev_fmt_ptr + delta) & self.ptr_mask
+                    package += struct.pack(self.fmt_ptr, self.prev_fmt_ptr)
+                else:
+                    word, offset = get_varint(logdata, offset)
+                    package += struct.pack(self.fmt_word, word)
+
+            # String indexes and appended strings
+            tail_len = pkg_len - len(package)
+            package += logdata[offset:(offset + tail_len)]
+            offset += tail_len
+
+        extra_data = logdata[offset:(offset + data_len)]
+        offset += data_len
+
+        if not self.print_one_msg(domain_id, level, source_id, timestamp, package, extra_data):
+            return None
+
+        # Point to next message
+        return offset
+
+
+    def print_one_msg(self, domain_id, level, source_id, timestamp, package, extra_data):
+        """Print one log message from its fields and package"""
         level_str, color = get_log_level_str_color(level)
         source_id_str = self.database.get_log_source_string(domain_id, source_id)
 
-        # Skip over data to point to next message (save as return value)
-        next_msg_offset = offset + pkg_len + data_len
+        pkg_len = len(package)
+        offset = 0
 
         # Offset from beginning of cbprintf_packaged data to end of va_list arguments
-        offset_end_of_args = struct.unpack_from("B", logdata, offset)[0]
+        offset_end_of_args = struct.unpack_from("B", package, offset)[0]
         offset_end_of_args *= self.data_types.get_sizeof(DataTypes.INT)
         offset_end_of_args += offset
 
-        # Extra data after packaged log
-        extra_data = logdata[(offset + pkg_len):next_msg_offset]
-
         # Number of appended strings in package
-        num_packed_strings = struct.unpack_from("B", logdata, offset+1)[0]
+        num_packed_strings = struct.unpack_from("B", package, offset+1)[0]
 
         # Number of read-only string indexes
-        num_ro_str_indexes = struct.unpack_from("B", logdata, offset+2)[0]
+        num_ro_str_indexes = struct.unpack_from("B", package, offset+2)[0]
         offset_end_of_args += num_ro_str_indexes
 
         # Number of read-write string indexes
-        num_rw_str_indexes = struct.unpack_from("B", logdata, offset+3)[0]
+        num_rw_str_indexes = struct.unpack_from("B", package, offset+3)[0]
         offset_end_of_args += num_rw_str_indexes
 
         # Extract the string table in the packaged log message
-        string_tbl = self.extract_string_table(logdata[offset_end_of_args:(offset + pkg_len)])
+        string_tbl = self.extract_string_table(package[offset_end_of_args:(offset + pkg_len)])
 
         if len(string_tbl) != num_packed_strings:
             logger.error("------ Error extracting string table")
-            return None
+            return False
 
         # Skip packaged string header
         offset += self.data_types.get_sizeof(DataTypes.PTR)
@@ -324,7 +423,7 @@ class LogParserV3(LogParser):
         # itself is before the va_list, so need to go back the width of
         # a pointer.
         fmt_str_ptr = struct.unpack_from(self.data_types.get_formatter(DataTypes.PTR),
-                                         logdata, offset)[0]
+                                         package, offset)[0]
         fmt_str = self.__get_string(fmt_str_ptr,
                                     -self.data_types.get_sizeof(DataTypes.PTR),
                                     string_tbl)
@@ -332,9 +431,9 @@ class LogParserV3(LogParser):
 
         if not fmt_str:
             logger.error("------ Error getting format string at 0x%x", fmt_str_ptr)
-            return None
+            return False
 
-        args = self.process_one_fmt_str(fmt_str, logdata[offset:offset_end_of_args], string_tbl)
+        args = self.process_one_fmt_str(fmt_str, package[offset:offset_end_of_args], string_tbl)
 
         fmt_str = formalize_fmt_string(fmt_str)
         log_msg = fmt_str % args
@@ -346,12 +445,11 @@ class LogParserV3(LogParser):
             log_prefix = f"[{timestamp:>10}] <{level_str}> {source_id_str}: "
             print(f"{color}%s%s{Fore.RESET}" % (log_prefix, log_msg))
 
-        if data_len > 0:
+        if len(extra_data) > 0:
             # Has hexdump data
             self.print_hexdump(extra_data, len(log_prefix), color)
 
-        # Point to next message
-        return next_msg_offset
+        return True
 
 
     def parse_log_data(self, logdata, debug=False):
@@ -376,6 +474,13 @@ class LogParserV3(LogParser):
 
                 offset = ret
 
+            elif msg_type == MSG_TYPE_NORMAL_COMPACT:
+                ret = self.parse_one_compact_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                offset = ret
+
             else:
                 logger.error("------ Unknown message type: %s", msg_type)
                 return False
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Select hot functions for code relocation
+
+This reads stack samples captured by the perf subsystem, counts the samples
+hitting each function of the ELF file, and writes zephyr_code_relocate()
+calls moving the most sampled functions into a faster memory, such as ITCM,
+within a size budget.
+
+Usage:
+    ./scripts/profiling/hot_relocate.py <perf capture> <ELF file> \\
+        --location ITCM_TEXT --budget 16384 -o hot_functions.cmake
+
+The perf capture is the output of "perf printbuf", or of "perf stream". The
+ELF file must be built with debug information, which maps the functions to
+their source files. The generated file is then included from the
+application CMakeLists.txt, with CONFIG_CODE_DATA_RELOCATION enabled:
+
+    include(${CMAKE_CURRENT_SOURCE_DIR}/hot_functions.cmake)
+
+Functions called before code relocation takes place, or while the relocated
+memory is not accessible, must be excluded with --exclude.
+"""
+
+import argparse
+import binascii
+import bisect
+import os
+import re
+import sys
+from collections import Counter, defaultdict
+
+from elftools.elf.elffile import ELFFile
+
+from stackcollapse import parse_buf, parse_stream
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter, allow_abbrev=False)
+    parser.add_argument("capture", help="perf printbuf or stream output")
+    parser.add_argument("elf", help="ELF file the samples were captured with")
+    parser.add_argument("-l", "--location", default="ITCM_TEXT",
+                        help="zephyr_code_relocate() LOCATION (default: %(default)s)")
+    parser.add_argument("-b", "--budget", type=int, required=True,
+                        help="size budget in bytes")
+    parser.add_argument("-e", "--exclude", action="append", default=[],
+                        help="regular expression of functions not to relocate, "
+                             "can be given several times")
+    parser.add_argument("-m", "--min-samples", type=int, default=1,
+                        help="minimum number of samples of a function (default: %(default)s)")
+    parser.add_argument("-o", "--output", required=True, help="output CMake file")
+    return parser.parse_args()
+
+
+def read_samples(path):
+    with open(path, "r") as f:
+        lines = f.read().splitlines()
+
+    match = re.match(r"Perf buf length (\d+)", lines[0])
+    if match:
+        buf = binascii.unhexlify("".join(lines[1:]))
+        return list(parse_buf(buf))
+
+    return list(parse_stream(lines))
+
+
+class FunctionTable:
+    """Address to function lookup, with the size of each function."""
+
+    def __init__(self, elf):
+        # Thumb function symbols have the lowest address bit set
+        addr_mask = ~1 if elf["e_machine"] == "EM_ARM" else ~0
+        funcs = []
+
+        for sym in elf.get_section_by_name(".symtab").iter_symbols():
+            if sym.entry.st_info.type != "STT_FUNC" or sym.entry.st_size == 0:
+                continue
+            start = sym.entry.st_value & addr_mask
+            funcs.append((start, start + sym.entry.st_size, sym.name))
+
+        funcs.sort()
+        self.starts = [f[0] for f in funcs]
+        self.funcs = funcs
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i >= 0 and self.funcs[i][0] <= addr < self.funcs[i][1]:
+            return self.funcs[i]
+        return None
+
+
+def source_files(elf):
+    """Map of compilation unit address ranges to source file paths."""
+    dwarf = elf.get_dwarf_info()
+    aranges = dwarf.get_aranges()
+    if aranges is None:
+        sys.exit("No .debug_aranges in the ELF file, enable CONFIG_DEBUG_INFO")
+
+    files = {}
+    for cu in dwarf.iter_CUs():
+        die = cu.get_top_DIE()
+        name = die.attributes.get("DW_AT_name")
+        if name is None:
+            continue
+        name = name.value.decode()
+        comp_dir = die.attributes.get("DW_AT_comp_dir")
+        if comp_dir is not None and not os.path.isabs(name):
+            name = os.path.join(comp_dir.value.decode(), name)
+        files[cu.cu_offset] = os.path.normpath(name)
+
+    def lookup(addr):
+        offset = aranges.cu_offset_at_addr(addr)
+        return files.get(offset) if offset is not None else None
+
+    return lookup
+
+
+def main():
+    args = parse_args()
+    excludes = [re.compile(e) for e in args.exclude]
+
+    with open(args.elf, "rb") as f:
+        elf = ELFFile(f)
+        table = FunctionTable(elf)
+        file_of = source_files(elf)
+
+        samples = read_samples(args.capture)
+        if not samples:
+            sys.exit("No samples in " + args.capture)
+
+        # The first address of a sample is where the CPU was interrupted
+        hits = Counter()
+        for addrs in samples:
+            func = table.lookup(addrs[0])
+            if func is not None:
+                hits[func] += 1
+
+        selected = defaultdict(list)
+        used = 0
+        covered = 0
+        print(f"{'samples':>8} {'size':>6}  function", file=sys.stderr)
+
+        for func, count in hits.most_common():
+            start, end, name = func
+            size = end - start
+
+            if count < args.min_samples:
+                break
+            if any(e.search(name) for e in excludes):
+                continue
+            if used + size > args.budget:
+                continue
+
+            path = file_of(start)
+            if path is None or not path.endswith((".c", ".cpp", ".S")):
+                print(f"skipping {name}: no source file", file=sys.stderr)
+                continue
+
+            selected[path].append(name)
+            used += size
+            covered += count
+            print(f"{count:8} {size:6}  {name}", file=sys.stderr)
+
+    with open(args.output, "w") as out:
+        out.write("# Generated by scripts/profiling/hot_relocate.py, do not edit.\n")
+        out.write(f"# {covered} of {len(samples)} samples in {used} of "
+                  f"{args.budget} bytes.\n\n")
+        for path in sorted(selected):
+            funcs = " ".join(sorted(selected[path]))
+            out.write(f"zephyr_code_relocate(FILES {path} LOCATION {args.location}\n"
+                      f"  FUNCTIONS {funcs})\n")
+
+    print(f"{covered} of {len(samples)} samples ({100 * covered // len(samples)}%) "
+          f"in {used} bytes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
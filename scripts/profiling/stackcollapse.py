@@ -14,6 +14,9 @@ from addresses
 
 Usage:
     ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+
+The input file can also be a capture of perf stream output, where each
+sample is a line of the form "perf <addr> <addr> ...".
 """
 
 import re
@@ -35,12 +38,23 @@ def addr_to_sym(addr, elf):
     return "[unknown]"
 
 
-def collapse(buf, elf):
+def parse_buf(buf):
     while buf:
         count, = struct.unpack_from(">Q", buf)
         assert count > 0
-        addrs = struct.unpack_from(f">{count}Q", buf, 8)
+        yield struct.unpack_from(f">{count}Q", buf, 8)
+        buf = buf[8 + 8 * count:]
+
 
+def parse_stream(lines):
+    for line in lines:
+        match = re.search(r"perf((?: [0-9a-f]+)+)\s*$", line)
+        if match:
+            yield [int(addr, 16) for addr in match.group(1).split()]
+
+
+def collapse(traces, elf):
+    for addrs in traces:
         func_trace = reversed(list(map(lambda a: addr_to_sym(a, elf), addrs)))
         prev_func = next(func_trace)
         line = prev_func
@@ -51,7 +65,6 @@ def collapse(buf, elf):
                 line += ";" + func
 
         print(line, 1)
-        buf = buf[8 + 8 * count:]
 
 
 if __name__ == "__main__":
@@ -60,6 +73,10 @@ if __name__ == "__main__":
         inp = f.read()
 
     lines = inp.splitlines()
-    assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
-    buf = binascii.unhexlify("".join(lines[1:]))
-    collapse(buf, elf)
+    match = re.match(r"Perf buf length (\d+)", lines[0])
+    if match:
+        assert int(match.group(1)) == len(lines) - 1
+        buf = binascii.unhexlify("".join(lines[1:]))
+        collapse(parse_buf(buf), elf)
+    else:
+        collapse(parse_stream(lines), elf)
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/audio/pipeline.h>
+#include <zephyr/sys/time_units.h>
+#include <zephyr/logging/log.h>
+
+#ifdef CONFIG_I2S
+#include <zephyr/drivers/i2s.h>
+#endif
+
+LOG_MODULE_REGISTER(audio_pipeline, CONFIG_AUDIO_PIPELINE_LOG_LEVEL);
+
+static void block_free(struct audio_block *block)
+{
+	if (block->data != NULL) {
+		k_mem_slab_free(block->slab, block->data);
+		block->data = NULL;
+	}
+}
+
+static int stage_run(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	struct audio_pipeline_stage_stats *stats = &stage->stats;
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+	int err;
+
+	err = stage->fn(stage, block);
+
+	cycles = k_cycle_get_32() - start;
+	stats->last_cycles = cycles;
+	stats->max_cycles = MAX(stats->max_cycles, cycles);
+	stats->total_cycles += cycles;
+	stats->blocks++;
+
+	if (err != 0) {
+		stats->errors++;
+		LOG_DBG("%s: block dropped (%d)", stage->name, err);
+	}
+
+	return err;
+}
+
+int audio_pipeline_prime(struct audio_pipeline *pipeline, struct k_mem_slab *slab, size_t size)
+{
+	struct audio_block block;
+	int err;
+
+	for (int i = 0; i < pipeline->depth; i++) {
+		block.slab = slab;
+		block.size = size;
+		block.timestamp = k_cycle_get_32();
+
+		if (k_mem_slab_alloc(slab, &block.data, K_NO_WAIT) != 0) {
+			return -ENOMEM;
+		}
+
+		memset(block.data, 0, size);
+
+		err = pipeline->sink->fn(pipeline->sink, &block);
+		block_free(&block);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+int audio_pipeline_process(struct audio_pipeline *pipeline)
+{
+	struct audio_pipeline_stats *stats = &pipeline->stats;
+	struct audio_block block = { 0 };
+	uint32_t latency_us;
+	int err;
+
+	err = stage_run(pipeline->source, &block);
+	if (err != 0) {
+		goto drop;
+	}
+
+	block.timestamp = k_cycle_get_32();
+
+	for (size_t i = 0; i < pipeline->num_stages; i++) {
+		err = stage_run(pipeline->stages[i], &block);
+		if (err != 0) {
+			goto drop;
+		}
+	}
+
+	/*
+	 * The first sample was captured one block earlier, and the block is
+	 * played after the blocks already queued at the sink.
+	 */
+	latency_us = k_cyc_to_us_ceil32(k_cycle_get_32() - block.timestamp) +
+		     (pipeline->depth + 1U) * pipeline->block_us;
+
+	err = stage_run(pipeline->sink, &block);
+	if (err != 0) {
+		goto drop;
+	}
+
+	/* The sink did not keep the block */
+	block_free(&block);
+
+	stats->last_us = latency_us;
+	stats->max_us = MAX(stats->max_us, latency_us);
+	stats->blocks++;
+
+	return 0;
+
+drop:
+	block_free(&block);
+	stats->dropped++;
+
+	return err;
+}
+
+void audio_pipeline_stats_reset(struct audio_pipeline *pipeline)
+{
+	memset(&pipeline->source->stats, 0, sizeof(pipeline->source->stats));
+	memset(&pipeline->sink->stats, 0, sizeof(pipeline->sink->stats));
+
+	for (size_t i = 0; i < pipeline->num_stages; i++) {
+		memset(&pipeline->stages[i]->stats, 0, sizeof(pipeline->stages[i]->stats));
+	}
+
+	memset(&pipeline->stats, 0, sizeof(pipeline->stats));
+}
+
+#ifdef CONFIG_I2S
+int audio_pipeline_i2s_source(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	const struct device *dev = stage->user_data;
+	const struct i2s_config *cfg;
+	int err;
+
+	cfg = i2s_config_get(dev, I2S_DIR_RX);
+	if (cfg == NULL) {
+		return -EIO;
+	}
+
+	err = i2s_read(dev, &block->data, &block->size);
+	if (err != 0) {
+		block->data = NULL;
+		return err;
+	}
+
+	block->slab = cfg->mem_slab;
+
+	return 0;
+}
+
+int audio_pipeline_i2s_sink(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	const struct device *dev = stage->user_data;
+	const struct i2s_config *cfg;
+	void *tx_block;
+	int err;
+
+	cfg = i2s_config_get(dev, I2S_DIR_TX);
+	if (cfg == NULL) {
+		return -EIO;
+	}
+
+	if (block->slab != cfg->mem_slab) {
+		if (block->size > cfg->block_size) {
+			return -EMSGSIZE;
+		}
+
+		err = k_mem_slab_alloc(cfg->mem_slab, &tx_block, SYS_TIMEOUT_MS(cfg->timeout));
+		if (err != 0) {
+			return err;
+		}
+
+		memcpy(tx_block, block->data, block->size);
+		block_free(block);
+		block->data = tx_block;
+		block->slab = cfg->mem_slab;
+	}
+
+	err = i2s_write(dev, block->data, block->size);
+	if (err == 0) {
+		/* Freed by the driver once sent */
+		block->data = NULL;
+	}
+
+	return err;
+}
+#endif /* CONFIG_I2S */
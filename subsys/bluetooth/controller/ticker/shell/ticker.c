@@ -122,10 +122,63 @@ int cmd_ticker_info(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+static void print_hist(const struct shell *sh, const char *name,
+		       const uint32_t *hist)
+{
+	shell_print(sh, "  %-8s %6u %6u %6u %6u %6u %6u %6u %6u", name,
+		    hist[0], hist[1], hist[2], hist[3], hist[4], hist[5],
+		    hist[6], hist[7]);
+}
+
+static int cmd_ticker_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct ticker_stats stats;
+	uint8_t i;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset")) {
+			shell_help(sh);
+			return -EINVAL;
+		}
+
+		ticker_stats_reset(0);
+
+		return 0;
+	}
+
+	shell_print(sh, "Histogram buckets: 0, 1, 2-3, 4-7, ... %u+ ticks",
+		    1U << (TICKER_STATS_BUCKETS - 2));
+
+	for (i = 0U; i < CONFIG_BT_TICKER_STATS_NODES; i++) {
+		if (ticker_stats_get(0, i, &stats) != TICKER_STATUS_SUCCESS) {
+			break;
+		}
+
+		if (!stats.expire && !stats.skip && !stats.must_expire_skip) {
+			continue;
+		}
+
+		shell_print(sh, "%03u expire %u skip %u must_expire_skip %u "
+			    "exec_max %uus latency_max %uus", i, stats.expire,
+			    stats.skip, stats.must_expire_skip,
+			    HAL_TICKER_TICKS_TO_US(stats.exec_max),
+			    HAL_TICKER_TICKS_TO_US(stats.latency_max));
+		print_hist(sh, "exec", stats.exec);
+		print_hist(sh, "latency", stats.latency);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 #define HELP_NONE "[none]"
 
 SHELL_STATIC_SUBCMD_SET_CREATE(ticker_cmds,
 	SHELL_CMD_ARG(info, NULL, HELP_NONE, cmd_ticker_info, 1, 0),
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+	SHELL_CMD_ARG(stats, NULL, "[reset]", cmd_ticker_stats, 1, 1),
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
 	SHELL_SUBCMD_SET_END
 );
 
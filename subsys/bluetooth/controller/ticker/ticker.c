@@ -334,6 +334,13 @@ struct ticker_instance {
 	bool expire_infos_outdated;
 #endif /* CONFIG_BT_TICKER_EXT_EXPIRE_INFO */
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+	struct ticker_stats stats[CONFIG_BT_TICKER_STATS_NODES]; /* Timing
+								  * statistics
+								  * per node
+								  */
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 	ticker_caller_id_get_cb_t caller_id_get_cb; /* Function for retrieving
 						     * the caller id from user
 						     * id
@@ -1237,6 +1244,89 @@ static void ticker_job_update_expire_infos(struct ticker_instance *instance)
 
 #endif /* CONFIG_BT_TICKER_EXT_EXPIRE_INFO */
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+/**
+ * @brief Get timing statistics of a ticker node
+ *
+ * @param instance Pointer to ticker instance
+ * @param ticker   Pointer to ticker node
+ *
+ * @return Pointer to the statistics, or NULL if the node is not instrumented
+ * @internal
+ */
+static struct ticker_stats *ticker_stats_node_get(struct ticker_instance *instance,
+						  struct ticker_node *ticker)
+{
+	uint8_t ticker_id = ticker - instance->nodes;
+
+	if (ticker_id >= CONFIG_BT_TICKER_STATS_NODES) {
+		return NULL;
+	}
+
+	return &instance->stats[ticker_id];
+}
+
+/**
+ * @brief Add a value to a statistics histogram
+ *
+ * @param hist  Pointer to histogram of TICKER_STATS_BUCKETS buckets
+ * @param ticks Value in ticks
+ *
+ * @internal
+ */
+static void ticker_stats_hist_add(uint32_t *hist, uint32_t ticks)
+{
+	uint8_t bucket = 0U;
+
+	while (ticks && (bucket < (TICKER_STATS_BUCKETS - 1U))) {
+		ticks >>= 1;
+		bucket++;
+	}
+
+	hist[bucket]++;
+}
+
+/**
+ * @brief Record a timeout callback invocation
+ *
+ * @param instance        Pointer to ticker instance
+ * @param ticker          Pointer to ticker node
+ * @param ticks_at_expire Scheduled expiry of the node
+ * @param ticks_start     Counter value when the callback was invoked
+ * @param must_expire_skip Non-zero for a shallow must-expire invocation
+ *
+ * @internal
+ */
+static void ticker_stats_expire(struct ticker_instance *instance,
+				struct ticker_node *ticker,
+				uint32_t ticks_at_expire, uint32_t ticks_start,
+				uint8_t must_expire_skip)
+{
+	struct ticker_stats *stats;
+	uint32_t latency;
+	uint32_t exec;
+
+	stats = ticker_stats_node_get(instance, ticker);
+	if (!stats) {
+		return;
+	}
+
+	if (must_expire_skip) {
+		stats->must_expire_skip++;
+		return;
+	}
+
+	latency = ticker_ticks_diff_get(ticks_start, ticks_at_expire);
+	exec = ticker_ticks_diff_get(cntr_cnt_get(), ticks_start);
+
+	stats->expire++;
+	stats->latency_max = MAX(stats->latency_max, latency);
+	stats->exec_max = MAX(stats->exec_max, exec);
+	ticker_stats_hist_add(stats->latency, latency);
+	ticker_stats_hist_add(stats->exec, exec);
+}
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 /**
  * @brief Ticker worker
  *
@@ -1377,6 +1467,16 @@ void ticker_worker(void *param)
 				 * ticker node. Mark it as elapsed.
 				 */
 				ticker->ack--;
+
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+				struct ticker_stats *stats =
+					ticker_stats_node_get(instance, ticker);
+
+				if (stats) {
+					stats->skip++;
+				}
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 				continue;
 			}
 
@@ -1425,6 +1525,10 @@ void ticker_worker(void *param)
 			remainder_current = 0U;
 #endif /* !CONFIG_BT_TICKER_REMAINDER_SUPPORT */
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+			uint32_t ticks_start = cntr_cnt_get();
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 #if defined(CONFIG_BT_TICKER_EXT_EXPIRE_INFO)
 			if (ticker->ext_data &&
 			    ticker->ext_data->ext_timeout_func) {
@@ -1473,6 +1577,11 @@ void ticker_worker(void *param)
 				DEBUG_TICKER_TASK(0);
 			}
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+			ticker_stats_expire(instance, ticker, ticks_at_expire,
+					    ticks_start, must_expire_skip);
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 			if (!IS_ENABLED(CONFIG_BT_TICKER_LOW_LAT) &&
 			   (must_expire_skip == 0U)) {
 				/* Reset latency to periodic offset */
@@ -4153,6 +4262,50 @@ uint8_t ticker_priority_set(uint8_t instance_index, uint8_t user_id, uint8_t tic
 	* CONFIG_BT_TICKER_PRIORITY_SET
 	*/
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+/**
+ * @brief Get timing statistics of a ticker node
+ *
+ * @details The statistics are updated from the ticker worker context, a
+ * caller at lower priority may read a partially updated copy.
+ *
+ * @param instance_index Index of ticker instance
+ * @param ticker_id	 Id of ticker node
+ * @param stats		 Pointer to statistics to fill
+ *
+ * @return TICKER_STATUS_SUCCESS, or TICKER_STATUS_FAILURE if the node is not
+ * instrumented
+ */
+uint8_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+			 struct ticker_stats *stats)
+{
+	struct ticker_instance *instance = &_instance[instance_index];
+
+	if ((ticker_id >= instance->count_node) ||
+	    (ticker_id >= CONFIG_BT_TICKER_STATS_NODES)) {
+		return TICKER_STATUS_FAILURE;
+	}
+
+	*stats = instance->stats[ticker_id];
+
+	return TICKER_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Reset timing statistics of all ticker nodes
+ *
+ * @param instance_index Index of ticker instance
+ */
+void ticker_stats_reset(uint8_t instance_index)
+{
+	struct ticker_instance *instance = &_instance[instance_index];
+
+	for (uint8_t i = 0U; i < CONFIG_BT_TICKER_STATS_NODES; i++) {
+		instance->stats[i] = (struct ticker_stats){ 0 };
+	}
+}
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 /**
  * @brief Schedule ticker job
  *
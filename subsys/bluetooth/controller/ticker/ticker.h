@@ -219,6 +219,34 @@ void ticker_job_sched(uint8_t instance_index, uint8_t user_id);
 uint32_t ticker_ticks_now_get(void);
 uint32_t ticker_ticks_diff_get(uint32_t ticks_now, uint32_t ticks_old);
 
+#if CONFIG_BT_TICKER_STATS_NODES > 0
+/** \brief Number of histogram buckets, bucket n counts values of
+ *  [2^(n-1), 2^n) ticks, bucket 0 counts zero and the last bucket counts
+ *  all larger values.
+ */
+#define TICKER_STATS_BUCKETS 8
+
+struct ticker_stats {
+	uint32_t expire;           /* Timeout callbacks invoked */
+	uint32_t skip;             /* Expiries skipped due to collision */
+	uint32_t must_expire_skip; /* Shallow expiries of must-expire
+				    * nodes skipped due to collision
+				    */
+	uint32_t exec_max;         /* Longest callback execution, ticks */
+	uint32_t latency_max;      /* Largest expiry to callback latency,
+				    * ticks
+				    */
+	uint32_t exec[TICKER_STATS_BUCKETS];    /* Execution time
+						 * histogram
+						 */
+	uint32_t latency[TICKER_STATS_BUCKETS]; /* Latency histogram */
+};
+
+uint8_t ticker_stats_get(uint8_t instance_index, uint8_t ticker_id,
+			 struct ticker_stats *stats);
+void ticker_stats_reset(uint8_t instance_index);
+#endif /* CONFIG_BT_TICKER_STATS_NODES > 0 */
+
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
 uint8_t ticker_priority_set(uint8_t instance_index, uint8_t user_id,
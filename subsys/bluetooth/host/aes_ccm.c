@@ -11,12 +11,91 @@
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/bluetooth/crypto.h>
 
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+#include <psa/crypto.h>
+#elif defined(CONFIG_BT_HOST_CRYPTO)
+#include <tinycrypt/constants.h>
+#include <tinycrypt/aes.h>
+#endif
+
 #include "common/bt_str.h"
 
 #define LOG_LEVEL CONFIG_BT_HCI_CORE_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(bt_aes_ccm);
 
+/* Block cipher keyed once per CCM operation instead of once per block */
+struct ccm_key {
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	psa_key_id_t id;
+#elif defined(CONFIG_BT_HOST_CRYPTO)
+	struct tc_aes_key_sched_struct sched;
+#else
+	const uint8_t *key;
+#endif
+};
+
+static int ccm_key_setup(struct ccm_key *ccm_key, const uint8_t key[16])
+{
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attr, 128);
+	psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&attr, PSA_ALG_ECB_NO_PADDING);
+	if (psa_import_key(&attr, key, 16, &ccm_key->id) != PSA_SUCCESS) {
+		LOG_ERR("Failed to import AES key");
+		return -EINVAL;
+	}
+#elif defined(CONFIG_BT_HOST_CRYPTO)
+	if (tc_aes128_set_encrypt_key(&ccm_key->sched, key) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+#else
+	/* The controller takes the key with every block */
+	ccm_key->key = key;
+#endif
+
+	return 0;
+}
+
+static void ccm_key_release(struct ccm_key *ccm_key)
+{
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	if (psa_destroy_key(ccm_key->id) != PSA_SUCCESS) {
+		LOG_ERR("Failed to destroy AES key");
+	}
+#elif defined(CONFIG_BT_HOST_CRYPTO)
+	(void)memset(&ccm_key->sched, 0, sizeof(ccm_key->sched));
+#else
+	ARG_UNUSED(ccm_key);
+#endif
+}
+
+static int ccm_block(const struct ccm_key *ccm_key, const uint8_t in[16], uint8_t out[16])
+{
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	size_t out_len;
+
+	if (psa_cipher_encrypt(ccm_key->id, PSA_ALG_ECB_NO_PADDING, in, 16, out, 16,
+			       &out_len) != PSA_SUCCESS) {
+		LOG_ERR("AES encryption failed");
+		return -EIO;
+	}
+
+	return 0;
+#elif defined(CONFIG_BT_HOST_CRYPTO)
+	if (tc_aes_encrypt(out, in, &ccm_key->sched) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	return 0;
+#else
+	return bt_encrypt_be(ccm_key->key, in, out);
+#endif
+}
+
 static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 {
 	dst[0] = a[0] ^ b[0];
@@ -38,7 +117,7 @@ static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 }
 
 /* b field is assumed to have the nonce already present in bytes 1-13 */
-static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t aad_len,
+static int ccm_calculate_X0(const struct ccm_key *key, const uint8_t *aad, uint8_t aad_len,
 			    size_t mic_size, uint16_t msg_len, uint8_t b[16],
 			    uint8_t X0[16])
 {
@@ -49,7 +128,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 
 	sys_put_be16(msg_len, b + 14);
 
-	err = bt_encrypt_be(key, b, X0);
+	err = ccm_block(key, b, X0);
 	if (err) {
 		return err;
 	}
@@ -73,7 +152,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 			aad_len -= 16;
 			i = 0;
 
-			err = bt_encrypt_be(key, b, X0);
+			err = ccm_block(key, b, X0);
 			if (err) {
 				return err;
 			}
@@ -87,7 +166,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 			b[i] = X0[i];
 		}
 
-		err = bt_encrypt_be(key, b, X0);
+		err = ccm_block(key, b, X0);
 		if (err) {
 			return err;
 		}
@@ -96,7 +175,7 @@ static int ccm_calculate_X0(const uint8_t key[16], const uint8_t *aad, uint8_t a
 	return 0;
 }
 
-static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
+static int ccm_auth(const struct ccm_key *key, uint8_t nonce[13],
 		    const uint8_t *cleartext_msg, uint16_t msg_len, const uint8_t *aad,
 		    size_t aad_len, uint8_t *mic, size_t mic_size)
 {
@@ -116,12 +195,15 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 	/* S[0] = e(AppKey, 0x01 || nonce || 0x0000) */
 	sys_put_be16(0x0000, &b[14]);
 
-	err = bt_encrypt_be(key, b, s0);
+	err = ccm_block(key, b, s0);
 	if (err) {
 		return err;
 	}
 
-	ccm_calculate_X0(key, aad, aad_len, mic_size, msg_len, b, Xn);
+	err = ccm_calculate_X0(key, aad, aad_len, mic_size, msg_len, b, Xn);
+	if (err) {
+		return err;
+	}
 
 	for (j = 0; j < blk_cnt; j++) {
 		/* X_1 = e(AppKey, X_0 ^ Payload[0-15]) */
@@ -135,7 +217,7 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 			xor16(b, Xn, &cleartext_msg[j * 16]);
 		}
 
-		err = bt_encrypt_be(key, b, Xn);
+		err = ccm_block(key, b, Xn);
 		if (err) {
 			return err;
 		}
@@ -149,7 +231,7 @@ static int ccm_auth(const uint8_t key[16], uint8_t nonce[13],
 	return 0;
 }
 
-static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
+static int ccm_crypt(const struct ccm_key *key, const uint8_t nonce[13],
 		     const uint8_t *in_msg, uint8_t *out_msg, uint16_t msg_len)
 {
 	uint8_t a_i[16], s_i[16];
@@ -170,7 +252,7 @@ static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
 		/* S_1 = e(AppKey, 0x01 || nonce || 0x0001) */
 		sys_put_be16(j + 1, &a_i[14]);
 
-		err = bt_encrypt_be(key, a_i, s_i);
+		err = ccm_block(key, a_i, s_i);
 		if (err) {
 			return err;
 		}
@@ -188,19 +270,87 @@ static int ccm_crypt(const uint8_t key[16], const uint8_t nonce[13],
 	return 0;
 }
 
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+/* Hand the whole message to PSA, which may use an AES-CCM accelerator */
+static int ccm_psa(const uint8_t key[16], const uint8_t nonce[13], const uint8_t *in,
+		   size_t len, const uint8_t *aad, size_t aad_len, uint8_t *out,
+		   size_t mic_size, bool encrypt)
+{
+	psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, mic_size);
+	psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+	psa_status_t status;
+	psa_key_id_t id;
+	size_t out_len;
+
+	psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attr, 128);
+	psa_set_key_usage_flags(&attr, encrypt ? PSA_KEY_USAGE_ENCRYPT : PSA_KEY_USAGE_DECRYPT);
+	psa_set_key_algorithm(&attr, alg);
+	if (psa_import_key(&attr, key, 16, &id) != PSA_SUCCESS) {
+		LOG_ERR("Failed to import AES key");
+		return -EINVAL;
+	}
+
+	if (encrypt) {
+		status = psa_aead_encrypt(id, alg, nonce, 13, aad, aad_len, in, len, out,
+					  len + mic_size, &out_len);
+	} else {
+		status = psa_aead_decrypt(id, alg, nonce, 13, aad, aad_len, in, len + mic_size,
+					  out, len, &out_len);
+	}
+
+	if (psa_destroy_key(id) != PSA_SUCCESS) {
+		LOG_ERR("Failed to destroy AES key");
+	}
+
+	if (status == PSA_ERROR_INVALID_SIGNATURE) {
+		return -EBADMSG;
+	}
+
+	return status == PSA_SUCCESS ? 0 : -EIO;
+}
+
+/* CCM allows even MIC sizes from 4 to 16 octets */
+static bool ccm_psa_supported(size_t mic_size)
+{
+	return mic_size >= 4 && (mic_size % 2) == 0;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO && CONFIG_BT_USE_PSA_API */
+
 int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13],
 		   const uint8_t *enc_data, size_t len, const uint8_t *aad,
 		   size_t aad_len, uint8_t *plaintext, size_t mic_size)
 {
+	struct ccm_key ccm_key;
 	uint8_t mic[16];
+	int err;
 
 	if (aad_len >= 0xff00 || mic_size > sizeof(mic) || len > UINT16_MAX) {
 		return -EINVAL;
 	}
 
-	ccm_crypt(key, nonce, enc_data, plaintext, len);
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	if (ccm_psa_supported(mic_size)) {
+		return ccm_psa(key, nonce, enc_data, len, aad, aad_len, plaintext, mic_size,
+			       false);
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO && CONFIG_BT_USE_PSA_API */
+
+	err = ccm_key_setup(&ccm_key, key);
+	if (err) {
+		return err;
+	}
+
+	err = ccm_crypt(&ccm_key, nonce, enc_data, plaintext, len);
+	if (!err) {
+		err = ccm_auth(&ccm_key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+	}
+
+	ccm_key_release(&ccm_key);
 
-	ccm_auth(key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+	if (err) {
+		return err;
+	}
 
 	if (memcmp(mic, enc_data + len, mic_size)) {
 		return -EBADMSG;
@@ -213,7 +363,9 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
 		   const uint8_t *plaintext, size_t len, const uint8_t *aad,
 		   size_t aad_len, uint8_t *enc_data, size_t mic_size)
 {
+	struct ccm_key ccm_key;
 	uint8_t *mic = enc_data + len;
+	int err;
 
 	LOG_DBG("key %s", bt_hex(key, 16));
 	LOG_DBG("nonce %s", bt_hex(nonce, 13));
@@ -225,9 +377,24 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13],
 		return -EINVAL;
 	}
 
-	ccm_auth(key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+#if defined(CONFIG_BT_HOST_CRYPTO) && defined(CONFIG_BT_USE_PSA_API)
+	if (ccm_psa_supported(mic_size)) {
+		return ccm_psa(key, nonce, plaintext, len, aad, aad_len, enc_data, mic_size,
+			       true);
+	}
+#endif /* CONFIG_BT_HOST_CRYPTO && CONFIG_BT_USE_PSA_API */
+
+	err = ccm_key_setup(&ccm_key, key);
+	if (err) {
+		return err;
+	}
+
+	err = ccm_auth(&ccm_key, nonce, plaintext, len, aad, aad_len, mic, mic_size);
+	if (!err) {
+		err = ccm_crypt(&ccm_key, nonce, plaintext, enc_data, len);
+	}
 
-	ccm_crypt(key, nonce, plaintext, enc_data, len);
+	ccm_key_release(&ccm_key);
 
-	return 0;
+	return err;
 }
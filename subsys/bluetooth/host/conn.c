@@ -802,6 +802,41 @@ static bool acl_has_data(struct bt_conn *conn)
 }
 #endif	/* defined(CONFIG_BT_CONN) */
 
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+/* Sum of the weights of the connections on the `conn_ready` list */
+static atomic_t tx_ready_weight;
+
+static uint8_t conn_tx_weight(struct bt_conn *conn)
+{
+	return conn->tx_weight ? conn->tx_weight : 1U;
+}
+
+/* Number of controller buffers the connection may hold while the other ready
+ * connections also have data: its weighted part of the pool, at least one,
+ * and at most three per weight unit (see `should_stop_tx`).
+ */
+static atomic_val_t conn_tx_share(struct bt_conn *conn)
+{
+	atomic_val_t weight = conn_tx_weight(conn);
+	atomic_val_t total = MAX(atomic_get(&tx_ready_weight), weight);
+	atomic_val_t share = bt_conn_get_pkts(conn)->limit * weight / total;
+
+	return CLAMP(share, 1, 3 * weight);
+}
+
+int bt_conn_set_tx_weight(struct bt_conn *conn, uint8_t weight)
+{
+	if (weight == 0U) {
+		return -EINVAL;
+	}
+
+	/* Applies from the next time the connection becomes ready */
+	conn->tx_weight = weight;
+
+	return 0;
+}
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
+
 /* Connection "Scheduler" of sorts:
  *
  * Will try to get the optimal number of queued buffers for the connection.
@@ -827,6 +862,16 @@ static bool should_stop_tx(struct bt_conn *conn)
 		return true;
 	}
 
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+	/* Send up to `weight` fragments in a row, so they can go out in the
+	 * same connection event, then let the next connection have its turn.
+	 */
+	if (++conn->tx_turn >= conn_tx_weight(conn)) {
+		return true;
+	}
+
+	return atomic_get(&conn->in_ll) + 1 >= conn_tx_share(conn);
+#else
 	/* Queue only 3 buffers per-conn for now */
 	if (atomic_get(&conn->in_ll) < 3) {
 		/* The goal of this heuristic is to allow the link-layer to
@@ -842,6 +887,7 @@ static bool should_stop_tx(struct bt_conn *conn)
 	}
 
 	return true;
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
 }
 
 void bt_conn_data_ready(struct bt_conn *conn)
@@ -856,6 +902,10 @@ void bt_conn_data_ready(struct bt_conn *conn)
 		 * the list (in `get_conn_ready`).
 		 */
 		bt_conn_ref(conn);
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+		conn->tx_ready_weight = conn_tx_weight(conn);
+		atomic_add(&tx_ready_weight, conn->tx_ready_weight);
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
 		sys_slist_append(&bt_dev.le.conn_ready,
 				 &conn->_conn_ready);
 		LOG_DBG("raised");
@@ -944,11 +994,39 @@ struct bt_conn *get_conn_ready(void)
 		return NULL;
 	}
 
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+	if (conn->state == BT_CONN_CONNECTED &&
+	    atomic_get(&conn->in_ll) >= conn_tx_share(conn)) {
+		/* The connection used up its share of controller buffers. Take
+		 * it off the list without sending: it is put back when one of
+		 * its buffers completes, so it can't hold up the others.
+		 */
+		__maybe_unused sys_snode_t *s = sys_slist_get(&bt_dev.le.conn_ready);
+
+		__ASSERT_NO_MSG(s == node);
+		atomic_sub(&tx_ready_weight, conn->tx_ready_weight);
+		conn->tx_turn = 0U;
+		(void)atomic_set(&conn->_conn_ready_lock, 0);
+
+		LOG_DBG("%p over its share, parked", conn);
+
+		/* Give back the list reference and let the next conn run */
+		bt_conn_unref(conn);
+		bt_tx_irq_raise();
+
+		return NULL;
+	}
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
+
 	if (should_stop_tx(conn)) {
 		/* Move reference off the list and into the `conn` variable. */
 		__maybe_unused sys_snode_t *s = sys_slist_get(&bt_dev.le.conn_ready);
 
 		__ASSERT_NO_MSG(s == node);
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+		atomic_sub(&tx_ready_weight, conn->tx_ready_weight);
+		conn->tx_turn = 0U;
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
 		(void)atomic_set(&conn->_conn_ready_lock, 0);
 
 		/* Append connection to list if it still has data */
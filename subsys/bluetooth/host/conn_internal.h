@@ -321,6 +321,15 @@ struct bt_conn {
 	/* Next buffer should be an ACL/ISO HCI fragment */
 	bool			next_is_frag;
 
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+	/* Share of the controller buffers and of the TX turns, 0 means 1 */
+	uint8_t			tx_weight;
+	/* Weight accounted for while on the `conn_ready` list */
+	uint8_t			tx_ready_weight;
+	/* Fragments sent in the current turn */
+	uint8_t			tx_turn;
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
+
 	/* Must be at the end so that everything else in the structure can be
 	 * memset to zero without affecting the ref.
 	 */
@@ -99,6 +99,107 @@ enum gatt_global_flags {
 
 static ATOMIC_DEFINE(gatt_flags, GATT_NUM_FLAGS);
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+#define ATTR_INDEX_BUCKETS 32
+
+/* Attributes by handle, and handles chained per UUID bucket in ascending
+ * order. Handles are stored as is, 0 terminates a chain.
+ */
+static struct {
+	const struct bt_gatt_attr *attrs[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t next[CONFIG_BT_GATT_ATTR_INDEX_SIZE];
+	uint16_t head[ATTR_INDEX_BUCKETS];
+	uint16_t tail[ATTR_INDEX_BUCKETS];
+	bool valid;
+} attr_index;
+
+static uint8_t attr_index_bucket(const struct bt_uuid *uuid)
+{
+	static const struct bt_uuid_128 base = BT_UUID_INIT_128(
+		BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000, 0x00805F9B34FB));
+	const uint8_t *val;
+	uint32_t hash;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		hash = BT_UUID_16(uuid)->val;
+		break;
+	case BT_UUID_TYPE_32:
+		hash = BT_UUID_32(uuid)->val;
+		break;
+	default:
+		val = BT_UUID_128(uuid)->val;
+
+		/* UUIDs derived from the base UUID compare equal to their short
+		 * form, so they shall land in the same bucket.
+		 */
+		if (!memcmp(val, base.val, 12)) {
+			hash = sys_get_le32(&val[12]);
+		} else {
+			hash = sys_get_le32(&val[0]) ^ sys_get_le32(&val[4]) ^
+			       sys_get_le32(&val[8]) ^ sys_get_le32(&val[12]);
+		}
+		break;
+	}
+
+	return hash % ATTR_INDEX_BUCKETS;
+}
+
+static bool attr_index_add(const struct bt_gatt_attr *attr, uint16_t handle)
+{
+	uint8_t bucket;
+
+	if (handle == 0 || handle > CONFIG_BT_GATT_ATTR_INDEX_SIZE) {
+		LOG_WRN("Handle 0x%04x not indexed, index disabled", handle);
+		return false;
+	}
+
+	attr_index.attrs[handle - 1] = attr;
+
+	/* Attributes are added in ascending handle order */
+	bucket = attr_index_bucket(attr->uuid);
+	if (attr_index.tail[bucket]) {
+		attr_index.next[attr_index.tail[bucket] - 1] = handle;
+	} else {
+		attr_index.head[bucket] = handle;
+	}
+
+	attr_index.tail[bucket] = handle;
+
+	return true;
+}
+
+static void attr_index_build(void)
+{
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	struct bt_gatt_service *svc;
+#endif
+	uint16_t handle = 1;
+
+	memset(&attr_index, 0, sizeof(attr_index));
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
+		for (size_t i = 0; i < static_svc->attr_count; i++, handle++) {
+			if (!attr_index_add(&static_svc->attrs[i], handle)) {
+				return;
+			}
+		}
+	}
+
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
+		for (size_t i = 0; i < svc->attr_count; i++) {
+			if (!attr_index_add(&svc->attrs[i], svc->attrs[i].handle)) {
+				return;
+			}
+		}
+	}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
+	attr_index.valid = true;
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0 */
+
 static ssize_t read_name(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
@@ -1258,6 +1359,12 @@ static const struct bt_gatt_attr *find_attr(uint16_t handle)
 {
 	const struct bt_gatt_attr *attr = NULL;
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+	if (attr_index.valid && handle > 0 && handle <= CONFIG_BT_GATT_ATTR_INDEX_SIZE) {
+		return attr_index.attrs[handle - 1];
+	}
+#endif
+
 	bt_gatt_foreach_attr(handle, handle, found_attr, &attr);
 
 	return attr;
@@ -1325,6 +1432,10 @@ populate:
 
 	gatt_insert(svc, last_handle);
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+	attr_index_build();
+#endif
+
 	return 0;
 }
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
@@ -1546,6 +1657,10 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+	attr_index_build();
+#endif
 }
 
 void bt_gatt_init(void)
@@ -1729,6 +1844,10 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 		}
 	}
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+	attr_index_build();
+#endif
+
 	return 0;
 }
 
@@ -2090,6 +2209,49 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+static void foreach_attr_type_index(uint16_t start_handle, uint16_t end_handle,
+				    const struct bt_uuid *uuid,
+				    const void *attr_data, uint16_t num_matches,
+				    bt_gatt_attr_func_t func, void *user_data)
+{
+	uint16_t handle;
+
+	end_handle = MIN(end_handle, CONFIG_BT_GATT_ATTR_INDEX_SIZE);
+
+	/* Only visit the attributes sharing the UUID bucket */
+	if (uuid) {
+		for (handle = attr_index.head[attr_index_bucket(uuid)];
+		     handle && handle <= end_handle; handle = attr_index.next[handle - 1]) {
+			if (handle < start_handle) {
+				continue;
+			}
+
+			if (gatt_foreach_iter(attr_index.attrs[handle - 1], handle,
+					      start_handle, end_handle, uuid,
+					      attr_data, &num_matches, func,
+					      user_data) == BT_GATT_ITER_STOP) {
+				return;
+			}
+		}
+
+		return;
+	}
+
+	for (handle = MAX(start_handle, 1); handle <= end_handle; handle++) {
+		if (!attr_index.attrs[handle - 1]) {
+			continue;
+		}
+
+		if (gatt_foreach_iter(attr_index.attrs[handle - 1], handle,
+				      start_handle, end_handle, uuid, attr_data,
+				      &num_matches, func, user_data) == BT_GATT_ITER_STOP) {
+			return;
+		}
+	}
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0 */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -2101,6 +2263,14 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if CONFIG_BT_GATT_ATTR_INDEX_SIZE > 0
+	if (attr_index.valid) {
+		foreach_attr_type_index(start_handle, end_handle, uuid, attr_data,
+					num_matches, func, user_data);
+		return;
+	}
+#endif
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -5143,6 +5313,7 @@ static int gatt_cancel_encode(struct net_buf *buf, size_t len, void *user_data)
 	return 0;
 }
 
+#if CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH == 0
 static int gatt_cancel_all_writes(struct bt_conn *conn,
 			   struct bt_gatt_write_params *params)
 {
@@ -5222,6 +5393,11 @@ fail:
 	/* Notify application that the write operation has failed */
 	params->func(conn, BT_ATT_ERR_UNLIKELY, params);
 }
+#else
+static void gatt_prepare_write_rsp(struct bt_conn *conn, int err,
+				   const void *pdu, uint16_t length,
+				   void *user_data);
+#endif /* CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH == 0 */
 
 static int gatt_prepare_write_encode(struct net_buf *buf, size_t len,
 				     void *user_data)
@@ -5261,6 +5437,161 @@ static int gatt_prepare_write(struct bt_conn *conn,
 			     BT_ATT_CHAN_OPT(params));
 }
 
+#if CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH > 0
+/* Queue the chunk at the write cursor and move the cursor past it */
+static int gatt_prepare_write_send(struct bt_conn *conn,
+				   struct bt_gatt_write_params *params)
+{
+	uint16_t len;
+	int err;
+
+	len = bt_att_get_mtu(conn) - sizeof(struct bt_att_prepare_write_req) - 1;
+	len = MIN(params->length, len);
+
+	err = gatt_prepare_write(conn, params);
+	if (err) {
+		return err;
+	}
+
+	params->offset += len;
+	params->data = (const uint8_t *)params->data + len;
+	params->length -= len;
+	params->_pending++;
+
+	return 0;
+}
+
+static bool gatt_prepare_write_rsp_valid(struct bt_gatt_write_params *params,
+					 const void *pdu, uint16_t length, bool first)
+{
+	const struct bt_att_prepare_write_rsp *rsp = pdu;
+	const uint8_t *data;
+	uint16_t offset;
+	size_t len;
+
+	if (length < sizeof(*rsp)) {
+		LOG_WRN("Parse err");
+		return false;
+	}
+
+	len = length - sizeof(*rsp);
+	offset = sys_le16_to_cpu(rsp->offset);
+
+	/* The first chunk is still at the cursor, the others are behind it and
+	 * their responses may arrive in any order.
+	 */
+	if (first) {
+		if (offset != params->offset || len > params->length) {
+			LOG_ERR("Incorrect offset or length in response");
+			return false;
+		}
+	} else if (offset < params->_offset || offset + len > params->offset) {
+		LOG_ERR("Incorrect offset or length in response");
+		return false;
+	}
+
+	data = (const uint8_t *)params->data - (params->offset - offset);
+	if (memcmp(data, rsp->value, len) != 0) {
+		LOG_ERR("Incorrect data in response");
+		return false;
+	}
+
+	if (first) {
+		params->offset += len;
+		params->data = (const uint8_t *)params->data + len;
+		params->length -= len;
+	}
+
+	return true;
+}
+
+static void gatt_prepare_write_cancel_rsp(struct bt_conn *conn, int err,
+					  const void *pdu, uint16_t length,
+					  void *user_data)
+{
+	struct bt_gatt_write_params *params = user_data;
+
+	LOG_DBG("err %d", err);
+
+	params->func(conn, params->_err, params);
+}
+
+static void gatt_prepare_write_rsp(struct bt_conn *conn, int err,
+				   const void *pdu, uint16_t length,
+				   void *user_data)
+{
+	struct bt_gatt_write_params *params = user_data;
+	bool first = params->offset == params->_offset;
+
+	LOG_DBG("err %d pending %u", err, params->_pending);
+
+	params->_pending--;
+
+	if (params->_err) {
+		/* Already failed, wait for the other requests to complete */
+	} else if (err) {
+		params->_err = att_err_from_int(err);
+	} else if (!gatt_prepare_write_rsp_valid(params, pdu, length, first)) {
+		params->_err = BT_ATT_ERR_UNLIKELY;
+	}
+
+	/* Keep up to the configured number of chunks in flight */
+	while (!params->_err && params->length &&
+	       params->_pending < CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH) {
+		if (gatt_prepare_write_send(conn, params)) {
+			/* Out of requests, retry when the next response arrives */
+			if (!params->_pending) {
+				params->_err = BT_ATT_ERR_UNLIKELY;
+			}
+
+			break;
+		}
+	}
+
+	if (params->_pending) {
+		return;
+	}
+
+	if (!params->_err) {
+		if (!gatt_exec_write(conn, params)) {
+			return;
+		}
+
+		params->_err = BT_ATT_ERR_UNLIKELY;
+	} else {
+		LOG_ERR("Long write failed, canceling write");
+	}
+
+	/* Drop the chunks the server has queued and report the first error */
+	if (gatt_req_send(conn, gatt_prepare_write_cancel_rsp, params,
+			  gatt_cancel_encode, BT_ATT_OP_EXEC_WRITE_REQ,
+			  sizeof(struct bt_att_exec_write_req),
+			  BT_ATT_CHAN_OPT(params))) {
+		params->func(conn, params->_err, params);
+	}
+}
+
+static int gatt_prepare_write_start(struct bt_conn *conn,
+				    struct bt_gatt_write_params *params)
+{
+	int err;
+
+	/* The first chunk goes alone and leaves the cursor in place, so that
+	 * it can be resent on a security error before more chunks follow.
+	 */
+	params->_offset = params->offset;
+	params->_pending = 1U;
+	params->_err = 0U;
+
+	err = gatt_prepare_write(conn, params);
+	if (err) {
+		params->_pending = 0U;
+	}
+
+	return err;
+}
+#endif /* CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH > 0 */
+
 static int gatt_write_encode(struct net_buf *buf, size_t len, void *user_data)
 {
 	struct bt_gatt_write_params *params = user_data;
@@ -5295,7 +5626,11 @@ int bt_gatt_write(struct bt_conn *conn, struct bt_gatt_write_params *params)
 
 	/* Use Prepare Write if offset is set or Long Write is required */
 	if (params->offset || len > (bt_att_get_mtu(conn) - 1)) {
+#if CONFIG_BT_GATT_WRITE_PIPELINE_DEPTH > 0
+		return gatt_prepare_write_start(conn, params);
+#else
 		return gatt_prepare_write(conn, params);
+#endif
 	}
 
 	LOG_DBG("handle 0x%04x length %u", params->handle, params->length);
@@ -5926,7 +6261,7 @@ void bt_gatt_connected(struct bt_conn *conn)
 					       &conn->le.dst, NULL);
 		}
 
-		settings_load_subtree_direct(key, ccc_set_direct, (void *)key);
+		bt_settings_load_direct(key, ccc_set_direct, (void *)key);
 	}
 
 	bt_gatt_foreach_attr(0x0001, 0xffff, update_ccc, &data);
@@ -6496,6 +6831,7 @@ void bt_gatt_disconnected(struct bt_conn *conn)
 
 	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		gatt_store_ccc_cf(conn->id, &conn->le.dst);
+		bt_settings_flush_async();
 	}
 
 	/* Make sure to clear the CCC entry when using lazy loading */
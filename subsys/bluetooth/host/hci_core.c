@@ -616,6 +616,15 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			__ASSERT_NO_MSG(atomic_get(&conn->in_ll));
 			atomic_dec(&conn->in_ll);
 
+#if defined(CONFIG_BT_CONN_TX_WEIGHTED)
+			/* The connection may have been taken off the ready list
+			 * for using up its share of controller buffers.
+			 */
+			if (conn->has_data && conn->has_data(conn)) {
+				bt_conn_data_ready(conn);
+			}
+#endif /* CONFIG_BT_CONN_TX_WEIGHTED */
+
 			/* TX context free + callback happens in there */
 			bt_conn_tx_notify(conn, false);
 		}
@@ -4276,18 +4285,8 @@ static void init_work(struct k_work *work)
 	}
 }
 
-static void rx_work_handler(struct k_work *work)
+static void rx_process(struct net_buf *buf)
 {
-	int err;
-
-	struct net_buf *buf;
-
-	LOG_DBG("Getting net_buf from queue");
-	buf = net_buf_slist_get(&bt_dev.rx_queue);
-	if (!buf) {
-		return;
-	}
-
 	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	switch (bt_buf_get_type(buf)) {
@@ -4309,6 +4308,33 @@ static void rx_work_handler(struct k_work *work)
 		net_buf_unref(buf);
 		break;
 	}
+}
+
+static void rx_work_handler(struct k_work *work)
+{
+	uint16_t count = 0U;
+	int err;
+
+	struct net_buf *buf;
+
+	LOG_DBG("Getting net_buf from queue");
+
+	/* Drain up to a batch of buffers per run */
+	while (count < MAX(CONFIG_BT_RECV_BATCH_SIZE, 1)) {
+		buf = net_buf_slist_get(&bt_dev.rx_queue);
+		if (!buf) {
+			break;
+		}
+
+		rx_process(buf);
+		count++;
+	}
+
+	if (!count) {
+		return;
+	}
+
+	LOG_DBG("Processed %u bufs", count);
 
 	/* Schedule the work handler to be executed again if there are
 	 * additional items in the queue. This allows for other users of the
@@ -4463,6 +4489,11 @@ int bt_disable(void)
 	disconnected_handles_reset();
 #endif /* CONFIG_BT_CONN */
 
+	if (IS_ENABLED(CONFIG_BT_SETTINGS)) {
+		/* Write the settings still held by the write cache */
+		bt_settings_flush();
+	}
+
 #if DT_HAS_CHOSEN(zephyr_bt_hci)
 	err = bt_hci_close(bt_dev.hci);
 	if (err == -ENOSYS) {
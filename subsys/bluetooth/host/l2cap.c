@@ -2467,10 +2467,10 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf)
 {
-	uint16_t len;
+	size_t len;
 	uint16_t seg = 0U;
 
-	len = chan->_sdu->len;
+	len = net_buf_frags_len(chan->_sdu);
 	if (len) {
 		memcpy(&seg, net_buf_user_data(chan->_sdu), sizeof(seg));
 	}
@@ -2487,16 +2487,28 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 
 	LOG_DBG("chan %p seg %d len %zu", chan, seg, buf->len);
 
-	/* Append received segment to SDU */
-	len = net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
-				   l2cap_alloc_frag, chan);
-	if (len != buf->len) {
-		LOG_ERR("Unable to store SDU");
-		bt_l2cap_chan_disconnect(&chan->chan);
-		return;
+#if CONFIG_BT_L2CAP_RX_SDU_CHAIN_MAX > 0
+	if (seg <= CONFIG_BT_L2CAP_RX_SDU_CHAIN_MAX) {
+		/* Chain the received segment to the SDU instead of copying it,
+		 * the caller keeps its own reference.
+		 */
+		net_buf_frag_add(chan->_sdu, net_buf_ref(buf));
+		len += buf->len;
+	} else
+#endif /* CONFIG_BT_L2CAP_RX_SDU_CHAIN_MAX > 0 */
+	{
+		/* Append received segment to SDU */
+		if (net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
+					 l2cap_alloc_frag, chan) != buf->len) {
+			LOG_ERR("Unable to store SDU");
+			bt_l2cap_chan_disconnect(&chan->chan);
+			return;
+		}
+
+		len += buf->len;
 	}
 
-	if (chan->_sdu->len < chan->_sdu_len) {
+	if (len < chan->_sdu_len) {
 		/* Give more credits if remote has run out of them, this
 		 * should only happen if the remote cannot fully utilize the
 		 * MPS for some reason.
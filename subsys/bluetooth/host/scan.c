@@ -618,6 +618,75 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
+#if CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0
+/* Entries probed from the hashed slot, the oldest one is replaced on a miss */
+#define DUP_FILTER_WAYS MIN(4, CONFIG_BT_SCAN_DUP_FILTER_SIZE)
+
+static struct dup_filter_entry {
+	bt_addr_le_t addr;
+	uint8_t sid;
+	uint8_t adv_type;
+	uint32_t data_hash;
+	uint32_t timestamp;
+} dup_filter[CONFIG_BT_SCAN_DUP_FILTER_SIZE];
+
+static void dup_filter_reset(void)
+{
+	(void)memset(dup_filter, 0, sizeof(dup_filter));
+}
+
+static uint32_t dup_filter_hash(uint32_t hash, const uint8_t *data, size_t len)
+{
+	/* FNV-1a */
+	while (len--) {
+		hash ^= *data++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/* Returns true if the report was seen recently, records it otherwise */
+static bool dup_filter_check(const bt_addr_le_t *addr, const struct bt_le_scan_recv_info *info,
+			     const uint8_t *data, uint16_t len)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t data_hash = dup_filter_hash(2166136261U, data, len);
+	uint32_t slot = dup_filter_hash(2166136261U, (const uint8_t *)addr, sizeof(*addr));
+	struct dup_filter_entry *oldest = NULL;
+
+	slot = dup_filter_hash(slot, &info->sid, sizeof(info->sid));
+
+	for (uint8_t i = 0U; i < DUP_FILTER_WAYS; i++) {
+		struct dup_filter_entry *entry =
+			&dup_filter[(slot + i) % CONFIG_BT_SCAN_DUP_FILTER_SIZE];
+
+		if (entry->sid == info->sid && bt_addr_le_eq(&entry->addr, addr)) {
+			if (entry->adv_type == info->adv_type && entry->data_hash == data_hash &&
+			    now - entry->timestamp < CONFIG_BT_SCAN_DUP_FILTER_TIMEOUT) {
+				return true;
+			}
+
+			/* Changed or aged report from a known advertiser */
+			oldest = entry;
+			break;
+		}
+
+		if (!oldest || (int32_t)(entry->timestamp - oldest->timestamp) < 0) {
+			oldest = entry;
+		}
+	}
+
+	bt_addr_le_copy(&oldest->addr, addr);
+	oldest->sid = info->sid;
+	oldest->adv_type = info->adv_type;
+	oldest->data_hash = data_hash;
+	oldest->timestamp = now;
+
+	return false;
+}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0 */
+
 static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 			struct net_buf_simple *buf, uint16_t len)
 {
@@ -644,6 +713,15 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 				bt_lookup_id_addr(BT_ID_DEFAULT, addr));
 	}
 
+#if CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0
+	if (atomic_test_bit(scan_state.scan_flags, BT_LE_SCAN_USER_EXPLICIT_SCAN) &&
+	    (scan_state.explicit_scan_param.options & BT_LE_SCAN_OPT_FILTER_DUPLICATE) &&
+	    dup_filter_check(addr, info, buf->data, len)) {
+		LOG_DBG("Dropped duplicate adv report");
+		goto pending_conn;
+	}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0 */
+
 	if (scan_dev_found_cb) {
 		net_buf_simple_save(buf, &state);
 
@@ -669,6 +747,9 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 	/* Clear pointer to this stack frame before returning to calling function */
 	info->addr = NULL;
 
+#if CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0
+pending_conn:
+#endif /* CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0 */
 #if defined(CONFIG_BT_CENTRAL)
 	check_pending_conn(&id_addr, addr, info->adv_props);
 #endif /* CONFIG_BT_CENTRAL */
@@ -1766,6 +1847,10 @@ int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
 	memcpy(&scan_state.explicit_scan_param, param,
 	       sizeof(scan_state.explicit_scan_param));
 
+#if CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0
+	dup_filter_reset();
+#endif /* CONFIG_BT_SCAN_DUP_FILTER_SIZE > 0 */
+
 	scan_dev_found_cb = cb;
 	err = bt_le_scan_user_add(BT_LE_SCAN_USER_EXPLICIT_SCAN);
 	k_mutex_unlock(&scan_state.scan_explicit_params_mutex);
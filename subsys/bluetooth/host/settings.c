@@ -298,6 +298,167 @@ int bt_settings_init(void)
 	return 0;
 }
 
+#if CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0
+/* Pending write or delete of a settings key */
+struct store_cache_entry {
+	char key[BT_SETTINGS_KEY_MAX];
+	uint8_t value[CONFIG_BT_SETTINGS_STORE_CACHE_VALUE_MAX];
+	uint16_t len;
+	bool deleted;
+};
+
+static struct store_cache_entry store_cache[CONFIG_BT_SETTINGS_STORE_CACHE_SIZE];
+static size_t store_cache_count;
+static K_MUTEX_DEFINE(store_cache_lock);
+
+static void store_cache_work_handler(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(store_cache_work, store_cache_work_handler);
+
+/* Write out and empty the cache, store_cache_lock must be held */
+static void store_cache_write_all_locked(void)
+{
+	int err;
+
+	__ASSERT_NO_MSG(store_cache_lock.owner == k_current_get());
+
+	LOG_DBG("count %zu", store_cache_count);
+
+	for (size_t i = 0; i < store_cache_count; i++) {
+		struct store_cache_entry *entry = &store_cache[i];
+
+		if (entry->deleted) {
+			err = settings_delete(entry->key);
+		} else {
+			err = settings_save_one(entry->key, entry->value, entry->len);
+		}
+
+		if (err) {
+			LOG_ERR("Failed to write %s (err %d)", entry->key, err);
+		}
+	}
+
+	store_cache_count = 0;
+}
+
+/* Look up the pending write of a key, store_cache_lock must be held */
+static struct store_cache_entry *store_cache_find_locked(const char *key)
+{
+	__ASSERT_NO_MSG(store_cache_lock.owner == k_current_get());
+
+	for (size_t i = 0; i < store_cache_count; i++) {
+		if (strcmp(store_cache[i].key, key) == 0) {
+			return &store_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void store_cache_work_handler(struct k_work *work)
+{
+	k_mutex_lock(&store_cache_lock, K_FOREVER);
+	store_cache_write_all_locked();
+	k_mutex_unlock(&store_cache_lock);
+}
+
+static ssize_t store_cache_read(void *cb_arg, void *data, size_t len)
+{
+	const struct store_cache_entry *entry = cb_arg;
+
+	len = MIN(len, entry->len);
+	memcpy(data, entry->value, len);
+
+	return len;
+}
+
+static int settings_write(const char *key, const void *value, size_t val_len)
+{
+	struct store_cache_entry *entry;
+
+	k_mutex_lock(&store_cache_lock, K_FOREVER);
+
+	entry = store_cache_find_locked(key);
+
+	if (val_len > sizeof(entry->value)) {
+		/* Too large to be held, drop the older pending write of the key */
+		if (entry) {
+			*entry = store_cache[--store_cache_count];
+		}
+
+		k_mutex_unlock(&store_cache_lock);
+
+		return value ? settings_save_one(key, value, val_len) : settings_delete(key);
+	}
+
+	if (!entry) {
+		if (store_cache_count == ARRAY_SIZE(store_cache)) {
+			store_cache_write_all_locked();
+		}
+
+		entry = &store_cache[store_cache_count++];
+		strcpy(entry->key, key);
+	}
+
+	entry->deleted = value == NULL;
+	entry->len = val_len;
+	if (value) {
+		memcpy(entry->value, value, val_len);
+	}
+
+	k_mutex_unlock(&store_cache_lock);
+
+	/* Restart the quiet period */
+	k_work_reschedule(&store_cache_work, K_MSEC(CONFIG_BT_SETTINGS_STORE_CACHE_MS));
+
+	return 0;
+}
+#else
+static int settings_write(const char *key, const void *value, size_t val_len)
+{
+	return value ? settings_save_one(key, value, val_len) : settings_delete(key);
+}
+#endif /* CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0 */
+
+void bt_settings_flush(void)
+{
+#if CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0
+	k_work_cancel_delayable(&store_cache_work);
+	store_cache_work_handler(NULL);
+#endif /* CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0 */
+}
+
+void bt_settings_flush_async(void)
+{
+#if CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0
+	k_work_reschedule(&store_cache_work, K_NO_WAIT);
+#endif /* CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0 */
+}
+
+int bt_settings_load_direct(const char *key, settings_load_direct_cb cb, void *param)
+{
+#if CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0
+	struct store_cache_entry *entry;
+#endif /* CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0 */
+	int err;
+
+	err = settings_load_subtree_direct(key, cb, param);
+
+#if CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0
+	/* A pending write supersedes the value in the backend */
+	k_mutex_lock(&store_cache_lock, K_FOREVER);
+
+	entry = store_cache_find_locked(key);
+	if (entry) {
+		err = cb(NULL, entry->deleted ? 0 : entry->len, store_cache_read, entry, param);
+	}
+
+	k_mutex_unlock(&store_cache_lock);
+#endif /* CONFIG_BT_SETTINGS_STORE_CACHE_SIZE > 0 */
+
+	return err;
+}
+
 int bt_settings_store(const char *key, uint8_t id, const bt_addr_le_t *addr, const void *value,
 		      size_t val_len)
 {
@@ -318,7 +479,7 @@ int bt_settings_store(const char *key, uint8_t id, const bt_addr_le_t *addr, con
 		}
 	}
 
-	return settings_save_one(key_str, value, val_len);
+	return settings_write(key_str, value, val_len);
 }
 
 int bt_settings_delete(const char *key, uint8_t id, const bt_addr_le_t *addr)
@@ -340,7 +501,7 @@ int bt_settings_delete(const char *key, uint8_t id, const bt_addr_le_t *addr)
 		}
 	}
 
-	return settings_delete(key_str);
+	return settings_write(key_str, NULL, 0);
 }
 
 int bt_settings_store_sc(uint8_t id, const bt_addr_le_t *addr, const void *value, size_t val_len)
@@ -28,6 +28,13 @@ int bt_settings_decode_key(const char *key, bt_addr_le_t *addr);
 
 void bt_settings_save_id(void);
 
+/* Write the pending settings of the write cache, now or from the workqueue */
+void bt_settings_flush(void);
+void bt_settings_flush_async(void);
+
+/* Load a single key, including a write still pending in the write cache */
+int bt_settings_load_direct(const char *key, settings_load_direct_cb cb, void *param);
+
 int bt_settings_init(void);
 
 int bt_settings_store_sc(uint8_t id, const bt_addr_le_t *addr, const void *value, size_t val_len);
@@ -33,6 +33,13 @@ LOG_MODULE_REGISTER(bt_mesh_adv_ext);
 #define CONFIG_BT_MESH_RELAY_ADV_SETS 0
 #endif
 
+#ifndef CONFIG_BT_MESH_ADV_EXT_SHARED_SETS
+#define CONFIG_BT_MESH_ADV_EXT_SHARED_SETS 0
+#endif
+
+/* Index of the first shared advertising set */
+#define SHARED_ADV_IDX (1 + CONFIG_BT_MESH_RELAY_ADV_SETS)
+
 enum {
 	/** Controller is currently advertising */
 	ADV_FLAG_ACTIVE,
@@ -101,6 +108,17 @@ static struct bt_mesh_ext_adv advs[] = {
 		.work = Z_WORK_INITIALIZER(send_pending_adv),
 	},
 #endif /* CONFIG_BT_MESH_RELAY_ADV_SETS */
+#if CONFIG_BT_MESH_ADV_EXT_SHARED_SETS
+	[SHARED_ADV_IDX ... (SHARED_ADV_IDX + CONFIG_BT_MESH_ADV_EXT_SHARED_SETS - 1)] = {
+		.tags = (
+#if defined(CONFIG_BT_MESH_RELAY)
+			BT_MESH_ADV_TAG_BIT_RELAY |
+#endif /* CONFIG_BT_MESH_RELAY */
+			BT_MESH_ADV_TAG_BIT_LOCAL
+		),
+		.work = Z_WORK_INITIALIZER(send_pending_adv),
+	},
+#endif /* CONFIG_BT_MESH_ADV_EXT_SHARED_SETS */
 #if defined(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE)
 	{
 		.tags = BT_MESH_ADV_TAG_BIT_FRIEND,
@@ -136,6 +154,12 @@ static inline struct bt_mesh_ext_adv *gatt_adv_get(void)
 	}
 }
 
+static inline bool is_shared_adv(const struct bt_mesh_ext_adv *ext_adv)
+{
+	return ext_adv >= &advs[SHARED_ADV_IDX] &&
+	       ext_adv < &advs[SHARED_ADV_IDX + CONFIG_BT_MESH_ADV_EXT_SHARED_SETS];
+}
+
 static int adv_start(struct bt_mesh_ext_adv *ext_adv,
 		     const struct bt_le_adv_param *param,
 		     struct bt_le_ext_adv_start_param *start,
@@ -263,6 +287,25 @@ static bool schedule_send_with_mask(struct bt_mesh_ext_adv *ext_adv, int ignore_
 	return true;
 }
 
+static struct bt_mesh_adv *adv_get(struct bt_mesh_ext_adv *ext_adv)
+{
+	struct bt_mesh_adv *adv;
+
+	/* Shared sets take relayed messages first, so that they do not queue up behind local
+	 * traffic, and fall back to local messages.
+	 */
+	if (IS_ENABLED(CONFIG_BT_MESH_RELAY) && is_shared_adv(ext_adv)) {
+		adv = bt_mesh_adv_get_by_tag(BT_MESH_ADV_TAG_BIT_RELAY, K_NO_WAIT);
+		if (adv) {
+			return adv;
+		}
+
+		return bt_mesh_adv_get_by_tag(BT_MESH_ADV_TAG_BIT_LOCAL, K_NO_WAIT);
+	}
+
+	return bt_mesh_adv_get_by_tag(ext_adv->tags, K_NO_WAIT);
+}
+
 static void send_pending_adv(struct k_work *work)
 {
 	struct bt_mesh_ext_adv *ext_adv;
@@ -297,7 +340,7 @@ static void send_pending_adv(struct k_work *work)
 		}
 	}
 
-	while ((adv = bt_mesh_adv_get_by_tag(ext_adv->tags, K_NO_WAIT))) {
+	while ((adv = adv_get(ext_adv))) {
 		/* busy == 0 means this was canceled */
 		if (!adv->ctx.busy) {
 			bt_mesh_adv_unref(adv);
@@ -350,9 +393,25 @@ void bt_mesh_adv_gatt_update(void)
 	(void)schedule_send(gatt_adv_get());
 }
 
+static bool schedule_send_shared(void)
+{
+	for (int i = 0; i < CONFIG_BT_MESH_ADV_EXT_SHARED_SETS; i++) {
+		if (schedule_send(&advs[SHARED_ADV_IDX + i])) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void bt_mesh_adv_local_ready(void)
 {
-	(void)schedule_send(advs);
+	if (schedule_send(advs)) {
+		return;
+	}
+
+	/* The main set is busy, let an idle shared set send the message. */
+	(void)schedule_send_shared();
 }
 
 void bt_mesh_adv_relay_ready(void)
@@ -365,6 +424,10 @@ void bt_mesh_adv_relay_ready(void)
 		}
 	}
 
+	if (schedule_send_shared()) {
+		return;
+	}
+
 	/* Use the main adv set for the sending of relay messages. */
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_RELAY_USING_MAIN_ADV_SET) ||
 	    CONFIG_BT_MESH_RELAY_ADV_SETS == 0) {
@@ -375,7 +438,7 @@ void bt_mesh_adv_relay_ready(void)
 void bt_mesh_adv_friend_ready(void)
 {
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE)) {
-		schedule_send(&advs[1 + CONFIG_BT_MESH_RELAY_ADV_SETS]);
+		schedule_send(&advs[SHARED_ADV_IDX + CONFIG_BT_MESH_ADV_EXT_SHARED_SETS]);
 	} else {
 		schedule_send(&advs[0]);
 	}
@@ -86,6 +86,49 @@ static struct {
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static uint16_t msg_cache_next;
 
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+/* Cache entries chained per hash bucket, as index + 1 with 0 ending a chain.
+ * The same chaining is used for the message cache and the duplicate cache.
+ */
+static uint16_t msg_cache_buckets[CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE];
+static uint16_t msg_cache_chain[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+static uint16_t dup_cache_buckets[CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE];
+static uint16_t dup_cache_chain[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+
+static uint16_t *cache_bucket(uint16_t *buckets, uint32_t key)
+{
+	return &buckets[((key * 2654435761U) >> 16) % CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE];
+}
+
+static void cache_link(uint16_t *buckets, uint16_t *chain, uint32_t key, uint16_t idx)
+{
+	uint16_t *head = cache_bucket(buckets, key);
+
+	chain[idx] = *head;
+	*head = idx + 1;
+}
+
+/* Entries that were never linked are not found, so this is a no-op for them */
+static void cache_unlink(uint16_t *buckets, uint16_t *chain, uint32_t key, uint16_t idx)
+{
+	uint16_t *link = cache_bucket(buckets, key);
+
+	while (*link != 0U) {
+		if (*link == idx + 1) {
+			*link = chain[idx];
+			return;
+		}
+
+		link = &chain[*link - 1];
+	}
+}
+
+static inline uint32_t msg_cache_key(uint16_t src, uint32_t seq)
+{
+	return ((uint32_t)src << 17) | (seq & BIT_MASK(17));
+}
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0 */
+
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
 	.local_queue = SYS_SLIST_STATIC_INIT(&bt_mesh.local_queue),
@@ -127,6 +170,18 @@ static bool check_dup(struct net_buf_simple *data)
 
 	val = sys_get_be32(tail - 4) ^ sys_get_be32(tail - 8);
 
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+	for (i = *cache_bucket(dup_cache_buckets, val); i != 0; i = dup_cache_chain[i - 1]) {
+		if (dup_cache[i - 1] == val) {
+			return true;
+		}
+	}
+
+	dup_cache_next %= ARRAY_SIZE(dup_cache);
+	cache_unlink(dup_cache_buckets, dup_cache_chain, dup_cache[dup_cache_next],
+		     dup_cache_next);
+	cache_link(dup_cache_buckets, dup_cache_chain, val, dup_cache_next);
+#else
 	for (i = dup_cache_next; i > 0;) {
 		if (dup_cache[--i] == val) {
 			return true;
@@ -140,6 +195,7 @@ static bool check_dup(struct net_buf_simple *data)
 	}
 
 	dup_cache_next %= ARRAY_SIZE(dup_cache);
+#endif
 	dup_cache[dup_cache_next++] = val;
 
 	return false;
@@ -149,6 +205,16 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 {
 	uint16_t i;
 
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+	uint32_t key = msg_cache_key(SRC(pdu->data), SEQ(pdu->data));
+
+	for (i = *cache_bucket(msg_cache_buckets, key); i != 0U; i = msg_cache_chain[i - 1]) {
+		if (msg_cache[i - 1].src == SRC(pdu->data) &&
+		    msg_cache[i - 1].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
+			return true;
+		}
+	}
+#else
 	for (i = msg_cache_next; i > 0U;) {
 		if (msg_cache[--i].src == SRC(pdu->data) &&
 		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
@@ -162,6 +228,7 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 			return true;
 		}
 	}
+#endif
 
 	return false;
 }
@@ -169,11 +236,35 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+	cache_unlink(msg_cache_buckets, msg_cache_chain,
+		     msg_cache_key(msg_cache[msg_cache_next].src, msg_cache[msg_cache_next].seq),
+		     msg_cache_next);
+	cache_link(msg_cache_buckets, msg_cache_chain, msg_cache_key(rx->ctx.addr, rx->seq),
+		   msg_cache_next);
+#endif
 	msg_cache[msg_cache_next].src = rx->ctx.addr;
 	msg_cache[msg_cache_next].seq = rx->seq;
 	msg_cache_next++;
 }
 
+static void msg_cache_rewind(void)
+{
+	/* Rewind the next index now that we're not using this entry */
+	msg_cache_next--;
+	dup_cache_next--;
+
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+	cache_unlink(msg_cache_buckets, msg_cache_chain,
+		     msg_cache_key(msg_cache[msg_cache_next].src, msg_cache[msg_cache_next].seq),
+		     msg_cache_next);
+	cache_unlink(dup_cache_buckets, dup_cache_chain, dup_cache[dup_cache_next],
+		     dup_cache_next);
+#endif
+	msg_cache[msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+	dup_cache[dup_cache_next] = 0;
+}
+
 static void store_iv(bool only_duration)
 {
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_IV_PENDING);
@@ -217,6 +308,9 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
 	msg_cache_next = 0U;
+#if CONFIG_BT_MESH_MSG_CACHE_HASH_SIZE > 0
+	(void)memset(msg_cache_buckets, 0, sizeof(msg_cache_buckets));
+#endif
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -911,9 +1005,7 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 * it again in the future.
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
-		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
-		dup_cache[--dup_cache_next] = 0;
+		msg_cache_rewind();
 		return;
 	} else if (err == -EBADMSG) {
 		LOG_DBG("Not relaying message rejected by the Transport layer");
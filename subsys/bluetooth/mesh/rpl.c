@@ -49,6 +49,124 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+#if CONFIG_BT_MESH_CRPL_HASH_SIZE > 0
+/* Entries chained per source address bucket, as index + 1 with 0 ending a
+ * chain. Only one entry per source address is linked, the one a linear scan
+ * would find first.
+ */
+static uint16_t rpl_buckets[CONFIG_BT_MESH_CRPL_HASH_SIZE];
+static uint16_t rpl_chain[CONFIG_BT_MESH_CRPL];
+
+static uint16_t *rpl_bucket(uint16_t src)
+{
+	return &rpl_buckets[src % CONFIG_BT_MESH_CRPL_HASH_SIZE];
+}
+
+static void rpl_link(int idx)
+{
+	uint16_t *head = rpl_bucket(replay_list[idx].src);
+
+	rpl_chain[idx] = *head;
+	*head = idx + 1;
+}
+
+/* Entries that are not linked are not found, so this is a no-op for them */
+static void rpl_unlink(int idx)
+{
+	uint16_t *link = rpl_bucket(replay_list[idx].src);
+
+	while (*link != 0U) {
+		if (*link == idx + 1) {
+			*link = rpl_chain[idx];
+			return;
+		}
+
+		link = &rpl_chain[*link - 1];
+	}
+}
+
+static void rpl_index_build(void)
+{
+	(void)memset(rpl_buckets, 0, sizeof(rpl_buckets));
+
+	for (int i = ARRAY_SIZE(replay_list); i > 0; i--) {
+		if (replay_list[i - 1].src) {
+			rpl_link(i - 1);
+		}
+	}
+}
+
+static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
+{
+	uint16_t next;
+
+	for (next = *rpl_bucket(src); next != 0U; next = rpl_chain[next - 1]) {
+		if (replay_list[next - 1].src == src) {
+			return &replay_list[next - 1];
+		}
+	}
+
+	return NULL;
+}
+
+static struct bt_mesh_rpl *rpl_slot(uint16_t src)
+{
+	struct bt_mesh_rpl *rpl = bt_mesh_rpl_find(src);
+
+	if (rpl) {
+		return rpl;
+	}
+
+	/* Only a source seen for the first time takes the linear search */
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (!replay_list[i].src) {
+			return &replay_list[i];
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline void rpl_link(int idx) {}
+static inline void rpl_unlink(int idx) {}
+static inline void rpl_index_build(void) {}
+
+static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src == src) {
+			return &replay_list[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct bt_mesh_rpl *rpl_slot(uint16_t src)
+{
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (!replay_list[i].src || replay_list[i].src == src) {
+			return &replay_list[i];
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_BT_MESH_CRPL_HASH_SIZE > 0 */
+
+/* Copy an entry to a lower slot while the list is compacted. The lower slot
+ * is found first from then on, as it would be by a linear scan.
+ */
+static void rpl_move(int to, int from)
+{
+	rpl_unlink(to);
+	rpl_unlink(from);
+	replay_list[to] = replay_list[from];
+	rpl_link(to);
+}
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,7 +210,12 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (rpl->src != rx->ctx.addr) {
+		rpl_unlink(rpl_idx(rpl));
+		rpl->src = rx->ctx.addr;
+		rpl_link(rpl_idx(rpl));
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -101,6 +224,26 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	}
 }
 
+static bool rpl_is_replay(const struct bt_mesh_rpl *rpl, const struct bt_mesh_net_rx *rx)
+{
+	if (!rpl->old_iv &&
+	    atomic_test_bit(rpl_flags, PENDING_RESET) &&
+	    !atomic_test_bit(store, rpl_idx(rpl))) {
+		/* Until rpl reset is finished, entry with old_iv == false and
+		 * without "store" bit set will be removed, therefore it can be
+		 * reused. If such entry is reused, "store" bit will be set and
+		 * the entry won't be removed.
+		 */
+		return false;
+	}
+
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	return !((!rx->old_iv && rpl->old_iv) || rpl->seq < rx->seq);
+}
+
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
  * parameter is given the RPL slot is returned, but it is not immediately
  * updated. This is used to prevent storing data in RPL that has been rejected
@@ -110,7 +253,6 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bool bridge)
 {
 	struct bt_mesh_rpl *rpl;
-	int i;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -122,44 +264,17 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bo
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
-			goto match;
-		}
-
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
-				goto match;
-			}
-
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
-		}
+	/* Existing slot for given address, or an empty slot */
+	rpl = rpl_slot(rx->ctx.addr);
+	if (!rpl) {
+		LOG_ERR("RPL is full!");
+		return true;
 	}
 
-	LOG_ERR("RPL is full!");
-	return true;
+	if (rpl->src && rpl_is_replay(rpl, rx)) {
+		return true;
+	}
 
-match:
 	if (match) {
 		*match = rpl;
 	} else {
@@ -175,6 +290,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_build();
 		return;
 	}
 
@@ -183,19 +299,6 @@ void bt_mesh_rpl_clear(void)
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_RPL_PENDING);
 }
 
-static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
-{
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
-		}
-	}
-
-	return NULL;
-}
-
 static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 {
 	int i;
@@ -203,6 +306,7 @@ static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (!replay_list[i].src) {
 			replay_list[i].src = src;
+			rpl_link(i);
 			return &replay_list[i];
 		}
 	}
@@ -261,6 +365,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_build();
 	}
 }
 
@@ -283,6 +388,7 @@ static int rpl_set(const char *name, size_t len_rd,
 	if (len_rd == 0) {
 		LOG_DBG("val (null)");
 		if (entry) {
+			rpl_unlink(rpl_idx(entry));
 			(void)memset(entry, 0, sizeof(*entry));
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
@@ -373,7 +479,7 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 			shift++;
 		} else if (atomic_test_and_clear_bit(store, i)) {
 			if (shift > 0) {
-				replay_list[i - shift] = *rpl;
+				rpl_move(i - shift, i);
 			}
 
 			store_rpl(&replay_list[i - shift]);
@@ -384,7 +490,7 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 			 * Otherwise, increment shift counter.
 			 */
 			if (atomic_test_and_clear_bit(store, i)) {
-				replay_list[i - shift] = *rpl;
+				rpl_move(i - shift, i);
 				atomic_set_bit(store, i - shift);
 			} else {
 				shift++;
@@ -402,6 +508,7 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_build();
 	}
 }
 
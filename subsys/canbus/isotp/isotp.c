@@ -105,6 +105,16 @@ static void receive_can_tx(const struct device *dev, int error, void *arg)
 	}
 }
 
+/*
+ * Hand the message received in the caller-supplied buffer over to
+ * isotp_recv_buf(). Can be called from the CAN RX callback.
+ */
+static void receive_user_buf_done(struct isotp_recv_ctx *rctx)
+{
+	rctx->user_buf_busy = true;
+	k_sem_give(&rctx->user_buf_sem);
+}
+
 static inline uint32_t receive_get_ff_length(struct net_buf *buf)
 {
 	uint32_t len;
@@ -278,6 +288,21 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		ud_rem_len = net_buf_user_data(rctx->buf);
 		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", rctx->length);
+		if (rctx->user_buf != NULL) {
+			if (rctx->length <= rctx->user_buf_size) {
+				memcpy(rctx->user_buf, rctx->buf->data, rctx->length);
+				rctx->user_buf_len = rctx->length;
+				receive_user_buf_done(rctx);
+			} else {
+				LOG_ERR("SF of length %d does not fit the buffer", rctx->length);
+			}
+
+			/* The SF buffer is reused for the next message */
+			net_buf_reset(rctx->buf);
+			rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+			break;
+		}
+
 		k_fifo_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_RECYCLE;
 		receive_state_machine(rctx);
@@ -287,6 +312,25 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		rctx->length = receive_get_ff_length(rctx->buf);
 		LOG_DBG("SM process FF. Length: %d", rctx->length);
 		rctx->length -= rctx->buf->len;
+		if (rctx->user_buf != NULL) {
+			if (rctx->length + rctx->buf->len > rctx->user_buf_size) {
+				LOG_ERR("Pkt length is %d but buffer has only %zu bytes",
+					rctx->length + rctx->buf->len, rctx->user_buf_size);
+				receive_report_error(rctx, ISOTP_N_BUFFER_OVERFLW);
+				receive_state_machine(rctx);
+				break;
+			}
+
+			/* The whole message fits, no allocation and no WAIT frames */
+			memcpy(rctx->user_buf, rctx->buf->data, rctx->buf->len);
+			rctx->user_buf_len = rctx->buf->len;
+			net_buf_reset(rctx->buf);
+			rctx->bs = rctx->opts.bs;
+			rctx->state = ISOTP_RX_STATE_SEND_FC;
+			receive_state_machine(rctx);
+			break;
+		}
+
 		if (rctx->opts.bs == 0 &&
 		    rctx->length > CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE) {
 			LOG_ERR("Pkt length is %d but buffer has only %d bytes", rctx->length,
@@ -346,6 +390,10 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		}
 
 		k_fifo_cancel_wait(&rctx->fifo);
+		if (rctx->user_buf != NULL) {
+			k_sem_give(&rctx->user_buf_sem);
+		}
+
 		net_buf_unref(rctx->buf);
 		rctx->buf = NULL;
 		rctx->state = ISOTP_RX_STATE_RECYCLE;
@@ -531,6 +579,24 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 
 	LOG_DBG("Got CF irq. Appending data");
 	data_len = MIN(rctx->length, can_dl - index);
+
+	if (rctx->user_buf != NULL) {
+		memcpy(&rctx->user_buf[rctx->user_buf_len], &frame->data[index], data_len);
+		rctx->user_buf_len += data_len;
+		rctx->length -= data_len;
+
+		if (rctx->length == 0) {
+			k_timer_stop(&rctx->timer);
+			rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
+			receive_user_buf_done(rctx);
+		} else if (rctx->opts.bs && !--rctx->bs) {
+			rctx->bs = rctx->opts.bs;
+			rctx->state = ISOTP_RX_STATE_SEND_FC;
+		}
+
+		return;
+	}
+
 	receive_add_mem(rctx, &frame->data[index], data_len);
 	rctx->length -= data_len;
 	LOG_DBG("%d bytes remaining", rctx->length);
@@ -564,6 +630,11 @@ static void receive_can_rx(const struct device *dev, struct can_frame *frame, vo
 	switch (rctx->state) {
 	case ISOTP_RX_STATE_WAIT_FF_SF:
 		__ASSERT_NO_MSG(rctx->buf);
+		if (rctx->user_buf != NULL && rctx->user_buf_busy) {
+			LOG_INF("Buffer holds a message not read yet. Ignore");
+			return;
+		}
+
 		process_ff_sf(rctx, frame);
 		break;
 
@@ -612,11 +683,11 @@ static inline int add_ff_sf_filter(struct isotp_recv_ctx *rctx)
 	return 0;
 }
 
-int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
-	       const struct isotp_msg_id *rx_addr,
-	       const struct isotp_msg_id *tx_addr,
-	       const struct isotp_fc_opts *opts,
-	       k_timeout_t timeout)
+static int bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
+		const struct isotp_msg_id *rx_addr,
+		const struct isotp_msg_id *tx_addr,
+		const struct isotp_fc_opts *opts,
+		k_timeout_t timeout)
 {
 	can_mode_t cap;
 	int ret;
@@ -669,6 +740,35 @@ int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
 	return ISOTP_N_OK;
 }
 
+int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
+	       const struct isotp_msg_id *rx_addr,
+	       const struct isotp_msg_id *tx_addr,
+	       const struct isotp_fc_opts *opts,
+	       k_timeout_t timeout)
+{
+	rctx->user_buf = NULL;
+
+	return bind(rctx, can_dev, rx_addr, tx_addr, opts, timeout);
+}
+
+int isotp_bind_buf(struct isotp_recv_ctx *rctx, const struct device *can_dev,
+		   const struct isotp_msg_id *rx_addr,
+		   const struct isotp_msg_id *tx_addr,
+		   const struct isotp_fc_opts *opts,
+		   uint8_t *buf, size_t size, k_timeout_t timeout)
+{
+	__ASSERT(buf, "buf is NULL");
+
+	rctx->user_buf = buf;
+	rctx->user_buf_size = size;
+	rctx->user_buf_len = 0;
+	rctx->user_buf_busy = false;
+	rctx->user_buf_taken = false;
+	k_sem_init(&rctx->user_buf_sem, 0, 1);
+
+	return bind(rctx, can_dev, rx_addr, tx_addr, opts, timeout);
+}
+
 void isotp_unbind(struct isotp_recv_ctx *rctx)
 {
 	struct net_buf *buf;
@@ -750,6 +850,37 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
 	return copied;
 }
 
+int isotp_recv_buf(struct isotp_recv_ctx *rctx, k_timeout_t timeout)
+{
+	int ret;
+
+	if (rctx->user_buf == NULL) {
+		return ISOTP_N_ERROR;
+	}
+
+	if (rctx->user_buf_taken) {
+		/* Release the message returned by the previous call */
+		rctx->user_buf_taken = false;
+		rctx->user_buf_busy = false;
+	}
+
+	if (k_sem_take(&rctx->user_buf_sem, timeout) != 0) {
+		return ISOTP_RECV_TIMEOUT;
+	}
+
+	if (!rctx->user_buf_busy) {
+		/* Woken up by a failed reception */
+		ret = rctx->error_nr ? rctx->error_nr : ISOTP_N_ERROR;
+		rctx->error_nr = 0;
+
+		return ret;
+	}
+
+	rctx->user_buf_taken = true;
+
+	return rctx->user_buf_len;
+}
+
 static inline void send_report_error(struct isotp_send_ctx *sctx, uint32_t err)
 {
 	sctx->state = ISOTP_TX_ERR;
@@ -1078,6 +1209,29 @@ static k_timeout_t stmin_to_timeout(uint8_t stmin)
 	return K_MSEC(stmin);
 }
 
+/*
+ * STmin values of 100 to 900 us are shorter than a tick on most systems, where
+ * a timer rounds them up to a full tick per CF. Wait them out in place instead.
+ */
+static bool stmin_busy_wait(uint8_t stmin)
+{
+	uint32_t us;
+
+	if (!IS_ENABLED(CONFIG_ISOTP_TX_STMIN_BUSY_WAIT) ||
+	    stmin < ISOTP_STMIN_US_BEGIN || stmin > ISOTP_STMIN_US_END) {
+		return false;
+	}
+
+	us = (stmin + 1 - ISOTP_STMIN_US_BEGIN) * 100U;
+	if (us >= k_ticks_to_us_ceil32(1)) {
+		return false;
+	}
+
+	k_busy_wait(us);
+
+	return true;
+}
+
 static void send_state_machine(struct isotp_send_ctx *sctx)
 {
 	int ret;
@@ -1114,7 +1268,7 @@ static void send_state_machine(struct isotp_send_ctx *sctx)
 				sctx->state = ISOTP_TX_WAIT_FC;
 				LOG_DBG("BS reached. Wait for FC again");
 				break;
-			} else if (sctx->opts.stmin) {
+			} else if (sctx->opts.stmin && !stmin_busy_wait(sctx->opts.stmin)) {
 				sctx->state = ISOTP_TX_WAIT_ST;
 				break;
 			}
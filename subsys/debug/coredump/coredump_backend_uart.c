@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/debug/coredump.h>
+#include "coredump_internal.h"
+
+/* Number of bytes per output line, printed as hex */
+#define UART_LINE_BYTES		32
+
+static const struct device *const uart_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_console));
+
+static int error;
+
+static void uart_puts(const char *s)
+{
+	while (*s != '\0') {
+		uart_poll_out(uart_dev, *s++);
+	}
+}
+
+static void coredump_uart_backend_start(void)
+{
+	/* Reset error */
+	error = 0;
+
+	if (!device_is_ready(uart_dev)) {
+		error = -ENODEV;
+		return;
+	}
+
+	uart_puts("\r\n" COREDUMP_PREFIX_STR COREDUMP_BEGIN_STR "\r\n");
+}
+
+static void coredump_uart_backend_end(void)
+{
+	if (error == -ENODEV) {
+		return;
+	}
+
+	if (error != 0) {
+		uart_puts(COREDUMP_PREFIX_STR COREDUMP_ERROR_STR "\r\n");
+	}
+
+	uart_puts(COREDUMP_PREFIX_STR COREDUMP_END_STR "\r\n");
+}
+
+static void coredump_uart_backend_buffer_output(uint8_t *buf, size_t buflen)
+{
+	char hex[2];
+	size_t i;
+
+	if (error == -ENODEV) {
+		return;
+	}
+
+	if ((buf == NULL) || (buflen == 0)) {
+		error = -EINVAL;
+		return;
+	}
+
+	for (i = 0; i < buflen; i++) {
+		if ((i % UART_LINE_BYTES) == 0) {
+			uart_puts(COREDUMP_PREFIX_STR);
+		}
+
+		hex2char(buf[i] >> 4, &hex[0]);
+		hex2char(buf[i] & 0xf, &hex[1]);
+		uart_poll_out(uart_dev, hex[0]);
+		uart_poll_out(uart_dev, hex[1]);
+
+		if ((((i + 1) % UART_LINE_BYTES) == 0) || ((i + 1) == buflen)) {
+			uart_puts("\r\n");
+		}
+	}
+}
+
+static int coredump_uart_backend_query(enum coredump_query_id query_id,
+				       void *arg)
+{
+	int ret;
+
+	ARG_UNUSED(arg);
+
+	switch (query_id) {
+	case COREDUMP_QUERY_GET_ERROR:
+		ret = error;
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	return ret;
+}
+
+static int coredump_uart_backend_cmd(enum coredump_cmd_id cmd_id,
+				     void *arg)
+{
+	int ret;
+
+	ARG_UNUSED(arg);
+
+	switch (cmd_id) {
+	case COREDUMP_CMD_CLEAR_ERROR:
+		ret = 0;
+		error = 0;
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	return ret;
+}
+
+struct coredump_backend_api coredump_backend_uart = {
+	.start = coredump_uart_backend_start,
+	.end = coredump_uart_backend_end,
+	.buffer_output = coredump_uart_backend_buffer_output,
+	.query = coredump_uart_backend_query,
+	.cmd = coredump_uart_backend_cmd,
+};
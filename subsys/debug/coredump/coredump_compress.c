@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "coredump_internal.h"
+
+/*
+ * Minimal greedy LZ4 block format encoder.
+ *
+ * This runs from the fatal error handler, so it must not allocate
+ * and must not depend on anything but its own static state.
+ */
+
+#define LZ4_MIN_MATCH		4
+
+/* The last 5 bytes of a block are always literals */
+#define LZ4_LAST_LITERALS	5
+
+/* The last match must start at least 12 bytes before the end */
+#define LZ4_MFLIMIT		12
+
+#define LZ4_HASH_BITS		12
+
+static uint16_t hash_table[1 << LZ4_HASH_BITS];
+
+static inline uint32_t read32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+	       ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t lz4_hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+static uint8_t *put_length(uint8_t *op, size_t len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+
+	*op++ = (uint8_t)len;
+
+	return op;
+}
+
+static uint8_t *put_literals(uint8_t *op, uint8_t *token,
+			     const uint8_t *lit, size_t len)
+{
+	*token = (uint8_t)(MIN(len, 15) << 4);
+
+	if (len >= 15) {
+		op = put_length(op, len - 15);
+	}
+
+	memcpy(op, lit, len);
+
+	return op + len;
+}
+
+size_t z_coredump_compress(const uint8_t *src, size_t len, uint8_t *dst)
+{
+	uint8_t *op = dst;
+	uint8_t *token;
+	size_t anchor = 0;
+	size_t ip = 0;
+
+	memset(hash_table, 0, sizeof(hash_table));
+
+	while ((len > LZ4_MFLIMIT) && (ip < (len - LZ4_MFLIMIT))) {
+		uint32_t seq = read32(&src[ip]);
+		uint32_t h = lz4_hash(seq);
+		size_t ref = hash_table[h];
+		size_t mlen;
+		size_t off;
+
+		hash_table[h] = (uint16_t)ip;
+
+		if ((ref >= ip) || (read32(&src[ref]) != seq)) {
+			ip++;
+			continue;
+		}
+
+		mlen = LZ4_MIN_MATCH;
+		while (((ip + mlen) < (len - LZ4_LAST_LITERALS)) &&
+		       (src[ref + mlen] == src[ip + mlen])) {
+			mlen++;
+		}
+
+		token = op++;
+		op = put_literals(op, token, &src[anchor], ip - anchor);
+
+		off = ip - ref;
+		*op++ = (uint8_t)(off & 0xff);
+		*op++ = (uint8_t)(off >> 8);
+
+		mlen -= LZ4_MIN_MATCH;
+		*token |= (uint8_t)MIN(mlen, 15);
+		if (mlen >= 15) {
+			op = put_length(op, mlen - 15);
+		}
+
+		ip += mlen + LZ4_MIN_MATCH;
+		anchor = ip;
+	}
+
+	token = op++;
+	op = put_literals(op, token, &src[anchor], len - anchor);
+
+	return op - dst;
+}
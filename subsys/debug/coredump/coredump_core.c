@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <string.h>
 #include <kernel_internal.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
@@ -20,6 +21,10 @@ static struct coredump_backend_api
 extern struct coredump_backend_api coredump_backend_flash_partition;
 static struct coredump_backend_api
 	*backend_api = &coredump_backend_flash_partition;
+#elif defined(CONFIG_DEBUG_COREDUMP_BACKEND_UART)
+extern struct coredump_backend_api coredump_backend_uart;
+static struct coredump_backend_api
+	*backend_api = &coredump_backend_uart;
 #elif defined(CONFIG_DEBUG_COREDUMP_BACKEND_INTEL_ADSP_MEM_WINDOW)
 extern struct coredump_backend_api coredump_backend_intel_adsp_mem_window;
 static struct coredump_backend_api
@@ -37,6 +42,58 @@ static struct coredump_backend_api
 #define DT_DRV_COMPAT zephyr_coredump
 #endif
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+#define COMPRESS_BLK_SZ		CONFIG_DEBUG_COREDUMP_COMPRESS_BLOCK_SIZE
+
+static uint8_t compress_in[COMPRESS_BLK_SZ];
+static uint8_t compress_out[Z_COREDUMP_COMPRESS_BOUND(COMPRESS_BLK_SZ)];
+static size_t compress_in_len;
+
+static void compress_flush(void)
+{
+	struct coredump_compress_blk_hdr_t hdr;
+	size_t comp_len;
+
+	if (compress_in_len == 0) {
+		return;
+	}
+
+	comp_len = z_coredump_compress(compress_in, compress_in_len,
+				       compress_out);
+
+	hdr.raw_len = sys_cpu_to_le16(compress_in_len);
+
+	if (comp_len < compress_in_len) {
+		hdr.comp_len = sys_cpu_to_le16(comp_len);
+		backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
+		backend_api->buffer_output(compress_out, comp_len);
+	} else {
+		/* Incompressible, store as is */
+		hdr.comp_len = 0;
+		backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
+		backend_api->buffer_output(compress_in, compress_in_len);
+	}
+
+	compress_in_len = 0;
+}
+
+static void compress_output(uint8_t *buf, size_t buflen)
+{
+	while (buflen > 0) {
+		size_t len = MIN(buflen, COMPRESS_BLK_SZ - compress_in_len);
+
+		memcpy(&compress_in[compress_in_len], buf, len);
+		compress_in_len += len;
+		buf += len;
+		buflen -= len;
+
+		if (compress_in_len == COMPRESS_BLK_SZ) {
+			compress_flush();
+		}
+	}
+}
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESS */
+
 #if defined(CONFIG_DEBUG_COREDUMP_DUMP_THREAD_PRIV_STACK)
 __weak void arch_coredump_priv_stack_dump(struct k_thread *thread)
 {
@@ -63,6 +120,10 @@ static void dump_header(unsigned int reason)
 
 	hdr.tgt_code = sys_cpu_to_le16(arch_coredump_tgt_code_get());
 
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESS)) {
+		hdr.flag |= COREDUMP_HDR_FLAG_COMPRESSED;
+	}
+
 	backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
 }
 
@@ -194,11 +255,19 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 
 void z_coredump_start(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+	compress_in_len = 0;
+#endif
+
 	backend_api->start();
 }
 
 void z_coredump_end(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+	compress_flush();
+#endif
+
 	backend_api->end();
 }
 
@@ -209,7 +278,11 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 		return;
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+	compress_output(buf, buflen);
+#else
 	backend_api->buffer_output(buf, buflen);
+#endif
 }
 
 void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
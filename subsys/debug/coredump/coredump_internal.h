@@ -43,6 +43,22 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS
+/** Worst case LZ4 output size for an input of @p n bytes */
+#define Z_COREDUMP_COMPRESS_BOUND(n)	((n) + ((n) / 255) + 16)
+
+/**
+ * @brief Compress a buffer into one LZ4 block
+ *
+ * @param src Data to compress
+ * @param len Number of bytes in @p src (at most 65535)
+ * @param dst Output buffer of at least Z_COREDUMP_COMPRESS_BOUND(len) bytes
+ *
+ * @return Number of bytes written to @p dst
+ */
+size_t z_coredump_compress(const uint8_t *src, size_t len, uint8_t *dst);
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESS */
+
 /**
  * @endcond
  */
@@ -36,6 +36,78 @@ LOG_MODULE_REGISTER(thread_analyzer, CONFIG_THREAD_ANALYZER_LOG_LEVEL);
  */
 #define PTR_STR_MAXLEN (sizeof(void *) * 2 + 2)
 
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+/* @brief Continue the incremental scan of a stack buffer
+ *
+ * Only the part of the stack below the known watermark can still turn out
+ * to be used, and at most CONFIG_THREAD_ANALYZER_INCREMENTAL_CHUNK bytes of
+ * it are checked, resuming at @p scan_pos. The watermark is counted from
+ * the top of the buffer so it stays valid if the bottom is adjusted.
+ *
+ * @return Number of unused bytes according to the last completed scan.
+ */
+static size_t stack_scan_incremental(const uint8_t *buf, size_t size,
+				     size_t *watermark, size_t *scan_pos)
+{
+	size_t limit;
+	size_t end;
+	size_t i;
+
+	if (IS_ENABLED(CONFIG_STACK_SENTINEL)) {
+		/* Skip the sentinel, as z_stack_space_get() does */
+		buf += 4;
+		size -= 4;
+	}
+
+	limit = size - MIN(*watermark, size);
+	end = MIN(*scan_pos + CONFIG_THREAD_ANALYZER_INCREMENTAL_CHUNK, limit);
+
+	for (i = *scan_pos; i < end; i++) {
+		if (buf[i] != 0xaaU) {
+			break;
+		}
+	}
+
+	if (i < end) {
+		/* New watermark found, restart from the bottom next time */
+		*watermark = size - i;
+		*scan_pos = 0;
+	} else if (end == limit) {
+		*scan_pos = 0;
+	} else {
+		*scan_pos = end;
+	}
+
+	return size - MIN(*watermark, size);
+}
+
+static int thread_stack_space_get(struct k_thread *thread, size_t *unused)
+{
+#ifdef CONFIG_THREAD_STACK_MEM_MAPPED
+	if (thread->stack_info.mapped.addr == NULL) {
+		return -EINVAL;
+	}
+#endif
+
+	if (IS_ENABLED(CONFIG_NO_UNUSED_STACK_INSPECTION) &&
+	    (thread == k_current_get())) {
+		return -ENOTSUP;
+	}
+
+	*unused = stack_scan_incremental((const uint8_t *)thread->stack_info.start,
+					 thread->stack_info.size,
+					 &thread->stack_info.watermark,
+					 &thread->stack_info.scan_pos);
+
+	return 0;
+}
+#else
+static int thread_stack_space_get(struct k_thread *thread, size_t *unused)
+{
+	return k_thread_stack_space_get(thread, unused);
+}
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+
 static void thread_print_cb(struct thread_analyzer_info *info)
 {
 	size_t pcnt = (info->stack_used * 100U) / info->stack_size;
@@ -114,7 +186,7 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 		snprintk(hexname, sizeof(hexname), "%p", (void *)thread);
 	}
 
-	err = k_thread_stack_space_get(thread, &unused);
+	err = thread_stack_space_get(thread, &unused);
 	if (err) {
 		THREAD_ANALYZER_PRINT(
 			THREAD_ANALYZER_FMT(
@@ -169,6 +241,11 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 K_KERNEL_STACK_ARRAY_DECLARE(z_interrupt_stacks, CONFIG_MP_MAX_NUM_CPUS,
 			     CONFIG_ISR_STACK_SIZE);
 
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+static size_t isr_stack_watermark[CONFIG_MP_MAX_NUM_CPUS];
+static size_t isr_stack_scan_pos[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 static void isr_stack(int core)
 {
 	const uint8_t *buf = K_KERNEL_STACK_BUFFER(z_interrupt_stacks[core]);
@@ -176,7 +253,13 @@ static void isr_stack(int core)
 	size_t unused;
 	int err;
 
+#ifdef CONFIG_THREAD_ANALYZER_INCREMENTAL
+	unused = stack_scan_incremental(buf, size, &isr_stack_watermark[core],
+					&isr_stack_scan_pos[core]);
+	err = 0;
+#else
 	err = z_stack_space_get(buf, size, &unused);
+#endif
 	if (err == 0) {
 		THREAD_ANALYZER_PRINT(
 			THREAD_ANALYZER_FMT(
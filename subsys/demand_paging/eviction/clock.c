@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* The clock hand sweeps the page frames circularly. A page accessed since
+ * the hand last passed over it is in the working set: its accessed state is
+ * cleared and it is skipped. The first clean, not accessed page is evicted.
+ *
+ * Dirty, not accessed pages are only remembered during one revolution of
+ * the hand, the first of them is evicted if no clean page was found.
+ * After one revolution every accessed state has been cleared, so the sweep
+ * always ends within two revolutions.
+ */
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	static uint32_t hand;
+	struct k_mem_page_frame *pf, *dirty_pf = NULL;
+	uintptr_t flags;
+	void *addr;
+
+	for (size_t i = 0; i < 2 * ARRAY_SIZE(k_mem_page_frames); i++) {
+		if (dirty_pf != NULL && i >= ARRAY_SIZE(k_mem_page_frames)) {
+			break;
+		}
+
+		pf = &k_mem_page_frames[hand];
+		hand = (hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		addr = k_mem_page_frame_to_virt(pf);
+		flags = arch_page_info_get(addr, NULL, false);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			/* Second chance */
+			(void)arch_page_info_get(addr, NULL, true);
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0U) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+/*
+ * unused interfaces
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
@@ -43,6 +43,101 @@ BUILD_ASSERT((CONFIG_IMG_BLOCK_BUF_SIZE % FLASH_WRITE_BLOCK_SIZE == 0),
 	     "FLASH_WRITE_BLOCK_SIZE");
 #endif
 
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+#define HASH_SUCCESS PSA_SUCCESS
+#else
+#define HASH_SUCCESS 0
+#endif
+
+static void flash_img_hash_start(struct flash_img_context *ctx, uint8_t area_id)
+{
+	int rc;
+
+	ctx->hash_len = 0;
+	ctx->hash_area_id = area_id;
+	ctx->hash_done = false;
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	ctx->hash_ctx = psa_hash_operation_init();
+	rc = psa_hash_setup(&ctx->hash_ctx, PSA_ALG_SHA_256);
+#else
+	mbedtls_sha256_init(&ctx->hash_ctx);
+	rc = mbedtls_sha256_starts(&ctx->hash_ctx, false);
+#endif
+
+	ctx->hash_running = (rc == HASH_SUCCESS);
+}
+
+/* flash_img_check() falls back to reading the image when no hash is kept */
+static void flash_img_hash_abort(struct flash_img_context *ctx)
+{
+	if (!ctx->hash_running) {
+		return;
+	}
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	psa_hash_abort(&ctx->hash_ctx);
+#else
+	mbedtls_sha256_free(&ctx->hash_ctx);
+#endif
+
+	ctx->hash_running = false;
+}
+
+static void flash_img_hash_update(struct flash_img_context *ctx, const uint8_t *data,
+				  size_t len)
+{
+	int rc;
+
+	if (!ctx->hash_running || len == 0) {
+		return;
+	}
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	rc = psa_hash_update(&ctx->hash_ctx, data, len);
+#else
+	rc = mbedtls_sha256_update(&ctx->hash_ctx, data, len);
+#endif
+	if (rc != HASH_SUCCESS) {
+		flash_img_hash_abort(ctx);
+		return;
+	}
+
+	ctx->hash_len += len;
+}
+
+static void flash_img_hash_finish(struct flash_img_context *ctx)
+{
+	int rc;
+
+	if (!ctx->hash_running) {
+		return;
+	}
+
+	/* Data written before the hash started, e.g. when resuming, is not hashed */
+	if (ctx->hash_len != stream_flash_bytes_written(&ctx->stream)) {
+		flash_img_hash_abort(ctx);
+		return;
+	}
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	size_t hash_len;
+
+	rc = psa_hash_finish(&ctx->hash_ctx, ctx->hash, sizeof(ctx->hash), &hash_len);
+	if (rc != HASH_SUCCESS) {
+		psa_hash_abort(&ctx->hash_ctx);
+	}
+#else
+	rc = mbedtls_sha256_finish(&ctx->hash_ctx, ctx->hash);
+	mbedtls_sha256_free(&ctx->hash_ctx);
+#endif
+
+	ctx->hash_running = false;
+	ctx->hash_done = (rc == HASH_SUCCESS);
+}
+#endif /* CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL */
+
 static int scramble_mcuboot_trailer(struct flash_img_context *ctx)
 {
 	int rc = 0;
@@ -112,6 +207,18 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	 * ensures that stream_flash erases flash progresively.
 	 */
 	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+	if (rc == 0) {
+		flash_img_hash_update(ctx, data, len);
+		if (flush) {
+			flash_img_hash_finish(ctx);
+		}
+	} else {
+		flash_img_hash_abort(ctx);
+	}
+#endif
+
 	if (!flush) {
 		return rc;
 	}
@@ -140,6 +247,10 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+	flash_img_hash_start(ctx, area_id);
+#endif
+
 	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
@@ -162,6 +273,14 @@ int flash_img_check(struct flash_img_context *ctx,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK_INCREMENTAL)
+	/* The image was hashed while written, no need to read it back */
+	if (ctx->hash_done && ctx->hash_area_id == area_id && fic->match != NULL &&
+	    fic->clen == ctx->hash_len) {
+		return memcmp(ctx->hash, fic->match, sizeof(ctx->hash)) == 0 ? 0 : -EILSEQ;
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			     (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
@@ -14,6 +14,8 @@
 #include <errno.h>
 #include <zephyr/device.h>
 
+#include "disk_cache.h"
+
 #define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
@@ -24,6 +26,16 @@ static sys_dlist_t disk_access_list = SYS_DLIST_STATIC_INIT(&disk_access_list);
 /* lock to protect storage layer registration */
 static struct k_spinlock lock;
 
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+static bool disk_access_cached(struct disk_info *disk, uint32_t start_sector,
+			       uint32_t num_sector)
+{
+	/* Out of bounds requests go to the driver, which rejects them */
+	return (start_sector < disk->cache_sectors) &&
+	       (num_sector <= disk->cache_sectors - start_sector);
+}
+#endif
+
 struct disk_info *disk_access_get_di(const char *name)
 {
 	struct disk_info *disk = NULL, *itr;
@@ -66,6 +78,9 @@ int disk_access_init(const char *pdrv)
 			if (rc == 0) {
 				/* Increment reference count */
 				disk->refcnt++;
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+				disk_cache_attach(disk);
+#endif
 			}
 		}
 	} else if ((disk != NULL) && (disk->refcnt < UINT16_MAX)) {
@@ -98,6 +113,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+		if (disk_access_cached(disk, start_sector, num_sector)) {
+			return disk_cache_read(disk, data_buf, start_sector, num_sector);
+		}
+#endif
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -112,6 +132,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+		if (disk_access_cached(disk, start_sector, num_sector)) {
+			return disk_cache_write(disk, data_buf, start_sector, num_sector);
+		}
+#endif
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -131,6 +156,9 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt++;
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+					disk_cache_attach(disk);
+#endif
 				}
 			} else if (disk->refcnt < UINT16_MAX) {
 				disk->refcnt++;
@@ -142,10 +170,22 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 		case DISK_IOCTL_CTRL_DEINIT:
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+				(void)disk_cache_sync(disk);
+				disk_cache_detach(disk);
+#endif
 				disk->refcnt = 0U;
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+				rc = disk_cache_sync(disk);
+				if (rc != 0) {
+					break;
+				}
+
+				disk_cache_detach(disk);
+#endif
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt--;
@@ -157,6 +197,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = disk_cache_sync(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
+#endif
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -165,6 +213,21 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 	return rc;
 }
 
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+int disk_access_cache_stats_get(const char *pdrv, struct disk_cache_stats *stats)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+
+	if ((disk == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	disk_cache_stats_get(disk, stats);
+
+	return 0;
+}
+#endif
+
 int disk_access_register(struct disk_info *disk)
 {
 	k_spinlock_key_t spinlock_key;
@@ -181,6 +244,10 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+	disk->cache_sectors = 0U;
+	memset(&disk->cache_stats, 0, sizeof(disk->cache_stats));
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -204,6 +271,10 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+	disk_cache_detach(disk);
+#endif
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
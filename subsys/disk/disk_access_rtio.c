@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/storage/disk_access.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk, CONFIG_DISK_LOG_LEVEL);
+
+/*
+ * A request is a transaction of two submissions: a tiny write holding the
+ * start sector (32-bit little endian), followed by the read or write of the
+ * data.
+ */
+struct disk_access_iodev_req {
+	struct rtio_iodev_sqe *first;
+	uint8_t op;
+	uint32_t sector;
+	uint32_t count;
+	uint8_t *buf;
+};
+
+/* Pops the next queued request. When the queue is empty and idle is set,
+ * the device is marked idle so that the next submission starts a new work
+ * item.
+ */
+static struct rtio_iodev_sqe *disk_access_iodev_next(struct disk_access_iodev_data *data,
+						      bool idle)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	struct mpsc_node *node = mpsc_pop(&data->pending);
+
+	if (node == NULL && idle) {
+		data->busy = false;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return node == NULL ? NULL : CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+}
+
+static int disk_access_iodev_parse(struct rtio_iodev_sqe *first, uint32_t sector_size,
+				   struct disk_access_iodev_req *req)
+{
+	struct rtio_iodev_sqe *data = rtio_txn_next(first);
+	uint32_t buf_len;
+
+	if (first->sqe.op != RTIO_OP_TINY_TX || first->sqe.tiny_tx.buf_len != sizeof(uint32_t) ||
+	    data == NULL) {
+		return -EINVAL;
+	}
+
+	switch (data->sqe.op) {
+	case RTIO_OP_RX:
+		req->buf = data->sqe.rx.buf;
+		buf_len = data->sqe.rx.buf_len;
+		break;
+	case RTIO_OP_TX:
+		req->buf = (uint8_t *)data->sqe.tx.buf;
+		buf_len = data->sqe.tx.buf_len;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (buf_len == 0U || (buf_len % sector_size) != 0U) {
+		return -EINVAL;
+	}
+
+	req->first = first;
+	req->op = data->sqe.op;
+	req->sector = sys_get_le32(first->sqe.tiny_tx.buf);
+	req->count = buf_len / sector_size;
+
+	return 0;
+}
+
+static void disk_access_iodev_work(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct disk_access_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_iodev_sqe *merged[CONFIG_DISK_ACCESS_RTIO_MERGE_MAX];
+	struct disk_access_iodev_req req, next;
+	struct rtio_iodev_sqe *curr;
+	uint32_t sector_size;
+	size_t num_merged;
+	int rc;
+
+	rc = disk_access_ioctl(data->pdrv, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size);
+	if (rc == 0 && sector_size == 0U) {
+		rc = -EIO;
+	}
+
+	curr = disk_access_iodev_next(data, true);
+
+	while (curr != NULL) {
+		if (rc != 0) {
+			rtio_iodev_sqe_err(curr, rc);
+			curr = disk_access_iodev_next(data, true);
+			continue;
+		}
+
+		if (disk_access_iodev_parse(curr, sector_size, &req) != 0) {
+			LOG_ERR("%s: invalid request %p", data->pdrv, (void *)curr);
+			rtio_iodev_sqe_err(curr, -EINVAL);
+			curr = disk_access_iodev_next(data, true);
+			continue;
+		}
+
+		merged[0] = curr;
+		num_merged = 1;
+		curr = NULL;
+
+		/* Merge the following requests continuing this one on the disk and in memory */
+		while (num_merged < ARRAY_SIZE(merged)) {
+			curr = disk_access_iodev_next(data, false);
+			if (curr == NULL ||
+			    disk_access_iodev_parse(curr, sector_size, &next) != 0 ||
+			    next.op != req.op || next.sector != req.sector + req.count ||
+			    next.buf != req.buf + req.count * sector_size) {
+				break;
+			}
+
+			merged[num_merged++] = curr;
+			req.count += next.count;
+			curr = NULL;
+		}
+
+		if (req.op == RTIO_OP_RX) {
+			rc = disk_access_read(data->pdrv, req.buf, req.sector, req.count);
+		} else {
+			rc = disk_access_write(data->pdrv, req.buf, req.sector, req.count);
+		}
+
+		for (size_t i = 0; i < num_merged; i++) {
+			if (rc != 0) {
+				rtio_iodev_sqe_err(merged[i], rc);
+			} else {
+				rtio_iodev_sqe_ok(merged[i], 0);
+			}
+		}
+
+		/* A failed access only fails its own requests */
+		rc = 0;
+
+		if (curr == NULL) {
+			curr = disk_access_iodev_next(data, true);
+		}
+	}
+}
+
+static void disk_access_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct disk_access_iodev_data *data = iodev_sqe->sqe.iodev->data;
+	struct rtio_work_req *req;
+	k_spinlock_key_t key;
+	bool start;
+
+	key = k_spin_lock(&data->lock);
+	mpsc_push(&data->pending, &iodev_sqe->q);
+	start = !data->busy;
+	data->busy = true;
+	k_spin_unlock(&data->lock, key);
+
+	if (!start) {
+		/* The running work item picks it up */
+		return;
+	}
+
+	req = rtio_work_req_alloc();
+	if (req == NULL) {
+		while ((iodev_sqe = disk_access_iodev_next(data, true)) != NULL) {
+			rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		}
+
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, disk_access_iodev_work);
+}
+
+const struct rtio_iodev_api disk_access_iodev_api = {
+	.submit = disk_access_iodev_submit,
+};
+
+static struct rtio_sqe *disk_access_rtio_prep(struct rtio *r, const struct rtio_iodev *iodev,
+					      uint32_t start_sector)
+{
+	struct rtio_sqe *sector_sqe = rtio_sqe_acquire(r);
+	struct rtio_sqe *data_sqe = rtio_sqe_acquire(r);
+	uint8_t sector[sizeof(uint32_t)];
+
+	if (sector_sqe == NULL || data_sqe == NULL) {
+		rtio_sqe_drop_all(r);
+		return NULL;
+	}
+
+	sys_put_le32(start_sector, sector);
+	rtio_sqe_prep_tiny_write(sector_sqe, iodev, RTIO_PRIO_NORM, sector, sizeof(sector),
+				 NULL);
+	sector_sqe->flags |= RTIO_SQE_TRANSACTION | RTIO_SQE_NO_RESPONSE;
+
+	return data_sqe;
+}
+
+struct rtio_sqe *disk_access_rtio_read(struct rtio *r, const struct rtio_iodev *iodev,
+				       uint8_t *data_buf, uint32_t start_sector,
+				       uint32_t buf_len, void *userdata)
+{
+	struct rtio_sqe *sqe = disk_access_rtio_prep(r, iodev, start_sector);
+
+	if (sqe != NULL) {
+		rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, data_buf, buf_len, userdata);
+	}
+
+	return sqe;
+}
+
+struct rtio_sqe *disk_access_rtio_write(struct rtio *r, const struct rtio_iodev *iodev,
+					const uint8_t *data_buf, uint32_t start_sector,
+					uint32_t buf_len, void *userdata)
+{
+	struct rtio_sqe *sqe = disk_access_rtio_prep(r, iodev, start_sector);
+
+	if (sqe != NULL) {
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, data_buf, buf_len, userdata);
+	}
+
+	return sqe;
+}
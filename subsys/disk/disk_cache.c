@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/drivers/disk.h>
+
+#include "disk_cache.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk, CONFIG_DISK_LOG_LEVEL);
+
+#define CACHE_SECTOR_SIZE CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE
+
+struct disk_cache_block {
+	/* Position in the LRU list, the least recently used block is first */
+	sys_dnode_t node;
+	/* Disk of the cached sector, NULL if the block is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+};
+
+static struct disk_cache_block cache_blocks[CONFIG_DISK_ACCESS_CACHE_SECTORS];
+static uint8_t cache_data[CONFIG_DISK_ACCESS_CACHE_SECTORS][CACHE_SECTOR_SIZE] __aligned(4);
+#if CONFIG_DISK_ACCESS_CACHE_READ_AHEAD > 0
+static uint8_t cache_ahead[CONFIG_DISK_ACCESS_CACHE_READ_AHEAD * CACHE_SECTOR_SIZE] __aligned(4);
+#endif
+
+static sys_dlist_t cache_lru = SYS_DLIST_STATIC_INIT(&cache_lru);
+static K_MUTEX_DEFINE(cache_lock);
+
+static uint8_t *cache_block_data(struct disk_cache_block *block)
+{
+	return cache_data[block - cache_blocks];
+}
+
+/* Look up the block caching a sector, cache_lock must be held */
+static struct disk_cache_block *cache_find_locked(struct disk_info *disk, uint32_t sector)
+{
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if (cache_blocks[i].disk == disk && cache_blocks[i].sector == sector) {
+			return &cache_blocks[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Mark a block as the most recently used, cache_lock must be held */
+static void cache_touch_locked(struct disk_cache_block *block)
+{
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	sys_dlist_remove(&block->node);
+	sys_dlist_append(&cache_lru, &block->node);
+}
+
+/* Write a dirty block to its disk, cache_lock must be held */
+static int cache_write_back_locked(struct disk_cache_block *block)
+{
+	int rc;
+
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	if (!block->dirty) {
+		return 0;
+	}
+
+	rc = block->disk->ops->write(block->disk, cache_block_data(block), block->sector, 1);
+	if (rc != 0) {
+		LOG_ERR("%s: write back of sector %u failed (%d)", block->disk->name,
+			block->sector, rc);
+		return rc;
+	}
+
+	block->dirty = false;
+	block->disk->cache_stats.write_backs++;
+
+	return 0;
+}
+
+/* Reuses the least recently used block for a sector, cache_lock must be held */
+static struct disk_cache_block *cache_alloc_locked(struct disk_info *disk, uint32_t sector)
+{
+	struct disk_cache_block *block;
+
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	block = SYS_DLIST_PEEK_HEAD_CONTAINER(&cache_lru, block, node);
+	if (cache_write_back_locked(block) != 0) {
+		return NULL;
+	}
+
+	block->disk = disk;
+	block->sector = sector;
+	cache_touch_locked(block);
+
+	return block;
+}
+
+/* Copy sectors read from the disk into the cache, cache_lock must be held */
+static void cache_fill_locked(struct disk_info *disk, const uint8_t *data_buf,
+			      uint32_t start_sector, uint32_t num_sector)
+{
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		struct disk_cache_block *block = cache_alloc_locked(disk, start_sector + i);
+
+		if (block == NULL) {
+			return;
+		}
+
+		memcpy(cache_block_data(block), &data_buf[i * CACHE_SECTOR_SIZE],
+		       CACHE_SECTOR_SIZE);
+	}
+}
+
+/* Cache the sectors following a read, cache_lock must be held */
+static void cache_read_ahead_locked(struct disk_info *disk, uint32_t sector)
+{
+#if CONFIG_DISK_ACCESS_CACHE_READ_AHEAD > 0
+	uint32_t count;
+
+	__ASSERT_NO_MSG(cache_lock.owner == k_current_get());
+
+	if (sector >= disk->cache_sectors) {
+		return;
+	}
+
+	/* Stop at the end of the disk or at the first sector already cached */
+	for (count = 0; count < MIN(CONFIG_DISK_ACCESS_CACHE_READ_AHEAD,
+				    disk->cache_sectors - sector); count++) {
+		if (cache_find_locked(disk, sector + count) != NULL) {
+			break;
+		}
+	}
+
+	if (count == 0 || disk->ops->read(disk, cache_ahead, sector, count) != 0) {
+		return;
+	}
+
+	cache_fill_locked(disk, cache_ahead, sector, count);
+	disk->cache_stats.read_ahead += count;
+#else
+	ARG_UNUSED(disk);
+	ARG_UNUSED(sector);
+#endif
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size;
+	uint32_t sector_count;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (sys_dlist_is_empty(&cache_lru)) {
+		for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+			sys_dlist_append(&cache_lru, &cache_blocks[i].node);
+		}
+	}
+
+	disk->cache_sectors = 0U;
+
+	if ((disk->ops->ioctl != NULL) &&
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) == 0) &&
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) == 0)) {
+		if (sector_size == CACHE_SECTOR_SIZE) {
+			disk->cache_sectors = sector_count;
+		} else {
+			LOG_INF("%s: sector size %u not cached", disk->name, sector_size);
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void disk_cache_detach(struct disk_info *disk)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		struct disk_cache_block *block = &cache_blocks[i];
+
+		if (block->disk != disk) {
+			continue;
+		}
+
+		if (block->dirty) {
+			LOG_WRN("%s: sector %u dropped before write back", disk->name,
+				block->sector);
+		}
+
+		block->disk = NULL;
+		block->dirty = false;
+
+		/* Free blocks are reused first */
+		sys_dlist_remove(&block->node);
+		sys_dlist_prepend(&cache_lru, &block->node);
+	}
+
+	disk->cache_sectors = 0U;
+
+	k_mutex_unlock(&cache_lock);
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	uint32_t i = 0;
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	while (i < num_sector) {
+		uint32_t count;
+
+		block = cache_find_locked(disk, start_sector + i);
+		if (block != NULL) {
+			memcpy(&data_buf[i * CACHE_SECTOR_SIZE], cache_block_data(block),
+			       CACHE_SECTOR_SIZE);
+			cache_touch_locked(block);
+			disk->cache_stats.hits++;
+			i++;
+			continue;
+		}
+
+		/* Read the sectors up to the next cached one at once */
+		for (count = 1; i + count < num_sector; count++) {
+			if (cache_find_locked(disk, start_sector + i + count) != NULL) {
+				break;
+			}
+		}
+
+		rc = disk->ops->read(disk, &data_buf[i * CACHE_SECTOR_SIZE],
+				     start_sector + i, count);
+		if (rc != 0) {
+			break;
+		}
+
+		disk->cache_stats.misses += count;
+		cache_fill_locked(disk, &data_buf[i * CACHE_SECTOR_SIZE], start_sector + i, count);
+		i += count;
+
+		if (i == num_sector) {
+			cache_read_ahead_locked(disk, start_sector + num_sector);
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *block;
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+#if defined(CONFIG_DISK_ACCESS_CACHE_WRITE_BACK)
+	/* Large writes are written through, so they do not flush the cache */
+	if (num_sector <= ARRAY_SIZE(cache_blocks) / 2) {
+		for (uint32_t i = 0; i < num_sector; i++) {
+			const uint8_t *data = &data_buf[i * CACHE_SECTOR_SIZE];
+
+			block = cache_find_locked(disk, start_sector + i);
+			if (block == NULL) {
+				block = cache_alloc_locked(disk, start_sector + i);
+			}
+
+			if (block == NULL) {
+				rc = disk->ops->write(disk, data, start_sector + i, 1);
+				if (rc != 0) {
+					break;
+				}
+
+				continue;
+			}
+
+			memcpy(cache_block_data(block), data, CACHE_SECTOR_SIZE);
+			block->dirty = true;
+			cache_touch_locked(block);
+		}
+
+		goto unlock;
+	}
+#endif
+
+	rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+	if (rc != 0) {
+		goto unlock;
+	}
+
+	/* Keep the cached copies up to date */
+	for (uint32_t i = 0; i < num_sector; i++) {
+		block = cache_find_locked(disk, start_sector + i);
+		if (block != NULL) {
+			memcpy(cache_block_data(block), &data_buf[i * CACHE_SECTOR_SIZE],
+			       CACHE_SECTOR_SIZE);
+			block->dirty = false;
+		}
+	}
+
+unlock:
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+	int rc2;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if (cache_blocks[i].disk != disk) {
+			continue;
+		}
+
+		rc2 = cache_write_back_locked(&cache_blocks[i]);
+		if (rc == 0) {
+			rc = rc2;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_cache_stats_get(struct disk_info *disk, struct disk_cache_stats *stats)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*stats = disk->cache_stats;
+	k_mutex_unlock(&cache_lock);
+}
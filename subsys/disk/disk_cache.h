@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Block cache between the disk access layer and the disk drivers */
+
+#include <zephyr/drivers/disk.h>
+
+/* Enable caching of an initialized disk, if its sector size is supported */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Drop the cached sectors of a disk, dirty sectors are not written */
+void disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write the dirty sectors of a disk */
+int disk_cache_sync(struct disk_info *disk);
+
+void disk_cache_stats_get(struct disk_info *disk, struct disk_cache_stats *stats);
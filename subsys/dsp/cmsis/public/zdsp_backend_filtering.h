@@ -0,0 +1,86 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_FILTERING_H_
+#define SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_FILTERING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* This include MUST be done before arm_math.h so we can let the arch specific
+ * logic set up the right #define values for arm_math.h
+ */
+#include <zephyr/kernel.h>
+
+#include <arm_math.h>
+
+/* The CMSIS instances are rebuilt on each call: the init functions would
+ * clear the state, and the layouts of the state and of the coefficients
+ * are the ones of the zDSP instances.
+ */
+
+static inline void zdsp_fir_q15(const struct zdsp_fir_q15 *inst, const q15_t *src, q15_t *dst,
+				uint32_t block_size)
+{
+	arm_fir_instance_q15 fir = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_q15(&fir, src, dst, block_size);
+}
+static inline void zdsp_fir_q31(const struct zdsp_fir_q31 *inst, const q31_t *src, q31_t *dst,
+				uint32_t block_size)
+{
+	arm_fir_instance_q31 fir = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_q31(&fir, src, dst, block_size);
+}
+static inline void zdsp_fir_f32(const struct zdsp_fir_f32 *inst, const float32_t *src,
+				float32_t *dst, uint32_t block_size)
+{
+	arm_fir_instance_f32 fir = {
+		.numTaps = inst->num_taps,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_fir_f32(&fir, src, dst, block_size);
+}
+
+static inline void zdsp_biquad_df1_q31(const struct zdsp_biquad_df1_q31 *inst, const q31_t *src,
+				       q31_t *dst, uint32_t block_size)
+{
+	arm_biquad_casd_df1_inst_q31 biquad = {
+		.numStages = inst->num_stages,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+		.postShift = inst->post_shift,
+	};
+
+	arm_biquad_cascade_df1_q31(&biquad, src, dst, block_size);
+}
+static inline void zdsp_biquad_df2t_f32(const struct zdsp_biquad_df2t_f32 *inst,
+					const float32_t *src, float32_t *dst, uint32_t block_size)
+{
+	arm_biquad_cascade_df2T_instance_f32 biquad = {
+		.numStages = inst->num_stages,
+		.pState = inst->state,
+		.pCoeffs = inst->coeffs,
+	};
+
+	arm_biquad_cascade_df2T_f32(&biquad, src, dst, block_size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_FILTERING_H_ */
@@ -0,0 +1,38 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_TRANSFORM_H_
+#define SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_TRANSFORM_H_
+
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* This include MUST be done before arm_math.h so we can let the arch specific
+ * logic set up the right #define values for arm_math.h
+ */
+#include <zephyr/kernel.h>
+
+#include <arm_math.h>
+
+static inline int zdsp_cfft_f32(float32_t *buf, uint32_t fft_len, bool inverse)
+{
+	arm_cfft_instance_f32 cfft;
+
+	if (fft_len > UINT16_MAX || arm_cfft_init_f32(&cfft, fft_len) != ARM_MATH_SUCCESS) {
+		return -EINVAL;
+	}
+
+	arm_cfft_f32(&cfft, buf, inverse ? 1 : 0, 1);
+
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUBSYS_DSP_CMSIS_PUBLIC_ZDSP_BACKEND_TRANSFORM_H_ */
@@ -0,0 +1,152 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/dsp/filtering.h>
+#include <zephyr/sys/util.h>
+
+/*
+ * The kernels are plain loops over contiguous arrays so that the compiler
+ * vectorizes them for the SIMD extensions the target is built with. The
+ * state layout is the one of CMSIS-DSP: the last num_taps - 1 input samples
+ * followed by the current block.
+ */
+
+void zdsp_fir_q15(const struct zdsp_fir_q15 *inst, const q15_t *src, q15_t *dst,
+		  uint32_t block_size)
+{
+	const q15_t *restrict coeffs = inst->coeffs;
+	q15_t *state = inst->state;
+	uint32_t num_taps = inst->num_taps;
+
+	/* Copied first, the output may overwrite the input */
+	memcpy(&state[num_taps - 1], src, block_size * sizeof(*src));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		const q15_t *restrict x = &state[n];
+		q63_t acc = 0;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += (q31_t)coeffs[k] * x[k];
+		}
+
+		dst[n] = (q15_t)CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1) * sizeof(*state));
+}
+
+void zdsp_fir_q31(const struct zdsp_fir_q31 *inst, const q31_t *src, q31_t *dst,
+		  uint32_t block_size)
+{
+	const q31_t *restrict coeffs = inst->coeffs;
+	q31_t *state = inst->state;
+	uint32_t num_taps = inst->num_taps;
+
+	memcpy(&state[num_taps - 1], src, block_size * sizeof(*src));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		const q31_t *restrict x = &state[n];
+		q63_t acc = 0;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += (q63_t)coeffs[k] * x[k];
+		}
+
+		dst[n] = (q31_t)(acc >> 31);
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1) * sizeof(*state));
+}
+
+void zdsp_fir_f32(const struct zdsp_fir_f32 *inst, const float32_t *src, float32_t *dst,
+		  uint32_t block_size)
+{
+	const float32_t *restrict coeffs = inst->coeffs;
+	float32_t *state = inst->state;
+	uint32_t num_taps = inst->num_taps;
+
+	memcpy(&state[num_taps - 1], src, block_size * sizeof(*src));
+
+	for (uint32_t n = 0; n < block_size; n++) {
+		const float32_t *restrict x = &state[n];
+		float32_t acc = 0.0f;
+
+		for (uint32_t k = 0; k < num_taps; k++) {
+			acc += coeffs[k] * x[k];
+		}
+
+		dst[n] = acc;
+	}
+
+	memmove(state, &state[block_size], (num_taps - 1) * sizeof(*state));
+}
+
+void zdsp_biquad_df1_q31(const struct zdsp_biquad_df1_q31 *inst, const q31_t *src, q31_t *dst,
+			 uint32_t block_size)
+{
+	const q31_t *coeffs = inst->coeffs;
+	q31_t *state = inst->state;
+	int shift = 31 - inst->post_shift;
+
+	for (uint8_t stage = 0; stage < inst->num_stages; stage++) {
+		q31_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2];
+		q31_t a1 = coeffs[3], a2 = coeffs[4];
+		q31_t x1 = state[0], x2 = state[1];
+		q31_t y1 = state[2], y2 = state[3];
+
+		for (uint32_t n = 0; n < block_size; n++) {
+			q31_t x0 = src[n];
+			q63_t acc;
+
+			acc = (q63_t)b0 * x0 + (q63_t)b1 * x1 + (q63_t)b2 * x2 +
+			      (q63_t)a1 * y1 + (q63_t)a2 * y2;
+
+			x2 = x1;
+			x1 = x0;
+			y2 = y1;
+			y1 = (q31_t)(acc >> shift);
+			dst[n] = y1;
+		}
+
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+
+		/* The next stage filters the output of this one */
+		src = dst;
+		coeffs += 5;
+		state += 4;
+	}
+}
+
+void zdsp_biquad_df2t_f32(const struct zdsp_biquad_df2t_f32 *inst, const float32_t *src,
+			  float32_t *dst, uint32_t block_size)
+{
+	const float32_t *coeffs = inst->coeffs;
+	float32_t *state = inst->state;
+
+	for (uint8_t stage = 0; stage < inst->num_stages; stage++) {
+		float32_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2];
+		float32_t a1 = coeffs[3], a2 = coeffs[4];
+		float32_t d1 = state[0], d2 = state[1];
+
+		for (uint32_t n = 0; n < block_size; n++) {
+			float32_t x0 = src[n];
+			float32_t y0 = b0 * x0 + d1;
+
+			d1 = b1 * x0 + a1 * y0 + d2;
+			d2 = b2 * x0 + a2 * y0;
+			dst[n] = y0;
+		}
+
+		state[0] = d1;
+		state[1] = d2;
+
+		src = dst;
+		coeffs += 5;
+		state += 2;
+	}
+}
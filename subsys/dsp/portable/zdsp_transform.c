@@ -0,0 +1,123 @@
+/* Copyright (c) 2024 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/dsp/transform.h>
+#include <zephyr/sys/util.h>
+
+#define CFFT_MIN_LEN 16U
+#define CFFT_MAX_LEN 4096U
+
+/* sin(pi / m) and sin(2 * pi / m) for m = 2^(i + 1), the seeds of the twiddle
+ * factor recurrence of each radix-2 stage. No libm needed.
+ */
+static const float32_t half_step_sin[] = {
+	1.0f,
+	0.70710678118654752f,
+	0.38268343236508977f,
+	0.19509032201612826f,
+	0.09801714032956060f,
+	0.04906767432741801f,
+	0.02454122852291229f,
+	0.01227153828571993f,
+	0.00613588464915448f,
+	0.00306795676296598f,
+	0.00153398018628477f,
+	0.00076699031874270f,
+};
+
+static const float32_t step_sin[] = {
+	0.0f,
+	1.0f,
+	0.70710678118654752f,
+	0.38268343236508977f,
+	0.19509032201612826f,
+	0.09801714032956060f,
+	0.04906767432741801f,
+	0.02454122852291229f,
+	0.01227153828571993f,
+	0.00613588464915448f,
+	0.00306795676296598f,
+	0.00153398018628477f,
+};
+
+BUILD_ASSERT(BIT(ARRAY_SIZE(half_step_sin)) == CFFT_MAX_LEN);
+BUILD_ASSERT(BIT(ARRAY_SIZE(step_sin)) == CFFT_MAX_LEN);
+
+static void bit_reverse(float32_t *buf, uint32_t fft_len)
+{
+	uint32_t j = 0;
+	uint32_t bit;
+
+	for (uint32_t i = 0; i < fft_len - 1; i++) {
+		if (i < j) {
+			float32_t re = buf[2 * i];
+			float32_t im = buf[2 * i + 1];
+
+			buf[2 * i] = buf[2 * j];
+			buf[2 * i + 1] = buf[2 * j + 1];
+			buf[2 * j] = re;
+			buf[2 * j + 1] = im;
+		}
+
+		bit = fft_len >> 1;
+		while ((j & bit) != 0) {
+			j ^= bit;
+			bit >>= 1;
+		}
+
+		j |= bit;
+	}
+}
+
+int zdsp_cfft_f32(float32_t *buf, uint32_t fft_len, bool inverse)
+{
+	float32_t sign = inverse ? 1.0f : -1.0f;
+
+	if (fft_len < CFFT_MIN_LEN || fft_len > CFFT_MAX_LEN || !IS_POWER_OF_TWO(fft_len)) {
+		return -EINVAL;
+	}
+
+	bit_reverse(buf, fft_len);
+
+	for (uint32_t stage = 0, half = 1; half < fft_len; stage++, half <<= 1) {
+		/* Rotation by one step of 2 * pi / (2 * half), kept as
+		 * {cos - 1, sin} which loses less precision than cos.
+		 */
+		float32_t hs = half_step_sin[stage];
+		float32_t alpha_re = -2.0f * hs * hs;
+		float32_t alpha_im = sign * step_sin[stage];
+		float32_t w_re = 1.0f;
+		float32_t w_im = 0.0f;
+		float32_t tmp;
+
+		for (uint32_t j = 0; j < half; j++) {
+			for (uint32_t k = j; k < fft_len; k += 2 * half) {
+				float32_t *a = &buf[2 * k];
+				float32_t *b = &buf[2 * (k + half)];
+				float32_t t_re = w_re * b[0] - w_im * b[1];
+				float32_t t_im = w_re * b[1] + w_im * b[0];
+
+				b[0] = a[0] - t_re;
+				b[1] = a[1] - t_im;
+				a[0] += t_re;
+				a[1] += t_im;
+			}
+
+			tmp = w_re;
+			w_re += w_re * alpha_re - w_im * alpha_im;
+			w_im += w_im * alpha_re + tmp * alpha_im;
+		}
+	}
+
+	if (inverse) {
+		float32_t scale = 1.0f / (float32_t)fft_len;
+
+		for (uint32_t i = 0; i < 2 * fft_len; i++) {
+			buf[i] *= scale;
+		}
+	}
+
+	return 0;
+}
@@ -63,10 +63,56 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	/** Columns of the area changed since the last finalize, end excluded */
+	uint16_t dirty_x0;
+	uint16_t dirty_x1;
+
+	/** Tile rows of the area changed since the last finalize, end excluded */
+	uint16_t dirty_row0;
+	uint16_t dirty_row1;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+/* Extends the area to send at the next finalize with a rectangle of pixels */
+static inline void mark_dirty(struct char_framebuffer *fb, int16_t x, int16_t y,
+			      uint16_t width, uint16_t height)
+{
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	const int32_t x0 = CLAMP(x, 0, fb->x_res);
+	const int32_t x1 = CLAMP(x + width, 0, fb->x_res);
+	const int32_t y0 = CLAMP(y, 0, fb->y_res);
+	const int32_t y1 = CLAMP(y + height, 0, fb->y_res);
+
+	if (x0 >= x1 || y0 >= y1) {
+		return;
+	}
+
+	fb->dirty_x0 = MIN(fb->dirty_x0, x0);
+	fb->dirty_x1 = MAX(fb->dirty_x1, x1);
+	fb->dirty_row0 = MIN(fb->dirty_row0, y0 / fb->ppt);
+	fb->dirty_row1 = MAX(fb->dirty_row1, DIV_ROUND_UP(y1, fb->ppt));
+#endif
+}
+
+static inline void mark_all_dirty(struct char_framebuffer *fb)
+{
+	mark_dirty(fb, 0, 0, fb->x_res, fb->y_res);
+}
+
+static inline void mark_clean(struct char_framebuffer *fb)
+{
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	fb->dirty_x0 = fb->x_res;
+	fb->dirty_x1 = 0U;
+	fb->dirty_row0 = fb->y_res / fb->ppt;
+	fb->dirty_row1 = 0U;
+#endif
+}
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, char c)
 {
 	return (uint8_t *)fptr->data +
@@ -91,7 +137,7 @@ static inline uint8_t get_glyph_byte(uint8_t *glyph_ptr, const struct cfb_font *
  * Draw the monochrome character in the monochrome tiled framebuffer,
  * a byte is interpreted as 8 pixels ordered vertically among each other.
  */
-static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
+static uint8_t draw_char_vtmono(struct char_framebuffer *fb,
 				char c, uint16_t x, uint16_t y,
 				bool draw_bg)
 {
@@ -110,6 +156,8 @@ static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 		return 0;
 	}
 
+	mark_dirty(fb, x, y, fptr->width, fptr->height);
+
 	for (size_t g_x = 0; g_x < fptr->width; g_x++) {
 		const int16_t fb_x = x + g_x;
 
@@ -228,6 +276,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index + x] |= m;
+	mark_dirty(fb, x, y, 1, 1);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -263,7 +312,7 @@ static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16
 static int draw_text(const struct device *dev, const char *const str, int16_t x, int16_t y,
 		     bool wrap)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const struct cfb_font *fptr;
 
 	if (!fb->fonts || !fb->buf) {
@@ -337,7 +386,7 @@ int cfb_print(const struct device *dev, const char *const str, uint16_t x, uint1
 int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		    uint16_t width, uint16_t height)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 	const bool need_reverse = ((fb->screen_info & SCREEN_INFO_MONO_MSB_FIRST) != 0);
 
 	if (x >= fb->x_res || y >= fb->y_res) {
@@ -363,6 +412,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			height = fb->y_res - y;
 		}
 
+		mark_dirty(fb, x, y, width, height);
+
 		for (size_t i = x; i < x + width; i++) {
 			for (size_t j = y; j < (y + height); j++) {
 				/*
@@ -432,13 +483,14 @@ static int cfb_invert(const struct char_framebuffer *fb)
 
 int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 {
-	const struct char_framebuffer *fb = &char_fb;
+	struct char_framebuffer *fb = &char_fb;
 
 	if (!fb || !fb->buf) {
 		return -ENODEV;
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_all_dirty(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -452,34 +504,77 @@ int cfb_framebuffer_invert(const struct device *dev)
 	struct char_framebuffer *fb = &char_fb;
 
 	fb->inverted = !fb->inverted;
+	mark_all_dirty(fb);
 
 	return 0;
 }
 
-int cfb_framebuffer_finalize(const struct device *dev)
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+/* Sends the changed columns of every changed tile row */
+static int cfb_write_dirty(const struct device *dev, struct char_framebuffer *fb)
 {
 	const struct display_driver_api *api = dev->api;
-	const struct char_framebuffer *fb = &char_fb;
 	struct display_buffer_descriptor desc;
-	int err;
+	int err = 0;
 
-	if (!fb || !fb->buf) {
-		return -ENODEV;
+	desc.width = fb->dirty_x1 - fb->dirty_x0;
+	desc.height = fb->ppt;
+	desc.pitch = desc.width;
+	desc.buf_size = desc.width;
+
+	for (uint16_t row = fb->dirty_row0; row < fb->dirty_row1; row++) {
+		err = api->write(dev, fb->dirty_x0, row * fb->ppt, &desc,
+				 fb->buf + row * fb->x_res + fb->dirty_x0);
+		if (err) {
+			break;
+		}
+	}
+
+	return err;
+}
+#endif
+
+static int cfb_write(const struct device *dev, struct char_framebuffer *fb)
+{
+	const struct display_driver_api *api = dev->api;
+	struct display_buffer_descriptor desc;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DIRTY_TRACKING
+	if (fb->screen_info & SCREEN_INFO_MONO_VTILED) {
+		return cfb_write_dirty(dev, fb);
 	}
+#endif
 
 	desc.buf_size = fb->size;
 	desc.width = fb->x_res;
 	desc.height = fb->y_res;
 	desc.pitch = fb->x_res;
 
+	return api->write(dev, 0, 0, &desc, fb->buf);
+}
+
+int cfb_framebuffer_finalize(const struct device *dev)
+{
+	struct char_framebuffer *fb = &char_fb;
+	int err;
+
+	if (!fb || !fb->buf) {
+		return -ENODEV;
+	}
+
 	if (!(fb->pixel_format & PIXEL_FORMAT_MONO10) != !(fb->inverted)) {
 		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
+		err = cfb_write(dev, fb);
 		cfb_invert(fb);
-		return err;
+	} else {
+		err = cfb_write(dev, fb);
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	if (!err) {
+		mark_clean(fb);
+	}
+
+	return err;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -586,6 +681,8 @@ int cfb_framebuffer_init(const struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_clean(fb);
+	mark_all_dirty(fb);
 
 	return 0;
 }
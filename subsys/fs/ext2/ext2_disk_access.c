@@ -100,6 +100,21 @@ static int disk_access_read_block(struct ext2_data *fs, void *buf, uint32_t bloc
 	return disk_read(disk->name, buf, sector_start, sector_count);
 }
 
+static int disk_access_read_blocks(struct ext2_data *fs, void *buf, uint32_t block,
+		uint32_t count)
+{
+	int rc;
+	struct disk_data *disk = fs->backend;
+	uint32_t sector_start, sector_count;
+
+	rc = disk_prepare_range(disk, block * fs->block_size, count * fs->block_size,
+			&sector_start, &sector_count);
+	if (rc < 0) {
+		return rc;
+	}
+	return disk_read(disk->name, buf, sector_start, sector_count);
+}
+
 static int disk_access_write_block(struct ext2_data *fs, const void *buf, uint32_t block)
 {
 	int rc;
@@ -140,6 +155,7 @@ static const struct ext2_backend_ops disk_access_ops = {
 	.get_device_size = disk_access_device_size,
 	.get_write_size = disk_access_write_size,
 	.read_block = disk_access_read_block,
+	.read_blocks = disk_access_read_blocks,
 	.write_block = disk_access_write_block,
 	.read_superblock = disk_access_read_superblock,
 	.sync = disk_access_sync,
@@ -253,6 +253,12 @@ int ext2_fetch_block_group(struct ext2_data *fs, uint32_t group)
 		return -ERANGE;
 	}
 
+	int rc = ext2_commit_bitmaps(fs);
+
+	if (rc < 0) {
+		return rc;
+	}
+
 	uint32_t groups_per_block = fs->block_size / sizeof(struct ext2_disk_bgroup);
 	uint32_t block = group / groups_per_block;
 	uint32_t offset = group % groups_per_block;
@@ -476,6 +482,74 @@ int ext2_fetch_inode_block(struct ext2_inode *inode, uint32_t block)
 	return 0;
 }
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+void ext2_inode_drop_map(struct ext2_inode *inode)
+{
+	ext2_drop_block(inode->map);
+	inode->map = NULL;
+	inode->map_lvl = 0;
+}
+
+int ext2_get_inode_block_num(struct ext2_inode *inode, uint32_t block, uint32_t *num)
+{
+	struct ext2_data *fs = inode->i_fs;
+	uint32_t offsets[MAX_OFFSETS_SIZE];
+	uint32_t map_num;
+	int max_lvl;
+
+	max_lvl = get_level_offsets(fs, block, offsets);
+	if (max_lvl < 0) {
+		return max_lvl;
+	}
+
+	if (max_lvl == 0) {
+		*num = inode->i_block[offsets[0]];
+		return 0;
+	}
+
+	/* The indirect block fetched with the current block may list this block too. */
+	if ((inode->flags & INODE_FETCHED_BLOCK) && inode->block_lvl == max_lvl &&
+	    memcmp(inode->offsets, offsets, max_lvl * sizeof(uint32_t)) == 0) {
+		uint32_t *list = (uint32_t *)inode->blocks[max_lvl - 1]->data;
+
+		*num = sys_le32_to_cpu(list[offsets[max_lvl]]);
+		return 0;
+	}
+
+	if (inode->map_lvl != max_lvl ||
+	    memcmp(inode->map_offsets, offsets, max_lvl * sizeof(uint32_t)) != 0) {
+		ext2_inode_drop_map(inode);
+
+		map_num = inode->i_block[offsets[0]];
+		for (int lvl = 1; lvl < max_lvl && map_num != 0; ++lvl) {
+			struct ext2_block *b = ext2_get_block(fs, map_num);
+
+			if (b == NULL) {
+				return -ENOENT;
+			}
+			map_num = sys_le32_to_cpu(((uint32_t *)b->data)[offsets[lvl]]);
+			ext2_drop_block(b);
+		}
+
+		/* Whole indirect block is not allocated */
+		if (map_num == 0) {
+			*num = 0;
+			return 0;
+		}
+
+		inode->map = ext2_get_block(fs, map_num);
+		if (inode->map == NULL) {
+			return -ENOENT;
+		}
+		memcpy(inode->map_offsets, offsets, sizeof(offsets));
+		inode->map_lvl = max_lvl;
+	}
+
+	*num = sys_le32_to_cpu(((uint32_t *)inode->map->data)[offsets[max_lvl]]);
+	return 0;
+}
+#endif /* CONFIG_EXT2_MULTI_BLOCK_READ */
+
 static bool all_zero(const uint32_t *offsets, int lvl)
 {
 	for (int i = 0; i < lvl; ++i) {
@@ -865,6 +939,57 @@ int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 	return ret;
 }
 
+int ext2_commit_bitmaps(struct ext2_data *fs)
+{
+	int rc;
+	struct ext2_bgroup *bg = &fs->bgroup;
+
+	if (bg->dirty == 0) {
+		return 0;
+	}
+
+	rc = ext2_commit_superblock(fs);
+	if (rc < 0) {
+		LOG_DBG("super block write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_commit_bg(fs);
+	if (rc < 0) {
+		LOG_DBG("block group write returned: %d", rc);
+		return -EIO;
+	}
+	if (bg->dirty & BGROUP_DIRTY_BLOCK_BITMAP) {
+		rc = ext2_write_block(fs, bg->block_bitmap);
+		if (rc < 0) {
+			LOG_DBG("block bitmap write returned: %d", rc);
+			return -EIO;
+		}
+	}
+	if (bg->dirty & BGROUP_DIRTY_INODE_BITMAP) {
+		rc = ext2_write_block(fs, bg->inode_bitmap);
+		if (rc < 0) {
+			LOG_DBG("inode bitmap write returned: %d", rc);
+			return -EIO;
+		}
+	}
+
+	bg->dirty = 0;
+	return 0;
+}
+
+/* Commit the changed bitmap of the current block group with the superblock and block group
+ * descriptor. With write back they are only marked to be written later.
+ */
+static int commit_bitmap(struct ext2_data *fs, uint8_t dirty)
+{
+	fs->bgroup.dirty |= dirty;
+
+	if (IS_ENABLED(CONFIG_EXT2_BITMAP_WRITE_BACK)) {
+		return 0;
+	}
+	return ext2_commit_bitmaps(fs);
+}
+
 int64_t ext2_alloc_block(struct ext2_data *fs)
 {
 	int rc, bitmap_slot;
@@ -920,20 +1045,9 @@ int64_t ext2_alloc_block(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_bitmap(fs, BGROUP_DIRTY_BLOCK_BITMAP);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return total;
 }
@@ -1017,20 +1131,9 @@ int32_t ext2_alloc_inode(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
+	rc = commit_bitmap(fs, BGROUP_DIRTY_INODE_BITMAP);
 	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 
 	LOG_DBG("Free inodes (bg): %d", fs->bgroup.bg_free_inodes_count);
@@ -1076,20 +1179,9 @@ int ext2_free_block(struct ext2_data *fs, uint32_t block)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
+	rc = commit_bitmap(fs, BGROUP_DIRTY_BLOCK_BITMAP);
 	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return 0;
 }
@@ -1139,20 +1231,9 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 
 	LOG_INF("Inode %d is free", ino);
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
+	rc = commit_bitmap(fs, BGROUP_DIRTY_INODE_BITMAP);
 	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	rc = fs->backend_ops->sync(fs);
 	if (rc < 0) {
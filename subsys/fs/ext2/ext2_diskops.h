@@ -41,6 +41,25 @@ int ext2_fetch_inode(struct ext2_data *fs, uint32_t ino, struct ext2_inode *inod
  */
 int ext2_fetch_inode_block(struct ext2_inode *inode, uint32_t block);
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+/**
+ * @brief Get the disk block number of inode block without reading the block.
+ *
+ * The indirect block listing the block is kept cached in the inode.
+ *
+ * @param inode Inode structure
+ * @param block Number of inode block
+ * @param num Pointer to place where to store the disk block number (0 if not allocated)
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_get_inode_block_num(struct ext2_inode *inode, uint32_t block, uint32_t *num);
+
+/* Drop the indirect block cached by ext2_get_inode_block_num. */
+void ext2_inode_drop_map(struct ext2_inode *inode);
+#endif
+
 /**
  * @brief Fetch block group into buffer in fs structure.
  *
@@ -158,6 +177,18 @@ int ext2_commit_superblock(struct ext2_data *fs);
  */
 int ext2_commit_bg(struct ext2_data *fs);
 
+/**
+ * @brief Write bitmaps of the fetched block group that are not written yet.
+ *
+ * The superblock and block group descriptor are written with them.
+ *
+ * @param fs File system data struct
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_commit_bitmaps(struct ext2_data *fs);
+
 /* Operations that reserve or free the block or inode in the file system. They
  * mark an inode or block as used in the bitmap and change free inode/block
  * count in superblock and block group.
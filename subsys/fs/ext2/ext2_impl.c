@@ -370,6 +370,11 @@ int ext2_close_fs(struct ext2_data *fs)
 		}
 	}
 
+	ret = ext2_commit_bitmaps(fs);
+	if (ret < 0) {
+		return ret;
+	}
+
 	/* To save file system as correct it must be writable and without errors */
 	if (!(fs->flags & (EXT2_DATA_FLAGS_RO | EXT2_DATA_FLAGS_ERR))) {
 		fs->sblock.s_state = EXT2_VALID_FS;
@@ -606,6 +611,43 @@ success:
 
 /* Inode operations --------------------------------------------------------- */
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+/* Read inode blocks starting with block that are contiguous on the disk.
+ *
+ * @retval >0 number of blocks read
+ * @retval 0 first block is not allocated
+ * @retval <0 error
+ */
+static int read_contiguous_blocks(struct ext2_inode *inode, uint8_t *buf, uint32_t block,
+		uint32_t count)
+{
+	int rc;
+	uint32_t first, num, n;
+	struct ext2_data *fs = inode->i_fs;
+
+	rc = ext2_get_inode_block_num(inode, block, &first);
+	if (rc < 0 || first == 0) {
+		return rc;
+	}
+
+	for (n = 1; n < count; ++n) {
+		rc = ext2_get_inode_block_num(inode, block + n, &num);
+		if (rc < 0) {
+			return rc;
+		}
+		if (num != first + n) {
+			break;
+		}
+	}
+
+	rc = fs->backend_ops->read_blocks(fs, buf, first, n);
+	if (rc < 0) {
+		return rc;
+	}
+	return n;
+}
+#endif
+
 ssize_t ext2_inode_read(struct ext2_inode *inode, void *buf, uint32_t offset, size_t nbytes)
 {
 	int rc = 0;
@@ -617,6 +659,24 @@ ssize_t ext2_inode_read(struct ext2_inode *inode, void *buf, uint32_t offset, si
 		uint32_t block = offset / block_size;
 		uint32_t block_off = offset % block_size;
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+		uint32_t whole_blocks = MIN(nbytes - read, inode->i_size - offset) / block_size;
+
+		if (block_off == 0 && whole_blocks > 1) {
+			rc = read_contiguous_blocks(inode, (uint8_t *)buf + read, block,
+					whole_blocks);
+			if (rc < 0) {
+				break;
+			}
+			if (rc > 0) {
+				read += rc * block_size;
+				offset += rc * block_size;
+				continue;
+			}
+			/* Not allocated block is read as usual */
+		}
+#endif
+
 		rc = ext2_fetch_inode_block(inode, block);
 		if (rc < 0) {
 			break;
@@ -644,6 +704,11 @@ ssize_t ext2_inode_write(struct ext2_inode *inode, const void *buf, uint32_t off
 	ssize_t written = 0;
 	uint32_t block_size = inode->i_fs->block_size;
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+	/* Written blocks may be listed in the cached indirect block */
+	ext2_inode_drop_map(inode);
+#endif
+
 	while (written < nbytes) {
 		uint32_t block = offset / block_size;
 		uint32_t block_off = offset % block_size;
@@ -699,6 +764,10 @@ int ext2_inode_trunc(struct ext2_inode *inode, off_t length)
 
 	LOG_DBG("Resizing inode from %d to %d", old_size, new_size);
 
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+	ext2_inode_drop_map(inode);
+#endif
+
 	if (old_size == new_size) {
 		return 0;
 	}
@@ -793,6 +862,15 @@ int ext2_inode_sync(struct ext2_inode *inode)
 			return ret;
 		}
 	}
+
+	/* Write back bitmaps changed by this and earlier allocations */
+	if (fs->bgroup.dirty != 0) {
+		ret = ext2_commit_bitmaps(fs);
+		if (ret < 0) {
+			return ret;
+		}
+		return fs->backend_ops->sync(fs);
+	}
 	return 0;
 }
 
@@ -1542,4 +1620,8 @@ void ext2_inode_drop_blocks(struct ext2_inode *inode)
 		ext2_drop_block(inode->blocks[i]);
 	}
 	inode->flags &= ~INODE_FETCHED_BLOCK;
+
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+	ext2_inode_drop_map(inode);
+#endif
 }
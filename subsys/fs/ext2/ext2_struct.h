@@ -151,6 +151,7 @@ struct ext2_bgroup {
 
 	int32_t num;                /* number of described block group */
 	uint32_t inode_table_block; /* number of fetched block (relative) */
+	uint8_t dirty;              /* bitmaps not yet written to disk */
 
 	uint32_t bg_block_bitmap;
 	uint32_t bg_inode_bitmap;
@@ -160,6 +161,10 @@ struct ext2_bgroup {
 	uint16_t bg_used_dirs_count;
 };
 
+/* Flags for changed block group data */
+#define BGROUP_DIRTY_BLOCK_BITMAP BIT(0)
+#define BGROUP_DIRTY_INODE_BITMAP BIT(1)
+
 /* Flags for inode */
 #define INODE_FETCHED_BLOCK BIT(0)
 #define INODE_REMOVE BIT(1)
@@ -180,6 +185,11 @@ struct ext2_inode {
 	uint32_t block_num;        /* relative number of fetched block */
 	uint32_t offsets[4];       /* offsets describing path to fetched block */
 	struct ext2_block *blocks[4];   /* fetched blocks for each level */
+#ifdef CONFIG_EXT2_MULTI_BLOCK_READ
+	int map_lvl;               /* level of data blocks listed in map (0 if none) */
+	uint32_t map_offsets[4];   /* offsets describing path to map */
+	struct ext2_block *map;    /* cached indirect block */
+#endif
 };
 
 static inline struct ext2_block *inode_current_block(struct ext2_inode *inode)
@@ -219,6 +229,7 @@ struct ext2_backend_ops {
 	int64_t (*get_device_size)(struct ext2_data *fs);
 	int64_t (*get_write_size)(struct ext2_data *fs);
 	int (*read_block)(struct ext2_data *fs, void *buf, uint32_t num);
+	int (*read_blocks)(struct ext2_data *fs, void *buf, uint32_t num, uint32_t count);
 	int (*write_block)(struct ext2_data *fs, const void *buf, uint32_t num);
 	int (*read_superblock)(struct ext2_data *fs, struct ext2_disk_superblock *sb);
 	int (*sync)(struct ext2_data *fs);
@@ -35,10 +35,25 @@
 BUILD_ASSERT(IS_ENABLED(CONFIG_FS_LITTLEFS_BLK_DEV) ||
 	     IS_ENABLED(CONFIG_FS_LITTLEFS_FMP_DEV));
 
+#define FILE_BUFFER_SIZE CONFIG_FS_LITTLEFS_FILE_BUFFER_SIZE
+
 struct lfs_file_data {
 	struct lfs_file file;
 	struct lfs_file_config config;
 	void *cache_block;
+#if FILE_BUFFER_SIZE > 0
+	/* Read-ahead data or writes not yet passed to littlefs.
+	 * With pending writes the file position is buf_len past the littlefs
+	 * one, after a read-ahead littlefs is at buf_pos + buf_len and the
+	 * file position is buf_pos + buf_off.
+	 */
+	uint8_t *buf;
+	lfs_soff_t buf_pos;
+	size_t buf_len;
+	size_t buf_off;
+	bool buf_dirty;
+	bool writable;
+#endif
 };
 
 #define LFS_FILEP(fp) (&((struct lfs_file_data *)(fp->filep))->file)
@@ -46,6 +61,10 @@ struct lfs_file_data {
 /* Global memory pool for open files and dirs */
 K_MEM_SLAB_DEFINE_STATIC(file_data_pool, sizeof(struct lfs_file_data),
 			 CONFIG_FS_LITTLEFS_NUM_FILES, 4);
+#if FILE_BUFFER_SIZE > 0
+K_MEM_SLAB_DEFINE_STATIC(file_buffer_pool, FILE_BUFFER_SIZE,
+			 CONFIG_FS_LITTLEFS_NUM_FILES, 4);
+#endif
 K_MEM_SLAB_DEFINE_STATIC(lfs_dir_pool, sizeof(struct lfs_dir),
 			 CONFIG_FS_LITTLEFS_NUM_DIRS, 4);
 
@@ -267,6 +286,12 @@ static void release_file_data(struct fs_file_t *fp)
 		fc_release(fdp->cache_block);
 	}
 
+#if FILE_BUFFER_SIZE > 0
+	if (fdp->buf) {
+		k_mem_slab_free(&file_buffer_pool, fdp->buf);
+	}
+#endif
+
 	k_mem_slab_free(&file_data_pool, fp->filep);
 	fp->filep = NULL;
 }
@@ -286,6 +311,114 @@ static int lfs_flags_from_zephyr(unsigned int zflags)
 	return flags;
 }
 
+#if FILE_BUFFER_SIZE > 0
+/* The file buffer helpers run with the mutex of the file system held */
+static void file_buffer_assert_locked(struct lfs *lfs)
+{
+	__ASSERT_NO_MSG(CONTAINER_OF(lfs, struct fs_littlefs, lfs)->mutex.owner ==
+			k_current_get());
+}
+
+/* Writes out pending data, or moves littlefs back to the file position
+ * after a read-ahead, and empties the buffer.
+ */
+static int file_buffer_settle_locked(struct lfs *lfs, struct lfs_file_data *fdp)
+{
+	lfs_ssize_t rc = 0;
+
+	file_buffer_assert_locked(lfs);
+
+	if (fdp->buf_dirty) {
+		rc = lfs_file_write(lfs, &fdp->file, fdp->buf, fdp->buf_len);
+	} else if (fdp->buf_off != fdp->buf_len) {
+		rc = lfs_file_seek(lfs, &fdp->file, fdp->buf_pos + fdp->buf_off, LFS_SEEK_SET);
+	}
+
+	fdp->buf_len = 0;
+	fdp->buf_off = 0;
+	fdp->buf_dirty = false;
+
+	return rc < 0 ? rc : 0;
+}
+
+/* Reads through the file buffer, filling it from littlefs when consumed */
+static lfs_ssize_t file_buffer_read_locked(struct lfs *lfs, struct lfs_file_data *fdp,
+					   uint8_t *ptr, size_t len)
+{
+	size_t done = 0;
+	lfs_ssize_t rc;
+
+	file_buffer_assert_locked(lfs);
+
+	if (fdp->buf_dirty || len >= FILE_BUFFER_SIZE) {
+		rc = file_buffer_settle_locked(lfs, fdp);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (len >= FILE_BUFFER_SIZE) {
+			return lfs_file_read(lfs, &fdp->file, ptr, len);
+		}
+	}
+
+	while (done < len) {
+		size_t count = MIN(len - done, fdp->buf_len - fdp->buf_off);
+
+		if (count == 0) {
+			/* Buffer consumed, littlefs is at the file position */
+			fdp->buf_pos = lfs_file_tell(lfs, &fdp->file);
+			fdp->buf_len = 0;
+			fdp->buf_off = 0;
+			if (fdp->buf_pos < 0) {
+				return fdp->buf_pos;
+			}
+
+			rc = lfs_file_read(lfs, &fdp->file, fdp->buf, FILE_BUFFER_SIZE);
+			if (rc <= 0) {
+				return done > 0 ? done : rc;
+			}
+
+			fdp->buf_len = rc;
+			continue;
+		}
+
+		memcpy(&ptr[done], &fdp->buf[fdp->buf_off], count);
+		fdp->buf_off += count;
+		done += count;
+	}
+
+	return done;
+}
+
+/* Appends small writes to the file buffer, passing the others to littlefs */
+static lfs_ssize_t file_buffer_write_locked(struct lfs *lfs, struct lfs_file_data *fdp,
+					    const void *ptr, size_t len)
+{
+	lfs_ssize_t rc;
+
+	file_buffer_assert_locked(lfs);
+
+	/* Without write access littlefs reports the error right away */
+	if (!fdp->writable || !fdp->buf_dirty || len >= FILE_BUFFER_SIZE ||
+	    fdp->buf_len + len > FILE_BUFFER_SIZE) {
+		rc = file_buffer_settle_locked(lfs, fdp);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (!fdp->writable || len >= FILE_BUFFER_SIZE) {
+			return lfs_file_write(lfs, &fdp->file, ptr, len);
+		}
+	}
+
+	memcpy(&fdp->buf[fdp->buf_len], ptr, len);
+	fdp->buf_len += len;
+	fdp->buf_dirty = true;
+
+	return len;
+}
+#endif /* FILE_BUFFER_SIZE > 0 */
+
 static int littlefs_open(struct fs_file_t *fp, const char *path,
 			 fs_mode_t zflags)
 {
@@ -309,6 +442,18 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 	}
 
 	fdp->config.buffer = fdp->cache_block;
+
+#if FILE_BUFFER_SIZE > 0
+	ret = k_mem_slab_alloc(&file_buffer_pool, (void **)&fdp->buf, K_NO_WAIT);
+	if (ret != 0) {
+		fdp->buf = NULL;
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	fdp->writable = (zflags & FS_O_WRITE) != 0;
+#endif
+
 	path = fs_impl_strip_prefix(path, fp->mp);
 
 	fs_lock(fs);
@@ -331,8 +476,16 @@ static int littlefs_close(struct fs_file_t *fp)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	int rc = file_buffer_settle_locked(&fs->lfs, fp->filep);
+#endif
 	int ret = lfs_file_close(&fs->lfs, LFS_FILEP(fp));
 
+#if FILE_BUFFER_SIZE > 0
+	if (ret == 0) {
+		ret = rc;
+	}
+#endif
 	fs_unlock(fs);
 
 	release_file_data(fp);
@@ -376,7 +529,11 @@ static ssize_t littlefs_read(struct fs_file_t *fp, void *ptr, size_t len)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	ssize_t ret = file_buffer_read_locked(&fs->lfs, fp->filep, ptr, len);
+#else
 	ssize_t ret = lfs_file_read(&fs->lfs, LFS_FILEP(fp), ptr, len);
+#endif
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -388,7 +545,11 @@ static ssize_t littlefs_write(struct fs_file_t *fp, const void *ptr, size_t len)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	ssize_t ret = file_buffer_write_locked(&fs->lfs, fp->filep, ptr, len);
+#else
 	ssize_t ret = lfs_file_write(&fs->lfs, LFS_FILEP(fp), ptr, len);
+#endif
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -404,7 +565,15 @@ static int littlefs_seek(struct fs_file_t *fp, off_t off, int whence)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	off_t ret = file_buffer_settle_locked(&fs->lfs, fp->filep);
+
+	if (ret == 0) {
+		ret = lfs_file_seek(&fs->lfs, LFS_FILEP(fp), off, whence);
+	}
+#else
 	off_t ret = lfs_file_seek(&fs->lfs, LFS_FILEP(fp), off, whence);
+#endif
 
 	fs_unlock(fs);
 
@@ -423,6 +592,16 @@ static off_t littlefs_tell(struct fs_file_t *fp)
 
 	off_t ret = lfs_file_tell(&fs->lfs, LFS_FILEP(fp));
 
+#if FILE_BUFFER_SIZE > 0
+	struct lfs_file_data *fdp = fp->filep;
+
+	if (ret >= 0 && fdp->buf_dirty) {
+		ret += fdp->buf_len;
+	} else if (ret >= 0 && fdp->buf_len > 0) {
+		ret = fdp->buf_pos + fdp->buf_off;
+	}
+#endif
+
 	fs_unlock(fs);
 	return ret;
 }
@@ -433,7 +612,15 @@ static int littlefs_truncate(struct fs_file_t *fp, off_t length)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	int ret = file_buffer_settle_locked(&fs->lfs, fp->filep);
+
+	if (ret == 0) {
+		ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
+	}
+#else
 	int ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
+#endif
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
@@ -445,7 +632,15 @@ static int littlefs_sync(struct fs_file_t *fp)
 
 	fs_lock(fs);
 
+#if FILE_BUFFER_SIZE > 0
+	int ret = file_buffer_settle_locked(&fs->lfs, fp->filep);
+
+	if (ret == 0) {
+		ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
+	}
+#else
 	int ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
+#endif
 
 	fs_unlock(fs);
 	return lfs_to_errno(ret);
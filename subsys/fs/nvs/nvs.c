@@ -95,6 +95,20 @@ static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
 	}
 	return (len + (write_block_size - 1U)) & ~(write_block_size - 1U);
 }
+
+/* nvs_checkpoint_size returns the room reserved in each sector for the
+ * mount checkpoint: header, lookup cache and ate.
+ */
+static inline size_t nvs_checkpoint_size(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_MOUNT_CHECKPOINT
+	return nvs_al_size(fs, sizeof(struct nvs_checkpoint)) +
+	       nvs_al_size(fs, sizeof(fs->lookup_cache)) +
+	       nvs_al_size(fs, sizeof(struct nvs_ate));
+#else
+	return 0;
+#endif
+}
 /* end basic routines */
 
 /* flash routines */
@@ -441,6 +455,12 @@ static int nvs_close_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry)
 	return 1;
 }
 
+/* nvs_ate_checkpoint returns true if the ate describes a mount checkpoint */
+static bool nvs_ate_checkpoint(const struct nvs_ate *entry)
+{
+	return (entry->id == 0xFFFF) && (entry->part == NVS_CHECKPOINT_PART);
+}
+
 /* store an entry in flash */
 static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 				size_t len)
@@ -577,6 +597,151 @@ static void nvs_sector_advance(struct nvs_fs *fs, uint32_t *addr)
 	}
 }
 
+#ifdef CONFIG_NVS_MOUNT_CHECKPOINT
+/* write a copy of the lookup cache as the last ate of the sector that is
+ * about to be closed. The room is reserved by nvs_write() but it can have
+ * been used by delete ate's, in which case no checkpoint is written.
+ */
+static int nvs_checkpoint_write(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_checkpoint checkpoint;
+	struct nvs_ate entry;
+	size_t hdr_size, data_size;
+
+	hdr_size = nvs_al_size(fs, sizeof(struct nvs_checkpoint));
+	data_size = hdr_size + nvs_al_size(fs, sizeof(fs->lookup_cache));
+
+	if (fs->ate_wra < (fs->data_wra + data_size)) {
+		LOG_DBG("No room for checkpoint");
+		return 0;
+	}
+
+	checkpoint.cache_size = CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	checkpoint.sector_count = fs->sector_count;
+	checkpoint.crc32 = crc32_ieee((const uint8_t *)&checkpoint.cache_size,
+				      sizeof(checkpoint) - sizeof(checkpoint.crc32));
+	checkpoint.crc32 = crc32_ieee_update(checkpoint.crc32,
+					     (const uint8_t *)fs->lookup_cache,
+					     sizeof(fs->lookup_cache));
+
+	entry.id = 0xFFFF;
+	entry.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	entry.len = (uint16_t)data_size;
+	entry.part = NVS_CHECKPOINT_PART;
+	nvs_ate_crc8_update(&entry);
+
+	rc = nvs_flash_data_wrt(fs, &checkpoint, sizeof(checkpoint), false);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_flash_data_wrt(fs, fs->lookup_cache, sizeof(fs->lookup_cache),
+				false);
+	if (rc) {
+		return rc;
+	}
+
+	return nvs_flash_ate_wrt(fs, &entry);
+}
+
+/* restore the lookup cache from the checkpoint written when the sector before
+ * the write sector was closed. Since then only the sector after the write
+ * sector has been garbage collected and only the write sector has been
+ * written, so the cache entries of the first are dropped and the ate's of the
+ * second are added, oldest first.
+ * returns 0 if the cache is restored, -ENOENT if there is no valid checkpoint.
+ */
+static int nvs_checkpoint_load(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_checkpoint checkpoint;
+	struct nvs_ate ate;
+	uint32_t addr, crc32;
+	size_t ate_size, hdr_size, data_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	hdr_size = nvs_al_size(fs, sizeof(struct nvs_checkpoint));
+	data_size = hdr_size + nvs_al_size(fs, sizeof(fs->lookup_cache));
+
+	addr = fs->ate_wra & ADDR_SECT_MASK;
+	if ((addr >> ADDR_SECT_SHIFT) == 0U) {
+		addr += ((fs->sector_count - 1) << ADDR_SECT_SHIFT);
+	} else {
+		addr -= (1 << ADDR_SECT_SHIFT);
+	}
+	addr += fs->sector_size - ate_size;
+
+	rc = nvs_flash_ate_rd(fs, addr, &ate);
+	if (rc) {
+		return rc;
+	}
+
+	if (!nvs_close_ate_valid(fs, &ate)) {
+		return -ENOENT;
+	}
+
+	/* the checkpoint is the last ate before the close ate */
+	addr &= ADDR_SECT_MASK;
+	addr += ate.offset;
+	rc = nvs_flash_ate_rd(fs, addr, &ate);
+	if (rc) {
+		return rc;
+	}
+
+	if (!nvs_ate_valid(fs, &ate) || !nvs_ate_checkpoint(&ate) ||
+	    (ate.len != data_size)) {
+		return -ENOENT;
+	}
+
+	addr &= ADDR_SECT_MASK;
+	addr += ate.offset;
+	rc = nvs_flash_rd(fs, addr, &checkpoint, sizeof(checkpoint));
+	if (rc) {
+		return rc;
+	}
+
+	if ((checkpoint.cache_size != CONFIG_NVS_LOOKUP_CACHE_SIZE) ||
+	    (checkpoint.sector_count != fs->sector_count)) {
+		return -ENOENT;
+	}
+
+	rc = nvs_flash_rd(fs, addr + hdr_size, fs->lookup_cache,
+			  sizeof(fs->lookup_cache));
+	if (rc) {
+		return rc;
+	}
+
+	crc32 = crc32_ieee((const uint8_t *)&checkpoint.cache_size,
+			   sizeof(checkpoint) - sizeof(checkpoint.crc32));
+	crc32 = crc32_ieee_update(crc32, (const uint8_t *)fs->lookup_cache,
+				  sizeof(fs->lookup_cache));
+	if (crc32 != checkpoint.crc32) {
+		return -ENOENT;
+	}
+
+	addr = fs->ate_wra & ADDR_SECT_MASK;
+	nvs_sector_advance(fs, &addr);
+	nvs_lookup_cache_invalidate(fs, addr >> ADDR_SECT_SHIFT);
+
+	addr = (fs->ate_wra & ADDR_SECT_MASK) + fs->sector_size - 2 * ate_size;
+	while (addr > fs->ate_wra) {
+		rc = nvs_flash_ate_rd(fs, addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if ((ate.id != 0xFFFF) && nvs_ate_valid(fs, &ate)) {
+			fs->lookup_cache[nvs_lookup_cache_pos(ate.id)] = addr;
+		}
+
+		addr -= ate_size;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NVS_MOUNT_CHECKPOINT */
+
 /* allocation entry close (this closes the current sector) by writing offset
  * of last ate to the sector end.
  */
@@ -587,6 +752,10 @@ static int nvs_sector_close(struct nvs_fs *fs)
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
+#ifdef CONFIG_NVS_MOUNT_CHECKPOINT
+	(void)nvs_checkpoint_write(fs);
+#endif
+
 	close_ate.id = 0xFFFF;
 	close_ate.len = 0U;
 	close_ate.offset = (uint16_t)((fs->ate_wra + ate_size) & ADDR_OFFS_MASK);
@@ -673,6 +842,11 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
+		/* checkpoints are not moved, a new one is written on close */
+		if (nvs_ate_checkpoint(&gc_ate)) {
+			continue;
+		}
+
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
 
@@ -745,6 +919,34 @@ gc_done:
 	return rc;
 }
 
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* a write can have closed the sector in the meantime */
+	if (!fs->ready || ((fs->ate_wra >> ADDR_SECT_SHIFT) != fs->gc_sector)) {
+		goto end;
+	}
+
+	LOG_DBG("Background gc of sector %d", fs->gc_sector);
+
+	rc = nvs_sector_close(fs);
+	if (!rc) {
+		rc = nvs_gc(fs);
+	}
+
+	if (rc) {
+		LOG_ERR("Background gc failed: %d", rc);
+	}
+end:
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -949,7 +1151,12 @@ static int nvs_startup(struct nvs_fs *fs)
 
 end:
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef CONFIG_NVS_MOUNT_CHECKPOINT
+	if (!rc && nvs_checkpoint_load(fs)) {
+		LOG_DBG("No valid checkpoint, rebuilding lookup cache");
+		rc = nvs_lookup_cache_rebuild(fs);
+	}
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	if (!rc) {
 		rc = nvs_lookup_cache_rebuild(fs);
 	}
@@ -997,6 +1204,9 @@ int nvs_mount(struct nvs_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->nvs_lock);
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	k_work_init(&fs->gc_work, nvs_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1056,6 +1266,9 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	uint32_t wlk_addr, rd_addr;
 	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
 	bool prev_found = false;
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	uint32_t free_space;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("NVS not initialized");
@@ -1069,9 +1282,10 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	 * where: 1 ate for data, 1 ate for sector close, 1 ate for gc done,
 	 * and 1 ate to always allow a delete.
 	 * Also take into account the data CRC that is appended at the end of the data field,
-	 * if any.
+	 * if any, and the room reserved for the mount checkpoint.
 	 */
-	if ((len > (fs->sector_size - 4 * ate_size - NVS_DATA_CRC_SIZE)) ||
+	if ((len > (fs->sector_size - 4 * ate_size - NVS_DATA_CRC_SIZE -
+		    nvs_checkpoint_size(fs))) ||
 	    ((len > 0) && (data == NULL))) {
 		return -EINVAL;
 	}
@@ -1137,12 +1351,17 @@ no_cached_entry:
 
 	/* calculate required space if the entry contains data */
 	if (data_size) {
-		/* Leave space for delete ate */
-		required_space = data_size + ate_size + NVS_DATA_CRC_SIZE;
+		/* Leave space for delete ate and mount checkpoint */
+		required_space = data_size + ate_size + NVS_DATA_CRC_SIZE +
+				 nvs_checkpoint_size(fs);
 	}
 
 	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
 
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	free_space = fs->ate_wra - fs->data_wra;
+#endif
+
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -1174,6 +1393,17 @@ no_cached_entry:
 		}
 		gc_count++;
 	}
+
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	/* Start the gc once this write makes the sector run low on free space,
+	 * so the next writes find an open sector with room.
+	 */
+	if ((gc_count == 0) && (free_space >= CONFIG_NVS_BACKGROUND_GC_THRESHOLD) &&
+	    ((fs->ate_wra - fs->data_wra) < CONFIG_NVS_BACKGROUND_GC_THRESHOLD)) {
+		fs->gc_sector = fs->ate_wra >> ADDR_SECT_SHIFT;
+		(void)k_work_submit(&fs->gc_work);
+	}
+#endif
 	rc = len;
 end:
 	k_mutex_unlock(&fs->nvs_lock);
@@ -1304,11 +1534,13 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 
 	/*
 	 * There is always a closing ATE and a reserved ATE for
-	 * deletion in each sector.
+	 * deletion in each sector, plus the room reserved for the mount
+	 * checkpoint if enabled.
 	 * Take into account one less sector because it is reserved for the
 	 * garbage collection.
 	 */
-	free_space = (fs->sector_count - 1) * (fs->sector_size - (2 * ate_size));
+	free_space = (fs->sector_count - 1) *
+		     (fs->sector_size - (2 * ate_size) - nvs_checkpoint_size(fs));
 
 	step_addr = fs->ate_wra;
 
@@ -1337,7 +1569,8 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 				if (step_ate.id == 0xFFFF) {
 					free_space -= ate_size;
 				}
-			} else if (wlk_addr == step_addr) {
+			} else if ((wlk_addr == step_addr) &&
+				   !nvs_ate_checkpoint(&step_ate)) {
 				/* count needed */
 				free_space -= nvs_al_size(fs, step_ate.len);
 				free_space -= ate_size;
@@ -1362,7 +1595,8 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs)
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
-	return fs->ate_wra - fs->data_wra - ate_size - NVS_DATA_CRC_SIZE;
+	return fs->ate_wra - fs->data_wra - ate_size - NVS_DATA_CRC_SIZE -
+	       nvs_checkpoint_size(fs);
 }
 
 int nvs_sector_use_next(struct nvs_fs *fs)
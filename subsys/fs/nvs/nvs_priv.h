@@ -30,6 +30,9 @@ extern "C" {
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
 
+/* part value that marks the ATE of a mount checkpoint */
+#define NVS_CHECKPOINT_PART 0xFE
+
 /*
  * Allow to use the NVS_DATA_CRC_SIZE macro in computations whether data CRC is enabled or not
  */
@@ -52,6 +55,13 @@ BUILD_ASSERT(offsetof(struct nvs_ate, crc8) ==
 		 sizeof(struct nvs_ate) - sizeof(uint8_t),
 		 "crc8 must be the last member");
 
+/* Mount checkpoint header, the lookup cache follows in flash */
+struct nvs_checkpoint {
+	uint32_t crc32;	/* crc32 of the header fields below and the cache */
+	uint16_t cache_size;	/* number of lookup cache entries */
+	uint16_t sector_count;	/* number of sectors of the fs */
+} __packed;
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,15 +40,113 @@ static inline size_t zms_lookup_cache_pos(uint32_t id)
 	return hash % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+/* Find the cache entry of an ID by linear probing from its hash position.
+ * Entries whose address is ZMS_LOOKUP_CACHE_NO_ADDR are free: they are unused
+ * when their ID is ZMS_HEAD_ID, which also ends the probing, or belong to an
+ * ID that has no entry anymore. If add is true, a free entry is taken for an
+ * ID that is not found.
+ */
+static uint64_t *zms_lookup_cache_entry(struct zms_fs *fs, uint32_t id, bool add)
+{
+	size_t pos = zms_lookup_cache_pos(id);
+	uint64_t *free_entry = NULL;
+
+	for (size_t i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache_id[pos] == id) {
+			return &fs->lookup_cache[pos];
+		}
+
+		if (fs->lookup_cache[pos] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			if (free_entry == NULL) {
+				free_entry = &fs->lookup_cache[pos];
+			}
+
+			if (fs->lookup_cache_id[pos] == ZMS_HEAD_ID) {
+				break;
+			}
+		}
+
+		pos = (pos + 1) % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+	}
+
+	if (!add) {
+		return NULL;
+	}
+
+	if (free_entry == NULL) {
+		/* IDs that are not cached have to be searched for in flash */
+		if (!fs->lookup_cache_incomplete) {
+			LOG_WRN("Lookup cache full, IDs are not all cached");
+		}
+		fs->lookup_cache_incomplete = true;
+		return NULL;
+	}
+
+	fs->lookup_cache_id[free_entry - fs->lookup_cache] = id;
+
+	return free_entry;
+}
+#endif /* CONFIG_ZMS_LOOKUP_CACHE_FULL */
+
+/* Returns the address of the most recent ATE to start looking for an ID at,
+ * or ZMS_LOOKUP_CACHE_NO_ADDR if the ID is not stored.
+ */
+static uint64_t zms_lookup_cache_get(struct zms_fs *fs, uint32_t id)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+	uint64_t *cache_entry = zms_lookup_cache_entry(fs, id, false);
+
+	if (cache_entry != NULL) {
+		return *cache_entry;
+	}
+
+	return fs->lookup_cache_incomplete ? fs->ate_wra : ZMS_LOOKUP_CACHE_NO_ADDR;
+#else
+	return fs->lookup_cache[zms_lookup_cache_pos(id)];
+#endif
+}
+
+static void zms_lookup_cache_set(struct zms_fs *fs, uint32_t id, uint64_t addr)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+	uint64_t *cache_entry = zms_lookup_cache_entry(fs, id, true);
+
+	if (cache_entry != NULL) {
+		*cache_entry = addr;
+	}
+#else
+	fs->lookup_cache[zms_lookup_cache_pos(id)] = addr;
+#endif
+}
+
+/* Returns true if the rebuild has not found an ATE for the ID yet */
+static bool zms_lookup_cache_missing(struct zms_fs *fs, uint32_t id)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+	return zms_lookup_cache_entry(fs, id, false) == NULL;
+#else
+	return fs->lookup_cache[zms_lookup_cache_pos(id)] == ZMS_LOOKUP_CACHE_NO_ADDR;
+#endif
+}
+
+static void zms_lookup_cache_clear(struct zms_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+	memset(fs->lookup_cache_id, 0xff, sizeof(fs->lookup_cache_id));
+	fs->lookup_cache_incomplete = false;
+#endif
+}
+
 static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 {
 	int rc, previous_sector_num = ZMS_INVALID_SECTOR_NUM;
 	uint64_t addr, ate_addr;
-	uint64_t *cache_entry;
 	uint8_t current_cycle;
 	struct zms_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	zms_lookup_cache_clear(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -60,9 +158,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
-
-		if (ate.id != ZMS_HEAD_ID && *cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		if (ate.id != ZMS_HEAD_ID && zms_lookup_cache_missing(fs, ate.id)) {
 			/* read the ate cycle only when we change the sector
 			 * or if it is the first read
 			 */
@@ -77,7 +173,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 				}
 			}
 			if (zms_ate_valid_different_sector(fs, &ate, current_cycle)) {
-				*cache_entry = ate_addr;
+				zms_lookup_cache_set(fs, ate.id, ate_addr);
 			}
 			previous_sector_num = SECTOR_NUM(ate_addr);
 		}
@@ -195,7 +291,7 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	/* 0xFFFFFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != ZMS_HEAD_ID) {
-		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		zms_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
@@ -916,7 +1012,7 @@ static int zms_gc(struct zms_fs *fs)
 		}
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = zms_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -1025,6 +1121,34 @@ end:
 	return 0;
 }
 
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+static void zms_gc_work_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	/* a write can have closed the sector in the meantime */
+	if (!fs->ready || (SECTOR_NUM(fs->ate_wra) != fs->gc_sector)) {
+		goto end;
+	}
+
+	LOG_DBG("Background gc of sector %u", fs->gc_sector);
+
+	rc = zms_sector_close(fs);
+	if (!rc) {
+		rc = zms_gc(fs);
+	}
+
+	if (rc) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+	}
+end:
+	k_mutex_unlock(&fs->zms_lock);
+}
+#endif
+
 static int zms_init(struct zms_fs *fs)
 {
 	int rc, sec_closed;
@@ -1258,9 +1382,14 @@ static int zms_init(struct zms_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+		zms_lookup_cache_clear(fs);
+		fs->lookup_cache_incomplete = true;
+#else
 		for (i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#endif
 #endif
 		rc = zms_gc(fs);
 		goto end;
@@ -1291,6 +1420,9 @@ int zms_mount(struct zms_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->zms_lock);
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	k_work_init(&fs->gc_work, zms_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1360,6 +1492,9 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 	uint64_t wlk_addr, rd_addr;
 	uint32_t gc_count, required_space = 0U; /* no space, appropriate for delete ate */
 	int prev_found = 0;
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	uint64_t free_space;
+#endif
 
 	if (!fs->ready) {
 		LOG_ERR("zms not initialized");
@@ -1380,7 +1515,7 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1448,6 +1583,10 @@ no_cached_entry:
 
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
 
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	free_space = fs->ate_wra - fs->data_wra;
+#endif
+
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -1485,6 +1624,17 @@ no_cached_entry:
 		}
 		gc_count++;
 	}
+
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	/* Start the gc once this write makes the sector run low on free space,
+	 * so the next writes find an open sector with room.
+	 */
+	if ((gc_count == 0) && (free_space >= CONFIG_ZMS_BACKGROUND_GC_THRESHOLD) &&
+	    ((fs->ate_wra - fs->data_wra) < CONFIG_ZMS_BACKGROUND_GC_THRESHOLD)) {
+		fs->gc_sector = SECTOR_NUM(fs->ate_wra);
+		(void)k_work_submit(&fs->gc_work);
+	}
+#endif
 	rc = len;
 end:
 	k_mutex_unlock(&fs->zms_lock);
@@ -1514,7 +1664,7 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 	cnt_his = 0U;
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
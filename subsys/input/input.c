@@ -8,6 +8,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 
@@ -18,6 +19,96 @@ K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 
 #endif
 
+#ifdef CONFIG_INPUT_QUEUE_STATS
+static struct k_spinlock input_stats_lock;
+static struct input_queue_stats input_stats;
+
+static void input_stats_queued(int ret)
+{
+	uint32_t used = k_msgq_num_used_get(&input_msgq);
+	k_spinlock_key_t key = k_spin_lock(&input_stats_lock);
+
+	if (ret < 0) {
+		input_stats.dropped++;
+	}
+
+	input_stats.max_used = MAX(input_stats.max_used, used);
+
+	k_spin_unlock(&input_stats_lock, key);
+}
+
+int input_queue_stats_get(struct input_queue_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&input_stats_lock);
+
+	*stats = input_stats;
+
+	k_spin_unlock(&input_stats_lock, key);
+
+	return 0;
+}
+
+void input_queue_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&input_stats_lock);
+
+	memset(&input_stats, 0, sizeof(input_stats));
+
+	k_spin_unlock(&input_stats_lock, key);
+}
+#endif /* CONFIG_INPUT_QUEUE_STATS */
+
+#ifdef CONFIG_INPUT_BATCH
+/* Only accessed from the input thread */
+static struct input_event input_batch[CONFIG_INPUT_BATCH_MAX_EVENTS];
+static size_t input_batch_count;
+
+static void input_batch_flush(void)
+{
+	const struct device *dev;
+
+	if (input_batch_count == 0) {
+		return;
+	}
+
+	dev = input_batch[0].dev;
+
+	STRUCT_SECTION_FOREACH(input_batch_callback, callback) {
+		if (callback->dev == NULL || callback->dev == dev) {
+			callback->callback(input_batch, input_batch_count,
+					   callback->user_data);
+		}
+	}
+
+#ifdef CONFIG_INPUT_QUEUE_STATS
+	k_spinlock_key_t key = k_spin_lock(&input_stats_lock);
+
+	input_stats.batches++;
+	input_stats.batch_max = MAX(input_stats.batch_max, input_batch_count);
+
+	k_spin_unlock(&input_stats_lock, key);
+#endif
+
+	input_batch_count = 0;
+}
+
+/* A batch holds the events of a single device, up to the one with the sync
+ * flag set. It is delivered early if another device reports or if it is full.
+ */
+static void input_batch_add(struct input_event *evt)
+{
+	if (input_batch_count > 0 && input_batch[0].dev != evt->dev) {
+		input_batch_flush();
+	}
+
+	input_batch[input_batch_count++] = *evt;
+
+	if (evt->sync || input_batch_count == ARRAY_SIZE(input_batch)) {
+		input_batch_flush();
+	}
+}
+#endif /* CONFIG_INPUT_BATCH */
+
 static void input_process(struct input_event *evt)
 {
 	STRUCT_SECTION_FOREACH(input_callback, callback) {
@@ -25,6 +116,10 @@ static void input_process(struct input_event *evt)
 			callback->callback(evt, callback->user_data);
 		}
 	}
+
+#ifdef CONFIG_INPUT_BATCH
+	input_batch_add(evt);
+#endif
 }
 
 bool input_queue_empty(void)
@@ -50,7 +145,13 @@ int input_report(const struct device *dev,
 	};
 
 #ifdef CONFIG_INPUT_MODE_THREAD
-	return k_msgq_put(&input_msgq, &evt, timeout);
+	int ret = k_msgq_put(&input_msgq, &evt, timeout);
+
+#ifdef CONFIG_INPUT_QUEUE_STATS
+	input_stats_queued(ret);
+#endif
+
+	return ret;
 #else
 	input_process(&evt);
 	return 0;
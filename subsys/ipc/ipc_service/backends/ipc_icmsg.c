@@ -43,10 +43,66 @@ static int send(const struct device *instance, void *token,
 	return icmsg_send(conf, dev_data, msg, len);
 }
 
+static int get_tx_buffer_size(const struct device *instance, void *token)
+{
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_get_tx_buffer_size(dev_data);
+}
+
+static int get_tx_buffer(const struct device *instance, void *token,
+			 void **data, uint32_t *len, k_timeout_t wait)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_get_tx_buffer(conf, dev_data, data, len, wait);
+}
+
+static int drop_tx_buffer(const struct device *instance, void *token,
+			  const void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_drop_tx_buffer(conf, dev_data, data);
+}
+
+static int send_nocopy(const struct device *instance, void *token,
+		       const void *data, size_t len)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_send_nocopy(conf, dev_data, data, len);
+}
+
+static int hold_rx_buffer(const struct device *instance, void *token,
+			  void *data)
+{
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_hold_rx_buffer(dev_data, data);
+}
+
+static int release_rx_buffer(const struct device *instance, void *token,
+			     void *data)
+{
+	struct icmsg_data_t *dev_data = instance->data;
+
+	return icmsg_release_rx_buffer(dev_data, data);
+}
+
 const static struct ipc_service_backend backend_ops = {
 	.register_endpoint = register_ept,
 	.deregister_endpoint = deregister_ept,
 	.send = send,
+	.get_tx_buffer_size = get_tx_buffer_size,
+	.get_tx_buffer = get_tx_buffer,
+	.drop_tx_buffer = drop_tx_buffer,
+	.send_nocopy = send_nocopy,
+	.hold_rx_buffer = hold_rx_buffer,
+	.release_rx_buffer = release_rx_buffer,
 };
 
 static int backend_init(const struct device *instance)
@@ -260,10 +260,73 @@ static int send(const struct device *instance, void *token,
 			     user_len);
 }
 
+static int get_tx_buffer_size(const struct device *instance, void *token)
+{
+	struct backend_data_t *dev_data = instance->data;
+
+	return icmsg_me_get_tx_buffer_size(&dev_data->icmsg_me_data);
+}
+
+static int get_tx_buffer(const struct device *instance, void *token,
+			 void **data, uint32_t *user_len, k_timeout_t wait)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct backend_data_t *dev_data = instance->data;
+
+	return icmsg_me_get_tx_buffer(conf, &dev_data->icmsg_me_data, data,
+				      user_len, wait);
+}
+
+static int drop_tx_buffer(const struct device *instance, void *token,
+			  const void *data)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct backend_data_t *dev_data = instance->data;
+
+	return icmsg_me_drop_tx_buffer(conf, &dev_data->icmsg_me_data, data);
+}
+
+static int send_nocopy(const struct device *instance, void *token,
+		       const void *msg, size_t user_len)
+{
+	const struct icmsg_config_t *conf = instance->config;
+	struct backend_data_t *dev_data = instance->data;
+	icmsg_me_ept_id_t *id = token;
+
+	if (*id == INVALID_EPT_ID) {
+		return -ENOTCONN;
+	}
+
+	return icmsg_me_send_nocopy(conf, &dev_data->icmsg_me_data, *id, msg,
+				    user_len);
+}
+
+static int hold_rx_buffer(const struct device *instance, void *token,
+			  void *data)
+{
+	struct backend_data_t *dev_data = instance->data;
+
+	return icmsg_me_hold_rx_buffer(&dev_data->icmsg_me_data, data);
+}
+
+static int release_rx_buffer(const struct device *instance, void *token,
+			     void *data)
+{
+	struct backend_data_t *dev_data = instance->data;
+
+	return icmsg_me_release_rx_buffer(&dev_data->icmsg_me_data, data);
+}
+
 const static struct ipc_service_backend backend_ops = {
 	.open_instance = open,
 	.register_endpoint = register_ept,
 	.send = send,
+	.get_tx_buffer_size = get_tx_buffer_size,
+	.get_tx_buffer = get_tx_buffer,
+	.drop_tx_buffer = drop_tx_buffer,
+	.send_nocopy = send_nocopy,
+	.hold_rx_buffer = hold_rx_buffer,
+	.release_rx_buffer = release_rx_buffer,
 };
 
 static int backend_init(const struct device *instance)
@@ -176,35 +176,68 @@ static void mbox_callback_process(struct icmsg_data_t *dev_data)
 #ifdef CONFIG_MULTITHREADING
 	struct icmsg_data_t *dev_data = CONTAINER_OF(item, struct icmsg_data_t, mbox_work);
 #endif
-	uint8_t rx_buffer[CONFIG_PBUF_RX_READ_BUF_SIZE] __aligned(4);
+	char *rx_data;
+	bool claimed = true;
+
+	if (atomic_get(&dev_data->rx_held)) {
+		/* Resumed when the held packet is released. */
+		return;
+	}
 
 	atomic_t state = atomic_get(&dev_data->state);
 
-	uint32_t len = data_available(dev_data);
+	/* Hand the packet over in place, unless it is wrapped in the buffer. */
+	int ret = pbuf_claim(dev_data->rx_pb, &rx_data);
 
-	if (len == 0) {
-		/* Unlikely, no data in buffer. */
-		return;
-	}
+	if (ret == -ENOTSUP) {
+		uint32_t plen = data_available(dev_data);
 
-	__ASSERT_NO_MSG(len <= sizeof(rx_buffer));
+		__ASSERT_NO_MSG(plen <= sizeof(dev_data->rx_buffer));
 
-	if (sizeof(rx_buffer) < len) {
+		if (sizeof(dev_data->rx_buffer) < plen) {
+			return;
+		}
+
+		ret = pbuf_read(dev_data->rx_pb, dev_data->rx_buffer, sizeof(dev_data->rx_buffer));
+		rx_data = dev_data->rx_buffer;
+		claimed = false;
+	}
+
+	if (ret <= 0) {
+		/* Unlikely, no data in buffer. */
 		return;
 	}
 
-	len = pbuf_read(dev_data->rx_pb, rx_buffer, sizeof(rx_buffer));
+	uint32_t len = ret;
 
 	if (state == ICMSG_STATE_READY) {
+		dev_data->rx_buf = rx_data;
+		dev_data->rx_len = len;
+		dev_data->rx_claimed = claimed;
+
 		if (dev_data->cb->received) {
-			dev_data->cb->received(rx_buffer, len, dev_data->ctx);
+			dev_data->cb->received(rx_data, len, dev_data->ctx);
+		}
+
+		if (atomic_get(&dev_data->rx_held)) {
+			/* Freed by icmsg_release_rx_buffer(). */
+			return;
+		}
+
+		dev_data->rx_buf = NULL;
+		if (claimed) {
+			(void)pbuf_free(dev_data->rx_pb, len);
 		}
 	} else {
 		__ASSERT_NO_MSG(state == ICMSG_STATE_BUSY);
 
 		/* Allow magic number longer than sizeof(magic) for future protocol version. */
 		bool endpoint_invalid = (len < sizeof(magic) ||
-					memcmp(magic, rx_buffer, sizeof(magic)));
+					memcmp(magic, rx_data, sizeof(magic)));
+
+		if (claimed) {
+			(void)pbuf_free(dev_data->rx_pb, len);
+		}
 
 		if (endpoint_invalid) {
 			__ASSERT_NO_MSG(false);
@@ -269,6 +302,9 @@ int icmsg_open(const struct icmsg_config_t *conf,
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
 	k_mutex_init(&dev_data->tx_lock);
 #endif
+	dev_data->tx_buf = NULL;
+	dev_data->rx_buf = NULL;
+	atomic_clear(&dev_data->rx_held);
 
 	int ret = pbuf_tx_init(dev_data->tx_pb);
 
@@ -353,7 +389,12 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	}
 #endif
 
-	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
+	if (dev_data->tx_buf != NULL) {
+		/* Allocated TX buffer has to be sent or dropped first. */
+		write_ret = -ENOBUFS;
+	} else {
+		write_ret = pbuf_write(dev_data->tx_pb, msg, len);
+	}
 
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
 	release_ret = release_tx_buffer(dev_data);
@@ -377,6 +418,163 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	return sent_bytes;
 }
 
+int icmsg_get_tx_buffer_size(struct icmsg_data_t *dev_data)
+{
+	uint32_t len = dev_data->tx_pb->cfg->len - _PBUF_IDX_SIZE - PBUF_PACKET_LEN_SZ;
+
+	return MIN(len, UINT16_MAX);
+}
+
+int icmsg_get_tx_buffer(const struct icmsg_config_t *conf,
+			struct icmsg_data_t *dev_data,
+			void **data, uint32_t *size, k_timeout_t wait)
+{
+	char *buf;
+	int ret;
+
+	if (!is_endpoint_ready(dev_data)) {
+		return -EBUSY;
+	}
+
+	if (*size > UINT16_MAX) {
+		*size = icmsg_get_tx_buffer_size(dev_data);
+		return -ENOMEM;
+	}
+
+#ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
+	/* Held until the buffer is sent or dropped. */
+	if (k_mutex_lock(&dev_data->tx_lock, wait) < 0) {
+		return -ENOBUFS;
+	}
+#endif
+
+	if (dev_data->tx_buf != NULL) {
+		ret = -EALREADY;
+		goto out;
+	}
+
+	ret = pbuf_alloc(dev_data->tx_pb, *size, &buf);
+	if (ret == -ENOMEM) {
+		/* Report the maximal size available. */
+		ret = pbuf_alloc(dev_data->tx_pb, 0, &buf);
+		*size = MAX(ret, 0);
+		ret = -ENOMEM;
+		goto out;
+	} else if (ret < 0) {
+		goto out;
+	}
+
+	dev_data->tx_buf = buf;
+	*data = buf;
+	*size = ret;
+
+	return 0;
+
+out:
+#ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
+	(void)release_tx_buffer(dev_data);
+#endif
+	return ret;
+}
+
+int icmsg_drop_tx_buffer(const struct icmsg_config_t *conf,
+			 struct icmsg_data_t *dev_data,
+			 const void *data)
+{
+	if (dev_data->tx_buf == NULL) {
+		return -EALREADY;
+	}
+
+	if (dev_data->tx_buf != data) {
+		return -ENXIO;
+	}
+
+	/* Nothing is visible to the remote before the buffer is committed. */
+	dev_data->tx_buf = NULL;
+#ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
+	(void)release_tx_buffer(dev_data);
+#endif
+
+	return 0;
+}
+
+int icmsg_send_nocopy(const struct icmsg_config_t *conf,
+		      struct icmsg_data_t *dev_data,
+		      const void *msg, size_t len)
+{
+	int ret;
+
+	if (dev_data->tx_buf == NULL || dev_data->tx_buf != msg) {
+		return -ENXIO;
+	}
+
+	/* Empty message is not allowed */
+	if (len == 0) {
+		return -ENODATA;
+	}
+
+	if (len > UINT16_MAX) {
+		return -EBADMSG;
+	}
+
+	ret = pbuf_commit(dev_data->tx_pb, msg, len);
+	if (ret < 0) {
+		return ret == -ENOMEM ? -EBADMSG : ret;
+	}
+
+	dev_data->tx_buf = NULL;
+#ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
+	(void)release_tx_buffer(dev_data);
+#endif
+
+	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
+
+	ret = mbox_send_dt(&conf->mbox_tx, NULL);
+	if (ret) {
+		return ret;
+	}
+
+	return len;
+}
+
+int icmsg_hold_rx_buffer(struct icmsg_data_t *dev_data, const void *data)
+{
+	if (dev_data->rx_buf == NULL || dev_data->rx_buf != data) {
+		return -ENXIO;
+	}
+
+	atomic_set(&dev_data->rx_held, 1);
+
+	return 0;
+}
+
+int icmsg_release_rx_buffer(struct icmsg_data_t *dev_data, const void *data)
+{
+	if (!atomic_get(&dev_data->rx_held)) {
+		return -EALREADY;
+	}
+
+	if (dev_data->rx_buf != data) {
+		return -ENXIO;
+	}
+
+	dev_data->rx_buf = NULL;
+	if (dev_data->rx_claimed) {
+		(void)pbuf_free(dev_data->rx_pb, dev_data->rx_len);
+	}
+
+	atomic_clear(&dev_data->rx_held);
+
+	/* Receive the packets that arrived in the meantime. */
+#ifdef CONFIG_MULTITHREADING
+	submit_work_if_buffer_free_and_data_available(dev_data);
+#else
+	submit_if_buffer_free_and_data_available(dev_data);
+#endif
+
+	return 0;
+}
+
 #if defined(CONFIG_IPC_SERVICE_BACKEND_ICMSG_WQ_ENABLE)
 
 static int work_q_init(void)
@@ -217,3 +217,93 @@ int icmsg_me_send(const struct icmsg_config_t *conf,
 
 	return sent_bytes;
 }
+
+static const void *user_buffer_to_icmsg_buffer(const void *user_buffer)
+{
+	return ((const char *)user_buffer) - HEADER_SIZE;
+}
+
+int icmsg_me_get_tx_buffer_size(struct icmsg_me_data_t *data)
+{
+	return icmsg_buffer_len_to_user_buffer_len(
+		icmsg_get_tx_buffer_size(&data->icmsg_data));
+}
+
+int icmsg_me_get_tx_buffer(const struct icmsg_config_t *conf,
+			   struct icmsg_me_data_t *data,
+			   void **buf, uint32_t *size, k_timeout_t wait)
+{
+	uint32_t icmsg_buffer_len = 0;
+	void *icmsg_buffer;
+	int r;
+
+	if (*size > 0) {
+		icmsg_buffer_len = user_buffer_len_to_icmsg_buffer_len(*size);
+	}
+
+	r = icmsg_get_tx_buffer(conf, &data->icmsg_data, &icmsg_buffer,
+				&icmsg_buffer_len, wait);
+
+	/* Also on -ENOMEM, the size available is reported. */
+	*size = MAX(icmsg_buffer_len_to_user_buffer_len(icmsg_buffer_len), 0);
+	if (r < 0) {
+		return r;
+	}
+
+	if (*size == 0) {
+		(void)icmsg_drop_tx_buffer(conf, &data->icmsg_data, icmsg_buffer);
+		return -ENOMEM;
+	}
+
+	*buf = icmsg_buffer_to_user_buffer(icmsg_buffer);
+
+	return 0;
+}
+
+int icmsg_me_drop_tx_buffer(const struct icmsg_config_t *conf,
+			    struct icmsg_me_data_t *data,
+			    const void *buf)
+{
+	return icmsg_drop_tx_buffer(conf, &data->icmsg_data,
+				    user_buffer_to_icmsg_buffer(buf));
+}
+
+int icmsg_me_send_nocopy(const struct icmsg_config_t *conf,
+			 struct icmsg_me_data_t *data, icmsg_me_ept_id_t id,
+			 const void *msg, size_t len)
+{
+	void *icmsg_buffer = (void *)user_buffer_to_icmsg_buffer(msg);
+	ssize_t icmsg_buffer_len = user_buffer_len_to_icmsg_buffer_len(len);
+	int r;
+
+	if (icmsg_buffer_len < 0) {
+		return -EBADMSG;
+	}
+
+	if (data->icmsg_data.tx_buf != icmsg_buffer) {
+		return -ENXIO;
+	}
+
+	/* The endpoint id is placed in front of the user data. */
+	set_ept_id_in_send_buffer(icmsg_buffer, id);
+
+	r = icmsg_send_nocopy(conf, &data->icmsg_data, icmsg_buffer,
+			      icmsg_buffer_len);
+	if (r < 0) {
+		return r;
+	}
+
+	return icmsg_buffer_len_to_user_buffer_len(r);
+}
+
+int icmsg_me_hold_rx_buffer(struct icmsg_me_data_t *data, const void *buf)
+{
+	return icmsg_hold_rx_buffer(&data->icmsg_data,
+				    user_buffer_to_icmsg_buffer(buf));
+}
+
+int icmsg_me_release_rx_buffer(struct icmsg_me_data_t *data, const void *buf)
+{
+	return icmsg_release_rx_buffer(&data->icmsg_data,
+				       user_buffer_to_icmsg_buffer(buf));
+}
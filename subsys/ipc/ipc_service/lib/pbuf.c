@@ -253,3 +253,189 @@ int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 
 	return len;
 }
+
+int pbuf_claim(struct pbuf *pb, char **buf)
+{
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* Invalidate wr_idx only, local rd_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->wr_idx_loc), sizeof(*(pb->cfg->wr_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t wr_idx = *(pb->cfg->wr_idx_loc);
+	uint32_t rd_idx = pb->data.rd_idx;
+
+	/* rd_idx must always be aligned. */
+	__ASSERT_NO_MSG(IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE));
+	/* wr_idx shall always be aligned, but its value is received from the
+	 * writer. Can not assert.
+	 */
+	if (!IS_PTR_ALIGNED_BYTES(wr_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (rd_idx == wr_idx) {
+		/* Buffer is empty. */
+		return 0;
+	}
+
+	/* Get packet len.*/
+	sys_cache_data_invd_range(&data_loc[rd_idx], PBUF_PACKET_LEN_SZ);
+	uint16_t plen = sys_get_be16(&data_loc[rd_idx]);
+
+	if (idx_occupied(blen, wr_idx, rd_idx) < plen + PBUF_PACKET_LEN_SZ) {
+		/* This should never happen. */
+		return -EAGAIN;
+	}
+
+	rd_idx = idx_wrap(blen, rd_idx + PBUF_PACKET_LEN_SZ);
+
+	if (plen > blen - rd_idx) {
+		/* Packet data are wrapped, they can only be copied by pbuf_read. */
+		return -ENOTSUP;
+	}
+
+	sys_cache_data_invd_range(&data_loc[rd_idx], plen);
+	*buf = (char *)&data_loc[rd_idx];
+
+	return (int)plen;
+}
+
+int pbuf_free(struct pbuf *pb, uint16_t len)
+{
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = idx_wrap(blen, pb->data.rd_idx + PBUF_PACKET_LEN_SZ);
+
+	/* Update rd_idx. */
+	rd_idx = idx_wrap(blen, ROUND_UP(rd_idx + len, _PBUF_IDX_SIZE));
+
+	pb->data.rd_idx = rd_idx;
+	*(pb->cfg->rd_idx_loc) = rd_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->rd_idx_loc, sizeof(*(pb->cfg->rd_idx_loc)));
+
+	return 0;
+}
+
+int pbuf_alloc(struct pbuf *pb, uint16_t len, char **buf)
+{
+	if (pb == NULL || buf == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* Invalidate rd_idx only, local wr_idx is used to increase buffer security. */
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = *(pb->cfg->rd_idx_loc);
+	uint32_t wr_idx = pb->data.wr_idx;
+
+	/* rd_idx shall always be aligned, but its value is received from the reader.
+	 * Can not assert.
+	 */
+	if (!IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	uint32_t free_space = blen - idx_occupied(blen, wr_idx, rd_idx) - _PBUF_IDX_SIZE;
+
+	if (free_space <= PBUF_PACKET_LEN_SZ) {
+		return -ENOMEM;
+	}
+
+	uint32_t max_len = MIN(free_space - PBUF_PACKET_LEN_SZ, UINT16_MAX);
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+	uint32_t tail_len = max_len;
+	uint32_t front_len = 0;
+
+	if (wr_idx >= rd_idx && data_idx != 0) {
+		/* Free space is split by the end of the buffer. The packet is
+		 * either written after its length, or at the buffer front, in
+		 * front of the packets not read yet.
+		 */
+		tail_len = MIN(max_len, blen - data_idx);
+		front_len = MIN(max_len, rd_idx);
+	}
+
+	bool front = (len == 0) ? (front_len > tail_len) : (len > tail_len);
+	uint32_t avail = front ? front_len : tail_len;
+
+	if (avail == 0 || len > avail) {
+		return -ENOMEM;
+	}
+
+	*buf = (char *)&data_loc[front ? 0 : data_idx];
+
+	return (int)avail;
+}
+
+int pbuf_commit(struct pbuf *pb, const char *buf, uint16_t len)
+{
+	if (pb == NULL || buf == NULL || len == 0) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	uint8_t *const data_loc = pb->cfg->data_loc;
+	const uint32_t blen = pb->cfg->len;
+	uint32_t rd_idx = *(pb->cfg->rd_idx_loc);
+	uint32_t wr_idx = pb->data.wr_idx;
+	uint32_t data_idx = idx_wrap(blen, wr_idx + PBUF_PACKET_LEN_SZ);
+
+	if (!IS_PTR_ALIGNED_BYTES(rd_idx, _PBUF_IDX_SIZE)) {
+		return -EINVAL;
+	}
+
+	if (blen - idx_occupied(blen, wr_idx, rd_idx) - _PBUF_IDX_SIZE <
+	    len + PBUF_PACKET_LEN_SZ) {
+		return -ENOMEM;
+	}
+
+	uint32_t tail = MIN(len, blen - data_idx);
+
+	if ((const uint8_t *)buf != &data_loc[data_idx]) {
+		if ((const uint8_t *)buf != data_loc) {
+			return -EINVAL;
+		}
+
+		/* Packet was written at the buffer front, move it into place. */
+		memcpy(&data_loc[data_idx], data_loc, tail);
+		memmove(data_loc, &data_loc[tail], len - tail);
+	}
+
+	/* Same as pbuf_write(), the shared wr_idx value is updated at the very end. */
+	*((uint32_t *)(&data_loc[wr_idx])) = 0;
+	sys_put_be16(len, &data_loc[wr_idx]);
+	__sync_synchronize();
+	sys_cache_data_flush_range(&data_loc[wr_idx], PBUF_PACKET_LEN_SZ);
+
+	sys_cache_data_flush_range(&data_loc[data_idx], tail);
+	if (len > tail) {
+		sys_cache_data_flush_range(&data_loc[0], len - tail);
+	}
+
+	wr_idx = idx_wrap(blen, ROUND_UP(data_idx + len, _PBUF_IDX_SIZE));
+	/* Update wr_idx. */
+	pb->data.wr_idx = wr_idx;
+	*(pb->cfg->wr_idx_loc) = wr_idx;
+	__sync_synchronize();
+	sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc, sizeof(*(pb->cfg->wr_idx_loc)));
+
+	return len;
+}
@@ -263,7 +263,42 @@ static void llext_link_plt(struct llext_loader *ldr, struct llext *ext, elf_shdr
 	}
 }
 
-int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_load_param *ldr_parm)
+/*
+ * Resolve an undefined symbol. The addresses already resolved are cached by
+ * symbol table index, as the same symbols are usually referenced by many
+ * relocations.
+ */
+static uintptr_t llext_resolve_undef(struct llext *ext, const char *name, const elf_sym_t *sym,
+				     unsigned int sym_idx, uintptr_t *sym_cache, size_t sym_cnt)
+{
+	uintptr_t link_addr;
+
+	if (sym_cache && sym_idx < sym_cnt && sym_cache[sym_idx]) {
+		return sym_cache[sym_idx];
+	}
+
+	link_addr = (uintptr_t)llext_find_sym(NULL, SYM_NAME_OR_SLID(name, sym->st_value));
+
+	if (link_addr == 0) {
+		/* Try loaded tables */
+		struct llext *dep;
+
+		link_addr = (uintptr_t)llext_find_extension_sym(name, &dep);
+		if (link_addr) {
+			llext_dependency_add(ext, dep);
+		}
+	}
+
+	if (link_addr && sym_cache && sym_idx < sym_cnt) {
+		sym_cache[sym_idx] = link_addr;
+	}
+
+	return link_addr;
+}
+
+static int llext_link_sections(struct llext_loader *ldr, struct llext *ext,
+			       const struct llext_load_param *ldr_parm,
+			       uintptr_t *sym_cache, size_t sym_cnt)
 {
 	uintptr_t sect_base = 0;
 	elf_rela_t rel;
@@ -388,18 +423,9 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 				link_addr = 0;
 			} else if (sym.st_shndx == SHN_UNDEF) {
 				/* If symbol is undefined, then we need to look it up */
-				link_addr = (uintptr_t)llext_find_sym(NULL,
-					SYM_NAME_OR_SLID(name, sym.st_value));
-
-				if (link_addr == 0) {
-					/* Try loaded tables */
-					struct llext *dep;
-
-					link_addr = (uintptr_t)llext_find_extension_sym(name, &dep);
-					if (link_addr) {
-						llext_dependency_add(ext, dep);
-					}
-				}
+				link_addr = llext_resolve_undef(ext, name, &sym,
+								ELF_R_SYM(rel.r_info),
+								sym_cache, sym_cnt);
 
 				if (link_addr == 0) {
 					LOG_ERR("Undefined symbol with no entry in "
@@ -469,3 +495,24 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 
 	return 0;
 }
+
+int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_load_param *ldr_parm)
+{
+	size_t sym_cnt = ldr->sects[LLEXT_MEM_SYMTAB].sh_size / sizeof(elf_sym_t);
+	uintptr_t *sym_cache;
+	int ret;
+
+	/* The cache only speeds up linking, go without it if the heap is short */
+	sym_cache = llext_alloc(sym_cnt * sizeof(uintptr_t));
+	if (sym_cache) {
+		memset(sym_cache, 0, sym_cnt * sizeof(uintptr_t));
+	} else {
+		LOG_DBG("No memory for the symbol cache, %zu symbols", sym_cnt);
+	}
+
+	ret = llext_link_sections(ldr, ext, ldr_parm, sym_cache, sym_cnt);
+
+	llext_free(sym_cache);
+
+	return ret;
+}
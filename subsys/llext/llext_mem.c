@@ -58,6 +58,49 @@ static void llext_init_mem_part(struct llext *ext, enum llext_mem mem_idx,
 	LOG_DBG("region %d: start 0x%zx, size %zd", mem_idx, (size_t)start, len);
 }
 
+#ifdef CONFIG_LLEXT_STORAGE_XIP
+/*
+ * Check whether a region can be used in place from the storage: it must
+ * not be writable nor modified by relocations.
+ */
+static bool llext_region_in_place(struct llext_loader *ldr, enum llext_mem mem_idx)
+{
+	switch (mem_idx) {
+	case LLEXT_MEM_SYMTAB:
+	case LLEXT_MEM_STRTAB:
+	case LLEXT_MEM_SHSTRTAB:
+		return true;
+	case LLEXT_MEM_DATA:
+	case LLEXT_MEM_BSS:
+		return false;
+	default:
+		break;
+	}
+
+	for (unsigned int i = 0; i < ldr->sect_cnt; i++) {
+		const elf_shdr_t *shdr = ldr->sect_hdrs + i;
+
+		if (shdr->sh_type != SHT_REL && shdr->sh_type != SHT_RELA) {
+			continue;
+		}
+
+		/* Relocations without a known target may apply anywhere */
+		if (shdr->sh_info >= ldr->sect_cnt ||
+		    ldr->sect_map[shdr->sh_info].mem_idx == LLEXT_MEM_COUNT ||
+		    ldr->sect_map[shdr->sh_info].mem_idx == mem_idx) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#else
+static inline bool llext_region_in_place(struct llext_loader *ldr, enum llext_mem mem_idx)
+{
+	return false;
+}
+#endif
+
 static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx)
 {
@@ -69,7 +112,7 @@ static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 	ext->mem_size[mem_idx] = ldr->sects[mem_idx].sh_size;
 
 	if (ldr->sects[mem_idx].sh_type != SHT_NOBITS &&
-	    IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE)) {
+	    (IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE) || llext_region_in_place(ldr, mem_idx))) {
 		/* Directly use data from the ELF buffer if peek() is supported */
 		ext->mem[mem_idx] = llext_peek(ldr, ldr->sects[mem_idx].sh_offset);
 		if (ext->mem[mem_idx]) {
@@ -172,6 +215,10 @@ void llext_adjust_mmu_permissions(struct llext *ext)
 		if (size == 0) {
 			continue;
 		}
+		if (IS_ENABLED(CONFIG_LLEXT_STORAGE_XIP) && !ext->mem_on_heap[mem_idx]) {
+			/* used in place from the storage */
+			continue;
+		}
 		switch (mem_idx) {
 		case LLEXT_MEM_TEXT:
 			sys_cache_instr_invd_range(addr, size);
@@ -197,7 +244,8 @@ void llext_free_regions(struct llext *ext)
 {
 	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
 #ifdef CONFIG_MMU
-		if (ext->mem_size[i] != 0) {
+		if (ext->mem_size[i] != 0 &&
+		    (ext->mem_on_heap[i] || !IS_ENABLED(CONFIG_LLEXT_STORAGE_XIP))) {
 			/* restore default RAM permissions */
 			k_mem_update_flags(ext->mem[i],
 					   ROUND_UP(ext->mem_size[i], LLEXT_PAGE_SIZE),
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
@@ -19,11 +20,24 @@
 #include <zephyr/pm/device_runtime.h>
 LOG_MODULE_REGISTER(log_uart);
 
+/* Double buffer in which messages are batched while the other half is sent. */
+struct lbu_batch {
+	struct k_spinlock lock;
+	uint8_t *buf[2];
+	size_t len[2];
+	/* Index of the half being filled. */
+	uint8_t fill;
+	bool tx_busy;
+};
+
 struct lbu_data {
 	struct k_sem sem;
 	uint32_t log_format_current;
 	volatile bool in_panic;
 	bool use_async;
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+	struct lbu_batch batch;
+#endif
 };
 
 struct lbu_cb_ctx {
@@ -43,6 +57,105 @@ struct lbu_cb_ctx {
  */
 static const char LOG_HEX_SEP[10] = "##ZLOGV1##";
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+/* Send the half being filled and switch to the other one. Called with the lock held. */
+static void batch_tx_start(const struct device *uart_dev, struct lbu_batch *batch)
+{
+	uint8_t idx = batch->fill;
+	int err;
+
+	batch->fill ^= 1U;
+	batch->tx_busy = true;
+
+	err = uart_tx(uart_dev, batch->buf[idx], batch->len[idx], SYS_FOREVER_US);
+	if (err != 0) {
+		/* Data cannot be sent, drop it. */
+		batch->len[idx] = 0;
+		batch->tx_busy = false;
+	}
+}
+
+static void batch_tx_done(const struct device *uart_dev, struct lbu_data *data)
+{
+	struct lbu_batch *batch = &data->batch;
+	k_spinlock_key_t key = k_spin_lock(&batch->lock);
+
+	batch->len[batch->fill ^ 1U] = 0;
+	batch->tx_busy = false;
+
+	/* Messages formatted during the transfer go out at once. */
+	if (batch->len[batch->fill] > 0) {
+		batch_tx_start(uart_dev, batch);
+	}
+
+	if (!batch->tx_busy) {
+		/* Release the device taken by the first transfer of the chain. */
+		(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+	}
+
+	k_spin_unlock(&batch->lock, key);
+
+	k_sem_give(&data->sem);
+}
+
+/* Copy data to the double buffer and start sending it unless a transfer is ongoing.
+ * Only waits when both halves are full.
+ *
+ * @return true if a transfer chain was started, which keeps the device active.
+ */
+static bool batch_out(const struct device *uart_dev, struct lbu_data *data,
+		      const uint8_t *buf, size_t length)
+{
+	struct lbu_batch *batch = &data->batch;
+	bool started = false;
+
+	while (length > 0) {
+		k_spinlock_key_t key = k_spin_lock(&batch->lock);
+		size_t len = MIN(length, CONFIG_LOG_BACKEND_UART_ASYNC_BATCH_SIZE -
+					 batch->len[batch->fill]);
+
+		if (len == 0) {
+			k_spin_unlock(&batch->lock, key);
+			(void)k_sem_take(&data->sem, K_FOREVER);
+			continue;
+		}
+
+		memcpy(&batch->buf[batch->fill][batch->len[batch->fill]], buf, len);
+		batch->len[batch->fill] += len;
+		buf += len;
+		length -= len;
+
+		if (!batch->tx_busy) {
+			batch_tx_start(uart_dev, batch);
+			started = started || batch->tx_busy;
+		}
+
+		k_spin_unlock(&batch->lock, key);
+	}
+
+	return started;
+}
+
+/* Send what the double buffer holds, in polling mode. */
+static void batch_panic(const struct device *uart_dev, struct lbu_data *data)
+{
+	struct lbu_batch *batch = &data->batch;
+	k_spinlock_key_t key = k_spin_lock(&batch->lock);
+
+	/* The ongoing transfer may never complete, as interrupts may be locked. */
+	if (batch->tx_busy) {
+		(void)uart_tx_abort(uart_dev);
+	}
+
+	for (size_t i = 0; i < batch->len[batch->fill]; i++) {
+		uart_poll_out(uart_dev, batch->buf[batch->fill][i]);
+	}
+	batch->len[batch->fill] = 0;
+
+	k_spin_unlock(&batch->lock, key);
+}
+#endif /* CONFIG_LOG_BACKEND_UART_ASYNC_BATCH */
+
 static void uart_callback(const struct device *dev,
 			  struct uart_event *evt,
 			  void *user_data)
@@ -54,6 +167,13 @@ static void uart_callback(const struct device *dev,
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+		if (!data->in_panic) {
+			batch_tx_done(dev, data);
+			break;
+		}
+#endif
 		k_sem_give(&data->sem);
 		break;
 	default:
@@ -106,6 +226,14 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 		goto cleanup;
 	}
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+	if (batch_out(uart_dev, lb_data, data, length)) {
+		/* The device is released when the transfers complete. */
+		return length;
+	}
+	goto cleanup;
+#endif
+
 	err = uart_tx(uart_dev, data, length, SYS_FOREVER_US);
 	__ASSERT_NO_MSG(err == 0);
 
@@ -203,6 +331,11 @@ static void panic(struct log_backend const *const backend)
 #endif /* CONFIG_PM_DEVICE */
 
 	data->in_panic = true;
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+	if (data->use_async) {
+		batch_panic(uart_dev, data);
+	}
+#endif
 	log_backend_std_panic(ctx->output);
 }
 
@@ -225,13 +358,25 @@ const struct log_backend_api log_backend_uart_api = {
 	.format_set = format_set,
 };
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+#define LBU_BATCH_DEFINE(...)                                                                      \
+	static uint8_t lbu_batch_buf##__VA_ARGS__[2][CONFIG_LOG_BACKEND_UART_ASYNC_BATCH_SIZE];
+#define LBU_BATCH_INIT(...)                                                                        \
+	.batch = {.buf = {lbu_batch_buf##__VA_ARGS__[0], lbu_batch_buf##__VA_ARGS__[1]}},
+#else
+#define LBU_BATCH_DEFINE(...)
+#define LBU_BATCH_INIT(...)
+#endif
+
 #define LBU_DEFINE(node_id, ...)                                                                   \
 	static uint8_t lbu_buffer##__VA_ARGS__[CONFIG_LOG_BACKEND_UART_BUFFER_SIZE];               \
+	LBU_BATCH_DEFINE(__VA_ARGS__)                                                              \
 	LOG_OUTPUT_DEFINE(lbu_output##__VA_ARGS__, char_out, lbu_buffer##__VA_ARGS__,              \
 			  CONFIG_LOG_BACKEND_UART_BUFFER_SIZE);                                    \
                                                                                                    \
 	static struct lbu_data lbu_data##__VA_ARGS__ = {                                           \
 		.log_format_current = CONFIG_LOG_BACKEND_UART_OUTPUT_DEFAULT,                      \
+		LBU_BATCH_INIT(__VA_ARGS__)                                                        \
 	};                                                                                         \
                                                                                                    \
 	static const struct lbu_cb_ctx lbu_cb_ctx##__VA_ARGS__ = {                                 \
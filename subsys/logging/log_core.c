@@ -53,6 +53,12 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_BUFFER_SIZE 4
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+#define LOG_BUFFER_CNT CONFIG_MP_MAX_NUM_CPUS
+#else
+#define LOG_BUFFER_CNT 1
+#endif
+
 #ifdef CONFIG_LOG_PROCESS_THREAD_CUSTOM_PRIORITY
 #define LOG_PROCESS_THREAD_PRIORITY CONFIG_LOG_PROCESS_THREAD_PRIORITY
 #else
@@ -116,20 +122,23 @@ static atomic_t unordered_cnt;
 static uint64_t last_failure_report;
 static struct k_spinlock process_lock;
 
-static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_msg_ptr);
-static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer);
+/* One local buffer, or one for each CPU. Like the buffers of the links,
+ * they are merged by timestamp when messages are claimed.
+ */
+static STRUCT_SECTION_ITERABLE_ARRAY(log_msg_ptr, log_msg_ptr, LOG_BUFFER_CNT);
+static STRUCT_SECTION_ITERABLE_ARRAY_ALTERNATE(log_mpsc_pbuf, mpsc_pbuf_buffer, log_buffer,
+					       LOG_BUFFER_CNT);
 static struct mpsc_pbuf_buffer *curr_log_buffer;
 
 #ifdef CONFIG_MPSC_PBUF
 static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
-	buf32[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+	buf32[LOG_BUFFER_CNT][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
 
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
-	.buf = (uint32_t *)buf32,
-	.size = ARRAY_SIZE(buf32),
+	.size = ARRAY_SIZE(buf32[0]),
 	.notify_drop = z_log_notify_drop,
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
@@ -633,11 +642,83 @@ bool z_log_dropped_pending(void)
 	return dropped_cnt > 0;
 }
 
+#ifdef CONFIG_LOG_RATE_LIMIT
+bool z_log_rate_limit_take(struct log_rate_limit *rl, uint8_t domain_id,
+			   const void *source, uint8_t level)
+{
+	uint32_t now = (uint32_t)k_uptime_ticks();
+	uint32_t last = (uint32_t)atomic_get(&rl->last);
+	uint32_t refill = (uint32_t)(((uint64_t)(now - last) * CONFIG_LOG_RATE_LIMIT_RATE) /
+				     CONFIG_SYS_CLOCK_TICKS_PER_SEC);
+	atomic_val_t taken;
+	atomic_val_t suppressed;
+
+	if (refill > 0U) {
+		/* Keep the time left over from the refill for the next one. */
+		uint32_t next = (refill >= CONFIG_LOG_RATE_LIMIT_BURST) ? now :
+			last + (uint32_t)(((uint64_t)refill * CONFIG_SYS_CLOCK_TICKS_PER_SEC) /
+					  CONFIG_LOG_RATE_LIMIT_RATE);
+
+		/* Only one of concurrent callers refills the bucket. */
+		if (atomic_cas(&rl->last, (atomic_val_t)last, (atomic_val_t)next)) {
+			do {
+				taken = atomic_get(&rl->taken);
+			} while (!atomic_cas(&rl->taken, taken,
+					     (taken > (atomic_val_t)refill) ?
+					     (taken - (atomic_val_t)refill) : 0));
+		}
+	}
+
+	do {
+		taken = atomic_get(&rl->taken);
+		if (taken >= CONFIG_LOG_RATE_LIMIT_BURST) {
+			atomic_inc(&rl->suppressed);
+			return false;
+		}
+	} while (!atomic_cas(&rl->taken, taken, taken + 1));
+
+	suppressed = atomic_clear(&rl->suppressed);
+	if (suppressed > 0) {
+		z_log_msg_runtime_create(domain_id, source, level, NULL, 0, 0,
+					 "%u messages suppressed", (uint32_t)suppressed);
+	}
+
+	return true;
+}
+#endif /* CONFIG_LOG_RATE_LIMIT */
+
 void z_log_msg_init(void)
 {
 #ifdef CONFIG_MPSC_PBUF
-	mpsc_pbuf_init(&log_buffer, &mpsc_config);
-	curr_log_buffer = &log_buffer;
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+		config.buf = buf32[i];
+		mpsc_pbuf_init(&log_buffer[i], &config);
+	}
+	curr_log_buffer = &log_buffer[0];
+#endif
+}
+
+/* Buffer of the CPU the caller runs on. The caller may have migrated by the
+ * time the message is allocated, which only costs some contention in that case.
+ */
+static struct mpsc_pbuf_buffer *local_buffer(void)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return &log_buffer[arch_curr_cpu()->id];
+#else
+	return &log_buffer[0];
+#endif
+}
+
+/* Buffer a message allocated with z_log_msg_alloc() belongs to. */
+static struct mpsc_pbuf_buffer *msg_buffer(const struct log_msg *msg)
+{
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return &log_buffer[((uintptr_t)msg - (uintptr_t)buf32) / sizeof(buf32[0])];
+#else
+	return &log_buffer[0];
 #endif
 }
 
@@ -656,7 +737,7 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
-	return msg_alloc(&log_buffer, wlen);
+	return msg_alloc(local_buffer(), wlen);
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -688,13 +769,13 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(msg_buffer(msg), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
 {
 #ifdef CONFIG_MPSC_PBUF
-	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer);
+	return (union log_msg_generic *)mpsc_pbuf_claim(&log_buffer[0]);
 #else
 	return NULL;
 #endif
@@ -775,7 +856,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) &&
+	    len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -810,8 +892,9 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
-		return msg_pending(&log_buffer);
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && !IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) ||
+	    (len == 1)) {
+		return msg_pending(&log_buffer[0]);
 	}
 
 	STRUCT_SECTION_FOREACH(log_msg_ptr, msg_ptr) {
@@ -837,7 +920,7 @@ void z_log_msg_enqueue(const struct log_link *link, const void *data, size_t len
 {
 	struct log_msg *log_msg = (struct log_msg *)data;
 	size_t wlen = DIV_ROUND_UP(ROUND_UP(len, Z_LOG_MSG_ALIGNMENT), sizeof(int));
-	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf : &log_buffer;
+	struct mpsc_pbuf_buffer *mpsc_pbuffer = link->mpsc_pbuf ? link->mpsc_pbuf : local_buffer();
 	struct log_msg *local_msg = msg_alloc(mpsc_pbuffer, wlen);
 
 	if (!local_msg) {
@@ -890,7 +973,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 		return -EINVAL;
 	}
 
-	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
+	*buf_size = 0;
+	*usage = 0;
+
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t size;
+		uint32_t now;
+
+		mpsc_pbuf_get_utilization(&log_buffer[i], &size, &now);
+		*buf_size += size;
+		*usage += now;
+	}
 
 	return 0;
 }
@@ -903,7 +996,20 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
-	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+	*max = 0;
+
+	/* With a buffer per CPU, the sum of their maximum utilizations. */
+	for (int i = 0; i < LOG_BUFFER_CNT; i++) {
+		uint32_t buf_max;
+		int err = mpsc_pbuf_get_max_utilization(&log_buffer[i], &buf_max);
+
+		if (err < 0) {
+			return err;
+		}
+		*max += buf_max;
+	}
+
+	return 0;
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
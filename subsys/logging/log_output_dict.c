@@ -5,16 +5,135 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/cbprintf.h>
 #include <zephyr/sys/util.h>
 
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+/* Maximum length of a 64 bit varint. */
+#define VARINT_MAX_LEN 10
+
+/* Buffer for the encoded header or a part of the encoded package. */
+#define COMPACT_BUF_LEN 48
+
+BUILD_ASSERT(COMPACT_BUF_LEN >= 2 + 4 * VARINT_MAX_LEN);
+
+static size_t varint_put(uint8_t *buf, uint64_t val)
+{
+	size_t len = 0;
+
+	do {
+		buf[len] = val & 0x7f;
+		val >>= 7;
+		if (val != 0U) {
+			buf[len] |= 0x80;
+		}
+		len++;
+	} while (val != 0U);
+
+	return len;
+}
+
+static size_t svarint_put(uint8_t *buf, int64_t val)
+{
+	return varint_put(buf, ((uint64_t)val << 1) ^ (uint64_t)(val >> 63));
+}
+
+static void compact_package_process(const struct log_output *output, const uint8_t *package,
+				    size_t len)
+{
+	struct log_output_control_block *cb = output->control_block;
+	const struct cbprintf_package_desc *desc = (const struct cbprintf_package_desc *)package;
+	/* Format string pointer follows the header, then the arguments. */
+	size_t fmt_offset = sizeof(union cbprintf_package_hdr);
+	size_t args_end = MIN(desc->len * sizeof(uint32_t), len);
+	uint8_t buf[COMPACT_BUF_LEN];
+	size_t buf_len = 0;
+	size_t offset = 4;
+
+	/* Descriptor fields are bytes. */
+	memcpy(buf, package, 4);
+	buf_len = 4;
+
+	while (offset + sizeof(uint32_t) <= args_end) {
+		if (buf_len > sizeof(buf) - VARINT_MAX_LEN) {
+			log_output_write(output->func, buf, buf_len, cb->ctx);
+			buf_len = 0;
+		}
+
+		if (offset == fmt_offset && offset + sizeof(uintptr_t) <= args_end) {
+			uintptr_t fmt;
+
+			memcpy(&fmt, &package[offset], sizeof(fmt));
+			buf_len += svarint_put(&buf[buf_len], (intptr_t)(fmt - cb->dict_fmt));
+			cb->dict_fmt = fmt;
+			offset += sizeof(fmt);
+		} else {
+			uint32_t word;
+
+			memcpy(&word, &package[offset], sizeof(word));
+			buf_len += varint_put(&buf[buf_len], word);
+			offset += sizeof(word);
+		}
+	}
+
+	log_output_write(output->func, buf, buf_len, cb->ctx);
+
+	/* String indexes and appended strings. */
+	if (len > offset) {
+		log_output_write(output->func, (uint8_t *)&package[offset], len - offset, cb->ctx);
+	}
+}
+
+static void compact_msg_process(const struct log_output *output, struct log_msg *msg)
+{
+	struct log_output_control_block *cb = output->control_block;
+	void *source = (void *)log_msg_get_source(msg);
+	log_timestamp_t delta = msg->hdr.timestamp - cb->dict_timestamp;
+	uint8_t hdr[COMPACT_BUF_LEN];
+	size_t hdr_len = 0;
+	size_t len;
+	uint8_t *data;
+
+	hdr[hdr_len++] = MSG_NORMAL_COMPACT;
+	hdr[hdr_len++] = msg->hdr.desc.domain | (msg->hdr.desc.level << 4);
+	hdr_len += varint_put(&hdr[hdr_len], (source != NULL) ? log_source_id(source) : 0U);
+	/* Timestamps may go back, with messages from several domains. */
+	hdr_len += svarint_put(&hdr[hdr_len], IS_ENABLED(CONFIG_LOG_TIMESTAMP_64BIT) ?
+						(int64_t)delta : (int64_t)(int32_t)delta);
+	hdr_len += varint_put(&hdr[hdr_len], msg->hdr.desc.package_len);
+	hdr_len += varint_put(&hdr[hdr_len], msg->hdr.desc.data_len);
+	cb->dict_timestamp = msg->hdr.timestamp;
+
+	log_output_write(output->func, hdr, hdr_len, cb->ctx);
+
+	data = log_msg_get_package(msg, &len);
+	if (len > 0U) {
+		compact_package_process(output, data, len);
+	}
+
+	data = log_msg_get_data(msg, &len);
+	if (len > 0U) {
+		log_output_write(output->func, data, len, cb->ctx);
+	}
+
+	log_output_flush(output);
+}
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT */
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	compact_msg_process(output, msg);
+	return;
+#endif
+
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
 
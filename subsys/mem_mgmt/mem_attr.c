@@ -13,6 +13,7 @@
 		.dt_addr = DT_REG_ADDR(node_id),			\
 		.dt_size = DT_REG_SIZE(node_id),			\
 		.dt_attr = DT_PROP(node_id, zephyr_memory_attr),	\
+		.dt_cpus = DT_MEMORY_ATTR_CPUS(node_id),		\
 	},
 
 static const struct mem_attr_region_t mem_attr_region[] = {
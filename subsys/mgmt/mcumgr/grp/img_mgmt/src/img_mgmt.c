@@ -387,6 +387,122 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+struct img_mgmt_window_chunk {
+	size_t off;
+	/* 0 if the chunk is free */
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_window_chunk img_mgmt_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW];
+
+static void img_mgmt_assert_lock_held(void)
+{
+#ifdef CONFIG_MCUMGR_GRP_IMG_MUTEX
+	__ASSERT_NO_MSG(img_mgmt_mutex.owner == k_current_get());
+#endif
+}
+
+static void img_mgmt_window_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		img_mgmt_window[i].len = 0;
+	}
+}
+
+/**
+ * Keeps a chunk received ahead of the expected offset, to be written once the missing data
+ * has arrived. The caller must hold the lock taken by img_mgmt_take_lock().
+ *
+ * @return true if the chunk is kept; false if it is dropped.
+ */
+static bool img_mgmt_window_stash_locked(const struct img_mgmt_upload_req *req)
+{
+	struct img_mgmt_window_chunk *chunk = NULL;
+
+	img_mgmt_assert_lock_held();
+
+	if (g_img_mgmt_state.area_id == -1 || req->off <= g_img_mgmt_state.off ||
+	    req->img_data.len == 0 || req->img_data.len > sizeof(chunk->data) ||
+	    req->off + req->img_data.len > g_img_mgmt_state.size ||
+	    req->off - g_img_mgmt_state.off >
+	    ARRAY_SIZE(img_mgmt_window) * sizeof(chunk->data)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+		if (img_mgmt_window[i].len == 0) {
+			if (chunk == NULL) {
+				chunk = &img_mgmt_window[i];
+			}
+		} else if (img_mgmt_window[i].off == req->off) {
+			/* Retransmission of a kept chunk */
+			return true;
+		}
+	}
+
+	if (chunk == NULL) {
+		return false;
+	}
+
+	chunk->off = req->off;
+	chunk->len = req->img_data.len;
+	memcpy(chunk->data, req->img_data.value, req->img_data.len);
+
+	return true;
+}
+
+/**
+ * Writes the kept chunks that continue the data written so far. The caller must hold the
+ * lock taken by img_mgmt_take_lock().
+ *
+ * @param last	Set if the last chunk of the image has been written.
+ *
+ * @return 0 on success; nonzero on failure.
+ */
+static int img_mgmt_window_drain_locked(bool *last)
+{
+	bool written = true;
+	size_t len;
+	int rc;
+
+	img_mgmt_assert_lock_held();
+
+	while (written && !*last) {
+		written = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(img_mgmt_window); i++) {
+			struct img_mgmt_window_chunk *chunk = &img_mgmt_window[i];
+
+			if (chunk->len == 0 || chunk->off > g_img_mgmt_state.off) {
+				continue;
+			}
+
+			if (chunk->off < g_img_mgmt_state.off) {
+				/* Overlaps data already written, the client resends it */
+				chunk->len = 0;
+				continue;
+			}
+
+			len = chunk->len;
+			chunk->len = 0;
+
+			*last = (chunk->off + len == g_img_mgmt_state.size);
+			rc = img_mgmt_write_image_data(chunk->off, chunk->data, len, *last);
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += len;
+			written = true;
+		}
+	}
+
+	return 0;
+}
+#endif
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -399,6 +515,9 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+	img_mgmt_window_reset();
+#endif
 	img_mgmt_release_lock();
 }
 
@@ -794,6 +913,11 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	}
 
 	if (!action.proceed) {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		/* Data ahead of the expected offset is kept for later */
+		(void)img_mgmt_window_stash_locked(&req);
+#endif
+
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
@@ -838,6 +962,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 #endif
 
 		g_img_mgmt_state.off = 0;
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+		img_mgmt_window_reset();
+#endif
 
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
@@ -915,7 +1042,12 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+#if CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW > 0
+			rc = img_mgmt_window_drain_locked(&last);
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
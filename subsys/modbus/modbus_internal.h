@@ -79,14 +79,32 @@ struct modbus_serial_config {
 	struct gpio_dt_spec *de;
 	/* Pointer to receiver enable (nRE) pin config */
 	struct gpio_dt_spec *re;
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	/* Protects the asynchronous receiver state */
+	struct k_spinlock rx_lock;
+	/* Asynchronous receiver state, see enum modbus_serial_rx_state */
+	uint8_t rx_state;
+	/* Restart the receiver when it is disabled */
+	bool rx_restart;
+#else
 	/* RTU timer to detect frame end point */
 	struct k_timer rtu_timer;
+#endif
 	/* Number of bytes received or to send */
 	uint16_t uart_buf_ctr;
 	/* Storage of received characters or characters to send */
 	uint8_t uart_buf[CONFIG_MODBUS_BUFFER_SIZE];
 };
 
+enum modbus_serial_rx_state {
+	/* Receiver disabled */
+	MODBUS_SERIAL_RX_IDLE,
+	/* Receiving into uart_buf */
+	MODBUS_SERIAL_RX_ON,
+	/* Disabling, waiting for UART_RX_DISABLED */
+	MODBUS_SERIAL_RX_STOPPING,
+};
+
 #define MODBUS_STATE_CONFIGURED		0
 
 struct modbus_context {
@@ -29,6 +29,115 @@ LOG_MODULE_REGISTER(modbus_serial, CONFIG_MODBUS_LOG_LEVEL);
 #include <zephyr/sys/crc.h>
 #include <modbus_internal.h>
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void modbus_serial_tx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
+	}
+}
+
+static void async_rx_start(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	cfg->uart_buf_ctr = 0;
+	cfg->uart_buf_ptr = &cfg->uart_buf[0];
+
+	/*
+	 * The receiver timeout is the RTU inter-frame delay, the driver
+	 * reports a complete RTU frame at once, without an interrupt per
+	 * character.
+	 */
+	err = uart_rx_enable(cfg->dev, cfg->uart_buf, CONFIG_MODBUS_BUFFER_SIZE,
+			     cfg->rtu_timeout);
+	if (err != 0) {
+		K_SPINLOCK(&cfg->rx_lock) {
+			cfg->rx_state = MODBUS_SERIAL_RX_IDLE;
+		}
+
+		LOG_ERR("Failed to enable receiver (%d)", err);
+	}
+}
+
+static void modbus_serial_rx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	bool start = false;
+
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 1);
+	}
+
+	K_SPINLOCK(&cfg->rx_lock) {
+		switch (cfg->rx_state) {
+		case MODBUS_SERIAL_RX_IDLE:
+			cfg->rx_state = MODBUS_SERIAL_RX_ON;
+			start = true;
+			break;
+		case MODBUS_SERIAL_RX_STOPPING:
+			/* Restarted on UART_RX_DISABLED */
+			cfg->rx_restart = true;
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (start) {
+		async_rx_start(ctx);
+	}
+}
+
+static void modbus_serial_rx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	bool stop = false;
+
+	K_SPINLOCK(&cfg->rx_lock) {
+		cfg->rx_restart = false;
+		if (cfg->rx_state == MODBUS_SERIAL_RX_ON) {
+			cfg->rx_state = MODBUS_SERIAL_RX_STOPPING;
+			stop = true;
+		}
+	}
+
+	/* Not under the lock, drivers may report UART_RX_DISABLED from here */
+	if (stop && uart_rx_disable(cfg->dev) != 0) {
+		/* Receiver already stopped on its own */
+		K_SPINLOCK(&cfg->rx_lock) {
+			if (cfg->rx_state == MODBUS_SERIAL_RX_STOPPING) {
+				cfg->rx_state = MODBUS_SERIAL_RX_IDLE;
+			}
+		}
+	}
+
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
+	}
+}
+
+static void modbus_serial_tx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 1);
+	}
+
+	err = uart_tx(cfg->dev, cfg->uart_buf, cfg->uart_buf_ctr, SYS_FOREVER_US);
+	if (err != 0) {
+		LOG_ERR("Failed to start transmission (%d)", err);
+		cfg->uart_buf_ctr = 0;
+		modbus_serial_tx_off(ctx);
+		modbus_serial_rx_on(ctx);
+	}
+}
+#else
 static void modbus_serial_tx_on(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
@@ -70,6 +179,7 @@ static void modbus_serial_rx_off(struct modbus_context *ctx)
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
 	}
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 #ifdef CONFIG_MODBUS_ASCII_MODE
 /* The function calculates an 8-bit Longitudinal Redundancy Check. */
@@ -304,6 +414,93 @@ static void rtu_tx_adu(struct modbus_context *ctx)
 	modbus_serial_tx_on(ctx);
 }
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void async_rx_disabled(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	bool restart = false;
+
+	K_SPINLOCK(&cfg->rx_lock) {
+		if (cfg->rx_restart) {
+			cfg->rx_restart = false;
+			cfg->rx_state = MODBUS_SERIAL_RX_ON;
+			restart = true;
+		} else {
+			cfg->rx_state = MODBUS_SERIAL_RX_IDLE;
+		}
+	}
+
+	if (restart) {
+		async_rx_start(ctx);
+	}
+}
+
+static void uart_async_cb_handler(const struct device *dev, struct uart_event *evt,
+				  void *user_data)
+{
+	struct modbus_context *ctx = user_data;
+	struct modbus_serial_config *cfg;
+	uint16_t end;
+
+	if (ctx == NULL) {
+		LOG_ERR("Modbus hardware is not properly initialized");
+		return;
+	}
+
+	cfg = ctx->cfg;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		/*
+		 * The driver reports the end of the transmission after the
+		 * last character, the RS-485 transceiver can be switched.
+		 */
+		cfg->uart_buf_ctr = 0;
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		modbus_serial_tx_off(ctx);
+		modbus_serial_rx_on(ctx);
+		break;
+	case UART_TX_ABORTED:
+		cfg->uart_buf_ctr = 0;
+		cfg->uart_buf_ptr = &cfg->uart_buf[0];
+		modbus_serial_tx_off(ctx);
+		break;
+	case UART_RX_RDY:
+		if (cfg->rx_state != MODBUS_SERIAL_RX_ON) {
+			/* Flushed while stopping, the frame is being processed */
+			break;
+		}
+
+		end = evt->data.rx.offset + evt->data.rx.len;
+		cfg->uart_buf_ctr = end;
+		cfg->uart_buf_ptr = &cfg->uart_buf[end];
+
+		if (ctx->mode == MODBUS_MODE_RTU) {
+			/* Inter-frame delay elapsed, or buffer full */
+			k_work_submit(&ctx->server_work);
+		} else if (memchr(&cfg->uart_buf[evt->data.rx.offset],
+				  MODBUS_ASCII_END_FRAME_CHAR2, evt->data.rx.len) != NULL ||
+			   end == CONFIG_MODBUS_BUFFER_SIZE) {
+			k_work_submit(&ctx->server_work);
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_WRN("Receiver stopped, reason %d", evt->data.rx_stop.reason);
+		/* Drop the frame and restart once disabled */
+		K_SPINLOCK(&cfg->rx_lock) {
+			if (cfg->rx_state == MODBUS_SERIAL_RX_ON) {
+				cfg->rx_restart = true;
+			}
+		}
+		break;
+	case UART_RX_DISABLED:
+		async_rx_disabled(ctx);
+		break;
+	default:
+		break;
+	}
+}
+#else
 /*
  * A byte has been received from a serial port. We just store it in the buffer
  * for processing when a complete packet has been received.
@@ -421,6 +618,7 @@ static void rtu_tmr_handler(struct k_timer *t_id)
 
 	k_work_submit(&ctx->server_work);
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 static int configure_gpio(struct modbus_context *ctx)
 {
@@ -598,9 +796,19 @@ int modbus_serial_init(struct modbus_context *ctx,
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	cfg->rx_state = MODBUS_SERIAL_RX_IDLE;
+	cfg->rx_restart = false;
+
+	if (uart_callback_set(cfg->dev, uart_async_cb_handler, ctx) != 0) {
+		LOG_ERR("UART asynchronous API not supported");
+		return -ENOTSUP;
+	}
+#else
 	uart_irq_callback_user_data_set(cfg->dev, uart_cb_handler, ctx);
 	k_timer_init(&cfg->rtu_timer, rtu_tmr_handler, NULL);
 	k_timer_user_data_set(&cfg->rtu_timer, ctx);
+#endif
 
 	modbus_serial_rx_on(ctx);
 	LOG_INF("RTU timeout %u us", cfg->rtu_timeout);
@@ -610,7 +818,13 @@ int modbus_serial_init(struct modbus_context *ctx,
 
 void modbus_serial_disable(struct modbus_context *ctx)
 {
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	(void)uart_tx_abort(ctx->cfg->dev);
+	modbus_serial_tx_off(ctx);
+	modbus_serial_rx_off(ctx);
+#else
 	modbus_serial_tx_off(ctx);
 	modbus_serial_rx_off(ctx);
 	k_timer_stop(&ctx->cfg->rtu_timer);
+#endif
 }
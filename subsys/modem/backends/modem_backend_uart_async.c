@@ -18,6 +18,7 @@ enum {
 	MODEM_BACKEND_UART_ASYNC_STATE_RX_BUF0_USED_BIT,
 	MODEM_BACKEND_UART_ASYNC_STATE_RX_BUF1_USED_BIT,
 	MODEM_BACKEND_UART_ASYNC_STATE_OPEN_BIT,
+	MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT,
 };
 
 static bool modem_backend_uart_async_is_uart_stopped(struct modem_backend_uart *backend)
@@ -47,6 +48,31 @@ static uint32_t get_receive_buf_length(struct modem_backend_uart *backend)
 	return ring_buf_size_get(&backend->async.receive_rb);
 }
 
+/* Start transmitting the next buffer of a scatter list, returns false once all are sent */
+static bool modem_backend_uart_async_transmit_next_buf(struct modem_backend_uart *backend)
+{
+	const struct modem_pipe_buf *buf;
+	int ret;
+
+	if (backend->async.transmit_bufs_next >= backend->async.transmit_bufs_count) {
+		backend->async.transmit_bufs_count = 0;
+		return false;
+	}
+
+	buf = &backend->async.transmit_bufs[backend->async.transmit_bufs_next++];
+
+	ret = uart_tx(backend->uart, buf->buf, buf->size,
+		      CONFIG_MODEM_BACKEND_UART_ASYNC_TRANSMIT_TIMEOUT_MS * 1000L);
+	if (ret != 0) {
+		LOG_ERR("Failed to %s %zu bytes. (%d)",
+			"start async transmit for", buf->size, ret);
+		backend->async.transmit_bufs_count = 0;
+		return false;
+	}
+
+	return true;
+}
+
 static void modem_backend_uart_async_event_handler(const struct device *dev,
 						   struct uart_event *evt, void *user_data)
 {
@@ -56,6 +82,10 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+		if (modem_backend_uart_async_transmit_next_buf(backend)) {
+			break;
+		}
+
 		atomic_clear_bit(&backend->async.state,
 				 MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
 		k_work_submit(&backend->transmit_idle_work);
@@ -65,6 +95,7 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 		if (modem_backend_uart_async_is_open(backend)) {
 			LOG_WRN("Transmit aborted (%zu sent)", evt->data.tx.len);
 		}
+		backend->async.transmit_bufs_count = 0;
 		atomic_clear_bit(&backend->async.state,
 				 MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
 		k_work_submit(&backend->transmit_idle_work);
@@ -118,7 +149,12 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 		if (received < evt->data.rx.len) {
 			const unsigned int buf_size = get_receive_buf_length(backend);
 
-			ring_buf_reset(&backend->async.receive_rb);
+			/* Claimed data is read in place until it is released */
+			if (!atomic_test_bit(&backend->async.state,
+					     MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT)) {
+				ring_buf_reset(&backend->async.receive_rb);
+			}
+
 			k_spin_unlock(&backend->async.receive_rb_lock, key);
 
 			LOG_WRN("Receive buffer overrun (dropped %u + %u)",
@@ -155,6 +191,7 @@ static int modem_backend_uart_async_open(void *data)
 
 	atomic_clear(&backend->async.state);
 	ring_buf_reset(&backend->async.receive_rb);
+	backend->async.transmit_bufs_count = 0;
 
 	atomic_set_bit(&backend->async.state, MODEM_BACKEND_UART_ASYNC_STATE_RX_BUF0_USED_BIT);
 	atomic_set_bit(&backend->async.state, MODEM_BACKEND_UART_ASYNC_STATE_RECEIVING_BIT);
@@ -259,6 +296,106 @@ static int modem_backend_uart_async_receive(void *data, uint8_t *buf, size_t siz
 	return (int)received;
 }
 
+static int modem_backend_uart_async_transmit_bufs(void *data, const struct modem_pipe_buf *bufs,
+						  size_t count)
+{
+	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
+	uint8_t bufs_count = 0;
+	bool transmitting;
+	size_t transmitted = 0;
+
+	transmitting = atomic_test_and_set_bit(&backend->async.state,
+					       MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
+	if (transmitting) {
+		return 0;
+	}
+
+	/* Only the buffer descriptors are copied, the UART sends the data in place */
+	for (size_t i = 0; i < count; i++) {
+		if (bufs_count == ARRAY_SIZE(backend->async.transmit_bufs)) {
+			break;
+		}
+
+		if (bufs[i].size == 0) {
+			continue;
+		}
+
+		backend->async.transmit_bufs[bufs_count++] = bufs[i];
+		transmitted += bufs[i].size;
+	}
+
+	backend->async.transmit_bufs_count = bufs_count;
+	backend->async.transmit_bufs_next = 0;
+
+	if (!modem_backend_uart_async_transmit_next_buf(backend)) {
+		atomic_clear_bit(&backend->async.state,
+				 MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
+		k_work_submit(&backend->transmit_idle_work);
+		return bufs_count == 0 ? 0 : -EIO;
+	}
+
+	return (int)transmitted;
+}
+
+static int modem_backend_uart_async_receive_claim(void *data, uint8_t **buf)
+{
+	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
+	k_spinlock_key_t key;
+	uint32_t claimed;
+
+	if (atomic_test_and_set_bit(&backend->async.state,
+				    MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT)) {
+		return -EBUSY;
+	}
+
+	key = k_spin_lock(&backend->async.receive_rb_lock);
+
+#if CONFIG_MODEM_STATS
+	advertise_receive_buf_stats(backend);
+#endif
+
+	claimed = ring_buf_get_claim(&backend->async.receive_rb, buf, UINT32_MAX);
+	k_spin_unlock(&backend->async.receive_rb_lock, key);
+
+	if (claimed == 0) {
+		atomic_clear_bit(&backend->async.state,
+				 MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT);
+	}
+
+	return (int)claimed;
+}
+
+static int modem_backend_uart_async_receive_release(void *data, size_t size)
+{
+	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
+	k_spinlock_key_t key;
+	bool empty;
+	int ret;
+
+	if (!atomic_test_bit(&backend->async.state,
+			     MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&backend->async.receive_rb_lock);
+	ret = ring_buf_get_finish(&backend->async.receive_rb, size);
+	empty = ring_buf_is_empty(&backend->async.receive_rb);
+	k_spin_unlock(&backend->async.receive_rb_lock, key);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	atomic_clear_bit(&backend->async.state,
+			 MODEM_BACKEND_UART_ASYNC_STATE_RECEIVE_CLAIMED_BIT);
+
+	if (!empty) {
+		k_work_schedule(&backend->receive_ready_work, K_NO_WAIT);
+	}
+
+	return 0;
+}
+
 static int modem_backend_uart_async_close(void *data)
 {
 	struct modem_backend_uart *backend = (struct modem_backend_uart *)data;
@@ -274,6 +411,9 @@ static const struct modem_pipe_api modem_backend_uart_async_api = {
 	.transmit = modem_backend_uart_async_transmit,
 	.receive = modem_backend_uart_async_receive,
 	.close = modem_backend_uart_async_close,
+	.transmit_bufs = modem_backend_uart_async_transmit_bufs,
+	.receive_claim = modem_backend_uart_async_receive_claim,
+	.receive_release = modem_backend_uart_async_receive_release,
 };
 
 bool modem_backend_uart_async_is_supported(struct modem_backend_uart *backend)
@@ -25,6 +25,8 @@ const struct modem_chat_script_chat modem_chat_empty_script_chats[0];
 
 #define MODEM_CHAT_SCRIPT_STATE_RUNNING_BIT (0)
 
+#define MODEM_CHAT_TRIE_NODE_NONE (UINT16_MAX)
+
 #if defined(CONFIG_LOG) && (CONFIG_MODEM_MODULES_LOG_LEVEL == LOG_LEVEL_DBG)
 
 static char log_buffer[CONFIG_MODEM_CHAT_LOG_BUFFER_SIZE];
@@ -385,6 +387,10 @@ static void modem_chat_parse_reset(struct modem_chat *chat)
 	chat->delimiter_match_len = 0;
 	chat->argc = 0;
 	chat->parse_match = NULL;
+
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+	chat->unsol_trie_node = 0;
+#endif
 }
 
 /* Exact match is stored at end of receive buffer */
@@ -426,26 +432,152 @@ static bool modem_chat_match_matches_received(struct modem_chat *chat,
 	return true;
 }
 
+static bool modem_chat_parse_find_match_of_type(struct modem_chat *chat, uint16_t type)
+{
+	/* Find in all matches of matches type */
+	for (uint16_t u = 0; u < chat->matches_size[type]; u++) {
+		/* Validate match size matches received data length */
+		if (chat->matches[type][u].match_size != chat->receive_buf_len) {
+			continue;
+		}
+
+		/* Validate match */
+		if (modem_chat_match_matches_received(chat, &chat->matches[type][u]) == false) {
+			continue;
+		}
+
+		/* Complete match found */
+		chat->parse_match = &chat->matches[type][u];
+		chat->parse_match_type = type;
+		return true;
+	}
+
+	return false;
+}
+
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+static bool modem_chat_match_has_wildcards(const struct modem_chat_match *match)
+{
+	return match->wildcards && (memchr(match->match, '?', match->match_size) != NULL);
+}
+
+static uint16_t modem_chat_unsol_trie_child(struct modem_chat *chat, uint16_t node, uint8_t byte)
+{
+	for (uint16_t i = chat->unsol_trie[node].child; i != 0; i = chat->unsol_trie[i].sibling) {
+		if (chat->unsol_trie[i].byte == byte) {
+			return i;
+		}
+	}
+
+	return MODEM_CHAT_TRIE_NODE_NONE;
+}
+
+static void modem_chat_unsol_trie_build(struct modem_chat *chat)
+{
+	const struct modem_chat_match *matches = chat->matches[MODEM_CHAT_MATCHES_INDEX_UNSOL];
+	uint16_t node;
+	uint16_t child;
+
+	/* Root node */
+	chat->unsol_trie_size = 1;
+
+	for (uint16_t u = 0; u < chat->matches_size[MODEM_CHAT_MATCHES_INDEX_UNSOL]; u++) {
+		/* Catch all matches are found separately */
+		if (matches[u].match_size == 0) {
+			continue;
+		}
+
+		/* Matches with wildcards are compared one by one */
+		if (modem_chat_match_has_wildcards(&matches[u])) {
+			chat->unsol_trie_wildcards = true;
+			continue;
+		}
+
+		node = 0;
+
+		for (uint16_t i = 0; i < matches[u].match_size; i++) {
+			child = modem_chat_unsol_trie_child(chat, node, matches[u].match[i]);
+			if (child == MODEM_CHAT_TRIE_NODE_NONE) {
+				if (chat->unsol_trie_size == ARRAY_SIZE(chat->unsol_trie)) {
+					LOG_WRN("unsolicited matches trie too small");
+					chat->unsol_trie_size = 0;
+					return;
+				}
+
+				child = chat->unsol_trie_size++;
+				chat->unsol_trie[child].byte = matches[u].match[i];
+				chat->unsol_trie[child].sibling = chat->unsol_trie[node].child;
+				chat->unsol_trie[node].child = child;
+			}
+
+			node = child;
+		}
+
+		/* First match in array takes precedence */
+		if (chat->unsol_trie[node].match == 0) {
+			chat->unsol_trie[node].match = u + 1;
+		}
+	}
+}
+
+static void modem_chat_unsol_trie_advance(struct modem_chat *chat, uint8_t byte)
+{
+	if ((chat->unsol_trie_size == 0) || (chat->unsol_trie_node == MODEM_CHAT_TRIE_NODE_NONE)) {
+		return;
+	}
+
+	chat->unsol_trie_node = modem_chat_unsol_trie_child(chat, chat->unsol_trie_node, byte);
+}
+
+static bool modem_chat_parse_find_unsol_trie_match(struct modem_chat *chat)
+{
+	const struct modem_chat_match *matches = chat->matches[MODEM_CHAT_MATCHES_INDEX_UNSOL];
+	uint16_t end = chat->matches_size[MODEM_CHAT_MATCHES_INDEX_UNSOL];
+	uint16_t node = chat->unsol_trie_node;
+
+	/* Trie node reached by received data holds the exact match, if any */
+	if ((node != MODEM_CHAT_TRIE_NODE_NONE) && (chat->unsol_trie[node].match != 0)) {
+		end = chat->unsol_trie[node].match - 1;
+	}
+
+	/* Matches with wildcards placed before the exact match take precedence */
+	for (uint16_t u = 0; chat->unsol_trie_wildcards && (u < end); u++) {
+		if ((matches[u].wildcards == false) ||
+		    (matches[u].match_size != chat->receive_buf_len)) {
+			continue;
+		}
+
+		if (modem_chat_match_matches_received(chat, &matches[u]) == true) {
+			end = u;
+			break;
+		}
+	}
+
+	if (end == chat->matches_size[MODEM_CHAT_MATCHES_INDEX_UNSOL]) {
+		return false;
+	}
+
+	chat->parse_match = &matches[end];
+	chat->parse_match_type = MODEM_CHAT_MATCHES_INDEX_UNSOL;
+	return true;
+}
+#endif
+
 static bool modem_chat_parse_find_match(struct modem_chat *chat)
 {
 	/* Find in all matches types */
 	for (uint16_t i = 0; i < ARRAY_SIZE(chat->matches); i++) {
-		/* Find in all matches of matches type */
-		for (uint16_t u = 0; u < chat->matches_size[i]; u++) {
-			/* Validate match size matches received data length */
-			if (chat->matches[i][u].match_size != chat->receive_buf_len) {
-				continue;
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+		if ((i == MODEM_CHAT_MATCHES_INDEX_UNSOL) && (chat->unsol_trie_size > 0)) {
+			if (modem_chat_parse_find_unsol_trie_match(chat) == true) {
+				return true;
 			}
 
-			/* Validate match */
-			if (modem_chat_match_matches_received(chat, &chat->matches[i][u]) ==
-			    false) {
-				continue;
-			}
+			continue;
+		}
+#endif
 
-			/* Complete match found */
-			chat->parse_match = &chat->matches[i][u];
-			chat->parse_match_type = i;
+		if (modem_chat_parse_find_match_of_type(chat, i) == true) {
 			return true;
 		}
 	}
@@ -601,6 +733,13 @@ static void modem_chat_process_byte(struct modem_chat *chat, uint8_t byte)
 	chat->receive_buf[chat->receive_buf_len] = byte;
 	chat->receive_buf_len++;
 
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+	/* Follow received data in unsolicited matches trie until a match is found */
+	if (chat->parse_match == NULL) {
+		modem_chat_unsol_trie_advance(chat, byte);
+	}
+#endif
+
 	/* Validate end delimiter not complete */
 	if (modem_chat_parse_end_del_complete(chat) == true) {
 		/* Filter out empty lines */
@@ -696,14 +835,14 @@ static bool modem_chat_discard_byte(struct modem_chat *chat, uint8_t byte)
 }
 
 /* Process chunk of received bytes */
-static void modem_chat_process_bytes(struct modem_chat *chat)
+static void modem_chat_process_bytes(struct modem_chat *chat, const uint8_t *buf)
 {
 	for (uint16_t i = 0; i < chat->work_buf_len; i++) {
-		if (modem_chat_discard_byte(chat, chat->work_buf[i])) {
+		if (modem_chat_discard_byte(chat, buf[i])) {
 			continue;
 		}
 
-		modem_chat_process_byte(chat, chat->work_buf[i]);
+		modem_chat_process_byte(chat, buf[i]);
 	}
 }
 
@@ -725,23 +864,34 @@ static void advertise_work_buf_stats(struct modem_chat *chat)
 static void modem_chat_process_handler(struct k_work *item)
 {
 	struct modem_chat *chat = CONTAINER_OF(item, struct modem_chat, receive_work);
+	uint8_t *buf;
 	int ret;
 
-	/* Fill work buffer */
-	ret = modem_pipe_receive(chat->pipe, chat->work_buf, sizeof(chat->work_buf));
+	/* Process the data in place if the pipe lends its buffer, else fill work buffer */
+	ret = modem_pipe_receive_claim(chat->pipe, &buf);
+	if (ret == -ENOTSUP) {
+		buf = chat->work_buf;
+		ret = modem_pipe_receive(chat->pipe, chat->work_buf, sizeof(chat->work_buf));
+	}
+
 	if (ret < 1) {
 		return;
 	}
 
-	/* Save received data length */
-	chat->work_buf_len = (size_t)ret;
+	/* Save received data length, lent data is processed in work buffer sized chunks */
+	chat->work_buf_len = MIN((size_t)ret, sizeof(chat->work_buf));
 
 #if CONFIG_MODEM_STATS
 	advertise_work_buf_stats(chat);
 #endif
 
 	/* Process data */
-	modem_chat_process_bytes(chat);
+	modem_chat_process_bytes(chat, buf);
+
+	if (buf != chat->work_buf) {
+		(void)modem_pipe_receive_release(chat->pipe, chat->work_buf_len);
+	}
+
 	k_work_submit(&chat->receive_work);
 }
 
@@ -818,6 +968,9 @@ int modem_chat_init(struct modem_chat *chat, const struct modem_chat_config *con
 	chat->filter_size = config->filter_size;
 	chat->matches[MODEM_CHAT_MATCHES_INDEX_UNSOL] = config->unsol_matches;
 	chat->matches_size[MODEM_CHAT_MATCHES_INDEX_UNSOL] = config->unsol_matches_size;
+#if CONFIG_MODEM_CHAT_UNSOL_TRIE_NODES > 0
+	modem_chat_unsol_trie_build(chat);
+#endif
 	atomic_set(&chat->script_state, 0);
 	k_sem_init(&chat->script_stopped_sem, 0, 1);
 	k_work_init(&chat->receive_work, modem_chat_process_handler);
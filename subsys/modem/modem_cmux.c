@@ -590,6 +590,7 @@ static void modem_cmux_on_dlci_frame_ua(struct modem_cmux_dlci *dlci)
 		k_work_cancel_delayable(&dlci->open_work);
 		k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 		ring_buf_reset(&dlci->receive_rb);
+		dlci->receive_claimed = false;
 		k_mutex_unlock(&dlci->receive_rb_lock);
 		break;
 
@@ -640,6 +641,7 @@ static void modem_cmux_on_dlci_frame_sabm(struct modem_cmux_dlci *dlci)
 	modem_pipe_notify_opened(&dlci->pipe);
 	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 	ring_buf_reset(&dlci->receive_rb);
+	dlci->receive_claimed = false;
 	k_mutex_unlock(&dlci->receive_rb_lock);
 }
 
@@ -889,14 +891,49 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/* Copy as much of the frame data as is available at once */
+static size_t modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+					       size_t size)
+{
+	size_t len;
+
+	if (cmux->receive_state != MODEM_CMUX_RECEIVE_STATE_DATA) {
+		return 0;
+	}
+
+	len = MIN(size, cmux->frame.data_len - cmux->receive_buf_len);
+
+	if (cmux->receive_buf_len < cmux->receive_buf_size) {
+		memcpy(&cmux->receive_buf[cmux->receive_buf_len], data,
+		       MIN(len, cmux->receive_buf_size - cmux->receive_buf_len));
+	}
+
+	cmux->receive_buf_len += len;
+
+	/* Check if datalen reached */
+	if (cmux->frame.data_len == cmux->receive_buf_len) {
+		/* Await FCS */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+	}
+
+	return len;
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
 	struct modem_cmux *cmux = CONTAINER_OF(dwork, struct modem_cmux, receive_work);
+	uint8_t *buf;
+	size_t consumed;
 	int ret;
 
-	/* Receive data from pipe */
-	ret = modem_pipe_receive(cmux->pipe, cmux->work_buf, sizeof(cmux->work_buf));
+	/* Parse received data in place if the pipe lends its buffer */
+	ret = modem_pipe_receive_claim(cmux->pipe, &buf);
+	if (ret == -ENOTSUP) {
+		buf = cmux->work_buf;
+		ret = modem_pipe_receive(cmux->pipe, cmux->work_buf, sizeof(cmux->work_buf));
+	}
+
 	if (ret < 1) {
 		if (ret < 0) {
 			LOG_ERR("Pipe receiving error: %d", ret);
@@ -905,8 +942,16 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
+	for (int i = 0; i < ret; i += consumed) {
+		consumed = modem_cmux_process_received_data(cmux, &buf[i], ret - i);
+		if (consumed == 0) {
+			modem_cmux_process_received_byte(cmux, buf[i]);
+			consumed = 1;
+		}
+	}
+
+	if (buf != cmux->work_buf) {
+		(void)modem_pipe_receive_release(cmux->pipe, ret);
 	}
 
 	/* Reschedule received work */
@@ -1126,6 +1171,49 @@ static int modem_cmux_dlci_pipe_api_receive(void *data, uint8_t *buf, size_t siz
 	return ret;
 }
 
+static int modem_cmux_dlci_pipe_api_receive_claim(void *data, uint8_t **buf)
+{
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	uint32_t ret;
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	if (dlci->receive_claimed) {
+		k_mutex_unlock(&dlci->receive_rb_lock);
+		return -EBUSY;
+	}
+
+#if CONFIG_MODEM_STATS
+	modem_cmux_dlci_advertise_receive_buf_stat(dlci);
+#endif
+
+	ret = ring_buf_get_claim(&dlci->receive_rb, buf, UINT32_MAX);
+	dlci->receive_claimed = ret > 0;
+	k_mutex_unlock(&dlci->receive_rb_lock);
+	return ret;
+}
+
+static int modem_cmux_dlci_pipe_api_receive_release(void *data, size_t size)
+{
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	int ret;
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	if (!dlci->receive_claimed) {
+		k_mutex_unlock(&dlci->receive_rb_lock);
+		return -EINVAL;
+	}
+
+	ret = ring_buf_get_finish(&dlci->receive_rb, size);
+	if (ret == 0) {
+		dlci->receive_claimed = false;
+	}
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+	return ret;
+}
+
 static int modem_cmux_dlci_pipe_api_close(void *data)
 {
 	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
@@ -1154,6 +1242,8 @@ static const struct modem_pipe_api modem_cmux_dlci_pipe_api = {
 	.transmit = modem_cmux_dlci_pipe_api_transmit,
 	.receive = modem_cmux_dlci_pipe_api_receive,
 	.close = modem_cmux_dlci_pipe_api_close,
+	.receive_claim = modem_cmux_dlci_pipe_api_receive_claim,
+	.receive_release = modem_cmux_dlci_pipe_api_receive_release,
 };
 
 static void modem_cmux_dlci_open_handler(struct k_work *item)
@@ -153,6 +153,44 @@ int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size)
 	return pipe_call_receive(pipe, buf, size);
 }
 
+int modem_pipe_transmit_bufs(struct modem_pipe *pipe, const struct modem_pipe_buf *bufs,
+			     size_t count)
+{
+	if (pipe->api->transmit_bufs == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (!pipe_test_events(pipe, PIPE_EVENT_OPENED_BIT)) {
+		return -EPERM;
+	}
+
+	pipe_clear_events(pipe, PIPE_EVENT_TRANSMIT_IDLE_BIT);
+	return pipe->api->transmit_bufs(pipe->data, bufs, count);
+}
+
+int modem_pipe_receive_claim(struct modem_pipe *pipe, uint8_t **buf)
+{
+	if (pipe->api->receive_claim == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (!pipe_test_events(pipe, PIPE_EVENT_OPENED_BIT)) {
+		return -EPERM;
+	}
+
+	pipe_clear_events(pipe, PIPE_EVENT_RECEIVE_READY_BIT);
+	return pipe->api->receive_claim(pipe->data, buf);
+}
+
+int modem_pipe_receive_release(struct modem_pipe *pipe, size_t size)
+{
+	if (pipe->api->receive_release == NULL) {
+		return -ENOTSUP;
+	}
+
+	return pipe->api->receive_release(pipe->data, size);
+}
+
 void modem_pipe_release(struct modem_pipe *pipe)
 {
 	pipe_set_callback(pipe, NULL, NULL);
@@ -19,6 +19,9 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+#define MODEM_PPP_WORD_ONES		(0x01010101U)
+#define MODEM_PPP_WORD_HIGHS		(0x80808080U)
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
 	return crc16_ccitt(0xFFFF, &byte, 1);
@@ -34,6 +37,58 @@ static uint16_t modem_ppp_fcs_final(uint16_t fcs)
 	return fcs ^ 0xFFFF;
 }
 
+static bool modem_ppp_word_has_less(uint32_t word, uint8_t value)
+{
+	return ((word - (MODEM_PPP_WORD_ONES * value)) & ~word & MODEM_PPP_WORD_HIGHS) != 0;
+}
+
+static bool modem_ppp_word_has_byte(uint32_t word, uint8_t value)
+{
+	return modem_ppp_word_has_less(word ^ (MODEM_PPP_WORD_ONES * value), 1);
+}
+
+static bool modem_ppp_byte_is_special(uint8_t byte, bool control)
+{
+	return (byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
+	       (control && (byte < MODEM_PPP_VALUE_ESCAPE));
+}
+
+/* Length of data before the first delimiter, escape or, if control is set, control byte */
+static size_t modem_ppp_plain_data_len(const uint8_t *data, size_t size, bool control)
+{
+	size_t i = 0;
+	uint32_t word;
+
+	/* Align to word */
+	while ((i < size) && (((uintptr_t)&data[i] % sizeof(uint32_t)) != 0)) {
+		if (modem_ppp_byte_is_special(data[i], control)) {
+			return i;
+		}
+
+		i++;
+	}
+
+	/* Check a word at a time */
+	while ((size - i) >= sizeof(uint32_t)) {
+		word = *(const uint32_t *)&data[i];
+
+		if (modem_ppp_word_has_byte(word, MODEM_PPP_CODE_DELIMITER) ||
+		    modem_ppp_word_has_byte(word, MODEM_PPP_CODE_ESCAPE) ||
+		    (control && modem_ppp_word_has_less(word, MODEM_PPP_VALUE_ESCAPE))) {
+			break;
+		}
+
+		i += sizeof(uint32_t);
+	}
+
+	/* Find the special byte in the last word */
+	while ((i < size) && !modem_ppp_byte_is_special(data[i], control)) {
+		i++;
+	}
+
+	return i;
+}
+
 static uint16_t modem_ppp_ppp_protocol(struct net_pkt *pkt)
 {
 	if (net_pkt_family(pkt) == AF_INET) {
@@ -88,8 +143,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_is_special(byte, true)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -106,8 +160,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = ppp->tx_pkt_protocol & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_is_special(byte, true)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -125,8 +178,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		(void)net_pkt_read_u8(ppp->tx_pkt, &byte);
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_is_special(byte, true)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -152,8 +204,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		ppp->tx_pkt_fcs = modem_ppp_fcs_final(ppp->tx_pkt_fcs);
 		byte = ppp->tx_pkt_fcs & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_is_special(byte, true)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -169,8 +220,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	case MODEM_PPP_TRANSMIT_STATE_FCS_HIGH:
 		byte = (ppp->tx_pkt_fcs >> 8) & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_byte_is_special(byte, true)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -192,6 +242,38 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	return 0;
 }
 
+/* Copy data which needs no escaping from the net_pkt straight into the transmit ring buffer */
+static uint32_t modem_ppp_wrap_net_pkt_data(struct modem_ppp *ppp)
+{
+	struct net_pkt_cursor *cursor = &ppp->tx_pkt->cursor;
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	size_t len;
+
+	if (cursor->buf == NULL) {
+		return 0;
+	}
+
+	/* Data left in the current fragment */
+	len = cursor->buf->len - (cursor->pos - cursor->buf->data);
+	reserved_size = ring_buf_put_claim(&ppp->transmit_rb, &reserved, len);
+	len = modem_ppp_plain_data_len(cursor->pos, reserved_size, true);
+
+	if ((len == 0) || (net_pkt_read(ppp->tx_pkt, reserved, len) < 0)) {
+		ring_buf_put_finish(&ppp->transmit_rb, 0);
+		return 0;
+	}
+
+	ring_buf_put_finish(&ppp->transmit_rb, len);
+	ppp->tx_pkt_fcs = crc16_ccitt(ppp->tx_pkt_fcs, reserved, len);
+
+	if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
+		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
+	}
+
+	return len;
+}
+
 static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 {
 	if (byte == expected_byte) {
@@ -313,6 +395,49 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/* Write data which needs no unescaping straight into the net_pkt */
+static size_t modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					      size_t size)
+{
+	size_t len;
+	size_t chunk;
+
+	if (ppp->receive_state != MODEM_PPP_RECEIVE_STATE_WRITING) {
+		return 0;
+	}
+
+	len = modem_ppp_plain_data_len(data, size, false);
+
+	for (size_t i = 0; i < len; i += chunk) {
+		if (net_pkt_available_buffer(ppp->rx_pkt) <= 1) {
+			if (net_pkt_alloc_buffer(ppp->rx_pkt, CONFIG_MODEM_PPP_NET_BUF_FRAG_SIZE,
+						 AF_INET, K_NO_WAIT) < 0) {
+				LOG_WRN("Failed to alloc buffer");
+				net_pkt_unref(ppp->rx_pkt);
+				ppp->rx_pkt = NULL;
+				ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+				break;
+			}
+		}
+
+		/* Keep one byte available, as the byte by byte path does */
+		chunk = MIN(len - i, net_pkt_available_buffer(ppp->rx_pkt) - 1);
+
+		if (net_pkt_write(ppp->rx_pkt, &data[i], chunk) < 0) {
+			LOG_WRN("Dropped PPP frame");
+			net_pkt_unref(ppp->rx_pkt);
+			ppp->rx_pkt = NULL;
+			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+			ppp->stats.drop++;
+#endif
+			break;
+		}
+	}
+
+	return len;
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -373,6 +498,11 @@ static void modem_ppp_send_handler(struct k_work *item)
 
 		/* Fill transmit ring buffer */
 		while (ring_buf_space_get(&ppp->transmit_rb) > 0) {
+			if ((ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) &&
+			    (modem_ppp_wrap_net_pkt_data(ppp) > 0)) {
+				continue;
+			}
+
 			byte = modem_ppp_wrap_net_pkt_byte(ppp);
 
 			ring_buf_put(&ppp->transmit_rb, &byte, 1);
@@ -409,19 +539,37 @@ static void modem_ppp_send_handler(struct k_work *item)
 static void modem_ppp_process_handler(struct k_work *item)
 {
 	struct modem_ppp *ppp = CONTAINER_OF(item, struct modem_ppp, process_work);
+	uint8_t *buf;
+	size_t consumed;
 	int ret;
 
-	ret = modem_pipe_receive(ppp->pipe, ppp->receive_buf, ppp->buf_size);
+	/* Unwrap frames in place if the pipe lends its buffer */
+	ret = modem_pipe_receive_claim(ppp->pipe, &buf);
+	if (ret == -ENOTSUP) {
+		buf = ppp->receive_buf;
+		ret = modem_pipe_receive(ppp->pipe, ppp->receive_buf, ppp->buf_size);
+	}
+
 	if (ret < 1) {
 		return;
 	}
 
+	ret = MIN(ret, ppp->buf_size);
+
 #if CONFIG_MODEM_STATS
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
+	for (int i = 0; i < ret; i += consumed) {
+		consumed = modem_ppp_process_received_data(ppp, &buf[i], ret - i);
+		if (consumed == 0) {
+			modem_ppp_process_received_byte(ppp, buf[i]);
+			consumed = 1;
+		}
+	}
+
+	if (buf != ppp->receive_buf) {
+		(void)modem_pipe_receive_release(ppp->pipe, ret);
 	}
 
 	k_work_submit(&ppp->process_work);
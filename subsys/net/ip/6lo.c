@@ -46,6 +46,13 @@ static inline uint8_t get_6co_cid(struct net_icmpv6_nd_opt_6co *opt)
 static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
 #endif
 
+#if CONFIG_NET_6LO_FLOW_CACHE_SIZE > 0
+/* Largest cached link layer address, IEEE 802.15.4 extended address */
+#define NET_6LO_FLOW_LLADDR_SIZE 8
+
+static void flow_cache_flush(void);
+#endif
+
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
 
 static const uint8_t tf_inline_size_table[] = {4, 3, 1, 0};
@@ -178,6 +185,11 @@ void net_6lo_set_context(struct net_if *iface,
 	int unused = -1;
 	uint8_t i;
 
+#if CONFIG_NET_6LO_FLOW_CACHE_SIZE > 0
+	/* Cached flows may have been compressed using the old context */
+	flow_cache_flush();
+#endif
+
 	/* If the context information already exists, update or remove
 	 * as per data.
 	 */
@@ -717,72 +729,45 @@ static struct net_6lo_context *get_dst_addr_ctx(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_6LO_CONTEXT */
 
-/* RFC 6282 LOWPAN IPHC Encoding format (3.1)
- *  Base Format
- *   0                                       1
- *   0   1   2   3   4   5   6   7   8   9   0   1   2   3   4   5
- * +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
- * | 0 | 1 | 1 |  TF   |NH | HLIM  |CID|SAC|  SAM  | M |DAC|  DAM  |
- * +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
+/* Compress source and destination addresses, addresses are placed before
+ * the next header fields. Sets the address related IPHC bits and returns the
+ * context identifiers in cid.
  */
-static inline int compress_IPHC_header(struct net_pkt *pkt)
+static uint8_t *compress_addresses(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+				   uint8_t *inline_pos, uint16_t *iphc, uint8_t *cid)
 {
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	struct net_6lo_context *src_ctx = NULL;
 	struct net_6lo_context *dst_ctx = NULL;
 #endif
-	uint8_t compressed = 0;
-	uint16_t iphc = (NET_6LO_DISPATCH_IPHC << 8);
-	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
-	struct net_udp_hdr *udp;
-	uint8_t *inline_pos;
-
-	if (pkt->frags->len < NET_IPV6H_LEN) {
-		NET_ERR("Invalid length %d, min %d",
-			pkt->frags->len, NET_IPV6H_LEN);
-		return -EINVAL;
-	}
-
-	if (ipv6->nexthdr == IPPROTO_UDP &&
-	    pkt->frags->len < NET_IPV6UDPH_LEN) {
-		NET_ERR("Invalid length %d, min %d",
-			pkt->frags->len, NET_IPV6UDPH_LEN);
-		return -EINVAL;
-	}
-
-	inline_pos = pkt->buffer->data + NET_IPV6H_LEN;
 
-	if (ipv6->nexthdr == IPPROTO_UDP) {
-		udp = (struct net_udp_hdr *)inline_pos;
-		inline_pos += NET_UDPH_LEN;
-
-		inline_pos = compress_nh_udp(udp, inline_pos, false);
-	}
+	*cid = 0U;
 
 	if (net_6lo_ll_prefix_padded_with_zeros((struct in6_addr *)ipv6->dst)) {
-		inline_pos = compress_da(ipv6, pkt, inline_pos, &iphc);
+		inline_pos = compress_da(ipv6, pkt, inline_pos, iphc);
 		goto da_end;
 	}
 
 	if (net_ipv6_is_addr_mcast((struct in6_addr *)ipv6->dst)) {
-		inline_pos = compress_da_mcast(ipv6, inline_pos, &iphc);
+		inline_pos = compress_da_mcast(ipv6, inline_pos, iphc);
 		goto da_end;
 	}
 
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	dst_ctx = get_dst_addr_ctx(pkt, ipv6);
 	if (dst_ctx) {
-		iphc |= NET_6LO_IPHC_CID_1;
-		inline_pos = compress_da_ctx(ipv6, inline_pos, pkt, &iphc,
+		*iphc |= NET_6LO_IPHC_CID_1;
+		*cid |= dst_ctx->cid & 0x0F;
+		inline_pos = compress_da_ctx(ipv6, inline_pos, pkt, iphc,
 					     dst_ctx);
 		goto da_end;
 	}
 #endif
-	inline_pos = set_da_inline(ipv6, inline_pos, &iphc);
+	inline_pos = set_da_inline(ipv6, inline_pos, iphc);
 da_end:
 
 	if (net_6lo_ll_prefix_padded_with_zeros((struct in6_addr *)ipv6->src)) {
-		inline_pos = compress_sa(ipv6, pkt, inline_pos, &iphc);
+		inline_pos = compress_sa(ipv6, pkt, inline_pos, iphc);
 		goto sa_end;
 	}
 
@@ -790,41 +775,224 @@ da_end:
 		NET_DBG("SAM_00, SAC_1 unspecified src address");
 
 		/* Unspecified IPv6 src address */
-		iphc |= NET_6LO_IPHC_SAC_1;
-		iphc |= NET_6LO_IPHC_SAM_00;
+		*iphc |= NET_6LO_IPHC_SAC_1;
+		*iphc |= NET_6LO_IPHC_SAM_00;
 		goto sa_end;
 	}
 
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	src_ctx = get_src_addr_ctx(pkt, ipv6);
 	if (src_ctx) {
-		inline_pos = compress_sa_ctx(ipv6, inline_pos, pkt, &iphc,
+		inline_pos = compress_sa_ctx(ipv6, inline_pos, pkt, iphc,
 					     src_ctx);
-		iphc |= NET_6LO_IPHC_CID_1;
+		*iphc |= NET_6LO_IPHC_CID_1;
+		*cid |= src_ctx->cid << 4;
 		goto sa_end;
 	}
 #endif
-	inline_pos = set_sa_inline(ipv6, inline_pos, &iphc);
+	inline_pos = set_sa_inline(ipv6, inline_pos, iphc);
 sa_end:
 
+	return inline_pos;
+}
+
+#if CONFIG_NET_6LO_FLOW_CACHE_SIZE > 0
+/* Address compression of recently sent flows. The inlined address bytes
+ * follow from the cached IPHC bits, so only those and the context
+ * identifiers are stored.
+ */
+struct net_6lo_flow {
+	struct net_if *iface;
+	uint8_t src[NET_IPV6_ADDR_SIZE];
+	uint8_t dst[NET_IPV6_ADDR_SIZE];
+	uint8_t ll_src[NET_6LO_FLOW_LLADDR_SIZE];
+	uint8_t ll_dst[NET_6LO_FLOW_LLADDR_SIZE];
+	uint8_t ll_src_len;
+	uint8_t ll_dst_len;
+	uint16_t iphc;
+	uint8_t cid;
+};
+
+static struct net_6lo_flow flows[CONFIG_NET_6LO_FLOW_CACHE_SIZE];
+static uint8_t flows_next;
+static struct k_spinlock flows_lock;
+
+static void flow_cache_flush(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&flows_lock);
+
+	memset(flows, 0, sizeof(flows));
+	k_spin_unlock(&flows_lock, key);
+}
+
+static bool flow_matches(struct net_6lo_flow *flow, struct net_pkt *pkt,
+			 struct net_ipv6_hdr *ipv6)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+
+	return flow->iface == net_pkt_iface(pkt) &&
+	       flow->ll_src_len == ll_src->len && flow->ll_dst_len == ll_dst->len &&
+	       !memcmp(flow->dst, ipv6->dst, NET_IPV6_ADDR_SIZE) &&
+	       !memcmp(flow->src, ipv6->src, NET_IPV6_ADDR_SIZE) &&
+	       !memcmp(flow->ll_src, ll_src->addr, ll_src->len) &&
+	       !memcmp(flow->ll_dst, ll_dst->addr, ll_dst->len);
+}
+
+static bool flow_cache_get(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+			   uint16_t *iphc, uint8_t *cid)
+{
+	k_spinlock_key_t key = k_spin_lock(&flows_lock);
+	bool found = false;
+
+	for (uint8_t i = 0U; i < ARRAY_SIZE(flows); i++) {
+		if (flows[i].iface == NULL || !flow_matches(&flows[i], pkt, ipv6)) {
+			continue;
+		}
+
+		*iphc |= flows[i].iphc;
+		*cid = flows[i].cid;
+		found = true;
+		break;
+	}
+
+	k_spin_unlock(&flows_lock, key);
+
+	return found;
+}
+
+static void flow_cache_add(struct net_pkt *pkt, struct net_ipv6_hdr *ipv6,
+			   uint16_t iphc, uint8_t cid)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+	struct net_6lo_flow *flow;
+	k_spinlock_key_t key;
+
+	if (ll_src->len > NET_6LO_FLOW_LLADDR_SIZE ||
+	    ll_dst->len > NET_6LO_FLOW_LLADDR_SIZE) {
+		return;
+	}
+
+	key = k_spin_lock(&flows_lock);
+
+	/* Replace the oldest flow */
+	flow = &flows[flows_next];
+	flows_next = (flows_next + 1U) % ARRAY_SIZE(flows);
+
+	flow->iface = net_pkt_iface(pkt);
+	memcpy(flow->src, ipv6->src, NET_IPV6_ADDR_SIZE);
+	memcpy(flow->dst, ipv6->dst, NET_IPV6_ADDR_SIZE);
+	memcpy(flow->ll_src, ll_src->addr, ll_src->len);
+	memcpy(flow->ll_dst, ll_dst->addr, ll_dst->len);
+	flow->ll_src_len = ll_src->len;
+	flow->ll_dst_len = ll_dst->len;
+	flow->iphc = iphc & (NET_6LO_IPHC_CID_MASK | NET_6LO_IPHC_SA_MASK |
+			     NET_6LO_IPHC_DA_MASK);
+	flow->cid = cid;
+
+	k_spin_unlock(&flows_lock, key);
+}
+
+/* Inline the trailing address bytes, the multicast 48 and 32 bit forms
+ * carry the second address byte in front of them.
+ */
+static uint8_t *set_addr_tail_inline(const uint8_t *addr, uint8_t *inline_ptr,
+				     uint8_t len, bool mcast_scope)
+{
+	if (mcast_scope) {
+		len -= sizeof(uint8_t);
+	}
+
+	inline_ptr -= len;
+	memmove(inline_ptr, &addr[NET_IPV6_ADDR_SIZE - len], len);
+
+	if (mcast_scope) {
+		inline_ptr -= sizeof(uint8_t);
+		*inline_ptr = addr[1];
+	}
+
+	return inline_ptr;
+}
+
+static uint8_t *compress_addresses_cached(struct net_ipv6_hdr *ipv6,
+					  uint8_t *inline_pos, uint16_t iphc)
+{
+	uint8_t da = (iphc & NET_6LO_IPHC_DA_MASK) >> NET_6LO_IPHC_DAM_POS;
+	uint8_t sa = (iphc & NET_6LO_IPHC_SA_MASK) >> NET_6LO_IPHC_SAM_POS;
+	bool mcast_scope = (iphc & NET_6LO_IPHC_M_1) &&
+			   ((iphc & NET_6LO_IPHC_DAM_MASK) == NET_6LO_IPHC_DAM_01 ||
+			    (iphc & NET_6LO_IPHC_DAM_MASK) == NET_6LO_IPHC_DAM_10);
+
+	inline_pos = set_addr_tail_inline(ipv6->dst, inline_pos,
+					  da_inline_size_table[da], mcast_scope);
+
+	return set_addr_tail_inline(ipv6->src, inline_pos,
+				    sa_inline_size_table[sa], false);
+}
+#endif /* CONFIG_NET_6LO_FLOW_CACHE_SIZE > 0 */
+
+/* RFC 6282 LOWPAN IPHC Encoding format (3.1)
+ *  Base Format
+ *   0                                       1
+ *   0   1   2   3   4   5   6   7   8   9   0   1   2   3   4   5
+ * +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
+ * | 0 | 1 | 1 |  TF   |NH | HLIM  |CID|SAC|  SAM  | M |DAC|  DAM  |
+ * +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
+ */
+static inline int compress_IPHC_header(struct net_pkt *pkt)
+{
+	uint8_t compressed = 0;
+	uint16_t iphc = (NET_6LO_DISPATCH_IPHC << 8);
+	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
+	struct net_udp_hdr *udp;
+	uint8_t *inline_pos;
+	uint8_t cid;
+
+	if (pkt->frags->len < NET_IPV6H_LEN) {
+		NET_ERR("Invalid length %d, min %d",
+			pkt->frags->len, NET_IPV6H_LEN);
+		return -EINVAL;
+	}
+
+	if (ipv6->nexthdr == IPPROTO_UDP &&
+	    pkt->frags->len < NET_IPV6UDPH_LEN) {
+		NET_ERR("Invalid length %d, min %d",
+			pkt->frags->len, NET_IPV6UDPH_LEN);
+		return -EINVAL;
+	}
+
+	inline_pos = pkt->buffer->data + NET_IPV6H_LEN;
+
+	if (ipv6->nexthdr == IPPROTO_UDP) {
+		udp = (struct net_udp_hdr *)inline_pos;
+		inline_pos += NET_UDPH_LEN;
+
+		inline_pos = compress_nh_udp(udp, inline_pos, false);
+	}
+
+#if CONFIG_NET_6LO_FLOW_CACHE_SIZE > 0
+	if (flow_cache_get(pkt, ipv6, &iphc, &cid)) {
+		inline_pos = compress_addresses_cached(ipv6, inline_pos, iphc);
+	} else {
+		uint16_t addr_iphc = 0U;
+
+		inline_pos = compress_addresses(pkt, ipv6, inline_pos, &addr_iphc, &cid);
+		flow_cache_add(pkt, ipv6, addr_iphc, cid);
+		iphc |= addr_iphc;
+	}
+#else
+	inline_pos = compress_addresses(pkt, ipv6, inline_pos, &iphc, &cid);
+#endif
+
 	inline_pos = compress_hoplimit(ipv6, inline_pos, &iphc);
 	inline_pos = compress_nh(ipv6, inline_pos, &iphc);
 	inline_pos = compress_tfl(ipv6, inline_pos, &iphc);
 
-#if defined(CONFIG_NET_6LO_CONTEXT)
 	if (iphc & NET_6LO_IPHC_CID_1) {
 		inline_pos -= sizeof(uint8_t);
-		*inline_pos = 0;
-
-		if (src_ctx) {
-			*inline_pos = src_ctx->cid << 4;
-		}
-
-		if (dst_ctx) {
-			*inline_pos |= dst_ctx->cid & 0x0F;
-		}
+		*inline_pos = cid;
 	}
-#endif
 
 	inline_pos -= sizeof(iphc);
 	iphc = htons(iphc);
@@ -923,338 +1091,89 @@ static inline uint8_t *uncompress_hoplimit(uint16_t iphc, uint8_t *cursor,
 	return cursor;
 }
 
-/* Helper to uncompress Source Address */
-static inline uint8_t *uncompress_sa(uint16_t iphc, uint8_t *cursor,
-				 struct net_ipv6_hdr *ipv6,
-				 struct net_pkt *pkt)
-{
-	struct in6_addr src_ip;
-
-	NET_DBG("SAC_0");
-
-	net_ipv6_addr_copy_raw((uint8_t *)&src_ip, ipv6->src);
-
-	switch (iphc & NET_6LO_IPHC_SAM_MASK) {
-	case NET_6LO_IPHC_SAM_00:
-		NET_DBG("SAM_00 full src addr inlined");
-
-		memmove(src_ip.s6_addr, cursor, sizeof(src_ip.s6_addr));
-		cursor += sizeof(src_ip.s6_addr);
-
-		break;
-	case NET_6LO_IPHC_SAM_01:
-		NET_DBG("SAM_01 last 64 bits are inlined");
-
-		memmove(&src_ip.s6_addr[8], cursor, 8);
-		cursor += 8U;
-
-		src_ip.s6_addr32[0] = 0x00;
-		src_ip.s6_addr32[1] = 0x00;
-		src_ip.s6_addr[0] = 0xFE;
-		src_ip.s6_addr[1] = 0x80;
-
-		break;
-	case NET_6LO_IPHC_SAM_10:
-		NET_DBG("SAM_10 src addr 16 bit compressed");
-
-		memmove(&src_ip.s6_addr[14], cursor, 2);
-		cursor += 2U;
-		src_ip.s6_addr16[6] = 0x00;
-
-		src_ip.s6_addr32[0] = 0x00;
-		src_ip.s6_addr32[1] = 0x00;
-		src_ip.s6_addr32[2] = 0x00;
-		src_ip.s6_addr[0] = 0xFE;
-		src_ip.s6_addr[1] = 0x80;
-		src_ip.s6_addr[11] = 0xFF;
-		src_ip.s6_addr[12] = 0xFE;
-
-		break;
-	case NET_6LO_IPHC_SAM_11:
-		NET_DBG("SAM_11 generate src addr from ll");
-
-		net_ipv6_addr_create_iid(&src_ip, net_pkt_lladdr_src(pkt));
-
-		break;
-	}
+/* Unicast address modes, indexed by SAM or DAM. The inlined bytes are the
+ * trailing bytes of the address, the leading 64 bits are the link-local or
+ * the context prefix.
+ */
+#define ADDR_MODE_LL 3
 
-	net_ipv6_addr_copy_raw(ipv6->src, (uint8_t *)&src_ip);
+static const uint8_t ll_prefix[8] = { 0xFE, 0x80 };
 
-	return cursor;
-}
+/* Multicast address modes, indexed by DAM. The inlined bytes are the
+ * trailing bytes of the address, optionally preceded by the second
+ * address byte (flags and scope).
+ */
+static const struct {
+	uint8_t len;
+	bool scope_inline;
+} mcast_mode_table[] = {
+	{ 16, false },	/* DAM_00: ffXX:XXXX:XXXX:XXXX:XXXX:XXXX:XXXX:XXXX */
+	{ 5, true },	/* DAM_01: ffXX::00XX:XXXX:XXXX */
+	{ 3, true },	/* DAM_10: ffXX::00XX:XXXX */
+	{ 1, false },	/* DAM_11: ff02::00XX */
+};
 
-#if defined(CONFIG_NET_6LO_CONTEXT)
-static inline uint8_t *uncompress_sa_ctx(uint16_t iphc, uint8_t *cursor,
-				     struct net_ipv6_hdr *ipv6,
-				     struct net_6lo_context *ctx,
-				     struct net_pkt *pkt)
+/* Helper to uncompress unicast Source or Destination Address */
+static inline uint8_t *uncompress_addr(uint8_t mode, uint8_t *cursor,
+				       uint8_t *addr, const uint8_t *prefix,
+				       struct net_linkaddr *lladdr)
 {
-	struct in6_addr src_ip;
-
-	net_ipv6_addr_copy_raw((uint8_t *)&src_ip, ipv6->src);
-
-	switch (iphc & NET_6LO_IPHC_SAM_MASK) {
-	case NET_6LO_IPHC_SAM_01:
-		NET_DBG("SAM_01 last 64 bits are inlined");
+	struct in6_addr ip;
+	uint8_t len = sa_inline_size_table[mode];
 
-		/* First 8 bytes are from context */
-		memmove(&src_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
+	NET_DBG("AM_%u %u bytes inlined", mode, len);
 
-		/* And the rest are carried in-line*/
-		memmove(&src_ip.s6_addr[8], cursor, 8);
-		cursor += 8U;
-
-		break;
-	case NET_6LO_IPHC_SAM_10:
-		NET_DBG("SAM_10 src addr 16 bit compressed");
-
-		/* 16 bit carried in-line */
-		memmove(&src_ip.s6_addr[14], cursor, 2);
-		cursor += 2U;
-
-		/* First 8 bytes are from context */
-		memmove(&src_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
-
-		src_ip.s6_addr32[2] = 0x00;
-		src_ip.s6_addr16[6] = 0x00;
-		src_ip.s6_addr[11] = 0xFF;
-		src_ip.s6_addr[12] = 0xFE;
+	if (mode == ADDR_MODE_LL) {
+		net_ipv6_addr_create_iid(&ip, lladdr);
+	} else {
+		memset(&ip, 0, sizeof(ip));
 
-		break;
-	case NET_6LO_IPHC_SAM_11:
-		NET_DBG("SAM_11 generate src addr from ll");
+		if (mode == (NET_6LO_IPHC_SAM_10 >> NET_6LO_IPHC_SAM_POS)) {
+			/* 0000:00ff:fe00:XXXX */
+			ip.s6_addr[11] = 0xFF;
+			ip.s6_addr[12] = 0xFE;
+		}
 
-		/* RFC 6282, 3.1.1. If SAC = 1 and SAM = 11
-		 * Derive addr using context information and
-		 * the encapsulating header.
-		 * (e.g., 802.15.4 or IPv6 source address).
-		 */
-		net_ipv6_addr_create_iid(&src_ip, net_pkt_lladdr_src(pkt));
+		memmove(&ip.s6_addr[sizeof(ip) - len], cursor, len);
+		cursor += len;
+	}
 
-		/* net_ipv6_addr_create_iid will copy first 8 bytes
-		 * as link local prefix.
-		 * Overwrite first 8 bytes from context prefix here.
-		 */
-		memmove(&src_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
-		break;
+	if (len < sizeof(ip)) {
+		memmove(&ip.s6_addr[0], prefix, 8);
 	}
 
-	net_ipv6_addr_copy_raw(ipv6->src, (uint8_t *)&src_ip);
+	net_ipv6_addr_copy_raw(addr, (uint8_t *)&ip);
 
 	return cursor;
 }
-#endif
 
-/* Helpers to uncompress Destination Address */
+/* Helper to uncompress multicast Destination Address */
 static inline uint8_t *uncompress_da_mcast(uint16_t iphc, uint8_t *cursor,
-				       struct net_ipv6_hdr *ipv6)
+					   struct net_ipv6_hdr *ipv6)
 {
+	uint8_t mode = (iphc & NET_6LO_IPHC_DAM_MASK) >> NET_6LO_IPHC_DAM_POS;
+	uint8_t len = mcast_mode_table[mode].len;
 	struct in6_addr dst_ip;
 
-	NET_DBG("Dst is multicast");
+	NET_DBG("DAM_%u multicast, %u bytes inlined", mode, len);
 
-	net_ipv6_addr_copy_raw((uint8_t *)&dst_ip, ipv6->dst);
-
-	if (iphc & NET_6LO_IPHC_DAC_1) {
-		NET_WARN("Unsupported DAM options");
-		return 0;
-	}
-
-	/* If M=1 and DAC=0:
-	 * 00: 128 bits, The full address is carried in-line.
-	 * 01:  48 bits, The address takes the form ffXX::00XX:XXXX:XXXX.
-	 * 10:  32 bits, The address takes the form ffXX::00XX:XXXX.
-	 * 11:   8 bits, The address takes the form ff02::00XX.
-	 */
-
-	switch (iphc & NET_6LO_IPHC_DAM_MASK) {
-	case NET_6LO_IPHC_DAM_00:
-		NET_DBG("DAM_00 full dst addr inlined");
-
-		memmove(&dst_ip.s6_addr[0], cursor,
-			sizeof(dst_ip.s6_addr));
-
-		cursor += sizeof(dst_ip.s6_addr);
-		break;
-	case NET_6LO_IPHC_DAM_01:
-		NET_DBG("DAM_01 2nd byte and last five bytes");
-
-		dst_ip.s6_addr[1] = *cursor;
-		cursor++;
-		memmove(&dst_ip.s6_addr[11], cursor, 5);
-		cursor += 5U;
-
-
-		dst_ip.s6_addr[0] = 0xFF;
-		dst_ip.s6_addr16[1] = 0x00;
-		dst_ip.s6_addr32[1] = 0x00;
-		dst_ip.s6_addr[10] = 0x00;
-		dst_ip.s6_addr16[4] = 0x00;
-
-		break;
-	case NET_6LO_IPHC_DAM_10:
-		NET_DBG("DAM_10 2nd byte and last three bytes");
+	memset(&dst_ip, 0, sizeof(dst_ip));
+	dst_ip.s6_addr[0] = 0xFF;
+	dst_ip.s6_addr[1] = 0x02;
 
+	if (mcast_mode_table[mode].scope_inline) {
 		dst_ip.s6_addr[1] = *cursor;
 		cursor++;
-		memmove(&dst_ip.s6_addr[13], cursor, 3);
-		cursor += 3U;
-
-		dst_ip.s6_addr[0] = 0xFF;
-		dst_ip.s6_addr16[1] = 0x00;
-		dst_ip.s6_addr32[1] = 0x00;
-		dst_ip.s6_addr32[2] = 0x00;
-		dst_ip.s6_addr[12] = 0x00;
-
-		break;
-	case NET_6LO_IPHC_DAM_11:
-		NET_DBG("DAM_11 8 bit compressed");
-
-		dst_ip.s6_addr[15] = *cursor;
-		cursor++;
-		dst_ip.s6_addr[14] = 0x00;
-
-		dst_ip.s6_addr32[0] = 0x00;
-		dst_ip.s6_addr32[1] = 0x00;
-		dst_ip.s6_addr32[2] = 0x00;
-		dst_ip.s6_addr16[6] = 0x00;
-		dst_ip.s6_addr[0] = 0xFF;
-		dst_ip.s6_addr[1] = 0x02;
-
-		break;
 	}
 
-	net_ipv6_addr_copy_raw(ipv6->dst, (uint8_t *)&dst_ip);
-
-	return cursor;
-}
-
-/* Helper to uncompress Destination Address */
-static inline uint8_t *uncompress_da(uint16_t iphc, uint8_t *cursor,
-				 struct net_ipv6_hdr *ipv6,
-				 struct net_pkt *pkt)
-{
-	struct in6_addr dst_ip;
-
-	NET_DBG("DAC_0");
-
-	net_ipv6_addr_copy_raw((uint8_t *)&dst_ip, ipv6->dst);
-
-	switch (iphc & NET_6LO_IPHC_DAM_MASK) {
-	case NET_6LO_IPHC_DAM_00:
-		NET_DBG("DAM_00 full dst addr inlined");
-
-		memmove(&dst_ip.s6_addr[0], cursor,
-			sizeof(dst_ip.s6_addr));
-		cursor += sizeof(dst_ip.s6_addr);
-
-		break;
-	case NET_6LO_IPHC_DAM_01:
-		NET_DBG("DAM_01 last 64 bits are inlined");
-
-		memmove(&dst_ip.s6_addr[8], cursor, 8);
-		cursor += 8U;
-
-		dst_ip.s6_addr32[0] = 0x00;
-		dst_ip.s6_addr32[1] = 0x00;
-		dst_ip.s6_addr[0] = 0xFE;
-		dst_ip.s6_addr[1] = 0x80;
-
-		break;
-	case NET_6LO_IPHC_DAM_10:
-		NET_DBG("DAM_10 dst addr 16 bit compressed");
-
-		memmove(&dst_ip.s6_addr[14], cursor, 2);
-		cursor += 2U;
-
-		dst_ip.s6_addr32[0] = 0x00;
-		dst_ip.s6_addr32[1] = 0x00;
-		dst_ip.s6_addr32[2] = 0x00;
-		dst_ip.s6_addr16[6] = 0x00;
-		dst_ip.s6_addr[0] = 0xFE;
-		dst_ip.s6_addr[1] = 0x80;
-		dst_ip.s6_addr[11] = 0xFF;
-		dst_ip.s6_addr[12] = 0xFE;
-
-		break;
-	case NET_6LO_IPHC_DAM_11:
-		NET_DBG("DAM_11 generate dst addr from ll");
-
-		net_ipv6_addr_create_iid(&dst_ip, net_pkt_lladdr_dst(pkt));
-
-		break;
-	}
+	memmove(&dst_ip.s6_addr[sizeof(dst_ip) - len], cursor, len);
+	cursor += len;
 
 	net_ipv6_addr_copy_raw(ipv6->dst, (uint8_t *)&dst_ip);
 
 	return cursor;
 }
 
-#if defined(CONFIG_NET_6LO_CONTEXT)
-static inline uint8_t *uncompress_da_ctx(uint16_t iphc, uint8_t *cursor,
-				     struct net_ipv6_hdr *ipv6,
-				     struct net_6lo_context *ctx,
-				     struct net_pkt *pkt)
-{
-	struct in6_addr dst_ip;
-
-	NET_DBG("DAC_1");
-
-	net_ipv6_addr_copy_raw((uint8_t *)&dst_ip, ipv6->dst);
-
-	switch (iphc & NET_6LO_IPHC_DAM_MASK) {
-	case NET_6LO_IPHC_DAM_01:
-		NET_DBG("DAM_01 last 64 bits are inlined");
-
-		/* Last 8 bytes carried in-line */
-		memmove(&dst_ip.s6_addr[8], cursor, 8);
-		cursor += 8U;
-
-		/* First 8 bytes are from context */
-		memmove(&dst_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
-
-		break;
-	case NET_6LO_IPHC_DAM_10:
-		NET_DBG("DAM_10 src addr 16 bit compressed");
-
-		/* 16 bit carried in-line */
-		memmove(&dst_ip.s6_addr[14], cursor, 2);
-		cursor += 2U;
-
-		/* First 8 bytes are from context */
-		memmove(&dst_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
-
-		dst_ip.s6_addr32[2] = 0x00;
-		dst_ip.s6_addr16[6] = 0x00;
-		dst_ip.s6_addr[11] = 0xFF;
-		dst_ip.s6_addr[12] = 0xFE;
-
-		break;
-	case NET_6LO_IPHC_DAM_11:
-		NET_DBG("DAM_11 generate src addr from ll");
-
-		/* RFC 6282, 3.1.1. If SAC = 1 and SAM = 11
-		 * Derive addr using context information and
-		 * the encapsulating header.
-		 * (e.g., 802.15.4 or IPv6 source address).
-		 */
-		net_ipv6_addr_create_iid(&dst_ip, net_pkt_lladdr_dst(pkt));
-
-		/* net_ipv6_addr_create_iid will copy first 8 bytes
-		 * as link local prefix.
-		 * Overwrite first 8 bytes from context prefix here.
-		 */
-		memmove(&dst_ip.s6_addr[0], &ctx->prefix.s6_addr[0], 8);
-
-		break;
-	}
-
-	net_ipv6_addr_copy_raw(ipv6->dst, (uint8_t *)&dst_ip);
-
-	return cursor;
-}
-#endif
-
 /* Helper to uncompress NH UDP */
 static uint8_t *uncompress_nh_udp(uint8_t nhc, uint8_t *cursor,
 				      struct net_udp_hdr *udp)
@@ -1353,6 +1272,8 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 	struct net_ipv6_hdr *ipv6;
 	uint16_t len;
 	uint16_t iphc;
+	uint8_t sam;
+	uint8_t dam;
 	int inline_size, compressed_hdr_size;
 	size_t diff;
 	uint8_t *cursor;
@@ -1362,6 +1283,8 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 #endif
 
 	iphc = ntohs(UNALIGNED_GET((uint16_t *)pkt->buffer->data));
+	sam = (iphc & NET_6LO_IPHC_SAM_MASK) >> NET_6LO_IPHC_SAM_POS;
+	dam = (iphc & NET_6LO_IPHC_DAM_MASK) >> NET_6LO_IPHC_DAM_POS;
 
 	inline_size = get_ihpc_inlined_size(iphc);
 	if (inline_size < 0) {
@@ -1453,14 +1376,17 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 				goto fail;
 			}
 
-			cursor = uncompress_sa_ctx(iphc, cursor, ipv6, src, pkt);
+			cursor = uncompress_addr(sam, cursor, ipv6->src,
+						 src->prefix.s6_addr,
+						 net_pkt_lladdr_src(pkt));
 #endif
 		} else {
 			NET_ERR("Context based uncompression not enabled");
 			goto fail;
 		}
 	} else {
-		cursor = uncompress_sa(iphc, cursor, ipv6, pkt);
+		cursor = uncompress_addr(sam, cursor, ipv6->src, ll_prefix,
+					 net_pkt_lladdr_src(pkt));
 	}
 
 	/* Uncompress Destination Address */
@@ -1476,19 +1402,27 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		}
 	} else {
 		if (iphc & NET_6LO_IPHC_DAC_1) {
+			if (dam == (NET_6LO_IPHC_DAM_00 >> NET_6LO_IPHC_DAM_POS)) {
+				NET_ERR("DAC_1 and DAM_00 is reserved");
+				goto fail;
+			}
+
 #if defined(CONFIG_NET_6LO_CONTEXT)
 			if (!dst) {
 				NET_ERR("Dst context doesn't exists");
 				goto fail;
 			}
 
-			cursor = uncompress_da_ctx(iphc, cursor, ipv6, dst, pkt);
+			cursor = uncompress_addr(dam, cursor, ipv6->dst,
+						 dst->prefix.s6_addr,
+						 net_pkt_lladdr_dst(pkt));
 #else
 			NET_ERR("Context based uncompression not enabled");
 			goto fail;
 #endif
 		} else {
-			cursor = uncompress_da(iphc, cursor, ipv6, pkt);
+			cursor = uncompress_addr(dam, cursor, ipv6->dst, ll_prefix,
+						 net_pkt_lladdr_dst(pkt));
 		}
 	}
 
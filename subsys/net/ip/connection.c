@@ -62,7 +62,34 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
-static sys_slist_t conn_used;
+
+/* The used connections are kept in hash buckets so that a received TCP or
+ * UDP packet is only matched against the connections that can accept it.
+ * Connections with a specified remote address and port and a local port
+ * are hashed by all three, connections with only a local port by that port.
+ * Everything else, like packet and CAN sockets, is in the wildcard list.
+ */
+#define CONN_HASH_SIZE		CONFIG_NET_CONN_HASH_SIZE
+#define CONN_LIST_REMOTE(_hash)	(_hash)
+#define CONN_LIST_LOCAL(_hash)	(CONN_HASH_SIZE + (_hash))
+#define CONN_LIST_WILDCARD	(2 * CONN_HASH_SIZE)
+#define CONN_LIST_COUNT		(CONN_LIST_WILDCARD + 1)
+
+static sys_slist_t conn_lists[CONN_LIST_COUNT];
+
+#define NET_CONN_REMOTE_SPEC (NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_REMOTE_PORT_SPEC)
+
+/* Iterator over the used connections of a set of lists */
+struct conn_iter {
+	/** Indexes of the lists to walk, NULL to walk all of them */
+	const uint16_t *lists;
+	/** Number of lists to walk */
+	int count;
+	/** Next list to walk */
+	int pos;
+	/** Current connection */
+	struct net_conn *conn;
+};
 
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
@@ -116,6 +143,108 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+static uint32_t conn_hash_bytes(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *ptr = data;
+
+	/* FNV-1a */
+	while (len--) {
+		hash ^= *ptr++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static uint16_t conn_hash_local(uint16_t proto, uint16_t local_port)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = conn_hash_bytes(hash, &proto, sizeof(proto));
+	hash = conn_hash_bytes(hash, &local_port, sizeof(local_port));
+
+	return hash % CONN_HASH_SIZE;
+}
+
+static uint16_t conn_hash_remote(uint16_t proto, const uint8_t *remote_addr,
+				 size_t addr_len, uint16_t remote_port,
+				 uint16_t local_port)
+{
+	uint32_t hash = 2166136261U;
+
+	hash = conn_hash_bytes(hash, &proto, sizeof(proto));
+	hash = conn_hash_bytes(hash, remote_addr, addr_len);
+	hash = conn_hash_bytes(hash, &remote_port, sizeof(remote_port));
+	hash = conn_hash_bytes(hash, &local_port, sizeof(local_port));
+
+	return hash % CONN_HASH_SIZE;
+}
+
+/* Ports are in network byte order */
+static void conn_get_lists(uint16_t proto, uint8_t family, const uint8_t *remote_addr,
+			   uint16_t remote_port, uint16_t local_port, uint16_t *lists)
+{
+	size_t addr_len = family == AF_INET6 ? sizeof(struct in6_addr) :
+					       sizeof(struct in_addr);
+
+	lists[0] = CONN_LIST_REMOTE(conn_hash_remote(proto, remote_addr, addr_len,
+						     remote_port, local_port));
+	lists[1] = CONN_LIST_LOCAL(conn_hash_local(proto, local_port));
+	lists[2] = CONN_LIST_WILDCARD;
+}
+
+static sys_slist_t *conn_get_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	const uint8_t *remote_addr;
+	uint16_t hash;
+
+	if ((conn->proto != IPPROTO_TCP && conn->proto != IPPROTO_UDP) ||
+	    (conn->family != AF_INET && conn->family != AF_INET6 &&
+	     conn->family != AF_UNSPEC) ||
+	    !(conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return &conn_lists[CONN_LIST_WILDCARD];
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_SPEC) != NET_CONN_REMOTE_SPEC) {
+		return &conn_lists[CONN_LIST_LOCAL(conn_hash_local(conn->proto, local_port))];
+	}
+
+	if (conn->remote_addr.sa_family == AF_INET6) {
+		remote_addr = (const uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr;
+		hash = conn_hash_remote(conn->proto, remote_addr, sizeof(struct in6_addr),
+					net_sin6(&conn->remote_addr)->sin6_port, local_port);
+	} else {
+		remote_addr = (const uint8_t *)&net_sin(&conn->remote_addr)->sin_addr;
+		hash = conn_hash_remote(conn->proto, remote_addr, sizeof(struct in_addr),
+					net_sin(&conn->remote_addr)->sin_port, local_port);
+	}
+
+	return &conn_lists[CONN_LIST_REMOTE(hash)];
+}
+
+static struct net_conn *conn_iter_next(struct conn_iter *iter)
+{
+	sys_snode_t *node = NULL;
+
+	if (iter->conn != NULL) {
+		node = sys_slist_peek_next(&iter->conn->node);
+	}
+
+	while (node == NULL && iter->pos < iter->count) {
+		int list = iter->lists != NULL ? iter->lists[iter->pos] : iter->pos;
+
+		node = sys_slist_peek_head(&conn_lists[list]);
+		iter->pos++;
+	}
+
+	iter->conn = node != NULL ? CONTAINER_OF(node, struct net_conn, node) : NULL;
+
+	return iter->conn;
+}
+
+#define CONN_ITER_ALL() { .lists = NULL, .count = CONN_LIST_COUNT }
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -140,7 +269,7 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_prepend(&conn_used, &conn->node);
+	sys_slist_prepend(conn_get_list(conn), &conn->node);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -162,12 +291,12 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 					  uint16_t local_port,
 					  bool reuseport_set)
 {
+	struct conn_iter iter = CONN_ITER_ALL();
 	struct net_conn *conn;
-	struct net_conn *tmp;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	for (conn = conn_iter_next(&iter); conn != NULL; conn = conn_iter_next(&iter)) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -451,7 +580,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_find_and_remove(&conn_used, &conn->node);
+	sys_slist_find_and_remove(conn_get_list(conn), &conn->node);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -476,9 +605,16 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
 	net_conn_change_callback(conn, cb, user_data);
 
+	/* A new remote end moves the connection to another hash bucket */
+	sys_slist_find_and_remove(conn_get_list(conn), &conn->node);
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	sys_slist_prepend(conn_get_list(conn), &conn->node);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -681,6 +817,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
 
+	struct conn_iter iter = CONN_ITER_ALL();
+	uint16_t lists[3];
 	struct net_conn *best_match = NULL;
 	int16_t best_rank = -1;
 	bool is_mcast_pkt = false;
@@ -708,9 +846,22 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+	/* A unicast TCP or UDP packet can only match the connections hashed
+	 * by its addresses and ports and the wildcard ones. A multicast
+	 * packet is delivered to every match, so all of them are checked.
+	 */
+	if (IS_ENABLED(CONFIG_NET_IP) && (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    (proto == IPPROTO_TCP || proto == IPPROTO_UDP) && !is_mcast_pkt) {
+		conn_get_lists(proto, pkt_family,
+			       pkt_family == AF_INET6 ? ip_hdr->ipv6->src : ip_hdr->ipv4->src,
+			       src_port, dst_port, lists);
+		iter.lists = lists;
+		iter.count = ARRAY_SIZE(lists);
+	}
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	for (conn = conn_iter_next(&iter); conn != NULL; conn = conn_iter_next(&iter)) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
 		    net_context_is_bound_to_iface(conn->context) &&
@@ -947,11 +1098,12 @@ drop:
 
 void net_conn_foreach(net_conn_foreach_cb_t cb, void *user_data)
 {
+	struct conn_iter iter = CONN_ITER_ALL();
 	struct net_conn *conn;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	for (conn = conn_iter_next(&iter); conn != NULL; conn = conn_iter_next(&iter)) {
 		cb(conn, user_data);
 	}
 
@@ -963,7 +1115,10 @@ void net_conn_init(void)
 	int i;
 
 	sys_slist_init(&conn_unused);
-	sys_slist_init(&conn_used);
+
+	for (i = 0; i < CONN_LIST_COUNT; i++) {
+		sys_slist_init(&conn_lists[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
@@ -317,6 +317,9 @@ static inline void net_ipv4_set_ecn(uint8_t *tos, uint8_t ecn)
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
 /** Store pending IPv4 fragment information that is needed for reassembly. */
 struct net_ipv4_reassembly {
+	/** Node in the hash bucket of the reassembly */
+	sys_snode_t node;
+
 	/** IPv4 source address of the fragment */
 	struct in_addr src;
 
@@ -329,12 +332,27 @@ struct net_ipv4_reassembly {
 	 */
 	struct k_work_delayable timer;
 
-	/** Pointers to pending fragments */
+	/** Pointers to pending fragments, sorted by offset */
 	struct net_pkt *pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT];
 
+	/** Bytes of the pending fragments */
+	size_t size;
+
+	/** Payload bytes received, the pending fragments never overlap */
+	uint32_t received;
+
+	/** Payload length of the packet, 0 until the last fragment is received */
+	uint32_t total;
+
 	/** IPv4 fragment identification */
 	uint16_t id;
 	uint8_t protocol;
+
+	/** Number of pending fragments */
+	uint16_t count;
+
+	/** Is this reassembly slot in use */
+	bool used;
 };
 #else
 struct net_ipv4_reassembly;
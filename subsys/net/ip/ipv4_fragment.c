@@ -30,84 +30,102 @@ LOG_MODULE_DECLARE(net_ipv4, CONFIG_NET_IPV4_LOG_LEVEL);
 static void reassembly_timeout(struct k_work *work);
 
 static struct net_ipv4_reassembly reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+static sys_slist_t reassembly_hash[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+static K_MUTEX_DEFINE(reassembly_lock);
+
+/* Bytes held by all the pending reassemblies */
+static size_t reassembly_size;
+
+static sys_slist_t *reassembly_bucket(uint16_t id, const struct in_addr *src,
+				      const struct in_addr *dst, uint8_t protocol)
+{
+	uint32_t hash = UNALIGNED_GET(&src->s_addr) ^ UNALIGNED_GET(&dst->s_addr) ^
+			((uint32_t)protocol << 16) ^ id;
+
+	/* Fibonacci hashing, consecutive identifiers land in different buckets */
+	hash *= 0x9e3779b1U;
+
+	return &reassembly_hash[(hash >> 16) % ARRAY_SIZE(reassembly_hash)];
+}
 
 static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
 						  struct in_addr *dst, uint8_t protocol)
 {
-	int i, avail = -1;
-
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv4_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv4_addr_cmp(dst, &reassembly[i].dst) &&
-		    reassembly[i].protocol == protocol) {
-			return &reassembly[i];
-		}
+	sys_slist_t *bucket = reassembly_bucket(id, src, dst, protocol);
+	struct net_ipv4_reassembly *reass;
+	int i;
 
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
-			continue;
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, node) {
+		if (reass->id == id &&
+		    net_ipv4_addr_cmp(src, &reass->src) &&
+		    net_ipv4_addr_cmp(dst, &reass->dst) &&
+		    reass->protocol == protocol) {
+			return reass;
 		}
+	}
 
-		if (avail < 0) {
-			avail = i;
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly[i].used) {
+			break;
 		}
 	}
 
-	if (avail < 0) {
+	if (i == CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT) {
 		return NULL;
 	}
 
-	k_work_reschedule(&reassembly[avail].timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
+	reass = &reassembly[i];
 
-	net_ipaddr_copy(&reassembly[avail].src, src);
-	net_ipaddr_copy(&reassembly[avail].dst, dst);
+	k_work_reschedule(&reass->timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
 
-	reassembly[avail].protocol = protocol;
-	reassembly[avail].id = id;
+	net_ipaddr_copy(&reass->src, src);
+	net_ipaddr_copy(&reass->dst, dst);
 
-	return &reassembly[avail];
-}
-
-static bool reassembly_cancel(uint32_t id, struct in_addr *src, struct in_addr *dst)
-{
-	int i, j;
+	reass->protocol = protocol;
+	reass->id = id;
+	reass->used = true;
 
-	LOG_DBG("Cancel 0x%x", id);
+	sys_slist_append(bucket, &reass->node);
 
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
-
-		if (reassembly[i].id != id ||
-		    !net_ipv4_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv4_addr_cmp(dst, &reassembly[i].dst)) {
-			continue;
-		}
+	return reass;
+}
 
-		remaining = k_ticks_to_ms_ceil32(
-			k_work_delayable_remaining_get(&reassembly[i].timer));
-		k_work_cancel_delayable(&reassembly[i].timer);
+static void reassembly_free(struct net_ipv4_reassembly *reass)
+{
+	int32_t remaining;
+	int i;
 
-		LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reassembly[i].id, remaining);
+	LOG_DBG("Cancel 0x%x", reass->id);
 
-		reassembly[i].id = 0U;
+	remaining = k_ticks_to_ms_ceil32(k_work_delayable_remaining_get(&reass->timer));
+	k_work_cancel_delayable(&reass->timer);
 
-		for (j = 0; j < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
-				continue;
-			}
+	LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reass->id, remaining);
 
-			LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", j,
-				reassembly[i].pkt[j], net_pkt_get_len(reassembly[i].pkt[j]));
+	sys_slist_find_and_remove(reassembly_bucket(reass->id, &reass->src, &reass->dst,
+						    reass->protocol),
+				  &reass->node);
 
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
+	for (i = 0; i < reass->count; i++) {
+		if (!reass->pkt[i]) {
+			continue;
 		}
 
-		return true;
+		LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", i, reass->pkt[i],
+			net_pkt_get_len(reass->pkt[i]));
+
+		net_pkt_unref(reass->pkt[i]);
+		reass->pkt[i] = NULL;
 	}
 
-	return false;
+	reassembly_size -= reass->size;
+
+	reass->size = 0U;
+	reass->received = 0U;
+	reass->total = 0U;
+	reass->count = 0U;
+	reass->id = 0U;
+	reass->used = false;
 }
 
 static void reassembly_info(char *str, struct net_ipv4_reassembly *reass)
@@ -125,15 +143,27 @@ static void reassembly_timeout(struct k_work *work)
 	struct net_ipv4_reassembly *reass =
 		CONTAINER_OF(dwork, struct net_ipv4_reassembly, timer);
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	/* The slot was freed, or reused for another packet, while the timeout
+	 * was waiting for the lock.
+	 */
+	if (!reass->used || k_work_delayable_remaining_get(&reass->timer) > 0) {
+		goto out;
+	}
+
 	reassembly_info("Reassembly cancelled", reass);
 
 	/* Send a ICMPv4 Time Exceeded only if we received the first fragment */
-	if (reass->pkt[0] && net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
+	if (reass->count > 0 && net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
 		net_icmpv4_send_error(reass->pkt[0], NET_ICMPV4_TIME_EXCEEDED,
 				      NET_ICMPV4_TIME_EXCEEDED_FRAGMENT_REASSEMBLY_TIME);
 	}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+	reassembly_free(reass);
+
+out:
+	k_mutex_unlock(&reassembly_lock);
 }
 
 static void reassemble_packet(struct net_ipv4_reassembly *reass)
@@ -151,18 +181,16 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
 	/* We start from 2nd packet which is then appended to the first one */
-	for (i = 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+	for (i = 1; i < reass->count; i++) {
 		pkt = reass->pkt[i];
-		if (!pkt) {
-			break;
-		}
 
 		net_pkt_cursor_init(pkt);
 
 		/* Get rid of IPv4 header which is at the beginning of the fragment. */
 		ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
 		if (!ipv4_hdr) {
-			goto error;
+			reassembly_free(reass);
+			return;
 		}
 
 		LOG_DBG("Removing %d bytes from start of pkt %p", net_pkt_ip_hdr_len(pkt),
@@ -170,7 +198,7 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 		if (net_pkt_pull(pkt, net_pkt_ip_hdr_len(pkt))) {
 			LOG_ERR("Failed to pull headers");
-			reassembly_cancel(reass->id, &reass->src, &reass->dst);
+			reassembly_free(reass);
 			return;
 		}
 
@@ -187,6 +215,8 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
 
+	reassembly_free(reass);
+
 	/* Update the header details for the packet */
 	net_pkt_cursor_init(pkt);
 
@@ -225,181 +255,186 @@ void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
 {
 	int i;
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
 	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		if (!k_work_delayable_remaining_get(&reassembly[i].timer)) {
+		if (!reassembly[i].used) {
 			continue;
 		}
 
 		cb(&reassembly[i], user_data);
 	}
+
+	k_mutex_unlock(&reassembly_lock);
 }
 
-/* Verify that we have all the fragments received and in correct order.
- * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
+/* Drop the oldest other reassemblies until len more bytes of fragments fit
+ * in CONFIG_NET_IPV4_FRAGMENT_MAX_SIZE.
  */
-static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+static bool reassembly_reserve(struct net_ipv4_reassembly *current, size_t len)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
+	while (reassembly_size + len > CONFIG_NET_IPV4_FRAGMENT_MAX_SIZE) {
+		struct net_ipv4_reassembly *oldest = NULL;
+		k_ticks_t oldest_remaining = 0;
+		int i;
 
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
+		for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+			struct net_ipv4_reassembly *reass = &reassembly[i];
+			k_ticks_t remaining;
 
-		if (!pkt) {
-			break;
-		}
+			if (!reass->used || reass == current) {
+				continue;
+			}
 
-		offset = net_pkt_ipv4_fragment_offset(pkt);
+			remaining = k_work_delayable_remaining_get(&reass->timer);
+			if (oldest == NULL || remaining < oldest_remaining) {
+				oldest = reass;
+				oldest_remaining = remaining;
+			}
+		}
 
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated, drop it */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
+		if (oldest == NULL) {
+			return false;
 		}
 
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+		reassembly_info("Reassembly evicted", oldest);
+		reassembly_free(oldest);
+	}
+
+	return true;
+}
+
+/* Insert the fragment at its place in the offset ordered list. The fragments
+ * must not overlap (RFC 5722 for IPv6, and a common attack vector for IPv4),
+ * so the received payload bytes tell when the packet is complete.
+ * Return:
+ * - a negative value if the fragment is erroneous and the packet must be dropped
+ * - zero if the fragment was stored
+ */
+static int fragment_insert(struct net_ipv4_reassembly *reass, struct net_pkt *pkt)
+{
+	uint32_t offset = net_pkt_ipv4_fragment_offset(pkt);
+	int len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+	uint32_t end = offset + len;
+	int lo = 0;
+	int hi = reass->count;
+
+	/* The reassembled packet must fit the 16 bit total length */
+	if (len <= 0 || end + net_pkt_ip_hdr_len(pkt) > UINT16_MAX) {
+		return -EBADMSG;
+	}
 
-		if (payload_len < 0) {
+	if (!net_pkt_ipv4_fragment_more(pkt)) {
+		/* The last fragment tells the length of the packet */
+		if (reass->total != 0U && reass->total != end) {
 			return -EBADMSG;
 		}
 
-		expected_offset += payload_len;
-		more = net_pkt_ipv4_fragment_more(pkt);
+		reass->total = end;
 	}
 
-	if (more) {
-		return 0;
+	if (reass->total != 0U && end > reass->total) {
+		return -EBADMSG;
 	}
 
-	return 1;
-}
+	if (reass->count == CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
 
-static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
-{
-	int i;
+	/* Find the first fragment starting after this one */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
 
-	for (i = pos + 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (!reass->pkt[i]) {
-			LOG_DBG("Moving [%d] %p (offset 0x%x) to [%d]", pos, reass->pkt[pos],
-				net_pkt_ipv4_fragment_offset(reass->pkt[pos]), pos + 1);
-
-			/* pkt[i] is free, so shift everything between [pos] and [i - 1] by one
-			 * element
-			 */
-			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
-				sizeof(void *) * (i - pos));
+		if (net_pkt_ipv4_fragment_offset(reass->pkt[mid]) <= offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
 
-			/* pkt[pos] is now free */
-			reass->pkt[pos] = NULL;
+	if (lo > 0) {
+		struct net_pkt *prev = reass->pkt[lo - 1];
 
-			return 0;
+		if (net_pkt_ipv4_fragment_offset(prev) + net_pkt_get_len(prev) -
+		    net_pkt_ip_hdr_len(prev) > offset) {
+			return -EBADMSG;
 		}
 	}
 
-	/* We do not have free space left in the array */
-	return -ENOMEM;
+	if (lo < reass->count && end > net_pkt_ipv4_fragment_offset(reass->pkt[lo])) {
+		return -EBADMSG;
+	}
+
+	LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, lo, offset);
+
+	memmove(&reass->pkt[lo + 1], &reass->pkt[lo],
+		sizeof(void *) * (reass->count - lo));
+	reass->pkt[lo] = pkt;
+	reass->count++;
+	reass->received += len;
+
+	return 0;
 }
 
 enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
 {
-	struct net_ipv4_reassembly *reass = NULL;
+	struct net_ipv4_reassembly *reass;
+	enum net_verdict verdict = NET_OK;
+	size_t len = net_pkt_get_len(pkt);
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint16_t id;
 	int ret;
-	int i;
 
 	flag = ntohs(*((uint16_t *)&hdr->offset));
 	id = ntohs(*((uint16_t *)&hdr->id));
 
-	reass = reassembly_get(id, (struct in_addr *)hdr->src,
-			       (struct in_addr *)hdr->dst, hdr->proto);
-	if (!reass) {
-		LOG_ERR("Cannot get reassembly slot, dropping pkt %p", pkt);
-		goto drop;
-	}
-
 	more = (flag & NET_IPV4_MORE_FRAG_MASK) ? true : false;
 	net_pkt_set_ipv4_fragment_flags(pkt, flag);
 
-	if (more && (net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt)) % 8) {
+	if (more && (len - net_pkt_ip_hdr_len(pkt)) % 8) {
 		/* Fragment length is not multiple of 8, discard the packet and send bad IP
 		 * header error.
 		 */
 		net_icmpv4_send_error(pkt, NET_ICMPV4_BAD_IP_HEADER,
 				      NET_ICMPV4_BAD_IP_HEADER_LENGTH);
-		goto drop;
+		return NET_DROP;
 	}
 
-	/* The fragments might come in wrong order so place them in the reassembly chain in the
-	 * correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv4_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room then it will discard
-			 * the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, i,
-			net_pkt_ipv4_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
 
-		break;
+	reass = reassembly_get(id, (struct in_addr *)hdr->src,
+			       (struct in_addr *)hdr->dst, hdr->proto);
+	if (!reass) {
+		LOG_ERR("Cannot get reassembly slot, dropping pkt %p", pkt);
+		verdict = NET_DROP;
+		goto out;
 	}
 
-	if (!found) {
-		/* We could not add this fragment into our saved fragment list. The whole packet
-		 * must be discarded at this point.
-		 */
-		LOG_ERR("No slots available for 0x%x", reass->id);
-		net_pkt_unref(pkt);
-		goto drop;
+	if (CONFIG_NET_IPV4_FRAGMENT_MAX_SIZE > 0 && !reassembly_reserve(reass, len)) {
+		ret = -ENOMEM;
+	} else {
+		ret = fragment_insert(reass, pkt);
 	}
 
-	ret = fragments_are_ready(reass);
 	if (ret < 0) {
-		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
+		/* We could not add this fragment into our saved fragment list. The whole
+		 * packet must be discarded at this point.
+		 */
+		LOG_ERR("Cannot store fragment of 0x%x (%d), dropping it", reass->id, ret);
+		reassembly_free(reass);
+		verdict = NET_DROP;
+		goto out;
+	}
 
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
+	reass->size += len;
+	reassembly_size += len;
 
-		net_pkt_unref(pkt);
-		goto drop;
-	} else if (ret == 0) {
+	if (reass->total == 0U || reass->received < reass->total) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		LOG_DBG("More fragments to be received");
-		goto accept;
+		goto out;
 	}
 
 	reassembly_info("Reassembly last pkt", reass);
@@ -407,17 +442,10 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 	/* The last fragment received, reassemble the packet */
 	reassemble_packet(reass);
 
-accept:
-	return NET_OK;
-
-drop:
-	if (reass) {
-		if (reassembly_cancel(reass->id, &reass->src, &reass->dst)) {
-			return NET_OK;
-		}
-	}
+out:
+	k_mutex_unlock(&reassembly_lock);
 
-	return NET_DROP;
+	return verdict;
 }
 
 static int send_ipv4_fragment(struct net_pkt *pkt, uint16_t rand_id, uint16_t fit_len,
@@ -621,9 +649,9 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 	/* If we have already fragmented the packet, the ID field will contain a non-zero value
-	 * and we can skip other checks.
+	 * and we can skip other checks. Large TCP sends are split into segments by the L2.
 	 */
-	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0) {
+	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0 && net_pkt_gso_size(pkt) == 0) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -424,6 +424,9 @@ static inline void net_ipv6_nbr_set_reachable_timer(struct net_if *iface,
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 /** Store pending IPv6 fragment information that is needed for reassembly. */
 struct net_ipv6_reassembly {
+	/** Node in the hash bucket of the reassembly */
+	sys_snode_t node;
+
 	/** IPv6 source address of the fragment */
 	struct in6_addr src;
 
@@ -436,11 +439,26 @@ struct net_ipv6_reassembly {
 	 */
 	struct k_work_delayable timer;
 
-	/** Pointers to pending fragments */
+	/** Pointers to pending fragments, sorted by offset */
 	struct net_pkt *pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT];
 
+	/** Bytes of the pending fragments */
+	size_t size;
+
+	/** Payload bytes received, the pending fragments never overlap */
+	uint32_t received;
+
+	/** Payload length of the packet, 0 until the last fragment is received */
+	uint32_t total;
+
 	/** IPv6 fragment identification */
 	uint32_t id;
+
+	/** Number of pending fragments */
+	uint16_t count;
+
+	/** Is this reassembly slot in use */
+	bool used;
 };
 #else
 struct net_ipv6_reassembly;
@@ -45,6 +45,11 @@ static bool reassembly_init_done;
 
 static struct net_ipv6_reassembly
 reassembly[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
+static sys_slist_t reassembly_hash[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
+static K_MUTEX_DEFINE(reassembly_lock);
+
+/* Bytes held by all the pending reassemblies */
+static size_t reassembly_size;
 
 int net_ipv6_find_last_ext_hdr(struct net_pkt *pkt, uint16_t *next_hdr_off,
 			       uint16_t *last_hdr_off)
@@ -120,86 +125,101 @@ fail:
 	return -EINVAL;
 }
 
+static sys_slist_t *reassembly_bucket(uint32_t id, const struct in6_addr *src,
+				      const struct in6_addr *dst)
+{
+	uint32_t hash = id;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash ^= UNALIGNED_GET(&src->s6_addr32[i]) ^ UNALIGNED_GET(&dst->s6_addr32[i]);
+	}
+
+	/* Fibonacci hashing, consecutive identifiers land in different buckets */
+	hash *= 0x9e3779b1U;
+
+	return &reassembly_hash[(hash >> 16) % ARRAY_SIZE(reassembly_hash)];
+}
+
 static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 						  struct in6_addr *src,
 						  struct in6_addr *dst)
 {
-	int i, avail = -1;
-
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv6_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			return &reassembly[i];
-		}
+	sys_slist_t *bucket = reassembly_bucket(id, src, dst);
+	struct net_ipv6_reassembly *reass;
+	int i;
 
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
-			continue;
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, node) {
+		if (reass->id == id &&
+		    net_ipv6_addr_cmp(src, &reass->src) &&
+		    net_ipv6_addr_cmp(dst, &reass->dst)) {
+			return reass;
 		}
+	}
 
-		if (avail < 0) {
-			avail = i;
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly[i].used) {
+			break;
 		}
 	}
 
-	if (avail < 0) {
+	if (i == CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT) {
 		return NULL;
 	}
 
-	k_work_reschedule(&reassembly[avail].timer, IPV6_REASSEMBLY_TIMEOUT);
+	reass = &reassembly[i];
 
-	net_ipaddr_copy(&reassembly[avail].src, src);
-	net_ipaddr_copy(&reassembly[avail].dst, dst);
+	k_work_reschedule(&reass->timer, IPV6_REASSEMBLY_TIMEOUT);
 
-	reassembly[avail].id = id;
+	net_ipaddr_copy(&reass->src, src);
+	net_ipaddr_copy(&reass->dst, dst);
 
-	return &reassembly[avail];
-}
+	reass->id = id;
+	reass->used = true;
 
-static bool reassembly_cancel(uint32_t id,
-			      struct in6_addr *src,
-			      struct in6_addr *dst)
-{
-	int i, j;
+	sys_slist_append(bucket, &reass->node);
 
-	NET_DBG("Cancel 0x%x", id);
-
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
+	return reass;
+}
 
-		if (reassembly[i].id != id ||
-		    !net_ipv6_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			continue;
-		}
+static void reassembly_free(struct net_ipv6_reassembly *reass)
+{
+	int32_t remaining;
+	int i;
 
-		remaining = k_ticks_to_ms_ceil32(
-			k_work_delayable_remaining_get(&reassembly[i].timer));
-		k_work_cancel_delayable(&reassembly[i].timer);
+	NET_DBG("Cancel 0x%x", reass->id);
 
-		NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
-			reassembly[i].id, remaining);
+	remaining = k_ticks_to_ms_ceil32(
+		k_work_delayable_remaining_get(&reass->timer));
+	k_work_cancel_delayable(&reass->timer);
 
-		reassembly[i].id = 0U;
+	NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
+		reass->id, remaining);
 
-		for (j = 0; j < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
-				continue;
-			}
+	sys_slist_find_and_remove(reassembly_bucket(reass->id, &reass->src,
+						    &reass->dst),
+				  &reass->node);
 
-			NET_DBG("[%d] IPv6 reassembly pkt %p %zd bytes data",
-				j, reassembly[i].pkt[j],
-				net_pkt_get_len(reassembly[i].pkt[j]));
-
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
+	for (i = 0; i < reass->count; i++) {
+		if (!reass->pkt[i]) {
+			continue;
 		}
 
-		return true;
+		NET_DBG("[%d] IPv6 reassembly pkt %p %zd bytes data",
+			i, reass->pkt[i], net_pkt_get_len(reass->pkt[i]));
+
+		net_pkt_unref(reass->pkt[i]);
+		reass->pkt[i] = NULL;
 	}
 
-	return false;
+	reassembly_size -= reass->size;
+
+	reass->size = 0U;
+	reass->received = 0U;
+	reass->total = 0U;
+	reass->count = 0U;
+	reass->id = 0U;
+	reass->used = false;
 }
 
 static void reassembly_info(char *str, struct net_ipv6_reassembly *reass)
@@ -217,14 +237,26 @@ static void reassembly_timeout(struct k_work *work)
 	struct net_ipv6_reassembly *reass =
 		CONTAINER_OF(dwork, struct net_ipv6_reassembly, timer);
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	/* The slot was freed, or reused for another packet, while the timeout
+	 * was waiting for the lock.
+	 */
+	if (!reass->used || k_work_delayable_remaining_get(&reass->timer) > 0) {
+		goto out;
+	}
+
 	reassembly_info("Reassembly cancelled", reass);
 
 	/* Send a ICMPv6 Time Exceeded only if we received the first fragment (RFC 2460 Sec. 5) */
-	if (reass->pkt[0] && net_pkt_ipv6_fragment_offset(reass->pkt[0]) == 0) {
+	if (reass->count > 0 && net_pkt_ipv6_fragment_offset(reass->pkt[0]) == 0) {
 		net_icmpv6_send_error(reass->pkt[0], NET_ICMPV6_TIME_EXCEEDED, 1, 0);
 	}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+	reassembly_free(reass);
+
+out:
+	k_mutex_unlock(&reassembly_lock);
 }
 
 static void reassemble_packet(struct net_ipv6_reassembly *reass)
@@ -250,13 +282,10 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	/* We start from 2nd packet which is then appended to
 	 * the first one.
 	 */
-	for (i = 1; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
+	for (i = 1; i < reass->count; i++) {
 		int removed_len;
 
 		pkt = reass->pkt[i];
-		if (!pkt) {
-			break;
-		}
 
 		net_pkt_cursor_init(pkt);
 
@@ -271,7 +300,7 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 
 		if (net_pkt_pull(pkt, removed_len)) {
 			NET_ERR("Failed to pull headers");
-			reassembly_cancel(reass->id, &reass->src, &reass->dst);
+			reassembly_free(reass);
 			return;
 		}
 
@@ -288,6 +317,8 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
 
+	reassembly_free(reass);
+
 	/* Next we need to strip away the fragment header from the first packet
 	 * and set the various pointers and values in packet.
 	 */
@@ -360,115 +391,152 @@ void net_ipv6_frag_foreach(net_ipv6_frag_cb_t cb, void *user_data)
 {
 	int i;
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
 	for (i = 0; reassembly_init_done &&
 		     i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		if (!k_work_delayable_remaining_get(&reassembly[i].timer)) {
+		if (!reassembly[i].used) {
 			continue;
 		}
 
 		cb(&reassembly[i], user_data);
 	}
+
+	k_mutex_unlock(&reassembly_lock);
 }
 
-/* Verify that we have all the fragments received and in correct order.
- * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
+static int fragment_payload_len(struct net_pkt *pkt)
+{
+	return net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt) -
+	       sizeof(struct net_ipv6_frag_hdr);
+}
+
+/* Drop the oldest other reassemblies until len more bytes of fragments fit
+ * in CONFIG_NET_IPV6_FRAGMENT_MAX_SIZE.
  */
-static int fragments_are_ready(struct net_ipv6_reassembly *reass)
+static bool reassembly_reserve(struct net_ipv6_reassembly *current, size_t len)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
+	while (reassembly_size + len > CONFIG_NET_IPV6_FRAGMENT_MAX_SIZE) {
+		struct net_ipv6_reassembly *oldest = NULL;
+		k_ticks_t oldest_remaining = 0;
+		int i;
 
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
+		for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+			struct net_ipv6_reassembly *reass = &reassembly[i];
+			k_ticks_t remaining;
 
-		if (!pkt) {
-			break;
-		}
+			if (!reass->used || reass == current) {
+				continue;
+			}
 
-		offset = net_pkt_ipv6_fragment_offset(pkt);
+			remaining = k_work_delayable_remaining_get(&reass->timer);
+			if (oldest == NULL || remaining < oldest_remaining) {
+				oldest = reass;
+				oldest_remaining = remaining;
+			}
+		}
 
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated
-			 * According to RFC8200 we can drop it
-			 */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
+		if (oldest == NULL) {
+			return false;
 		}
 
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ipv6_fragment_start(pkt);
-		payload_len -= sizeof(struct net_ipv6_frag_hdr);
-		if (payload_len < 0) {
+		reassembly_info("Reassembly evicted", oldest);
+		reassembly_free(oldest);
+	}
+
+	return true;
+}
+
+/* Insert the fragment at its place in the offset ordered list. Overlapping
+ * fragments make the whole packet invalid (RFC 8200 ch 4.5), so the received
+ * payload bytes tell when the packet is complete.
+ * Return:
+ * - a negative value if the fragment is erroneous and the packet must be dropped
+ * - zero if the fragment was stored
+ */
+static int fragment_insert(struct net_ipv6_reassembly *reass,
+			   struct net_pkt *pkt)
+{
+	uint32_t offset = net_pkt_ipv6_fragment_offset(pkt);
+	int len = fragment_payload_len(pkt);
+	uint32_t end = offset + len;
+	int lo = 0;
+	int hi = reass->count;
+
+	/* The reassembled packet must fit the 16 bit payload length */
+	if (len <= 0 || end + net_pkt_ipv6_fragment_start(pkt) -
+			NET_IPV6H_LEN > UINT16_MAX) {
+		return -EBADMSG;
+	}
+
+	if (!net_pkt_ipv6_fragment_more(pkt)) {
+		/* The last fragment tells the length of the packet */
+		if (reass->total != 0U && reass->total != end) {
 			return -EBADMSG;
 		}
 
-		expected_offset += payload_len;
-		more = net_pkt_ipv6_fragment_more(pkt);
+		reass->total = end;
 	}
 
-	if (more) {
-		return 0;
+	if (reass->total != 0U && end > reass->total) {
+		return -EBADMSG;
 	}
 
-	return 1;
-}
-
-static int shift_packets(struct net_ipv6_reassembly *reass, int pos)
-{
-	int i;
+	if (reass->count == CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
 
-	for (i = pos + 1; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		if (!reass->pkt[i]) {
-			NET_DBG("Moving [%d] %p (offset 0x%x) to [%d]",
-				pos, reass->pkt[pos],
-				net_pkt_ipv6_fragment_offset(reass->pkt[pos]),
-				pos + 1);
+	/* Find the first fragment starting after this one */
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
 
-			/* pkt[i] is free, so shift everything between
-			 * [pos] and [i - 1] by one element
-			 */
-			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
-				sizeof(void *) * (i - pos));
+		if (net_pkt_ipv6_fragment_offset(reass->pkt[mid]) <= offset) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
 
-			/* pkt[pos] is now free */
-			reass->pkt[pos] = NULL;
+	if (lo > 0) {
+		struct net_pkt *prev = reass->pkt[lo - 1];
 
-			return 0;
+		if (net_pkt_ipv6_fragment_offset(prev) +
+		    fragment_payload_len(prev) > offset) {
+			return -EBADMSG;
 		}
 	}
 
-	/* We do not have free space left in the array */
-	return -ENOMEM;
+	if (lo < reass->count &&
+	    end > net_pkt_ipv6_fragment_offset(reass->pkt[lo])) {
+		return -EBADMSG;
+	}
+
+	NET_DBG("Storing pkt %p to slot %d offset %d", pkt, lo, offset);
+
+	memmove(&reass->pkt[lo + 1], &reass->pkt[lo],
+		sizeof(void *) * (reass->count - lo));
+	reass->pkt[lo] = pkt;
+	reass->count++;
+	reass->received += len;
+
+	return 0;
 }
 
 enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 					      struct net_ipv6_hdr *hdr,
 					      uint8_t nexthdr)
 {
-	struct net_ipv6_reassembly *reass = NULL;
+	struct net_ipv6_reassembly *reass;
+	enum net_verdict verdict = NET_OK;
+	size_t len = net_pkt_get_len(pkt);
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint32_t id;
 	int ret;
 	int i;
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
 	if (!reassembly_init_done) {
 		/* Static initializing does not work here because of the array
 		 * so we must do it at runtime.
@@ -489,81 +557,58 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 	if (net_pkt_skip(pkt, 1) || /* reserved */
 	    net_pkt_read_be16(pkt, &flag) ||
 	    net_pkt_read_be32(pkt, &id)) {
-		goto drop;
-	}
-
-	reass = reassembly_get(id, (struct in6_addr *)hdr->src,
-			       (struct in6_addr *)hdr->dst);
-	if (!reass) {
-		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
-		goto drop;
+		verdict = NET_DROP;
+		goto out;
 	}
 
 	more = flag & 0x01;
 	net_pkt_set_ipv6_fragment_flags(pkt, flag);
 
-	if (more && net_pkt_get_len(pkt) % 8) {
+	if (more && len % 8) {
 		/* Fragment length is not multiple of 8, discard
 		 * the packet and send parameter problem error with the
 		 * offset of the "Payload Length" field in the IPv6 header.
 		 */
 		net_icmpv6_send_error(pkt, NET_ICMPV6_PARAM_PROBLEM,
 				      NET_ICMPV6_PARAM_PROB_HEADER, NET_IPV6H_LENGTH_OFFSET);
-		goto drop;
+		verdict = NET_DROP;
+		goto out;
 	}
 
-	/* The fragments might come in wrong order so place them
-	 * in reassembly chain in correct order.
-	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv6_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv6_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room,
-			 * then it will discard the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		NET_DBG("Storing pkt %p to slot %d offset %d",
-			pkt, i, net_pkt_ipv6_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
+	reass = reassembly_get(id, (struct in6_addr *)hdr->src,
+			       (struct in6_addr *)hdr->dst);
+	if (!reass) {
+		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
+		verdict = NET_DROP;
+		goto out;
+	}
 
-		break;
+	if (CONFIG_NET_IPV6_FRAGMENT_MAX_SIZE > 0 &&
+	    !reassembly_reserve(reass, len)) {
+		ret = -ENOMEM;
+	} else {
+		ret = fragment_insert(reass, pkt);
 	}
 
-	if (!found) {
+	if (ret < 0) {
 		/* We could not add this fragment into our saved fragment
 		 * list. We must discard the whole packet at this point.
 		 */
-		NET_DBG("No slots available for 0x%x", reass->id);
-		net_pkt_unref(pkt);
-		goto drop;
+		NET_DBG("Cannot store fragment of 0x%x (%d), dropping it",
+			reass->id, ret);
+		reassembly_free(reass);
+		verdict = NET_DROP;
+		goto out;
 	}
 
-	ret = fragments_are_ready(reass);
-	if (ret < 0) {
-		NET_DBG("Reassembled IPv6 verify failed, dropping id %u",
-			reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
+	reass->size += len;
+	reassembly_size += len;
 
-		net_pkt_unref(pkt);
-		goto drop;
-	} else if (ret == 0) {
+	if (reass->total == 0U || reass->received < reass->total) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		NET_DBG("More fragments to be received");
-		goto accept;
+		goto out;
 	}
 
 	reassembly_info("Reassembly last pkt", reass);
@@ -571,17 +616,10 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 	/* The last fragment received, reassemble the packet */
 	reassemble_packet(reass);
 
-accept:
-	return NET_OK;
-
-drop:
-	if (reass) {
-		if (reassembly_cancel(reass->id, &reass->src, &reass->dst)) {
-			return NET_OK;
-		}
-	}
+out:
+	k_mutex_unlock(&reassembly_lock);
 
-	return NET_DROP;
+	return verdict;
 }
 
 #define BUF_ALLOC_TIMEOUT K_MSEC(100)
@@ -1771,6 +1771,21 @@ static int get_context_timestamping(struct net_context *context,
 #endif
 }
 
+static int get_context_udp_segment(struct net_context *context,
+				   void *value, size_t *len)
+{
+#if defined(CONFIG_NET_UDP_GSO)
+	return get_uint16_option(context->options.udp_segment,
+				 value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
  * to net_pkt from msghdr.
  */
@@ -1922,6 +1937,72 @@ static struct net_pkt *context_alloc_pkt(struct net_context *context,
 	return pkt;
 }
 
+/* Segment size of a UDP send, 0 if the data goes out as one datagram */
+static int context_udp_gso_size(struct net_context *context,
+				sa_family_t family, struct net_if *iface,
+				size_t len)
+{
+#if defined(CONFIG_NET_UDP_GSO)
+	uint16_t gso_size = context->options.udp_segment;
+	size_t hdr_len;
+
+	if (gso_size == 0U || len <= gso_size || iface == NULL ||
+	    net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    net_if_is_ip_offloaded(iface)) {
+		return 0;
+	}
+
+	hdr_len = NET_UDPH_LEN +
+		  (family == AF_INET6 ? NET_IPV6H_LEN : NET_IPV4H_LEN);
+
+	/* Every datagram must fit the MTU, and the whole send one packet */
+	if (gso_size + hdr_len > net_if_get_mtu(iface)) {
+		return -EINVAL;
+	}
+
+	if (len + hdr_len > UINT16_MAX) {
+		return -EMSGSIZE;
+	}
+
+	return gso_size;
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(family);
+	ARG_UNUSED(iface);
+	ARG_UNUSED(len);
+
+	return 0;
+#endif
+}
+
+/* A large UDP send is not bound by the MTU like the regular allocation,
+ * as the L2 splits it into datagrams of the segment size.
+ */
+static struct net_pkt *context_alloc_gso_pkt(struct net_context *context,
+					     sa_family_t family,
+					     size_t len, k_timeout_t timeout)
+{
+	size_t hdr_len = NET_UDPH_LEN +
+			 (family == AF_INET6 ? NET_IPV6H_LEN : NET_IPV4H_LEN);
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_on_iface(net_context_get_iface(context), timeout);
+	if (!pkt) {
+		return NULL;
+	}
+
+	net_pkt_set_family(pkt, family);
+	net_pkt_set_context(pkt, context);
+
+	if (net_pkt_alloc_buffer_raw(pkt, hdr_len + len, timeout)) {
+		net_pkt_unref(pkt);
+
+		return NULL;
+	}
+
+	return pkt;
+}
+
 static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 {
 	struct cmsghdr *cmsg;
@@ -1951,6 +2032,7 @@ static int context_sendto(struct net_context *context,
 	struct net_if *iface;
 	struct net_pkt *pkt = NULL;
 	sa_family_t family;
+	uint16_t gso_size = 0U;
 	size_t tmp_len;
 	int ret;
 
@@ -2189,7 +2271,22 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	if (IS_ENABLED(CONFIG_NET_UDP_GSO) &&
+	    net_context_get_proto(context) == IPPROTO_UDP) {
+		ret = context_udp_gso_size(context, family, iface, len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		gso_size = ret;
+	}
+
+	if (gso_size > 0U) {
+		pkt = context_alloc_gso_pkt(context, family, len, PKT_WAIT_TIME);
+	} else {
+		pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	}
+
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2254,6 +2351,8 @@ skip_alloc:
 			goto fail;
 		}
 
+		net_pkt_set_gso_size(pkt, gso_size);
+
 		context_finalize_packet(context, family, pkt);
 
 		ret = net_send_data(pkt);
@@ -3103,6 +3202,24 @@ static int set_context_timestamping(struct net_context *context,
 #endif
 }
 
+static int set_context_udp_segment(struct net_context *context,
+				   const void *value, size_t len)
+{
+#if defined(CONFIG_NET_UDP_GSO)
+	if (net_context_get_proto(context) != IPPROTO_UDP) {
+		return -ENOPROTOOPT;
+	}
+
+	return set_uint16_option(&context->options.udp_segment, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 int net_context_set_option(struct net_context *context,
 			   enum net_context_option option,
 			   const void *value, size_t len)
@@ -3172,6 +3289,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_TIMESTAMPING:
 		ret = set_context_timestamping(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = set_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -3248,6 +3368,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_TIMESTAMPING:
 		ret = get_context_timestamping(context, value, len);
 		break;
+	case NET_OPT_UDP_SEGMENT:
+		ret = get_context_udp_segment(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
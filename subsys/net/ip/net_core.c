@@ -59,6 +59,7 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "tcp_internal.h"
 
 #include "net_stats.h"
+#include "net_gro.h"
 
 #if defined(CONFIG_NET_NATIVE)
 static inline enum net_verdict process_data(struct net_pkt *pkt,
@@ -131,6 +132,13 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		if (IS_ENABLED(CONFIG_NET_GRO) && !is_loopback && !locally_routed) {
+			ret = net_gro_receive(pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -466,7 +474,13 @@ void net_process_rx_packet(struct net_pkt *pkt)
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	uint8_t prio = net_pkt_priority(pkt);
-	uint8_t tc = net_rx_priority2tc(prio);
+	uint8_t tc;
+
+	if (IS_ENABLED(CONFIG_NET_RX_RSS)) {
+		tc = net_tc_rx_rss_queue(iface, pkt);
+	} else {
+		tc = net_rx_priority2tc(prio);
+	}
 
 #if defined(CONFIG_NET_STATISTICS)
 	net_stats_update_tc_recv_pkt(iface, tc);
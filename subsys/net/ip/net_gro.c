@@ -0,0 +1,400 @@
+/** @file
+ * @brief Coalescing of received TCP segments
+ *
+ * Consecutive in-order segments of a TCP connection that are waiting in
+ * the same RX traffic class queue are merged into one packet, so the IP
+ * and TCP input paths run once for the whole batch.
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_core, CONFIG_NET_CORE_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "net_private.h"
+#include "net_gro.h"
+
+#define GRO_TCP_FIN BIT(0)
+#define GRO_TCP_SYN BIT(1)
+#define GRO_TCP_RST BIT(2)
+#define GRO_TCP_PSH BIT(3)
+#define GRO_TCP_ACK BIT(4)
+#define GRO_TCP_URG BIT(5)
+
+/* A segment carrying any of these flags is never coalesced */
+#define GRO_TCP_NO_MERGE (GRO_TCP_FIN | GRO_TCP_SYN | GRO_TCP_RST | GRO_TCP_URG)
+
+#define GRO_TCP_MAX_OPTS_LEN 40
+
+struct gro_seg {
+	/** TCP header of the segment */
+	struct net_tcp_hdr th;
+	/** TCP options of the segment */
+	uint8_t opts[GRO_TCP_MAX_OPTS_LEN];
+	/** Length of the IP header */
+	uint16_t ip_len;
+	/** Length of the IP and TCP headers */
+	uint16_t hdr_len;
+	/** Length of the TCP payload */
+	uint16_t payload_len;
+};
+
+struct gro_flow {
+	/** Packet being built, NULL if the slot is free */
+	struct net_pkt *pkt;
+	/** Headers of the first segment, payload length of the whole packet */
+	struct gro_seg seg;
+	/** Sequence number expected in the next segment */
+	uint32_t next_seq;
+	/** Payload length of the first segment */
+	uint16_t seg_size;
+	/** Number of segments merged into the packet */
+	uint16_t count;
+};
+
+static struct gro_flow gro_flows[NET_TC_RX_COUNT][CONFIG_NET_GRO_MAX_FLOWS];
+
+static bool gro_parse_ipv4(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_ipv4_hdr *hdr = NET_IPV4_HDR(pkt);
+
+	if (pkt->buffer->len < sizeof(*hdr) || hdr->vhl != 0x45 ||
+	    hdr->proto != IPPROTO_TCP ||
+	    ntohs(hdr->len) != net_pkt_get_len(pkt) ||
+	    (sys_get_be16(hdr->offset) &
+	     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) != 0U) {
+		return false;
+	}
+
+	net_pkt_set_family(pkt, AF_INET);
+	net_pkt_set_ip_hdr_len(pkt, sizeof(*hdr));
+	net_pkt_set_ipv6_ext_len(pkt, 0);
+	net_pkt_set_ipv4_opts_len(pkt, 0);
+
+	/* The header is rewritten when segments are merged, so a broken
+	 * checksum must not get fixed up along the way.
+	 */
+	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV4_HEADER) &&
+	    net_calc_chksum_ipv4(pkt) != 0U) {
+		return false;
+	}
+
+	seg->ip_len = sizeof(*hdr);
+
+	return true;
+}
+
+static bool gro_parse_ipv6(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_ipv6_hdr *hdr = NET_IPV6_HDR(pkt);
+
+	if (pkt->buffer->len < sizeof(*hdr) || hdr->nexthdr != IPPROTO_TCP ||
+	    ntohs(hdr->len) + sizeof(*hdr) != net_pkt_get_len(pkt)) {
+		return false;
+	}
+
+	net_pkt_set_family(pkt, AF_INET6);
+	net_pkt_set_ip_hdr_len(pkt, sizeof(*hdr));
+	net_pkt_set_ipv6_ext_len(pkt, 0);
+
+	seg->ip_len = sizeof(*hdr);
+
+	return true;
+}
+
+static bool gro_parse(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *th;
+	size_t len = net_pkt_get_len(pkt);
+	size_t th_len;
+	bool ret = false;
+
+	if (pkt->buffer == NULL || pkt->buffer->len < sizeof(struct net_ipv4_hdr)) {
+		return false;
+	}
+
+	switch (NET_IPV6_HDR(pkt)->vtc & 0xf0) {
+	case 0x40:
+		if (!IS_ENABLED(CONFIG_NET_IPV4) || !gro_parse_ipv4(pkt, seg)) {
+			return false;
+		}
+		break;
+	case 0x60:
+		if (!IS_ENABLED(CONFIG_NET_IPV6) || !gro_parse_ipv6(pkt, seg)) {
+			return false;
+		}
+		break;
+	default:
+		return false;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, seg->ip_len)) {
+		goto out;
+	}
+
+	th = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (th == NULL) {
+		goto out;
+	}
+
+	th_len = (th->offset >> 4) * 4U;
+	if (th_len < sizeof(*th) || seg->ip_len + th_len > len) {
+		goto out;
+	}
+
+	memcpy(&seg->th, th, sizeof(seg->th));
+
+	if (net_pkt_acknowledge_data(pkt, &tcp_access) ||
+	    net_pkt_read(pkt, seg->opts, th_len - sizeof(*th))) {
+		goto out;
+	}
+
+	seg->hdr_len = seg->ip_len + th_len;
+	seg->payload_len = len - seg->hdr_len;
+	ret = true;
+out:
+	net_pkt_cursor_init(pkt);
+
+	return ret;
+}
+
+static bool gro_can_hold(const struct gro_seg *seg)
+{
+	return seg->payload_len > 0U && (seg->th.flags & GRO_TCP_ACK) &&
+	       !(seg->th.flags & (GRO_TCP_NO_MERGE | GRO_TCP_PSH));
+}
+
+/* Verify the TCP checksum of a segment, the checksum of a merged packet
+ * does not cover its data anymore so it must be checked before merging.
+ */
+static bool gro_chksum_ok(struct net_pkt *pkt)
+{
+	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
+		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) ||
+	    !net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type)) {
+		return true;
+	}
+
+	if (net_calc_chksum_tcp(pkt) != 0U) {
+		return false;
+	}
+
+	net_pkt_set_chksum_done(pkt, true);
+
+	return true;
+}
+
+static bool gro_same_flow(struct gro_flow *flow, struct net_pkt *pkt,
+			  const struct gro_seg *seg)
+{
+	if (net_pkt_iface(flow->pkt) != net_pkt_iface(pkt) ||
+	    flow->seg.ip_len != seg->ip_len ||
+	    flow->seg.th.src_port != seg->th.src_port ||
+	    flow->seg.th.dst_port != seg->th.dst_port) {
+		return false;
+	}
+
+	if (seg->ip_len == sizeof(struct net_ipv4_hdr)) {
+		struct net_ipv4_hdr *a = NET_IPV4_HDR(flow->pkt);
+		struct net_ipv4_hdr *b = NET_IPV4_HDR(pkt);
+
+		return !memcmp(a->src, b->src, sizeof(a->src)) &&
+		       !memcmp(a->dst, b->dst, sizeof(a->dst));
+	}
+
+	return !memcmp(NET_IPV6_HDR(flow->pkt)->src, NET_IPV6_HDR(pkt)->src,
+		       sizeof(NET_IPV6_HDR(pkt)->src)) &&
+	       !memcmp(NET_IPV6_HDR(flow->pkt)->dst, NET_IPV6_HDR(pkt)->dst,
+		       sizeof(NET_IPV6_HDR(pkt)->dst));
+}
+
+static bool gro_can_merge(struct gro_flow *flow, const struct gro_seg *seg)
+{
+	size_t opts_len = seg->hdr_len - seg->ip_len - sizeof(struct net_tcp_hdr);
+
+	/* Only a trailing PSH is allowed, it ends the packet */
+	if (seg->payload_len == 0U ||
+	    (seg->th.flags & ~GRO_TCP_PSH) != flow->seg.th.flags ||
+	    seg->hdr_len != flow->seg.hdr_len ||
+	    seg->payload_len > flow->seg_size) {
+		return false;
+	}
+
+	if (sys_get_be32(seg->th.seq) != flow->next_seq ||
+	    memcmp(seg->th.ack, flow->seg.th.ack, sizeof(seg->th.ack)) ||
+	    memcmp(seg->opts, flow->seg.opts, opts_len)) {
+		return false;
+	}
+
+	return flow->seg.hdr_len + flow->seg.payload_len + seg->payload_len <=
+	       CONFIG_NET_GRO_MAX_SIZE;
+}
+
+static void gro_merge(struct gro_flow *flow, struct net_pkt *pkt,
+		      const struct gro_seg *seg)
+{
+	struct net_buf *payload;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_pull(pkt, seg->hdr_len);
+
+	payload = pkt->buffer;
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	net_pkt_append_buffer(flow->pkt, payload);
+
+	flow->seg.payload_len += seg->payload_len;
+	flow->seg.th.flags |= seg->th.flags & GRO_TCP_PSH;
+	memcpy(flow->seg.th.wnd, seg->th.wnd, sizeof(seg->th.wnd));
+	flow->next_seq += seg->payload_len;
+	flow->count++;
+}
+
+/* Rewrite the IP length and the TCP flags and window of a merged packet */
+static void gro_fixup(struct gro_flow *flow)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_pkt *pkt = flow->pkt;
+	uint16_t len = flow->seg.hdr_len + flow->seg.payload_len;
+	struct net_tcp_hdr *th;
+
+	if (flow->seg.ip_len == sizeof(struct net_ipv4_hdr)) {
+		struct net_ipv4_hdr *hdr = NET_IPV4_HDR(pkt);
+
+		hdr->len = htons(len);
+		hdr->chksum = 0U;
+		hdr->chksum = net_calc_chksum_ipv4(pkt);
+	} else {
+		NET_IPV6_HDR(pkt)->len = htons(len - sizeof(struct net_ipv6_hdr));
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (!net_pkt_skip(pkt, flow->seg.ip_len)) {
+		th = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+		if (th != NULL) {
+			th->flags = flow->seg.th.flags;
+			memcpy(th->wnd, flow->seg.th.wnd, sizeof(th->wnd));
+			net_pkt_set_data(pkt, &tcp_access);
+		}
+	}
+
+	net_pkt_cursor_init(pkt);
+}
+
+static void gro_flush_flow(struct gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->pkt;
+	enum net_verdict verdict;
+
+	if (flow->count > 1U) {
+		NET_DBG("Merged %u segments into pkt %p (%u bytes)", flow->count,
+			pkt, flow->seg.payload_len);
+		gro_fixup(flow);
+	}
+
+	flow->pkt = NULL;
+
+	if (flow->seg.ip_len == sizeof(struct net_ipv4_hdr)) {
+		verdict = net_ipv4_input(pkt, false);
+	} else {
+		verdict = net_ipv6_input(pkt, false);
+	}
+
+	if (verdict != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+enum net_verdict net_gro_receive(struct net_pkt *pkt)
+{
+	struct gro_flow *flows = gro_flows[net_rx_priority2tc(net_pkt_priority(pkt))];
+	struct gro_flow *flow = NULL;
+	struct gro_flow *slot = NULL;
+	struct gro_seg seg;
+	int i;
+
+	if (!gro_parse(pkt, &seg)) {
+		return NET_CONTINUE;
+	}
+
+	for (i = 0; i < CONFIG_NET_GRO_MAX_FLOWS; i++) {
+		if (flows[i].pkt == NULL) {
+			if (slot == NULL) {
+				slot = &flows[i];
+			}
+
+			continue;
+		}
+
+		if (gro_same_flow(&flows[i], pkt, &seg)) {
+			flow = &flows[i];
+			break;
+		}
+	}
+
+	if (flow != NULL) {
+		if (gro_can_merge(flow, &seg) && gro_chksum_ok(pkt)) {
+			gro_merge(flow, pkt, &seg);
+
+			/* A short or pushed segment ends the write of the
+			 * peer, pass the data on without waiting.
+			 */
+			if ((flow->seg.th.flags & GRO_TCP_PSH) ||
+			    seg.payload_len < flow->seg_size) {
+				gro_flush_flow(flow);
+			}
+
+			return NET_OK;
+		}
+
+		/* Keep the segments of the connection in order */
+		gro_flush_flow(flow);
+		slot = flow;
+	}
+
+	if (slot == NULL || !gro_can_hold(&seg) || !gro_chksum_ok(pkt)) {
+		return NET_CONTINUE;
+	}
+
+	slot->pkt = pkt;
+	slot->seg = seg;
+	slot->next_seq = sys_get_be32(seg.th.seq) + seg.payload_len;
+	slot->seg_size = seg.payload_len;
+	slot->count = 1U;
+
+	return NET_OK;
+}
+
+void net_gro_flush(int tc)
+{
+	struct gro_flow *flows = gro_flows[tc];
+	int i;
+
+	for (i = 0; i < CONFIG_NET_GRO_MAX_FLOWS; i++) {
+		if (flows[i].pkt != NULL) {
+			gro_flush_flow(&flows[i]);
+		}
+	}
+}
@@ -0,0 +1,52 @@
+/** @file
+ * @brief Coalescing of received TCP segments
+ *
+ * This is not to be included by the application.
+ */
+
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __NET_GRO_H
+#define __NET_GRO_H
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+
+#if defined(CONFIG_NET_GRO)
+/**
+ * @brief Try to coalesce a received packet with the held segments.
+ *
+ * Called after L2 processing, before the packet is passed to the IP layer.
+ *
+ * @param pkt Received packet, the cursor must point to the IP header.
+ *
+ * @return NET_OK if the packet was held or merged, NET_CONTINUE if it
+ * must be processed as usual.
+ */
+enum net_verdict net_gro_receive(struct net_pkt *pkt);
+
+/**
+ * @brief Pass all the held packets of a traffic class to the IP layer.
+ *
+ * @param tc RX traffic class.
+ */
+void net_gro_flush(int tc);
+#else
+static inline enum net_verdict net_gro_receive(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+
+static inline void net_gro_flush(int tc)
+{
+	ARG_UNUSED(tc);
+}
+#endif /* CONFIG_NET_GRO */
+
+#endif /* __NET_GRO_H */
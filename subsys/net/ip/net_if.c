@@ -379,9 +379,10 @@ void net_if_queue_tx(struct net_if *iface, struct net_pkt *pkt)
 
 	if (!net_tc_submit_to_tx_queue(tc, pkt)) {
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
-		iface->tx_pending--
+		iface->tx_pending--;
 #endif
-			;
+		NET_DBG("TX queue %d full, dropping pkt %p", tc, pkt);
+		net_pkt_unref(pkt);
 	}
 }
 #endif /* CONFIG_NET_NATIVE */
@@ -48,7 +48,25 @@ static struct k_work_q mgmt_work_q_obj;
 #endif
 
 static uint32_t global_event_mask;
-static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
+static sys_slist_t event_callbacks[CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS];
+
+/* Callbacks run from the context notifying the event, they have their own
+ * lock so that they are not held up by the callbacks run from the queue.
+ */
+static K_MUTEX_DEFINE(net_mgmt_direct_lock);
+static uint32_t direct_event_mask;
+static sys_slist_t direct_callbacks[CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS];
+
+/* A callback matches the layer and layer code of an event exactly, so all
+ * the callbacks interested in an event are in the same list.
+ */
+static inline sys_slist_t *mgmt_bucket(sys_slist_t *lists, uint32_t event_mask)
+{
+	uint32_t key = (NET_MGMT_GET_LAYER(event_mask) << 11) |
+		       NET_MGMT_GET_LAYER_CODE(event_mask);
+
+	return &lists[key % CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS];
+}
 
 /* Forward declaration for the actual caller */
 static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event);
@@ -154,36 +172,56 @@ static inline void mgmt_add_event_mask(uint32_t event_mask)
 	global_event_mask |= event_mask;
 }
 
-static inline void mgmt_rebuild_global_event_mask(void)
+static inline uint32_t mgmt_slist_event_mask(sys_slist_t *lists)
 {
 	struct net_mgmt_event_callback *cb, *tmp;
+	uint32_t event_mask = 0U;
 
+	for (int i = 0; i < CONFIG_NET_MGMT_EVENT_CALLBACK_BUCKETS; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&lists[i], cb, tmp, node) {
+			event_mask |= cb->event_mask;
+		}
+	}
+
+	return event_mask;
+}
+
+static inline void mgmt_rebuild_global_event_mask(void)
+{
 	global_event_mask = 0U;
 
 	STRUCT_SECTION_FOREACH(net_mgmt_event_static_handler, it) {
 		mgmt_add_event_mask(it->event_mask);
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
-	}
+	mgmt_add_event_mask(mgmt_slist_event_mask(event_callbacks));
 }
 
-static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
+static inline bool mgmt_is_event_handled(uint32_t event_mask, uint32_t mgmt_event)
 {
 	return (((NET_MGMT_GET_LAYER(mgmt_event) &
-		  NET_MGMT_GET_LAYER(global_event_mask)) ==
+		  NET_MGMT_GET_LAYER(event_mask)) ==
 		 NET_MGMT_GET_LAYER(mgmt_event)) &&
 		((NET_MGMT_GET_LAYER_CODE(mgmt_event) &
-		  NET_MGMT_GET_LAYER_CODE(global_event_mask)) ==
+		  NET_MGMT_GET_LAYER_CODE(event_mask)) ==
 		 NET_MGMT_GET_LAYER_CODE(mgmt_event)) &&
 		((NET_MGMT_GET_COMMAND(mgmt_event) &
-		  NET_MGMT_GET_COMMAND(global_event_mask)) ==
+		  NET_MGMT_GET_COMMAND(event_mask)) ==
 		 NET_MGMT_GET_COMMAND(mgmt_event)));
 }
 
+static inline bool mgmt_event_matches(uint32_t mgmt_event, uint32_t event_mask)
+{
+	return NET_MGMT_GET_LAYER(mgmt_event) == NET_MGMT_GET_LAYER(event_mask) &&
+	       NET_MGMT_GET_LAYER_CODE(mgmt_event) == NET_MGMT_GET_LAYER_CODE(event_mask) &&
+	       (!NET_MGMT_GET_COMMAND(mgmt_event) ||
+		!NET_MGMT_GET_COMMAND(event_mask) ||
+		(NET_MGMT_GET_COMMAND(mgmt_event) & NET_MGMT_GET_COMMAND(event_mask)));
+}
+
 static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
+	sys_slist_t *callbacks = mgmt_bucket(event_callbacks, mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -193,15 +231,9 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
-		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER_CODE(cb->event_mask)) ||
-		    (NET_MGMT_GET_COMMAND(mgmt_event->event) &&
-		     NET_MGMT_GET_COMMAND(cb->event_mask) &&
-		     !(NET_MGMT_GET_COMMAND(mgmt_event->event) &
-		       NET_MGMT_GET_COMMAND(cb->event_mask)))) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(callbacks, cb, tmp, node) {
+		if (!mgmt_event_matches(mgmt_event->event, cb->event_mask)) {
+			prev = &cb->node;
 			continue;
 		}
 
@@ -222,6 +254,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 
 			if (sync_data->iface &&
 			    sync_data->iface != mgmt_event->iface) {
+				prev = &cb->node;
 				continue;
 			}
 
@@ -230,7 +263,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(callbacks, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -250,14 +283,7 @@ static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * cons
 static inline void mgmt_run_static_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
 	STRUCT_SECTION_FOREACH(net_mgmt_event_static_handler, it) {
-		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER(it->event_mask)) ||
-		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
-		      NET_MGMT_GET_LAYER_CODE(it->event_mask)) ||
-		    (NET_MGMT_GET_COMMAND(mgmt_event->event) &&
-		     NET_MGMT_GET_COMMAND(it->event_mask) &&
-		     !(NET_MGMT_GET_COMMAND(mgmt_event->event) &
-		       NET_MGMT_GET_COMMAND(it->event_mask)))) {
+		if (!mgmt_event_matches(mgmt_event->event, it->event_mask)) {
 			continue;
 		}
 
@@ -282,6 +308,43 @@ static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event)
 	(void)k_mutex_unlock(&net_mgmt_callback_lock);
 }
 
+static void mgmt_run_direct_callbacks(uint32_t mgmt_event, struct net_if *iface,
+				      const void *info, size_t length)
+{
+	struct net_mgmt_event_callback *cb, *tmp;
+
+#ifndef CONFIG_NET_MGMT_EVENT_INFO
+	ARG_UNUSED(info);
+	ARG_UNUSED(length);
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+	(void)k_mutex_lock(&net_mgmt_direct_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(mgmt_bucket(direct_callbacks, mgmt_event),
+					  cb, tmp, node) {
+		if (!mgmt_event_matches(mgmt_event, cb->event_mask)) {
+			continue;
+		}
+
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+		/* Nothing is copied, the info is the one of the notifier */
+		if (info != NULL && length > 0) {
+			cb->info = info;
+			cb->info_length = length;
+		} else {
+			cb->info = NULL;
+			cb->info_length = 0;
+		}
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+		NET_DBG("Running direct callback %p : %p", cb, cb->handler);
+
+		cb->handler(cb, mgmt_event, iface);
+	}
+
+	(void)k_mutex_unlock(&net_mgmt_direct_lock);
+}
+
 static int mgmt_event_wait_call(struct net_if *iface,
 				uint32_t mgmt_event_mask,
 				uint32_t *raised_event,
@@ -345,32 +408,61 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
 	/* Remove the callback if it already exists to avoid loop */
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(mgmt_bucket(event_callbacks, cb->event_mask), &cb->node);
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(mgmt_bucket(event_callbacks, cb->event_mask), &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
 	(void)k_mutex_unlock(&net_mgmt_callback_lock);
 }
 
+void net_mgmt_add_direct_event_callback(struct net_mgmt_event_callback *cb)
+{
+	NET_DBG("Adding direct event callback %p", cb);
+
+	(void)k_mutex_lock(&net_mgmt_direct_lock, K_FOREVER);
+
+	/* Remove the callback if it already exists to avoid loop */
+	sys_slist_find_and_remove(mgmt_bucket(direct_callbacks, cb->event_mask), &cb->node);
+
+	sys_slist_prepend(mgmt_bucket(direct_callbacks, cb->event_mask), &cb->node);
+
+	direct_event_mask |= cb->event_mask;
+
+	(void)k_mutex_unlock(&net_mgmt_direct_lock);
+}
+
 void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 {
 	NET_DBG("Deleting event callback %p", cb);
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(mgmt_bucket(event_callbacks, cb->event_mask), &cb->node);
 
 	mgmt_rebuild_global_event_mask();
 
 	(void)k_mutex_unlock(&net_mgmt_callback_lock);
+
+	(void)k_mutex_lock(&net_mgmt_direct_lock, K_FOREVER);
+
+	if (sys_slist_find_and_remove(mgmt_bucket(direct_callbacks, cb->event_mask),
+				      &cb->node)) {
+		direct_event_mask = mgmt_slist_event_mask(direct_callbacks);
+	}
+
+	(void)k_mutex_unlock(&net_mgmt_direct_lock);
 }
 
 void net_mgmt_event_notify_with_info(uint32_t mgmt_event, struct net_if *iface,
 				     const void *info, size_t length)
 {
-	if (mgmt_is_event_handled(mgmt_event)) {
+	if (mgmt_is_event_handled(direct_event_mask, mgmt_event)) {
+		mgmt_run_direct_callbacks(mgmt_event, iface, info, length);
+	}
+
+	if (mgmt_is_event_handled(global_event_mask, mgmt_event)) {
 		/* Readable layer code is starting from 1, thus the increment */
 		NET_DBG("Notifying Event layer %u code %u type %u",
 			NET_MGMT_GET_LAYER(mgmt_event) + 1,
@@ -131,6 +131,103 @@ BUILD_ASSERT(CONFIG_NET_BUF_DATA_SIZE >= 96);
 NET_PKT_SLAB_DEFINE(rx_pkts, CONFIG_NET_PKT_RX_COUNT);
 NET_PKT_SLAB_DEFINE(tx_pkts, CONFIG_NET_PKT_TX_COUNT);
 
+#if CONFIG_NET_PKT_CACHE_SIZE > 0
+/* Per-CPU caches of free RX and TX packets. The lock of a cache is only
+ * contended when another CPU runs out of packets and takes from it.
+ */
+struct pkt_cache {
+	struct k_spinlock lock;
+	uint8_t count;
+	struct net_pkt *pkts[CONFIG_NET_PKT_CACHE_SIZE];
+};
+
+static struct pkt_cache pkt_caches[CONFIG_MP_MAX_NUM_CPUS][2];
+
+static struct pkt_cache *pkt_cache_of(struct k_mem_slab *slab, int cpu)
+{
+	if (slab == &rx_pkts) {
+		return &pkt_caches[cpu][0];
+	} else if (slab == &tx_pkts) {
+		return &pkt_caches[cpu][1];
+	}
+
+	return NULL;
+}
+
+static struct net_pkt *pkt_cache_take(struct pkt_cache *cache)
+{
+	struct net_pkt *pkt = NULL;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count > 0) {
+		pkt = cache->pkts[--cache->count];
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return pkt;
+}
+
+/* The current CPU is only a hint, the thread may migrate before the cache
+ * is locked and then uses the cache of another CPU.
+ */
+static struct net_pkt *pkt_cache_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
+{
+	struct pkt_cache *cache = pkt_cache_of(slab, arch_curr_cpu()->id);
+	struct net_pkt *pkt;
+
+	if (cache == NULL) {
+		goto slab_alloc;
+	}
+
+	pkt = pkt_cache_take(cache);
+	if (pkt != NULL) {
+		return pkt;
+	}
+
+	if (k_mem_slab_alloc(slab, (void **)&pkt, K_NO_WAIT) == 0) {
+		return pkt;
+	}
+
+	/* The free packets may be cached by the other CPUs */
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		pkt = pkt_cache_take(pkt_cache_of(slab, cpu));
+		if (pkt != NULL) {
+			return pkt;
+		}
+	}
+
+slab_alloc:
+	if (k_mem_slab_alloc(slab, (void **)&pkt, timeout) != 0) {
+		return NULL;
+	}
+
+	return pkt;
+}
+
+static void pkt_cache_free(struct net_pkt *pkt)
+{
+	struct pkt_cache *cache = pkt_cache_of(pkt->slab, arch_curr_cpu()->id);
+	k_spinlock_key_t key;
+
+	if (cache != NULL) {
+		key = k_spin_lock(&cache->lock);
+
+		if (cache->count < ARRAY_SIZE(cache->pkts)) {
+			cache->pkts[cache->count++] = pkt;
+			k_spin_unlock(&cache->lock, key);
+			return;
+		}
+
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	k_mem_slab_free(pkt->slab, (void *)pkt);
+}
+#endif /* CONFIG_NET_PKT_CACHE_SIZE > 0 */
+
 #if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
 
 NET_BUF_POOL_FIXED_DEFINE(rx_bufs, CONFIG_NET_BUF_RX_COUNT, CONFIG_NET_BUF_DATA_SIZE,
@@ -613,7 +710,20 @@ done:
 		net_pkt_cursor_init(pkt);
 	}
 
+#if CONFIG_NET_PKT_CACHE_SIZE > 0
+	pkt_cache_free(pkt);
+#else
 	k_mem_slab_free(pkt->slab, (void *)pkt);
+#endif
+}
+
+void net_pkt_unref_bulk(struct net_pkt **pkts, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (pkts[i] != NULL) {
+			net_pkt_unref(pkts[i]);
+		}
+	}
 }
 
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
@@ -1387,10 +1497,19 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 		ARG_UNUSED(create_time);
 	}
 
+#if CONFIG_NET_PKT_CACHE_SIZE > 0
+	pkt = pkt_cache_alloc(slab, timeout);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	ARG_UNUSED(ret);
+#else
 	ret = k_mem_slab_alloc(slab, (void **)&pkt, timeout);
 	if (ret) {
 		return NULL;
 	}
+#endif
 
 	memset(pkt, 0, sizeof(struct net_pkt));
 
@@ -1986,6 +2105,8 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_forwarding(clone_pkt, net_pkt_forwarding(pkt));
 	net_pkt_set_chksum_done(clone_pkt, net_pkt_is_chksum_done(pkt));
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
+	net_pkt_set_rx_hash(clone_pkt, net_pkt_rx_hash(pkt));
 
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
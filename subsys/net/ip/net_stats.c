@@ -29,6 +29,56 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+K_PERCPU_DEFINE(net_stats_cpu);
+
+/* Everything before the traffic class statistics is a plain counter */
+#if NET_TC_COUNT > 1
+#define NET_STATS_COUNTERS_SIZE offsetof(struct net_stats, tc)
+#else
+#define NET_STATS_COUNTERS_SIZE sizeof(struct net_stats)
+#endif
+
+BUILD_ASSERT((NET_STATS_COUNTERS_SIZE % sizeof(net_stats_t)) == 0);
+
+static void net_stats_add(struct net_stats *dst, const struct net_stats *src)
+{
+	net_stats_t *d = (net_stats_t *)dst;
+	const net_stats_t *s = (const net_stats_t *)src;
+
+	for (size_t i = 0; i < NET_STATS_COUNTERS_SIZE / sizeof(net_stats_t); i++) {
+		d[i] += s[i];
+	}
+
+#if NET_TC_COUNT > 1
+	for (int i = 0; i < NET_TC_TX_STATS_COUNT; i++) {
+		dst->tc.sent[i].pkts += src->tc.sent[i].pkts;
+		dst->tc.sent[i].bytes += src->tc.sent[i].bytes;
+		dst->tc.sent[i].priority = MAX(dst->tc.sent[i].priority,
+					       src->tc.sent[i].priority);
+	}
+
+	for (int i = 0; i < NET_TC_RX_STATS_COUNT; i++) {
+		dst->tc.recv[i].pkts += src->tc.recv[i].pkts;
+		dst->tc.recv[i].bytes += src->tc.recv[i].bytes;
+		dst->tc.recv[i].priority = MAX(dst->tc.recv[i].priority,
+					       src->tc.recv[i].priority);
+	}
+#endif
+}
+
+void net_stats_collect(void)
+{
+	struct net_stats sum = { 0 };
+
+	K_PERCPU_FOREACH_CPU(cpu) {
+		net_stats_add(&sum, &K_PERCPU_CPU_PTR(net_stats_cpu, cpu)->stats);
+	}
+
+	net_stats = sum;
+}
+#endif /* CONFIG_NET_STATISTICS_PERCPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -227,6 +277,7 @@ void net_print_statistics_all(void)
 
 void net_print_statistics(void)
 {
+	net_stats_collect();
 	net_print_statistics_iface(NULL);
 }
 
@@ -240,6 +291,10 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	if (iface == NULL) {
+		net_stats_collect();
+	}
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -372,4 +427,8 @@ void net_stats_reset(struct net_if *iface)
 
 	net_if_stats_reset_all();
 	memset(&net_stats, 0, sizeof(net_stats));
+
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+	memset(net_stats_cpu, 0, sizeof(net_stats_cpu));
+#endif
 }
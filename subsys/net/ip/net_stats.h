@@ -17,6 +17,32 @@
 
 extern struct net_stats net_stats;
 
+#if defined(CONFIG_NET_STATISTICS_PERCPU)
+#include <zephyr/kernel/percpu.h>
+
+/* Global statistics are updated in a per-CPU copy, and only summed into
+ * net_stats by net_stats_collect() when they are read.
+ */
+struct net_stats_cpu {
+	struct net_stats stats;
+};
+
+K_PERCPU_DECLARE(struct net_stats_cpu, net_stats_cpu);
+
+void net_stats_collect(void);
+
+#define UPDATE_STAT_GLOBAL(cmd)						\
+	do {								\
+		unsigned int _key = arch_irq_lock();			\
+									\
+		K_PERCPU_PTR(net_stats_cpu)->cmd;			\
+		arch_irq_unlock(_key);					\
+	} while (false)
+#else
+#define net_stats_collect()
+#define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
+#endif /* CONFIG_NET_STATISTICS_PERCPU */
+
 #if defined(CONFIG_NET_STATISTICS_PER_INTERFACE)
 #define SET_STAT(cmd) (cmd)
 #define GET_STAT(iface, s) (iface ? iface->stats.s : net_stats.s)
@@ -27,9 +53,8 @@ extern struct net_stats net_stats;
 #define GET_STAT_ADDR(iface, s) (&GET_STAT(iface, s))
 #endif
 
-#define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
 #define UPDATE_STAT(_iface, _cmd) \
-	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
+	{ NET_ASSERT(_iface); UPDATE_STAT_GLOBAL(_cmd); \
 	  SET_STAT(_iface->_cmd); }
 /* Core stats */
 
@@ -9,14 +9,17 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
 #include <string.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "net_gro.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
@@ -47,9 +50,55 @@ static void submit_to_queue(struct k_fifo *queue, struct net_pkt *pkt)
 }
 #endif
 
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+/* Account the packet against the byte limit of its Tx queue, waiting for
+ * room if the caller can sleep. The Tx threads themselves never wait as
+ * they might be the ones that should drain the queue.
+ */
+static bool tx_queue_reserve(struct net_traffic_class *class, size_t len)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_MSEC(CONFIG_NET_TC_TX_BYTE_LIMIT_TIMEOUT));
+	bool can_wait = !k_is_in_isr() && !k_is_pre_kernel() &&
+			k_current_get() != &class->handler &&
+			k_current_get() != k_work_queue_thread_get(&k_sys_work_q);
+	atomic_val_t queued;
+
+	while (true) {
+		queued = atomic_get(&class->queued_bytes);
+
+		/* An empty queue always takes the packet so that packets
+		 * bigger than the limit can be sent.
+		 */
+		if (queued == 0 || queued + len <= CONFIG_NET_TC_TX_BYTE_LIMIT_SIZE) {
+			if (atomic_cas(&class->queued_bytes, queued, queued + len)) {
+				return true;
+			}
+
+			continue;
+		}
+
+		if (!can_wait || k_sem_take(&class->space, sys_timepoint_timeout(end)) < 0) {
+			return false;
+		}
+	}
+}
+
+static void tx_queue_release(struct net_traffic_class *class, size_t len)
+{
+	atomic_sub(&class->queued_bytes, len);
+	k_sem_give(&class->space);
+}
+#endif /* CONFIG_NET_TC_TX_BYTE_LIMIT */
+
 bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_TX_COUNT > 0
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+	if (!tx_queue_reserve(&tx_classes[tc], net_pkt_get_len(pkt))) {
+		return false;
+	}
+#endif
+
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
 	submit_to_queue(&tx_classes[tc].fifo, pkt);
@@ -72,6 +121,98 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+#if defined(CONFIG_NET_RX_RSS)
+static uint32_t rx_hash_add(uint32_t hash, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+		hash = (hash ^ sys_get_be32(&data[i])) * 0x9e3779b1U;
+		hash ^= hash >> 16;
+	}
+
+	return hash;
+}
+
+/* Hash the addresses and the ports of a received IP packet. Only the first
+ * buffer of the packet is looked at, 0 is returned if the headers are not
+ * found there.
+ */
+static uint32_t rx_flow_hash(struct net_if *iface, struct net_pkt *pkt)
+{
+	const uint8_t *data;
+	uint32_t hash = 0;
+	uint16_t type;
+	size_t len, off = 0, l4 = 0;
+	uint8_t proto;
+
+	if (pkt->buffer == NULL) {
+		return 0;
+	}
+
+	data = pkt->buffer->data;
+	len = pkt->buffer->len;
+
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+	    net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		if (len < sizeof(struct net_eth_hdr)) {
+			return 0;
+		}
+
+		type = sys_get_be16(&data[12]);
+		off = sizeof(struct net_eth_hdr);
+
+		if (type == NET_ETH_PTYPE_VLAN) {
+			if (len < off + 4) {
+				return 0;
+			}
+
+			type = sys_get_be16(&data[off + 2]);
+			off += 4;
+		}
+	} else if (len > 0 && (data[0] >> 4) == 4) {
+		type = NET_ETH_PTYPE_IP;
+	} else if (len > 0 && (data[0] >> 4) == 6) {
+		type = NET_ETH_PTYPE_IPV6;
+	} else {
+		return 0;
+	}
+
+	if (type == NET_ETH_PTYPE_IP && len >= off + NET_IPV4H_LEN) {
+		proto = data[off + 9];
+		hash = rx_hash_add(proto, &data[off + 12], 2 * sizeof(struct in_addr));
+
+		/* Fragments after the first one have no ports */
+		if ((sys_get_be16(&data[off + 6]) & 0x3fff) == 0) {
+			l4 = off + (data[off] & 0x0f) * 4;
+		}
+	} else if (type == NET_ETH_PTYPE_IPV6 && len >= off + NET_IPV6H_LEN) {
+		proto = data[off + 6];
+		hash = rx_hash_add(proto, &data[off + 8], 2 * sizeof(struct in6_addr));
+		l4 = off + NET_IPV6H_LEN;
+	} else {
+		return 0;
+	}
+
+	if (l4 > 0 && (proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+	    len >= l4 + 2 * sizeof(uint16_t)) {
+		hash = rx_hash_add(hash, &data[l4], 2 * sizeof(uint16_t));
+	}
+
+	return hash;
+}
+
+uint8_t net_tc_rx_rss_queue(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint32_t hash = net_pkt_rx_hash(pkt);
+
+	if (hash == 0) {
+		hash = rx_flow_hash(iface, pkt);
+		net_pkt_set_rx_hash(pkt, hash);
+	}
+
+	return hash % NET_TC_RX_COUNT;
+}
+#endif /* CONFIG_NET_RX_RSS */
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -88,6 +229,18 @@ int net_tx_priority2tc(enum net_priority prio)
 #endif
 }
 
+int net_tx_priority2queue(enum net_priority prio, int queue_count)
+{
+#if NET_TC_TX_COUNT > 1
+	return net_tx_priority2tc(prio) * queue_count / NET_TC_TX_COUNT;
+#else
+	ARG_UNUSED(prio);
+	ARG_UNUSED(queue_count);
+
+	return 0;
+#endif
+}
+
 int net_rx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_RX_COUNT > 0
@@ -242,12 +395,14 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_fifo *fifo = p1;
+	int tc = POINTER_TO_INT(p2);
 	struct net_pkt *pkt;
 
+	ARG_UNUSED(tc);
+
 	while (1) {
 		pkt = k_fifo_get(fifo, K_FOREVER);
 		if (pkt == NULL) {
@@ -255,6 +410,13 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 		}
 
 		net_process_rx_packet(pkt);
+
+		/* Hand over the coalesced segments once the batch of queued
+		 * packets has been processed.
+		 */
+		if (IS_ENABLED(CONFIG_NET_GRO) && k_fifo_is_empty(fifo)) {
+			net_gro_flush(tc);
+		}
 	}
 }
 #endif
@@ -267,6 +429,11 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 
 	struct k_fifo *fifo = p1;
 	struct net_pkt *pkt;
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+	struct net_traffic_class *class =
+		CONTAINER_OF(fifo, struct net_traffic_class, fifo);
+	size_t len;
+#endif
 
 	while (1) {
 		pkt = k_fifo_get(fifo, K_FOREVER);
@@ -274,7 +441,14 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 			continue;
 		}
 
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+		/* The packet counts until the driver is done with it */
+		len = net_pkt_get_len(pkt);
 		net_process_tx_packet(pkt);
+		tx_queue_release(class, len);
+#else
+		net_process_tx_packet(pkt);
+#endif
 	}
 }
 #endif
@@ -317,6 +491,10 @@ void net_tc_tx_init(void)
 			priority);
 
 		k_fifo_init(&tx_classes[i].fifo);
+#if defined(CONFIG_NET_TC_TX_BYTE_LIMIT)
+		atomic_set(&tx_classes[i].queued_bytes, 0);
+		k_sem_init(&tx_classes[i].space, 0, 1);
+#endif
 
 		tid = k_thread_create(&tx_classes[i].handler, tx_stack[i],
 				      K_KERNEL_STACK_SIZEOF(tx_stack[i]),
@@ -359,7 +537,12 @@ void net_tc_rx_init(void)
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		if (IS_ENABLED(CONFIG_NET_RX_RSS)) {
+			/* The queues carry flows, not priorities */
+			thread_priority = rx_tc2thread(net_rx_priority2tc(NET_PRIORITY_BE));
+		} else {
+			thread_priority = rx_tc2thread(i);
+		}
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -379,7 +562,7 @@ void net_tc_rx_init(void)
 		tid = k_thread_create(&rx_classes[i].handler, rx_stack[i],
 				      K_KERNEL_STACK_SIZEOF(rx_stack[i]),
 				      tc_rx_handler,
-				      &rx_classes[i].fifo, NULL, NULL,
+				      &rx_classes[i].fifo, INT_TO_POINTER(i), NULL,
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
@@ -393,6 +576,12 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_RX_RSS) && defined(CONFIG_SCHED_CPU_MASK)
+		if (k_thread_cpu_pin(tid, i % arch_num_cpus()) < 0) {
+			NET_WARN("Cannot pin RX queue %d to a CPU", i);
+		}
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -16,6 +16,7 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 #include <limits.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_core.h>
@@ -32,7 +33,26 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 /* We keep track of the routes in a separate list so that we can remove
  * the oldest routes (at tail) if needed.
  */
-static sys_slist_t routes;
+static sys_dlist_t routes = SYS_DLIST_STATIC_INIT(&routes);
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* Path compressed binary trie of the route prefixes. A node holds the
+ * routes with exactly its prefix, and the subtrees of the longer prefixes
+ * continuing with a 0 or a 1 bit. Nodes without routes only exist where
+ * two subtrees branch off.
+ */
+struct route_trie_node {
+	struct route_trie_node *child[2];
+	sys_slist_t routes;
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+/* N prefixes need at most N - 1 branching nodes */
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_free;
+static struct route_trie_node *route_trie_root;
+#endif /* CONFIG_NET_ROUTE_TRIE */
 
 /* Track currently active route lifetime timers */
 static sys_slist_t active_route_lifetime_timers;
@@ -263,19 +283,212 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
-	sys_slist_find_and_remove(&routes, &route->node);
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_remove(&route->node);
+	sys_dlist_prepend(&routes, &route->node);
+}
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+static inline uint8_t route_trie_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8] >> (7 - (bit % 8))) & 1U;
 }
 
+/* Number of leading bits, up to max_len, that are the same in a and b */
+static uint8_t route_trie_common_len(const struct in6_addr *a,
+				     const struct in6_addr *b,
+				     uint8_t max_len)
+{
+	uint8_t len = 0U;
+	int i;
+
+	for (i = 0; i < sizeof(a->s6_addr) && len < max_len; i++) {
+		uint8_t diff = a->s6_addr[i] ^ b->s6_addr[i];
+
+		if (diff != 0U) {
+			len += __builtin_clz(diff) - 24;
+			break;
+		}
+
+		len += 8U;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct route_trie_node *route_trie_node_alloc(const struct in6_addr *prefix,
+						     uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_free;
+	uint8_t bytes = prefix_len / 8;
+	uint8_t bits = prefix_len % 8;
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	route_trie_free = node->child[0];
+
+	(void)memset(node, 0, sizeof(*node));
+	sys_slist_init(&node->routes);
+
+	memcpy(node->prefix.s6_addr, prefix->s6_addr, bytes);
+	if (bits != 0U) {
+		node->prefix.s6_addr[bytes] = prefix->s6_addr[bytes] &
+					      (uint8_t)(0xff << (8 - bits));
+	}
+
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+static void route_trie_node_free(struct route_trie_node *node)
+{
+	node->child[0] = route_trie_free;
+	route_trie_free = node;
+}
+
+static int route_trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	const struct in6_addr *prefix = &route->addr;
+	uint8_t prefix_len = route->prefix_len;
+	struct route_trie_node *node;
+	struct route_trie_node *branch;
+	struct route_trie_node *leaf;
+	uint8_t len;
+
+	while (*link != NULL) {
+		node = *link;
+
+		len = route_trie_common_len(&node->prefix, prefix,
+					    MIN(node->prefix_len, prefix_len));
+		if (len < node->prefix_len) {
+			/* The new prefix branches off inside this node, or
+			 * is a shorter prefix of it.
+			 */
+			branch = route_trie_node_alloc(prefix, len);
+			leaf = len == prefix_len ? branch :
+				route_trie_node_alloc(prefix, prefix_len);
+			if (branch == NULL || leaf == NULL) {
+				if (branch != NULL) {
+					route_trie_node_free(branch);
+				}
+
+				return -ENOMEM;
+			}
+
+			branch->child[route_trie_bit(&node->prefix, len)] = node;
+			if (leaf != branch) {
+				branch->child[route_trie_bit(prefix, len)] = leaf;
+			}
+
+			*link = branch;
+			node = leaf;
+			goto attach;
+		}
+
+		if (node->prefix_len == prefix_len) {
+			goto attach;
+		}
+
+		link = &node->child[route_trie_bit(prefix, node->prefix_len)];
+	}
+
+	node = route_trie_node_alloc(prefix, prefix_len);
+	if (node == NULL) {
+		return -ENOMEM;
+	}
+
+	*link = node;
+
+attach:
+	sys_slist_append(&node->routes, &route->trie_node);
+
+	return 0;
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node **parent_link = NULL;
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *node;
+	struct route_trie_node *parent;
+
+	/* The nodes on the way to the route are all prefixes of it */
+	while ((node = *link) != NULL && node->prefix_len < route->prefix_len) {
+		parent_link = link;
+		link = &node->child[route_trie_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (node == NULL ||
+	    !sys_slist_find_and_remove(&node->routes, &route->trie_node)) {
+		return;
+	}
+
+	if (!sys_slist_is_empty(&node->routes) ||
+	    (node->child[0] != NULL && node->child[1] != NULL)) {
+		return;
+	}
+
+	*link = node->child[0] != NULL ? node->child[0] : node->child[1];
+	route_trie_node_free(node);
+
+	if (*link != NULL || parent_link == NULL) {
+		return;
+	}
+
+	/* A parent without routes is not needed for a single subtree */
+	parent = *parent_link;
+	if (sys_slist_is_empty(&parent->routes)) {
+		*parent_link = parent->child[0] != NULL ? parent->child[0] :
+							  parent->child[1];
+		route_trie_node_free(parent);
+	}
+}
+
+static struct net_route_entry *route_trie_lookup(struct net_if *iface,
+						 struct in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *found = NULL;
+	struct net_route_entry *route;
+
+	while (node != NULL &&
+	       route_trie_common_len(&node->prefix, dst,
+				     node->prefix_len) == node->prefix_len) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_node) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[route_trie_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	struct net_route_entry *found = NULL;
 
 	net_ipv6_nbr_lock();
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	found = route_trie_lookup(iface, dst);
+#else
+	struct net_route_entry *route;
+	uint8_t longest_match = 0U;
+	int i;
+
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -297,6 +510,7 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 			longest_match = route->prefix_len;
 		}
 	}
+#endif /* CONFIG_NET_ROUTE_TRIE */
 
 	if (found) {
 		net_route_info("Found", found, dst);
@@ -393,9 +607,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	nbr = nbr_new(iface, addr, prefix_len);
 	if (!nbr) {
 		/* Remove the oldest route and try again */
-		sys_snode_t *last = sys_slist_peek_tail(&routes);
-
-		sys_slist_find_and_remove(&routes, last);
+		sys_dnode_t *last = sys_dlist_peek_tail(&routes);
 
 		route = CONTAINER_OF(last,
 				     struct net_route_entry,
@@ -444,7 +656,12 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	net_route_update_lifetime(route, lifetime);
 
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_prepend(&routes, &route->node);
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/* Cannot fail, there are enough nodes for all the routes */
+	(void)route_trie_insert(route);
+#endif
 
 	tmp = nbr_nexthop_get(iface, nexthop);
 
@@ -586,7 +803,13 @@ int net_route_del(struct net_route_entry *route)
 		}
 	}
 
-	sys_slist_find_and_remove(&routes, &route->node);
+	if (sys_dnode_is_linked(&route->node)) {
+		sys_dlist_remove(&route->node);
+	}
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	route_trie_remove(route);
+#endif
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
@@ -1131,6 +1354,14 @@ void net_route_init(void)
 
 #if defined(CONFIG_NET_ROUTE_MCAST)
 	memset(route_mcast_entries, 0, sizeof(route_mcast_entries));
+#endif
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	route_trie_root = NULL;
+	route_trie_free = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		route_trie_node_free(&route_trie_nodes[i]);
+	}
 #endif
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
@@ -64,6 +64,12 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+#define TCP_MAX_WIN ((uint32_t)UINT16_MAX << NET_TCP_MAX_WIN_SCALE)
+#else
+#define TCP_MAX_WIN UINT16_MAX
+#endif
+
 /* Define the number of MSS sections the congestion window is initialized at */
 #define TCP_CONGESTION_INITIAL_WIN 1
 #define TCP_CONGESTION_INITIAL_SSTHRESH 3
@@ -483,7 +489,7 @@ static void tcp_new_reno_dup_ack(struct tcp *conn)
 	int32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	conn->ca.cwnd = MIN(new_win, TCP_MAX_WIN);
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
@@ -499,7 +505,7 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			/* Implement a div_ceil	to avoid rounding to 0 */
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+		conn->ca.cwnd = MIN(new_win, TCP_MAX_WIN);
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -513,29 +519,261 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static const struct tcp_ca_ops tcp_new_reno_ops = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.on_ack = tcp_new_reno_pkts_acked,
+	.on_dup_ack = tcp_new_reno_dup_ack,
+	.on_loss = tcp_new_reno_fast_retransmit,
+	.on_rto = tcp_new_reno_timeout,
+};
+
+#ifdef CONFIG_NET_TCP_CA_CUBIC
+
+/* Implementation according to RFC 9438, with C = 0.4 and beta = 0.7 */
+
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Longest time since the start of an epoch used on the curve (ms) */
+#define CUBIC_MAX_T_MS 100000
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, cubic %s, cwnd=%u, ssthres=%u, w_max=%u, k=%ums",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh, conn->ca.w_max,
+		conn->ca.k_ms);
+}
+
+static uint32_t tcp_cubic_cbrt(uint64_t v)
+{
+	uint64_t r = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		r <<= 1;
+		b = 3 * r * (r + 1) + 1;
+		if ((v >> s) >= b) {
+			v -= b << s;
+			r++;
+		}
+	}
+
+	return (uint32_t)r;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
 {
 	tcp_new_reno_init(conn);
+	conn->ca.w_max = 0;
+	conn->ca.epoch_start = 0;
+}
+
+/* Multiplicative decrease, remembering where the window used to be */
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, release bandwidth to new flows */
+	if (cwnd < conn->ca.w_max) {
+		conn->ca.w_max = (uint32_t)(((uint64_t)cwnd *
+					    (CUBIC_BETA_DEN + CUBIC_BETA_NUM)) /
+					   (2 * CUBIC_BETA_DEN));
+	} else {
+		conn->ca.w_max = cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2,
+				(uint32_t)(((uint64_t)cwnd * CUBIC_BETA_NUM) / CUBIC_BETA_DEN));
+	conn->ca.epoch_start = 0;
+}
+
+static void tcp_cubic_on_loss(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_on_rto(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_cubic_log(conn, "timeout");
+}
+
+static void tcp_cubic_epoch_start(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->ca.epoch_start = k_uptime_get_32();
+	conn->ca.w_est = conn->ca.cwnd;
+
+	if (conn->ca.cwnd < conn->ca.w_max) {
+		/* K = cbrt((w_max - cwnd) / C), in segments and seconds */
+		conn->ca.k_ms = tcp_cubic_cbrt(((uint64_t)(conn->ca.w_max - conn->ca.cwnd) *
+						2500000000ULL) / mss);
+		conn->ca.origin = conn->ca.w_max;
+	} else {
+		conn->ca.k_ms = 0;
+		conn->ca.origin = conn->ca.cwnd;
+	}
+}
+
+static void tcp_cubic_congestion_avoidance(struct tcp *conn, uint32_t acked_len)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	int64_t t;
+	int64_t target;
+
+	if (conn->ca.epoch_start == 0) {
+		tcp_cubic_epoch_start(conn);
+	}
+
+	t = (int64_t)(uint32_t)(k_uptime_get_32() - conn->ca.epoch_start);
+	t = MIN(t, CUBIC_MAX_T_MS) - conn->ca.k_ms;
+
+	/* W_cubic(t) = C * (t - K)^3 + origin, with C = 0.4 segments/s^3 */
+	target = (int64_t)conn->ca.origin + (((t * t * t * 4) / 10000) * mss) / 1000000;
+	target = CLAMP(target, (int64_t)cwnd, (int64_t)cwnd + cwnd / 2);
+
+	if (target > cwnd) {
+		cwnd += (uint32_t)(((target - cwnd) * acked_len) / cwnd);
+	} else {
+		/* Probe slowly around the previous maximum */
+		cwnd += MAX(((uint64_t)mss * acked_len) / (100ULL * cwnd), 1);
+	}
+
+	/* Never grow slower than a Reno flow would (TCP-friendly region),
+	 * that is by 3 * (1 - beta) / (1 + beta) segments per window.
+	 */
+	conn->ca.w_est += (uint32_t)(((uint64_t)mss * acked_len * 9) / (17ULL * conn->ca.cwnd));
+	cwnd = MAX(cwnd, conn->ca.w_est);
+
+	conn->ca.cwnd = MIN(cwnd, TCP_MAX_WIN);
+}
+
+static void tcp_cubic_on_ack(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes != 0) {
+		/* Recovery is handled the same way as with NewReno */
+		tcp_new_reno_pkts_acked(conn, acked_len);
+		return;
+	}
+
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd = MIN(conn->ca.cwnd + MIN(acked_len, conn_mss(conn)), TCP_MAX_WIN);
+	} else {
+		tcp_cubic_congestion_avoidance(conn, acked_len);
+	}
+
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+static const struct tcp_ca_ops tcp_cubic_ops = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.on_ack = tcp_cubic_on_ack,
+	.on_dup_ack = tcp_new_reno_dup_ack,
+	.on_loss = tcp_cubic_on_loss,
+	.on_rto = tcp_cubic_on_rto,
+};
+#endif /* CONFIG_NET_TCP_CA_CUBIC */
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_new_reno_ops,
+#ifdef CONFIG_NET_TCP_CA_CUBIC
+	&tcp_cubic_ops,
+#endif
+};
+
+#ifdef CONFIG_NET_TCP_CA_DEFAULT_CUBIC
+#define TCP_CA_DEFAULT (&tcp_cubic_ops)
+#else
+#define TCP_CA_DEFAULT (&tcp_new_reno_ops)
+#endif
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->on_loss(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->on_rto(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->on_dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->on_ack(conn, acked_len);
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	size_t name_len = strnlen(value, len);
+
+	ARRAY_FOR_EACH(tcp_ca_algorithms, i) {
+		const struct tcp_ca_ops *ops = tcp_ca_algorithms[i];
+
+		if (strlen(ops->name) != name_len ||
+		    strncmp(ops->name, value, name_len) != 0) {
+			continue;
+		}
+
+		if (ops != conn->ca_ops) {
+			conn->ca_ops = ops;
+
+			/* An established connection keeps its window, the
+			 * algorithm specific state starts over.
+			 */
+			if (conn->state != TCP_LISTEN && conn->state != TCP_SYN_SENT &&
+			    conn->state != TCP_SYN_RECEIVED) {
+				uint32_t cwnd = conn->ca.cwnd;
+				uint32_t ssthresh = conn->ca.ssthresh;
+
+				tcp_ca_init(conn);
+				conn->ca.cwnd = cwnd;
+				conn->ca.ssthresh = ssthresh;
+			}
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (len == NULL || *len == 0) {
+		return -EINVAL;
+	}
+
+	name_len = MIN(name_len, *len);
+	memcpy(value, conn->ca_ops->name, name_len);
+	((char *)value)[name_len - 1] = '\0';
+	*len = name_len;
+
+	return 0;
 }
 #else
 
@@ -549,6 +787,212 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	return -ENOTSUP;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	return -ENOTSUP;
+}
+
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Selective acknowledgments according to RFC 2018. The sender keeps a
+ * sorted scoreboard of the ranges above snd_una that the peer already holds,
+ * so that retransmissions only fill the holes in between.
+ */
+
+static bool tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_enabled = conn->recv_options.sack_perm_found;
+
+	return conn->sack_enabled;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack_cnt = 0;
+	conn->sack_recovery = false;
+}
+
+/* Called after the fast retransmit of the segment at snd_una */
+static void tcp_sack_recovery_start(struct tcp *conn)
+{
+	conn->sack_recovery = (conn->sack_cnt > 0);
+	conn->sack_rexmit = conn->seq + conn->unacked_len;
+}
+
+static void tcp_sack_remove(struct tcp *conn, int idx)
+{
+	conn->sack_cnt--;
+	memmove(&conn->sack_scoreboard[idx], &conn->sack_scoreboard[idx + 1],
+		(conn->sack_cnt - idx) * sizeof(struct tcp_sack_block));
+}
+
+static void tcp_sack_insert(struct tcp *conn, uint32_t start, uint32_t end)
+{
+	struct tcp_sack_block *sb = conn->sack_scoreboard;
+	int i = 0;
+
+	/* Merge all blocks overlapping or adjacent to the new one */
+	while (i < conn->sack_cnt) {
+		if (net_tcp_seq_greater(start, sb[i].end)) {
+			i++;
+			continue;
+		}
+
+		if (net_tcp_seq_greater(sb[i].start, end)) {
+			break;
+		}
+
+		if (net_tcp_seq_greater(start, sb[i].start)) {
+			start = sb[i].start;
+		}
+
+		if (net_tcp_seq_greater(sb[i].end, end)) {
+			end = sb[i].end;
+		}
+
+		tcp_sack_remove(conn, i);
+	}
+
+	if (conn->sack_cnt == NET_TCP_SACK_SCOREBOARD_SIZE) {
+		/* Forget about the highest range, it is the least useful
+		 * one for repairing the holes right above snd_una.
+		 */
+		if (i == conn->sack_cnt) {
+			return;
+		}
+
+		conn->sack_cnt--;
+	}
+
+	memmove(&sb[i + 1], &sb[i], (conn->sack_cnt - i) * sizeof(struct tcp_sack_block));
+	sb[i].start = start;
+	sb[i].end = end;
+	conn->sack_cnt++;
+}
+
+/* Update the scoreboard from the SACK option of the received segment and
+ * drop everything the cumulative acknowledgment @p ack covers.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_options *opts = &conn->recv_options;
+	uint32_t snd_max = conn->seq + conn->send_data_total;
+
+	if (!conn->sack_enabled) {
+		return;
+	}
+
+	for (int i = 0; i < opts->sack_cnt; i++) {
+		uint32_t start = opts->sack[i].start;
+		uint32_t end = opts->sack[i].end;
+
+		/* Ignore invalid blocks and blocks reporting duplicates */
+		if (!net_tcp_seq_greater(end, start) || !net_tcp_seq_greater(end, ack) ||
+		    net_tcp_seq_greater(end, snd_max)) {
+			continue;
+		}
+
+		tcp_sack_insert(conn, start, end);
+	}
+
+	/* The option is only parsed from segments carrying options */
+	opts->sack_cnt = 0;
+
+	while (conn->sack_cnt > 0 &&
+	       !net_tcp_seq_greater(conn->sack_scoreboard[0].end, ack)) {
+		tcp_sack_remove(conn, 0);
+	}
+
+	if (conn->sack_cnt > 0 && net_tcp_seq_greater(ack, conn->sack_scoreboard[0].start)) {
+		conn->sack_scoreboard[0].start = ack;
+	}
+
+	if (conn->sack_cnt == 0) {
+		conn->sack_recovery = false;
+	}
+}
+
+/* Move the send offset past any data the peer already holds */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	for (int i = 0; i < conn->sack_cnt; i++) {
+		struct tcp_sack_block *sb = &conn->sack_scoreboard[i];
+		uint32_t next = conn->seq + conn->unacked_len;
+
+		if (net_tcp_seq_greater(sb->start, next)) {
+			break;
+		}
+
+		if (net_tcp_seq_greater(sb->end, next)) {
+			conn->unacked_len = sb->end - conn->seq;
+		}
+	}
+}
+
+/* Limit a segment sent from the current send offset to the hole in front
+ * of the next SACKed range.
+ */
+static int tcp_sack_limit(struct tcp *conn, int len)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sack_cnt; i++) {
+		struct tcp_sack_block *sb = &conn->sack_scoreboard[i];
+
+		if (net_tcp_seq_greater(sb->start, next)) {
+			return MIN(len, (int)(sb->start - next));
+		}
+	}
+
+	return len;
+}
+
+/* Out-of-order data waiting in the receive queue is reported as a single
+ * SACK block, as the queue only ever holds one contiguous range.
+ */
+static bool tcp_sack_block_get(struct tcp *conn, uint8_t flags,
+			       struct tcp_sack_block *block)
+{
+	struct net_pkt *queue = conn->queue_recv_data;
+
+	if (!conn->sack_enabled || !(flags & ACK) || (flags & (SYN | RST)) ||
+	    queue == NULL || net_pkt_is_empty(queue)) {
+		return false;
+	}
+
+	block->start = tcp_get_seq(queue->buffer);
+	block->end = block->start + net_pkt_get_len(queue);
+
+	return true;
+}
+
+#else
+
+static bool tcp_sack_negotiate(struct tcp *conn) { return false; }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+static void tcp_sack_recovery_start(struct tcp *conn) { }
+
+static void tcp_sack_update(struct tcp *conn, uint32_t ack) { }
+
+static void tcp_sack_skip(struct tcp *conn) { }
+
+static int tcp_sack_limit(struct tcp *conn, int len) { return len; }
+
+static bool tcp_sack_block_get(struct tcp *conn, uint8_t flags,
+			       struct tcp_sack_block *block)
+{
+	return false;
+}
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -1098,6 +1542,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_perm_found = false;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1143,9 +1588,36 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			recv_options->window = options[2];
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_OPT:
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_cnt = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+						     NET_TCP_SACK_MAX_BLOCKS);
+			for (int i = 0; i < recv_options->sack_cnt; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1336,6 +1808,101 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+/* Smallest shift that lets the receive window fit into the header field */
+static uint8_t tcp_wscale_get(uint32_t win)
+{
+	uint8_t shift = 0;
+
+	while (shift < NET_TCP_MAX_WIN_SCALE && (win >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+
+/* Window scaling is used in both directions only if both ends sent
+ * the option in their SYN segments.
+ */
+static void tcp_wscale_negotiate(struct tcp *conn)
+{
+	if (conn->recv_options.wnd_found) {
+		conn->snd_wscale = MIN(conn->recv_options.window, NET_TCP_MAX_WIN_SCALE);
+		conn->rcv_wscale = tcp_wscale_get(conn->recv_win_max);
+	} else {
+		conn->snd_wscale = 0;
+		conn->rcv_wscale = 0;
+	}
+}
+
+static void tcp_wscale_offer(struct tcp *conn, bool offer)
+{
+	conn->send_options.wnd_found = offer;
+	conn->send_options.window = tcp_wscale_get(conn->recv_win_max);
+}
+
+#define TCP_SND_WSCALE(conn) ((conn)->snd_wscale)
+#define TCP_RCV_WSCALE(conn) ((conn)->rcv_wscale)
+#else
+static void tcp_wscale_negotiate(struct tcp *conn) { }
+
+static void tcp_wscale_offer(struct tcp *conn, bool offer) { }
+
+#define TCP_SND_WSCALE(conn) 0
+#define TCP_RCV_WSCALE(conn) 0
+#endif
+
+/* The window field of SYN segments is never scaled */
+static uint16_t tcp_recv_win_field(struct tcp *conn, uint8_t flags)
+{
+	uint32_t win = conn->recv_win;
+
+	if (!(flags & SYN)) {
+		win >>= TCP_RCV_WSCALE(conn);
+	}
+
+	return MIN(win, UINT16_MAX);
+}
+
+static uint32_t tcp_send_win_get(struct tcp *conn, struct tcphdr *th)
+{
+	uint32_t win = ntohs(th_win(th));
+
+	if (!(th_flags(th) & SYN)) {
+		win <<= TCP_SND_WSCALE(conn);
+	}
+
+	return win;
+}
+
+/* SACK options are padded with two NOPs to keep them 32-bit aligned */
+#define TCP_SACK_PERM_OPT_LEN (2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE)
+#define TCP_SACK_OPT_LEN (2 * NET_TCP_NOP_SIZE + 2 + NET_TCP_SACK_BLOCK_SIZE)
+
+static size_t tcp_send_options_len(struct tcp *conn, uint8_t flags)
+{
+	struct tcp_sack_block block;
+	size_t len = 0;
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+	if (conn->send_options.wnd_found) {
+		len += NET_TCP_NOP_SIZE + NET_TCP_WINDOW_SCALE_SIZE;
+	}
+
+	if (conn->send_options.sack_perm_found) {
+		len += TCP_SACK_PERM_OPT_LEN;
+	}
+
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		len += TCP_SACK_OPT_LEN;
+	}
+
+	return len;
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1351,14 +1918,10 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + tcp_send_options_len(conn, flags) / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(tcp_recv_win_field(conn, flags)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -1435,6 +1998,49 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+static int tcp_set_wscale_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	uint8_t opts[NET_TCP_NOP_SIZE + NET_TCP_WINDOW_SCALE_SIZE] = {
+		NET_TCP_NOP_OPT,
+		NET_TCP_WINDOW_SCALE_OPT,
+		NET_TCP_WINDOW_SCALE_SIZE,
+		conn->send_options.window,
+	};
+
+	return net_pkt_write(pkt, opts, sizeof(opts));
+}
+
+static int tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	uint8_t opts[TCP_SACK_PERM_OPT_LEN + TCP_SACK_OPT_LEN];
+	struct tcp_sack_block block;
+	size_t len = 0;
+
+	if (conn->send_options.sack_perm_found) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_OPT;
+		opts[len++] = NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (tcp_sack_block_get(conn, flags, &block)) {
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_NOP_OPT;
+		opts[len++] = NET_TCP_SACK_OPT;
+		opts[len++] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(htonl(block.start), (uint32_t *)&opts[len]);
+		len += sizeof(uint32_t);
+		UNALIGNED_PUT(htonl(block.end), (uint32_t *)&opts[len]);
+		len += sizeof(uint32_t);
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1539,14 +2145,10 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t alloc_len = sizeof(struct tcphdr) + tcp_send_options_len(conn, flags);
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
-
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1556,6 +2158,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 		data->buffer = NULL;
 	}
 
@@ -1579,6 +2182,20 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (conn->send_options.wnd_found) {
+		ret = tcp_set_wscale_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
+	ret = tcp_set_sack_opt(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1734,17 +2351,44 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+/* Payload of a data segment, leaving room for the options sent with it */
+static int tcp_send_mss(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_send_options_len(conn, PSH | ACK);
+}
+
+/* Largest payload passed down in one packet. New data may span several
+ * segments when the interface splits the packet late.
+ */
+static int tcp_send_len_max(struct tcp *conn)
+{
+	int mss = tcp_send_mss(conn);
+
+#if defined(CONFIG_NET_TCP_GSO)
+	if (conn->data_mode == TCP_DATA_MODE_SEND && conn->iface != NULL &&
+	    net_if_l2(conn->iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return MAX(mss, ROUND_DOWN(CONFIG_NET_TCP_GSO_MAX_SIZE, mss));
+	}
+#endif
+
+	return mss;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	tcp_sack_skip(conn);
+
+	len = MIN(tcp_unsent_len(conn), tcp_send_len_max(conn));
 	if (len < 0) {
 		ret = len;
 		goto out;
 	}
+
+	len = tcp_sack_limit(conn, len);
 	if (len == 0) {
 		NET_DBG("conn: %p no data to send", conn);
 		ret = -ENODATA;
@@ -1765,6 +2409,10 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
+	if (len > tcp_send_mss(conn)) {
+		net_pkt_set_gso_size(pkt, tcp_send_mss(conn));
+	}
+
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
@@ -1790,6 +2438,42 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* During recovery, retransmit the first hole after the last retransmission
+ * that lies below the highest range SACKed by the peer, as such data is
+ * considered lost.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	int temp_unacked_len = conn->unacked_len;
+	uint32_t highest;
+
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	highest = conn->sack_scoreboard[conn->sack_cnt - 1].start;
+
+	if (net_tcp_seq_greater(conn->sack_rexmit, conn->seq)) {
+		conn->unacked_len = conn->sack_rexmit - conn->seq;
+	} else {
+		conn->unacked_len = 0;
+	}
+
+	tcp_sack_skip(conn);
+
+	if (net_tcp_seq_greater(highest, conn->seq + conn->unacked_len) &&
+	    tcp_send_data(conn) == 0) {
+		conn->sack_rexmit = conn->seq + conn->unacked_len;
+	}
+
+	/* Restore the current transmission */
+	conn->unacked_len = temp_unacked_len;
+}
+#else
+static void tcp_sack_retransmit(struct tcp *conn) { }
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1884,6 +2568,11 @@ static void tcp_resend_data(struct k_work *work)
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
+	/* The peer may have discarded SACKed data, so do not rely on it after
+	 * a retransmission timeout.
+	 */
+	tcp_sack_reset(conn);
+
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
 	if (ret == 0) {
@@ -2123,10 +2812,10 @@ static struct tcp *tcp_conn_alloc(void)
 
 	conn->in_connect = false;
 	conn->state = TCP_LISTEN;
-	conn->recv_win_max = tcp_rx_window;
+	conn->recv_win_max = MIN(tcp_rx_window, TCP_MAX_WIN);
 	conn->recv_win = conn->recv_win_max;
 	conn->recv_win_sent = conn->recv_win_max;
-	conn->send_win_max = MAX(tcp_tx_window, NET_IPV6_MTU);
+	conn->send_win_max = MIN(MAX(tcp_tx_window, NET_IPV6_MTU), TCP_MAX_WIN);
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 	conn->addr_ref_done = false;
@@ -2137,7 +2826,8 @@ static struct tcp *tcp_conn_alloc(void)
 	/* Initially set the congestion window at its max size, since only the MSS
 	 * is available as soon as the connection is established
 	 */
-	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.cwnd = TCP_MAX_WIN;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2265,6 +2955,9 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		}
 
 		conn->accepted_conn = conn_old;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+		conn->ca_ops = conn_old->ca_ops;
+#endif
 	}
 in:
 	if (conn) {
@@ -2788,6 +3481,7 @@ static void tcp_check_sock_options(struct tcp *conn)
 
 		k_mutex_lock(&conn->lock, K_FOREVER);
 
+		rcvbuf_opt = MIN(rcvbuf_opt, TCP_MAX_WIN);
 		diff = rcvbuf_opt - conn->recv_win_max;
 		conn->recv_win_max = rcvbuf_opt;
 		tcp_update_recv_wnd(conn, diff);
@@ -2892,7 +3586,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (th) {
-		conn->send_win = ntohs(th_win(th));
+		conn->send_win = tcp_send_win_get(conn, th);
 		if (conn->send_win > conn->send_win_max) {
 			NET_DBG("Lowering send window from %u to %u",
 				conn->send_win, conn->send_win_max);
@@ -2926,9 +3620,14 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			conn->send_options.sack_perm_found = tcp_sack_negotiate(conn);
+			tcp_wscale_negotiate(conn);
+			tcp_wscale_offer(conn, conn->recv_options.wnd_found);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
+			conn->send_options.sack_perm_found = false;
+			tcp_wscale_offer(conn, false);
 			conn_seq(conn, + 1);
 			next = TCP_SYN_RECEIVED;
 
@@ -2940,12 +3639,16 @@ next_state:
 			verdict = NET_OK;
 		} else {
 			conn->send_options.mss_found = true;
+			conn->send_options.sack_perm_found = IS_ENABLED(CONFIG_NET_TCP_SACK);
+			tcp_wscale_offer(conn, true);
 			ret = tcp_out_ext(conn, SYN, NULL /* no data */, conn->seq);
 			if (ret < 0) {
 				do_close = true;
 				close_status = ret;
 			} else {
 				conn->send_options.mss_found = false;
+				conn->send_options.sack_perm_found = false;
+				tcp_wscale_offer(conn, false);
 				conn_seq(conn, + 1);
 				next = TCP_SYN_SENT;
 				tcp_conn_ref(conn);
@@ -3051,6 +3754,8 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			(void)tcp_sack_negotiate(conn);
+			tcp_wscale_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3134,6 +3839,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th && FL(&fl, &, ACK)) {
+			tcp_sack_update(conn, th_ack(th));
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3160,6 +3869,7 @@ next_state:
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
+				tcp_sack_recovery_start(conn);
 
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
@@ -3168,6 +3878,11 @@ next_state:
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+				   (len == 0)) {
+				/* Every further duplicate ACK repairs one more hole */
+				tcp_sack_retransmit(conn);
 			}
 		}
 #endif
@@ -3228,6 +3943,9 @@ next_state:
 				tcp_derive_rto(conn);
 			}
 			conn->data_mode = TCP_DATA_MODE_SEND;
+
+			/* A partial ACK during recovery repairs the next hole */
+			tcp_sack_retransmit(conn);
 			if (conn->send_data_total > 0) {
 				k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
 					    K_MSEC(TCP_RTO_MS));
@@ -4106,7 +4824,9 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
+	/* Coalesced segments have been verified one by one */
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    !(IS_ENABLED(CONFIG_NET_GRO) && net_pkt_is_chksum_done(pkt)) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -4470,6 +5190,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4507,6 +5230,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -146,7 +146,7 @@
 #define conn_send_data_dump(_conn)                                             \
 	({                                                                     \
 		NET_DBG("conn: %p total=%zd, unacked_len=%d, "                 \
-			"send_win=%hu, mss=%hu",                               \
+			"send_win=%u, mss=%hu",                                \
 			(_conn), net_pkt_get_len((_conn)->send_data),          \
 			_conn->unacked_len, _conn->send_win,                   \
 			(uint16_t)conn_mss((_conn)));                          \
@@ -227,26 +227,79 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+
+/* Largest window shift allowed by RFC 7323 */
+#define NET_TCP_MAX_WIN_SCALE     14
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Maximum number of SACK blocks in a received option */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+/* Number of SACKed ranges remembered by the sender */
+#define NET_TCP_SACK_SCOREBOARD_SIZE 4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
-	uint16_t cwnd;
-	uint16_t ssthresh;
-	uint16_t pending_fast_retransmit_bytes;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t pending_fast_retransmit_bytes;
+#ifdef CONFIG_NET_TCP_CA_CUBIC
+	/* Window before the last reduction */
+	uint32_t w_max;
+	/* Window estimate of a Reno flow, for the TCP-friendly region */
+	uint32_t w_est;
+	/* Window at the start of the current epoch and target of the curve */
+	uint32_t origin;
+	/* Time from the start of the epoch to reach origin (ms) */
+	uint32_t k_ms;
+	/* Start of the current congestion avoidance epoch, 0 if none */
+	uint32_t epoch_start;
+#endif
+};
+
+struct tcp;
+
+/* Congestion control algorithm, selected per connection */
+struct tcp_ca_ops {
+	/* Name used with the TCP_CONGESTION socket option */
+	const char *name;
+	/* Connection established */
+	void (*init)(struct tcp *conn);
+	/* New data acknowledged */
+	void (*on_ack)(struct tcp *conn, uint32_t acked_len);
+	/* Duplicate acknowledgment received */
+	void (*on_dup_ack)(struct tcp *conn);
+	/* Loss detected by duplicate acknowledgments */
+	void (*on_loss)(struct tcp *conn);
+	/* Retransmission timeout */
+	void (*on_rto)(struct tcp *conn);
 };
 #endif
 
@@ -314,20 +367,30 @@ struct tcp { /* TCP connection */
 	uint32_t keep_cnt;
 	uint32_t keep_cur;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
-	uint16_t recv_win_sent;
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win_max;
-	uint16_t send_win;
+	uint32_t recv_win_sent;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win_max;
+	uint32_t send_win;
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
+#endif
+#ifdef CONFIG_NET_TCP_WINDOW_SCALE
+	uint8_t snd_wscale;
+	uint8_t rcv_wscale;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack_scoreboard[NET_TCP_SACK_SCOREBOARD_SIZE];
+	uint32_t sack_rexmit;
+	uint8_t sack_cnt;
 #endif
 	uint8_t zwp_retries;
 	bool in_retransmission : 1;
@@ -338,6 +401,10 @@ struct tcp { /* TCP connection */
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_enabled : 1;
+	bool sack_recovery : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
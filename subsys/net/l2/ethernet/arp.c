@@ -29,7 +29,12 @@ static struct arp_entry arp_entries[CONFIG_NET_ARP_TABLE_SIZE];
 
 static sys_slist_t arp_free_entries;
 static sys_slist_t arp_pending_entries;
-static sys_slist_t arp_table;
+
+/* Resolved entries, hashed by IP address for the lookup and kept in
+ * least recently used order for the replacement.
+ */
+static sys_slist_t arp_table[CONFIG_NET_ARP_TABLE_HASH_SIZE];
+static sys_dlist_t arp_lru;
 
 static struct k_work_delayable arp_request_timer;
 
@@ -88,25 +93,44 @@ static struct arp_entry *arp_entry_find(sys_slist_t *list,
 	return NULL;
 }
 
+static inline sys_slist_t *arp_table_bucket(struct in_addr *addr)
+{
+	return &arp_table[(ntohl(UNALIGNED_GET(&addr->s_addr)) * 2654435761U) %
+			  CONFIG_NET_ARP_TABLE_HASH_SIZE];
+}
+
+static inline struct arp_entry *arp_table_find(struct net_if *iface,
+					       struct in_addr *dst)
+{
+	return arp_entry_find(arp_table_bucket(dst), iface, dst, NULL);
+}
+
+static void arp_table_add(struct arp_entry *entry)
+{
+	sys_slist_prepend(arp_table_bucket(&entry->ip), &entry->node);
+	sys_dlist_prepend(&arp_lru, &entry->lru_node);
+}
+
+static void arp_table_remove(struct arp_entry *entry)
+{
+	sys_slist_find_and_remove(arp_table_bucket(&entry->ip), &entry->node);
+	sys_dlist_remove(&entry->lru_node);
+}
+
 static inline struct arp_entry *arp_entry_find_move_first(struct net_if *iface,
 							  struct in_addr *dst)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
 	NET_DBG("dst %s", net_sprint_ipv4_addr(dst));
 
-	entry = arp_entry_find(&arp_table, iface, dst, &prev);
+	entry = arp_table_find(iface, dst);
 	if (entry) {
-		/* Let's assume the target is going to be accessed
-		 * more than once here in a short time frame. So we
-		 * place the entry first in position into the table
-		 * in order to reduce subsequent find.
+		/* The entry is the most recently used one now, it will
+		 * be the last one to be replaced when the table is full.
 		 */
-		if (&entry->node != sys_slist_peek_head(&arp_table)) {
-			sys_slist_remove(&arp_table, prev, &entry->node);
-			sys_slist_prepend(&arp_table, &entry->node);
-		}
+		sys_dlist_remove(&entry->lru_node);
+		sys_dlist_prepend(&arp_lru, &entry->lru_node);
 	}
 
 	return entry;
@@ -159,20 +183,22 @@ static struct arp_entry *arp_entry_get_free(void)
 
 static struct arp_entry *arp_entry_get_last_from_table(void)
 {
-	sys_snode_t *node;
+	struct arp_entry *entry;
+	sys_dnode_t *node;
 
-	/* We assume last entry is the oldest one,
-	 * so is the preferred one to be taken out.
+	/* The least recently used entry is the preferred one
+	 * to be taken out.
 	 */
 
-	node = sys_slist_peek_tail(&arp_table);
+	node = sys_dlist_peek_tail(&arp_lru);
 	if (!node) {
 		return NULL;
 	}
 
-	sys_slist_find_and_remove(&arp_table, node);
+	entry = CONTAINER_OF(node, struct arp_entry, lru_node);
+	arp_table_remove(entry);
 
-	return CONTAINER_OF(node, struct arp_entry, node);
+	return entry;
 }
 
 
@@ -465,10 +491,9 @@ static void arp_gratuitous(struct net_if *iface,
 			   struct in_addr *src,
 			   struct net_eth_addr *hwaddr)
 {
-	sys_snode_t *prev = NULL;
 	struct arp_entry *entry;
 
-	entry = arp_entry_find(&arp_table, iface, src, &prev);
+	entry = arp_table_find(iface, src);
 	if (entry) {
 		NET_DBG("Gratuitous ARP hwaddr %s -> %s",
 			net_sprint_ll_addr((const uint8_t *)&entry->eth,
@@ -636,10 +661,9 @@ void net_arp_update(struct net_if *iface,
 		}
 
 		if (force) {
-			sys_snode_t *prev = NULL;
 			struct arp_entry *arp_ent;
 
-			arp_ent = arp_entry_find(&arp_table, iface, src, &prev);
+			arp_ent = arp_table_find(iface, src);
 			if (arp_ent) {
 				memcpy(&arp_ent->eth, hwaddr,
 				       sizeof(struct net_eth_addr));
@@ -658,7 +682,7 @@ void net_arp_update(struct net_if *iface,
 					arp_ent->iface = iface;
 					net_ipaddr_copy(&arp_ent->ip, src);
 					memcpy(&arp_ent->eth, hwaddr, sizeof(arp_ent->eth));
-					sys_slist_prepend(&arp_table, &arp_ent->node);
+					arp_table_add(arp_ent);
 				}
 			}
 		}
@@ -671,7 +695,7 @@ void net_arp_update(struct net_if *iface,
 	memcpy(&entry->eth, hwaddr, sizeof(struct net_eth_addr));
 
 	/* Inserting entry into the table */
-	sys_slist_prepend(&arp_table, &entry->node);
+	arp_table_add(entry);
 
 	while (!k_fifo_is_empty(&entry->pending_queue)) {
 		int ret;
@@ -898,20 +922,20 @@ void net_arp_clear_cache(struct net_if *iface)
 
 	k_mutex_lock(&arp_mutex, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_table, entry, next, node) {
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&arp_lru, entry, next, lru_node) {
 		if (iface && iface != entry->iface) {
-			prev = &entry->node;
 			continue;
 		}
 
+		/* The entry is hashed by its address, remove it before the
+		 * address is cleared.
+		 */
+		arp_table_remove(entry);
 		arp_entry_cleanup(entry, false);
 
-		sys_slist_remove(&arp_table, prev, &entry->node);
 		sys_slist_prepend(&arp_free_entries, &entry->node);
 	}
 
-	prev = NULL;
-
 	NET_DBG("Flushing ARP pending requests");
 
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&arp_pending_entries,
@@ -954,7 +978,7 @@ int net_arp_foreach(net_arp_cb_t cb, void *user_data)
 
 	k_mutex_lock(&arp_mutex, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&arp_table, entry, node) {
+	SYS_DLIST_FOR_EACH_CONTAINER(&arp_lru, entry, lru_node) {
 		ret++;
 		cb(entry, user_data);
 	}
@@ -974,7 +998,11 @@ void net_arp_init(void)
 
 	sys_slist_init(&arp_free_entries);
 	sys_slist_init(&arp_pending_entries);
-	sys_slist_init(&arp_table);
+	sys_dlist_init(&arp_lru);
+
+	for (i = 0; i < CONFIG_NET_ARP_TABLE_HASH_SIZE; i++) {
+		sys_slist_init(&arp_table[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_ARP_TABLE_SIZE; i++) {
 		/* Inserting entry as free with initialised packet queue */
@@ -10,6 +10,7 @@
 #if defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)
 
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 #include <zephyr/net/ethernet.h>
 
 #ifdef __cplusplus
@@ -54,6 +55,7 @@ int net_arp_clear_pending(struct net_if *iface,
 
 struct arp_entry {
 	sys_snode_t node;
+	sys_dnode_t lru_node;
 	uint32_t req_start;
 	struct net_if *iface;
 	struct in_addr ip;
@@ -41,6 +41,263 @@ static void unlock_bridge(struct eth_bridge_iface_context *ctx)
 	k_mutex_unlock(&ctx->lock);
 }
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+#define FDB_AGEING_TIME_MS (CONFIG_NET_ETHERNET_BRIDGE_FDB_AGEING_TIME * MSEC_PER_SEC)
+
+static void fdb_init(struct eth_bridge_iface_context *ctx)
+{
+	ARRAY_FOR_EACH(ctx->fdb_hash, i) {
+		sys_slist_init(&ctx->fdb_hash[i]);
+	}
+
+	sys_slist_init(&ctx->fdb_free);
+
+	ARRAY_FOR_EACH(ctx->fdb, i) {
+		sys_slist_append(&ctx->fdb_free, &ctx->fdb[i].node);
+	}
+}
+
+static sys_slist_t *fdb_bucket(struct eth_bridge_iface_context *ctx,
+			       const uint8_t *addr)
+{
+	/* The last bytes of a MAC address vary the most */
+	return &ctx->fdb_hash[(addr[3] ^ addr[4] ^ addr[5]) % ARRAY_SIZE(ctx->fdb_hash)];
+}
+
+static bool fdb_is_expired(struct eth_bridge_fdb_entry *entry, int64_t now)
+{
+	return !entry->is_static && FDB_AGEING_TIME_MS > 0 &&
+	       now - entry->last_seen > FDB_AGEING_TIME_MS;
+}
+
+static void fdb_remove(struct eth_bridge_iface_context *ctx,
+		       struct eth_bridge_fdb_entry *entry)
+{
+	sys_slist_find_and_remove(fdb_bucket(ctx, entry->addr), &entry->node);
+	sys_slist_prepend(&ctx->fdb_free, &entry->node);
+	entry->iface = NULL;
+}
+
+/* Must be called with the bridge locked. Aged out entries are removed
+ * when they are looked up.
+ */
+static struct eth_bridge_fdb_entry *fdb_lookup(struct eth_bridge_iface_context *ctx,
+					       const uint8_t *addr)
+{
+	struct eth_bridge_fdb_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(fdb_bucket(ctx, addr), entry, node) {
+		if (memcmp(entry->addr, addr, sizeof(entry->addr)) != 0) {
+			continue;
+		}
+
+		if (fdb_is_expired(entry, k_uptime_get())) {
+			fdb_remove(ctx, entry);
+			return NULL;
+		}
+
+		return entry;
+	}
+
+	return NULL;
+}
+
+static struct eth_bridge_fdb_entry *fdb_alloc(struct eth_bridge_iface_context *ctx,
+					      const uint8_t *addr)
+{
+	struct eth_bridge_fdb_entry *entry = NULL;
+	sys_snode_t *node;
+
+	node = sys_slist_get(&ctx->fdb_free);
+	if (node != NULL) {
+		entry = CONTAINER_OF(node, struct eth_bridge_fdb_entry, node);
+	} else {
+		/* Replace the least recently seen learned address */
+		ARRAY_FOR_EACH_PTR(ctx->fdb, tmp) {
+			if (tmp->is_static) {
+				continue;
+			}
+
+			if (entry == NULL || tmp->last_seen < entry->last_seen) {
+				entry = tmp;
+			}
+		}
+
+		if (entry == NULL) {
+			return NULL;
+		}
+
+		sys_slist_find_and_remove(fdb_bucket(ctx, entry->addr), &entry->node);
+	}
+
+	memcpy(entry->addr, addr, sizeof(entry->addr));
+	sys_slist_prepend(fdb_bucket(ctx, addr), &entry->node);
+
+	return entry;
+}
+
+static void fdb_learn(struct eth_bridge_iface_context *ctx,
+		      struct net_eth_addr *addr, struct net_if *iface)
+{
+	struct eth_bridge_fdb_entry *entry;
+
+	if (!net_eth_is_addr_valid(addr)) {
+		return;
+	}
+
+	entry = fdb_lookup(ctx, addr->addr);
+	if (entry == NULL) {
+		entry = fdb_alloc(ctx, addr->addr);
+		if (entry == NULL) {
+			return;
+		}
+
+		entry->is_static = false;
+
+		NET_DBG("Learned %s on iface %d",
+			net_sprint_ll_addr(addr->addr, sizeof(addr->addr)),
+			net_if_get_by_iface(iface));
+	} else if (entry->is_static) {
+		return;
+	}
+
+	entry->iface = iface;
+	entry->last_seen = k_uptime_get();
+}
+
+/* Forget the addresses reached through an interface leaving the bridge */
+static void fdb_flush_iface(struct eth_bridge_iface_context *ctx,
+			    struct net_if *iface)
+{
+	ARRAY_FOR_EACH_PTR(ctx->fdb, entry) {
+		if (entry->iface == iface) {
+			fdb_remove(ctx, entry);
+		}
+	}
+}
+
+static bool is_bridge(struct net_if *br)
+{
+	return net_if_l2(br) == &NET_L2_GET_NAME(VIRTUAL) &&
+	       (net_virtual_get_iface_capabilities(br) & VIRTUAL_INTERFACE_BRIDGE);
+}
+#endif /* CONFIG_NET_ETHERNET_BRIDGE_FDB */
+
+int eth_bridge_fdb_add(struct net_if *br, const struct net_eth_addr *addr,
+		       struct net_if *iface)
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	struct eth_bridge_iface_context *ctx;
+	struct eth_bridge_fdb_entry *entry;
+	struct ethernet_context *eth_ctx;
+	int ret = 0;
+
+	if (!is_bridge(br) || net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    !net_eth_is_addr_valid((struct net_eth_addr *)addr)) {
+		return -EINVAL;
+	}
+
+	ctx = net_if_get_device(br)->data;
+	eth_ctx = net_if_l2_data(iface);
+
+	lock_bridge(ctx);
+
+	if (eth_ctx->bridge != br) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	entry = fdb_lookup(ctx, addr->addr);
+	if (entry == NULL) {
+		entry = fdb_alloc(ctx, addr->addr);
+		if (entry == NULL) {
+			ret = -ENOMEM;
+			goto out;
+		}
+	}
+
+	entry->iface = iface;
+	entry->is_static = true;
+	entry->last_seen = k_uptime_get();
+
+out:
+	unlock_bridge(ctx);
+
+	return ret;
+#else
+	ARG_UNUSED(br);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(iface);
+
+	return -ENOTSUP;
+#endif
+}
+
+int eth_bridge_fdb_del(struct net_if *br, const struct net_eth_addr *addr)
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	struct eth_bridge_iface_context *ctx;
+	struct eth_bridge_fdb_entry *entry;
+
+	if (!is_bridge(br)) {
+		return -EINVAL;
+	}
+
+	ctx = net_if_get_device(br)->data;
+
+	lock_bridge(ctx);
+
+	entry = fdb_lookup(ctx, addr->addr);
+	if (entry != NULL) {
+		fdb_remove(ctx, entry);
+	}
+
+	unlock_bridge(ctx);
+
+	return entry != NULL ? 0 : -ENOENT;
+#else
+	ARG_UNUSED(br);
+	ARG_UNUSED(addr);
+
+	return -ENOTSUP;
+#endif
+}
+
+void eth_bridge_fdb_foreach(struct net_if *br, eth_bridge_fdb_cb_t cb,
+			    void *user_data)
+{
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	struct eth_bridge_iface_context *ctx;
+	struct eth_bridge_fdb_entry *entry, *next;
+	int64_t now = k_uptime_get();
+
+	if (!is_bridge(br)) {
+		return;
+	}
+
+	ctx = net_if_get_device(br)->data;
+
+	lock_bridge(ctx);
+
+	ARRAY_FOR_EACH(ctx->fdb_hash, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx->fdb_hash[i], entry, next, node) {
+			if (fdb_is_expired(entry, now)) {
+				fdb_remove(ctx, entry);
+				continue;
+			}
+
+			cb(entry, user_data);
+		}
+	}
+
+	unlock_bridge(ctx);
+#else
+	ARG_UNUSED(br);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+#endif
+}
+
 struct ud {
 	eth_bridge_cb_t cb;
 	void *user_data;
@@ -187,6 +444,10 @@ int eth_bridge_iface_remove(struct net_if *br, struct net_if *iface)
 			ctx->eth_iface[i] = NULL;
 			eth_ctx->bridge = NULL;
 			found = true;
+
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+			fdb_flush_iface(ctx, iface);
+#endif
 		}
 
 		/* Calculate how many interfaces are added to this bridge */
@@ -248,6 +509,10 @@ static void bridge_iface_init(struct net_if *iface)
 
 	k_mutex_init(&ctx->lock);
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	fdb_init(ctx);
+#endif
+
 	ctx->iface = iface;
 
 	net_if_flag_set(iface, NET_IF_NO_AUTO_START);
@@ -338,6 +603,7 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 					     bool is_send)
 {
 	struct eth_bridge_iface_context *ctx = net_if_get_device(iface)->data;
+	struct net_if *dst_iface = NULL;
 	struct net_if *orig_iface;
 	struct net_pkt *send_pkt;
 	size_t count;
@@ -357,11 +623,39 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 
 	count = ctx->count;
 
-	/* Pass the data to all the Ethernet interface except the originator
-	 * Ethernet interface.
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+	if (pkt->buffer != NULL && pkt->buffer->len >= sizeof(struct net_eth_hdr)) {
+		struct net_eth_hdr *hdr = NET_ETH_HDR(pkt);
+		struct eth_bridge_fdb_entry *entry;
+
+		if (!is_send) {
+			fdb_learn(ctx, &hdr->src, orig_iface);
+		}
+
+		if (!net_eth_is_addr_group(&hdr->dst)) {
+			entry = fdb_lookup(ctx, hdr->dst.addr);
+			if (entry != NULL) {
+				dst_iface = entry->iface;
+			}
+		}
+	}
+
+	/* The destination is in the network the frame came from */
+	if (dst_iface != NULL && dst_iface == orig_iface) {
+		NET_DBG("DROP: local destination");
+		goto out;
+	}
+#endif
+
+	/* Pass the data to the Ethernet interface of a known destination, or
+	 * to all the Ethernet interfaces except the originator one.
 	 */
 	ARRAY_FOR_EACH(ctx->eth_iface, i) {
 		if (ctx->eth_iface[i] != NULL && ctx->eth_iface[i] != orig_iface) {
+			if (dst_iface != NULL && ctx->eth_iface[i] != dst_iface) {
+				continue;
+			}
+
 			/* Skip it if not up */
 			if (!net_if_flag_is_set(ctx->eth_iface[i], NET_IF_UP)) {
 				continue;
@@ -370,7 +664,7 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 			/* Clone the packet if we have more than two interfaces in the bridge
 			 * because the first send might mess the data part of the message.
 			 */
-			if (count > 2) {
+			if (count > 2 && dst_iface == NULL) {
 				send_pkt = net_pkt_clone(pkt, K_NO_WAIT);
 				net_pkt_ref(send_pkt);
 			} else {
@@ -390,6 +684,9 @@ static enum net_verdict bridge_iface_process(struct net_if *iface,
 		}
 	}
 
+#if defined(CONFIG_NET_ETHERNET_BRIDGE_FDB)
+out:
+#endif
 	unlock_bridge(ctx);
 
 	/* The packet was cloned by the caller so remove it here. */
@@ -179,6 +179,123 @@ static int cmd_bridge_show(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+static struct net_if *get_bridge(const struct shell *sh, char *index_str)
+{
+	struct net_if *br;
+	int br_idx;
+
+	br_idx = get_idx(sh, index_str);
+	if (br_idx < 0) {
+		return NULL;
+	}
+
+	br = eth_bridge_get_by_index(br_idx);
+	if (br == NULL) {
+		shell_warn(sh, "Bridge %d not found\n", br_idx);
+	}
+
+	return br;
+}
+
+static void fdb_show(const struct eth_bridge_fdb_entry *entry, void *data)
+{
+	const struct shell *sh = data;
+
+	shell_fprintf(sh, SHELL_NORMAL, "%02x:%02x:%02x:%02x:%02x:%02x  %-6d",
+		      entry->addr[0], entry->addr[1], entry->addr[2],
+		      entry->addr[3], entry->addr[4], entry->addr[5],
+		      net_if_get_by_iface(entry->iface));
+
+	if (entry->is_static) {
+		shell_fprintf(sh, SHELL_NORMAL, "static\n");
+	} else {
+		shell_fprintf(sh, SHELL_NORMAL, "%lld\n",
+			      (long long)(k_uptime_get() - entry->last_seen) / MSEC_PER_SEC);
+	}
+}
+
+static int cmd_bridge_fdb(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct net_if *br;
+
+	if (!IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE_FDB)) {
+		shell_warn(sh, "%s not enabled\n", "CONFIG_NET_ETHERNET_BRIDGE_FDB");
+		return -ENOEXEC;
+	}
+
+	br = get_bridge(sh, argv[1]);
+	if (br == NULL) {
+		return -ENOENT;
+	}
+
+	shell_fprintf(sh, SHELL_NORMAL, "%-19s%-7sAge (sec)\n", "Address", "Iface");
+
+	eth_bridge_fdb_foreach(br, fdb_show, (void *)sh);
+
+	return 0;
+}
+
+static int cmd_bridge_fdbadd(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct net_eth_addr addr;
+	struct net_if *iface;
+	struct net_if *br;
+	int if_idx;
+	int ret;
+
+	br = get_bridge(sh, argv[1]);
+	if (br == NULL) {
+		return -ENOENT;
+	}
+
+	if (net_bytes_from_str(addr.addr, sizeof(addr.addr), argv[2]) < 0) {
+		shell_warn(sh, "Invalid MAC address %s\n", argv[2]);
+		return -EINVAL;
+	}
+
+	if_idx = get_idx(sh, argv[3]);
+	if (if_idx < 0) {
+		return if_idx;
+	}
+
+	iface = net_if_get_by_index(if_idx);
+	if (iface == NULL) {
+		shell_warn(sh, "Interface %d not found\n", if_idx);
+		return -ENOENT;
+	}
+
+	ret = eth_bridge_fdb_add(br, &addr, iface);
+	if (ret < 0) {
+		shell_error(sh, "error: bridge fdb add (%d)\n", ret);
+	}
+
+	return ret;
+}
+
+static int cmd_bridge_fdbdel(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct net_eth_addr addr;
+	struct net_if *br;
+	int ret;
+
+	br = get_bridge(sh, argv[1]);
+	if (br == NULL) {
+		return -ENOENT;
+	}
+
+	if (net_bytes_from_str(addr.addr, sizeof(addr.addr), argv[2]) < 0) {
+		shell_warn(sh, "Invalid MAC address %s\n", argv[2]);
+		return -EINVAL;
+	}
+
+	ret = eth_bridge_fdb_del(br, &addr);
+	if (ret < 0) {
+		shell_error(sh, "error: bridge fdb del (%d)\n", ret);
+	}
+
+	return ret;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(bridge_commands,
 	SHELL_CMD_ARG(addif, NULL,
 		  "Add a network interface to a bridge.\n"
@@ -192,6 +309,18 @@ SHELL_STATIC_SUBCMD_SET_CREATE(bridge_commands,
 		  "Show bridge information.\n"
 		  "'bridge show [<bridge_index>]'",
 		  cmd_bridge_show, 1, 1),
+	SHELL_CMD_ARG(fdb, NULL,
+		  "Show the forwarding database of a bridge.\n"
+		  "'bridge fdb <bridge_index>'",
+		  cmd_bridge_fdb, 2, 0),
+	SHELL_CMD_ARG(fdbadd, NULL,
+		  "Add a static forwarding database entry.\n"
+		  "'bridge fdbadd <bridge_index> <MAC address> <interface index>'",
+		  cmd_bridge_fdbadd, 4, 0),
+	SHELL_CMD_ARG(fdbdel, NULL,
+		  "Delete a forwarding database entry.\n"
+		  "'bridge fdbdel <bridge_index> <MAC address>'",
+		  cmd_bridge_fdbdel, 3, 0),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include <zephyr/net/ethernet_mgmt.h>
 #include <zephyr/net/gptp.h>
 #include <zephyr/random/random.h>
+#include <zephyr/cache.h>
 
 #if defined(CONFIG_NET_LLDP)
 #include <zephyr/net/lldp.h>
@@ -615,6 +616,187 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
+#if defined(CONFIG_NET_GSO)
+/* TCP flags only carried by the last segment of a large send */
+#define ETH_GSO_TCP_FIN BIT(0)
+#define ETH_GSO_TCP_PSH BIT(3)
+
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt);
+
+/* Transport protocol of a large send, the IP header is contiguous */
+static uint8_t ethernet_gso_proto(struct net_pkt *pkt)
+{
+	if (net_pkt_family(pkt) == AF_INET) {
+		return NET_IPV4_HDR(pkt)->proto;
+	}
+
+	return NET_IPV6_HDR(pkt)->nexthdr;
+}
+
+static int ethernet_gso_fix_tcp(struct net_pkt *seg, size_t offset, bool last)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	sys_put_be32(sys_get_be32(tcp_hdr->seq) + offset, tcp_hdr->seq);
+	if (!last) {
+		tcp_hdr->flags &= ~(ETH_GSO_TCP_PSH | ETH_GSO_TCP_FIN);
+	}
+
+	return net_pkt_set_data(seg, &tcp_access);
+}
+
+static struct net_pkt *ethernet_gso_segment(struct net_if *iface,
+					    struct net_pkt *pkt, uint8_t proto,
+					    size_t hdr_len, size_t offset,
+					    size_t len, bool last)
+{
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	struct net_pkt *seg;
+	int ret;
+
+	seg = net_pkt_alloc_with_buffer(iface, hdr_len + len,
+					net_pkt_family(pkt), proto,
+					NET_BUF_TIMEOUT);
+	if (!seg) {
+		return NULL;
+	}
+
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	if (net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else {
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+	}
+
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+	       sizeof(struct net_linkaddr));
+	memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+	       sizeof(struct net_linkaddr));
+
+	/* Headers first, then this segment's share of the payload */
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_copy(seg, pkt, hdr_len) < 0 ||
+	    net_pkt_skip(pkt, offset) < 0 ||
+	    net_pkt_copy(seg, pkt, len) < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_len) < 0) {
+		goto fail;
+	}
+
+	/* UDP datagrams only differ in their length and checksum, which
+	 * the finalize step below sets.
+	 */
+	if (proto == IPPROTO_TCP && ethernet_gso_fix_tcp(seg, offset, last) < 0) {
+		goto fail;
+	}
+
+	net_pkt_cursor_init(seg);
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		ret = net_ipv4_finalize(seg, proto);
+	} else {
+		ret = net_ipv6_finalize(seg, proto);
+	}
+
+	if (ret < 0) {
+		goto fail;
+	}
+
+	net_pkt_set_overwrite(seg, false);
+	net_pkt_cursor_init(seg);
+
+	return seg;
+
+fail:
+	net_pkt_unref(seg);
+
+	return NULL;
+}
+
+/* Split a large TCP or UDP packet into segments of net_pkt_gso_size()
+ * bytes of payload, for devices that cannot do it themselves.
+ */
+static int ethernet_gso_send(struct net_if *iface, struct net_pkt *pkt,
+			     uint8_t proto)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	size_t gso_size = net_pkt_gso_size(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	size_t payload_len;
+	size_t hdr_len;
+	size_t offset;
+	int total = 0;
+	int ret;
+
+	if (proto == IPPROTO_UDP) {
+		hdr_len = ip_len + NET_UDPH_LEN;
+	} else {
+		net_pkt_cursor_init(pkt);
+		if (net_pkt_skip(pkt, ip_len) < 0) {
+			return -EINVAL;
+		}
+
+		tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+		if (!tcp_hdr) {
+			return -EINVAL;
+		}
+
+		hdr_len = ip_len + ((tcp_hdr->offset >> 4) * 4U);
+	}
+
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+
+	for (offset = 0; offset < payload_len; offset += gso_size) {
+		size_t len = MIN(gso_size, payload_len - offset);
+		struct net_pkt *seg;
+
+		seg = ethernet_gso_segment(iface, pkt, proto, hdr_len, offset,
+					   len, offset + len == payload_len);
+		if (!seg) {
+			return -ENOMEM;
+		}
+
+		ret = ethernet_send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		total += ret;
+	}
+
+	net_pkt_unref(pkt);
+
+	return total;
+}
+
+/* Whether the device splits large sends of this protocol itself */
+static bool ethernet_gso_offloaded(struct net_if *iface, uint8_t proto)
+{
+	enum ethernet_hw_caps caps = net_eth_get_hw_capabilities(iface);
+
+	if (proto == IPPROTO_UDP) {
+		return (caps & ETHERNET_HW_USO) != 0;
+	}
+
+	return (caps & ETHERNET_HW_TSO) != 0;
+}
+#endif /* CONFIG_NET_GSO */
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -641,6 +823,21 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		goto send;
 	}
 
+#if defined(CONFIG_NET_GSO)
+	if (net_pkt_gso_size(pkt) > 0) {
+		uint8_t proto = ethernet_gso_proto(pkt);
+
+		if (proto != IPPROTO_TCP && proto != IPPROTO_UDP) {
+			ret = -EINVAL;
+			goto error;
+		}
+
+		if (!ethernet_gso_offloaded(iface, proto)) {
+			return ethernet_gso_send(iface, pkt, proto);
+		}
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_IPV4) &&
 	    net_pkt_family(pkt) == AF_INET) {
 		struct net_pkt *tmp;
@@ -864,6 +1061,31 @@ void net_eth_carrier_off(struct net_if *iface)
 	}
 }
 
+struct net_buf *net_eth_rx_dma_buf_alloc(size_t size, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	buf = net_pkt_get_reserve_rx_data(size, timeout);
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	if (buf->size < size) {
+		net_buf_unref(buf);
+		return NULL;
+	}
+
+	(void)sys_cache_data_invd_range(buf->data, buf->size);
+
+	return buf;
+}
+
+void net_eth_rx_dma_buf_complete(struct net_buf *buf, size_t len)
+{
+	(void)sys_cache_data_invd_range(buf->data, len);
+	net_buf_add(buf, len);
+}
+
 const struct device *net_eth_get_phy(struct net_if *iface)
 {
 	const struct device *dev = net_if_get_device(iface);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/net/ethernet.h>
+
+static K_KERNEL_STACK_DEFINE(rx_poll_stack, CONFIG_NET_ETHERNET_RX_POLL_STACK_SIZE);
+static struct k_work_q rx_poll_work_q;
+
+static void rx_poll_handler(struct k_work *work)
+{
+	struct net_eth_rx_poll *rx_poll = CONTAINER_OF(work, struct net_eth_rx_poll, work);
+	int count;
+
+	count = rx_poll->cb(rx_poll, rx_poll->budget);
+	if (count >= rx_poll->budget) {
+		/* More frames are waiting. The RX interrupt stays disabled and
+		 * the device is polled again after the others.
+		 */
+		k_work_submit_to_queue(&rx_poll_work_q, &rx_poll->work);
+	}
+}
+
+void net_eth_rx_poll_init(struct net_eth_rx_poll *rx_poll,
+			  net_eth_rx_poll_cb_t cb, int budget)
+{
+	k_work_init(&rx_poll->work, rx_poll_handler);
+	rx_poll->cb = cb;
+	rx_poll->budget = budget > 0 ? budget : CONFIG_NET_ETHERNET_RX_POLL_BUDGET;
+}
+
+void net_eth_rx_poll_schedule(struct net_eth_rx_poll *rx_poll)
+{
+	k_work_submit_to_queue(&rx_poll_work_q, &rx_poll->work);
+}
+
+static int rx_poll_init(void)
+{
+	struct k_work_queue_config cfg = { .name = "eth_rx_poll" };
+
+	k_work_queue_init(&rx_poll_work_q);
+	k_work_queue_start(&rx_poll_work_q, rx_poll_stack,
+			   K_KERNEL_STACK_SIZEOF(rx_poll_stack),
+			   K_PRIO_PREEMPT(CONFIG_NET_ETHERNET_RX_POLL_THREAD_PRIO),
+			   &cfg);
+
+	return 0;
+}
+
+SYS_INIT(rx_poll_init, POST_KERNEL, 0);
@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
 #include "ipv6.h"
 #include "udp_internal.h"
 #include "net_stats.h"
+#include "filter.h"
 
 #define PKT_ALLOC_TIME K_MSEC(50)
 #define DEFAULT_PORT 4242
@@ -84,6 +85,14 @@ struct net_capture {
 	 */
 	struct sockaddr local;
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	/**
+	 * Filter selecting the captured packets, none if filter_len is 0.
+	 */
+	struct net_capture_filter filter[CONFIG_NET_CAPTURE_FILTER_MAX_LEN];
+	size_t filter_len;
+#endif
+
 	/**
 	 * Is this context setup already
 	 */
@@ -131,6 +140,11 @@ void net_capture_foreach(net_capture_cb_t cb, void *user_data)
 		info.peer = &ctx->peer;
 		info.local = &ctx->local;
 		info.is_enabled = ctx->is_enabled;
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+		info.filter_len = ctx->filter_len;
+#else
+		info.filter_len = 0;
+#endif
 
 		k_mutex_unlock(&lock);
 		cb(&info, user_data);
@@ -536,6 +550,14 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 			continue;
 		}
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+		if (ctx->filter_len > 0 &&
+		    !net_capture_filter_run(ctx->filter, ctx->filter_len, pkt)) {
+			/* Not captured, so a cooked packet is freed by the caller */
+			goto out;
+		}
+#endif
+
 		/* If the packet is marked as "cooked", then it means that the
 		 * packet was directed here by "any" interface and was already
 		 * cooked mode captured. So no need to clone it here.
@@ -715,12 +737,45 @@ static int capture_send(const struct device *dev, struct net_if *iface,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+static int capture_set_filter(const struct device *dev,
+			      const struct net_capture_filter *prog, size_t len)
+{
+	struct net_capture *ctx = dev->data;
+	int ret;
+
+	if (prog != NULL && len > 0) {
+		ret = net_capture_filter_check(prog, len);
+		if (ret < 0) {
+			return ret;
+		}
+	} else {
+		len = 0;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	if (len > 0) {
+		memcpy(ctx->filter, prog, len * sizeof(*prog));
+	}
+
+	ctx->filter_len = len;
+
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+#endif
+
 static const struct net_capture_interface_api capture_interface_api = {
 	.cleanup = capture_cleanup,
 	.enable = capture_enable,
 	.disable = capture_disable,
 	.is_enabled = capture_is_enabled,
 	.send = capture_send,
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	.set_filter = capture_set_filter,
+#endif
 };
 
 #define DEFINE_NET_CAPTURE_DEV_DATA(x, _)				\
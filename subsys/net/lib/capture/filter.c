@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "filter.h"
+
+/* Instruction classes */
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_LD   0x00
+#define BPF_LDX  0x01
+#define BPF_ST   0x02
+#define BPF_STX  0x03
+#define BPF_ALU  0x04
+#define BPF_JMP  0x05
+#define BPF_RET  0x06
+#define BPF_MISC 0x07
+
+/* Load size */
+#define BPF_SIZE(code) ((code) & 0x18)
+#define BPF_W 0x00
+#define BPF_H 0x08
+#define BPF_B 0x10
+
+/* Load mode */
+#define BPF_MODE(code) ((code) & 0xe0)
+#define BPF_IMM 0x00
+#define BPF_ABS 0x20
+#define BPF_IND 0x40
+#define BPF_MEM 0x60
+#define BPF_LEN 0x80
+#define BPF_MSH 0xa0
+
+/* ALU and jump operations */
+#define BPF_OP(code) ((code) & 0xf0)
+#define BPF_ADD  0x00
+#define BPF_SUB  0x10
+#define BPF_MUL  0x20
+#define BPF_DIV  0x30
+#define BPF_OR   0x40
+#define BPF_AND  0x50
+#define BPF_LSH  0x60
+#define BPF_RSH  0x70
+#define BPF_NEG  0x80
+#define BPF_MOD  0x90
+#define BPF_XOR  0xa0
+
+#define BPF_JA   0x00
+#define BPF_JEQ  0x10
+#define BPF_JGT  0x20
+#define BPF_JGE  0x30
+#define BPF_JSET 0x40
+
+/* Operand source */
+#define BPF_SRC(code) ((code) & 0x08)
+#define BPF_K 0x00
+#define BPF_X 0x08
+
+/* Return value source */
+#define BPF_RVAL(code) ((code) & 0x18)
+#define BPF_A 0x10
+
+/* Miscellaneous operations */
+#define BPF_MISCOP(code) ((code) & 0xf8)
+#define BPF_TAX 0x00
+#define BPF_TXA 0x80
+
+#define BPF_MEMWORDS 16
+
+static bool filter_load(struct net_pkt *pkt, uint32_t offset, uint8_t *data, size_t len)
+{
+	struct net_buf *frag = pkt->buffer;
+
+	/* Walk the fragments directly, so the packet cursor is left as is */
+	while (frag != NULL && offset >= frag->len) {
+		offset -= frag->len;
+		frag = frag->frags;
+	}
+
+	while (len > 0) {
+		size_t count;
+
+		if (frag == NULL) {
+			return false;
+		}
+
+		count = MIN(len, frag->len - offset);
+		memcpy(data, frag->data + offset, count);
+
+		data += count;
+		len -= count;
+		offset = 0;
+		frag = frag->frags;
+	}
+
+	return true;
+}
+
+static bool filter_load_size(struct net_pkt *pkt, uint16_t code, uint32_t offset,
+			     uint32_t *value)
+{
+	uint8_t data[sizeof(uint32_t)];
+
+	switch (BPF_SIZE(code)) {
+	case BPF_W:
+		if (!filter_load(pkt, offset, data, sizeof(uint32_t))) {
+			return false;
+		}
+
+		*value = sys_get_be32(data);
+		return true;
+
+	case BPF_H:
+		if (!filter_load(pkt, offset, data, sizeof(uint16_t))) {
+			return false;
+		}
+
+		*value = sys_get_be16(data);
+		return true;
+
+	case BPF_B:
+		if (!filter_load(pkt, offset, data, sizeof(uint8_t))) {
+			return false;
+		}
+
+		*value = data[0];
+		return true;
+	}
+
+	return false;
+}
+
+int net_capture_filter_check(const struct net_capture_filter *prog, size_t len)
+{
+	if (len == 0 || len > CONFIG_NET_CAPTURE_FILTER_MAX_LEN) {
+		return -EINVAL;
+	}
+
+	for (size_t pc = 0; pc < len; pc++) {
+		const struct net_capture_filter *insn = &prog[pc];
+		size_t remaining = len - pc - 1;
+
+		switch (BPF_CLASS(insn->code)) {
+		case BPF_LD:
+		case BPF_LDX:
+			if (BPF_MODE(insn->code) == BPF_MEM && insn->k >= BPF_MEMWORDS) {
+				return -EINVAL;
+			}
+
+			break;
+
+		case BPF_ST:
+		case BPF_STX:
+			if (insn->k >= BPF_MEMWORDS) {
+				return -EINVAL;
+			}
+
+			break;
+
+		case BPF_ALU:
+			if ((BPF_OP(insn->code) == BPF_DIV || BPF_OP(insn->code) == BPF_MOD) &&
+			    BPF_SRC(insn->code) == BPF_K && insn->k == 0) {
+				return -EINVAL;
+			}
+
+			break;
+
+		case BPF_JMP:
+			/* Jumps only go forward, so every program terminates */
+			if (BPF_OP(insn->code) == BPF_JA) {
+				if (insn->k > remaining) {
+					return -EINVAL;
+				}
+			} else if (insn->jt > remaining || insn->jf > remaining) {
+				return -EINVAL;
+			}
+
+			break;
+
+		case BPF_RET:
+		case BPF_MISC:
+			break;
+		}
+	}
+
+	if (BPF_CLASS(prog[len - 1].code) != BPF_RET) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+bool net_capture_filter_run(const struct net_capture_filter *prog, size_t len,
+			    struct net_pkt *pkt)
+{
+	uint32_t mem[BPF_MEMWORDS] = { 0 };
+	uint32_t a = 0U;
+	uint32_t x = 0U;
+
+	for (size_t pc = 0; pc < len; pc++) {
+		const struct net_capture_filter *insn = &prog[pc];
+		uint32_t operand;
+
+		switch (BPF_CLASS(insn->code)) {
+		case BPF_LD:
+			switch (BPF_MODE(insn->code)) {
+			case BPF_IMM:
+				a = insn->k;
+				break;
+			case BPF_ABS:
+				if (!filter_load_size(pkt, insn->code, insn->k, &a)) {
+					return false;
+				}
+				break;
+			case BPF_IND:
+				if (!filter_load_size(pkt, insn->code, x + insn->k, &a)) {
+					return false;
+				}
+				break;
+			case BPF_MEM:
+				a = mem[insn->k];
+				break;
+			case BPF_LEN:
+				a = net_pkt_get_len(pkt);
+				break;
+			default:
+				return false;
+			}
+
+			break;
+
+		case BPF_LDX:
+			switch (BPF_MODE(insn->code)) {
+			case BPF_IMM:
+				x = insn->k;
+				break;
+			case BPF_MEM:
+				x = mem[insn->k];
+				break;
+			case BPF_LEN:
+				x = net_pkt_get_len(pkt);
+				break;
+			case BPF_MSH: {
+				uint8_t byte;
+
+				/* Length of an IPv4 header */
+				if (!filter_load(pkt, insn->k, &byte, sizeof(byte))) {
+					return false;
+				}
+
+				x = (byte & 0x0f) * 4U;
+				break;
+			}
+			default:
+				return false;
+			}
+
+			break;
+
+		case BPF_ST:
+			mem[insn->k] = a;
+			break;
+
+		case BPF_STX:
+			mem[insn->k] = x;
+			break;
+
+		case BPF_ALU:
+			operand = BPF_SRC(insn->code) == BPF_X ? x : insn->k;
+
+			switch (BPF_OP(insn->code)) {
+			case BPF_ADD:
+				a += operand;
+				break;
+			case BPF_SUB:
+				a -= operand;
+				break;
+			case BPF_MUL:
+				a *= operand;
+				break;
+			case BPF_DIV:
+				if (operand == 0U) {
+					return false;
+				}
+				a /= operand;
+				break;
+			case BPF_MOD:
+				if (operand == 0U) {
+					return false;
+				}
+				a %= operand;
+				break;
+			case BPF_OR:
+				a |= operand;
+				break;
+			case BPF_AND:
+				a &= operand;
+				break;
+			case BPF_XOR:
+				a ^= operand;
+				break;
+			case BPF_LSH:
+				a = operand < 32U ? a << operand : 0U;
+				break;
+			case BPF_RSH:
+				a = operand < 32U ? a >> operand : 0U;
+				break;
+			case BPF_NEG:
+				a = -a;
+				break;
+			default:
+				return false;
+			}
+
+			break;
+
+		case BPF_JMP:
+			operand = BPF_SRC(insn->code) == BPF_X ? x : insn->k;
+
+			switch (BPF_OP(insn->code)) {
+			case BPF_JA:
+				pc += insn->k;
+				break;
+			case BPF_JEQ:
+				pc += (a == operand) ? insn->jt : insn->jf;
+				break;
+			case BPF_JGT:
+				pc += (a > operand) ? insn->jt : insn->jf;
+				break;
+			case BPF_JGE:
+				pc += (a >= operand) ? insn->jt : insn->jf;
+				break;
+			case BPF_JSET:
+				pc += (a & operand) ? insn->jt : insn->jf;
+				break;
+			default:
+				return false;
+			}
+
+			break;
+
+		case BPF_RET:
+			switch (BPF_RVAL(insn->code)) {
+			case BPF_K:
+				return insn->k != 0U;
+			case BPF_X:
+				return x != 0U;
+			case BPF_A:
+				return a != 0U;
+			default:
+				return false;
+			}
+
+		case BPF_MISC:
+			if (BPF_MISCOP(insn->code) == BPF_TAX) {
+				x = a;
+			} else if (BPF_MISCOP(insn->code) == BPF_TXA) {
+				a = x;
+			} else {
+				return false;
+			}
+
+			break;
+		}
+	}
+
+	return false;
+}
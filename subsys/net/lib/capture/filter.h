@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Classic BPF packet filter used to select the captured packets */
+
+#include <zephyr/kernel.h>
+#include <zephyr/types.h>
+#include <zephyr/net/capture.h>
+
+struct net_pkt;
+
+/* Validate a filter program, returns 0 if it can be run safely */
+int net_capture_filter_check(const struct net_capture_filter *prog, size_t len);
+
+/* Run a validated filter program, returns true if the packet is to be captured */
+bool net_capture_filter_run(const struct net_capture_filter *prog, size_t len,
+			    struct net_pkt *pkt);
@@ -63,12 +63,29 @@ static void reset_block_contexts(struct coap_client_internal_request *request)
 	request->send_blk_ctx.current = 0;
 }
 
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+static void window_reset(struct coap_client_internal_request *request)
+{
+	ARRAY_FOR_EACH_PTR(request->window, slot) {
+		slot->active = false;
+		coap_pending_clear(&slot->pending);
+	}
+
+	request->window_blocks = 0;
+	request->window_next = 0;
+	request->window_received = 0;
+}
+#endif
+
 static void reset_internal_request(struct coap_client_internal_request *request)
 {
 	request->offset = 0;
 	request->last_id = 0;
 	request->last_response_id = -1;
 	reset_block_contexts(request);
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+	window_reset(request);
+#endif
 }
 
 static int coap_client_schedule_poll(struct coap_client *client, int sock,
@@ -259,6 +276,18 @@ static int coap_client_init_request(struct coap_client *client,
 		}
 	}
 
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+	/* Ask for the size of the resource, so that its blocks can be requested in parallel */
+	if (!block2 && req->method == COAP_METHOD_GET && req->payload == NULL) {
+		ret = coap_append_option_int(&internal_req->request, COAP_OPTION_SIZE2, 0);
+
+		if (ret < 0) {
+			LOG_ERR("Failed to append size2 option");
+			goto out;
+		}
+	}
+#endif
+
 	if (req->payload) {
 		uint16_t payload_len;
 		uint16_t offset;
@@ -495,6 +524,102 @@ static int resend_request(struct coap_client *client,
 	return ret;
 }
 
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+static int window_send_block(struct coap_client *client,
+			     struct coap_client_internal_request *internal_req,
+			     struct coap_client_block_slot *slot, bool init_pending)
+{
+	struct coap_client_request *req = &internal_req->coap_request;
+	struct coap_block_context blk_ctx = internal_req->recv_blk_ctx;
+	struct coap_packet request;
+	int ret;
+
+	blk_ctx.current = slot->num * coap_block_size_to_bytes(blk_ctx.block_size);
+
+	memset(client->send_buf, 0, sizeof(client->send_buf));
+
+	ret = coap_packet_init(&request, client->send_buf, MAX_COAP_MSG_LEN, COAP_VERSION,
+			       req->confirmable ? COAP_TYPE_CON : COAP_TYPE_NON_CON,
+			       COAP_TOKEN_MAX_LEN, slot->token, req->method, slot->id);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = coap_packet_set_path(&request, req->path);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = coap_append_block2_option(&request, &blk_ctx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (int i = 0; i < req->num_options; i++) {
+		if (req->options[i].code == COAP_OPTION_BLOCK2) {
+			continue;
+		}
+
+		ret = coap_packet_append_option(&request, req->options[i].code,
+						req->options[i].value, req->options[i].len);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (init_pending && req->confirmable) {
+		struct coap_transmission_parameters params = internal_req->pending.params;
+
+		ret = coap_pending_init(&slot->pending, &request, &client->address, &params);
+		if (ret < 0) {
+			return ret;
+		}
+
+		coap_pending_cycle(&slot->pending);
+	}
+
+	ret = send_request(client->fd, request.data, request.offset, 0, &client->address,
+			   client->socklen);
+
+	return ret < 0 ? -errno : 0;
+}
+
+static bool window_timeout_expired(struct coap_client_block_slot *slot)
+{
+	return slot->active && slot->pending.timeout != 0 &&
+	       slot->pending.timeout <= (k_uptime_get() - slot->pending.t0);
+}
+
+static void window_abort(struct coap_client_internal_request *internal_req, int error_code)
+{
+	report_callback_error(internal_req, error_code);
+	window_reset(internal_req);
+	internal_req->request_ongoing = false;
+}
+
+static int window_resend(struct coap_client *client,
+			 struct coap_client_internal_request *internal_req,
+			 struct coap_client_block_slot *slot)
+{
+	int ret;
+
+	if (!coap_pending_cycle(&slot->pending)) {
+		LOG_ERR("Timeout for block %u, no more retries left", slot->num);
+		window_abort(internal_req, -ETIMEDOUT);
+		return -ETIMEDOUT;
+	}
+
+	LOG_DBG("Timeout for block %u, retrying send", slot->num);
+
+	ret = window_send_block(client, internal_req, slot, false);
+	if (ret < 0) {
+		LOG_ERR("Failed to resend block request, %d", ret);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1 */
+
 static int coap_client_resend_handler(void)
 {
 	int ret = 0;
@@ -506,6 +631,15 @@ static int coap_client_resend_handler(void)
 			if (timeout_expired(&clients[i]->requests[j])) {
 				ret = resend_request(clients[i], &clients[i]->requests[j]);
 			}
+
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+			ARRAY_FOR_EACH_PTR(clients[i]->requests[j].window, slot) {
+				if (clients[i]->requests[j].request_ongoing &&
+				    window_timeout_expired(slot)) {
+					ret = window_resend(clients[i], &clients[i]->requests[j], slot);
+				}
+			}
+#endif
 		}
 
 		k_mutex_unlock(&clients[i]->lock);
@@ -653,6 +787,178 @@ static int send_ack(struct coap_client *client, const struct coap_packet *req,
 	return 0;
 }
 
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+static struct coap_client_block_slot *window_find_slot(
+	struct coap_client_internal_request *internal_req, const struct coap_packet *resp)
+{
+	uint8_t response_token[COAP_TOKEN_MAX_LEN];
+	uint8_t response_tkl;
+
+	if (!internal_req->request_ongoing || internal_req->window_blocks == 0) {
+		return NULL;
+	}
+
+	response_tkl = coap_header_get_token(resp, response_token);
+
+	ARRAY_FOR_EACH_PTR(internal_req->window, slot) {
+		if (!slot->active) {
+			continue;
+		}
+
+		/* Empty ACKs only carry the message ID */
+		if (response_tkl == 0 && coap_header_get_type(resp) == COAP_TYPE_ACK) {
+			if (slot->id == coap_header_get_id(resp)) {
+				return slot;
+			}
+		} else if (response_tkl == COAP_TOKEN_MAX_LEN &&
+			   memcmp(slot->token, response_token, response_tkl) == 0) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+static bool window_eligible(struct coap_client_internal_request *internal_req)
+{
+	struct coap_client_request *req = &internal_req->coap_request;
+
+	if (req->payload != NULL || internal_req->recv_blk_ctx.total_size == 0) {
+		return false;
+	}
+
+	/* Notifications keep the token of the request */
+	for (int i = 0; i < req->num_options; i++) {
+		if (req->options[i].code == COAP_OPTION_OBSERVE) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int window_open_slot(struct coap_client *client,
+			    struct coap_client_internal_request *internal_req,
+			    struct coap_client_block_slot *slot)
+{
+	memcpy(slot->token, coap_next_token(), COAP_TOKEN_MAX_LEN);
+	slot->id = coap_next_id();
+	slot->num = internal_req->window_next++;
+	slot->active = true;
+
+	return window_send_block(client, internal_req, slot, true);
+}
+
+/* Request the remaining blocks, up to the window size, after the block given
+ * to the application last.
+ */
+static int window_start(struct coap_client *client,
+			struct coap_client_internal_request *internal_req)
+{
+	uint16_t block_bytes = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	int ret;
+
+	internal_req->window_blocks = DIV_ROUND_UP(internal_req->recv_blk_ctx.total_size,
+						   block_bytes);
+	internal_req->window_next = internal_req->recv_blk_ctx.current / block_bytes;
+	internal_req->window_received = internal_req->window_next;
+
+	LOG_DBG("Requesting %u blocks, window %d",
+		internal_req->window_blocks - internal_req->window_next,
+		CONFIG_COAP_CLIENT_BLOCK_WINDOW);
+
+	ARRAY_FOR_EACH_PTR(internal_req->window, slot) {
+		if (internal_req->window_next >= internal_req->window_blocks) {
+			break;
+		}
+
+		ret = window_open_slot(client, internal_req, slot);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int window_handle_response(struct coap_client *client,
+				  struct coap_client_internal_request *internal_req,
+				  struct coap_client_block_slot *slot,
+				  const struct coap_packet *response)
+{
+	uint16_t block_bytes = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	uint8_t response_type = coap_header_get_type(response);
+	uint8_t response_code = coap_header_get_code(response);
+	const uint8_t *payload;
+	uint16_t payload_len;
+	int block_option;
+	bool last_block;
+	int ret;
+
+	payload = coap_packet_get_payload(response, &payload_len);
+
+	/* Separate response coming */
+	if (payload_len == 0 && response_type == COAP_TYPE_ACK &&
+	    response_code == COAP_CODE_EMPTY) {
+		slot->pending.t0 = k_uptime_get();
+		slot->pending.timeout = slot->pending.t0 + COAP_SEPARATE_TIMEOUT;
+		slot->pending.retries = 0;
+		return 1;
+	}
+
+	if (response_type == COAP_TYPE_CON) {
+		ret = send_ack(client, response, COAP_CODE_EMPTY);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	coap_pending_clear(&slot->pending);
+	slot->active = false;
+
+	block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	if ((response_code >> 5) != 2 || block_option < 0 ||
+	    GET_BLOCK_NUM(block_option) != slot->num ||
+	    GET_BLOCK_SIZE(block_option) != internal_req->recv_blk_ctx.block_size) {
+		LOG_ERR("Unexpected response %d.%02d to block %u",
+			response_code >> 5, response_code & 0x1f, slot->num);
+		window_abort(internal_req, -EBADMSG);
+		return -EBADMSG;
+	}
+
+	internal_req->window_received++;
+	last_block = internal_req->window_received == internal_req->window_blocks;
+
+	if (internal_req->coap_request.cb) {
+		if (!atomic_set(&internal_req->in_callback, 1)) {
+			internal_req->coap_request.cb(response_code, slot->num * block_bytes,
+						      payload, MIN(payload_len, block_bytes),
+						      last_block,
+						      internal_req->coap_request.user_data);
+			atomic_clear(&internal_req->in_callback);
+		}
+	}
+
+	if (!internal_req->request_ongoing || last_block) {
+		/* Done, or the user callback called coap_client_cancel_requests() */
+		window_reset(internal_req);
+		internal_req->request_ongoing = false;
+		return 0;
+	}
+
+	if (internal_req->window_next < internal_req->window_blocks) {
+		ret = window_open_slot(client, internal_req, slot);
+		if (ret < 0) {
+			LOG_ERR("Error sending a CoAP request");
+			window_abort(internal_req, ret);
+			return ret;
+		}
+	}
+
+	return 1;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1 */
+
 static struct coap_client_internal_request *get_request_with_token(
 	struct coap_client *client, const struct coap_packet *resp)
 {
@@ -665,6 +971,11 @@ static struct coap_client_internal_request *get_request_with_token(
 	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
 		if (client->requests[i].request_ongoing ||
 		    !exchange_lifetime_exceeded(&client->requests[i])) {
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+			if (window_find_slot(&client->requests[i], resp) != NULL) {
+				return &client->requests[i];
+			}
+#endif
 			if (client->requests[i].request_tkl != response_tkl) {
 				continue;
 			}
@@ -703,6 +1014,19 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 	response_type = coap_header_get_type(response);
 
 	internal_req = get_request_with_token(client, response);
+
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+	if (internal_req != NULL && response_type != COAP_TYPE_RESET) {
+		struct coap_client_block_slot *slot = window_find_slot(internal_req, response);
+
+		if (slot != NULL) {
+			ret = window_handle_response(client, internal_req, slot, response);
+			client->response_ready = false;
+			return ret;
+		}
+	}
+#endif
+
 	/* Reset and Ack need to match the message ID with request */
 	if ((response_type == COAP_TYPE_ACK || response_type == COAP_TYPE_RESET) &&
 	     internal_req == NULL)  {
@@ -864,6 +1188,19 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+		if (block_option > 0 && window_eligible(internal_req)) {
+			ret = window_start(client, internal_req);
+			if (ret < 0) {
+				LOG_ERR("Error sending a CoAP request");
+				window_reset(internal_req);
+				goto fail;
+			}
+
+			return 1;
+		}
+#endif
+
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
 
@@ -914,6 +1251,9 @@ void coap_client_cancel_requests(struct coap_client *client)
 			report_callback_error(&client->requests[i], -ECANCELED);
 			client->requests[i].request_ongoing = false;
 			client->requests[i].is_observe = false;
+#if CONFIG_COAP_CLIENT_BLOCK_WINDOW > 1
+			window_reset(&client->requests[i]);
+#endif
 		}
 	}
 	atomic_clear(&coap_client_recv_active);
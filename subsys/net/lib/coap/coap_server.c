@@ -33,6 +33,7 @@ LOG_MODULE_DECLARE(net_coap, CONFIG_COAP_LOG_LEVEL);
 #define MAX_OPTIONS    CONFIG_COAP_SERVER_MESSAGE_OPTIONS
 #define MAX_PENDINGS   CONFIG_COAP_SERVICE_PENDING_MESSAGES
 #define MAX_OBSERVERS  CONFIG_COAP_SERVICE_OBSERVERS
+#define INDEX_SIZE     CONFIG_COAP_SERVICE_RESOURCE_INDEX_SIZE
 #define MAX_POLL_FD    CONFIG_ZVFS_POLL_MAX
 
 BUILD_ASSERT(CONFIG_ZVFS_POLL_MAX > 0, "CONFIG_ZVFS_POLL_MAX can't be 0");
@@ -87,6 +88,7 @@ static int coap_service_remove_observer(const struct coap_service *service,
 					const uint8_t *token, uint8_t tkl)
 {
 	struct coap_observer *obs;
+	size_t i;
 
 	if (tkl > 0 && addr != NULL) {
 		/* Prefer addr+token to find the observer */
@@ -106,14 +108,14 @@ static int coap_service_remove_observer(const struct coap_service *service,
 		return 0;
 	}
 
+	i = ARRAY_INDEX(service->data->observers, obs);
+
 	if (resource == NULL) {
-		COAP_SERVICE_FOREACH_RESOURCE(service, it) {
-			if (coap_remove_observer(it, obs)) {
-				memset(obs, 0, sizeof(*obs));
-				return 1;
-			}
-		}
-	} else if (coap_remove_observer(resource, obs)) {
+		resource = service->data->observer_res[i];
+	}
+
+	if (resource != NULL && coap_remove_observer(resource, obs)) {
+		service->data->observer_res[i] = NULL;
 		memset(obs, 0, sizeof(*obs));
 		return 1;
 	}
@@ -121,6 +123,153 @@ static int coap_service_remove_observer(const struct coap_service *service,
 	return 0;
 }
 
+#if INDEX_SIZE > 0
+#define PATH_HASH_INIT 2166136261U
+
+static uint32_t coap_path_hash_update(uint32_t hash, const uint8_t *segment, size_t len)
+{
+	/* FNV-1a, the length separates the segments */
+	hash = (hash ^ len) * 16777619U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ segment[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static uint32_t coap_resource_path_hash(const char * const *path)
+{
+	uint32_t hash = PATH_HASH_INIT;
+
+	for (; *path != NULL; path++) {
+		hash = coap_path_hash_update(hash, (const uint8_t *)*path, strlen(*path));
+	}
+
+	return hash;
+}
+
+static uint32_t coap_request_path_hash(const struct coap_option *options, uint8_t opt_num)
+{
+	uint32_t hash = PATH_HASH_INIT;
+
+	for (uint8_t i = 0; i < opt_num; i++) {
+		if (options[i].delta == COAP_OPTION_URI_PATH) {
+			hash = coap_path_hash_update(hash, options[i].value, options[i].len);
+		}
+	}
+
+	return hash;
+}
+
+static bool coap_resource_path_has_wildcard(const char * const *path)
+{
+	if (!IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		return false;
+	}
+
+	for (; *path != NULL; path++) {
+		if (strcmp(*path, "+") == 0 || strcmp(*path, "#") == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool coap_resource_path_equal(const char * const *a, const char * const *b)
+{
+	for (; *a != NULL && *b != NULL; a++, b++) {
+		if (strcmp(*a, *b) != 0) {
+			return false;
+		}
+	}
+
+	return *a == *b;
+}
+
+/* Index the resources by path. Wildcard paths cannot be hashed, the range of
+ * resources holding them is searched linearly instead.
+ */
+static void coap_service_index_resources(const struct coap_service *service)
+{
+	struct coap_service_data *data = service->data;
+	size_t count = COAP_SERVICE_RESOURCE_COUNT(service);
+
+	memset(data->res_index, 0, sizeof(data->res_index));
+	data->res_wildcard_begin = count;
+	data->res_wildcard_end = 0;
+	data->res_indexed = false;
+
+	if (count > INDEX_SIZE) {
+		LOG_WRN("%zu resources, too many to index %s", count, service->name);
+		return;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const char * const *path = service->res_begin[i].path;
+		size_t slot;
+
+		if (coap_resource_path_has_wildcard(path)) {
+			data->res_wildcard_begin = MIN(data->res_wildcard_begin, i);
+			data->res_wildcard_end = i + 1;
+			continue;
+		}
+
+		slot = coap_resource_path_hash(path) % INDEX_SIZE;
+
+		while (data->res_index[slot] != 0) {
+			/* The first resource with a given path wins */
+			if (coap_resource_path_equal(
+				    service->res_begin[data->res_index[slot] - 1].path, path)) {
+				break;
+			}
+
+			slot = (slot + 1) % INDEX_SIZE;
+		}
+
+		if (data->res_index[slot] == 0) {
+			data->res_index[slot] = i + 1;
+		}
+	}
+
+	data->res_indexed = true;
+}
+
+static struct coap_resource *coap_service_find_resource(const struct coap_service *service,
+							 struct coap_option *options,
+							 uint8_t opt_num)
+{
+	struct coap_service_data *data = service->data;
+	size_t count = COAP_SERVICE_RESOURCE_COUNT(service);
+	size_t slot = coap_request_path_hash(options, opt_num) % INDEX_SIZE;
+	size_t found = count;
+
+	for (size_t probe = 0; probe < INDEX_SIZE && data->res_index[slot] != 0; probe++) {
+		size_t i = data->res_index[slot] - 1;
+
+		if (coap_uri_path_match(service->res_begin[i].path, options, opt_num)) {
+			found = i;
+			break;
+		}
+
+		slot = (slot + 1) % INDEX_SIZE;
+	}
+
+	/* A matching wildcard resource defined first takes precedence, like
+	 * with a linear search.
+	 */
+	for (size_t i = data->res_wildcard_begin; i < MIN(found, data->res_wildcard_end); i++) {
+		if (coap_uri_path_match(service->res_begin[i].path, options, opt_num)) {
+			found = i;
+			break;
+		}
+	}
+
+	return found < count ? &service->res_begin[found] : NULL;
+}
+#endif /* INDEX_SIZE > 0 */
+
 static int coap_server_process(int sock_fd)
 {
 	static uint8_t buf[CONFIG_COAP_SERVER_MESSAGE_SIZE];
@@ -214,8 +363,17 @@ static int coap_server_process(int sock_fd)
 
 		ret = coap_service_send(service, &response, &client_addr, client_addr_len, NULL);
 	} else {
-		ret = coap_handle_request_len(&request, service->res_begin,
-					      COAP_SERVICE_RESOURCE_COUNT(service),
+		struct coap_resource *resources = service->res_begin;
+		size_t resources_len = COAP_SERVICE_RESOURCE_COUNT(service);
+
+#if INDEX_SIZE > 0
+		if (service->data->res_indexed) {
+			resources = coap_service_find_resource(service, options, opt_num);
+			resources_len = (resources != NULL) ? 1 : 0;
+		}
+#endif
+
+		ret = coap_handle_request_len(&request, resources, resources_len,
 					      options, opt_num, &client_addr, client_addr_len);
 
 		/* Translate errors to response codes */
@@ -423,6 +581,10 @@ int coap_service_start(const struct coap_service *service)
 		goto end;
 	}
 
+#if INDEX_SIZE > 0
+	coap_service_index_resources(service);
+#endif
+
 	service->data->sock_fd = zsock_socket(af, SOCK_DGRAM, IPPROTO_UDP);
 	if (service->data->sock_fd < 0) {
 		ret = -errno;
@@ -654,6 +816,8 @@ int coap_resource_parse_observe(struct coap_resource *resource, const struct coa
 
 		coap_observer_init(observer, request, addr);
 		coap_register_observer(resource, observer);
+		service->data->observer_res[ARRAY_INDEX(service->data->observers, observer)] =
+			resource;
 	} else if (ret == 1) {
 		ret = coap_service_remove_observer(service, resource, addr, token, tkl);
 		if (ret < 0) {
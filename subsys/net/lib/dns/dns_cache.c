@@ -9,13 +9,72 @@
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
-static void dns_cache_clean(struct dns_cache const *cache);
+static void dns_cache_clean_locked(struct dns_cache const *cache);
+
+static uint32_t dns_cache_hash(const char *query)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*query != '\0') {
+		hash ^= (uint8_t)*query++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static uint16_t *dns_cache_bucket(struct dns_cache const *cache, uint32_t hash)
+{
+	return &cache->buckets[hash % cache->size];
+}
+
+/* Append an entry to its hash bucket, cache->lock must be held */
+static void dns_cache_link_locked(struct dns_cache const *cache, size_t index)
+{
+	uint16_t *link = dns_cache_bucket(cache, cache->entries[index].hash);
+
+	__ASSERT_NO_MSG(cache->lock->owner == k_current_get());
+
+	/* Append, so the entries of a query are found in the order they were added */
+	while (*link != 0) {
+		link = &cache->entries[*link - 1].next;
+	}
+
+	cache->entries[index].next = 0;
+	*link = index + 1;
+}
+
+/* Remove an entry from its hash bucket and free it, cache->lock must be held */
+static void dns_cache_unlink_locked(struct dns_cache const *cache, size_t index)
+{
+	uint16_t *link = dns_cache_bucket(cache, cache->entries[index].hash);
+
+	__ASSERT_NO_MSG(cache->lock->owner == k_current_get());
+
+	while (*link != 0) {
+		if (*link == index + 1) {
+			*link = cache->entries[index].next;
+			break;
+		}
+
+		link = &cache->entries[*link - 1].next;
+	}
+
+	cache->entries[index].in_use = false;
+}
+
+static bool dns_cache_same_addr(struct dns_addrinfo const *a, struct dns_addrinfo const *b)
+{
+	return a->ai_family == b->ai_family && a->ai_addrlen == b->ai_addrlen &&
+	       memcmp(&a->ai_addr, &b->ai_addr, a->ai_addrlen) == 0;
+}
 
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
 	for (size_t i = 0; i < cache->size; i++) {
 		cache->entries[i].in_use = false;
+		cache->buckets[i] = 0;
 	}
 	k_mutex_unlock(cache->lock);
 
@@ -25,9 +84,11 @@ int dns_cache_flush(struct dns_cache *cache)
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl)
 {
-	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
+	int64_t least_recently_used = INT64_MAX;
 	size_t index_to_replace = 0;
 	bool found_empty = false;
+	uint32_t hash;
+	uint16_t next;
 
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
@@ -40,33 +101,55 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
 
-	dns_cache_clean(cache);
+	/* An answer to a prefetch query renews the entry it refreshes */
+	for (next = *dns_cache_bucket(cache, hash); next != 0;
+	     next = cache->entries[next - 1].next) {
+		struct dns_cache_entry *entry = &cache->entries[next - 1];
+
+		if (entry->refreshing && entry->hash == hash && strcmp(entry->query, query) == 0 &&
+		    dns_cache_same_addr(&entry->data, addrinfo)) {
+			NET_DBG("Refresh \"%s\"", query);
+			entry->expiry = sys_timepoint_calc(K_SECONDS(ttl));
+			entry->refreshing = false;
+			goto unlock;
+		}
+	}
+
+	dns_cache_clean_locked(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
 		if (!cache->entries[i].in_use) {
 			index_to_replace = i;
 			found_empty = true;
 			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
+		} else if (cache->entries[i].last_used < least_recently_used) {
 			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
+			least_recently_used = cache->entries[i].last_used;
 		}
 	}
 
 	if (!found_empty) {
 		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+		dns_cache_unlink_locked(cache, index_to_replace);
 	}
 
 	strncpy(cache->entries[index_to_replace].query, query,
 		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
 	cache->entries[index_to_replace].data = *addrinfo;
 	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	cache->entries[index_to_replace].last_used = k_uptime_ticks();
+	cache->entries[index_to_replace].hash = hash;
 	cache->entries[index_to_replace].in_use = true;
+	cache->entries[index_to_replace].refreshing = false;
+	dns_cache_link_locked(cache, index_to_replace);
 
+unlock:
 	k_mutex_unlock(cache->lock);
 
 	return 0;
@@ -74,6 +157,9 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
+	uint32_t hash;
+	uint16_t next;
+
 	NET_DBG("Remove all entries with query \"%s\"", query);
 	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
 		NET_WARN("Query string to big to be processed %u >= "
@@ -82,13 +168,17 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
-	dns_cache_clean(cache);
+	next = *dns_cache_bucket(cache, hash);
+	while (next != 0) {
+		size_t i = next - 1;
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (cache->entries[i].in_use && strcmp(cache->entries[i].query, query) == 0) {
-			cache->entries[i].in_use = false;
+		next = cache->entries[i].next;
+		if (cache->entries[i].hash == hash && strcmp(cache->entries[i].query, query) == 0) {
+			dns_cache_unlink_locked(cache, i);
 		}
 	}
 
@@ -101,6 +191,9 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 		   size_t addrinfo_array_len)
 {
 	size_t found = 0;
+	uint32_t hash;
+	uint16_t next;
+	int64_t now;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
@@ -113,22 +206,32 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+	now = k_uptime_ticks();
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
-	dns_cache_clean(cache);
+	next = *dns_cache_bucket(cache, hash);
+	while (next != 0) {
+		struct dns_cache_entry *entry = &cache->entries[next - 1];
 
-	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
+		next = entry->next;
+		if (entry->hash != hash || strcmp(entry->query, query) != 0) {
 			continue;
 		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
+		if (sys_timepoint_expired(entry->expiry)) {
+			NET_DBG("Remove \"%s\"", entry->query);
+			dns_cache_unlink_locked(cache, entry - cache->entries);
 			continue;
 		}
+
+		entry->last_used = now;
+
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
 		} else {
-			addrinfo[found] = cache->entries[i].data;
+			addrinfo[found] = entry->data;
 			found++;
 			NET_DBG("Found \"%s\"", query);
 		}
@@ -146,9 +249,68 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 	return found;
 }
 
-/* Needs to be called when lock is already acquired */
-static void dns_cache_clean(struct dns_cache const *cache)
+bool dns_cache_refresh_due(struct dns_cache *cache, const char *query, int family)
 {
+#if CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME > 0
+	k_timepoint_t threshold =
+		sys_timepoint_calc(K_SECONDS(CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME));
+	uint32_t hash = dns_cache_hash(query);
+	bool due = false;
+	uint16_t next;
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	for (next = *dns_cache_bucket(cache, hash); next != 0;
+	     next = cache->entries[next - 1].next) {
+		struct dns_cache_entry *entry = &cache->entries[next - 1];
+
+		if (entry->hash != hash || entry->data.ai_family != family ||
+		    strcmp(entry->query, query) != 0) {
+			continue;
+		}
+
+		if (entry->refreshing) {
+			/* A prefetch is already running */
+			due = false;
+			break;
+		}
+
+		if (sys_timepoint_cmp(entry->expiry, threshold) <= 0) {
+			due = true;
+		}
+	}
+
+	if (due) {
+		NET_DBG("Prefetch \"%s\"", query);
+
+		for (next = *dns_cache_bucket(cache, hash); next != 0;
+		     next = cache->entries[next - 1].next) {
+			struct dns_cache_entry *entry = &cache->entries[next - 1];
+
+			if (entry->hash == hash && entry->data.ai_family == family &&
+			    strcmp(entry->query, query) == 0) {
+				entry->refreshing = true;
+			}
+		}
+	}
+
+	k_mutex_unlock(cache->lock);
+
+	return due;
+#else
+	ARG_UNUSED(cache);
+	ARG_UNUSED(query);
+	ARG_UNUSED(family);
+
+	return false;
+#endif
+}
+
+/* Remove the expired entries, cache->lock must be held */
+static void dns_cache_clean_locked(struct dns_cache const *cache)
+{
+	__ASSERT_NO_MSG(cache->lock->owner == k_current_get());
+
 	for (size_t i = 0; i < cache->size; i++) {
 		if (!cache->entries[i].in_use) {
 			continue;
@@ -156,7 +318,7 @@ static void dns_cache_clean(struct dns_cache const *cache)
 
 		if (sys_timepoint_expired(cache->entries[i].expiry)) {
 			NET_DBG("Remove \"%s\"", cache->entries[i].query);
-			cache->entries[i].in_use = false;
+			dns_cache_unlink_locked(cache, i);
 		}
 	}
 }
@@ -22,12 +22,21 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	/* Uptime in ticks of the last add or find hit, for LRU replacement */
+	int64_t last_used;
+	uint32_t hash;
+	/* Next entry + 1 in the hash bucket, 0 ends the chain */
+	uint16_t next;
 	bool in_use;
+	/* A prefetch query has been started for this entry */
+	bool refreshing;
 };
 
 struct dns_cache {
 	size_t size;
 	struct dns_cache_entry *entries;
+	/* First entry + 1 of each hash bucket, 0 if empty */
+	uint16_t *buckets;
 	struct k_mutex *lock;
 };
 
@@ -41,10 +50,14 @@ struct dns_cache {
  * @param name Name of the cache.
  */
 #define DNS_CACHE_DEFINE(name, cache_size)                                                         \
+	BUILD_ASSERT((cache_size) > 0 && (cache_size) < UINT16_MAX);                               \
 	static K_MUTEX_DEFINE(name##_mutex);                                                       \
 	static struct dns_cache_entry name##_entries[cache_size];                                  \
-	static struct dns_cache name = {                                                           \
-		.entries = name##_entries, .size = cache_size, .lock = &name##_mutex};
+	static uint16_t name##_buckets[cache_size];                                                \
+	static struct dns_cache name = {.entries = name##_entries,                                 \
+					.buckets = name##_buckets,                                 \
+					.size = cache_size,                                        \
+					.lock = &name##_mutex};
 
 /**
  * @brief Flushes the dns cache removing all its entries.
@@ -56,8 +69,11 @@ struct dns_cache {
 int dns_cache_flush(struct dns_cache *cache);
 
 /**
- * @brief Adds a new entry to the dns cache removing the one closest to expiry
- * if no free space is available.
+ * @brief Adds a new entry to the dns cache removing an expired entry, or the
+ * least recently used one, if no free space is available.
+ *
+ * An entry being refreshed by a prefetch query with the same address is
+ * updated in place instead.
  *
  * @param cache Cache where the entry should be added.
  * @param query Query which should be persisted in the cache.
@@ -97,4 +113,20 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
 int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
 		   size_t addrinfo_array_len);
 
+/**
+ * @brief Checks if the entries of a query should be refreshed.
+ *
+ * Returns true once when the entries of the query with the given address
+ * family expire in less than
+ * CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME seconds. The entries are then
+ * marked as being refreshed until a new answer updates them.
+ *
+ * @param cache Cache where the entries should be searched.
+ * @param query Query which should be searched for.
+ * @param family Address family of the entries, AF_INET or AF_INET6.
+ * @retval true if a new query should be sent to refresh the entries.
+ * @retval false otherwise.
+ */
+bool dns_cache_refresh_due(struct dns_cache *cache, const char *query, int family);
+
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
@@ -1219,13 +1219,70 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
-int dns_resolve_name(struct dns_resolve_context *ctx,
-		     const char *query,
-		     enum dns_query_type type,
-		     uint16_t *dns_id,
-		     dns_resolve_cb_t cb,
-		     void *user_data,
-		     int32_t timeout)
+#if CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME > 0
+static int dns_resolve_name_internal(struct dns_resolve_context *ctx,
+				     const char *query,
+				     enum dns_query_type type,
+				     uint16_t *dns_id,
+				     dns_resolve_cb_t cb,
+				     void *user_data,
+				     int32_t timeout,
+				     bool use_cache);
+
+/* Only one prefetch query at a time, the query string must outlive it */
+static char prefetch_query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
+static atomic_t prefetch_busy;
+
+static void prefetch_cb(enum dns_resolve_status status,
+			struct dns_addrinfo *info,
+			void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The answers are put in the cache by the response handler */
+	if (status != DNS_EAI_INPROGRESS) {
+		atomic_clear(&prefetch_busy);
+	}
+}
+
+static void dns_cache_prefetch(struct dns_resolve_context *ctx,
+			       const char *query,
+			       enum dns_query_type type,
+			       int32_t timeout)
+{
+	int ret;
+
+	if (!atomic_cas(&prefetch_busy, 0, 1)) {
+		return;
+	}
+
+	if (!dns_cache_refresh_due(&dns_cache, query,
+				   type == DNS_QUERY_TYPE_A ? AF_INET : AF_INET6)) {
+		atomic_clear(&prefetch_busy);
+		return;
+	}
+
+	strncpy(prefetch_query, query, sizeof(prefetch_query) - 1);
+	prefetch_query[sizeof(prefetch_query) - 1] = '\0';
+
+	ret = dns_resolve_name_internal(ctx, prefetch_query, type, NULL, prefetch_cb,
+					NULL, timeout, false);
+	if (ret < 0) {
+		NET_DBG("Cannot prefetch \"%s\" (%d)", query, ret);
+		atomic_clear(&prefetch_busy);
+	}
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME > 0 */
+
+static int dns_resolve_name_internal(struct dns_resolve_context *ctx,
+				     const char *query,
+				     enum dns_query_type type,
+				     uint16_t *dns_id,
+				     dns_resolve_cb_t cb,
+				     void *user_data,
+				     int32_t timeout,
+				     bool use_cache)
 {
 	k_timeout_t tout;
 	struct net_buf *dns_data = NULL;
@@ -1300,7 +1357,8 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 
 try_resolve:
 #ifdef CONFIG_DNS_RESOLVER_CACHE
-	ret = dns_cache_find(&dns_cache, query, cached_info, ARRAY_SIZE(cached_info));
+	ret = use_cache ? dns_cache_find(&dns_cache, query, cached_info,
+					 ARRAY_SIZE(cached_info)) : 0;
 	if (ret > 0) {
 		/* The query was cached, no
 		 * need to continue further.
@@ -1310,8 +1368,14 @@ try_resolve:
 		}
 		cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+#if CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME > 0
+		/* Refresh the entries in the background before they expire */
+		dns_cache_prefetch(ctx, query, type, timeout);
+#endif
 		return 0;
 	}
+#else
+	ARG_UNUSED(use_cache);
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
 
 	k_mutex_lock(&ctx->lock, K_FOREVER);
@@ -1459,6 +1523,18 @@ fail:
 	return ret;
 }
 
+int dns_resolve_name(struct dns_resolve_context *ctx,
+		     const char *query,
+		     enum dns_query_type type,
+		     uint16_t *dns_id,
+		     dns_resolve_cb_t cb,
+		     void *user_data,
+		     int32_t timeout)
+{
+	return dns_resolve_name_internal(ctx, query, type, dns_id, cb, user_data,
+					 timeout, true);
+}
+
 /* Must be invoked with context lock held */
 static int dns_resolve_close_locked(struct dns_resolve_context *ctx)
 {
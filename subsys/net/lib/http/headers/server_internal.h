@@ -42,7 +42,11 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size, bool *gzipped);
+uint32_t http_server_static_etag(struct http_resource_detail_static *static_detail);
+bool http_server_etag_match(struct http_client_ctx *client, uint32_t etag);
 void http_client_timer_restart(struct http_client_ctx *client);
+bool http_server_claim_resource(struct http_resource_detail_dynamic *dynamic_detail,
+				struct http_client_ctx *client);
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status);
 bool http_response_is_provided(struct http_response_ctx *rsp);
 
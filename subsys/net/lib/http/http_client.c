@@ -364,6 +364,11 @@ static int on_message_complete(struct http_parser *parser)
 
 	req->internal.response.message_complete = 1;
 
+	/* Stop at the end of the response, any following data belongs to
+	 * the next pipelined response.
+	 */
+	http_parser_pause(parser, 1);
+
 	return 0;
 }
 
@@ -459,10 +464,18 @@ static void http_report_progress(struct http_request *req)
 	}
 }
 
-static int http_wait_data(int sock, struct http_request *req, const k_timepoint_t req_end_timepoint)
+/* On entry, pending is the amount of data of this response already stored at
+ * the start of the receive buffer. On return, it is the amount of data of the
+ * next response that was received after this one, moved to the start of the
+ * receive buffer.
+ */
+static int http_wait_data(int sock, struct http_request *req, const k_timepoint_t req_end_timepoint,
+			  size_t *pending)
 {
 	int total_received = 0;
 	size_t offset = 0;
+	size_t parsed;
+	uint8_t *data;
 	int received, ret;
 	struct zsock_pollfd fds[1];
 	int nfds = 1;
@@ -471,27 +484,36 @@ static int http_wait_data(int sock, struct http_request *req, const k_timepoint_
 	fds[0].events = ZSOCK_POLLIN;
 
 	do {
-		k_ticks_t req_timeout_ticks =
-			sys_timepoint_timeout(req_end_timepoint).ticks;
-		int req_timeout_ms = k_ticks_to_ms_floor32(req_timeout_ticks);
-
-		ret = zsock_poll(fds, nfds, req_timeout_ms);
-		if (ret == 0) {
-			LOG_DBG("Timeout");
-			ret = -ETIMEDOUT;
-			goto error;
-		} else if (ret < 0) {
-			ret = -errno;
-			goto error;
-		}
-		if (fds[0].revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
-			ret = -errno;
-			goto error;
-		} else if (fds[0].revents & ZSOCK_POLLHUP) {
-			/* Connection closed */
-			goto closed;
-		} else if (fds[0].revents & ZSOCK_POLLIN) {
-			received = zsock_recv(sock, req->internal.response.recv_buf + offset,
+		data = req->internal.response.recv_buf + offset;
+
+		if (*pending > 0) {
+			received = *pending;
+			*pending = 0;
+		} else {
+			k_ticks_t req_timeout_ticks =
+				sys_timepoint_timeout(req_end_timepoint).ticks;
+			int req_timeout_ms = k_ticks_to_ms_floor32(req_timeout_ticks);
+
+			ret = zsock_poll(fds, nfds, req_timeout_ms);
+			if (ret == 0) {
+				LOG_DBG("Timeout");
+				ret = -ETIMEDOUT;
+				goto error;
+			} else if (ret < 0) {
+				ret = -errno;
+				goto error;
+			}
+			if (fds[0].revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
+				ret = -errno;
+				goto error;
+			} else if (fds[0].revents & ZSOCK_POLLHUP) {
+				/* Connection closed */
+				goto closed;
+			} else if (!(fds[0].revents & ZSOCK_POLLIN)) {
+				continue;
+			}
+
+			received = zsock_recv(sock, data,
 					      req->internal.response.recv_buf_len - offset, 0);
 			if (received == 0) {
 				/* Connection closed */
@@ -499,34 +521,43 @@ static int http_wait_data(int sock, struct http_request *req, const k_timepoint_
 			} else if (received < 0) {
 				ret = -errno;
 				goto error;
-			} else {
-				req->internal.response.data_len += received;
-
-				(void)http_parser_execute(
-					&req->internal.parser, &req->internal.parser_settings,
-					req->internal.response.recv_buf + offset, received);
 			}
+		}
 
-			total_received += received;
-			offset += received;
+		req->internal.response.data_len += received;
 
-			if (offset >= req->internal.response.recv_buf_len) {
-				offset = 0;
-			}
+		parsed = http_parser_execute(&req->internal.parser,
+					     &req->internal.parser_settings,
+					     data, received);
 
-			if (req->internal.response.message_complete) {
-				http_report_complete(req);
-				break;
-			} else if (offset == 0) {
-				http_report_progress(req);
+		total_received += received;
+		offset += received;
 
-				/* Re-use the result buffer and start to fill it again */
-				req->internal.response.data_len = 0;
-				req->internal.response.body_frag_start = NULL;
-				req->internal.response.body_frag_len = 0;
-			}
+		if (offset >= req->internal.response.recv_buf_len) {
+			offset = 0;
 		}
 
+		if (req->internal.response.message_complete) {
+			*pending = received - MIN(parsed, received);
+			req->internal.response.data_len -= *pending;
+			total_received -= *pending;
+
+			http_report_complete(req);
+
+			if (*pending > 0) {
+				memmove(req->internal.response.recv_buf,
+					data + received - *pending, *pending);
+			}
+
+			break;
+		} else if (offset == 0) {
+			http_report_progress(req);
+
+			/* Re-use the result buffer and start to fill it again */
+			req->internal.response.data_len = 0;
+			req->internal.response.body_frag_start = NULL;
+			req->internal.response.body_frag_len = 0;
+		}
 	} while (true);
 
 	return total_received;
@@ -552,23 +583,22 @@ error:
 	return ret;
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static bool http_request_is_valid(const struct http_request *req)
+{
+	return req != NULL && req->response != NULL &&
+	       req->recv_buf != NULL && req->recv_buf_len != 0;
+}
+
+static int http_send_request(int sock, struct http_request *req,
+			     const k_timepoint_t req_end_timepoint, void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
-	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
-	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
-
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
 
 	memset(&req->internal.response, 0, sizeof(req->internal.response));
 
@@ -741,23 +771,461 @@ int http_client_req(int sock, struct http_request *req,
 		total_sent += ret;
 	}
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+static int http_send_requests(int sock, struct http_request **reqs, size_t count,
+			      const k_timepoint_t req_end_timepoint, void *user_data)
+{
+	int total_sent = 0;
+	int ret;
+
+	for (size_t i = 0; i < count; i++) {
+		ret = http_send_request(sock, reqs[i], req_end_timepoint, user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+	}
+
 	NET_DBG("Sent %d bytes", total_sent);
 
-	http_client_init_parser(&req->internal.parser,
-				&req->internal.parser_settings);
+	return total_sent;
+}
 
-	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req, req_end_timepoint);
-	if (total_recv < 0) {
-		NET_DBG("Wait data failure (%d)", total_recv);
-		ret = total_recv;
-		goto out;
+/* Return the amount of data received after the last response. */
+static int http_wait_responses(int sock, struct http_request **reqs, size_t count,
+			       const k_timepoint_t req_end_timepoint)
+{
+	size_t pending = 0;
+	int total_recv;
+
+	for (size_t i = 0; i < count; i++) {
+		if (pending > 0) {
+			/* Start of the next response, received with the previous one */
+			if (pending > reqs[i]->recv_buf_len) {
+				return -EMSGSIZE;
+			}
+
+			memmove(reqs[i]->recv_buf, reqs[i - 1]->recv_buf, pending);
+		}
+
+		http_client_init_parser(&reqs[i]->internal.parser,
+					&reqs[i]->internal.parser_settings);
+
+		/* Request is sent, now wait data to be received */
+		total_recv = http_wait_data(sock, reqs[i], req_end_timepoint, &pending);
+		if (total_recv < 0) {
+			NET_DBG("Wait data failure (%d)", total_recv);
+			return total_recv;
+		}
+
+		NET_DBG("Received %d bytes", total_recv);
+
+		if (!reqs[i]->internal.response.message_complete && i + 1 < count) {
+			/* Connection closed before the remaining responses */
+			return -ECONNRESET;
+		}
 	}
 
-	NET_DBG("Received %d bytes", total_recv);
+	return pending;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	return http_client_req_pipeline(sock, &req, 1, timeout, user_data);
+}
+
+int http_client_req_pipeline(int sock, struct http_request **reqs, size_t count,
+			     int32_t timeout, void *user_data)
+{
+	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
+	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
+	int total_sent;
+	int ret;
+
+	if (sock < 0 || reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!http_request_is_valid(reqs[i])) {
+			return -EINVAL;
+		}
+	}
+
+	total_sent = http_send_requests(sock, reqs, count, req_end_timepoint, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	ret = http_wait_responses(sock, reqs, count, req_end_timepoint);
+	if (ret < 0) {
+		return ret;
+	}
 
 	return total_sent;
+}
+
+#if defined(CONFIG_HTTP_CLIENT_POOL)
+
+#define POOL_IDLE_TIMEOUT K_SECONDS(CONFIG_HTTP_CLIENT_POOL_IDLE_TIMEOUT)
+#define POOL_HOST_LEN 64
+
+enum http_client_pool_state {
+	POOL_CONN_FREE = 0,
+	POOL_CONN_BUSY,
+	POOL_CONN_IDLE,
+};
+
+struct http_client_pool_conn {
+	struct sockaddr_storage addr;
+	char host[POOL_HOST_LEN];
+	k_timepoint_t expiry;
+	sec_tag_t sec_tag;
+	enum http_client_pool_state state;
+	int sock;
+};
+
+static struct http_client_pool_conn pool_conns[CONFIG_HTTP_CLIENT_POOL_SIZE];
+static K_MUTEX_DEFINE(pool_lock);
+
+static void pool_expire_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(pool_expire_work, pool_expire_handler);
+
+static bool pool_addr_equal(const struct sockaddr *a, const struct sockaddr *b)
+{
+	if (a->sa_family != b->sa_family) {
+		return false;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && a->sa_family == AF_INET) {
+		return net_sin(a)->sin_port == net_sin(b)->sin_port &&
+		       net_ipv4_addr_cmp(&net_sin(a)->sin_addr, &net_sin(b)->sin_addr);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && a->sa_family == AF_INET6) {
+		return net_sin6(a)->sin6_port == net_sin6(b)->sin6_port &&
+		       net_ipv6_addr_cmp(&net_sin6(a)->sin6_addr, &net_sin6(b)->sin6_addr);
+	}
+
+	return false;
+}
+
+static bool pool_conn_match(struct http_client_pool_conn *conn,
+			    const struct sockaddr *addr, sec_tag_t sec_tag,
+			    const char *host)
+{
+	return pool_addr_equal((struct sockaddr *)&conn->addr, addr) &&
+	       conn->sec_tag == sec_tag &&
+	       strncmp(conn->host, host, sizeof(conn->host)) == 0;
+}
+
+/* The server sends nothing on an idle connection, so anything to read
+ * means it has been closed.
+ */
+static bool pool_conn_alive(struct http_client_pool_conn *conn)
+{
+	struct zsock_pollfd fds = {
+		.fd = conn->sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	return zsock_poll(&fds, 1, 0) == 0;
+}
+
+static void pool_conn_close(struct http_client_pool_conn *conn)
+{
+	NET_DBG("Closing pooled connection %d", conn->sock);
+
+	(void)zsock_close(conn->sock);
+	conn->sock = -1;
+	conn->state = POOL_CONN_FREE;
+}
+
+static void pool_expire_handler(struct k_work *work)
+{
+	k_timeout_t next = K_FOREVER;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(pool_conns, conn) {
+		k_timeout_t remaining;
+
+		if (conn->state != POOL_CONN_IDLE) {
+			continue;
+		}
+
+		if (sys_timepoint_expired(conn->expiry)) {
+			pool_conn_close(conn);
+			continue;
+		}
+
+		remaining = sys_timepoint_timeout(conn->expiry);
+		if (K_TIMEOUT_EQ(next, K_FOREVER) || remaining.ticks < next.ticks) {
+			next = remaining;
+		}
+	}
+
+	if (!K_TIMEOUT_EQ(next, K_FOREVER)) {
+		k_work_reschedule(&pool_expire_work, next);
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+static int pool_connect(const struct sockaddr *addr, socklen_t addrlen,
+			sec_tag_t sec_tag, const char *host)
+{
+	int proto = IPPROTO_TCP;
+	int sock, ret;
+
+	if (sec_tag >= 0) {
+		if (!IS_ENABLED(CONFIG_NET_SOCKETS_SOCKOPT_TLS)) {
+			return -EPROTONOSUPPORT;
+		}
+
+		proto = IPPROTO_TLS_1_2;
+	}
+
+	sock = zsock_socket(addr->sa_family, SOCK_STREAM, proto);
+	if (sock < 0) {
+		return -errno;
+	}
+
+#if defined(CONFIG_NET_SOCKETS_SOCKOPT_TLS)
+	if (sec_tag >= 0) {
+		if (zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+				     &sec_tag, sizeof(sec_tag)) < 0) {
+			goto fail;
+		}
+
+		if (host != NULL &&
+		    zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME,
+				     host, strlen(host)) < 0) {
+			goto fail;
+		}
+	}
+#endif
+
+	if (zsock_connect(sock, addr, addrlen) < 0) {
+		goto fail;
+	}
+
+	NET_DBG("New pooled connection %d", sock);
+
+	return sock;
+
+fail:
+	ret = -errno;
+	(void)zsock_close(sock);
 
-out:
 	return ret;
 }
+
+/* Get an idle connection to the server, or connect a new one. The
+ * connection is not pooled if conn is set to NULL, all slots being busy.
+ */
+static int pool_conn_get(const struct sockaddr *addr, socklen_t addrlen,
+			 sec_tag_t sec_tag, const char *host,
+			 struct http_client_pool_conn **conn, bool *reused)
+{
+	struct http_client_pool_conn *oldest = NULL;
+	struct http_client_pool_conn *found = NULL;
+	int sock;
+
+	if (host == NULL || strlen(host) >= POOL_HOST_LEN ||
+	    addrlen > sizeof(struct sockaddr_storage)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(pool_conns, entry) {
+		if (entry->state != POOL_CONN_IDLE) {
+			continue;
+		}
+
+		if (sys_timepoint_expired(entry->expiry) || !pool_conn_alive(entry)) {
+			pool_conn_close(entry);
+			continue;
+		}
+
+		if (found == NULL && pool_conn_match(entry, addr, sec_tag, host)) {
+			found = entry;
+		}
+	}
+
+	if (found != NULL) {
+		found->state = POOL_CONN_BUSY;
+		k_mutex_unlock(&pool_lock);
+
+		*conn = found;
+		*reused = true;
+
+		return found->sock;
+	}
+
+	/* Reserve a slot, replacing the idle connection closest to expiry */
+	ARRAY_FOR_EACH_PTR(pool_conns, entry) {
+		if (entry->state == POOL_CONN_FREE) {
+			found = entry;
+			break;
+		}
+
+		if (entry->state == POOL_CONN_IDLE &&
+		    (oldest == NULL ||
+		     sys_timepoint_cmp(entry->expiry, oldest->expiry) < 0)) {
+			oldest = entry;
+		}
+	}
+
+	if (found == NULL && oldest != NULL) {
+		pool_conn_close(oldest);
+		found = oldest;
+	}
+
+	if (found != NULL) {
+		memcpy(&found->addr, addr, addrlen);
+		strcpy(found->host, host);
+		found->sec_tag = sec_tag;
+		found->state = POOL_CONN_BUSY;
+	}
+
+	k_mutex_unlock(&pool_lock);
+
+	*conn = found;
+	*reused = false;
+
+	sock = pool_connect(addr, addrlen, sec_tag, host);
+	if (sock < 0) {
+		if (found != NULL) {
+			k_mutex_lock(&pool_lock, K_FOREVER);
+			found->state = POOL_CONN_FREE;
+			k_mutex_unlock(&pool_lock);
+		}
+
+		return sock;
+	}
+
+	if (found != NULL) {
+		found->sock = sock;
+	}
+
+	return sock;
+}
+
+static void pool_conn_put(struct http_client_pool_conn *conn, int sock, bool keep_alive)
+{
+	if (conn == NULL) {
+		(void)zsock_close(sock);
+		return;
+	}
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	if (keep_alive) {
+		conn->state = POOL_CONN_IDLE;
+		conn->expiry = sys_timepoint_calc(POOL_IDLE_TIMEOUT);
+
+		/* Only the next expiry needs to be scheduled */
+		(void)k_work_schedule(&pool_expire_work, POOL_IDLE_TIMEOUT);
+	} else {
+		pool_conn_close(conn);
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+int http_client_pool_req_pipeline(const struct sockaddr *addr, socklen_t addrlen,
+				  sec_tag_t sec_tag, struct http_request **reqs,
+				  size_t count, int32_t timeout, void *user_data)
+{
+	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
+	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
+	struct http_client_pool_conn *conn;
+	struct http_request *last;
+	bool keep_alive;
+	bool reused;
+	int total_sent;
+	int sock, ret;
+
+	if (addr == NULL || reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!http_request_is_valid(reqs[i])) {
+			return -EINVAL;
+		}
+	}
+
+	do {
+		sock = pool_conn_get(addr, addrlen, sec_tag, reqs[0]->host,
+				     &conn, &reused);
+		if (sock < 0) {
+			return sock;
+		}
+
+		total_sent = http_send_requests(sock, reqs, count, req_end_timepoint,
+						user_data);
+		if (total_sent >= 0) {
+			break;
+		}
+
+		pool_conn_put(conn, sock, false);
+
+		/* The server may have closed the idle connection meanwhile,
+		 * retry on a new one.
+		 */
+	} while (reused);
+
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	ret = http_wait_responses(sock, reqs, count, req_end_timepoint);
+
+	/* Nothing may follow the last response on a reusable connection */
+	last = reqs[count - 1];
+	keep_alive = ret == 0 && last->internal.response.message_complete &&
+		     http_should_keep_alive(&last->internal.parser);
+
+	pool_conn_put(conn, sock, keep_alive);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return total_sent;
+}
+
+int http_client_pool_req(const struct sockaddr *addr, socklen_t addrlen,
+			 sec_tag_t sec_tag, struct http_request *req,
+			 int32_t timeout, void *user_data)
+{
+	return http_client_pool_req_pipeline(addr, addrlen, sec_tag, &req, 1,
+					     timeout, user_data);
+}
+
+void http_client_pool_close_all(void)
+{
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(pool_conns, conn) {
+		if (conn->state == POOL_CONN_IDLE) {
+			pool_conn_close(conn);
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+#endif /* CONFIG_HTTP_CLIENT_POOL */
@@ -10,6 +10,7 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/net/http/hpack.h>
 #include <zephyr/net/net_core.h>
+#include <zephyr/sys/util.h>
 
 LOG_MODULE_DECLARE(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 
@@ -101,11 +102,116 @@ const struct hpack_table_entry *http_hpack_table_get(uint32_t key)
 	return &http_hpack_table_static[key];
 }
 
+void http_hpack_table_init(struct http_hpack_table *table, size_t max_size)
+{
+	table->count = 0;
+	table->datalen = 0;
+	table->size = 0;
+	table->max_size = MIN(max_size, HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+	table->size_update = false;
+}
+
+/* Evict the oldest entries until the table fits in size, RFC7541 ch 4.4. */
+static void hpack_table_evict(struct http_hpack_table *table, size_t size)
+{
+	size_t evicted = 0;
+	int count = 0;
+
+	while (table->size > size) {
+		size_t len = table->entries[count].name_len +
+			     table->entries[count].value_len;
+
+		table->size -= len + HTTP_HPACK_ENTRY_OVERHEAD;
+		evicted += len;
+		count++;
+	}
+
+	if (count == 0) {
+		return;
+	}
+
+	table->count -= count;
+	table->datalen -= evicted;
+
+	memmove(table->data, table->data + evicted, table->datalen);
+	memmove(table->entries, table->entries + count,
+		table->count * sizeof(table->entries[0]));
+}
+
+void http_hpack_table_set_max_size(struct http_hpack_table *table,
+				   size_t max_size)
+{
+	max_size = MIN(max_size, HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+	if (max_size == table->max_size) {
+		return;
+	}
+
+	hpack_table_evict(table, max_size);
+	table->max_size = max_size;
+	table->size_update = true;
+}
+
+/* The name and value must not point to the table data. */
+static void hpack_table_add(struct http_hpack_table *table,
+			    const char *name, size_t name_len,
+			    const char *value, size_t value_len)
+{
+	size_t len = name_len + value_len;
+	uint8_t *data;
+
+	if (len + HTTP_HPACK_ENTRY_OVERHEAD > table->max_size) {
+		/* An entry larger than the table empties it, RFC7541 ch 4.4. */
+		hpack_table_evict(table, 0);
+		return;
+	}
+
+	hpack_table_evict(table, table->max_size - len - HTTP_HPACK_ENTRY_OVERHEAD);
+
+	data = table->data + table->datalen;
+	memcpy(data, name, name_len);
+	memcpy(data + name_len, value, value_len);
+
+	table->entries[table->count].name_len = name_len;
+	table->entries[table->count].value_len = value_len;
+	table->count++;
+	table->datalen += len;
+	table->size += len + HTTP_HPACK_ENTRY_OVERHEAD;
+}
+
+/* Dynamic table indexes start with the newest entry, RFC7541 ch 2.3.3.
+ * Return the position of the entry in the table, oldest entry first.
+ */
+static int hpack_table_lookup(const struct http_hpack_table *table,
+			      uint32_t key, size_t *offset)
+{
+	uint32_t index = key - HTTP_SERVER_HPACK_WWW_AUTHENTICATE;
+	int pos;
+
+	if (table == NULL || !http_hpack_key_is_dynamic(key) ||
+	    index > table->count) {
+		return -EBADMSG;
+	}
+
+	pos = table->count - index;
+
+	*offset = 0;
+	for (int i = 0; i < pos; i++) {
+		*offset += table->entries[i].name_len +
+			   table->entries[i].value_len;
+	}
+
+	return pos;
+}
+
 static int http_hpack_find_index(struct http_hpack_header_buf *header,
-				 bool *name_only)
+				 bool *name_only,
+				 const struct http_hpack_table *table)
 {
 	const struct hpack_table_entry *entry;
+	int dynamic_candidate = -1;
 	int candidate = -1;
+	int exact = -1;
+	size_t offset = 0;
 
 	for (int i = HTTP_SERVER_HPACK_AUTHORITY;
 	     i <= HTTP_SERVER_HPACK_WWW_AUTHENTICATE; i++) {
@@ -128,6 +234,37 @@ static int http_hpack_find_index(struct http_hpack_header_buf *header,
 		}
 	}
 
+	for (int i = 0; table != NULL && i < table->count; i++) {
+		const uint8_t *name = table->data + offset;
+		size_t name_len = table->entries[i].name_len;
+		size_t value_len = table->entries[i].value_len;
+		int key = HTTP_SERVER_HPACK_WWW_AUTHENTICATE + table->count - i;
+
+		offset += name_len + value_len;
+
+		if (name_len != header->name_len ||
+		    memcmp(name, header->name, name_len) != 0) {
+			continue;
+		}
+
+		/* Newer entries come later and have lower indexes. */
+		if (value_len == header->value_len &&
+		    memcmp(name + name_len, header->value, value_len) == 0) {
+			exact = key;
+		}
+
+		dynamic_candidate = key;
+	}
+
+	if (exact > 0) {
+		*name_only = false;
+		return exact;
+	}
+
+	if (candidate < 0) {
+		candidate = dynamic_candidate;
+	}
+
 	if (candidate > 0) {
 		/* Matched name only. */
 		*name_only = true;
@@ -287,10 +424,13 @@ static int hpack_string_decode(const uint8_t *buf, size_t datalen,
 }
 
 static int hpack_handle_indexed(const uint8_t *buf, size_t datalen,
-				struct http_hpack_header_buf *header)
+				struct http_hpack_header_buf *header,
+				const struct http_hpack_table *table)
 {
 	const struct hpack_table_entry *entry;
 	uint32_t index;
+	size_t offset;
+	int pos;
 	int ret;
 
 	ret = hpack_integer_decode(buf, datalen, HPACK_PREFIX_LEN_INDEXED,
@@ -303,6 +443,20 @@ static int hpack_handle_indexed(const uint8_t *buf, size_t datalen,
 		return -EBADMSG;
 	}
 
+	if (http_hpack_key_is_dynamic(index)) {
+		pos = hpack_table_lookup(table, index, &offset);
+		if (pos < 0) {
+			return pos;
+		}
+
+		header->name = (const char *)table->data + offset;
+		header->name_len = table->entries[pos].name_len;
+		header->value = header->name + header->name_len;
+		header->value_len = table->entries[pos].value_len;
+
+		return ret;
+	}
+
 	entry = http_hpack_table_get(index);
 	if (entry == NULL) {
 		return -EBADMSG;
@@ -322,9 +476,11 @@ static int hpack_handle_indexed(const uint8_t *buf, size_t datalen,
 
 static int hpack_handle_literal(const uint8_t *buf, size_t datalen,
 				struct http_hpack_header_buf *header,
+				const struct http_hpack_table *table,
 				uint8_t prefix_len)
 {
 	uint32_t index;
+	size_t offset;
 	int ret, len;
 
 	header->datalen = 0;
@@ -349,6 +505,27 @@ static int hpack_handle_literal(const uint8_t *buf, size_t datalen,
 		len += ret;
 		buf += ret;
 		datalen -= ret;
+	} else if (http_hpack_key_is_dynamic(index)) {
+		/* Indexed name from the dynamic table. Copy it, as the entry
+		 * may be evicted when the header is added to the table.
+		 */
+		size_t name_len;
+		int pos;
+
+		pos = hpack_table_lookup(table, index, &offset);
+		if (pos < 0) {
+			return pos;
+		}
+
+		name_len = table->entries[pos].name_len;
+		if (name_len > sizeof(header->buf)) {
+			return -ENOBUFS;
+		}
+
+		memcpy(header->buf, table->data + offset, name_len);
+		header->name = header->buf;
+		header->name_len = name_len;
+		header->datalen = name_len;
 	} else {
 		/* Indexed name. */
 		const struct hpack_table_entry *entry;
@@ -377,22 +554,34 @@ static int hpack_handle_literal(const uint8_t *buf, size_t datalen,
 }
 
 static int hpack_handle_literal_index(const uint8_t *buf, size_t datalen,
-			       struct http_hpack_header_buf *header)
+			       struct http_hpack_header_buf *header,
+			       struct http_hpack_table *table)
 {
-	/* TODO Add dynamic table support, if needed. */
+	int ret;
+
+	ret = hpack_handle_literal(buf, datalen, header, table,
+				   HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	if (ret < 0 || table == NULL) {
+		return ret;
+	}
 
-	return hpack_handle_literal(buf, datalen, header,
-				    HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	hpack_table_add(table, header->name, header->name_len,
+			header->value, header->value_len);
+
+	return ret;
 }
 
 static int hpack_handle_literal_no_index(const uint8_t *buf, size_t datalen,
-				  struct http_hpack_header_buf *header)
+				  struct http_hpack_header_buf *header,
+				  const struct http_hpack_table *table)
 {
-	return hpack_handle_literal(buf, datalen, header,
+	return hpack_handle_literal(buf, datalen, header, table,
 				    HPACK_PREFIX_LEN_LITERAL_NO_INDEXING);
 }
 
-static int hpack_handle_dynamic_size_update(const uint8_t *buf, size_t datalen)
+static int hpack_handle_dynamic_size_update(const uint8_t *buf, size_t datalen,
+					    struct http_hpack_header_buf *header,
+					    struct http_hpack_table *table)
 {
 	uint32_t max_size;
 	int ret;
@@ -403,13 +592,30 @@ static int hpack_handle_dynamic_size_update(const uint8_t *buf, size_t datalen)
 		return ret;
 	}
 
-	/* TODO Add dynamic table support, if needed. */
+	/* No header field, report an empty name. */
+	header->name = NULL;
+	header->name_len = 0;
+	header->value = NULL;
+	header->value_len = 0;
+
+	if (table == NULL) {
+		return ret;
+	}
+
+	/* The decoder advertised its maximum size, RFC7541 ch 6.3. */
+	if (max_size > HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE) {
+		return -EBADMSG;
+	}
+
+	hpack_table_evict(table, max_size);
+	table->max_size = max_size;
 
 	return ret;
 }
 
 int http_hpack_decode_header(const uint8_t *buf, size_t datalen,
-			     struct http_hpack_header_buf *header)
+			     struct http_hpack_header_buf *header,
+			     struct http_hpack_table *table)
 {
 	uint8_t prefix;
 	int ret;
@@ -425,18 +631,19 @@ int http_hpack_decode_header(const uint8_t *buf, size_t datalen,
 	prefix = *buf;
 
 	if ((prefix & HPACK_PREFIX_INDEXED_MASK) == HPACK_PREFIX_INDEXED) {
-		ret = hpack_handle_indexed(buf, datalen, header);
+		ret = hpack_handle_indexed(buf, datalen, header, table);
 	} else if ((prefix & HPACK_PREFIX_LITERAL_INDEXING_MASK) ==
 		   HPACK_PREFIX_LITERAL_INDEXING) {
-		ret = hpack_handle_literal_index(buf, datalen, header);
+		ret = hpack_handle_literal_index(buf, datalen, header, table);
 	} else if (((prefix & HPACK_PREFIX_LITERAL_NO_INDEXING_MASK) ==
 		    HPACK_PREFIX_LITERAL_NO_INDEXING) ||
 		   ((prefix & HPACK_PREFIX_LITERAL_NEVER_INDEXED_MASK) ==
 		    HPACK_PREFIX_LITERAL_NEVER_INDEXED)) {
-		ret = hpack_handle_literal_no_index(buf, datalen, header);
+		ret = hpack_handle_literal_no_index(buf, datalen, header, table);
 	} else if ((prefix & HPACK_PREFIX_DYNAMIC_TABLE_SIZE_MASK) ==
 		   HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE) {
-		ret = hpack_handle_dynamic_size_update(buf, datalen);
+		ret = hpack_handle_dynamic_size_update(buf, datalen, header,
+						       table);
 	} else {
 		ret = -EINVAL;
 	}
@@ -470,7 +677,7 @@ static int hpack_integer_encode(uint8_t *buf, size_t buflen, int value,
 			return -ENOBUFS;
 		}
 
-		*buf = (uint8_t)((value % 128) + 128);
+		*buf++ = (uint8_t)((value % 128) + 128);
 		len++;
 		value /= 128;
 	}
@@ -534,23 +741,22 @@ static int hpack_string_encode(uint8_t *buf, size_t buflen,
 	return len;
 }
 
-static int hpack_encode_literal(uint8_t *buf, size_t buflen,
+static int hpack_encode_literal(uint8_t *buf, size_t buflen, int index,
+				bool indexing,
 				struct http_hpack_header_buf *header)
 {
 	int ret, len = 0;
 
-	ret = hpack_integer_encode(buf, buflen, 0,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
-	if (ret < 0) {
-		return ret;
+	if (indexing) {
+		ret = hpack_integer_encode(buf, buflen, index,
+					   HPACK_PREFIX_LITERAL_INDEXING,
+					   HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	} else {
+		ret = hpack_integer_encode(buf, buflen, index,
+					   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
+					   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
 	}
 
-	buf += ret;
-	buflen -= ret;
-	len += ret;
-
-	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_NAME, header);
 	if (ret < 0) {
 		return ret;
 	}
@@ -559,32 +765,17 @@ static int hpack_encode_literal(uint8_t *buf, size_t buflen,
 	buflen -= ret;
 	len += ret;
 
-	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_VALUE, header);
-	if (ret < 0) {
-		return ret;
-	}
-
-	len += ret;
-
-	return len;
-}
-
-static int hpack_encode_literal_value(uint8_t *buf, size_t buflen, int index,
-				      struct http_hpack_header_buf *header)
-{
-	int ret, len = 0;
+	if (index == 0) {
+		ret = hpack_string_encode(buf, buflen, HPACK_HEADER_NAME, header);
+		if (ret < 0) {
+			return ret;
+		}
 
-	ret = hpack_integer_encode(buf, buflen, index,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
-	if (ret < 0) {
-		return ret;
+		buf += ret;
+		buflen -= ret;
+		len += ret;
 	}
 
-	buf += ret;
-	buflen -= ret;
-	len += ret;
-
 	ret = hpack_string_encode(buf, buflen, HPACK_HEADER_VALUE, header);
 	if (ret < 0) {
 		return ret;
@@ -602,10 +793,13 @@ static int hpack_encode_indexed(uint8_t *buf, size_t buflen, int index)
 }
 
 int http_hpack_encode_header(uint8_t *buf, size_t buflen,
-			     struct http_hpack_header_buf *header)
+			     struct http_hpack_header_buf *header,
+			     struct http_hpack_table *table)
 {
 	int ret, len = 0;
+	bool indexing;
 	bool name_only;
+	int index;
 
 	if (buf == NULL || header == NULL ||
 	    header->name == NULL || header->name_len == 0 ||
@@ -617,17 +811,45 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 		return -ENOBUFS;
 	}
 
-	ret = http_hpack_find_index(header, &name_only);
-	if (ret < 0) {
-		/* All literal */
-		len = hpack_encode_literal(buf, buflen, header);
-	} else if (name_only) {
-		/* Literal value */
-		len = hpack_encode_literal_value(buf, buflen, ret, header);
-	} else {
+	if (table != NULL && table->size_update) {
+		/* Signal the new size first in the header block, RFC7541 ch 4.2. */
+		ret = hpack_integer_encode(buf, buflen, table->max_size,
+					   HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+					   HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	index = http_hpack_find_index(header, &name_only, table);
+	if (index > 0 && !name_only) {
 		/* Indexed */
-		len = hpack_encode_indexed(buf, buflen, ret);
+		ret = hpack_encode_indexed(buf, buflen, index);
+	} else {
+		/* Literal, add it to the dynamic table if it fits. */
+		indexing = table != NULL &&
+			   header->name_len + header->value_len +
+			   HTTP_HPACK_ENTRY_OVERHEAD <= table->max_size;
+
+		ret = hpack_encode_literal(buf, buflen, MAX(index, 0), indexing,
+					   header);
+		if (ret >= 0 && indexing) {
+			hpack_table_add(table, header->name, header->name_len,
+					header->value, header->value_len);
+		}
 	}
 
-	return len;
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (table != NULL) {
+		table->size_update = false;
+	}
+
+	return len + ret;
 }
@@ -22,6 +22,7 @@
 #include <zephyr/net/tls_credentials.h>
 #include <zephyr/posix/sys/eventfd.h>
 #include <zephyr/posix/fnmatch.h>
+#include <zephyr/sys/crc.h>
 
 LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 
@@ -36,27 +37,60 @@ LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_SERVER_LOG_LEVEL);
 #endif
 
 #define INVALID_SOCK -1
+/* Client socket handed over to a worker, not polled meanwhile. */
+#define BUSY_SOCK -2
 #define INACTIVITY_TIMEOUT K_SECONDS(CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT)
 
 #define HTTP_SERVER_MAX_SERVICES CONFIG_HTTP_SERVER_NUM_SERVICES
 #define HTTP_SERVER_MAX_CLIENTS  CONFIG_HTTP_SERVER_MAX_CLIENTS
-#define HTTP_SERVER_SOCK_COUNT (1 + HTTP_SERVER_MAX_SERVICES + HTTP_SERVER_MAX_CLIENTS)
+#define HTTP_SERVER_WORKERS      CONFIG_HTTP_SERVER_WORKERS
+
+#if HTTP_SERVER_WORKERS > 0
+/* Stop eventfd and worker eventfd */
+#define HTTP_SERVER_EVENT_FDS 2
+#define WORKER_EVENT_FD 1
+#else
+#define HTTP_SERVER_EVENT_FDS 1
+#endif
+
+#define HTTP_SERVER_SOCK_COUNT (HTTP_SERVER_EVENT_FDS + HTTP_SERVER_MAX_SERVICES + \
+				HTTP_SERVER_MAX_CLIENTS)
 
 struct http_server_ctx {
 	int num_clients;
-	int listen_fds; /* max value of 1 + MAX_SERVICES */
+	int listen_fds; /* max value of HTTP_SERVER_EVENT_FDS + MAX_SERVICES */
 
 	/* First pollfd is eventfd that can be used to stop the server,
+	 * then, with workers, the eventfd the workers use to hand clients back,
 	 * then we have the server listen sockets,
 	 * and then the accepted sockets.
 	 */
 	struct zsock_pollfd fds[HTTP_SERVER_SOCK_COUNT];
 	struct http_client_ctx clients[HTTP_SERVER_MAX_CLIENTS];
+
+#if HTTP_SERVER_WORKERS > 0
+	/* Number of clients handed over to the workers. */
+	int busy_clients;
+#endif
 };
 
 static struct http_server_ctx server_ctx;
 static K_SEM_DEFINE(server_start, 0, 1);
 static bool server_running;
+static struct k_spinlock server_lock;
+
+#if HTTP_SERVER_WORKERS > 0
+K_MSGQ_DEFINE(worker_msgq, sizeof(struct http_client_ctx *),
+	      HTTP_SERVER_MAX_CLIENTS, sizeof(void *));
+K_MSGQ_DEFINE(worker_done_msgq, sizeof(struct http_client_ctx *),
+	      HTTP_SERVER_MAX_CLIENTS, sizeof(void *));
+K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, HTTP_SERVER_WORKERS,
+			    CONFIG_HTTP_SERVER_WORKER_STACK_SIZE);
+static struct k_thread worker_threads[HTTP_SERVER_WORKERS];
+
+/* Created once, as workers may still signal it while the server restarts. */
+static int worker_event_fd = INVALID_SOCK;
+#endif
 
 static void close_client_connection(struct http_client_ctx *client);
 
@@ -105,6 +139,14 @@ int http_server_init(struct http_server_ctx *ctx)
 	ctx->fds[count].events = ZSOCK_POLLIN;
 	count++;
 
+#if HTTP_SERVER_WORKERS > 0
+	ctx->fds[count].fd = worker_event_fd;
+	ctx->fds[count].events = ZSOCK_POLLIN;
+	count++;
+
+	ctx->busy_clients = 0;
+#endif
+
 	HTTP_SERVICE_FOREACH(svc) {
 		/* set the default address (in6addr_any / INADDR_ANY are all 0) */
 		memset(&addr_storage, 0, sizeof(struct sockaddr_storage));
@@ -265,6 +307,17 @@ static int accept_new_client(int server_fd)
 	return new_socket;
 }
 
+static bool is_worker_event_fd(int i)
+{
+#if HTTP_SERVER_WORKERS > 0
+	return i == WORKER_EVENT_FD;
+#else
+	ARG_UNUSED(i);
+
+	return false;
+#endif
+}
+
 static void close_all_sockets(struct http_server_ctx *ctx)
 {
 	zsock_close(ctx->fds[0].fd); /* close eventfd */
@@ -276,7 +329,9 @@ static void close_all_sockets(struct http_server_ctx *ctx)
 		}
 
 		if (i < ctx->listen_fds) {
-			zsock_close(ctx->fds[i].fd);
+			if (!is_worker_event_fd(i)) {
+				zsock_close(ctx->fds[i].fd);
+			}
 		} else {
 			struct http_client_ctx *client =
 				&server_ctx.clients[i - ctx->listen_fds];
@@ -326,25 +381,41 @@ static void client_release_resources(struct http_client_ctx *client)
 
 void http_server_release_client(struct http_client_ctx *client)
 {
-	int i;
+	int i = server_ctx.listen_fds + ARRAY_INDEX(server_ctx.clients, client);
 	struct k_work_sync sync;
+	k_spinlock_key_t key;
 
 	__ASSERT_NO_MSG(IS_ARRAY_ELEMENT(server_ctx.clients, client));
 
 	k_work_cancel_delayable_sync(&client->inactivity_timer, &sync);
 	client_release_resources(client);
 
+	memset(client, 0, sizeof(struct http_client_ctx));
+	client->fd = INVALID_SOCK;
+
+	/* Workers release their client while the server thread accepts. */
+	key = k_spin_lock(&server_lock);
 	server_ctx.num_clients--;
+	server_ctx.fds[i].fd = INVALID_SOCK;
+	k_spin_unlock(&server_lock, key);
+}
 
-	for (i = server_ctx.listen_fds; i < ARRAY_SIZE(server_ctx.fds); i++) {
-		if (server_ctx.fds[i].fd == client->fd) {
-			server_ctx.fds[i].fd = INVALID_SOCK;
-			break;
-		}
+bool http_server_claim_resource(struct http_resource_detail_dynamic *dynamic_detail,
+				struct http_client_ctx *client)
+{
+	k_spinlock_key_t key;
+	bool claimed = false;
+
+	key = k_spin_lock(&server_lock);
+
+	if (dynamic_detail->holder == NULL || dynamic_detail->holder == client) {
+		dynamic_detail->holder = client;
+		claimed = true;
 	}
 
-	memset(client, 0, sizeof(struct http_client_ctx));
-	client->fd = INVALID_SOCK;
+	k_spin_unlock(&server_lock, key);
+
+	return claimed;
 }
 
 static void close_client_connection(struct http_client_ctx *client)
@@ -386,6 +457,18 @@ static void init_client_ctx(struct http_client_ctx *client, int new_socket)
 	client->preface_sent = false;
 	client->window_size = HTTP_SERVER_INITIAL_WINDOW_SIZE;
 
+	http_hpack_table_init(&client->decoder_table,
+			      HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+
+	/* The client decoder starts with the default table size, signal the
+	 * smaller one used by the server, RFC7541 ch 4.2.
+	 */
+	http_hpack_table_init(&client->encoder_table,
+			      HTTP2_DEFAULT_HEADER_TABLE_SIZE);
+	client->encoder_table.size_update =
+		client->encoder_table.max_size != HTTP2_DEFAULT_HEADER_TABLE_SIZE &&
+		HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE > 0;
+
 	memset(client->buffer, 0, sizeof(client->buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
 	k_work_init_delayable(&client->inactivity_timer, client_timeout);
@@ -504,6 +587,112 @@ static int handle_http_request(struct http_client_ctx *client)
 	return 0;
 }
 
+static void handle_client_data(struct http_client_ctx *client)
+{
+	int ret;
+
+	ret = zsock_recv(client->fd, client->buffer + client->data_len,
+			 sizeof(client->buffer) - client->data_len, 0);
+	if (ret <= 0) {
+		if (ret == 0) {
+			LOG_DBG("Connection closed by peer for client #%d",
+				ARRAY_INDEX(server_ctx.clients, client));
+		} else {
+			ret = -errno;
+			LOG_DBG("ERROR reading from socket (%d)", ret);
+		}
+
+		close_client_connection(client);
+		return;
+	}
+
+	client->data_len += ret;
+
+	http_client_timer_restart(client);
+
+	ret = handle_http_request(client);
+	if (ret < 0 && ret != -EAGAIN) {
+		if (ret == -ENOTCONN) {
+			LOG_DBG("Client closed connection while handling request");
+		} else {
+			LOG_ERR("HTTP request handling error (%d)", ret);
+		}
+		close_client_connection(client);
+	} else if (client->data_len == sizeof(client->buffer)) {
+		/* If the RX buffer is still full after parsing,
+		 * it means we won't be able to handle this request
+		 * with the current buffer size.
+		 */
+		LOG_ERR("RX buffer too small to handle request");
+		close_client_connection(client);
+	}
+}
+
+#if HTTP_SERVER_WORKERS > 0
+static void http_server_worker(void *p1, void *p2, void *p3)
+{
+	struct http_client_ctx *client;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&worker_msgq, &client, K_FOREVER);
+
+		handle_client_data(client);
+
+		(void)k_msgq_put(&worker_done_msgq, &client, K_FOREVER);
+		(void)eventfd_write(worker_event_fd, 1);
+	}
+}
+
+static int http_server_workers_start(void)
+{
+	if (worker_event_fd >= 0) {
+		return 0;
+	}
+
+	worker_event_fd = eventfd(0, 0);
+	if (worker_event_fd < 0) {
+		return -errno;
+	}
+
+	for (int i = 0; i < HTTP_SERVER_WORKERS; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				http_server_worker, NULL, NULL, NULL,
+				THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker_threads[i], "http_worker");
+	}
+
+	return 0;
+}
+
+/* Poll the sockets of the clients the workers are done with again. */
+static void resume_clients(struct http_server_ctx *ctx, k_timeout_t timeout)
+{
+	struct http_client_ctx *client;
+	int i;
+
+	while (k_msgq_get(&worker_done_msgq, &client, timeout) == 0) {
+		i = ctx->listen_fds + ARRAY_INDEX(ctx->clients, client);
+
+		ctx->busy_clients--;
+
+		/* The slot is free if the worker closed the connection. */
+		if (ctx->fds[i].fd == BUSY_SOCK) {
+			ctx->fds[i].fd = client->fd;
+			ctx->fds[i].revents = 0;
+		}
+
+		if (ctx->busy_clients == 0 && K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+			break;
+		}
+	}
+}
+#endif /* HTTP_SERVER_WORKERS > 0 */
+
 static int http_server_run(struct http_server_ctx *ctx)
 {
 	struct http_client_ctx *client;
@@ -513,6 +702,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 	int ret, i, j;
 	int sock_error;
 	socklen_t optlen = sizeof(int);
+	k_spinlock_key_t key;
 
 	value = 0;
 
@@ -541,6 +731,17 @@ static int http_server_run(struct http_server_ctx *ctx)
 				continue;
 			}
 
+#if HTTP_SERVER_WORKERS > 0
+			if (i == WORKER_EVENT_FD) {
+				if (ctx->fds[i].revents & ZSOCK_POLLIN) {
+					eventfd_read(ctx->fds[i].fd, &value);
+					resume_clients(ctx, K_NO_WAIT);
+				}
+
+				continue;
+			}
+#endif
+
 			if (ctx->fds[i].revents & ZSOCK_POLLHUP) {
 				if (i >= ctx->listen_fds) {
 					LOG_DBG("Client #%d has disconnected",
@@ -591,16 +792,18 @@ static int http_server_run(struct http_server_ctx *ctx)
 						continue;
 					}
 
+					LOG_DBG("Init client #%d", j - ctx->listen_fds);
+
+					init_client_ctx(&ctx->clients[j - ctx->listen_fds],
+							new_socket);
+
+					key = k_spin_lock(&server_lock);
 					ctx->fds[j].fd = new_socket;
 					ctx->fds[j].events = ZSOCK_POLLIN;
 					ctx->fds[j].revents = 0;
-
 					ctx->num_clients++;
+					k_spin_unlock(&server_lock, key);
 
-					LOG_DBG("Init client #%d", j - ctx->listen_fds);
-
-					init_client_ctx(&ctx->clients[j - ctx->listen_fds],
-							new_socket);
 					found_slot = true;
 					break;
 				}
@@ -616,47 +819,28 @@ static int http_server_run(struct http_server_ctx *ctx)
 			/* Client sock */
 			client = &ctx->clients[i - ctx->listen_fds];
 
-			ret = zsock_recv(client->fd, client->buffer + client->data_len,
-					 sizeof(client->buffer) - client->data_len, 0);
-			if (ret <= 0) {
-				if (ret == 0) {
-					LOG_DBG("Connection closed by peer for client #%d",
-						i - ctx->listen_fds);
-				} else {
-					ret = -errno;
-					LOG_DBG("ERROR reading from socket (%d)", ret);
-				}
-
-				close_client_connection(client);
-				continue;
-			}
-
-			client->data_len += ret;
+#if HTTP_SERVER_WORKERS > 0
+			/* Don't poll the socket until the worker is done with it. */
+			ctx->fds[i].fd = BUSY_SOCK;
+			ctx->busy_clients++;
 
-			http_client_timer_restart(client);
-
-			ret = handle_http_request(client);
-			if (ret < 0 && ret != -EAGAIN) {
-				if (ret == -ENOTCONN) {
-					LOG_DBG("Client closed connection while handling request");
-				} else {
-					LOG_ERR("HTTP request handling error (%d)", ret);
-				}
-				close_client_connection(client);
-			} else if (client->data_len == sizeof(client->buffer)) {
-				/* If the RX buffer is still full after parsing,
-				 * it means we won't be able to handle this request
-				 * with the current buffer size.
-				 */
-				LOG_ERR("RX buffer too small to handle request");
-				close_client_connection(client);
-			}
+			(void)k_msgq_put(&worker_msgq, &client, K_FOREVER);
+#else
+			handle_client_data(client);
+#endif
 		}
 	}
 
 	return 0;
 
 closing:
+#if HTTP_SERVER_WORKERS > 0
+	/* Wait for the workers to hand all the clients back */
+	if (ctx->busy_clients > 0) {
+		resume_clients(ctx, K_FOREVER);
+	}
+#endif
+
 	/* Close all client connections and the server socket */
 	close_all_sockets(ctx);
 	return ret;
@@ -734,25 +918,77 @@ struct http_resource_detail *get_resource_detail(const char *path,
 
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size, bool *gzipped)
 {
+	bool prefer_gzip = *gzipped;
 	struct fs_dirent dirent;
 	size_t len;
 	int ret;
 
-	ret = fs_stat(fname, &dirent);
-	if (ret < 0) {
-		len = strlen(fname);
-		snprintk(fname + len, fname_size - len, ".gz");
+	len = strlen(fname);
+	*gzipped = false;
+
+	if (!prefer_gzip) {
 		ret = fs_stat(fname, &dirent);
-		*gzipped = (ret == 0);
+		if (ret == 0) {
+			goto found;
+		}
 	}
 
+	snprintk(fname + len, fname_size - len, ".gz");
+	ret = fs_stat(fname, &dirent);
 	if (ret == 0) {
-		*file_size = dirent.size;
-		return ret;
+		*gzipped = true;
+		goto found;
+	}
+
+	fname[len] = '\0';
+
+	if (prefer_gzip) {
+		ret = fs_stat(fname, &dirent);
+		if (ret == 0) {
+			goto found;
+		}
 	}
 
 	return -ENOENT;
+
+found:
+	*file_size = dirent.size;
+
+	return 0;
+}
+
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+uint32_t http_server_static_etag(struct http_resource_detail_static *static_detail)
+{
+	/* A resource whose CRC happens to be 0 is hashed on every request,
+	 * which is harmless.
+	 */
+	if (static_detail->etag == 0U) {
+		static_detail->etag = crc32_ieee(static_detail->static_data,
+						 static_detail->static_data_len);
+	}
+
+	return static_detail->etag;
+}
+
+bool http_server_etag_match(struct http_client_ctx *client, uint32_t etag)
+{
+	char tag[sizeof("\"01234567\"")];
+
+	if (client->if_none_match[0] == '\0') {
+		return false;
+	}
+
+	if (strcmp(client->if_none_match, "*") == 0) {
+		return true;
+	}
+
+	snprintk(tag, sizeof(tag), "\"%08x\"", etag);
+
+	/* The header may list several, possibly weak, tags. */
+	return strstr(client->if_none_match, tag) != NULL;
 }
+#endif /* CONFIG_HTTP_SERVER_STATIC_ETAG */
 
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size)
@@ -849,6 +1085,14 @@ static void http_server_thread(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+#if HTTP_SERVER_WORKERS > 0
+	ret = http_server_workers_start();
+	if (ret < 0) {
+		LOG_ERR("Failed to start HTTP server workers (%d)", ret);
+		return;
+	}
+#endif
+
 	while (true) {
 		k_sem_take(&server_start, K_FOREVER);
 
@@ -37,6 +37,23 @@ static const char conflict_response[] = "HTTP/1.1 409 Conflict\r\n\r\n";
 static const char final_chunk[] = "0\r\n\r\n";
 static const char *crlf = &final_chunk[3];
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+#define ETAG_TEMPLATE "ETag: \"%08x\"\r\n"
+
+static int handle_http1_not_modified(struct http_client_ctx *client, uint32_t etag)
+{
+	char http_response[sizeof("HTTP/1.1 304 Not Modified\r\n") +
+			   sizeof(ETAG_TEMPLATE) + sizeof("\r\n")];
+
+	snprintk(http_response, sizeof(http_response),
+		 "HTTP/1.1 304 Not Modified\r\n" ETAG_TEMPLATE "\r\n", etag);
+
+	return http_server_sendall(client, http_response, strlen(http_response));
+}
+#else
+#define ETAG_TEMPLATE ""
+#endif /* CONFIG_HTTP_SERVER_STATIC_ETAG */
+
 static int handle_http1_static_resource(
 	struct http_resource_detail_static *static_detail,
 	struct http_client_ctx *client)
@@ -50,39 +67,53 @@ static int handle_http1_static_resource(
 	char http_response[sizeof(RESPONSE_TEMPLATE) +
 			   sizeof("Content-Encoding: 01234567890123456789\r\n") +
 			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
-			   sizeof("xxxx") +
+			   sizeof("xxxx") + sizeof(ETAG_TEMPLATE) +
 			   sizeof("\r\n")];
 	const char *data;
 	int len;
+	int pos;
 	int ret;
 
 	if (static_detail->common.bitmask_of_supported_http_methods & BIT(HTTP_GET)) {
 		data = static_detail->static_data;
 		len = static_detail->static_data_len;
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+		uint32_t etag = http_server_static_etag(static_detail);
+
+		if (http_server_etag_match(client, etag)) {
+			return handle_http1_not_modified(client, etag);
+		}
+#endif
+
+		pos = snprintk(http_response, sizeof(http_response),
+			       RESPONSE_TEMPLATE,
+			       "Content-Type: ",
+			       static_detail->common.content_type == NULL ?
+			       "text/html" : static_detail->common.content_type,
+			       len);
+
 		if (static_detail->common.content_encoding != NULL &&
 		    static_detail->common.content_encoding[0] != '\0') {
-			snprintk(http_response, sizeof(http_response),
-				 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
-				 "Content-Type: ",
-				 static_detail->common.content_type == NULL ?
-				 "text/html" : static_detail->common.content_type,
-				 len, static_detail->common.content_encoding);
-		} else {
-			snprintk(http_response, sizeof(http_response),
-				 RESPONSE_TEMPLATE "\r\n",
-				 "Content-Type: ",
-				 static_detail->common.content_type == NULL ?
-				 "text/html" : static_detail->common.content_type,
-				 len);
+			pos += snprintk(http_response + pos, sizeof(http_response) - pos,
+					"Content-Encoding: %s\r\n",
+					static_detail->common.content_encoding);
 		}
 
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+		pos += snprintk(http_response + pos, sizeof(http_response) - pos,
+				ETAG_TEMPLATE, etag);
+#endif
+
+		snprintk(http_response + pos, sizeof(http_response) - pos, "\r\n");
+
 		ret = http_server_sendall(client, http_response,
 					  strlen(http_response));
 		if (ret < 0) {
 			return ret;
 		}
 
+		/* Sent straight from the resource, which may be in flash. */
 		ret = http_server_sendall(client, data, len);
 		if (ret < 0) {
 			return ret;
@@ -378,10 +409,16 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 {
 #define RESPONSE_TEMPLATE_STATIC_FS                                                                \
 	"HTTP/1.1 200 OK\r\n"                                                                      \
-	"Content-Type: %s%s\r\n\r\n"
+	"Content-Type: %s%s\r\n"                                                                   \
+	"Content-Length: %zu\r\n\r\n"
 #define CONTENT_ENCODING_GZIP "\r\nContent-Encoding: gzip"
 
-	bool gzipped = false;
+	/* The server thread serves one client at a time. */
+	static char http_response[MAX(CONFIG_HTTP_SERVER_STATIC_FS_BUFFER_SIZE,
+				      sizeof(RESPONSE_TEMPLATE_STATIC_FS) +
+				      HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
+				      sizeof(CONTENT_ENCODING_GZIP) + sizeof("4294967295"))];
+	bool gzipped = client->accept_gzip;
 	int len;
 	int remaining;
 	int ret;
@@ -389,11 +426,6 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 	struct fs_file_t file;
 	char fname[HTTP_SERVER_MAX_URL_LENGTH];
 	char content_type[HTTP_SERVER_MAX_CONTENT_TYPE_LEN] = "text/html";
-	/* Add couple of bytes to response template size to have space
-	 * for the content type and encoding
-	 */
-	char http_response[sizeof(RESPONSE_TEMPLATE_STATIC_FS) + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
-			   sizeof(CONTENT_ENCODING_GZIP)];
 
 	if (!(static_fs_detail->common.bitmask_of_supported_http_methods & BIT(HTTP_GET))) {
 		ret = http_server_sendall(client, not_allowed_response,
@@ -440,7 +472,7 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 
 	/* send HTTP header */
 	len = snprintk(http_response, sizeof(http_response), RESPONSE_TEMPLATE_STATIC_FS,
-		       content_type, gzipped ? CONTENT_ENCODING_GZIP : "");
+		       content_type, gzipped ? CONTENT_ENCODING_GZIP : "", file_size);
 	ret = http_server_sendall(client, http_response, len);
 	if (ret < 0) {
 		goto close;
@@ -450,13 +482,17 @@ int handle_http1_static_fs_resource(struct http_resource_detail_static_fs *stati
 	remaining = file_size;
 	while (remaining > 0) {
 		len = fs_read(&file, http_response, sizeof(http_response));
+		if (len <= 0) {
+			ret = len < 0 ? len : -EIO;
+			goto close;
+		}
+
 		ret = http_server_sendall(client, http_response, len);
 		if (ret < 0) {
 			goto close;
 		}
 		remaining -= len;
 	}
-	ret = http_server_sendall(client, "\r\n\r\n", 4);
 
 close:
 	/* close file */
@@ -483,7 +519,7 @@ static int handle_http1_dynamic_resource(
 		return -ENOPROTOOPT;
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_resource(dynamic_detail, client)) {
 		ret = http_server_sendall(client, conflict_response,
 					  sizeof(conflict_response) - 1);
 		if (ret < 0) {
@@ -494,8 +530,6 @@ static int handle_http1_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_HEAD:
 		if (user_method & BIT(HTTP_HEAD)) {
@@ -605,6 +639,11 @@ static int on_header_field(struct http_parser *parser, const char *at,
 				ctx->has_upgrade_header = true;
 			} else if (strcasecmp(ctx->header_buffer, "Sec-WebSocket-Key") == 0) {
 				ctx->websocket_sec_key_next = true;
+			} else if (strcasecmp(ctx->header_buffer, "Accept-Encoding") == 0) {
+				ctx->accept_encoding_next = true;
+			} else if (IS_ENABLED(CONFIG_HTTP_SERVER_STATIC_ETAG) &&
+				   strcasecmp(ctx->header_buffer, "If-None-Match") == 0) {
+				ctx->if_none_match_next = true;
 			}
 
 			ctx->header_buffer[0] = '\0';
@@ -665,6 +704,8 @@ static int on_header_value(struct http_parser *parser,
 			ctx->header_capture_ctx.status = HTTP_HEADER_STATUS_DROPPED;
 		}
 #endif /* defined(CONFIG_HTTP_SERVER_CAPTURE_HEADERS) */
+		ctx->accept_encoding_next = false;
+		ctx->if_none_match_next = false;
 	} else {
 		memcpy(ctx->header_buffer + offset, at, length);
 		offset += length;
@@ -693,6 +734,18 @@ static int on_header_value(struct http_parser *parser,
 				ctx->websocket_sec_key_next = false;
 			}
 
+			if (ctx->accept_encoding_next) {
+				ctx->accept_gzip = (strstr(ctx->header_buffer, "gzip") != NULL);
+				ctx->accept_encoding_next = false;
+			}
+
+			if (ctx->if_none_match_next) {
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+				memcpy(ctx->if_none_match, ctx->header_buffer, offset + 1);
+#endif
+				ctx->if_none_match_next = false;
+			}
+
 			ctx->header_buffer[0] = '\0';
 		}
 	}
@@ -771,6 +824,13 @@ int enter_http1_request(struct http_client_ctx *client)
 	client->parser_settings.on_message_complete = on_message_complete;
 	client->parser_state = HTTP1_INIT_HEADER_STATE;
 	client->http1_headers_sent = false;
+	client->accept_gzip = false;
+	client->accept_encoding_next = false;
+	client->if_none_match_next = false;
+
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+	client->if_none_match[0] = '\0';
+#endif
 
 #if defined(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)
 	client->header_capture_ctx.store_next_value = false;
@@ -115,7 +115,8 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
-	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field,
+				       &client->encoder_table);
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
@@ -258,7 +259,8 @@ int send_settings_frame(struct http_client_ctx *client, bool ack)
 			(settings_frame + HTTP2_FRAME_HEADER_SIZE);
 		UNALIGNED_PUT(htons(HTTP2_SETTINGS_HEADER_TABLE_SIZE),
 			      &setting->id);
-		UNALIGNED_PUT(0, &setting->value);
+		UNALIGNED_PUT(htonl(HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE),
+			      &setting->value);
 
 		setting++;
 		UNALIGNED_PUT(htons(HTTP2_SETTINGS_MAX_CONCURRENT_STREAMS),
@@ -407,7 +409,7 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 		.path_len = static_fs_detail->common.path_len,
 		.type = static_fs_detail->common.type,
 	};
-	bool gzipped;
+	bool gzipped = false;
 	int len;
 	int remaining;
 	char tmp[64];
@@ -705,7 +707,7 @@ static int handle_http2_dynamic_resource(
 		return -ENOPROTOOPT;
 	}
 
-	if (dynamic_detail->holder != NULL && dynamic_detail->holder != client) {
+	if (!http_server_claim_resource(dynamic_detail, client)) {
 		ret = send_http2_409(client, frame);
 		if (ret < 0) {
 			return ret;
@@ -714,8 +716,6 @@ static int handle_http2_dynamic_resource(
 		return enter_http_done_state(client);
 	}
 
-	dynamic_detail->holder = client;
-
 	switch (client->method) {
 	case HTTP_GET:
 		if (user_method & BIT(HTTP_GET)) {
@@ -1424,7 +1424,8 @@ int handle_http_frame_headers(struct http_client_ctx *client)
 		struct http_hpack_header_buf *header = &client->header_field;
 		size_t datalen = MIN(client->data_len, frame->length);
 
-		ret = http_hpack_decode_header(client->cursor, datalen, header);
+		ret = http_hpack_decode_header(client->cursor, datalen, header,
+					       &client->decoder_table);
 		if (ret <= 0) {
 			if (ret == -EAGAIN) {
 				ret = handle_incomplete_http_header(client);
@@ -1444,6 +1445,11 @@ int handle_http_frame_headers(struct http_client_ctx *client)
 		client->cursor += ret;
 		client->data_len -= ret;
 
+		if (header->name_len == 0) {
+			/* Dynamic table size update, no header field. */
+			continue;
+		}
+
 		LOG_DBG("Parsed header: %.*s %.*s", (int)header->name_len,
 			header->name, (int)header->value_len, header->value);
 
@@ -1573,6 +1579,26 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	return 0;
 }
 
+static void parse_http_frame_settings_fields(struct http_client_ctx *client)
+{
+	struct http2_frame *frame = &client->current_frame;
+	struct http2_settings_field *setting;
+	int count = frame->length / sizeof(struct http2_settings_field);
+
+	setting = (struct http2_settings_field *)client->cursor;
+
+	for (int i = 0; i < count; i++, setting++) {
+		uint16_t id = ntohs(UNALIGNED_GET(&setting->id));
+		uint32_t value = ntohl(UNALIGNED_GET(&setting->value));
+
+		if (id == HTTP2_SETTINGS_HEADER_TABLE_SIZE) {
+			/* Limits the table used to encode response headers. */
+			http_hpack_table_set_max_size(&client->encoder_table,
+						      value);
+		}
+	}
+}
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1584,6 +1610,10 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		parse_http_frame_settings_fields(client);
+	}
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
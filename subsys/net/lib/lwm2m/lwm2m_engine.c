@@ -625,7 +625,7 @@ static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestam
 			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
 		obs->last_timestamp = timestamp;
 
-		if (!rc) {
+		if (!rc && CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW == 0) {
 			/* create at most one notification */
 			goto cleanup;
 		}
@@ -383,6 +383,8 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 					timestamp = k_uptime_get();
 				}
 
+				timestamp = engine_observe_coalesce_timestamp(timestamp);
+
 				if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
 					obs->resource_update = true;
 					obs->event_timestamp = timestamp;
@@ -1443,7 +1445,7 @@ int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv
 	}
 
 	if (attrs.pmax) {
-		t_s = timestamp + MSEC_PER_SEC * attrs.pmax;
+		t_s = engine_observe_coalesce_timestamp(timestamp + MSEC_PER_SEC * attrs.pmax);
 	}
 
 	return t_s;
@@ -37,6 +37,18 @@ void clear_attrs(void *ref);
 int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv_obj_inst,
 					  const int64_t timestamp);
 
+static inline int64_t engine_observe_coalesce_timestamp(int64_t timestamp)
+{
+#if CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW > 0
+	const int64_t window = CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW;
+
+	/* Round up, so all events due in the same window fire together */
+	return ((timestamp + window - 1) / window) * window;
+#else
+	return timestamp;
+#endif
+}
+
 void remove_observer_from_list(struct lwm2m_ctx *ctx, sys_snode_t *prev_node,
 			       struct observe_node *obs);
 
@@ -89,6 +89,15 @@ static const struct default_obj_version default_obj_versions[] = {
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
 
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+static sys_slist_t engine_obj_inst_index[CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE];
+#endif
+
+/* Last object instance found, composite operations resolve many paths of the
+ * same instance in a row.
+ */
+static struct lwm2m_engine_obj_inst *engine_obj_inst_last;
+
 /* Resource wrappers */
 sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
@@ -165,6 +174,15 @@ struct lwm2m_engine_obj *lwm2m_engine_get_obj(const struct lwm2m_obj_path *path)
 }
 /* Engine object instance */
 
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+static sys_slist_t *engine_obj_inst_bucket(uint16_t obj_id, uint16_t obj_inst_id)
+{
+	uint32_t hash = ((uint32_t)obj_id << 16 | obj_inst_id) * 2654435761U;
+
+	return &engine_obj_inst_index[hash % CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE];
+}
+#endif
+
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
 #if defined(CONFIG_LWM2M_ACCESS_CONTROL_ENABLE)
@@ -176,6 +194,10 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+	sys_slist_append(engine_obj_inst_bucket(obj_inst->obj->obj_id, obj_inst->obj_inst_id),
+			 &obj_inst->index_node);
+#endif
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -185,17 +207,40 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+	sys_slist_find_and_remove(engine_obj_inst_bucket(obj_inst->obj->obj_id,
+							 obj_inst->obj_inst_id),
+				  &obj_inst->index_node);
+#endif
+	if (engine_obj_inst_last == obj_inst) {
+		engine_obj_inst_last = NULL;
+	}
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
-	struct lwm2m_engine_obj_inst *obj_inst;
+	struct lwm2m_engine_obj_inst *obj_inst = engine_obj_inst_last;
 
+	if (obj_inst && obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+		return obj_inst;
+	}
+
+#if CONFIG_LWM2M_ENGINE_OBJ_INST_INDEX_SIZE > 0
+	SYS_SLIST_FOR_EACH_CONTAINER(engine_obj_inst_bucket(obj_id, obj_inst_id), obj_inst,
+				     index_node) {
+		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+			engine_obj_inst_last = obj_inst;
+			return obj_inst;
+		}
+	}
+#else
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+			engine_obj_inst_last = obj_inst;
 			return obj_inst;
 		}
 	}
+#endif
 
 	return NULL;
 }
@@ -25,6 +25,9 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if CONFIG_MQTT_PUBLISH_INFLIGHT_MAX > 0
+	client->internal.inflight_count = 0U;
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -236,49 +239,195 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
-int mqtt_publish(struct mqtt_client *client,
-		 const struct mqtt_publish_param *param)
+#if CONFIG_MQTT_PUBLISH_INFLIGHT_MAX > 0
+static int inflight_find(const struct mqtt_client *client, uint16_t message_id)
 {
-	int err_code;
-	struct buf_ctx packet;
-	struct iovec io_vector[2];
-	struct msghdr msg;
+	for (int i = 0; i < client->internal.inflight_count; i++) {
+		if (client->internal.inflight[i] == message_id) {
+			return i;
+		}
+	}
 
-	NULL_PARAM_CHECK(client);
-	NULL_PARAM_CHECK(param);
+	return -ENOENT;
+}
 
-	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
-		 "Data size 0x%08x", client, client->internal.state,
-		 param->message.topic.topic.size,
-		 param->message.payload.len);
+static int inflight_check(const struct mqtt_client *client,
+			  const struct mqtt_publish_param *param)
+{
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		return 0;
+	}
 
-	mqtt_mutex_lock(client);
+	if (inflight_find(client, param->message_id) >= 0) {
+		/* Retransmissions reuse their entry. */
+		return param->dup_flag ? 0 : -EBUSY;
+	}
+
+	if (client->internal.inflight_count >= CONFIG_MQTT_PUBLISH_INFLIGHT_MAX) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static void inflight_add(struct mqtt_client *client,
+			 const struct mqtt_publish_param *param)
+{
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE ||
+	    inflight_find(client, param->message_id) >= 0) {
+		return;
+	}
+
+	client->internal.inflight[client->internal.inflight_count++] = param->message_id;
+}
+
+void mqtt_inflight_release(struct mqtt_client *client, uint16_t message_id)
+{
+	int i = inflight_find(client, message_id);
+
+	if (i < 0) {
+		return;
+	}
+
+	client->internal.inflight_count--;
+	client->internal.inflight[i] =
+		client->internal.inflight[client->internal.inflight_count];
+}
+#else
+static inline int inflight_check(const struct mqtt_client *client,
+				 const struct mqtt_publish_param *param)
+{
+	return 0;
+}
+
+static inline void inflight_add(struct mqtt_client *client,
+				const struct mqtt_publish_param *param)
+{
+}
+
+void mqtt_inflight_release(struct mqtt_client *client, uint16_t message_id)
+{
+}
+#endif /* CONFIG_MQTT_PUBLISH_INFLIGHT_MAX > 0 */
+
+/* Send the publish header from the tx buffer, followed by the payload
+ * vectors io_vector[1..iovlen - 1] given by the caller.
+ */
+static int client_publish(struct mqtt_client *client,
+			  const struct mqtt_publish_param *param,
+			  struct iovec *io_vector, size_t iovlen)
+{
+	int err_code;
+	struct buf_ctx packet;
+	struct msghdr msg;
 
 	tx_buf_init(client, &packet);
 
 	err_code = verify_tx_state(client);
 	if (err_code < 0) {
-		goto error;
+		return err_code;
+	}
+
+	err_code = inflight_check(client, param);
+	if (err_code < 0) {
+		return err_code;
 	}
 
 	err_code = publish_encode(param, &packet);
 	if (err_code < 0) {
-		goto error;
+		return err_code;
 	}
 
 	io_vector[0].iov_base = packet.cur;
 	io_vector[0].iov_len = packet.end - packet.cur;
-	io_vector[1].iov_base = param->message.payload.data;
-	io_vector[1].iov_len = param->message.payload.len;
 
 	memset(&msg, 0, sizeof(msg));
 
 	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	msg.msg_iovlen = iovlen;
 
 	err_code = client_write_msg(client, &msg);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	inflight_add(client, param);
+
+	return 0;
+}
+
+int mqtt_publish(struct mqtt_client *client,
+		 const struct mqtt_publish_param *param)
+{
+	int err_code;
+	struct iovec io_vector[2];
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 param->message.payload.len);
+
+	mqtt_mutex_lock(client);
+
+	io_vector[1].iov_base = param->message.payload.data;
+	io_vector[1].iov_len = param->message.payload.len;
+
+	err_code = client_publish(client, param, io_vector, ARRAY_SIZE(io_vector));
+
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+#define MQTT_PUBLISH_MAX_FRAGMENTS 8
+
+int mqtt_publish_net_buf(struct mqtt_client *client,
+			 const struct mqtt_publish_param *param,
+			 struct net_buf *payload)
+{
+	int err_code;
+	struct iovec io_vector[1 + MQTT_PUBLISH_MAX_FRAGMENTS];
+	struct mqtt_publish_param frag_param;
+	size_t iovlen = 1;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+	NULL_PARAM_CHECK(payload);
+
+	frag_param = *param;
+	frag_param.message.payload.data = NULL;
+	frag_param.message.payload.len = 0U;
+
+	for (struct net_buf *frag = payload; frag != NULL; frag = frag->frags) {
+		if (frag->len == 0U) {
+			continue;
+		}
+
+		if (iovlen == ARRAY_SIZE(io_vector)) {
+			return -EMSGSIZE;
+		}
+
+		io_vector[iovlen].iov_base = frag->data;
+		io_vector[iovlen].iov_len = frag->len;
+		frag_param.message.payload.len += frag->len;
+		iovlen++;
+	}
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x in %zu fragments", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 frag_param.message.payload.len, iovlen - 1);
+
+	mqtt_mutex_lock(client);
+
+	err_code = client_publish(client, &frag_param, io_vector, iovlen);
 
-error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
 			 client, client->internal.state, err_code);
 
@@ -154,6 +154,13 @@ enum mqtt_state {
  */
 void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
 
+/**@brief Releases the in-flight entry of an acknowledged publish.
+ *
+ * @param[in] client Identifies the client for which the ack was received.
+ * @param[in] message_id Message ID of the acknowledged publish.
+ */
+void mqtt_inflight_release(struct mqtt_client *client, uint16_t message_id);
+
 /**@brief Handles MQTT messages received from the peer.
  *
  * @param[in] client Identifies the client for which the data was received.
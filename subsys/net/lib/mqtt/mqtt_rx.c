@@ -77,6 +77,9 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(buf, &evt.param.puback);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_release(client, evt.param.puback.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -101,6 +104,9 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBCOMP;
 		err_code = publish_complete_decode(buf, &evt.param.pubcomp);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_release(client, evt.param.pubcomp.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_SUBACK:
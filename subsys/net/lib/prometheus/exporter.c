@@ -0,0 +1,688 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/net/prometheus/exporter.h>
+#include <zephyr/net/prometheus/formatter.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_NET_STATISTICS_USER_API)
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_stats.h>
+#endif
+
+#if defined(CONFIG_NET_NATIVE) || defined(CONFIG_NET_OFFLOAD)
+#include <zephyr/net/net_pkt.h>
+#define EXPORTER_NET_PKT 1
+#endif
+
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (K_HEAP_MEM_POOL_SIZE > 0)
+#include <zephyr/sys/sys_heap.h>
+#define EXPORTER_SYSTEM_HEAP 1
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(pm_exporter, CONFIG_PROMETHEUS_LOG_LEVEL);
+
+#define LABELS_LEN 48
+
+/* One metric family, formatted as its HELP and TYPE lines and its samples */
+struct exporter_family {
+	const char *name;
+	const char *help;
+	const char *type;
+	/* Fill the labels and value of a sample, -ENOENT past the last one */
+	int (*sample)(int index, char *labels, size_t labels_len, uint64_t *value);
+};
+
+#if defined(CONFIG_OBJ_CORE)
+struct obj_core_nth {
+	int n;
+	struct k_obj_core *obj_core;
+};
+
+static int obj_core_nth_cb(struct k_obj_core *obj_core, void *data)
+{
+	struct obj_core_nth *nth = data;
+
+	if (nth->n-- == 0) {
+		nth->obj_core = obj_core;
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Objects are looked up by position so that a scrape never holds the
+ * object core lock for longer than one list walk.
+ */
+static struct k_obj_core *obj_core_get(uint32_t type_id, int index)
+{
+	struct k_obj_type *type = k_obj_type_find(type_id);
+	struct obj_core_nth nth = { .n = index, .obj_core = NULL };
+
+	if (type == NULL) {
+		return NULL;
+	}
+
+	(void)k_obj_type_walk_locked(type, obj_core_nth_cb, &nth);
+
+	return nth.obj_core;
+}
+#endif /* CONFIG_OBJ_CORE */
+
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+static int cpu_stats_get(int index, char *labels, size_t labels_len,
+			 k_thread_runtime_stats_t *stats)
+{
+	if ((unsigned int)index >= arch_num_cpus()) {
+		return -ENOENT;
+	}
+
+	snprintk(labels, labels_len, "cpu=\"%d\"", index);
+
+	return k_thread_runtime_stats_cpu_get(index, stats);
+}
+
+static int cpu_busy_cycles(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	k_thread_runtime_stats_t stats;
+	int ret;
+
+	ret = cpu_stats_get(index, labels, labels_len, &stats);
+	*value = stats.total_cycles;
+
+	return ret;
+}
+
+static int cpu_idle_cycles(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	k_thread_runtime_stats_t stats;
+	int ret;
+
+	ret = cpu_stats_get(index, labels, labels_len, &stats);
+	*value = stats.idle_cycles;
+
+	return ret;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+
+#if defined(CONFIG_OBJ_CORE_STATS_THREAD)
+static int thread_stats_get(int index, char *labels, size_t labels_len,
+			    k_thread_runtime_stats_t *stats, struct k_thread **thread_ptr)
+{
+	struct k_obj_core *obj_core = obj_core_get(K_OBJ_TYPE_THREAD_ID, index);
+	struct k_thread *thread;
+	const char *name;
+
+	if (obj_core == NULL) {
+		return -ENOENT;
+	}
+
+	thread = CONTAINER_OF(obj_core, struct k_thread, obj_core);
+
+	name = k_thread_name_get(thread);
+	if (name != NULL && name[0] != '\0') {
+		snprintk(labels, labels_len, "thread=\"%s\"", name);
+	} else {
+		snprintk(labels, labels_len, "thread=\"%p\"", (void *)thread);
+	}
+
+	if (thread_ptr != NULL) {
+		*thread_ptr = thread;
+	}
+
+	return k_obj_core_stats_query(obj_core, stats, sizeof(*stats));
+}
+
+static int thread_cycles(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	k_thread_runtime_stats_t stats;
+	int ret;
+
+	ret = thread_stats_get(index, labels, labels_len, &stats, NULL);
+	*value = stats.total_cycles;
+
+	return ret;
+}
+
+#if defined(CONFIG_THREAD_STACK_INFO)
+static int thread_stack_size(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	k_thread_runtime_stats_t stats;
+	struct k_thread *thread;
+	int ret;
+
+	ret = thread_stats_get(index, labels, labels_len, &stats, &thread);
+	if (ret == 0) {
+		*value = thread->stack_info.size;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_THREAD_STACK_INFO */
+
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+static int thread_stack_used(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	k_thread_runtime_stats_t stats;
+	int ret;
+
+	ret = thread_stats_get(index, labels, labels_len, &stats, NULL);
+	*value = stats.stack_used;
+
+	return ret;
+}
+#endif /* CONFIG_THREAD_ANALYZER_INCREMENTAL */
+#endif /* CONFIG_OBJ_CORE_STATS_THREAD */
+
+#if defined(CONFIG_OBJ_CORE_STATS_MEM_SLAB)
+static int mem_slab_stats_get(int index, char *labels, size_t labels_len,
+			      struct sys_memory_stats *stats)
+{
+	struct k_obj_core *obj_core = obj_core_get(K_OBJ_TYPE_MEM_SLAB_ID, index);
+
+	if (obj_core == NULL) {
+		return -ENOENT;
+	}
+
+	snprintk(labels, labels_len, "slab=\"%p\"",
+		 (void *)CONTAINER_OF(obj_core, struct k_mem_slab, obj_core));
+
+	return k_obj_core_stats_query(obj_core, stats, sizeof(*stats));
+}
+
+static int mem_slab_used(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = mem_slab_stats_get(index, labels, labels_len, &stats);
+	*value = stats.allocated_bytes;
+
+	return ret;
+}
+
+static int mem_slab_free(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = mem_slab_stats_get(index, labels, labels_len, &stats);
+	*value = stats.free_bytes;
+
+	return ret;
+}
+
+static int mem_slab_max_used(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = mem_slab_stats_get(index, labels, labels_len, &stats);
+	*value = stats.max_allocated_bytes;
+
+	return ret;
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MEM_SLAB */
+
+#if defined(EXPORTER_SYSTEM_HEAP)
+extern struct k_heap _system_heap;
+
+static int heap_stats_get(int index, char *labels, size_t labels_len,
+			  struct sys_memory_stats *stats)
+{
+	if (index > 0) {
+		return -ENOENT;
+	}
+
+	snprintk(labels, labels_len, "heap=\"system\"");
+
+	return sys_heap_runtime_stats_get(&_system_heap.heap, stats);
+}
+
+static int heap_allocated(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = heap_stats_get(index, labels, labels_len, &stats);
+	*value = stats.allocated_bytes;
+
+	return ret;
+}
+
+static int heap_free(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = heap_stats_get(index, labels, labels_len, &stats);
+	*value = stats.free_bytes;
+
+	return ret;
+}
+
+static int heap_max_allocated(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct sys_memory_stats stats;
+	int ret;
+
+	ret = heap_stats_get(index, labels, labels_len, &stats);
+	*value = stats.max_allocated_bytes;
+
+	return ret;
+}
+#endif /* EXPORTER_SYSTEM_HEAP */
+
+#if defined(CONFIG_OBJ_CORE_MSGQ)
+static struct k_msgq *msgq_get(int index, char *labels, size_t labels_len)
+{
+	struct k_obj_core *obj_core = obj_core_get(K_OBJ_TYPE_MSGQ_ID, index);
+	struct k_msgq *msgq;
+
+	if (obj_core == NULL) {
+		return NULL;
+	}
+
+	msgq = CONTAINER_OF(obj_core, struct k_msgq, obj_core);
+	snprintk(labels, labels_len, "msgq=\"%p\"", (void *)msgq);
+
+	return msgq;
+}
+
+static int msgq_used(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct k_msgq *msgq = msgq_get(index, labels, labels_len);
+
+	if (msgq == NULL) {
+		return -ENOENT;
+	}
+
+	*value = k_msgq_num_used_get(msgq);
+
+	return 0;
+}
+
+static int msgq_max(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct k_msgq *msgq = msgq_get(index, labels, labels_len);
+
+	if (msgq == NULL) {
+		return -ENOENT;
+	}
+
+	*value = msgq->max_msgs;
+
+	return 0;
+}
+#endif /* CONFIG_OBJ_CORE_MSGQ */
+
+#if defined(CONFIG_NET_STATISTICS_USER_API)
+/* Read as a whole at the start of each exposition so that all network
+ * samples of one scrape are consistent.
+ */
+static struct net_stats net_stats_snapshot;
+
+struct net_stat_entry {
+	const char *proto;
+	const char *event;
+	size_t offset;
+};
+
+#define NET_STAT_ENTRY(_proto, _event)                                                             \
+	{ STRINGIFY(_proto), STRINGIFY(_event), offsetof(struct net_stats, _proto._event) }
+
+static const struct net_stat_entry net_packet_stats[] = {
+#if defined(CONFIG_NET_STATISTICS_IPV4)
+	NET_STAT_ENTRY(ipv4, recv),
+	NET_STAT_ENTRY(ipv4, sent),
+	NET_STAT_ENTRY(ipv4, drop),
+#endif
+#if defined(CONFIG_NET_STATISTICS_IPV6)
+	NET_STAT_ENTRY(ipv6, recv),
+	NET_STAT_ENTRY(ipv6, sent),
+	NET_STAT_ENTRY(ipv6, drop),
+#endif
+#if defined(CONFIG_NET_STATISTICS_ICMP)
+	NET_STAT_ENTRY(icmp, recv),
+	NET_STAT_ENTRY(icmp, sent),
+	NET_STAT_ENTRY(icmp, drop),
+#endif
+#if defined(CONFIG_NET_STATISTICS_UDP)
+	NET_STAT_ENTRY(udp, recv),
+	NET_STAT_ENTRY(udp, sent),
+	NET_STAT_ENTRY(udp, drop),
+#endif
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	NET_STAT_ENTRY(tcp, recv),
+	NET_STAT_ENTRY(tcp, sent),
+	NET_STAT_ENTRY(tcp, drop),
+#endif
+};
+
+static int net_bytes(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	switch (index) {
+	case 0:
+		snprintk(labels, labels_len, "direction=\"sent\"");
+		*value = net_stats_snapshot.bytes.sent;
+		return 0;
+	case 1:
+		snprintk(labels, labels_len, "direction=\"received\"");
+		*value = net_stats_snapshot.bytes.received;
+		return 0;
+	default:
+		return -ENOENT;
+	}
+}
+
+static int net_packets(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	const struct net_stat_entry *entry;
+
+	if ((size_t)index >= ARRAY_SIZE(net_packet_stats)) {
+		return -ENOENT;
+	}
+
+	entry = &net_packet_stats[index];
+	snprintk(labels, labels_len, "proto=\"%s\",event=\"%s\"", entry->proto, entry->event);
+	*value = *(const net_stats_t *)((const uint8_t *)&net_stats_snapshot + entry->offset);
+
+	return 0;
+}
+
+static int net_processing_errors(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	if (index > 0) {
+		return -ENOENT;
+	}
+
+	labels[0] = '\0';
+	*value = net_stats_snapshot.processing_error;
+
+	return 0;
+}
+#endif /* CONFIG_NET_STATISTICS_USER_API */
+
+#if defined(EXPORTER_NET_PKT)
+static struct k_mem_slab *net_pkt_slab_get(int index, char *labels, size_t labels_len)
+{
+	struct k_mem_slab *rx, *tx;
+	struct net_buf_pool *rx_data, *tx_data;
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	switch (index) {
+	case 0:
+		snprintk(labels, labels_len, "pool=\"rx\"");
+		return rx;
+	case 1:
+		snprintk(labels, labels_len, "pool=\"tx\"");
+		return tx;
+	default:
+		return NULL;
+	}
+}
+
+static int net_pkt_free(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct k_mem_slab *slab = net_pkt_slab_get(index, labels, labels_len);
+
+	if (slab == NULL) {
+		return -ENOENT;
+	}
+
+	*value = k_mem_slab_num_free_get(slab);
+
+	return 0;
+}
+
+static int net_pkt_count(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct k_mem_slab *slab = net_pkt_slab_get(index, labels, labels_len);
+
+	if (slab == NULL) {
+		return -ENOENT;
+	}
+
+	*value = slab->info.num_blocks;
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+static int net_buf_free(int index, char *labels, size_t labels_len, uint64_t *value)
+{
+	struct k_mem_slab *rx, *tx;
+	struct net_buf_pool *rx_data, *tx_data;
+	struct net_buf_pool *pool;
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	switch (index) {
+	case 0:
+		snprintk(labels, labels_len, "pool=\"rx_data\"");
+		pool = rx_data;
+		break;
+	case 1:
+		snprintk(labels, labels_len, "pool=\"tx_data\"");
+		pool = tx_data;
+		break;
+	default:
+		return -ENOENT;
+	}
+
+	*value = atomic_get(&pool->avail_count);
+
+	return 0;
+}
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+#endif /* EXPORTER_NET_PKT */
+
+static const struct exporter_family families[] = {
+#if defined(CONFIG_SCHED_THREAD_USAGE_ALL)
+	{ "zephyr_cpu_busy_cycles_total", "Cycles spent running non-idle threads",
+	  "counter", cpu_busy_cycles },
+	{ "zephyr_cpu_idle_cycles_total", "Cycles spent idle", "counter", cpu_idle_cycles },
+#endif
+#if defined(CONFIG_OBJ_CORE_STATS_THREAD)
+	{ "zephyr_thread_cycles_total", "Cycles spent running the thread",
+	  "counter", thread_cycles },
+#if defined(CONFIG_THREAD_STACK_INFO)
+	{ "zephyr_thread_stack_size_bytes", "Stack size of the thread",
+	  "gauge", thread_stack_size },
+#endif
+#if defined(CONFIG_THREAD_ANALYZER_INCREMENTAL)
+	{ "zephyr_thread_stack_used_bytes", "Stack high watermark of the thread",
+	  "gauge", thread_stack_used },
+#endif
+#endif /* CONFIG_OBJ_CORE_STATS_THREAD */
+#if defined(CONFIG_OBJ_CORE_STATS_MEM_SLAB)
+	{ "zephyr_mem_slab_used_bytes", "Bytes allocated from the memory slab",
+	  "gauge", mem_slab_used },
+	{ "zephyr_mem_slab_free_bytes", "Bytes free in the memory slab",
+	  "gauge", mem_slab_free },
+	{ "zephyr_mem_slab_max_used_bytes", "Most bytes ever allocated from the memory slab",
+	  "gauge", mem_slab_max_used },
+#endif
+#if defined(EXPORTER_SYSTEM_HEAP)
+	{ "zephyr_heap_allocated_bytes", "Bytes allocated from the heap",
+	  "gauge", heap_allocated },
+	{ "zephyr_heap_free_bytes", "Bytes free in the heap", "gauge", heap_free },
+	{ "zephyr_heap_max_allocated_bytes", "Most bytes ever allocated from the heap",
+	  "gauge", heap_max_allocated },
+#endif
+#if defined(CONFIG_OBJ_CORE_MSGQ)
+	{ "zephyr_msgq_used_msgs", "Messages queued in the message queue", "gauge", msgq_used },
+	{ "zephyr_msgq_max_msgs", "Capacity of the message queue", "gauge", msgq_max },
+#endif
+#if defined(CONFIG_NET_STATISTICS_USER_API)
+	{ "zephyr_net_bytes_total", "Bytes transferred on all network interfaces",
+	  "counter", net_bytes },
+	{ "zephyr_net_packets_total", "Network packets per protocol and event",
+	  "counter", net_packets },
+	{ "zephyr_net_processing_errors_total", "Malformed or unhandled network packets",
+	  "counter", net_processing_errors },
+#endif
+#if defined(EXPORTER_NET_PKT)
+	{ "zephyr_net_pkt_free", "Free network packets", "gauge", net_pkt_free },
+	{ "zephyr_net_pkt_count", "Size of the network packet pool", "gauge", net_pkt_count },
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	{ "zephyr_net_buf_free", "Free network data buffers", "gauge", net_buf_free },
+#endif
+#endif /* EXPORTER_NET_PKT */
+};
+
+void prometheus_exporter_format_start(struct prometheus_exporter_ctx *ctx)
+{
+	ctx->family = 0;
+	ctx->sample = -1;
+
+#if defined(CONFIG_NET_STATISTICS_USER_API)
+	if (net_mgmt(NET_REQUEST_STATS_GET_ALL, NULL, &net_stats_snapshot,
+		     sizeof(net_stats_snapshot)) < 0) {
+		memset(&net_stats_snapshot, 0, sizeof(net_stats_snapshot));
+	}
+#endif
+}
+
+int prometheus_exporter_format_next(struct prometheus_exporter_ctx *ctx, char *buffer,
+				    size_t buffer_size)
+{
+	char labels[LABELS_LEN];
+	size_t len = 0;
+	uint64_t value;
+	int ret;
+
+	if (ctx == NULL || buffer == NULL || buffer_size == 0) {
+		LOG_ERR("Invalid arguments");
+		return -EINVAL;
+	}
+
+	buffer[0] = '\0';
+
+	while (ctx->family < ARRAY_SIZE(families)) {
+		const struct exporter_family *family = &families[ctx->family];
+
+		if (ctx->sample < 0) {
+			ret = snprintk(buffer + len, buffer_size - len,
+				       "# HELP %s %s\n# TYPE %s %s\n",
+				       family->name, family->help, family->name, family->type);
+		} else {
+			ret = family->sample(ctx->sample, labels, sizeof(labels), &value);
+			if (ret == -ENOENT) {
+				ctx->family++;
+				ctx->sample = -1;
+				continue;
+			}
+
+			if (ret < 0) {
+				/* object without statistics, skip it */
+				ctx->sample++;
+				continue;
+			}
+
+			if (labels[0] != '\0') {
+				ret = snprintk(buffer + len, buffer_size - len, "%s{%s} %llu\n",
+					       family->name, labels, (unsigned long long)value);
+			} else {
+				ret = snprintk(buffer + len, buffer_size - len, "%s %llu\n",
+					       family->name, (unsigned long long)value);
+			}
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		if ((size_t)ret >= buffer_size - len) {
+			if (len == 0) {
+				LOG_ERR("Buffer too small for %s", family->name);
+				return -ENOMEM;
+			}
+
+			/* drop the partial line, it goes into the next chunk */
+			buffer[len] = '\0';
+			break;
+		}
+
+		len += ret;
+		ctx->sample++;
+	}
+
+	return len;
+}
+
+static struct {
+	struct http_client_ctx *client;
+	size_t next_metric;
+	struct prometheus_exporter_ctx ctx;
+	char buffer[CONFIG_PROMETHEUS_EXPORTER_CHUNK_SIZE];
+} http_scrape;
+
+int prometheus_exporter_http_handler(struct http_client_ctx *client, enum http_data_status status,
+				     uint8_t *buffer, size_t len,
+				     struct http_response_ctx *response_ctx, void *user_data)
+{
+	const struct prometheus_collector *collector = user_data;
+	int ret = 0;
+
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(len);
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		if (http_scrape.client == client) {
+			http_scrape.client = NULL;
+		}
+
+		return 0;
+	}
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	if (http_scrape.client == NULL) {
+		http_scrape.client = client;
+		http_scrape.next_metric = 0;
+		prometheus_exporter_format_start(&http_scrape.ctx);
+	} else if (http_scrape.client != client) {
+		/* one scrape at a time, the chunk buffer is shared */
+		return -EBUSY;
+	}
+
+	if (collector != NULL) {
+		ret = prometheus_format_exposition_next(collector, &http_scrape.next_metric,
+							http_scrape.buffer,
+							sizeof(http_scrape.buffer));
+	}
+
+	if (ret == 0) {
+		ret = prometheus_exporter_format_next(&http_scrape.ctx, http_scrape.buffer,
+						      sizeof(http_scrape.buffer));
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Cannot format exposition data (%d)", ret);
+		http_scrape.client = NULL;
+		return ret;
+	}
+
+	response_ctx->body = (const uint8_t *)http_scrape.buffer;
+	response_ctx->body_len = ret;
+
+	if (ret == 0) {
+		response_ctx->final_chunk = true;
+		http_scrape.client = NULL;
+	}
+
+	return 0;
+}
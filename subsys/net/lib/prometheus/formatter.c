@@ -45,193 +45,236 @@ static int write_metric_to_buffer(char *buffer, size_t buffer_size, const char *
 	return 0;
 }
 
-int prometheus_format_exposition(const struct prometheus_collector *collector, char *buffer,
-				 size_t buffer_size)
+static int format_metric(const struct prometheus_collector *collector,
+			 const struct prometheus_metric *metric, char *buffer, size_t buffer_size)
 {
 	int ret;
-	int written = 0;
 
-	if (collector == NULL || buffer == NULL || buffer_size == 0) {
-		LOG_ERR("Invalid arguments");
-		return -EINVAL;
+	/* write HELP line if available */
+	if (metric->description[0] != '\0') {
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# HELP %s %s\n", metric->name,
+					     metric->description);
+		if (ret < 0) {
+			LOG_DBG("Error writing to buffer");
+			return ret;
+		}
 	}
 
-	/* iterate through each metric in the collector */
-	for (size_t ind = 0; ind < collector->size; ind++) {
+	/* write TYPE line */
+	switch (metric->type) {
+	case PROMETHEUS_COUNTER:
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# TYPE %s counter\n", metric->name);
+		if (ret < 0) {
+			LOG_DBG("Error writing counter");
+			return ret;
+		}
+		break;
+	case PROMETHEUS_GAUGE:
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# TYPE %s gauge\n", metric->name);
+		if (ret < 0) {
+			LOG_DBG("Error writing gauge");
+			return ret;
+		}
+		break;
+	case PROMETHEUS_HISTOGRAM:
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# TYPE %s histogram\n", metric->name);
+		if (ret < 0) {
+			LOG_DBG("Error writing histogram");
+			return ret;
+		}
+		break;
+	case PROMETHEUS_SUMMARY:
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# TYPE %s summary\n", metric->name);
+		if (ret < 0) {
+			LOG_DBG("Error writing summary");
+			return ret;
+		}
+		break;
+	default:
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "# TYPE %s untyped\n", metric->name);
+		if (ret < 0) {
+			LOG_DBG("Error writing untyped");
+			return ret;
+		}
+		break;
+	}
+
+	/* write metric-specific fields */
+	switch (metric->type) {
+	case PROMETHEUS_COUNTER: {
+		const struct prometheus_counter *counter =
+			(const struct prometheus_counter *)prometheus_collector_get_metric(
+				collector, metric->name);
 
-		const struct prometheus_metric *metric = collector->metric[ind];
+		LOG_DBG("counter->value: %llu", counter->value);
 
-		/* write HELP line if available */
-		if (metric->description[0] != '\0') {
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# HELP %s %s\n", metric->name,
-						     metric->description);
+		for (int i = 0; i < metric->num_labels; ++i) {
+			ret = write_metric_to_buffer(
+				buffer, buffer_size,
+				"%s{%s=\"%s\"} %llu\n", metric->name, metric->labels[i].key,
+				metric->labels[i].value, counter->value);
 			if (ret < 0) {
-				LOG_ERR("Error writing to buffer");
+				LOG_DBG("Error writing counter");
 				return ret;
 			}
 		}
+		break;
+	}
+	case PROMETHEUS_GAUGE: {
+		const struct prometheus_gauge *gauge =
+			(const struct prometheus_gauge *)prometheus_collector_get_metric(
+				collector, metric->name);
 
-		/* write TYPE line */
-		switch (metric->type) {
-		case PROMETHEUS_COUNTER:
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# TYPE %s counter\n", metric->name);
-			if (ret < 0) {
-				LOG_ERR("Error writing counter");
-				return ret;
-			}
-			break;
-		case PROMETHEUS_GAUGE:
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# TYPE %s gauge\n", metric->name);
-			if (ret < 0) {
-				LOG_ERR("Error writing gauge");
-				return ret;
-			}
-			break;
-		case PROMETHEUS_HISTOGRAM:
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# TYPE %s histogram\n", metric->name);
-			if (ret < 0) {
-				LOG_ERR("Error writing histogram");
-				return ret;
-			}
-			break;
-		case PROMETHEUS_SUMMARY:
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# TYPE %s summary\n", metric->name);
+		LOG_DBG("gauge->value: %f", gauge->value);
+
+		for (int i = 0; i < metric->num_labels; ++i) {
+			ret = write_metric_to_buffer(
+				buffer, buffer_size,
+				"%s{%s=\"%s\"} %f\n", metric->name, metric->labels[i].key,
+				metric->labels[i].value, gauge->value);
 			if (ret < 0) {
-				LOG_ERR("Error writing summary");
+				LOG_DBG("Error writing gauge");
 				return ret;
 			}
-			break;
-		default:
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "# TYPE %s untyped\n", metric->name);
+		}
+		break;
+	}
+	case PROMETHEUS_HISTOGRAM: {
+		const struct prometheus_histogram *histogram =
+			(const struct prometheus_histogram *)
+				prometheus_collector_get_metric(collector, metric->name);
+
+		LOG_DBG("histogram->count: %lu", histogram->count);
+
+		for (int i = 0; i < histogram->num_buckets; ++i) {
+			ret = write_metric_to_buffer(
+				buffer, buffer_size,
+				"%s_bucket{le=\"%f\"} %lu\n", metric->name,
+				histogram->buckets[i].upper_bound,
+				histogram->buckets[i].count);
 			if (ret < 0) {
-				LOG_ERR("Error writing untyped");
+				LOG_DBG("Error writing histogram");
 				return ret;
 			}
-			break;
 		}
 
-		/* write metric-specific fields */
-		switch (metric->type) {
-		case PROMETHEUS_COUNTER: {
-			const struct prometheus_counter *counter =
-				(const struct prometheus_counter *)prometheus_collector_get_metric(
-					collector, metric->name);
-
-			LOG_DBG("counter->value: %llu", counter->value);
-
-			for (int i = 0; i < metric->num_labels; ++i) {
-				ret = write_metric_to_buffer(
-					buffer + written, buffer_size - written,
-					"%s{%s=\"%s\"} %llu\n", metric->name, metric->labels[i].key,
-					metric->labels[i].value, counter->value);
-				if (ret < 0) {
-					LOG_ERR("Error writing counter");
-					return ret;
-				}
-			}
-			break;
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "%s_sum %f\n", metric->name, histogram->sum);
+		if (ret < 0) {
+			LOG_DBG("Error writing histogram");
+			return ret;
 		}
-		case PROMETHEUS_GAUGE: {
-			const struct prometheus_gauge *gauge =
-				(const struct prometheus_gauge *)prometheus_collector_get_metric(
-					collector, metric->name);
-
-			LOG_DBG("gauge->value: %f", gauge->value);
-
-			for (int i = 0; i < metric->num_labels; ++i) {
-				ret = write_metric_to_buffer(
-					buffer + written, buffer_size - written,
-					"%s{%s=\"%s\"} %f\n", metric->name, metric->labels[i].key,
-					metric->labels[i].value, gauge->value);
-				if (ret < 0) {
-					LOG_ERR("Error writing gauge");
-					return ret;
-				}
-			}
-			break;
+
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "%s_count %lu\n", metric->name,
+					     histogram->count);
+		if (ret < 0) {
+			LOG_DBG("Error writing histogram");
+			return ret;
 		}
-		case PROMETHEUS_HISTOGRAM: {
-			const struct prometheus_histogram *histogram =
-				(const struct prometheus_histogram *)
-					prometheus_collector_get_metric(collector, metric->name);
-
-			LOG_DBG("histogram->count: %lu", histogram->count);
-
-			for (int i = 0; i < histogram->num_buckets; ++i) {
-				ret = write_metric_to_buffer(
-					buffer + written, buffer_size - written,
-					"%s_bucket{le=\"%f\"} %lu\n", metric->name,
-					histogram->buckets[i].upper_bound,
-					histogram->buckets[i].count);
-				if (ret < 0) {
-					LOG_ERR("Error writing histogram");
-					return ret;
-				}
-			}
+		break;
+	}
+	case PROMETHEUS_SUMMARY: {
+		const struct prometheus_summary *summary =
+			(const struct prometheus_summary *)prometheus_collector_get_metric(
+				collector, metric->name);
 
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "%s_sum %f\n", metric->name, histogram->sum);
-			if (ret < 0) {
-				LOG_ERR("Error writing histogram");
-				return ret;
-			}
+		LOG_DBG("summary->count: %lu", summary->count);
 
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "%s_count %lu\n", metric->name,
-						     histogram->count);
+		for (int i = 0; i < summary->num_quantiles; ++i) {
+			ret = write_metric_to_buffer(
+				buffer, buffer_size,
+				"%s{%s=\"%f\"} %f\n", metric->name, "quantile",
+				summary->quantiles[i].quantile,
+				summary->quantiles[i].value);
 			if (ret < 0) {
-				LOG_ERR("Error writing histogram");
+				LOG_DBG("Error writing summary");
 				return ret;
 			}
-			break;
 		}
-		case PROMETHEUS_SUMMARY: {
-			const struct prometheus_summary *summary =
-				(const struct prometheus_summary *)prometheus_collector_get_metric(
-					collector, metric->name);
-
-			LOG_DBG("summary->count: %lu", summary->count);
-
-			for (int i = 0; i < summary->num_quantiles; ++i) {
-				ret = write_metric_to_buffer(
-					buffer + written, buffer_size - written,
-					"%s{%s=\"%f\"} %f\n", metric->name, "quantile",
-					summary->quantiles[i].quantile,
-					summary->quantiles[i].value);
-				if (ret < 0) {
-					LOG_ERR("Error writing summary");
-					return ret;
-				}
-			}
 
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "%s_sum %f\n", metric->name, summary->sum);
-			if (ret < 0) {
-				LOG_ERR("Error writing summary");
-				return ret;
-			}
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "%s_sum %f\n", metric->name, summary->sum);
+		if (ret < 0) {
+			LOG_DBG("Error writing summary");
+			return ret;
+		}
 
-			ret = write_metric_to_buffer(buffer + written, buffer_size - written,
-						     "%s_count %lu\n", metric->name,
-						     summary->count);
-			if (ret < 0) {
-				LOG_ERR("Error writing summary");
-				return ret;
-			}
-			break;
+		ret = write_metric_to_buffer(buffer, buffer_size,
+					     "%s_count %lu\n", metric->name,
+					     summary->count);
+		if (ret < 0) {
+			LOG_DBG("Error writing summary");
+			return ret;
 		}
-		default:
-			/* should not happen */
-			LOG_ERR("Unsupported metric type %d", metric->type);
-			return -EINVAL;
+		break;
+	}
+	default:
+		/* should not happen */
+		LOG_ERR("Unsupported metric type %d", metric->type);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int prometheus_format_exposition(const struct prometheus_collector *collector, char *buffer,
+				 size_t buffer_size)
+{
+	int ret;
+
+	if (collector == NULL || buffer == NULL || buffer_size == 0) {
+		LOG_ERR("Invalid arguments");
+		return -EINVAL;
+	}
+
+	/* iterate through each metric in the collector */
+	for (size_t ind = 0; ind < collector->size; ind++) {
+		ret = format_metric(collector, collector->metric[ind], buffer, buffer_size);
+		if (ret < 0) {
+			return ret;
 		}
 	}
 
 	return 0;
 }
+
+int prometheus_format_exposition_next(const struct prometheus_collector *collector,
+				      size_t *next, char *buffer, size_t buffer_size)
+{
+	size_t len;
+	int ret;
+
+	if (collector == NULL || next == NULL || buffer == NULL || buffer_size == 0) {
+		LOG_ERR("Invalid arguments");
+		return -EINVAL;
+	}
+
+	buffer[0] = '\0';
+	len = 0;
+
+	/* add whole metrics until the next one does not fit anymore */
+	while (*next < collector->size) {
+		ret = format_metric(collector, collector->metric[*next], buffer, buffer_size);
+		if (ret == -ENOMEM && len > 0) {
+			/* drop the partial metric, it goes into the next chunk */
+			buffer[len] = '\0';
+			break;
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		len = strlen(buffer);
+		(*next)++;
+	}
+
+	return len;
+}
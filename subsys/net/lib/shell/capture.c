@@ -66,6 +66,10 @@ static void capture_cb(struct net_capture_info *info, void *user_data)
 	   net_if_get_by_iface(info->tunnel_iface),
 	   addr_local, addr_peer);
 
+	if (info->filter_len > 0) {
+		PR("\tFilter of %zu instructions\n", info->filter_len);
+	}
+
 	(*count)++;
 }
 #endif
@@ -249,6 +253,112 @@ static int cmd_net_capture_disable(const struct shell *sh, size_t argc, char *ar
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+/* Get the next number of a "tcpdump -ddd" program, where the numbers are
+ * separated by spaces and commas, possibly spread over several arguments.
+ */
+static int capture_filter_next(size_t argc, char *argv[], int *arg, char **pos,
+			       uint32_t *value)
+{
+	char *end;
+
+	while (*arg < argc) {
+		while (**pos == ' ' || **pos == ',') {
+			(*pos)++;
+		}
+
+		if (**pos != '\0') {
+			break;
+		}
+
+		(*arg)++;
+		if (*arg < argc) {
+			*pos = argv[*arg];
+		}
+	}
+
+	if (*arg >= argc) {
+		return -ENOENT;
+	}
+
+	errno = 0;
+	*value = strtoul(*pos, &end, 0);
+	if (errno != 0 || end == *pos) {
+		return -EINVAL;
+	}
+
+	*pos = end;
+
+	return 0;
+}
+#endif
+
+static int cmd_net_capture_filter(const struct shell *sh, size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	static struct net_capture_filter prog[CONFIG_NET_CAPTURE_FILTER_MAX_LEN];
+	uint32_t count, values[4];
+	int ret, arg = 1;
+	char *pos;
+
+	if (capture_dev == NULL) {
+		PR_WARNING("Capture not setup.\n");
+		return -ENOEXEC;
+	}
+
+	if (argc < 2) {
+		PR_WARNING("Filter program is missing.\n");
+		return -ENOEXEC;
+	}
+
+	if (strcmp(argv[arg], "off") == 0) {
+		(void)net_capture_set_filter(capture_dev, NULL, 0);
+		PR_INFO("Capturing all packets\n");
+		return 0;
+	}
+
+	pos = argv[arg];
+
+	ret = capture_filter_next(argc, argv, &arg, &pos, &count);
+	if (ret < 0 || count == 0 || count > ARRAY_SIZE(prog)) {
+		PR_WARNING("Invalid number of instructions, maximum is %d\n",
+			   CONFIG_NET_CAPTURE_FILTER_MAX_LEN);
+		return -ENOEXEC;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(values); j++) {
+			ret = capture_filter_next(argc, argv, &arg, &pos, &values[j]);
+			if (ret < 0) {
+				PR_WARNING("Invalid instruction %u\n", i);
+				return -ENOEXEC;
+			}
+		}
+
+		prog[i].code = values[0];
+		prog[i].jt = values[1];
+		prog[i].jf = values[2];
+		prog[i].k = values[3];
+	}
+
+	ret = net_capture_set_filter(capture_dev, prog, count);
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "filter", ret);
+		return -ENOEXEC;
+	}
+
+	PR_INFO("Filter of %u instructions set\n", count);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_FILTER", "network packet capture filter");
+#endif
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 	SHELL_CMD(setup, NULL, "Setup network packet capture.\n"
 		  "'net capture setup <remote-ip-addr> <local-addr> <peer-addr>'\n"
@@ -266,6 +376,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 		  cmd_net_capture_enable),
 	SHELL_CMD(disable, NULL, "Disable network packet capture.",
 		  cmd_net_capture_disable),
+	SHELL_CMD(filter, NULL, "Capture only the packets accepted by a filter.\n"
+		  "'net capture filter <program>|off'\n"
+		  "<program> is a classic BPF program in the format printed by\n"
+		  "'tcpdump -ddd <expression> | tr \"\\n\" \",\"', like\n"
+		  "4,40 0 0 12,21 0 1 2048,6 0 0 65535,6 0 0 0",
+		  cmd_net_capture_filter),
 	SHELL_SUBCMD_SET_END
 );
 
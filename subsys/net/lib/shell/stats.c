@@ -139,6 +139,7 @@ static void print_ppp_stats(struct net_if *iface, struct net_stats_ppp *data,
 
 #if !defined(CONFIG_NET_NATIVE)
 #define GET_STAT(a, b) 0
+#define net_stats_collect()
 #endif
 
 #if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL) || \
@@ -453,6 +454,7 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	} else {
 		PR("\nGlobal statistics\n");
 		PR("=================\n");
+		net_stats_collect();
 	}
 
 #if defined(CONFIG_NET_STATISTICS_IPV6) && defined(CONFIG_NET_NATIVE_IPV6)
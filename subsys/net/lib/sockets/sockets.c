@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/internal/syscall_handler.h>
 
 #include "sockets_internal.h"
@@ -726,6 +727,181 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t ret;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		ret = vtable->sendmsg(obj, &msgvec[i].msg_hdr, flags);
+
+		sock_obj_core_update_send_stats(sock, ret);
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	k_mutex_unlock(lock);
+
+	/* The error is reported only if no message was sent, like on Linux */
+	return (i > 0 || vlen == 0) ? i : -1;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int len;
+	unsigned int i;
+	ssize_t ret;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	/* The messages are still sent with one system call, but each one is
+	 * copied from user memory separately.
+	 */
+	for (i = 0; i < vlen; i++) {
+		ret = z_vrfy_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &len, sizeof(len)));
+	}
+
+	return (i > 0 || vlen == 0) ? i : -1;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t ret;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		ret = vtable->recvmsg(obj, &msgvec[i].msg_hdr, flags);
+
+		sock_obj_core_update_recv_stats(sock, ret);
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+
+		/* Only wait for the first message */
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	k_mutex_unlock(lock);
+
+	return (i > 0 || vlen == 0) ? i : -1;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int len;
+	unsigned int i;
+	ssize_t ret;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(*msgvec)));
+
+	for (i = 0; i < vlen; i++) {
+		ret = z_vrfy_zsock_recvmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &len, sizeof(len)));
+
+		flags |= ZSOCK_MSG_DONTWAIT;
+	}
+
+	return (i > 0 || vlen == 0) ? i : -1;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int sock_ioctl_call(int sock, unsigned long request, ...)
+{
+	va_list args;
+	int ret;
+
+	va_start(args, request);
+	ret = z_impl_zsock_ioctl_impl(sock, request, args);
+	va_end(args);
+
+	return ret;
+}
+
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **pkt, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int ret;
+
+	/* The packet buffers are not accessible from user mode */
+	if (k_is_user_context()) {
+		errno = EPERM;
+		return -1;
+	}
+
+	ret = sock_ioctl_call(sock, ZFD_IOCTL_RECV_PKT, pkt, flags, src_addr,
+			      addrlen);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+
+void zsock_recv_pkt_release(struct net_pkt *pkt)
+{
+	if (pkt != NULL) {
+		net_pkt_unref(pkt);
+	}
+}
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
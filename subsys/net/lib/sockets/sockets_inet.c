@@ -21,6 +21,7 @@ LOG_MODULE_DECLARE(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/sys/fdtable.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/zvfs/epoll.h>
 
 #if defined(CONFIG_SOCKS)
 #include "socks.h"
@@ -44,6 +45,20 @@ static void zsock_received_cb(struct net_context *ctx,
 			      int status,
 			      void *user_data);
 
+static inline void zsock_epoll_init(struct net_context *ctx)
+{
+#if defined(CONFIG_ZVFS_EPOLL)
+	ctx->epoll_entry = NULL;
+#endif
+}
+
+static inline void zsock_epoll_notify(struct net_context *ctx)
+{
+#if defined(CONFIG_ZVFS_EPOLL)
+	zvfs_epoll_notify(ctx->epoll_entry);
+#endif
+}
+
 static int fifo_wait_non_empty(struct k_fifo *fifo, k_timeout_t timeout)
 {
 	struct k_poll_event events[] = {
@@ -110,6 +125,8 @@ static int zsock_socket_internal(int family, int type, int proto)
 	/* The socket flags are stored here */
 	ctx->socket_data = NULL;
 
+	zsock_epoll_init(ctx);
+
 	/* recv_q and accept_q are in union */
 	k_fifo_init(&ctx->recv_q);
 
@@ -155,6 +172,12 @@ int zsock_close_ctx(struct net_context *ctx)
 	ctx->user_data = INT_TO_POINTER(EINTR);
 	sock_set_error(ctx);
 
+#if defined(CONFIG_ZVFS_EPOLL)
+	/* A closed socket leaves the event poll instances, like on Linux */
+	zvfs_epoll_detach(ctx->epoll_entry);
+	ctx->epoll_entry = NULL;
+#endif
+
 	zsock_flush_queue(ctx);
 
 	ret = net_context_put(ctx);
@@ -180,6 +203,7 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 				       NULL);
 		k_fifo_init(&new_ctx->recv_q);
 		k_condvar_init(&new_ctx->cond.recv);
+		zsock_epoll_init(new_ctx);
 
 		k_fifo_put(&parent->accept_q, new_ctx);
 
@@ -193,6 +217,7 @@ static void zsock_accepted_cb(struct net_context *new_ctx,
 		net_context_ref(new_ctx);
 
 		(void)k_condvar_signal(&parent->cond.recv);
+		zsock_epoll_notify(parent);
 	}
 
 }
@@ -246,6 +271,7 @@ static void zsock_received_cb(struct net_context *ctx,
 unlock:
 	/* Wake reader if it was sleeping */
 	(void)k_condvar_signal(&ctx->cond.recv);
+	zsock_epoll_notify(ctx);
 
 	if (ctx->cond.lock) {
 		(void)k_mutex_unlock(ctx->cond.lock);
@@ -1499,6 +1525,110 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+static ssize_t zsock_recv_pkt_ctx(struct net_context *ctx, struct net_pkt **pkt,
+				  int flags, struct sockaddr *src_addr,
+				  socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *head;
+	size_t len;
+	int ret;
+
+	if (pkt == NULL || (flags & ZSOCK_MSG_PEEK)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*pkt = NULL;
+
+	if (sock_type == SOCK_STREAM) {
+		if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+			errno = ENOTCONN;
+			return -1;
+		}
+
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+	} else if (sock_type != SOCK_DGRAM) {
+		errno = ENOTSUP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	head = k_fifo_get(&ctx->recv_q, sock_type == SOCK_DGRAM ? timeout : K_NO_WAIT);
+	if (head == NULL) {
+		if (sock_type == SOCK_STREAM && sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (sock_type == SOCK_DGRAM && src_addr != NULL && addrlen != NULL) {
+		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+			ret = sock_get_offload_pkt_src_addr(head, ctx, src_addr,
+							    *addrlen);
+		} else {
+			ret = sock_get_pkt_src_addr(head, net_context_get_proto(ctx),
+						    src_addr, *addrlen);
+		}
+
+		if (ret < 0) {
+			net_pkt_unref(head);
+			errno = -ret;
+			return -1;
+		}
+
+		*addrlen = src_addr->sa_family == AF_INET6 ?
+			   sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+	}
+
+	len = net_pkt_remaining_data(head);
+
+	if (sock_type == SOCK_STREAM) {
+		if (net_pkt_eof(head)) {
+			sock_set_eof(ctx);
+		}
+
+		/* The data is owned by the caller from now on */
+		net_context_update_recv_wnd(ctx, len);
+
+		if (len == 0) {
+			net_pkt_unref(head);
+			return 0;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(head, k_cycle_get_32());
+	}
+
+	*pkt = head;
+
+	return len;
+}
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -1771,6 +1901,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -1793,6 +1937,25 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_UDP_GSO)) {
+				ret = net_context_get_option(ctx, NET_OPT_UDP_SEGMENT,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -2303,6 +2466,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
 
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case TCP_KEEPIDLE:
 			__fallthrough;
 		case TCP_KEEPINTVL:
@@ -2324,6 +2501,25 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 		}
 		break;
 
+	case IPPROTO_UDP:
+		switch (optname) {
+		case UDP_SEGMENT:
+			if (IS_ENABLED(CONFIG_NET_UDP_GSO)) {
+				ret = net_context_set_option(ctx, NET_OPT_UDP_SEGMENT,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+		}
+
+		break;
+
 	case IPPROTO_IP:
 		switch (optname) {
 		case IP_TOS:
@@ -2699,6 +2895,38 @@ static int sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		return 0;
 	}
 
+#if defined(CONFIG_ZVFS_EPOLL)
+	case ZFD_IOCTL_EPOLL_WATCH: {
+		struct net_context *ctx = obj;
+		struct zvfs_epoll_entry *entry;
+
+		entry = va_arg(args, struct zvfs_epoll_entry *);
+
+		/* Only one event poll instance can be notified */
+		if (entry != NULL && ctx->epoll_entry != NULL) {
+			errno = EBUSY;
+			return -1;
+		}
+
+		ctx->epoll_entry = entry;
+		return 0;
+	}
+#endif
+
+	case ZFD_IOCTL_RECV_PKT: {
+		struct net_pkt **pkt;
+		struct sockaddr *src_addr;
+		socklen_t *addrlen;
+		int flags;
+
+		pkt = va_arg(args, struct net_pkt **);
+		flags = va_arg(args, int);
+		src_addr = va_arg(args, struct sockaddr *);
+		addrlen = va_arg(args, socklen_t *);
+
+		return zsock_recv_pkt_ctx(obj, pkt, flags, src_addr, addrlen);
+	}
+
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
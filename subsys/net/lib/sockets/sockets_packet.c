@@ -7,6 +7,7 @@
 
 #include <stdbool.h>
 #include <zephyr/posix/fcntl.h>
+#include <zephyr/posix/sys/mman.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(net_sock_packet, CONFIG_NET_SOCKETS_LOG_LEVEL);
@@ -14,12 +15,14 @@ LOG_MODULE_REGISTER(net_sock_packet, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/entropy.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
 
 #include "../../ip/net_stats.h"
 
@@ -29,6 +32,26 @@ extern const struct socket_op_vtable sock_fd_op_vtable;
 
 static const struct socket_op_vtable packet_sock_fd_op_vtable;
 
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+struct zpacket_rx_ring {
+	/* Frames shared with the application */
+	uint8_t *frames;
+	size_t size;
+	uint32_t frame_size;
+	uint32_t frame_nr;
+
+	/* Next frame to fill */
+	uint32_t head;
+	bool losing;
+	struct k_spinlock lock;
+
+	struct k_poll_signal signal;
+	struct tpacket_stats stats;
+};
+
+static void zpacket_rx_ring_put(struct net_context *ctx, struct net_pkt *pkt);
+#endif /* CONFIG_NET_SOCKETS_PACKET_RX_RING */
+
 static inline int k_fifo_wait_non_empty(struct k_fifo *fifo,
 					k_timeout_t timeout)
 {
@@ -116,6 +139,13 @@ static void zpacket_received_cb(struct net_context *ctx,
 	/* Normal packet */
 	net_pkt_set_eof(pkt, false);
 
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	if (ctx->rx_ring != NULL) {
+		zpacket_rx_ring_put(ctx, pkt);
+		return;
+	}
+#endif
+
 	k_fifo_put(&ctx->recv_q, pkt);
 }
 
@@ -234,6 +264,247 @@ static void zpacket_set_source_addr(struct net_context *ctx,
 	*addrlen = sizeof(struct sockaddr_ll);
 }
 
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+static void zpacket_rx_ring_put(struct net_context *ctx, struct net_pkt *pkt)
+{
+	struct zpacket_rx_ring *ring = ctx->rx_ring;
+	uint16_t mac = TPACKET_ALIGN(TPACKET_HDRLEN);
+	socklen_t addrlen = sizeof(struct sockaddr_ll);
+	struct tpacket_hdr *hdr;
+	unsigned long status;
+	k_spinlock_key_t key;
+	uint64_t usecs;
+	size_t len;
+
+	/* Claim the frame, the application hands it back by setting its
+	 * status to TP_STATUS_KERNEL.
+	 */
+	key = k_spin_lock(&ring->lock);
+
+	hdr = (struct tpacket_hdr *)(ring->frames + ring->head * ring->frame_size);
+	if (hdr->tp_status != TP_STATUS_KERNEL) {
+		ring->stats.tp_drops++;
+		ring->losing = true;
+		k_spin_unlock(&ring->lock, key);
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	ring->head = (ring->head + 1) % ring->frame_nr;
+	ring->stats.tp_packets++;
+
+	status = TP_STATUS_USER;
+	if (ring->losing) {
+		status |= TP_STATUS_LOSING;
+		ring->losing = false;
+	}
+
+	k_spin_unlock(&ring->lock, key);
+
+	len = net_pkt_get_len(pkt);
+
+	hdr->tp_len = len;
+	hdr->tp_snaplen = MIN(len, ring->frame_size - mac);
+	hdr->tp_mac = mac;
+	hdr->tp_net = mac;
+
+	if (net_context_get_type(ctx) == SOCK_RAW &&
+	    net_context_get_iface(ctx) != NULL &&
+	    net_if_get_link_addr(net_context_get_iface(ctx))->type == NET_LINK_ETHERNET) {
+		hdr->tp_net += sizeof(struct net_eth_hdr);
+	}
+
+	usecs = k_ticks_to_us_floor64(k_uptime_ticks());
+	hdr->tp_sec = usecs / USEC_PER_SEC;
+	hdr->tp_usec = usecs % USEC_PER_SEC;
+
+	if (hdr->tp_snaplen < len) {
+		status |= TP_STATUS_COPY;
+	}
+
+	zpacket_set_source_addr(ctx, pkt,
+				(struct sockaddr *)((uint8_t *)hdr +
+						    TPACKET_ALIGN(sizeof(*hdr))),
+				&addrlen);
+
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_read(pkt, (uint8_t *)hdr + mac, hdr->tp_snaplen) < 0) {
+		hdr->tp_snaplen = 0;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	net_pkt_unref(pkt);
+
+	/* The frame content must be visible before it is handed over */
+	barrier_dmem_fence_full();
+	hdr->tp_status = status;
+
+	k_poll_signal_raise(&ring->signal, 0);
+
+#if defined(CONFIG_ZVFS_EPOLL)
+	zvfs_epoll_notify(ctx->epoll_entry);
+#endif
+}
+
+static bool zpacket_rx_ring_readable(struct zpacket_rx_ring *ring)
+{
+	uint32_t last = (ring->head + ring->frame_nr - 1) % ring->frame_nr;
+	struct tpacket_hdr *hdr;
+
+	/* The frames are filled in order, so the application has something
+	 * to read as long as the last filled frame has not been handed back.
+	 */
+	hdr = (struct tpacket_hdr *)(ring->frames + last * ring->frame_size);
+
+	return hdr->tp_status != TP_STATUS_KERNEL;
+}
+
+static int zpacket_rx_ring_set(struct net_context *ctx,
+			       const struct tpacket_req *req)
+{
+	struct zpacket_rx_ring *ring = ctx->rx_ring;
+	size_t size;
+
+	/* Packets may be written into the ring at any time, so it is kept
+	 * until the socket is closed.
+	 */
+	if (ring != NULL) {
+		return -EBUSY;
+	}
+
+	if (req->tp_block_nr == 0 ||
+	    req->tp_frame_size < TPACKET_HDRLEN ||
+	    req->tp_frame_size % TPACKET_ALIGNMENT != 0 ||
+	    req->tp_block_size < req->tp_frame_size ||
+	    req->tp_block_size % req->tp_frame_size != 0 ||
+	    req->tp_frame_nr !=
+		    req->tp_block_size / req->tp_frame_size * req->tp_block_nr ||
+	    req->tp_frame_nr > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	size = (size_t)req->tp_block_size * req->tp_block_nr;
+
+	ring = k_aligned_alloc(TPACKET_ALIGNMENT,
+			       TPACKET_ALIGN(sizeof(*ring)) + size);
+	if (ring == NULL) {
+		return -ENOMEM;
+	}
+
+	memset(ring, 0, TPACKET_ALIGN(sizeof(*ring)) + size);
+
+	ring->frames = (uint8_t *)ring + TPACKET_ALIGN(sizeof(*ring));
+	ring->size = size;
+	ring->frame_size = req->tp_frame_size;
+	ring->frame_nr = req->tp_frame_nr;
+	k_poll_signal_init(&ring->signal);
+
+	ctx->rx_ring = ring;
+
+	return 0;
+}
+
+static int zpacket_rx_ring_ioctl(struct net_context *ctx,
+				 unsigned int request, va_list args)
+{
+	struct zpacket_rx_ring *ring = ctx->rx_ring;
+
+	switch (request) {
+	case ZFD_IOCTL_POLL_PREPARE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+		struct k_poll_event *pev_end;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+		pev_end = va_arg(args, struct k_poll_event *);
+
+		if (pfd->events & ZSOCK_POLLIN) {
+			if (*pev == pev_end) {
+				return -ENOMEM;
+			}
+
+			/* Reset before checking, so no frame can be missed */
+			k_poll_signal_reset(&ring->signal);
+
+			(*pev)->obj = &ring->signal;
+			(*pev)->type = K_POLL_TYPE_SIGNAL;
+			(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+			(*pev)->state = K_POLL_STATE_NOT_READY;
+			(*pev)++;
+
+			if (zpacket_rx_ring_readable(ring)) {
+				return -EALREADY;
+			}
+		}
+
+		if ((pfd->events & ZSOCK_POLLOUT) || sock_is_error(ctx)) {
+			return -EALREADY;
+		}
+
+		return 0;
+	}
+
+	case ZFD_IOCTL_POLL_UPDATE: {
+		struct zsock_pollfd *pfd;
+		struct k_poll_event **pev;
+
+		pfd = va_arg(args, struct zsock_pollfd *);
+		pev = va_arg(args, struct k_poll_event **);
+
+		if (pfd->events & ZSOCK_POLLIN) {
+			if (zpacket_rx_ring_readable(ring)) {
+				pfd->revents |= ZSOCK_POLLIN;
+			}
+			(*pev)++;
+		}
+
+		if (pfd->events & ZSOCK_POLLOUT) {
+			pfd->revents |= ZSOCK_POLLOUT;
+		}
+
+		if (sock_is_error(ctx)) {
+			pfd->revents |= ZSOCK_POLLERR;
+		}
+
+		return 0;
+	}
+
+	case ZFD_IOCTL_MMAP: {
+		size_t len;
+		int flags;
+		off_t off;
+		void **maddr;
+
+		(void)va_arg(args, void *);
+		len = va_arg(args, size_t);
+		(void)va_arg(args, int);
+		flags = va_arg(args, int);
+		off = va_arg(args, off_t);
+		maddr = va_arg(args, void **);
+
+		/* The ring stays owned by the socket and is released by
+		 * close(), munmap() is not needed.
+		 */
+		if (off != 0 || len > ring->size || !(flags & MAP_SHARED)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		*maddr = ring->frames;
+		return 0;
+	}
+
+	default:
+		return sock_fd_op_vtable.fd_vtable.ioctl(ctx, request, args);
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_PACKET_RX_RING */
+
 ssize_t zpacket_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 			   int flags, const struct sockaddr *dest_addr,
 			   socklen_t addrlen)
@@ -368,6 +639,31 @@ int zpacket_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 		return -1;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	if (level == SOL_PACKET && optname == PACKET_STATISTICS) {
+		struct zpacket_rx_ring *ring = ctx->rx_ring;
+		k_spinlock_key_t key;
+
+		if (*optlen < sizeof(struct tpacket_stats)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		if (ring == NULL) {
+			memset(optval, 0, sizeof(struct tpacket_stats));
+		} else {
+			/* Reading the counters resets them */
+			key = k_spin_lock(&ring->lock);
+			memcpy(optval, &ring->stats, sizeof(ring->stats));
+			memset(&ring->stats, 0, sizeof(ring->stats));
+			k_spin_unlock(&ring->lock, key);
+		}
+
+		*optlen = sizeof(struct tpacket_stats);
+		return 0;
+	}
+#endif
+
 	return sock_fd_op_vtable.getsockopt(ctx, level, optname,
 					    optval, optlen);
 }
@@ -375,6 +671,25 @@ int zpacket_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 int zpacket_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			const void *optval, socklen_t optlen)
 {
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	if (level == SOL_PACKET && optname == PACKET_RX_RING) {
+		int ret;
+
+		if (optval == NULL || optlen != sizeof(struct tpacket_req)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		ret = zpacket_rx_ring_set(ctx, optval);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+
+		return 0;
+	}
+#endif
+
 	return sock_fd_op_vtable.setsockopt(ctx, level, optname,
 					    optval, optlen);
 }
@@ -393,6 +708,12 @@ static ssize_t packet_sock_write_vmeth(void *obj, const void *buffer,
 static int packet_sock_ioctl_vmeth(void *obj, unsigned int request,
 				   va_list args)
 {
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	if (((struct net_context *)obj)->rx_ring != NULL) {
+		return zpacket_rx_ring_ioctl(obj, request, args);
+	}
+#endif
+
 	return sock_fd_op_vtable.fd_vtable.ioctl(obj, request, args);
 }
 
@@ -464,7 +785,18 @@ static int packet_sock_setsockopt_vmeth(void *obj, int level, int optname,
 
 static int packet_sock_close_vmeth(void *obj)
 {
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING)
+	struct zpacket_rx_ring *ring = ((struct net_context *)obj)->rx_ring;
+	int ret;
+
+	/* Free the ring once no more packets can be received into it */
+	ret = zsock_close_ctx(obj);
+	k_free(ring);
+
+	return ret;
+#else
 	return zsock_close_ctx(obj);
+#endif
 }
 
 static const struct socket_op_vtable packet_sock_fd_op_vtable = {
@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
 #include <zephyr/zvfs/eventfd.h>
+#include <zephyr/zvfs/epoll.h>
 
 static int init_socket_service(void);
 
@@ -29,12 +30,38 @@ STRUCT_SECTION_START_EXTERN(net_socket_service_desc);
 STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
 static struct service {
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	/* Only the restart event is polled directly */
+	struct zsock_pollfd events[1];
+#else
 	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
+#endif
 	int count;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	/* Event poll instance holding the sockets of the services */
+	int epfd;
+	/* Triggered events waiting for a worker, sorted by priority */
+	sys_slist_t queue;
+	struct k_sem pending;
+#endif
 } ctx;
 
 #define get_idx(svc) (*(svc->idx))
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+/* There is no global poll array, the index tells whether the handler runs */
+#define svc_busy(svc) (*(svc->idx))
+
+/* How many events are taken from the event poll instance at once */
+#define DISPATCH_EVENTS 8
+
+#define SERVICE_MAX_FDS CONFIG_ZVFS_EPOLL_MAX_FDS
+#define SERVICE_MAX_FDS_OPTION "CONFIG_ZVFS_EPOLL_MAX_FDS"
+#else
+#define SERVICE_MAX_FDS CONFIG_ZVFS_POLL_MAX
+#define SERVICE_MAX_FDS_OPTION "CONFIG_ZVFS_POLL_MAX"
+#endif
+
 void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 {
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
@@ -50,6 +77,50 @@ static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 	}
 }
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+/* Remove the sockets of a service from the epoll instance, lock must be held */
+static void svc_unwatch_locked(const struct net_socket_service_desc *svc)
+{
+	__ASSERT_NO_MSG(lock.owner == k_current_get());
+
+	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd < 0) {
+			continue;
+		}
+
+		/* A closed socket has already left the event poll instance */
+		(void)zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_DEL, svc->pev[i].event.fd, NULL);
+	}
+}
+
+/* Add the sockets of a service to the epoll instance, lock must be held */
+static int svc_watch_locked(const struct net_socket_service_desc *svc)
+{
+	struct zvfs_epoll_event event;
+	int ret = 0;
+
+	__ASSERT_NO_MSG(lock.owner == k_current_get());
+
+	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd < 0) {
+			continue;
+		}
+
+		event.events = svc->pev[i].event.events;
+		event.data.ptr = &svc->pev[i];
+
+		if (zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD, svc->pev[i].event.fd,
+				   &event) < 0) {
+			ret = -errno;
+			NET_DBG("Cannot watch socket %d of service %p (%d)",
+				svc->pev[i].event.fd, svc, ret);
+		}
+	}
+
+	return ret;
+}
+#endif
+
 int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc,
 				       struct zsock_pollfd *fds, int len,
 				       void *user_data)
@@ -71,26 +142,41 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 		goto out;
 	}
 
+	if (fds != NULL && len > svc->pev_len) {
+		NET_DBG("Too many file descriptors, "
+			"max is %d for service %p",
+			svc->pev_len, svc);
+		ret = -ENOMEM;
+		goto out;
+	}
+
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	/* A running handler watches the sockets again when it returns */
+	if (!svc_busy(svc)) {
+		svc_unwatch_locked(svc);
+	}
+#endif
+
 	if (fds == NULL) {
 		cleanup_svc_events(svc);
 	} else {
-		if (len > svc->pev_len) {
-			NET_DBG("Too many file descriptors, "
-				"max is %d for service %p",
-				svc->pev_len, svc);
-			ret = -ENOMEM;
-			goto out;
-		}
-
 		for (i = 0; i < len; i++) {
 			svc->pev[i].event = fds[i];
 			svc->pev[i].user_data = user_data;
+			svc->pev[i].svc = (struct net_socket_service_desc *)svc;
 		}
 	}
 
+	ret = 0;
+
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	if (!svc_busy(svc)) {
+		ret = svc_watch_locked(svc);
+	}
+#endif
+
 	/* Tell the thread to re-read the variables */
 	zvfs_eventfd_write(ctx.events[0].fd, 1);
-	ret = 0;
 
 out:
 	k_mutex_unlock(&lock);
@@ -98,6 +184,7 @@ out:
 	return ret;
 }
 
+#if !defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
 static struct net_socket_service_desc *find_svc_and_event(
 	struct zsock_pollfd *pev,
 	struct net_socket_service_event **event)
@@ -113,6 +200,7 @@ static struct net_socket_service_desc *find_svc_and_event(
 
 	return NULL;
 }
+#endif
 
 /* We do not set the user callback to our work struct because we need to
  * hook into the flow and restore the global poll array so that the next poll
@@ -126,14 +214,117 @@ void net_socket_service_callback(struct net_socket_service_event *pev)
 
 	ev.callback(&ev);
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	k_mutex_lock(&lock, K_FOREVER);
+
+	/* The sockets were removed from the event poll instance when the
+	 * event was queued, the registered ones may have changed meanwhile.
+	 */
+	svc_busy(svc) = 0;
+	(void)svc_watch_locked(svc);
+
+	k_mutex_unlock(&lock);
+
+	/* Sockets that are polled on every wait are only seen after a restart */
+	zvfs_eventfd_write(ctx.events[0].fd, 1);
+#else
 	/* Copy back the socket fd to the global array because we marked
 	 * it as -1 when triggering the work.
 	 */
 	for (int i = 0; i < svc->pev_len; i++) {
 		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
 	}
+#endif
 }
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+static void queue_event(struct net_socket_service_event *pev, uint32_t revents)
+{
+	struct net_socket_service_desc *svc = pev->svc;
+	struct net_socket_service_event *queued;
+	sys_snode_t *prev = NULL;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	/* The socket was unregistered, or the service is already queued */
+	if (pev->event.fd < 0 || svc_busy(svc)) {
+		goto out;
+	}
+
+	/* Do not report the sockets again until the handler has returned */
+	svc_unwatch_locked(svc);
+	svc_busy(svc) = 1;
+
+	/* Copy the triggered events so that we know what was actually
+	 * causing the event.
+	 */
+	pev->event.revents = revents;
+
+	/* Services of the same priority are run in the order they triggered */
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx.queue, queued, node) {
+		if (queued->svc->priority > svc->priority) {
+			break;
+		}
+
+		prev = &queued->node;
+	}
+
+	sys_slist_insert(&ctx.queue, prev, &pev->node);
+	k_sem_give(&ctx.pending);
+
+out:
+	k_mutex_unlock(&lock);
+}
+
+static int dispatch_events(void)
+{
+	struct zvfs_epoll_event events[DISPATCH_EVENTS];
+	zvfs_eventfd_t value;
+	int ret;
+
+	while (true) {
+		ret = zvfs_epoll_wait(ctx.epfd, events, ARRAY_SIZE(events), -1);
+		if (ret < 0) {
+			ret = -errno;
+			NET_ERR("epoll wait failed (%d)", ret);
+			return ret;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			if (events[i].data.ptr == NULL) {
+				/* The next wait sees the newly watched sockets */
+				zvfs_eventfd_read(ctx.events[0].fd, &value);
+				NET_DBG("Received restart event.");
+				continue;
+			}
+
+			queue_event(events[i].data.ptr, events[i].events);
+		}
+	}
+}
+
+static void socket_service_worker(void *p1, void *p2, void *p3)
+{
+	struct net_socket_service_event *pev;
+	sys_snode_t *node;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_sem_take(&ctx.pending, K_FOREVER);
+
+		k_mutex_lock(&lock, K_FOREVER);
+		node = sys_slist_get(&ctx.queue);
+		k_mutex_unlock(&lock);
+
+		pev = CONTAINER_OF(node, struct net_socket_service_event, node);
+
+		net_socket_service_callback(pev);
+	}
+}
+#else
 static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *event)
 {
 	int ret = 0;
@@ -169,11 +360,17 @@ static int trigger_work(struct zsock_pollfd *pev)
 
 	return call_work(pev, event);
 }
+#endif
 
 static void socket_service_thread(void)
 {
-	int ret, i, fd, count = 0;
+	int ret, fd, count = 0;
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	struct zvfs_epoll_event event;
+#else
 	zvfs_eventfd_t value;
+	int i;
+#endif
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
 	if (ret == 0) {
@@ -187,16 +384,18 @@ static void socket_service_thread(void)
 			COND_CODE_1(CONFIG_NET_SOCKETS_LOG_LEVEL_DBG,
 				    (svc->owner), ("")),
 			svc->pev_len);
+#if !defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
 		get_idx(svc) = count + 1;
+#endif
 		count += svc->pev_len;
 	}
 
-	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
+	if ((count + 1) > SERVICE_MAX_FDS) {
 		NET_ERR("You have %d services to monitor but "
-			"%zd poll entries configured.",
-			count + 1, ARRAY_SIZE(ctx.events));
+			"%d poll entries configured.",
+			count + 1, SERVICE_MAX_FDS);
 		NET_ERR("Please increase value of %s to at least %d",
-			"CONFIG_ZVFS_POLL_MAX", count + 1);
+			SERVICE_MAX_FDS_OPTION, count + 1);
 		goto fail;
 	}
 
@@ -212,12 +411,35 @@ static void socket_service_thread(void)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	ctx.epfd = zvfs_epoll_create(0);
+	if (ctx.epfd < 0) {
+		ret = -errno;
+		NET_ERR("zvfs_epoll_create failed (%d)", ret);
+		goto fail;
+	}
+
+	/* The restart event is the only one without a service event */
+	event.events = ZVFS_EPOLLIN;
+	event.data.ptr = NULL;
+
+	if (zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD, fd, &event) < 0) {
+		ret = -errno;
+		NET_ERR("zvfs_epoll_ctl failed (%d)", ret);
+		goto fail;
+	}
+#endif
+
 	thread_status = SOCKET_SERVICE_THREAD_RUNNING;
 	k_condvar_broadcast(&wait_start);
 
 	ctx.events[0].fd = fd;
 	ctx.events[0].events = ZSOCK_POLLIN;
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	/* The services are watched when they are registered */
+	(void)dispatch_events();
+#else
 restart:
 	i = 1;
 
@@ -264,6 +486,7 @@ restart:
 			}
 		}
 	}
+#endif
 
 out:
 	NET_DBG("Socket service thread stopped");
@@ -284,6 +507,11 @@ static int init_socket_service(void)
 	static K_THREAD_STACK_DEFINE(service_thread_stack,
 				     CONFIG_NET_SOCKETS_SERVICE_STACK_SIZE);
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	sys_slist_init(&ctx.queue);
+	k_sem_init(&ctx.pending, 0, K_SEM_MAX_LIMIT);
+#endif
+
 	ssm = k_thread_create(&service_thread,
 			      service_thread_stack,
 			      K_THREAD_STACK_SIZEOF(service_thread_stack),
@@ -294,6 +522,29 @@ static int init_socket_service(void)
 
 	k_thread_name_set(ssm, "net_socket_service");
 
+#if defined(CONFIG_NET_SOCKETS_SERVICE_DISPATCHER)
+	static struct k_thread worker_threads[CONFIG_NET_SOCKETS_SERVICE_WORKERS];
+
+	static K_THREAD_STACK_ARRAY_DEFINE(worker_thread_stacks,
+					   CONFIG_NET_SOCKETS_SERVICE_WORKERS,
+					   CONFIG_NET_SOCKETS_SERVICE_WORKER_STACK_SIZE);
+
+	for (int i = 0; i < CONFIG_NET_SOCKETS_SERVICE_WORKERS; i++) {
+		char name[sizeof("net_socket_service_wX")];
+
+		ssm = k_thread_create(&worker_threads[i],
+				      worker_thread_stacks[i],
+				      K_THREAD_STACK_SIZEOF(worker_thread_stacks[i]),
+				      socket_service_worker, NULL, NULL, NULL,
+				      CLAMP(CONFIG_NET_SOCKETS_SERVICE_THREAD_PRIO,
+					    K_HIGHEST_APPLICATION_THREAD_PRIO,
+					    K_LOWEST_APPLICATION_THREAD_PRIO), 0, K_NO_WAIT);
+
+		snprintk(name, sizeof(name), "net_socket_service_w%d", i);
+		k_thread_name_set(ssm, name);
+	}
+#endif
+
 	return 0;
 }
 
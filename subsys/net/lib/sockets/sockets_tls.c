@@ -47,6 +47,7 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#include <mbedtls/ssl_ticket.h>
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -68,6 +69,12 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #define DTLS_SENDMSG_BUF_SIZE 0
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_TX_COALESCE_SIZE)
+#define TLS_TX_COALESCE_SIZE (CONFIG_NET_SOCKETS_TLS_TX_COALESCE_SIZE)
+#else
+#define TLS_TX_COALESCE_SIZE 0
+#endif /* CONFIG_NET_SOCKETS_TLS_TX_COALESCE_SIZE */
+
 static const struct socket_op_vtable tls_sock_fd_op_vtable;
 
 #ifndef MBEDTLS_ERR_SSL_PEER_VERIFY_FAILED
@@ -99,7 +106,7 @@ struct dtls_timing_context {
 	uint32_t fin_ms;
 };
 
-/** TLS peer address/session ID mapping. */
+/** TLS peer/session ID mapping. */
 struct tls_session_cache {
 	/** Creation time. */
 	int64_t timestamp;
@@ -107,6 +114,9 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Peer hostname, NULL if the session is keyed by peer address. */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -192,6 +202,12 @@ __net_socket struct tls_context {
 		/** Session cache enabled on a socket. */
 		bool cache_enabled;
 
+		/** Session tickets issued by a server socket. */
+		bool tickets_enabled;
+
+		/** Amount of data coalesced into a TLS record, 0 if disabled. */
+		uint16_t tx_coalesce;
+
 		/** Socket TX timeout */
 		k_timeout_t timeout_tx;
 
@@ -223,6 +239,17 @@ __net_socket struct tls_context {
 	socklen_t dtls_peer_addrlen;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if TLS_TX_COALESCE_SIZE > 0
+	/** Data waiting to be sent in a single TLS record. */
+	uint8_t tx_buf[TLS_TX_COALESCE_SIZE];
+
+	/** Length of the data in tx_buf. */
+	uint16_t tx_len;
+
+	/** Last attempt to write tx_buf did not complete. */
+	bool tx_blocked;
+#endif
+
 #if defined(CONFIG_MBEDTLS)
 	/** mbedTLS context. */
 	mbedtls_ssl_context ssl;
@@ -254,6 +281,21 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME)
+#if defined(MBEDTLS_GCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_GCM
+#elif defined(MBEDTLS_CCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_256_CCM
+#elif defined(MBEDTLS_CHACHAPOLY_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_CHACHA20_POLY1305
+#endif
+#endif
+
+#if defined(TLS_TICKET_CIPHER)
+static mbedtls_ssl_ticket_context ticket_ctx;
+static bool ticket_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -268,6 +310,10 @@ static void tls_session_cache_reset(void)
 		if (client_cache[i].session != NULL) {
 			mbedtls_free(client_cache[i].session);
 		}
+
+		if (client_cache[i].hostname != NULL) {
+			mbedtls_free(client_cache[i].hostname);
+		}
 	}
 
 	(void)memset(client_cache, 0, sizeof(client_cache));
@@ -355,6 +401,22 @@ static int dtls_get_remaining_timeout(struct tls_context *ctx)
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(TLS_TICKET_CIPHER)
+static void tls_ticket_setup(void)
+{
+	int ret;
+
+	ret = mbedtls_ssl_ticket_setup(&ticket_ctx, tls_ctr_drbg_random, NULL,
+				       TLS_TICKET_CIPHER,
+				       CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+	if (ret != 0) {
+		NET_ERR("Failed to set up session tickets, err: -0x%x", -ret);
+	}
+
+	ticket_ready = (ret == 0);
+}
+#endif
+
 /* Initialize TLS internals. */
 static int tls_init(void)
 {
@@ -373,6 +435,11 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(TLS_TICKET_CIPHER)
+	mbedtls_ssl_ticket_init(&ticket_ctx);
+	tls_ticket_setup();
+#endif
+
 	return 0;
 }
 
@@ -571,7 +638,51 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static uint16_t peer_port(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_port;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && addr->sa_family == AF_INET) {
+		return net_sin(addr)->sin_port;
+	}
+
+	return 0;
+}
+
+/* Sessions of a peer with a known hostname are keyed by the hostname and
+ * port, so they can be resumed whichever address the name resolves to.
+ * Other sessions are keyed by the peer address.
+ */
+static bool tls_session_match(const struct tls_session_cache *entry,
+			      const struct sockaddr *peer_addr,
+			      const char *hostname)
+{
+	if (hostname != NULL) {
+		return entry->hostname != NULL &&
+		       strcmp(entry->hostname, hostname) == 0 &&
+		       entry->peer_addr.sa_family == peer_addr->sa_family &&
+		       peer_port(&entry->peer_addr) == peer_port(peer_addr);
+	}
+
+	return entry->hostname == NULL &&
+	       peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
+static void tls_session_entry_free(struct tls_session_cache *entry)
+{
+	if (entry->session != NULL) {
+		mbedtls_free(entry->session);
+		entry->session = NULL;
+	}
+
+	if (entry->hostname != NULL) {
+		mbedtls_free(entry->hostname);
+		entry->hostname = NULL;
+	}
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -585,8 +696,9 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
-				/* Reuse old entry for given address. */
+			if (tls_session_match(&client_cache[i], peer_addr,
+					      hostname)) {
+				/* Reuse old entry for given peer. */
 				entry = &client_cache[i];
 				break;
 			}
@@ -602,9 +714,18 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 
 	/* Allocate session and save */
 
-	if (entry->session != NULL) {
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+	tls_session_entry_free(entry);
+
+	if (hostname != NULL) {
+		size_t hostname_len = strlen(hostname);
+
+		entry->hostname = mbedtls_calloc(1, hostname_len + 1);
+		if (entry->hostname == NULL) {
+			NET_ERR("Failed to allocate hostname buffer.");
+			return -ENOMEM;
+		}
+
+		memcpy(entry->hostname, hostname, hostname_len);
 	}
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
@@ -612,6 +733,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 	entry->session = mbedtls_calloc(1, session_len);
 	if (entry->session == NULL) {
 		NET_ERR("Failed to allocate session buffer.");
+		tls_session_entry_free(entry);
 		return -ENOMEM;
 	}
 
@@ -619,8 +741,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				       &session_len);
 	if (ret < 0) {
 		NET_ERR("Failed to serialize session, err: -0x%x.", -ret);
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		return -ENOMEM;
 	}
 
@@ -632,6 +753,7 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -639,7 +761,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_match(&client_cache[i], peer_addr, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -653,8 +775,7 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 				       entry->session_len);
 	if (ret < 0) {
 		/* Discard corrupted session data. */
-		mbedtls_free(entry->session);
-		entry->session = NULL;
+		tls_session_entry_free(entry);
 		NET_ERR("Failed to load TLS session %d", ret);
 		return -EIO;
 	}
@@ -662,6 +783,18 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 	return 0;
 }
 
+/* Hostname the session cache is keyed by, NULL to use the peer address. */
+static const char *tls_session_hostname(struct tls_context *context)
+{
+	if (!context->options.is_hostname_set ||
+	    context->ssl.hostname == NULL ||
+	    context->ssl.hostname[0] == '\0') {
+		return NULL;
+	}
+
+	return context->ssl.hostname;
+}
+
 static void tls_session_store(struct tls_context *context,
 			      const struct sockaddr *addr,
 			      socklen_t addrlen)
@@ -683,7 +816,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, tls_session_hostname(context),
+			       &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -707,7 +841,8 @@ static void tls_session_restore(struct tls_context *context,
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, tls_session_hostname(context),
+			      &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -730,6 +865,13 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(TLS_TICKET_CIPHER)
+	/* New ticket keys invalidate the tickets issued so far. */
+	mbedtls_ssl_ticket_free(&ticket_ctx);
+	mbedtls_ssl_ticket_init(&ticket_ctx);
+	tls_ticket_setup();
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -1421,6 +1563,15 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(TLS_TICKET_CIPHER)
+	if (is_server && context->options.tickets_enabled && ticket_ready) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &ticket_ctx);
+	}
+#endif
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 	mbedtls_ssl_conf_early_data(&context->config, MBEDTLS_SSL_EARLY_DATA_ENABLED);
 #endif
@@ -1452,6 +1603,161 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	return 0;
 }
 
+static ssize_t tls_write(struct tls_context *ctx, const void *buf,
+			 size_t len, int flags)
+{
+	const bool is_block = is_blocking(ctx->sock, flags);
+	k_timeout_t timeout;
+	k_timepoint_t end;
+	int ret;
+
+	if (!is_block) {
+		timeout = K_NO_WAIT;
+	} else {
+		timeout = ctx->options.timeout_tx;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	do {
+		ret = mbedtls_ssl_write(&ctx->ssl, buf, len);
+		if (ret >= 0) {
+			return ret;
+		}
+
+		if (ret == MBEDTLS_ERR_SSL_WANT_READ ||
+		    ret == MBEDTLS_ERR_SSL_WANT_WRITE ||
+		    ret == MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS ||
+		    ret ==  MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS) {
+			int timeout_ms;
+
+			if (!is_block) {
+				errno = EAGAIN;
+				break;
+			}
+
+			/* Blocking timeout. */
+			timeout = sys_timepoint_timeout(end);
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				errno = EAGAIN;
+				break;
+			}
+
+			/* Block. */
+			timeout_ms = timeout_to_ms(&timeout);
+			ret = wait_for_reason(ctx->sock, timeout_ms, ret);
+			if (ret != 0) {
+				errno = -ret;
+				break;
+			}
+		} else {
+			NET_ERR("TLS send error: -%x", -ret);
+
+			/* MbedTLS API documentation requires session to
+			 * be reset in other error cases
+			 */
+			ret = tls_mbedtls_reset(ctx);
+			if (ret != 0) {
+				ctx->error = ENOMEM;
+				errno = ENOMEM;
+			} else {
+				ctx->error = ECONNABORTED;
+				errno = ECONNABORTED;
+			}
+
+			break;
+		}
+	} while (true);
+
+	return -1;
+}
+
+#if TLS_TX_COALESCE_SIZE > 0
+/* Write out the coalesced data. On failure, the data that was not written
+ * stays in the buffer, and has to be written before anything is added to it.
+ */
+static int tls_tx_flush(struct tls_context *ctx, int flags)
+{
+	ssize_t ret = 0;
+	size_t sent = 0;
+
+	while (sent < ctx->tx_len) {
+		ret = tls_write(ctx, ctx->tx_buf + sent, ctx->tx_len - sent,
+				flags);
+		if (ret < 0) {
+			break;
+		}
+
+		sent += ret;
+	}
+
+	if (sent > 0) {
+		memmove(ctx->tx_buf, ctx->tx_buf + sent, ctx->tx_len - sent);
+		ctx->tx_len -= sent;
+	}
+
+	ctx->tx_blocked = (ret < 0);
+
+	return ret < 0 ? -1 : 0;
+}
+
+static ssize_t send_tls_coalesce(struct tls_context *ctx, const void *buf,
+				 size_t len, int flags)
+{
+	const uint8_t *ptr = buf;
+	size_t sent = 0;
+	size_t copy;
+	ssize_t ret;
+
+	while (sent < len) {
+		if (ctx->tx_blocked && tls_tx_flush(ctx, flags) < 0) {
+			goto out;
+		}
+
+		/* Nothing to coalesce with, send large writes as they are. */
+		if (ctx->tx_len == 0 && len - sent >= ctx->options.tx_coalesce) {
+			ret = tls_write(ctx, ptr + sent, len - sent, flags);
+			if (ret < 0) {
+				goto out;
+			}
+
+			sent += ret;
+			continue;
+		}
+
+		copy = MIN(len - sent, ctx->options.tx_coalesce - ctx->tx_len);
+		memcpy(ctx->tx_buf + ctx->tx_len, ptr + sent, copy);
+		ctx->tx_len += copy;
+		sent += copy;
+
+		if (ctx->tx_len == ctx->options.tx_coalesce) {
+			/* The data is already accepted, a failed write is
+			 * reported on the next call.
+			 */
+			(void)tls_tx_flush(ctx, flags);
+		}
+	}
+
+out:
+	return sent > 0 ? sent : -1;
+}
+#else
+static int tls_tx_flush(struct tls_context *ctx, int flags)
+{
+	return 0;
+}
+#endif /* TLS_TX_COALESCE_SIZE > 0 */
+
+static bool tls_tx_pending(struct tls_context *ctx)
+{
+#if TLS_TX_COALESCE_SIZE > 0
+	/* After an error, the session is reset and the data cannot be sent. */
+	return ctx->tx_len > 0 && ctx->error == 0;
+#else
+	return false;
+#endif
+}
+
 static int tls_opt_sec_tag_list_set(struct tls_context *context,
 				    const void *optval, socklen_t optlen)
 {
@@ -1945,6 +2251,120 @@ static int tls_opt_session_cache_get(struct tls_context *context,
 	return 0;
 }
 
+static int tls_opt_session_tickets_set(struct tls_context *context,
+				       const void *optval, socklen_t optlen)
+{
+#if defined(TLS_TICKET_CIPHER)
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	context->options.tickets_enabled = (*val == TLS_SESSION_TICKETS_ENABLED);
+
+	return 0;
+#else
+	return -ENOPROTOOPT;
+#endif
+}
+
+static int tls_opt_session_tickets_get(struct tls_context *context,
+				       void *optval, socklen_t *optlen)
+{
+#if defined(TLS_TICKET_CIPHER)
+	int tickets_enabled = context->options.tickets_enabled ?
+			      TLS_SESSION_TICKETS_ENABLED :
+			      TLS_SESSION_TICKETS_DISABLED;
+
+	if (*optlen != sizeof(tickets_enabled)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = tickets_enabled;
+
+	return 0;
+#else
+	return -ENOPROTOOPT;
+#endif
+}
+
+static int tls_opt_tx_coalesce_set(struct tls_context *context,
+				   const void *optval, socklen_t optlen)
+{
+#if TLS_TX_COALESCE_SIZE > 0
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (sizeof(int) != optlen) {
+		return -EINVAL;
+	}
+
+	if (*val < 0 || *val > TLS_TX_COALESCE_SIZE) {
+		return -EINVAL;
+	}
+
+	if (context->type != SOCK_STREAM) {
+		return -EOPNOTSUPP;
+	}
+
+	/* Do not keep more data than the new limit allows. */
+	if (context->tx_len > 0 && context->tx_len >= *val &&
+	    tls_tx_flush(context, 0) < 0) {
+		return -errno;
+	}
+
+	context->options.tx_coalesce = *val;
+
+	return 0;
+#else
+	return -ENOPROTOOPT;
+#endif
+}
+
+static int tls_opt_tx_coalesce_get(struct tls_context *context,
+				   void *optval, socklen_t *optlen)
+{
+#if TLS_TX_COALESCE_SIZE > 0
+	int tx_coalesce = context->options.tx_coalesce;
+
+	if (*optlen != sizeof(tx_coalesce)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = tx_coalesce;
+
+	return 0;
+#else
+	return -ENOPROTOOPT;
+#endif
+}
+
+static int tls_opt_tx_flush_set(struct tls_context *context,
+				const void *optval, socklen_t optlen)
+{
+	ARG_UNUSED(optval);
+	ARG_UNUSED(optlen);
+
+	if (context->error != 0) {
+		return -context->error;
+	}
+
+	if (tls_tx_pending(context) &&
+	    tls_tx_flush(context, 0) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
 static int tls_opt_session_cache_purge_set(struct tls_context *context,
 					   const void *optval, socklen_t optlen)
 {
@@ -2115,6 +2535,10 @@ int ztls_close_ctx(struct tls_context *ctx)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+	if (tls_tx_pending(ctx)) {
+		(void)tls_tx_flush(ctx, 0);
+	}
+
 	(void)mbedtls_ssl_close_notify(&ctx->ssl);
 
 	err = tls_release(ctx);
@@ -2267,11 +2691,6 @@ error:
 static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 			size_t len, int flags)
 {
-	const bool is_block = is_blocking(ctx->sock, flags);
-	k_timeout_t timeout;
-	k_timepoint_t end;
-	int ret;
-
 	if (ctx->error != 0) {
 		errno = ctx->error;
 		return -1;
@@ -2282,65 +2701,13 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 		return -1;
 	}
 
-	if (!is_block) {
-		timeout = K_NO_WAIT;
-	} else {
-		timeout = ctx->options.timeout_tx;
+#if TLS_TX_COALESCE_SIZE > 0
+	if (ctx->options.tx_coalesce > 0 && ctx->type == SOCK_STREAM) {
+		return send_tls_coalesce(ctx, buf, len, flags);
 	}
+#endif
 
-	end = sys_timepoint_calc(timeout);
-
-	do {
-		ret = mbedtls_ssl_write(&ctx->ssl, buf, len);
-		if (ret >= 0) {
-			return ret;
-		}
-
-		if (ret == MBEDTLS_ERR_SSL_WANT_READ ||
-		    ret == MBEDTLS_ERR_SSL_WANT_WRITE ||
-		    ret == MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS ||
-		    ret ==  MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS) {
-			int timeout_ms;
-
-			if (!is_block) {
-				errno = EAGAIN;
-				break;
-			}
-
-			/* Blocking timeout. */
-			timeout = sys_timepoint_timeout(end);
-			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
-				errno = EAGAIN;
-				break;
-			}
-
-			/* Block. */
-			timeout_ms = timeout_to_ms(&timeout);
-			ret = wait_for_reason(ctx->sock, timeout_ms, ret);
-			if (ret != 0) {
-				errno = -ret;
-				break;
-			}
-		} else {
-			NET_ERR("TLS send error: -%x", -ret);
-
-			/* MbedTLS API documentation requires session to
-			 * be reset in other error cases
-			 */
-			ret = tls_mbedtls_reset(ctx);
-			if (ret != 0) {
-				ctx->error = ENOMEM;
-				errno = ENOMEM;
-			} else {
-				ctx->error = ECONNABORTED;
-				errno = ECONNABORTED;
-			}
-
-			break;
-		}
-	} while (true);
-
-	return -1;
+	return tls_write(ctx, buf, len, flags);
 }
 
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
@@ -2575,6 +2942,11 @@ static ssize_t recv_tls(struct tls_context *ctx, void *buf,
 		return 0;
 	}
 
+	/* The peer may be waiting for the coalesced data to respond. */
+	if (tls_tx_pending(ctx)) {
+		(void)tls_tx_flush(ctx, flags);
+	}
+
 	if (!is_block) {
 		timeout = K_NO_WAIT;
 	} else {
@@ -3026,6 +3398,13 @@ static int ztls_poll_prepare_ctx(struct tls_context *ctx,
 	}
 
 	if (pfd->events & ZSOCK_POLLIN) {
+		/* Same as for recv(), do not wait for a response to the data
+		 * that was not sent yet.
+		 */
+		if (tls_tx_pending(ctx)) {
+			(void)tls_tx_flush(ctx, ZSOCK_MSG_DONTWAIT);
+		}
+
 		ret = ztls_poll_prepare_pollin(ctx);
 	}
 
@@ -3483,6 +3862,14 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+	case TLS_SESSION_TICKETS:
+		err = tls_opt_session_tickets_get(ctx, optval, optlen);
+		break;
+
+	case TLS_TX_COALESCE:
+		err = tls_opt_tx_coalesce_get(ctx, optval, optlen);
+		break;
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_get(ctx, optval,
@@ -3605,6 +3992,18 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
 		break;
 
+	case TLS_SESSION_TICKETS:
+		err = tls_opt_session_tickets_set(ctx, optval, optlen);
+		break;
+
+	case TLS_TX_COALESCE:
+		err = tls_opt_tx_coalesce_set(ctx, optval, optlen);
+		break;
+
+	case TLS_TX_FLUSH:
+		err = tls_opt_tx_flush_set(ctx, optval, optlen);
+		break;
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_set(ctx, optval,
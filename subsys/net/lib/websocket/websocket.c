@@ -20,6 +20,7 @@ LOG_MODULE_REGISTER(net_websocket, CONFIG_NET_WEBSOCKET_LOG_LEVEL);
 #include <stdlib.h>
 
 #include <zephyr/sys/fdtable.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_ip.h>
 #if defined(CONFIG_POSIX_API)
@@ -602,38 +603,58 @@ static int sendmsg_all(int sock, const struct msghdr *message, int flags,
 }
 #endif /* !defined(CONFIG_NET_TEST) */
 
-static int websocket_prepare_and_send(struct websocket_context *ctx,
-				      uint8_t *header, size_t header_len,
-				      uint8_t *payload, size_t payload_len,
-				      int32_t timeout)
+#define MAX_SEND_FRAGMENTS 8
+
+static inline uint8_t websocket_mask_byte(uint32_t mask, size_t offset)
 {
-	struct iovec io_vector[2];
-	struct msghdr msg;
+	return mask >> (8 * (3 - offset % 4));
+}
 
-	io_vector[0].iov_base = header;
-	io_vector[0].iov_len = header_len;
-	io_vector[1].iov_base = payload;
-	io_vector[1].iov_len = payload_len;
+/* XOR the data with the masking key a word at a time. The offset is the
+ * position of the data in the frame payload.
+ */
+static void websocket_mask(uint8_t *data, size_t len, uint32_t mask, size_t offset)
+{
+	uintptr_t key;
+	size_t i = 0;
 
-	memset(&msg, 0, sizeof(msg));
+	for (; i < len && ((uintptr_t)&data[i] % sizeof(key)) != 0; i++) {
+		data[i] ^= websocket_mask_byte(mask, offset + i);
+	}
 
-	msg.msg_iov = io_vector;
-	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+	if (len - i >= sizeof(key)) {
+		uint8_t *key_bytes = (uint8_t *)&key;
 
-	if (HEXDUMP_SENT_PACKETS) {
-		LOG_HEXDUMP_DBG(header, header_len, "Header");
-		if ((payload != NULL) && (payload_len > 0)) {
-			LOG_HEXDUMP_DBG(payload, payload_len, "Payload");
-		} else {
-			LOG_DBG("No payload");
+		for (size_t j = 0; j < sizeof(key); j++) {
+			key_bytes[j] = websocket_mask_byte(mask, offset + i + j);
+		}
+
+		for (; len - i >= sizeof(key); i += sizeof(key)) {
+			*(uintptr_t *)&data[i] ^= key;
 		}
 	}
 
+	for (; i < len; i++) {
+		data[i] ^= websocket_mask_byte(mask, offset + i);
+	}
+}
+
+static int websocket_sendmsg(struct websocket_context *ctx, struct iovec *io_vector,
+			     size_t iovlen, int32_t timeout)
+{
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = iovlen;
+
 #if defined(CONFIG_NET_TEST)
 	/* Simulate a case where the payload is split to two. The unit test
 	 * does not set mask bit in this case.
 	 */
-	return verify_sent_and_received_msg(&msg, !(header[1] & BIT(7)));
+	return verify_sent_and_received_msg(&msg,
+					    !(((uint8_t *)io_vector[0].iov_base)[1] & BIT(7)));
 #else
 	k_timeout_t tout = K_FOREVER;
 
@@ -650,14 +671,34 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
-int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
-		       enum websocket_opcode opcode, bool mask, bool final,
-		       int32_t timeout)
+static int websocket_prepare_and_send(struct websocket_context *ctx,
+				      uint8_t *header, size_t header_len,
+				      uint8_t *payload, size_t payload_len,
+				      int32_t timeout)
+{
+	struct iovec io_vector[2];
+
+	io_vector[0].iov_base = header;
+	io_vector[0].iov_len = header_len;
+	io_vector[1].iov_base = payload;
+	io_vector[1].iov_len = payload_len;
+
+	if (HEXDUMP_SENT_PACKETS) {
+		LOG_HEXDUMP_DBG(header, header_len, "Header");
+		if ((payload != NULL) && (payload_len > 0)) {
+			LOG_HEXDUMP_DBG(payload, payload_len, "Payload");
+		} else {
+			LOG_DBG("No payload");
+		}
+	}
+
+	return websocket_sendmsg(ctx, io_vector, ARRAY_SIZE(io_vector), timeout);
+}
+
+static struct websocket_context *websocket_send_ctx_get(int ws_sock,
+							 enum websocket_opcode opcode)
 {
 	struct websocket_context *ctx;
-	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
-	int ret;
 
 	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
 	    opcode != WEBSOCKET_OPCODE_DATA_BINARY &&
@@ -665,12 +706,14 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	    opcode != WEBSOCKET_OPCODE_CLOSE &&
 	    opcode != WEBSOCKET_OPCODE_PING &&
 	    opcode != WEBSOCKET_OPCODE_PONG) {
-		return -EINVAL;
+		errno = EINVAL;
+		return NULL;
 	}
 
 	ctx = zvfs_get_fd_obj(ws_sock, NULL, 0);
 	if (ctx == NULL) {
-		return -EBADF;
+		errno = EBADF;
+		return NULL;
 	}
 
 #if !defined(CONFIG_NET_TEST)
@@ -679,14 +722,22 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 	 */
 
 	if (!PART_OF_ARRAY(contexts, ctx)) {
-		return -ENOENT;
+		errno = ENOENT;
+		return NULL;
 	}
 #endif /* !defined(CONFIG_NET_TEST) */
 
-	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
-		mask, final ? "final" : "more");
+	return ctx;
+}
 
-	memset(header, 0, sizeof(header));
+/* Fill the frame header and pick a new masking value if needed. */
+static size_t websocket_prepare_header(struct websocket_context *ctx, uint8_t *header,
+				       size_t payload_len, enum websocket_opcode opcode,
+				       bool mask, bool final)
+{
+	size_t hdr_len = 2;
+
+	memset(header, 0, MAX_HEADER_LEN);
 
 	/* Is this the last packet? */
 	header[0] = final ? BIT(7) : 0;
@@ -719,27 +770,46 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
 		header[hdr_len++] |= ctx->masking_value >> 16;
 		header[hdr_len++] |= ctx->masking_value >> 8;
 		header[hdr_len++] |= ctx->masking_value;
+	}
 
-		if ((payload != NULL) && (payload_len > 0)) {
-			data_to_send = k_malloc(payload_len);
-			if (!data_to_send) {
-				return -ENOMEM;
-			}
+	return hdr_len;
+}
 
-			memcpy(data_to_send, payload, payload_len);
+int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
+		       enum websocket_opcode opcode, bool mask, bool final,
+		       int32_t timeout)
+{
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN];
+	uint8_t *data_to_send = (uint8_t *)payload;
+	size_t hdr_len;
+	int ret;
 
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+	ctx = websocket_send_ctx_get(ws_sock, opcode);
+	if (ctx == NULL) {
+		return -errno;
+	}
+
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	hdr_len = websocket_prepare_header(ctx, header, payload_len, opcode, mask, final);
+
+	/* The caller data cannot be modified, mask a copy of it */
+	if (mask && (payload != NULL) && (payload_len > 0)) {
+		data_to_send = k_malloc(payload_len);
+		if (!data_to_send) {
+			return -ENOMEM;
 		}
+
+		memcpy(data_to_send, payload, payload_len);
+		websocket_mask(data_to_send, payload_len, ctx->masking_value, 0);
 	}
 
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
@@ -762,6 +832,71 @@ quit:
 	return ret - hdr_len;
 }
 
+int websocket_send_net_buf(int ws_sock, struct net_buf *buf,
+			   enum websocket_opcode opcode, bool mask, bool final,
+			   int32_t timeout)
+{
+	struct iovec io_vector[1 + MAX_SEND_FRAGMENTS];
+	struct websocket_context *ctx;
+	uint8_t header[MAX_HEADER_LEN];
+	size_t payload_len;
+	size_t hdr_len;
+	size_t iovlen = 1;
+	int ret;
+
+	ctx = websocket_send_ctx_get(ws_sock, opcode);
+	if (ctx == NULL) {
+		return -errno;
+	}
+
+	for (struct net_buf *frag = buf; frag != NULL; frag = frag->frags) {
+		if (frag->len == 0) {
+			continue;
+		}
+
+		if (iovlen == ARRAY_SIZE(io_vector)) {
+			return -EMSGSIZE;
+		}
+
+		iovlen++;
+	}
+
+	payload_len = net_buf_frags_len(buf);
+
+	NET_DBG("[%p] Len %zd %s/%d/%s", ctx, payload_len, opcode2str(opcode),
+		mask, final ? "final" : "more");
+
+	hdr_len = websocket_prepare_header(ctx, header, payload_len, opcode, mask, final);
+
+	io_vector[0].iov_base = header;
+	io_vector[0].iov_len = hdr_len;
+	iovlen = 1;
+
+	/* The fragments are masked in place and sent as they are */
+	for (size_t offset = 0; buf != NULL; buf = buf->frags) {
+		if (buf->len == 0) {
+			continue;
+		}
+
+		if (mask) {
+			websocket_mask(buf->data, buf->len, ctx->masking_value, offset);
+		}
+
+		io_vector[iovlen].iov_base = buf->data;
+		io_vector[iovlen].iov_len = buf->len;
+		iovlen++;
+		offset += buf->len;
+	}
+
+	ret = websocket_sendmsg(ctx, io_vector, iovlen, timeout);
+	if (ret <= 0) {
+		NET_DBG("Cannot send ws msg (%d)", ret < 0 ? -errno : 0);
+		return ret;
+	}
+
+	return ret - hdr_len;
+}
+
 static uint32_t websocket_opcode2flag(uint8_t data)
 {
 	switch (data & 0x0f) {
@@ -1051,15 +1186,8 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
-		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
-
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.count, ctx->masking_value,
+			       ctx->message_len - ctx->parser_remaining - payload.count);
 	}
 
 	return payload.count;
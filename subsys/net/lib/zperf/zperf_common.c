@@ -48,6 +48,24 @@ K_THREAD_STACK_DEFINE(zperf_work_q_stack, CONFIG_ZPERF_WORK_Q_STACK_SIZE);
 
 static struct k_work_q zperf_work_q;
 
+#if CONFIG_NET_ZPERF_MAX_STREAMS > 1
+#define ZPERF_EXTRA_STREAMS (CONFIG_NET_ZPERF_MAX_STREAMS - 1)
+
+struct zperf_stream {
+	struct k_thread thread;
+	const struct zperf_upload_params *param;
+	zperf_stream_fn upload;
+	struct zperf_results result;
+	int index;
+	int ret;
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(zperf_stream_stacks, ZPERF_EXTRA_STREAMS,
+			    CONFIG_ZPERF_WORK_Q_STACK_SIZE);
+static struct zperf_stream zperf_streams[ZPERF_EXTRA_STREAMS];
+static atomic_t zperf_streams_busy;
+#endif /* CONFIG_NET_ZPERF_MAX_STREAMS > 1 */
+
 int zperf_get_ipv6_addr(char *host, char *prefix_str, struct in6_addr *addr)
 {
 	struct net_if_ipv6_prefix *prefix;
@@ -220,6 +238,150 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
+#if CONFIG_NET_ZPERF_MAX_STREAMS > 1
+static void zperf_stream_thread(void *p1, void *p2, void *p3)
+{
+	struct zperf_stream *stream = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	stream->ret = stream->upload(stream->param, stream->index, &stream->result);
+}
+
+static void zperf_results_add(struct zperf_results *total,
+			      const struct zperf_results *result)
+{
+	total->nb_packets_sent += result->nb_packets_sent;
+	total->nb_packets_rcvd += result->nb_packets_rcvd;
+	total->nb_packets_lost += result->nb_packets_lost;
+	total->nb_packets_outorder += result->nb_packets_outorder;
+	total->nb_packets_errors += result->nb_packets_errors;
+	total->total_len += result->total_len;
+
+	/* The streams run in parallel, so the slowest one gives the times */
+	total->time_in_us = MAX(total->time_in_us, result->time_in_us);
+	total->client_time_in_us = MAX(total->client_time_in_us,
+				       result->client_time_in_us);
+	total->jitter_in_us = MAX(total->jitter_in_us, result->jitter_in_us);
+}
+#endif /* CONFIG_NET_ZPERF_MAX_STREAMS > 1 */
+
+int zperf_upload_streams(const struct zperf_upload_params *param,
+			 zperf_stream_fn upload, struct zperf_results *result)
+{
+#if CONFIG_NET_ZPERF_MAX_STREAMS > 1
+	int count = param->num_streams;
+	int ret;
+
+	if (count <= 1) {
+		return upload(param, 0, result);
+	}
+
+	if (count > CONFIG_NET_ZPERF_MAX_STREAMS) {
+		NET_WARN("Too many streams, limiting to %d",
+			 CONFIG_NET_ZPERF_MAX_STREAMS);
+		count = CONFIG_NET_ZPERF_MAX_STREAMS;
+	}
+
+	if (!atomic_cas(&zperf_streams_busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	for (int i = 0; i < count - 1; i++) {
+		struct zperf_stream *stream = &zperf_streams[i];
+
+		memset(&stream->result, 0, sizeof(stream->result));
+		stream->param = param;
+		stream->upload = upload;
+		stream->index = i + 1;
+		stream->ret = 0;
+
+		k_thread_create(&stream->thread, zperf_stream_stacks[i],
+				K_THREAD_STACK_SIZEOF(zperf_stream_stacks[i]),
+				zperf_stream_thread, stream, NULL, NULL,
+				ZPERF_WORK_Q_THREAD_PRIORITY, 0, K_FOREVER);
+		k_thread_name_set(&stream->thread, "zperf_stream");
+#if defined(CONFIG_SCHED_CPU_MASK)
+		(void)k_thread_cpu_pin(&stream->thread,
+				       (i + 1) % arch_num_cpus());
+#endif
+		k_thread_start(&stream->thread);
+	}
+
+	ret = upload(param, 0, result);
+
+	for (int i = 0; i < count - 1; i++) {
+		struct zperf_stream *stream = &zperf_streams[i];
+
+		(void)k_thread_join(&stream->thread, K_FOREVER);
+
+		if (stream->ret < 0) {
+			if (ret == 0) {
+				ret = stream->ret;
+			}
+
+			continue;
+		}
+
+		zperf_results_add(result, &stream->result);
+	}
+
+	atomic_set(&zperf_streams_busy, 0);
+
+	return ret;
+#else
+	return upload(param, 0, result);
+#endif /* CONFIG_NET_ZPERF_MAX_STREAMS > 1 */
+}
+
+/* Log-linear bins: exact below 4 us, then 4 bins per power of two */
+void zperf_latency_record(uint32_t *bins, uint32_t latency_us)
+{
+	uint32_t idx;
+
+	if (latency_us < 4U) {
+		idx = latency_us;
+	} else {
+		int msb = 31 - __builtin_clz(latency_us);
+
+		idx = (msb - 1) * 4 + ((latency_us >> (msb - 2)) & 3U);
+	}
+
+	bins[MIN(idx, ZPERF_LATENCY_BINS - 1)]++;
+}
+
+uint32_t zperf_latency_percentile(const uint32_t *bins, uint32_t count,
+				  uint32_t per_mille)
+{
+	uint64_t rank = ((uint64_t)count * per_mille + 999U) / 1000U;
+	uint64_t seen = 0U;
+
+	if (count == 0U) {
+		return 0U;
+	}
+
+	for (uint32_t idx = 0U; idx < ZPERF_LATENCY_BINS; idx++) {
+		uint32_t msb;
+
+		seen += bins[idx];
+		if (seen < rank) {
+			continue;
+		}
+
+		if (idx < 4U) {
+			return idx;
+		}
+
+		/* Report the upper bound of the bin */
+		msb = idx / 4U + 1U;
+
+		return ((4U + idx % 4U + 1U) << (msb - 2U)) - 1U;
+	}
+
+	return UINT32_MAX;
+}
+
 void zperf_async_work_submit(struct k_work *work)
 {
 	k_work_submit_to_queue(&zperf_work_q, work);
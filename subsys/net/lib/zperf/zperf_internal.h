@@ -90,6 +90,12 @@ struct zperf_async_upload_context {
 	void *user_data;
 };
 
+#define ZPERF_LATENCY_BINS 80
+
+/* Upload of one stream, the streams of an upload differ by the index only */
+typedef int (*zperf_stream_fn)(const struct zperf_upload_params *param,
+			       int stream, struct zperf_results *result);
+
 static inline uint32_t time_delta(uint32_t ts, uint32_t t)
 {
 	return (t >= ts) ? (t - ts) : (ULONG_MAX - ts + t);
@@ -108,6 +114,13 @@ int zperf_prepare_upload_sock(const struct sockaddr *peer_addr, uint8_t tos,
 
 uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps);
 
+int zperf_upload_streams(const struct zperf_upload_params *param,
+			 zperf_stream_fn upload, struct zperf_results *result);
+
+void zperf_latency_record(uint32_t *bins, uint32_t latency_us);
+uint32_t zperf_latency_percentile(const uint32_t *bins, uint32_t count,
+				  uint32_t per_mille);
+
 void zperf_async_work_submit(struct k_work *work);
 void zperf_udp_uploader_init(void);
 void zperf_tcp_uploader_init(void);
@@ -100,6 +100,10 @@ void zperf_reset_session_stats(struct session *session)
 	session->error = 0U;
 	session->jitter = 0;
 	session->last_transit_time = 0;
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	session->min_transit_time = INT32_MAX;
+	(void)memset(session->latency_bins, 0, sizeof(session->latency_bins));
+#endif
 }
 
 void zperf_session_reset(enum session_proto proto)
@@ -49,6 +49,10 @@ struct session {
 	uint32_t last_time;
 	int32_t jitter;
 	int32_t last_transit_time;
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	int32_t min_transit_time;
+	uint32_t latency_bins[ZPERF_LATENCY_BINS];
+#endif
 
 	/* Stats packet*/
 	struct zperf_server_hdr stat;
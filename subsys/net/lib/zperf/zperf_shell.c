@@ -351,6 +351,18 @@ static void udp_session_cb(enum zperf_status status,
 		print_number(sh, result->jitter_in_us, TIME_US, TIME_US_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+		if (IS_ENABLED(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)) {
+			shell_fprintf(sh, SHELL_NORMAL, " latency p50:\t\t");
+			print_number(sh, result->latency_p50_us, TIME_US, TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+			shell_fprintf(sh, SHELL_NORMAL, " latency p99:\t\t");
+			print_number(sh, result->latency_p99_us, TIME_US, TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+			shell_fprintf(sh, SHELL_NORMAL, " latency p99.9:\t\t");
+			print_number(sh, result->latency_p999_us, TIME_US, TIME_US_UNIT);
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+		}
+
 		shell_fprintf(sh, SHELL_NORMAL, " rate:\t\t\t");
 		print_number(sh, rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
@@ -719,6 +731,15 @@ static int execute_upload(const struct shell *sh,
 		      param->packet_size);
 	shell_fprintf(sh, SHELL_NORMAL, "Rate:\t\t%u kbps\n",
 		      param->rate_kbps);
+	if (param->num_streams > 1) {
+		shell_fprintf(sh, SHELL_NORMAL, "Streams:\t%u\n",
+			      param->num_streams);
+
+		if (param->options.report_interval_ms > 0) {
+			shell_fprintf(sh, SHELL_WARNING,
+				      "Periodic reporting is ignored with parallel streams\n");
+		}
+	}
 	shell_fprintf(sh, SHELL_NORMAL, "Starting...\n");
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && param->peer_addr.sa_family == AF_INET6) {
@@ -895,6 +916,21 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			break;
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Number of streams must be between 1 and %d\n",
+					      CONFIG_NET_ZPERF_MAX_STREAMS);
+				return -ENOEXEC;
+			}
+
+			param.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'I':
 			i++;
 			if (i >= argc) {
@@ -1128,6 +1164,21 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			break;
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 
+		case 'P': {
+			int streams = parse_arg(&i, argc, argv);
+
+			if (streams < 1 || streams > CONFIG_NET_ZPERF_MAX_STREAMS) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Number of streams must be between 1 and %d\n",
+					      CONFIG_NET_ZPERF_MAX_STREAMS);
+				return -ENOEXEC;
+			}
+
+			param.num_streams = streams;
+			opt_cnt += 2;
+			break;
+		}
+
 		case 'I':
 			i++;
 			if (i >= argc) {
@@ -1473,6 +1524,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "-i sec: Periodic reporting interval in seconds (async only)\n"
 		  "-n: Disable Nagle's algorithm\n"
+		  "-P num: Number of parallel streams\n"
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
@@ -1493,6 +1545,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 		  "-a: Asynchronous call (shell will not block for the upload)\n"
 		  "-i sec: Periodic reporting interval in seconds (async only)\n"
 		  "-n: Disable Nagle's algorithm\n"
+		  "-P num: Number of parallel streams\n"
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
@@ -1542,6 +1595,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 		  "-I: Specify host interface name\n"
+		  "-P num: Number of parallel streams, each at <baud rate>\n"
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
@@ -1563,6 +1617,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
 		  "-I: Specify host interface name\n"
+		  "-P num: Number of parallel streams, each at <baud rate>\n"
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
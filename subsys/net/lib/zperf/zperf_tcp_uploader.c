@@ -56,14 +56,6 @@ static int tcp_upload(int sock,
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 
-	(void)memset(sample_packet, 'z', sizeof(sample_packet));
-
-	/* Set the "flags" field in start of the packet to be 0.
-	 * As the protocol is not properly described anywhere, it is
-	 * not certain if this is a proper thing to do.
-	 */
-	(void)memset(sample_packet, 0, sizeof(uint32_t));
-
 	do {
 		/* Send the packet */
 		ret = sendall(sock, sample_packet, packet_size);
@@ -122,15 +114,13 @@ static int tcp_upload(int sock,
 	return 0;
 }
 
-int zperf_tcp_upload(const struct zperf_upload_params *param,
-		     struct zperf_results *result)
+static int tcp_upload_stream(const struct zperf_upload_params *param,
+			     int stream, struct zperf_results *result)
 {
 	int sock;
 	int ret;
 
-	if (param == NULL || result == NULL) {
-		return -EINVAL;
-	}
+	ARG_UNUSED(stream);
 
 	sock = zperf_prepare_upload_sock(&param->peer_addr, param->options.tos,
 					 param->options.priority, param->options.tcp_nodelay,
@@ -146,6 +136,16 @@ int zperf_tcp_upload(const struct zperf_upload_params *param,
 	return ret;
 }
 
+int zperf_tcp_upload(const struct zperf_upload_params *param,
+		     struct zperf_results *result)
+{
+	if (param == NULL || result == NULL) {
+		return -EINVAL;
+	}
+
+	return zperf_upload_streams(param, tcp_upload_stream, result);
+}
+
 static void tcp_upload_async_work(struct k_work *work)
 {
 	struct zperf_async_upload_context *upload_ctx =
@@ -158,6 +158,20 @@ static void tcp_upload_async_work(struct k_work *work)
 	upload_ctx->callback(ZPERF_SESSION_STARTED, NULL,
 			     upload_ctx->user_data);
 
+	if (param.num_streams > 1) {
+		/* Periodic reports are not supported with parallel streams */
+		ret = zperf_tcp_upload(&param, &result);
+		if (ret < 0) {
+			upload_ctx->callback(ZPERF_SESSION_ERROR, NULL,
+					     upload_ctx->user_data);
+		} else {
+			upload_ctx->callback(ZPERF_SESSION_FINISHED, &result,
+					     upload_ctx->user_data);
+		}
+
+		return;
+	}
+
 	sock = zperf_prepare_upload_sock(&param.peer_addr, param.options.tos,
 					 param.options.priority, param.options.tcp_nodelay,
 					 IPPROTO_TCP);
@@ -241,5 +255,16 @@ int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 
 void zperf_tcp_uploader_init(void)
 {
+	/* The payload is only read while uploading, so the parallel
+	 * streams can share it.
+	 */
+	(void)memset(sample_packet, 'z', sizeof(sample_packet));
+
+	/* Set the "flags" field in start of the packet to be 0.
+	 * As the protocol is not properly described anywhere, it is
+	 * not certain if this is a proper thing to do.
+	 */
+	(void)memset(sample_packet, 0, sizeof(uint32_t));
+
 	k_work_init(&tcp_async_upload_ctx.work, tcp_upload_async_work);
 }
@@ -184,6 +184,14 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 			results.time_in_us = duration;
 			results.jitter_in_us = session->jitter;
 			results.packet_size = session->length / session->counter;
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+			results.latency_p50_us = zperf_latency_percentile(
+				session->latency_bins, session->counter, 500U);
+			results.latency_p99_us = zperf_latency_percentile(
+				session->latency_bins, session->counter, 990U);
+			results.latency_p999_us = zperf_latency_percentile(
+				session->latency_bins, session->counter, 999U);
+#endif
 
 			if (udp_session_cb != NULL) {
 				udp_session_cb(ZPERF_SESSION_FINISHED, &results,
@@ -213,6 +221,18 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 
 			session->last_transit_time = transit_time;
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+			/* The clocks of the peers are not synchronized, so
+			 * record the delay relative to the fastest packet.
+			 */
+			if (transit_time < session->min_transit_time) {
+				session->min_transit_time = transit_time;
+			}
+
+			zperf_latency_record(session->latency_bins,
+					     transit_time - session->min_transit_time);
+#endif
+
 			/* Check header id */
 			if (id != session->next_id) {
 				if (id < session->next_id) {
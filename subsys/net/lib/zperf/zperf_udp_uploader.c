@@ -14,9 +14,12 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 
 #include "zperf_internal.h"
 
-static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
-			     sizeof(struct zperf_client_hdr_v1) +
-			     PACKET_SIZE_MAX];
+#define SAMPLE_PACKET_SIZE (sizeof(struct zperf_udp_datagram) + \
+			    sizeof(struct zperf_client_hdr_v1) + \
+			    PACKET_SIZE_MAX)
+
+/* The packet header is rewritten for every packet, so each stream has its own */
+static uint8_t sample_packets[CONFIG_NET_ZPERF_MAX_STREAMS][SAMPLE_PACKET_SIZE];
 
 static struct zperf_async_upload_context udp_async_upload_ctx;
 
@@ -47,6 +50,7 @@ static inline void zperf_upload_decode_stat(const uint8_t *data,
 }
 
 static inline int zperf_upload_fin(int sock,
+				   uint8_t *sample_packet,
 				   uint32_t nb_packets,
 				   uint64_t end_time,
 				   uint32_t packet_size,
@@ -85,7 +89,7 @@ static inline int zperf_upload_fin(int sock,
 		hdr->flags = 0;
 		hdr->num_of_threads = htonl(1);
 		hdr->port = 0;
-		hdr->buffer_len = sizeof(sample_packet) -
+		hdr->buffer_len = SAMPLE_PACKET_SIZE -
 			sizeof(*datagram) - sizeof(*hdr);
 		hdr->bandwidth = 0;
 		hdr->num_of_bytes = htonl(packet_size);
@@ -138,7 +142,7 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
-static int udp_upload(int sock, int port,
+static int udp_upload(int sock, int port, uint8_t *sample_packet,
 		      const struct zperf_upload_params *param,
 		      struct zperf_results *results)
 {
@@ -174,7 +178,7 @@ static int udp_upload(int sock, int port,
 	print_period = k_ms_to_ticks_ceil32(MSEC_PER_SEC);
 	print_time = start_time + print_period;
 
-	(void)memset(sample_packet, 'z', sizeof(sample_packet));
+	(void)memset(sample_packet, 'z', SAMPLE_PACKET_SIZE);
 
 	do {
 		struct zperf_udp_datagram *datagram;
@@ -221,7 +225,7 @@ static int udp_upload(int sock, int port,
 		hdr->flags = 0;
 		hdr->num_of_threads = htonl(1);
 		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
+		hdr->buffer_len = SAMPLE_PACKET_SIZE -
 			sizeof(*datagram) - sizeof(*hdr);
 		hdr->bandwidth = htonl(rate_in_kbps);
 		hdr->num_of_bytes = htonl(packet_size);
@@ -267,8 +271,8 @@ static int udp_upload(int sock, int port,
 	} else {
 		return -EINVAL;
 	}
-	ret = zperf_upload_fin(sock, nb_packets, end_time, packet_size,
-			       results, is_mcast_pkt);
+	ret = zperf_upload_fin(sock, sample_packet, nb_packets, end_time,
+			       packet_size, results, is_mcast_pkt);
 	if (ret < 0) {
 		return ret;
 	}
@@ -282,18 +286,14 @@ static int udp_upload(int sock, int port,
 	return 0;
 }
 
-int zperf_udp_upload(const struct zperf_upload_params *param,
-		     struct zperf_results *result)
+static int udp_upload_stream(const struct zperf_upload_params *param,
+			     int stream, struct zperf_results *result)
 {
 	int port = 0;
 	int sock;
 	int ret;
 	struct ifreq req;
 
-	if (param == NULL || result == NULL) {
-		return -EINVAL;
-	}
-
 	if (param->peer_addr.sa_family == AF_INET) {
 		port = ntohs(net_sin(&param->peer_addr)->sin_port);
 	} else if (param->peer_addr.sa_family == AF_INET6) {
@@ -321,13 +321,23 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 		}
 	}
 
-	ret = udp_upload(sock, port, param, result);
+	ret = udp_upload(sock, port, sample_packets[stream], param, result);
 
 	zsock_close(sock);
 
 	return ret;
 }
 
+int zperf_udp_upload(const struct zperf_upload_params *param,
+		     struct zperf_results *result)
+{
+	if (param == NULL || result == NULL) {
+		return -EINVAL;
+	}
+
+	return zperf_upload_streams(param, udp_upload_stream, result);
+}
+
 static void udp_upload_async_work(struct k_work *work)
 {
 	struct zperf_async_upload_context *upload_ctx =
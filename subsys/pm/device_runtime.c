@@ -7,7 +7,9 @@
 
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/atomic.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(pm_device, CONFIG_PM_DEVICE_LOG_LEVEL);
@@ -129,6 +131,32 @@ static void runtime_suspend_work(struct k_work *work)
 	__ASSERT(ret == 0, "Could not suspend device (%d)", ret);
 }
 
+/* Runs the resume action of a device, recording its latency. Called with the
+ * device locked.
+ */
+static int runtime_resume_action(const struct device *dev, struct pm_device_base *pm)
+{
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	uint32_t start = k_cycle_get_32();
+	uint32_t cyc;
+#endif
+	int ret;
+
+	ret = pm->action_cb(dev, PM_DEVICE_ACTION_RESUME);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	if (ret == 0) {
+		cyc = k_cycle_get_32() - start;
+		pm->stats.resume_count++;
+		pm->stats.resume_last_cyc = cyc;
+		pm->stats.resume_max_cyc = MAX(pm->stats.resume_max_cyc, cyc);
+		pm->stats.resume_total_cyc += cyc;
+	}
+#endif
+
+	return ret;
+}
+
 static int get_sync_locked(const struct device *dev)
 {
 	int ret;
@@ -149,7 +177,7 @@ static int get_sync_locked(const struct device *dev)
 			}
 		}
 
-		ret = pm->base.action_cb(dev, PM_DEVICE_ACTION_RESUME);
+		ret = runtime_resume_action(dev, &pm->base);
 		if (ret < 0) {
 			return ret;
 		}
@@ -255,7 +283,7 @@ int pm_device_runtime_get(const struct device *dev)
 		goto unlock;
 	}
 
-	ret = pm->base.action_cb(pm->dev, PM_DEVICE_ACTION_RESUME);
+	ret = runtime_resume_action(pm->dev, &pm->base);
 	if (ret < 0) {
 		pm->base.usage--;
 		goto unlock;
@@ -585,3 +613,203 @@ int pm_device_runtime_usage(const struct device *dev)
 
 	return usage;
 }
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+int pm_device_runtime_stats_get(const struct device *dev,
+				struct pm_device_runtime_stats *stats)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (dev->pm_base == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (atomic_test_bit(&dev->pm_base->flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		struct pm_device_isr *pm_sync = dev->pm_isr;
+		k_spinlock_key_t k = k_spin_lock(&pm_sync->lock);
+
+		*stats = pm_sync->base.stats;
+
+		k_spin_unlock(&pm_sync->lock, k);
+	} else {
+		(void)k_sem_take(&pm->lock, K_FOREVER);
+		*stats = pm->base.stats;
+		k_sem_give(&pm->lock);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_STATS */
+
+BUILD_ASSERT(PM_DEVICE_RUNTIME_BATCH_MAX <= ATOMIC_BITS);
+
+/* A batched transition. Devices are claimed by index, so that the caller and
+ * the helper threads each process the next device not yet taken.
+ */
+struct runtime_batch {
+	const struct device *const *devs;
+	size_t count;
+	bool get;
+	atomic_t next;
+	/* Devices whose transition succeeded */
+	atomic_t ok;
+	/* Error of the first device that failed */
+	atomic_t err;
+#if CONFIG_PM_DEVICE_RUNTIME_BATCH_THREADS > 0
+	struct k_sem finished;
+#endif
+};
+
+static void runtime_batch_run(struct runtime_batch *batch)
+{
+	atomic_val_t i;
+	int ret;
+
+	while ((i = atomic_inc(&batch->next)) < (atomic_val_t)batch->count) {
+		if (batch->get) {
+			ret = pm_device_runtime_get(batch->devs[i]);
+		} else {
+			ret = pm_device_runtime_put(batch->devs[i]);
+		}
+
+		if (ret < 0) {
+			(void)atomic_cas(&batch->err, 0, ret);
+		} else {
+			atomic_set_bit(&batch->ok, i);
+		}
+	}
+}
+
+#if CONFIG_PM_DEVICE_RUNTIME_BATCH_THREADS > 0
+#define BATCH_THREADS CONFIG_PM_DEVICE_RUNTIME_BATCH_THREADS
+
+static K_THREAD_STACK_ARRAY_DEFINE(batch_stacks, BATCH_THREADS,
+				   CONFIG_PM_DEVICE_RUNTIME_BATCH_STACK_SIZE);
+static struct k_work_q batch_workq[BATCH_THREADS];
+static struct k_work batch_work[BATCH_THREADS];
+/* Owned by the batch being processed in parallel */
+static K_MUTEX_DEFINE(batch_lock);
+static struct runtime_batch *batch_current;
+
+static void runtime_batch_work(struct k_work *work)
+{
+	struct runtime_batch *batch = batch_current;
+
+	ARG_UNUSED(work);
+
+	runtime_batch_run(batch);
+	k_sem_give(&batch->finished);
+}
+
+/* Hands the batch to the helper threads, returns how many were started. A
+ * batch started while another one is in progress, e.g. from a PM action
+ * callback, is processed by its caller alone.
+ */
+static size_t runtime_batch_start(struct runtime_batch *batch)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	size_t helpers;
+
+	if (k_is_pre_kernel() || k_is_in_isr() || (batch->count < 2U) ||
+	    (k_mutex_lock(&batch_lock, K_NO_WAIT) != 0)) {
+		return 0;
+	}
+
+	helpers = MIN(batch->count - 1U, BATCH_THREADS);
+	k_sem_init(&batch->finished, 0, helpers);
+	batch_current = batch;
+
+	for (size_t i = 0; i < helpers; i++) {
+		k_thread_priority_set(&batch_workq[i].thread, prio);
+		(void)k_work_submit_to_queue(&batch_workq[i], &batch_work[i]);
+	}
+
+	return helpers;
+}
+
+static void runtime_batch_wait(struct runtime_batch *batch, size_t helpers)
+{
+	if (helpers == 0U) {
+		return;
+	}
+
+	for (size_t i = 0; i < helpers; i++) {
+		(void)k_sem_take(&batch->finished, K_FOREVER);
+	}
+
+	batch_current = NULL;
+	k_mutex_unlock(&batch_lock);
+}
+
+static int runtime_batch_init(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "pm_batch",
+	};
+
+	for (size_t i = 0; i < BATCH_THREADS; i++) {
+		k_work_init(&batch_work[i], runtime_batch_work);
+		k_work_queue_start(&batch_workq[i], batch_stacks[i],
+				   K_THREAD_STACK_SIZEOF(batch_stacks[i]),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+	}
+
+	return 0;
+}
+
+SYS_INIT(runtime_batch_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline size_t runtime_batch_start(struct runtime_batch *batch)
+{
+	ARG_UNUSED(batch);
+
+	return 0;
+}
+
+static inline void runtime_batch_wait(struct runtime_batch *batch, size_t helpers)
+{
+	ARG_UNUSED(batch);
+	ARG_UNUSED(helpers);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_BATCH_THREADS > 0 */
+
+static int runtime_batch(const struct device *const *devs, size_t count, bool get)
+{
+	struct runtime_batch batch = {
+		.devs = devs,
+		.count = count,
+		.get = get,
+	};
+	size_t helpers;
+	int ret;
+
+	if (count > PM_DEVICE_RUNTIME_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	helpers = runtime_batch_start(&batch);
+	runtime_batch_run(&batch);
+	runtime_batch_wait(&batch, helpers);
+
+	ret = (int)atomic_get(&batch.err);
+	if ((ret < 0) && get) {
+		/* Leave the group as it was */
+		for (size_t i = 0; i < count; i++) {
+			if (atomic_test_bit(&batch.ok, i)) {
+				(void)pm_device_runtime_put(devs[i]);
+			}
+		}
+	}
+
+	return ret;
+}
+
+int pm_device_runtime_get_batch(const struct device *const *devs, size_t count)
+{
+	return runtime_batch(devs, count, true);
+}
+
+int pm_device_runtime_put_batch(const struct device *const *devs, size_t count)
+{
+	return runtime_batch(devs, count, false);
+}
@@ -18,6 +18,7 @@
 #include <zephyr/tracing/tracing.h>
 
 #include "pm_stats.h"
+#include "policy/policy_predictive.h"
 #include "device_system_managed.h"
 
 #include <zephyr/logging/log.h>
@@ -217,14 +218,16 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	 */
 	k_sched_lock();
 	pm_stats_start();
+	pm_policy_predictive_idle_enter();
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
 	pm_state_set(z_cpus_pm_state[id].state, z_cpus_pm_state[id].substate_id);
 	pm_stats_stop();
+	pm_policy_predictive_idle_exit();
 
 	/* Wake up sequence starts here */
-	pm_stats_update(z_cpus_pm_state[id].state);
+	pm_stats_update(&z_cpus_pm_state[id]);
 	pm_system_resume();
 	k_sched_unlock();
 	SYS_PORT_TRACING_FUNC_EXIT(pm, system_suspend, ticks,
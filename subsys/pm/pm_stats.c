@@ -16,12 +16,14 @@ STATS_SECT_START(pm_stats)
 STATS_SECT_ENTRY32(state_count)
 STATS_SECT_ENTRY32(state_last_cycles)
 STATS_SECT_ENTRY32(state_total_cycles)
+STATS_SECT_ENTRY32(state_short_count)
 STATS_SECT_END;
 
 STATS_NAME_START(pm_stats)
 STATS_NAME(pm_stats, state_count)
 STATS_NAME(pm_stats, state_last_cycles)
 STATS_NAME(pm_stats, state_total_cycles)
+STATS_NAME(pm_stats, state_short_count)
 STATS_NAME_END(pm_stats);
 
 static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
@@ -40,7 +42,7 @@ static int pm_stats_init(void)
 		for (uint8_t j = 0U; j < PM_STATE_COUNT; j++) {
 			snprintk(names[i][j], PM_STAT_NAME_LEN,
 				 "pm_cpu_%03d_state_%1d_stats", i, j);
-			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 3U,
+			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 4U,
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
@@ -61,12 +63,18 @@ void pm_stats_stop(void)
 	time_stop[_current_cpu->id] = k_cycle_get_32();
 }
 
-void pm_stats_update(enum pm_state state)
+void pm_stats_update(const struct pm_state_info *info)
 {
 	uint8_t cpu = _current_cpu->id;
+	enum pm_state state = info->state;
 	uint32_t time_total = time_stop[cpu] - time_start[cpu];
 
 	STATS_INC(stats[cpu][state], state_count);
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
+
+	/* Left before the minimum residency: the entry cost more than it saved */
+	if (time_total < k_us_to_cyc_ceil32(info->min_residency_us)) {
+		STATS_INC(stats[cpu][state], state_short_count);
+	}
 }
@@ -13,11 +13,11 @@
 #ifdef CONFIG_PM_STATS
 void pm_stats_start(void);
 void pm_stats_stop(void);
-void pm_stats_update(enum pm_state state);
+void pm_stats_update(const struct pm_state_info *info);
 #else
 static inline void pm_stats_start(void) {}
 static inline void pm_stats_stop(void) {}
-static inline void pm_stats_update(enum pm_state state) {}
+static inline void pm_stats_update(const struct pm_state_info *info) {}
 #endif /* CONFIG_PM_STATS */
 
 #endif /* ZEPHYR_SUBSYS_PM_PM_STATS_H_ */
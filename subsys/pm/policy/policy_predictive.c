@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/pm/policy.h>
+#include <zephyr/sys_clock.h>
+#include <zephyr/pm/device.h>
+
+#include "policy_predictive.h"
+
+extern struct pm_policy_event *next_event;
+extern int32_t max_latency_cyc;
+
+/* Longest idle duration recorded, keeps the variance computation in 64 bits */
+#define IDLE_MAX_US 0xFFFFFFU
+
+/* Variance below which the durations are consistent whatever their average */
+#define IDLE_VARIANCE_MAX_US2 400U
+
+#define HISTORY_LEN CONFIG_PM_POLICY_PREDICTIVE_HISTORY
+
+/* Recent actual idle durations of a CPU */
+struct idle_history {
+	uint32_t idle_us[HISTORY_LEN];
+	uint8_t next;
+	uint8_t count;
+};
+
+static struct idle_history histories[CONFIG_MP_MAX_NUM_CPUS];
+static uint32_t idle_start[CONFIG_MP_MAX_NUM_CPUS];
+
+void pm_policy_predictive_record(uint8_t cpu, uint32_t idle_us)
+{
+	struct idle_history *h = &histories[cpu];
+
+	h->idle_us[h->next] = MIN(idle_us, IDLE_MAX_US);
+	h->next = (h->next + 1U) % HISTORY_LEN;
+	if (h->count < HISTORY_LEN) {
+		h->count++;
+	}
+}
+
+void pm_policy_predictive_idle_enter(void)
+{
+	idle_start[_current_cpu->id] = k_cycle_get_32();
+}
+
+void pm_policy_predictive_idle_exit(void)
+{
+	uint8_t cpu = _current_cpu->id;
+
+	pm_policy_predictive_record(cpu, k_cyc_to_us_floor32(k_cycle_get_32() - idle_start[cpu]));
+}
+
+/*
+ * Typical idle duration of a CPU, as done by the Linux menu governor: the
+ * average of the recent durations if they are consistent, i.e. if their
+ * standard deviation is below a sixth of the average. Otherwise the longest
+ * durations are discarded as outliers, up to half of the history, and the
+ * check is repeated. Returns -1 when there is no typical duration.
+ */
+static int64_t predicted_idle_us(uint8_t cpu)
+{
+	const struct idle_history *h = &histories[cpu];
+	uint32_t thresh = UINT32_MAX;
+
+	if (h->count < HISTORY_LEN) {
+		return -1;
+	}
+
+	for (uint8_t iter = 0U; iter < HISTORY_LEN / 2U; iter++) {
+		uint64_t sum = 0U, variance = 0U, avg;
+		uint32_t max = 0U;
+		uint8_t n = 0U;
+
+		for (uint8_t i = 0U; i < HISTORY_LEN; i++) {
+			if (h->idle_us[i] <= thresh) {
+				sum += h->idle_us[i];
+				max = MAX(max, h->idle_us[i]);
+				n++;
+			}
+		}
+
+		if (n < HISTORY_LEN / 2U) {
+			break;
+		}
+
+		avg = sum / n;
+
+		for (uint8_t i = 0U; i < HISTORY_LEN; i++) {
+			if (h->idle_us[i] <= thresh) {
+				int64_t diff = (int64_t)h->idle_us[i] - (int64_t)avg;
+
+				variance += (uint64_t)(diff * diff);
+			}
+		}
+
+		variance /= n;
+
+		if ((variance <= IDLE_VARIANCE_MAX_US2) || ((variance * 36U) <= (avg * avg))) {
+			return (int64_t)avg;
+		}
+
+		thresh = max - 1U;
+	}
+
+	return -1;
+}
+
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	const struct pm_state_info *fallback = NULL;
+	int64_t cyc = -1, predicted_cyc = -1, predicted_us;
+	uint8_t num_cpu_states;
+	const struct pm_state_info *cpu_states;
+
+#ifdef CONFIG_PM_NEED_ALL_DEVICES_IDLE
+	if (pm_device_is_any_busy()) {
+		return NULL;
+	}
+#endif
+
+	if (ticks != K_TICKS_FOREVER) {
+		cyc = k_ticks_to_cyc_ceil32(ticks);
+	}
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
+	if ((next_event) && (next_event->value_cyc >= 0)) {
+		uint32_t cyc_curr = k_cycle_get_32();
+		int64_t cyc_evt = next_event->value_cyc - cyc_curr;
+
+		/* event happening after cycle counter max value, pad */
+		if (next_event->value_cyc <= cyc_curr) {
+			cyc_evt += UINT32_MAX;
+		}
+
+		if (cyc_evt > 0) {
+			/* if there's no system wakeup event always wins,
+			 * otherwise, who comes earlier wins
+			 */
+			if (cyc < 0) {
+				cyc = cyc_evt;
+			} else {
+				cyc = MIN(cyc, cyc_evt);
+			}
+		}
+	}
+
+	predicted_us = predicted_idle_us(cpu);
+	if (predicted_us >= 0) {
+		predicted_cyc = k_us_to_cyc_floor64(predicted_us);
+	}
+
+	for (int16_t i = (int16_t)num_cpu_states - 1; i >= 0; i--) {
+		const struct pm_state_info *state = &cpu_states[i];
+		uint32_t min_residency_cyc, exit_latency_cyc;
+
+		/* check if there is a lock on state + substate */
+		if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+			continue;
+		}
+
+		min_residency_cyc = k_us_to_cyc_ceil32(state->min_residency_us);
+		exit_latency_cyc = k_us_to_cyc_ceil32(state->exit_latency_us);
+
+		/* skip state if it brings too much latency */
+		if ((max_latency_cyc >= 0) &&
+		    (exit_latency_cyc >= max_latency_cyc)) {
+			continue;
+		}
+
+		/* skip state if the next wakeup comes too early */
+		if ((cyc >= 0) && (cyc < (min_residency_cyc + exit_latency_cyc))) {
+			continue;
+		}
+
+		if ((predicted_cyc < 0) ||
+		    (predicted_cyc >= (min_residency_cyc + exit_latency_cyc))) {
+			return state;
+		}
+
+		/* An early wakeup is expected: keep the shallowest state allowed by
+		 * the next wakeup, rather than staying active, so that the idle
+		 * durations keep being tracked.
+		 */
+		fallback = state;
+	}
+
+	return fallback;
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_PM_POLICY_POLICY_PREDICTIVE_H_
+#define ZEPHYR_SUBSYS_PM_POLICY_POLICY_PREDICTIVE_H_
+
+#include <stdint.h>
+
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+void pm_policy_predictive_idle_enter(void);
+void pm_policy_predictive_idle_exit(void);
+void pm_policy_predictive_record(uint8_t cpu, uint32_t idle_us);
+#else
+static inline void pm_policy_predictive_idle_enter(void) {}
+static inline void pm_policy_predictive_idle_exit(void) {}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
+#endif /* ZEPHYR_SUBSYS_PM_POLICY_POLICY_PREDICTIVE_H_ */
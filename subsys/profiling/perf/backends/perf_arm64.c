@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	extern uintptr_t __text_region_start, __text_region_end;
+
+	return (addr >= (uintptr_t)&__text_region_start) && (addr < (uintptr_t)&__text_region_end);
+}
+
+/*
+ * This function use frame pointers to unwind stack and get trace of return addresses.
+ * Return addresses are translated in corresponding function's names using .elf file.
+ * So we get function call trace
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 1U) {
+		return 0;
+	}
+
+	size_t idx = 0;
+
+	/*
+	 * In arm64 (arch/arm64/core/vector_table.S) z_arm64_enter_exc saves
+	 * elr, lr and fp on the thread stack, as specified by struct arch_esf.
+	 * Then, before calling the interrupt handler, _isr_wrapper
+	 * (arch/arm64/core/isr_wrapper.S) switches $sp to
+	 * _current_cpu->irq_stack and saves the old $sp with offset -16 on
+	 * the irq stack.
+	 *
+	 * The following lines do the reverse things to get elr and fp from
+	 * the thread stack.
+	 */
+	const struct arch_esf * const esf =
+		*((struct arch_esf **)(((uintptr_t)_current_cpu->irq_stack) - 16));
+
+	buf[idx++] = (uintptr_t)esf->elr;
+	void **fp = (void **)esf->fp;
+
+	/*
+	 * x29 is frame pointer, it points to the frame record.
+	 *
+	 * stack frame in memory:
+	 * (addresses growth up)
+	 *  ....
+	 *  x30 (lr)
+	 *  x29 (next) <- x29 (curr)
+	 *  ....
+	 *
+	 * Leaf functions keep the frame record too, as arm64 is built with
+	 * -mno-omit-leaf-frame-pointer when CONFIG_FRAME_POINTER is enabled.
+	 */
+	while (valid_stack((uintptr_t)fp, _current)) {
+		if (idx >= size) {
+			return 0;
+		}
+
+		if (!in_text_region((uintptr_t)fp[1])) {
+			break;
+		}
+
+		buf[idx++] = (uintptr_t)fp[1];
+		void **new_fp = (void **)fp[0];
+
+		/*
+		 * anti-infinity-loop if
+		 * new_fp can't be smaller than fp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if (new_fp <= fp) {
+			break;
+		}
+		fp = new_fp;
+	}
+
+	return idx;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <cmsis_core.h>
+
+static bool valid_stack(uintptr_t addr, k_tid_t current)
+{
+	return current->stack_info.start <= addr &&
+		addr < current->stack_info.start + current->stack_info.size;
+}
+
+static inline bool in_text_region(uintptr_t addr)
+{
+	extern uintptr_t __text_region_start, __text_region_end;
+
+	return (addr >= (uintptr_t)&__text_region_start) && (addr < (uintptr_t)&__text_region_end);
+}
+
+/*
+ * Check that addr looks like a return address: it is a Thumb code address
+ * in the text region, and the preceding instruction is a BL or a BLX.
+ */
+static bool is_return_address(uintptr_t addr)
+{
+	if ((addr & 1U) == 0U) {
+		return false;
+	}
+
+	addr &= ~1U;
+
+	if (!in_text_region(addr - 4U)) {
+		return false;
+	}
+
+	const uint16_t *insn = (const uint16_t *)addr;
+
+	/* BLX <Rm> */
+	if ((insn[-1] & 0xff87U) == 0x4780U) {
+		return true;
+	}
+
+	/* BL <label> */
+	return ((insn[-2] & 0xf800U) == 0xf000U) && ((insn[-1] & 0xd000U) == 0xd000U);
+}
+
+/*
+ * Code built by GCC for Thumb does not keep a usable frame pointer chain, so
+ * this function scans the thread stack for words that look like return
+ * addresses. Return addresses are translated in corresponding function's names
+ * using .elf file. Stale return addresses left on the stack may show up in the
+ * trace, so the result is a best effort call trace.
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	if (size < 2U) {
+		return 0;
+	}
+
+	size_t idx = 0;
+
+	/*
+	 * On exception entry the core pushes the basic stack frame (struct
+	 * __basic_sf) on the process stack. Threads run on the PSP and the
+	 * timer interrupt handler does not modify it, so the PSP still points
+	 * to the frame of the interrupted thread.
+	 */
+	const struct arch_esf * const esf = (const struct arch_esf *)__get_PSP();
+	uintptr_t *sp = (uintptr_t *)(&esf->basic + 1);
+
+	buf[idx++] = (uintptr_t)esf->basic.pc;
+
+	/*
+	 * $lr is the return address of leaf functions and of functions
+	 * interrupted in their prologue, which have not saved it yet.
+	 */
+	if (in_text_region(esf->basic.lr)) {
+		buf[idx++] = (uintptr_t)esf->basic.lr;
+	}
+
+	while (valid_stack((uintptr_t)sp, _current)) {
+		uintptr_t addr = *sp++;
+
+		if (!is_return_address(addr) || addr == buf[idx - 1]) {
+			continue;
+		}
+
+		if (idx >= size) {
+			return 0;
+		}
+
+		buf[idx++] = addr;
+	}
+
+	return idx;
+}
@@ -10,6 +10,7 @@
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_uart.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -70,9 +71,141 @@ static void perf_dwork_handler(struct k_work *work)
 	}
 }
 
+#ifdef CONFIG_PROFILING_PERF_STREAM
+struct perf_stream_t {
+	struct k_timer timer;
+
+	const struct shell *sh;
+
+	struct k_work_delayable dwork;
+
+	struct ring_buf *rb;
+	uintptr_t trace[CONFIG_PROFILING_PERF_STREAM_MAX_DEPTH + 1];
+	uintptr_t out[CONFIG_PROFILING_PERF_STREAM_MAX_DEPTH];
+	char line[sizeof("perf") + CONFIG_PROFILING_PERF_STREAM_MAX_DEPTH *
+		  (2 * sizeof(uintptr_t) + 1)];
+	atomic_t dropped;
+	bool running;
+};
+
+RING_BUF_DECLARE(perf_stream_rb,
+		 CONFIG_PROFILING_PERF_STREAM_BUFFER_SIZE * sizeof(uintptr_t));
+
+static void perf_stream_tracer(struct k_timer *timer);
+static void perf_stream_dwork_handler(struct k_work *work);
+static struct perf_stream_t perf_stream = {
+	.timer = Z_TIMER_INITIALIZER(perf_stream.timer, perf_stream_tracer, NULL),
+	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_stream_dwork_handler),
+	.rb = &perf_stream_rb,
+};
+
+static void perf_stream_tracer(struct k_timer *timer)
+{
+	struct perf_stream_t *stream = (struct perf_stream_t *)k_timer_user_data_get(timer);
+	size_t trace_length;
+	uint32_t size;
+
+	trace_length = arch_perf_current_stack_trace(stream->trace + 1,
+						     CONFIG_PROFILING_PERF_STREAM_MAX_DEPTH);
+	size = (trace_length + 1) * sizeof(uintptr_t);
+
+	/* The timer ISR is the only writer, the work handler the only reader. */
+	if (trace_length == 0 || ring_buf_space_get(stream->rb) < size) {
+		atomic_inc(&stream->dropped);
+		return;
+	}
+
+	stream->trace[0] = trace_length;
+	(void)ring_buf_put(stream->rb, (uint8_t *)stream->trace, size);
+}
+
+static void perf_stream_dwork_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct perf_stream_t *stream = CONTAINER_OF(dwork, struct perf_stream_t, dwork);
+	uintptr_t trace_length;
+	atomic_val_t dropped;
+
+	while (ring_buf_get(stream->rb, (uint8_t *)&trace_length,
+			    sizeof(trace_length)) == sizeof(trace_length)) {
+		(void)ring_buf_get(stream->rb, (uint8_t *)stream->out,
+				   trace_length * sizeof(uintptr_t));
+
+		size_t len = snprintf(stream->line, sizeof(stream->line), "perf");
+
+		for (size_t i = 0; i < trace_length; i++) {
+			len += snprintf(stream->line + len, sizeof(stream->line) - len,
+					" %lx", stream->out[i]);
+		}
+		shell_print(stream->sh, "%s", stream->line);
+	}
+
+	dropped = atomic_clear(&stream->dropped);
+	if (dropped != 0) {
+		shell_warn(stream->sh, "Perf dropped %ld samples", (long)dropped);
+	}
+
+	if (stream->running) {
+		k_work_schedule(dwork, K_MSEC(CONFIG_PROFILING_PERF_STREAM_PERIOD));
+	} else {
+		shell_print(stream->sh, "Perf stream done!");
+	}
+}
+
+static int cmd_perf_stream(const struct shell *sh, size_t argc, char **argv)
+{
+	if (perf_stream.running || k_work_delayable_is_pending(&perf_data.dwork)) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+	k_timeout_t period = K_NSEC(1000000000 / strtoll(argv[1], NULL, 10));
+
+	perf_stream.sh = sh;
+	perf_stream.running = true;
+	atomic_clear(&perf_stream.dropped);
+	ring_buf_reset(perf_stream.rb);
+
+	k_timer_user_data_set(&perf_stream.timer, &perf_stream);
+	k_timer_start(&perf_stream.timer, K_NO_WAIT, period);
+
+	k_work_schedule(&perf_stream.dwork, K_MSEC(CONFIG_PROFILING_PERF_STREAM_PERIOD));
+
+	shell_print(sh, "Enabled perf stream");
+
+	return 0;
+}
+
+static int cmd_perf_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	if (!perf_stream.running) {
+		shell_warn(sh, "Perf stream is not running");
+		return -EALREADY;
+	}
+
+	k_timer_stop(&perf_stream.timer);
+	perf_stream.running = false;
+
+	/* Flush the remaining samples. */
+	k_work_reschedule(&perf_stream.dwork, K_NO_WAIT);
+
+	return 0;
+}
+
+static bool perf_stream_running(void)
+{
+	return perf_stream.running;
+}
+#else
+static bool perf_stream_running(void)
+{
+	return false;
+}
+#endif /* CONFIG_PROFILING_PERF_STREAM */
+
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_stream_running() || k_work_delayable_is_pending(&perf_data.dwork)) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
@@ -146,11 +279,19 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
 	"Usage: record <duration> <frequency>"
 
+#define CMD_HELP_STREAM                                                                            \
+	"Start streaming samples on <frequency> Hz until stopped\n"                                \
+	"Usage: stream <frequency>"
+
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
+#ifdef CONFIG_PROFILING_PERF_STREAM
+	SHELL_CMD_ARG(stream, NULL, CMD_HELP_STREAM, cmd_perf_stream, 2, 0),
+	SHELL_CMD_ARG(stop, NULL, "Stop streaming samples", cmd_perf_stop, 0, 0),
+#endif
 	SHELL_SUBCMD_SET_END
 );
 SHELL_CMD_ARG_REGISTER(perf, &m_sub_perf, "Lightweight profiler", NULL, 0, 0);
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_RANDOM_CSPRNG_BUFFER_H_
+#define ZEPHYR_SUBSYS_RANDOM_CSPRNG_BUFFER_H_
+
+#include <stddef.h>
+
+/*
+ * With the per-CPU buffers, sys_csrand_get() is implemented by
+ * random_csprng_buffer.c and the CSPRNG backend provides the generator
+ * filling the buffers instead.
+ */
+#ifdef CONFIG_CSPRNG_BUFFER
+#define CSPRNG_GENERATE z_csprng_generate
+
+int z_csprng_generate(void *dst, size_t outlen);
+#else
+#define CSPRNG_GENERATE z_impl_sys_csrand_get
+#endif
+
+#endif /* ZEPHYR_SUBSYS_RANDOM_CSPRNG_BUFFER_H_ */
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/spinlock.h>
+#include <string.h>
+
+#include "csprng_buffer.h"
+
+#define BUF_SIZE CONFIG_CSPRNG_BUFFER_SIZE
+
+/* Output of the generator not handed out yet, in data[0..avail). Bytes are
+ * served from the end and erased, so that none is ever handed out twice or
+ * kept once used.
+ */
+struct csprng_buf {
+	struct k_spinlock lock;
+	size_t avail;
+	uint8_t data[BUF_SIZE];
+};
+
+static struct csprng_buf csprng_bufs[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Only used by the refill work item, which never runs concurrently with
+ * itself.
+ */
+static uint8_t refill_block[BUF_SIZE];
+
+static void csprng_refill(struct k_work *work)
+{
+	struct csprng_buf *buf;
+	k_spinlock_key_t key;
+	size_t need;
+
+	ARG_UNUSED(work);
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		buf = &csprng_bufs[cpu];
+
+		key = k_spin_lock(&buf->lock);
+		need = BUF_SIZE - buf->avail;
+		k_spin_unlock(&buf->lock, key);
+
+		if (need < BUF_SIZE / 2) {
+			continue;
+		}
+
+		if (z_csprng_generate(refill_block, need) != 0) {
+			break;
+		}
+
+		/* The buffer can only have drained meanwhile */
+		key = k_spin_lock(&buf->lock);
+		memcpy(&buf->data[buf->avail], refill_block, need);
+		buf->avail += need;
+		k_spin_unlock(&buf->lock, key);
+
+		memset(refill_block, 0, need);
+	}
+}
+
+static K_WORK_DEFINE(csprng_refill_work, csprng_refill);
+
+/* The current CPU is only a hint, the thread may migrate before the buffer
+ * is locked and then uses the buffer of another CPU.
+ */
+int z_impl_sys_csrand_get(void *dst, size_t outlen)
+{
+	struct csprng_buf *buf = &csprng_bufs[arch_curr_cpu()->id];
+	k_spinlock_key_t key;
+	bool served = false;
+	bool low;
+
+	key = k_spin_lock(&buf->lock);
+
+	if (outlen <= buf->avail) {
+		buf->avail -= outlen;
+		memcpy(dst, &buf->data[buf->avail], outlen);
+		memset(&buf->data[buf->avail], 0, outlen);
+		served = true;
+	}
+
+	low = buf->avail < BUF_SIZE / 2;
+
+	k_spin_unlock(&buf->lock, key);
+
+	if (low && !k_is_pre_kernel()) {
+		(void)k_work_submit(&csprng_refill_work);
+	}
+
+	if (served) {
+		return 0;
+	}
+
+	/* Large requests, and small ones while the buffer refills, are
+	 * served by the generator directly.
+	 */
+	return z_csprng_generate(dst, outlen);
+}
@@ -10,6 +10,8 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 
+#include "csprng_buffer.h"
+
 #if defined(CONFIG_MBEDTLS)
 #if !defined(CONFIG_MBEDTLS_CFG_FILE)
 #include "mbedtls/config.h"
@@ -103,7 +105,7 @@ static int ctr_drbg_initialize(void)
 }
 
 
-int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
+int CSPRNG_GENERATE(void *dst, size_t outlen)
 {
 	int ret;
 
@@ -9,6 +9,8 @@
 #include <zephyr/drivers/entropy.h>
 #include <string.h>
 
+#include "csprng_buffer.h"
+
 static const struct device *const entropy_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
 
@@ -65,7 +67,7 @@ void z_impl_sys_rand_get(void *dst, size_t outlen)
 
 #if defined(CONFIG_HARDWARE_DEVICE_CS_GENERATOR)
 
-int z_impl_sys_csrand_get(void *dst, size_t outlen)
+int CSPRNG_GENERATE(void *dst, size_t outlen)
 {
 	if (rand_get(dst, outlen, true) != 0) {
 		/* Is it the only error it should return ? entropy_sam
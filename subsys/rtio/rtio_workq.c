@@ -6,15 +6,63 @@
 
 #include <zephyr/rtio/work.h>
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 
 #define RTIO_WORKQ_PRIO_MED		CONFIG_RTIO_WORKQ_PRIO_MED
 #define RTIO_WORKQ_PRIO_HIGH		RTIO_WORKQ_PRIO_MED - 1
 #define RTIO_WORKQ_PRIO_LOW		RTIO_WORKQ_PRIO_MED + 1
 
+#ifdef CONFIG_RTIO_WORKQ_PER_CPU
+#define RTIO_WORKQ_NUM			CONFIG_MP_MAX_NUM_CPUS
+
+static struct k_p4wq rtio_workq[RTIO_WORKQ_NUM];
+static struct k_thread rtio_workq_threads[RTIO_WORKQ_NUM];
+static K_THREAD_STACK_ARRAY_DEFINE(rtio_workq_stacks, RTIO_WORKQ_NUM,
+				   CONFIG_RTIO_WORKQ_STACK_SIZE);
+
+static int rtio_workq_init(void)
+{
+	for (int i = 0; i < RTIO_WORKQ_NUM; i++) {
+		k_p4wq_init(&rtio_workq[i]);
+	}
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	k_p4wq_enable_stealing(rtio_workq, RTIO_WORKQ_NUM);
+#endif
+
+	for (int i = 0; i < RTIO_WORKQ_NUM; i++) {
+		/* Threads are pinned before they start */
+		rtio_workq[i].flags = K_P4WQ_DELAYED_START;
+		k_p4wq_add_thread(&rtio_workq[i], &rtio_workq_threads[i],
+				  rtio_workq_stacks[i],
+				  K_THREAD_STACK_SIZEOF(rtio_workq_stacks[i]));
+		(void)k_thread_cpu_pin(&rtio_workq_threads[i], i);
+		k_thread_start(&rtio_workq_threads[i]);
+	}
+
+	return 0;
+}
+
+SYS_INIT(rtio_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+/* Requests run on the queue of the submitting CPU. Being migrated right
+ * after reading the CPU id only costs locality.
+ */
+static inline struct k_p4wq *rtio_workq_get(void)
+{
+	return &rtio_workq[arch_curr_cpu()->id];
+}
+#else
 K_P4WQ_DEFINE(rtio_workq,
 	      CONFIG_RTIO_WORKQ_THREADS_POOL,
 	      CONFIG_RTIO_WORKQ_STACK_SIZE);
 
+static inline struct k_p4wq *rtio_workq_get(void)
+{
+	return &rtio_workq;
+}
+#endif /* CONFIG_RTIO_WORKQ_PER_CPU */
+
 K_MEM_SLAB_DEFINE_STATIC(rtio_work_items_slab,
 			 sizeof(struct rtio_work_req),
 			 CONFIG_RTIO_WORKQ_POOL_ITEMS,
@@ -85,7 +133,7 @@ void rtio_work_req_submit(struct rtio_work_req *req,
 	}
 
 	/** Decoupling action: Let the P4WQ execute the action. */
-	k_p4wq_submit(&rtio_workq, work);
+	k_p4wq_submit(rtio_workq_get(), work);
 }
 
 uint32_t rtio_work_req_used_count_get(void)
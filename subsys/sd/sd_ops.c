@@ -222,6 +222,7 @@ static int sdmmc_spi_read_cxd(struct sd_card *card, uint32_t opcode, uint32_t *c
 	data.blocks = 1U;
 	data.data = cxd_be;
 	data.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+	data.flags = 0U;
 
 	ret = sdhc_request(card->sdhc, &cmd, &data);
 	if (ret) {
@@ -504,7 +505,8 @@ static int card_read(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 	 * commands. Therefore, we will not handle CMD12 or CMD23 at this layer.
 	 * The host SDHC driver is expected to recognize CMD17, CMD18, CMD24,
 	 * and CMD25 as special read/write commands and handle CMD23 and
-	 * CMD12 appropriately.
+	 * CMD12 appropriately. SDHC_DATA_BLOCK_COUNT tells the host that the
+	 * card accepts CMD23, so the transfer can use a predefined block count.
 	 */
 	cmd.opcode = (num_blocks == 1U) ? SD_READ_SINGLE_BLOCK : SD_READ_MULTIPLE_BLOCK;
 	if (!(card->flags & SD_HIGH_CAPACITY_FLAG)) {
@@ -522,6 +524,7 @@ static int card_read(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 	data.blocks = num_blocks;
 	data.data = rbuf;
 	data.timeout_ms = CONFIG_SD_DATA_TIMEOUT;
+	data.flags = (card->flags & SD_CMD23_FLAG) ? SDHC_DATA_BLOCK_COUNT : 0U;
 
 	LOG_DBG("READ: Sector = %u, Count = %u", start_block, num_blocks);
 
@@ -633,6 +636,7 @@ static int card_query_written(struct sd_card *card, uint32_t *num_written)
 	data.blocks = 1U;
 	data.data = blocks;
 	data.timeout_ms = CONFIG_SD_DATA_TIMEOUT;
+	data.flags = 0U;
 
 	ret = sdhc_request(card->sdhc, &cmd, &data);
 	if (ret) {
@@ -650,6 +654,35 @@ static int card_query_written(struct sd_card *card, uint32_t *num_written)
 	return 0;
 }
 
+#if CONFIG_SD_PRE_ERASE_BLOCKS > 0
+/*
+ * Sends ACMD23 so the card can erase the blocks of a multiple block write
+ * ahead of the transfer. It is only a hint, a failure is not an error.
+ */
+static void card_pre_erase(struct sd_card *card, uint32_t num_blocks)
+{
+	struct sdhc_command cmd;
+	int ret;
+
+	ret = card_app_command(card, card->relative_addr);
+	if (ret) {
+		LOG_DBG("App CMD for ACMD23 failed");
+		return;
+	}
+
+	cmd.opcode = SD_APP_SET_WRITE_BLK_ERASE_CNT;
+	cmd.arg = num_blocks & 0x7FFFFFU;
+	cmd.response_type = (SD_RSP_TYPE_R1 | SD_SPI_RSP_TYPE_R1);
+	cmd.retries = CONFIG_SD_CMD_RETRIES;
+	cmd.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+
+	ret = sdhc_request(card->sdhc, &cmd, NULL);
+	if (ret) {
+		LOG_DBG("ACMD23 failed: %d", ret);
+	}
+}
+#endif /* CONFIG_SD_PRE_ERASE_BLOCKS > 0 */
+
 static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
 		      uint32_t num_blocks)
 {
@@ -658,6 +691,13 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd;
 	struct sdhc_data data;
 
+#if CONFIG_SD_PRE_ERASE_BLOCKS > 0
+	if (card->type == CARD_SDMMC && num_blocks >= CONFIG_SD_PRE_ERASE_BLOCKS &&
+	    num_blocks > 1) {
+		card_pre_erase(card, num_blocks);
+	}
+#endif
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -678,6 +718,7 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	data.blocks = num_blocks;
 	data.data = (uint8_t *)wbuf;
 	data.timeout_ms = CONFIG_SD_DATA_TIMEOUT;
+	data.flags = (card->flags & SD_CMD23_FLAG) ? SDHC_DATA_BLOCK_COUNT : 0U;
 
 	LOG_DBG("WRITE: Sector = %u, Count = %u", start_block, num_blocks);
 
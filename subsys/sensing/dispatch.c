@@ -11,6 +11,79 @@
 
 LOG_MODULE_DECLARE(sensing, CONFIG_SENSING_LOG_LEVEL);
 
+#ifdef CONFIG_SENSING_DISPATCH_DATA_REFS
+/* References and length of the buffers in use, indexed by their first block */
+static atomic_t data_refs[CONFIG_SENSING_RTIO_BLOCK_COUNT];
+static uint32_t data_lens[CONFIG_SENSING_RTIO_BLOCK_COUNT];
+
+static int data_block_index(const void *buf)
+{
+	const uint8_t *pool = sensing_rtio_ctx.block_pool->buffer;
+	uint32_t blk_size = rtio_mempool_block_size(&sensing_rtio_ctx);
+	uintptr_t offset = (uintptr_t)buf - (uintptr_t)pool;
+
+	if ((const uint8_t *)buf < pool || offset % blk_size != 0 ||
+	    offset / blk_size >= ARRAY_SIZE(data_refs)) {
+		return -EINVAL;
+	}
+
+	return offset / blk_size;
+}
+
+int sensing_data_ref(const void *buf)
+{
+	int idx = data_block_index(buf);
+
+	if (idx < 0 || atomic_get(&data_refs[idx]) == 0) {
+		return -EINVAL;
+	}
+
+	atomic_inc(&data_refs[idx]);
+
+	return 0;
+}
+
+void sensing_data_unref(const void *buf)
+{
+	int idx = data_block_index(buf);
+
+	__ASSERT(idx >= 0 && atomic_get(&data_refs[idx]) > 0, "invalid sensor data buffer");
+
+	if (atomic_dec(&data_refs[idx]) == 1) {
+		rtio_release_buffer(&sensing_rtio_ctx, (void *)buf, data_lens[idx]);
+	}
+}
+
+/* The dispatcher holds a reference while the clients are called */
+static void dispatch_hold_data(uint8_t *data, uint32_t data_len)
+{
+	int idx = data_block_index(data);
+
+	__ASSERT_NO_MSG(idx >= 0);
+
+	data_lens[idx] = data_len;
+	atomic_set(&data_refs[idx], 1);
+}
+
+static void dispatch_release_data(uint8_t *data, uint32_t data_len)
+{
+	ARG_UNUSED(data_len);
+
+	sensing_data_unref(data);
+}
+#else
+static void dispatch_hold_data(uint8_t *data, uint32_t data_len)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(data_len);
+}
+
+static void dispatch_release_data(uint8_t *data, uint32_t data_len)
+{
+	rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
+}
+#endif /* CONFIG_SENSING_DISPATCH_DATA_REFS */
+
 /* check whether it is right time for client to consume this sample */
 static inline bool sensor_test_consume_time(struct sensing_sensor *sensor,
 				     struct sensing_connection *conn,
@@ -40,6 +113,8 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 {
 	struct sensing_sensor *client;
 	struct sensing_connection *conn;
+	/* All the clients see the same buffer at the same time */
+	uint64_t cur_time = get_us();
 
 	for_each_client_conn(sensor, conn) {
 		client = conn->sink;
@@ -53,7 +128,7 @@ static int send_data_to_clients(struct sensing_sensor *sensor,
 		 * true: it's time for client consuming the data
 		 * false: client time not arrived yet, not consume the data
 		 */
-		if (!sensor_test_consume_time(sensor, conn, get_us())) {
+		if (!sensor_test_consume_time(sensor, conn, cur_time)) {
 			continue;
 		}
 
@@ -108,6 +183,8 @@ static void dispatch_task(void *a, void *b, void *c)
 			continue;
 		}
 
+		dispatch_hold_data(data, data_len);
+
 		if ((uintptr_t)cqe.userdata >=
 			    (uintptr_t)STRUCT_SECTION_START(sensing_sensor) &&
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
@@ -116,7 +193,7 @@ static void dispatch_task(void *a, void *b, void *c)
 			send_data_to_clients(sensor, data);
 		}
 
-		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
+		dispatch_release_data(data, data_len);
 	}
 }
 
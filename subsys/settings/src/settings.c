@@ -25,6 +25,111 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+/* Hash table of the static handlers, keyed by their full name. A key is
+ * looked up by probing the table with each of its leading name segments.
+ */
+static struct {
+	uint32_t hash;
+	const struct settings_handler_static *ch;
+} settings_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static bool settings_index_ready;
+
+static uint32_t settings_index_hash(uint32_t hash, char c)
+{
+	return (hash ^ (uint8_t)c) * 16777619U;
+}
+
+static void settings_index_init(void)
+{
+	settings_index_ready = false;
+	memset(settings_index, 0, sizeof(settings_index));
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		uint32_t hash = 2166136261U;
+		size_t slot;
+		size_t i;
+
+		for (const char *c = ch->name; *c != '\0'; c++) {
+			hash = settings_index_hash(hash, *c);
+		}
+
+		slot = hash % ARRAY_SIZE(settings_index);
+		for (i = 0; i < ARRAY_SIZE(settings_index); i++) {
+			if (settings_index[slot].ch == NULL) {
+				break;
+			}
+
+			slot = (slot + 1) % ARRAY_SIZE(settings_index);
+		}
+
+		if (i == ARRAY_SIZE(settings_index)) {
+			LOG_WRN("Handler index too small, using linear lookup");
+			return;
+		}
+
+		settings_index[slot].hash = hash;
+		settings_index[slot].ch = ch;
+	}
+
+	settings_index_ready = true;
+}
+
+static struct settings_handler_static *settings_index_find(const char *name, size_t len,
+							  uint32_t hash)
+{
+	size_t slot = hash % ARRAY_SIZE(settings_index);
+
+	for (size_t i = 0; i < ARRAY_SIZE(settings_index); i++) {
+		const struct settings_handler_static *ch = settings_index[slot].ch;
+
+		if (ch == NULL) {
+			break;
+		}
+
+		if (settings_index[slot].hash == hash && strncmp(ch->name, name, len) == 0 &&
+		    ch->name[len] == '\0') {
+			return (struct settings_handler_static *)ch;
+		}
+
+		slot = (slot + 1) % ARRAY_SIZE(settings_index);
+	}
+
+	return NULL;
+}
+
+/* Returns the static handler with the longest name matching the key */
+static struct settings_handler_static *settings_index_lookup(const char *name,
+							    const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	uint32_t hash = 2166136261U;
+
+	for (size_t len = 0; ; len++) {
+		char c = name[len];
+		bool end = (c == '\0') || (c == SETTINGS_NAME_END);
+
+		if (end || (c == SETTINGS_NAME_SEPARATOR)) {
+			ch = settings_index_find(name, len, hash);
+			if (ch) {
+				bestmatch = ch;
+				if (next) {
+					*next = end ? NULL : &name[len + 1];
+				}
+			}
+		}
+
+		if (end) {
+			break;
+		}
+
+		hash = settings_index_hash(hash, c);
+	}
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 
 void settings_store_init(void);
 
@@ -33,6 +138,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	settings_index_init();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 	settings_store_init();
 }
 
@@ -142,16 +250,19 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
-struct settings_handler_static *settings_parse_and_lookup(const char *name,
-							const char **next)
+static struct settings_handler_static *settings_static_lookup(const char *name,
+							     const char **next)
 {
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
 
-	bestmatch = NULL;
-	if (next) {
-		*next = NULL;
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (settings_index_ready && name) {
+		return settings_index_lookup(name, next);
 	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
+	bestmatch = NULL;
 
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
@@ -172,8 +283,23 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		}
 	}
 
+	return bestmatch;
+}
+
+struct settings_handler_static *settings_parse_and_lookup(const char *name,
+							const char **next)
+{
+	struct settings_handler_static *bestmatch;
+
+	if (next) {
+		*next = NULL;
+	}
+
+	bestmatch = settings_static_lookup(name, next);
+
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	struct settings_handler *ch;
+	const char *tmpnext;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, ch, node) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
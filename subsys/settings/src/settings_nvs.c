@@ -155,6 +155,21 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * setting's value.
 		 */
 		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+
+		/* Skip the value of items outside the loaded subtree, dirty
+		 * entries are cleaned when everything is loaded.
+		 */
+		if ((rc1 > 0) && ((size_t)rc1 < sizeof(name)) && arg && arg->subtree) {
+			name[rc1] = '\0';
+			if (!settings_name_steq(name, arg->subtree, NULL)) {
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+				settings_nvs_cache_add(cf, name, name_id);
+				cached++;
+#endif
+				continue;
+			}
+		}
+
 		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
 			       &buf, sizeof(buf));
 
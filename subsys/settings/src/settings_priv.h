@@ -107,6 +107,11 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  uint8_t io_rwbs);
 
 
+#ifdef CONFIG_SETTINGS_TXN
+/* Complete a transaction commit interrupted by a reset, settings_lock must be held */
+void settings_txn_recover_locked(void);
+#endif
+
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
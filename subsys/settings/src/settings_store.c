@@ -54,6 +54,9 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#ifdef CONFIG_SETTINGS_TXN
+	settings_txn_recover_locked();
+#endif
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -81,6 +84,9 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#ifdef CONFIG_SETTINGS_TXN
+	settings_txn_recover_locked();
+#endif
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
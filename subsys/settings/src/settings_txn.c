@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/settings/settings.h>
+#include "settings_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+extern struct k_mutex settings_lock;
+
+/*
+ * Staged values are kept as a sequence of records:
+ *   name, '\0', value length (16-bit little endian), value
+ * The same buffer is saved as the journal before the values are written, so
+ * that an interrupted commit is completed on the next load.
+ */
+#define SETTINGS_TXN_JOURNAL ".txn"
+
+static uint8_t txn_buf[CONFIG_SETTINGS_TXN_BUF_SIZE];
+static size_t txn_len;
+static bool txn_active;
+
+static size_t settings_txn_record_len(const uint8_t *rec)
+{
+	size_t name_len = strlen((const char *)rec) + 1;
+
+	return name_len + sizeof(uint16_t) + sys_get_le16(&rec[name_len]);
+}
+
+/* Checks that the records fill exactly len bytes of buf */
+static bool settings_txn_valid(const uint8_t *buf, size_t len)
+{
+	size_t off = 0;
+
+	while (off < len) {
+		const uint8_t *end = memchr(&buf[off], '\0', len - off);
+
+		if (end == NULL || (size_t)(end - buf) + 1 + sizeof(uint16_t) > len) {
+			return false;
+		}
+
+		off += settings_txn_record_len(&buf[off]);
+	}
+
+	return off == len;
+}
+
+static void settings_txn_remove(const char *name)
+{
+	size_t off = 0;
+
+	while (off < txn_len) {
+		size_t rec_len = settings_txn_record_len(&txn_buf[off]);
+
+		if (strcmp((const char *)&txn_buf[off], name) == 0) {
+			memmove(&txn_buf[off], &txn_buf[off + rec_len],
+				txn_len - off - rec_len);
+			txn_len -= rec_len;
+			return;
+		}
+
+		off += rec_len;
+	}
+}
+
+/* Save the records of a journal to the store, settings_lock must be held */
+static int settings_txn_apply_locked(struct settings_store *cs, const uint8_t *buf,
+				     size_t len)
+{
+	size_t off = 0;
+	int rc = 0;
+	int rc2;
+
+	__ASSERT_NO_MSG(settings_lock.owner == k_current_get());
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	while (off < len) {
+		const char *name = (const char *)&buf[off];
+		size_t name_len = strlen(name) + 1;
+		uint16_t val_len = sys_get_le16(&buf[off + name_len]);
+		const uint8_t *value = &buf[off + name_len + sizeof(uint16_t)];
+
+		rc2 = cs->cs_itf->csi_save(cs, name, val_len ? (const char *)value : NULL,
+					   val_len);
+		if (!rc) {
+			rc = rc2;
+		}
+
+		off += name_len + sizeof(uint16_t) + val_len;
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		cs->cs_itf->csi_save_end(cs);
+	}
+
+	return rc;
+}
+
+int settings_txn_begin(void)
+{
+	int rc = 0;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (txn_active) {
+		rc = -EBUSY;
+	} else {
+		txn_active = true;
+		txn_len = 0;
+	}
+
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+int settings_txn_save(const char *name, const void *value, size_t val_len)
+{
+	size_t name_len = strlen(name) + 1;
+	int rc = 0;
+
+	if (val_len > UINT16_MAX || (val_len > 0 && value == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!txn_active) {
+		rc = -EINVAL;
+		goto unlock;
+	}
+
+	/* The last value staged for a name is the one written */
+	settings_txn_remove(name);
+
+	if (txn_len + name_len + sizeof(uint16_t) + val_len > sizeof(txn_buf)) {
+		rc = -ENOMEM;
+		goto unlock;
+	}
+
+	memcpy(&txn_buf[txn_len], name, name_len);
+	txn_len += name_len;
+	sys_put_le16(val_len, &txn_buf[txn_len]);
+	txn_len += sizeof(uint16_t);
+	if (val_len > 0) {
+		memcpy(&txn_buf[txn_len], value, val_len);
+		txn_len += val_len;
+	}
+
+unlock:
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+int settings_txn_delete(const char *name)
+{
+	return settings_txn_save(name, NULL, 0);
+}
+
+int settings_txn_commit(void)
+{
+	struct settings_store *cs;
+	bool journaled;
+	int rc;
+
+	cs = settings_save_dst;
+	if (!cs) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!txn_active) {
+		rc = -EINVAL;
+		goto unlock;
+	}
+
+	if (txn_len == 0) {
+		rc = 0;
+		goto done;
+	}
+
+	/* Back-ends write each record atomically, so a saved journal holds the
+	 * complete batch. Without it the values are still written, just not
+	 * atomically.
+	 */
+	rc = cs->cs_itf->csi_save(cs, SETTINGS_TXN_JOURNAL, (const char *)txn_buf, txn_len);
+	journaled = (rc == 0);
+	if (!journaled) {
+		LOG_WRN("Transaction journal not saved (err %d), commit is not atomic", rc);
+	}
+
+	rc = settings_txn_apply_locked(cs, txn_buf, txn_len);
+
+	if (!rc && journaled) {
+		rc = cs->cs_itf->csi_save(cs, SETTINGS_TXN_JOURNAL, NULL, 0);
+	}
+
+done:
+	txn_active = false;
+	txn_len = 0;
+
+unlock:
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+void settings_txn_abort(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	txn_active = false;
+	txn_len = 0;
+
+	k_mutex_unlock(&settings_lock);
+}
+
+static int settings_txn_journal_load(const char *key, size_t len, settings_read_cb read_cb,
+				     void *cb_arg, void *param)
+{
+	size_t *journal_len = param;
+	ssize_t rc;
+
+	if (key != NULL || len == 0) {
+		return 0;
+	}
+
+	if (len > sizeof(txn_buf)) {
+		LOG_ERR("Transaction journal too large (%zu)", len);
+		return 0;
+	}
+
+	rc = read_cb(cb_arg, txn_buf, len);
+	*journal_len = (rc == (ssize_t)len) ? len : 0;
+
+	return 0;
+}
+
+void settings_txn_recover_locked(void)
+{
+	struct settings_store *cs;
+	size_t journal_len = 0;
+	const struct settings_load_arg arg = {
+		.subtree = SETTINGS_TXN_JOURNAL,
+		.cb = settings_txn_journal_load,
+		.param = &journal_len,
+	};
+
+	__ASSERT_NO_MSG(settings_lock.owner == k_current_get());
+
+	if (txn_active || !settings_save_dst) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
+		cs->cs_itf->csi_load(cs, &arg);
+	}
+
+	if (journal_len == 0) {
+		return;
+	}
+
+	cs = settings_save_dst;
+
+	if (settings_txn_valid(txn_buf, journal_len)) {
+		LOG_INF("Completing interrupted transaction");
+		if (settings_txn_apply_locked(cs, txn_buf, journal_len)) {
+			/* Keep the journal to try again on the next load */
+			return;
+		}
+	} else {
+		LOG_ERR("Invalid transaction journal");
+	}
+
+	(void)cs->cs_itf->csi_save(cs, SETTINGS_TXN_JOURNAL, NULL, 0);
+}
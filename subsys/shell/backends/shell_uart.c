@@ -28,14 +28,57 @@ NET_BUF_POOL_DEFINE(smp_shell_rx_pool, CONFIG_MCUMGR_TRANSPORT_SHELL_RX_BUF_COUN
 		    SMP_SHELL_RX_BUF_SIZE, 0, NULL);
 #endif /* CONFIG_MCUMGR_TRANSPORT_SHELL */
 
+/* Start a transfer of the whole contiguous part of the TX ring buffer.
+ * Called with tx_busy set, clears it when there is nothing left to send.
+ */
+static void async_tx_start(struct shell_uart_async *sh_uart)
+{
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	do {
+		len = ring_buf_get_claim(&sh_uart->tx_ringbuf, &data,
+					 sh_uart->tx_ringbuf.size);
+		if (len > 0) {
+			sh_uart->tx_len = len;
+			err = uart_tx(sh_uart->common.dev, data, len, SYS_FOREVER_US);
+			if (err == 0) {
+				return;
+			}
+
+			/* Drop data the driver did not accept. */
+			LOG_WRN("TX failed (%d), %u bytes dropped", err, len);
+			(void)ring_buf_get_finish(&sh_uart->tx_ringbuf, len);
+			continue;
+		}
+
+		atomic_clear(&sh_uart->tx_busy);
+
+		/* Writer may have added data after the claim but before tx_busy
+		 * was cleared, in which case it did not start a transfer.
+		 */
+	} while (!ring_buf_is_empty(&sh_uart->tx_ringbuf) &&
+		 atomic_cas(&sh_uart->tx_busy, 0, 1));
+}
+
 static void async_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	struct shell_uart_async *sh_uart = (struct shell_uart_async *)user_data;
 
 	switch (evt->type) {
 	case  UART_TX_DONE:
-		k_sem_give(&sh_uart->tx_sem);
+	case  UART_TX_ABORTED:
+	{
+		int err = ring_buf_get_finish(&sh_uart->tx_ringbuf, sh_uart->tx_len);
+
+		__ASSERT_NO_MSG(err == 0);
+		ARG_UNUSED(err);
+
+		async_tx_start(sh_uart);
+		sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
 		break;
+	}
 	case  UART_RX_RDY:
 		uart_async_rx_on_rdy(&sh_uart->async_rx, evt->data.rx.buf, evt->data.rx.len);
 		sh_uart->common.handler(SHELL_TRANSPORT_EVT_RX_RDY, sh_uart->common.context);
@@ -243,7 +286,9 @@ static void async_init(struct shell_uart_async *sh_uart)
 		.buf_cnt = CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_BUFFER_COUNT,
 	};
 
-	k_sem_init(&sh_uart->tx_sem, 0, 1);
+	ring_buf_init(&sh_uart->tx_ringbuf, CONFIG_SHELL_BACKEND_SERIAL_TX_RING_BUFFER_SIZE,
+		      sh_uart->tx_buf);
+	sh_uart->tx_busy = 0;
 
 	err = uart_async_rx_init(async_rx, &sh_uart->async_rx_config);
 	(void)err;
@@ -387,20 +432,16 @@ static int irq_write(struct shell_uart_int_driven *sh_uart,
 static int async_write(struct shell_uart_async *sh_uart,
 		       const void *data, size_t length, size_t *cnt)
 {
-	int err;
+	/* Data written while a transfer is ongoing is sent with the next one.
+	 * When the buffer is full, the shell waits for TX_RDY before retrying.
+	 */
+	*cnt = ring_buf_put(&sh_uart->tx_ringbuf, data, length);
 
-	err = uart_tx(sh_uart->common.dev, data, length, SYS_FOREVER_US);
-	if (err < 0) {
-		*cnt = 0;
-		return err;
+	if (atomic_set(&sh_uart->tx_busy, 1) == 0) {
+		async_tx_start(sh_uart);
 	}
 
-	err = k_sem_take(&sh_uart->tx_sem, K_FOREVER);
-	*cnt = length;
-
-	sh_uart->common.handler(SHELL_TRANSPORT_EVT_TX_RDY, sh_uart->common.context);
-
-	return err;
+	return 0;
 }
 
 static int write_uart(const struct shell_transport *transport,
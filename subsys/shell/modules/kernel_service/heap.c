@@ -8,10 +8,14 @@
 #if K_HEAP_MEM_POOL_SIZE > 0
 #include "kernel_shell.h"
 
+#include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
 
-extern struct sys_heap _system_heap;
+extern struct k_heap _system_heap;
 
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 {
 	ARG_UNUSED(argc);
@@ -20,7 +24,7 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	int err;
 	struct sys_memory_stats stats;
 
-	err = sys_heap_runtime_stats_get(&_system_heap, &stats);
+	err = sys_heap_runtime_stats_get(&_system_heap.heap, &stats);
 	if (err) {
 		shell_error(sh, "Failed to read kernel system heap statistics (err %d)", err);
 		return -ENOEXEC;
@@ -32,7 +36,187 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 
 	return 0;
 }
+#else
+#define cmd_kernel_heap NULL
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
 
-KERNEL_CMD_ADD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap);
+#ifdef CONFIG_SYS_HEAP_PROFILE
+static struct sys_heap_profile profile;
+static struct sys_heap_profile snapshot;
+static bool profiling;
+
+static void profile_attach(struct sys_heap_profile *prof)
+{
+	K_SPINLOCK(&_system_heap.lock) {
+		sys_heap_profile_attach(&_system_heap.heap, prof);
+	}
+}
+
+/* Copy the profile and the fragmentation, consistent with each other */
+static int profile_snapshot(const struct shell *sh, struct sys_heap_frag_stats *frag)
+{
+	if (!profiling) {
+		shell_error(sh, "Profiling not started");
+		return -ENOEXEC;
+	}
+
+	K_SPINLOCK(&_system_heap.lock) {
+		snapshot = profile;
+		sys_heap_frag_stats_get(&_system_heap.heap, frag);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_heap_profile_start(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	profile_attach(&profile);
+	profiling = true;
+
+	shell_print(sh, "Profiling the system heap, 1 in %d allocations sampled",
+		    CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE);
+
+	return 0;
+}
+
+static int cmd_kernel_heap_profile_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	/* The results stay readable until the next start */
+	profile_attach(NULL);
+
+	return 0;
+}
+
+static int cmd_kernel_heap_profile_show(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct sys_heap_frag_stats frag;
+	int err = profile_snapshot(sh, &frag);
+
+	if (err != 0) {
+		return err;
+	}
+
+	shell_print(sh, "allocs: %u frees: %u failures: %u dropped samples: %u",
+		    snapshot.allocs, snapshot.frees, snapshot.failures, snapshot.dropped);
+	shell_print(sh, "free: %zu in %zu blocks, largest %zu",
+		    frag.free_bytes, frag.free_blocks, frag.largest_free_bytes);
+
+	shell_print(sh, "\nrequest size         allocs");
+	for (int i = 0; i < SYS_HEAP_PROFILE_SIZE_BUCKETS; i++) {
+		if (snapshot.size_hist[i] != 0U) {
+			shell_print(sh, "%10u+ %13u", 1U << i, snapshot.size_hist[i]);
+		}
+	}
+
+	shell_print(sh, "\nlifetime (ticks)    samples");
+	for (int i = 0; i < SYS_HEAP_PROFILE_LIFETIME_BUCKETS; i++) {
+		if (snapshot.lifetime_hist[i] != 0U) {
+			shell_print(sh, "%10u+ %13u", (i == 0) ? 0U : 1U << (i - 1),
+				    snapshot.lifetime_hist[i]);
+		}
+	}
+
+	shell_print(sh, "\ncall site          samples    frees      bytes       live       peak");
+	for (int i = 0; i < snapshot.nsites; i++) {
+		const struct sys_heap_profile_site *site = &snapshot.sites[i];
+
+		shell_print(sh, "0x%0*lx %8u %8u %10zu %10zu %10zu",
+			    (int)(2 * sizeof(uintptr_t)), (unsigned long)site->caller,
+			    site->allocs, site->frees, site->bytes, site->live_bytes,
+			    site->peak_live_bytes);
+	}
+
+	return 0;
+}
+
+struct export_line {
+	const struct shell *sh;
+	uint8_t buf[32];
+	size_t len;
+};
+
+static void export_flush(struct export_line *line)
+{
+	char hex[2 * sizeof(line->buf) + 1];
+
+	if (line->len != 0U) {
+		(void)bin2hex(line->buf, line->len, hex, sizeof(hex));
+		shell_print(line->sh, "%s", hex);
+		line->len = 0U;
+	}
+}
+
+static int export_cb(const uint8_t *data, size_t len, void *arg)
+{
+	struct export_line *line = arg;
+
+	while (len != 0U) {
+		size_t n = MIN(len, sizeof(line->buf) - line->len);
+
+		memcpy(&line->buf[line->len], data, n);
+		line->len += n;
+		data += n;
+		len -= n;
+
+		if (line->len == sizeof(line->buf)) {
+			export_flush(line);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_heap_profile_export(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct export_line line = {
+		.sh = sh,
+	};
+	struct sys_heap_frag_stats frag;
+	int err = profile_snapshot(sh, &frag);
+
+	if (err != 0) {
+		return err;
+	}
+
+	(void)sys_heap_profile_export(&snapshot, &frag, export_cb, &line);
+	export_flush(&line);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_heap_profile,
+	SHELL_CMD(start, NULL, "Start profiling, clearing previous results.",
+		  cmd_kernel_heap_profile_start),
+	SHELL_CMD(stop, NULL, "Stop profiling, keeping the results.",
+		  cmd_kernel_heap_profile_stop),
+	SHELL_CMD(show, NULL, "Show the profile.", cmd_kernel_heap_profile_show),
+	SHELL_CMD(export, NULL, "Export the profile in binary form, as hex.",
+		  cmd_kernel_heap_profile_export),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_heap,
+	SHELL_CMD(profile, &sub_kernel_heap_profile, "System heap allocation profile.", NULL),
+	SHELL_SUBCMD_SET_END
+);
+#define SUB_KERNEL_HEAP (&sub_kernel_heap)
+#else
+#define SUB_KERNEL_HEAP NULL
+#endif /* CONFIG_SYS_HEAP_PROFILE */
+
+KERNEL_CMD_ADD(heap, SUB_KERNEL_HEAP, "System heap usage statistics.", cmd_kernel_heap);
 
 #endif /* K_HEAP_MEM_POOL_SIZE > 0 */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/irq_stats.h>
+
+#define NUM_BUCKETS CONFIG_IRQ_STATS_BUCKETS
+
+static void irq_hist_dump(const struct shell *sh, const char *name, const uint32_t *hist)
+{
+	shell_print(sh, "\t%s:", name);
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		if (hist[i] == 0U) {
+			continue;
+		}
+
+		shell_print(sh, "\t%s%10u cycles: %u", (i == (NUM_BUCKETS - 1)) ? ">=" : "< ",
+			    (i == (NUM_BUCKETS - 1)) ? BIT(i) : BIT(i + 1), hist[i]);
+	}
+}
+
+static int cmd_kernel_irq(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct irq_stats stats;
+
+	for (unsigned int irq = 0; irq < IRQ_STATS_NUM_IRQS; irq++) {
+		if ((irq_stats_query(irq, &stats) != 0) || (stats.count == 0U)) {
+			continue;
+		}
+
+		shell_print(sh, "IRQ %u: %u calls, duration avg %u max %u cycles, "
+			    "peak latency %u cycles", irq, stats.count,
+			    (uint32_t)(stats.duration_total / stats.count), stats.duration_max,
+			    stats.latency_max);
+		irq_hist_dump(sh, "duration", stats.duration);
+		irq_hist_dump(sh, "latency", stats.latency);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_irq_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	if (argc > 1) {
+		char *end;
+		unsigned long irq = strtoul(argv[1], &end, 0);
+
+		if ((*end != '\0') || (irq_stats_reset(irq) != 0)) {
+			shell_error(sh, "Invalid IRQ: %s", argv[1]);
+			return -EINVAL;
+		}
+
+		return 0;
+	}
+
+	for (unsigned int irq = 0; irq < IRQ_STATS_NUM_IRQS; irq++) {
+		(void)irq_stats_reset(irq);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_irq,
+	SHELL_CMD_ARG(reset, NULL, "Reset the statistics of [irq], or of all IRQs.",
+		      cmd_kernel_irq_reset, 1, 1),
+	SHELL_SUBCMD_SET_END
+);
+
+KERNEL_CMD_ADD(irq, &sub_kernel_irq, "Interrupt handler duration and latency statistics.",
+	       cmd_kernel_irq);
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+#define NUM_BUCKETS CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS
+
+static void latency_hist_dump(const struct shell *sh, const k_thread_runtime_stats_t *stats)
+{
+	uint32_t total = 0U;
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		total += stats->wakeup_latency[i];
+	}
+
+	shell_print(sh, "\twakeups: %u, peak latency: %u cycles", total,
+		    stats->peak_wakeup_latency);
+
+	for (int i = 0; i < NUM_BUCKETS; i++) {
+		if (stats->wakeup_latency[i] == 0U) {
+			continue;
+		}
+
+		shell_print(sh, "\t%s%10u cycles: %u", (i == (NUM_BUCKETS - 1)) ? ">=" : "< ",
+			    (i == (NUM_BUCKETS - 1)) ? BIT(i) : BIT(i + 1),
+			    stats->wakeup_latency[i]);
+	}
+}
+
+static void shell_latency_dump(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %-10s", thread, tname ? tname : "NA");
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		shell_print(sh, "\t?");
+		return;
+	}
+
+	latency_hist_dump(sh, &stats);
+}
+
+static int cmd_kernel_thread_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+	k_thread_runtime_stats_t stats;
+
+	shell_print(sh, "Wakeup latency, from being made ready to running:");
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(shell_latency_dump, (void *)sh);
+
+	if (!IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)) {
+		return 0;
+	}
+
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (k_thread_runtime_stats_cpu_get(i, &stats) == 0) {
+			shell_print(sh, "CPU %d", i);
+			latency_hist_dump(sh, &stats);
+		}
+	}
+
+	return 0;
+}
+
+KERNEL_THREAD_CMD_ADD(latency, NULL, "List threads wakeup latency histograms.",
+		      cmd_kernel_thread_latency);
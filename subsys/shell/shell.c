@@ -336,6 +336,16 @@ static void find_completion_candidates(const struct shell *sh,
 	*longest = 0U;
 	*cnt = 0;
 
+	if ((cmd == NULL) &&
+	    z_shell_root_cmd_prefix_find(incompl_cmd, incompl_cmd_len, first_idx, cnt)) {
+		for (idx = *first_idx; idx < (*first_idx + *cnt); idx++) {
+			candidate = z_shell_cmd_get(NULL, idx, NULL);
+			*longest = Z_MAX(strlen(candidate->syntax), *longest);
+		}
+
+		return;
+	}
+
 	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
@@ -266,12 +266,73 @@ static inline uint32_t shell_root_cmd_count(void)
 	return len;
 }
 
+/* Root commands are placed in their section sorted by symbol name, which is
+ * derived from the command syntax, so the section is normally sorted by
+ * syntax. This is checked once, lookups fall back to a linear search if the
+ * linker did not sort the section.
+ */
+static bool root_cmds_sorted(void)
+{
+	static int sorted = -1;
+
+	if (sorted < 0) {
+		const size_t cmd_count = shell_root_cmd_count();
+		int res = 1;
+
+		for (size_t cmd_idx = 1; cmd_idx < cmd_count; ++cmd_idx) {
+			if (strcmp(shell_root_cmd_get(cmd_idx - 1)->entry->syntax,
+				   shell_root_cmd_get(cmd_idx)->entry->syntax) >= 0) {
+				res = 0;
+				break;
+			}
+		}
+
+		sorted = res;
+	}
+
+	return sorted == 1;
+}
+
+/* Index of the first root command which does not sort before @p str when
+ * comparing at most @p len characters.
+ */
+static size_t root_cmd_lower_bound(const char *str, size_t len)
+{
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strncmp(shell_root_cmd_get(mid)->entry->syntax, str, len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
 
+	if (root_cmds_sorted()) {
+		size_t cmd_idx = root_cmd_lower_bound(syntax, SIZE_MAX);
+
+		if (cmd_idx < cmd_count) {
+			cmd = shell_root_cmd_get(cmd_idx);
+			if (strcmp(syntax, cmd->entry->syntax) == 0) {
+				return cmd->entry;
+			}
+		}
+
+		return NULL;
+	}
+
 	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
@@ -282,6 +343,29 @@ const struct shell_static_entry *root_cmd_find(const char *syntax)
 	return NULL;
 }
 
+bool z_shell_root_cmd_prefix_find(const char *prefix, size_t len,
+				  size_t *first_idx, size_t *cnt)
+{
+	const size_t cmd_count = shell_root_cmd_count();
+	size_t cmd_idx;
+
+	if (!root_cmds_sorted()) {
+		return false;
+	}
+
+	cmd_idx = root_cmd_lower_bound(prefix, len);
+	*first_idx = cmd_idx;
+
+	while ((cmd_idx < cmd_count) &&
+	       (strncmp(shell_root_cmd_get(cmd_idx)->entry->syntax, prefix, len) == 0)) {
+		cmd_idx++;
+	}
+
+	*cnt = cmd_idx - *first_idx;
+
+	return true;
+}
+
 const struct shell_static_entry *z_shell_cmd_get(
 					const struct shell_static_entry *parent,
 					size_t idx,
@@ -343,16 +427,18 @@ const struct shell_static_entry *z_shell_find_cmd(
 	struct shell_static_entry parent_cpy;
 	size_t idx = 0;
 
+	if (parent == NULL) {
+		return root_cmd_find(cmd_str);
+	}
+
 	/* Dynamic command operates on shared memory. If we are processing two
 	 * dynamic commands at the same time (current and subcommand) they
 	 * will operate on the same memory region what can cause undefined
 	 * behaviour.
 	 * Hence we need a separate memory for each of them.
 	 */
-	if (parent) {
-		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
-		parent = &parent_cpy;
-	}
+	memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
+	parent = &parent_cpy;
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
 		if (strcmp(cmd_str, entry->syntax) == 0) {
@@ -83,6 +83,21 @@ void z_shell_cmd_trim(const struct shell *sh);
 
 const struct shell_static_entry *root_cmd_find(const char *syntax);
 
+/* @internal @brief Finds the range of root commands starting with a prefix.
+ *
+ * Uses a binary search over the sorted root commands.
+ *
+ * @param[in] prefix	Prefix to search for.
+ * @param[in] len	Length of the prefix.
+ * @param[out] first_idx	Index of the first matching root command.
+ * @param[out] cnt	Number of matching root commands.
+ *
+ * @return False if the root commands are not sorted, the caller must then
+ *	   search linearly.
+ */
+bool z_shell_root_cmd_prefix_find(const char *prefix, size_t len,
+				  size_t *first_idx, size_t *cnt);
+
 static inline void z_transport_buffer_flush(const struct shell *sh)
 {
 	z_shell_fprintf_buffer_flush(sh->fprintf_ctx);
@@ -8,10 +8,24 @@
 #include <stdio.h>
 #include <errno.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/stats/stats.h>
 
 #define STATS_GEN_NAME_MAX_LEN  (sizeof("s255"))
 
+#ifdef CONFIG_STATS_PER_CPU
+/* The entries of each CPU start on their own aligned boundary, see
+ * STATS_SECT_END.
+ */
+#define STATS_NUM_CPUS		CONFIG_MP_MAX_NUM_CPUS
+#define STATS_ENTRIES_OFF	ROUND_UP(sizeof(struct stats_hdr), K_PERCPU_ALIGN)
+#define STATS_CPU_STRIDE(hdr)	ROUND_UP((hdr)->s_size * (hdr)->s_cnt, K_PERCPU_ALIGN)
+#else
+#define STATS_NUM_CPUS		1
+#define STATS_ENTRIES_OFF	sizeof(struct stats_hdr)
+#define STATS_CPU_STRIDE(hdr)	0
+#endif
+
 /* The global list of registered statistic groups. */
 static struct stats_hdr *stats_list;
 
@@ -28,7 +42,7 @@ stats_get_name(const struct stats_hdr *hdr, int idx)
 	 * offset.  This annotation allows for naming only certain statistics,
 	 * and doesn't enforce ordering restrictions on the stats name map.
 	 */
-	off = sizeof(*hdr) + idx * hdr->s_size;
+	off = STATS_ENTRIES_OFF + idx * hdr->s_size;
 	for (i = 0; i < hdr->s_map_cnt; i++) {
 		cur = hdr->s_map + i;
 		if (cur->snm_off == off) {
@@ -43,7 +57,41 @@ stats_get_name(const struct stats_hdr *hdr, int idx)
 static uint16_t
 stats_get_off(const struct stats_hdr *hdr, int idx)
 {
-	return (uint16_t) (sizeof(*hdr) + idx * (int) hdr->s_size);
+	return (uint16_t) (STATS_ENTRIES_OFF + idx * (int) hdr->s_size);
+}
+
+/**
+ * Read a statistic entry, summing up the copies of all CPUs.
+ *
+ * @param hdr The header of the statistics section
+ * @param off The offset of the entry in the copy of the first CPU
+ *
+ * @return The value of the entry.
+ */
+uint64_t
+stats_get(const struct stats_hdr *hdr, uint16_t off)
+{
+	const uint8_t *addr = (const uint8_t *)hdr + off;
+	uint64_t val = 0;
+	int i;
+
+	for (i = 0; i < STATS_NUM_CPUS; i++) {
+		switch (hdr->s_size) {
+		case sizeof(uint16_t):
+			val += *(const uint16_t *)addr;
+			break;
+		case sizeof(uint32_t):
+			val += *(const uint32_t *)addr;
+			break;
+		case sizeof(uint64_t):
+			val += *(const uint64_t *)addr;
+			break;
+		}
+
+		addr += STATS_CPU_STRIDE(hdr);
+	}
+
+	return val;
 }
 
 /**
@@ -280,5 +328,11 @@ stats_init_and_reg(struct stats_hdr *shdr, uint8_t size, uint16_t cnt,
 void
 stats_reset(struct stats_hdr *hdr)
 {
-	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0, hdr->s_size * hdr->s_cnt);
+	uint8_t *addr = (uint8_t *)hdr + STATS_ENTRIES_OFF;
+	int i;
+
+	for (i = 0; i < STATS_NUM_CPUS; i++) {
+		(void)memset(addr, 0, hdr->s_size * hdr->s_cnt);
+		addr += STATS_CPU_STRIDE(hdr);
+	}
 }
@@ -11,20 +11,8 @@ static int stats_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t
 {
 	struct shell *sh = arg;
 	void *addr = (uint8_t *)hdr + off;
-	uint64_t val = 0;
-
-	switch (hdr->s_size) {
-	case sizeof(uint16_t):
-		val = *(uint16_t *)(addr);
-		break;
-
-	case sizeof(uint32_t):
-		val = *(uint32_t *)(addr);
-		break;
-	case sizeof(uint64_t):
-		val = *(uint64_t *)(addr);
-		break;
-	}
+	uint64_t val = stats_get(hdr, off);
+
 	shell_print(sh, "\t%s (offset: %u, addr: %p): %" PRIu64, name, off, addr, val);
 	return 0;
 }
@@ -13,9 +13,106 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 #include <zephyr/types.h>
 #include <string.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+static K_KERNEL_STACK_DEFINE(erase_ahead_stack, CONFIG_STREAM_FLASH_ERASE_AHEAD_STACK_SIZE);
+static struct k_work_q erase_ahead_workq;
+
+static void erase_ahead_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, erase_work);
+	int rc;
+
+	LOG_DBG("Erasing ahead page at offset 0x%08lx", (long)ctx->erase_ahead_page);
+
+	rc = flash_erase(ctx->fdev, ctx->erase_ahead_page, ctx->erase_ahead_size);
+	if (rc != 0) {
+		LOG_WRN("Error %d while erasing ahead", rc);
+	}
+
+	ctx->erase_ahead_done = (rc == 0);
+}
+
+/* Starts erasing the page following the last erased one, if it is within
+ * the write area.
+ */
+static void erase_ahead_start(struct stream_flash_ctx *ctx)
+{
+	struct flash_pages_info page;
+	off_t next;
+
+	if (ctx->last_erased_page_start_offset < 0 || ctx->erase_ahead_page >= 0) {
+		return;
+	}
+
+#if defined(CONFIG_FLASH_HAS_NO_EXPLICIT_ERASE)
+	const struct flash_parameters *fparams = flash_get_parameters(ctx->fdev);
+
+	if (!(flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT)) {
+		return;
+	}
+#endif
+
+	if (flash_get_page_info_by_offs(ctx->fdev, ctx->last_erased_page_start_offset,
+					&page) != 0) {
+		return;
+	}
+
+	next = page.start_offset + page.size;
+	if ((next - ctx->offset) >= ctx->available ||
+	    flash_get_page_info_by_offs(ctx->fdev, next, &page) != 0) {
+		return;
+	}
+
+	ctx->erase_ahead_page = page.start_offset;
+	ctx->erase_ahead_size = page.size;
+	ctx->erase_ahead_done = false;
+
+	(void)k_work_submit_to_queue(&erase_ahead_workq, &ctx->erase_work);
+}
+
+/* Waits for the erase ahead to complete. If off is not negative, the page
+ * erased ahead is recorded as erased once the write position off reaches it.
+ */
+static void erase_ahead_wait(struct stream_flash_ctx *ctx, off_t off)
+{
+	struct k_work_sync sync;
+
+	(void)k_work_flush(&ctx->erase_work, &sync);
+
+	if (off < 0 || ctx->erase_ahead_page < 0) {
+		return;
+	}
+
+	if (ctx->erase_ahead_done && off < ctx->erase_ahead_page) {
+		/* Still ahead of the write position */
+		return;
+	}
+
+	if (ctx->erase_ahead_done &&
+	    (off - ctx->erase_ahead_page) < ctx->erase_ahead_size) {
+		ctx->last_erased_page_start_offset = ctx->erase_ahead_page;
+	}
+
+	ctx->erase_ahead_page = -1;
+}
+
+static int erase_ahead_init(void)
+{
+	k_work_queue_start(&erase_ahead_workq, erase_ahead_stack,
+			   K_KERNEL_STACK_SIZEOF(erase_ahead_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+	k_thread_name_set(&erase_ahead_workq.thread, "stream_flash_erase");
+
+	return 0;
+}
+
+SYS_INIT(erase_ahead_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_STREAM_FLASH_ERASE_AHEAD */
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 #include <zephyr/settings/settings.h>
 
@@ -53,6 +150,11 @@ static int settings_direct_loader(const char *key, size_t len,
 		/* Update the last erased page to avoid deleting already
 		 * written data.
 		 */
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+		/* Drop any page erased ahead of the previous position */
+		erase_ahead_wait(ctx, -1);
+		ctx->erase_ahead_page = -1;
+#endif
 		if (ctx->bytes_written > 0) {
 			rc = flash_get_page_info_by_offs(ctx->fdev, offset,
 							 &page);
@@ -136,7 +238,9 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+		erase_ahead_wait(ctx, write_addr + ctx->buf_bytes - 1);
+#endif
 		rc = stream_flash_erase_page(ctx,
 					     write_addr + ctx->buf_bytes - 1);
 		if (rc < 0) {
@@ -165,6 +269,13 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return rc;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* Overlap the erase of the next page with the verification and the
+	 * filling of the next buffer.
+	 */
+	erase_ahead_start(ctx);
+#endif
+
 	if (ctx->callback) {
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
@@ -234,6 +345,13 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	if (flush) {
+		/* Leave no flash operation running behind the caller */
+		erase_ahead_wait(ctx, -1);
+	}
+#endif
+
 	return rc;
 }
 
@@ -321,6 +439,10 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
+#endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	k_work_init(&ctx->erase_work, erase_ahead_handler);
+	ctx->erase_ahead_page = -1;
 #endif
 	ctx->erase_value = params->erase_value;
 
@@ -184,6 +184,16 @@ extern "C" {
 #define sys_port_trace_k_condvar_wait_enter(condvar)
 #define sys_port_trace_k_condvar_wait_exit(condvar, ret)
 
+#define sys_port_trace_k_rwlock_init(rwlock, ret)
+#define sys_port_trace_k_rwlock_read_lock_enter(rwlock, timeout)
+#define sys_port_trace_k_rwlock_read_lock_blocking(rwlock, timeout)
+#define sys_port_trace_k_rwlock_read_lock_exit(rwlock, timeout, ret)
+#define sys_port_trace_k_rwlock_write_lock_enter(rwlock, timeout)
+#define sys_port_trace_k_rwlock_write_lock_blocking(rwlock, timeout)
+#define sys_port_trace_k_rwlock_write_lock_exit(rwlock, timeout, ret)
+#define sys_port_trace_k_rwlock_unlock_enter(rwlock)
+#define sys_port_trace_k_rwlock_unlock_exit(rwlock, ret)
+
 #define sys_port_trace_k_queue_init(queue)
 #define sys_port_trace_k_queue_cancel_wait(queue)
 #define sys_port_trace_k_queue_queue_insert_enter(queue, alloc)
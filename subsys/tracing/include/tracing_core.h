@@ -14,9 +14,16 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+/* Buffers are per CPU, only interrupts of the current CPU need locking. */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
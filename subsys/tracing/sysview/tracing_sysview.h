@@ -338,6 +338,16 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_condvar_wait_exit(condvar, ret)                                           \
 	SEGGER_SYSVIEW_RecordEndCallU32(TID_CONDVAR_WAIT, (uint32_t)ret)
 
+#define sys_port_trace_k_rwlock_init(rwlock, ret)
+#define sys_port_trace_k_rwlock_read_lock_enter(rwlock, timeout)
+#define sys_port_trace_k_rwlock_read_lock_blocking(rwlock, timeout)
+#define sys_port_trace_k_rwlock_read_lock_exit(rwlock, timeout, ret)
+#define sys_port_trace_k_rwlock_write_lock_enter(rwlock, timeout)
+#define sys_port_trace_k_rwlock_write_lock_blocking(rwlock, timeout)
+#define sys_port_trace_k_rwlock_write_lock_exit(rwlock, timeout, ret)
+#define sys_port_trace_k_rwlock_unlock_enter(rwlock)
+#define sys_port_trace_k_rwlock_unlock_exit(rwlock, ret)
+
 #define sys_port_trace_k_queue_init(queue)                                                         \
 	SEGGER_SYSVIEW_RecordU32(TID_QUEUE_INIT, (uint32_t)(uintptr_t)queue)
 
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit to avoid
+ * undefined symbols as the macros are not expanded recursively
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/__assert.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+#ifdef CONFIG_TRACING_NET_UDP
+#define TRACING_NET_SOCK_TYPE  SOCK_DGRAM
+#define TRACING_NET_PROTO      IPPROTO_UDP
+#define TRACING_NET_CHUNK_SIZE CONFIG_TRACING_NET_UDP_PAYLOAD_SIZE
+#else
+#define TRACING_NET_SOCK_TYPE  SOCK_STREAM
+#define TRACING_NET_PROTO      IPPROTO_TCP
+#define TRACING_NET_CHUNK_SIZE UINT32_MAX
+#endif
+
+static struct sockaddr server_addr;
+static int sock = -1;
+
+static int tracing_net_connect(void)
+{
+	int fd;
+
+	fd = zsock_socket(server_addr.sa_family, TRACING_NET_SOCK_TYPE, TRACING_NET_PROTO);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (zsock_connect(fd, &server_addr, sizeof(server_addr)) < 0) {
+		int err = -errno;
+
+		(void)zsock_close(fd);
+		return err;
+	}
+
+	sock = fd;
+
+	return 0;
+}
+
+static void tracing_backend_net_output(
+	const struct tracing_backend *backend,
+	uint8_t *data, uint32_t length)
+{
+	/* Until the network is up and the server reachable, data is dropped. */
+	if ((sock < 0) && (tracing_net_connect() < 0)) {
+		return;
+	}
+
+	while (length > 0) {
+		ssize_t sent = zsock_send(sock, data, MIN(length, TRACING_NET_CHUNK_SIZE), 0);
+
+		if (sent < 0) {
+			/* Connect again with the next data. */
+			(void)zsock_close(sock);
+			sock = -1;
+			return;
+		}
+
+		data += sent;
+		length -= sent;
+	}
+}
+
+static void tracing_backend_net_init(void)
+{
+	bool ok = net_ipaddr_parse(CONFIG_TRACING_NET_SERVER,
+				   sizeof(CONFIG_TRACING_NET_SERVER) - 1, &server_addr);
+
+	__ASSERT(ok, "invalid tracing server address");
+	(void)ok;
+}
+
+const struct tracing_backend_api tracing_backend_net_api = {
+	.init = tracing_backend_net_init,
+	.output  = tracing_backend_net_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_net, tracing_backend_net_api);
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -17,53 +19,178 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 	return sizeof(tracing_cmd_buffer);
 }
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+/* Each CPU writes to its own buffer with its interrupts locked, so writers
+ * never contend with each other. The tracing thread is the only reader.
+ */
+#define TRACING_BUFFER_CNT CONFIG_MP_MAX_NUM_CPUS
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFER_CNT];
+static uint8_t tracing_buffer[TRACING_BUFFER_CNT][CONFIG_TRACING_BUFFER_SIZE + 1];
+
+/* Buffer being read and number of bytes left to read from it. Reading stops
+ * at the amount the buffer held when it was picked, which is the end of a
+ * packet, so that packets of several CPUs are never mixed.
+ */
+static uint8_t read_idx;
+static uint32_t read_left;
+
+static struct ring_buf *put_buf(void)
+{
+	/* Writers run with interrupts locked, they cannot migrate. */
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+}
+
+static struct ring_buf *get_buf(void)
+{
+	for (int i = 0; (read_left == 0U) && (i < TRACING_BUFFER_CNT); i++) {
+		read_idx = (read_idx + 1U) % TRACING_BUFFER_CNT;
+		read_left = ring_buf_size_get(&tracing_ring_buf[read_idx]);
+	}
+
+	/* Pairs with the fence of the writer, which may run on another CPU. */
+	barrier_dmem_fence_full();
+
+	return &tracing_ring_buf[read_idx];
+}
+
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_buf(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	/* Publish the data before the packet to the reader. */
+	barrier_dmem_fence_full();
+
+	return ring_buf_put_finish(put_buf(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	struct ring_buf *buf = put_buf();
+	uint32_t total = 0U;
+	uint32_t len;
+	uint8_t *dst;
+
+	do {
+		len = ring_buf_put_claim(buf, &dst, size - total);
+		memcpy(dst, &data[total], len);
+		total += len;
+	} while ((len > 0U) && (total < size));
+
+	barrier_dmem_fence_full();
+	(void)ring_buf_put_finish(buf, total);
+
+	return total;
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	struct ring_buf *buf = get_buf();
+
+	return ring_buf_get_claim(buf, data, MIN(size, read_left));
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	int err = ring_buf_get_finish(&tracing_ring_buf[read_idx], size);
+
+	if (err == 0) {
+		read_left -= size;
+	}
+
+	return err;
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	uint32_t total = 0U;
+
+	while (size > 0U) {
+		struct ring_buf *buf = get_buf();
+		uint32_t len = ring_buf_get(buf, data, MIN(size, read_left));
+
+		if (len == 0U) {
+			break;
+		}
+
+		read_left -= len;
+		total += len;
+		data += len;
+		size -= len;
+	}
+
+	return total;
 }
+#else
+#define TRACING_BUFFER_CNT 1
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFER_CNT];
+static uint8_t tracing_buffer[TRACING_BUFFER_CNT][CONFIG_TRACING_BUFFER_SIZE + 1];
+
+static inline struct ring_buf *put_buf(void)
+{
+	return &tracing_ring_buf[0];
+}
+
+uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
+{
+	return ring_buf_put_claim(put_buf(), data, size);
+}
+
+int tracing_buffer_put_finish(uint32_t size)
+{
+	return ring_buf_put_finish(put_buf(), size);
+}
+
+uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
+{
+	return ring_buf_put(put_buf(), data, size);
+}
+
+uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
+{
+	return ring_buf_get_claim(&tracing_ring_buf[0], data, size);
+}
+
+int tracing_buffer_get_finish(uint32_t size)
+{
+	return ring_buf_get_finish(&tracing_ring_buf[0], size);
+}
+
+uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
+{
+	return ring_buf_get(&tracing_ring_buf[0], data, size);
+}
+#endif /* CONFIG_TRACING_PER_CPU_BUFFERS */
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFER_CNT; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int i = 0; i < TRACING_BUFFER_CNT; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_buf());
 }
@@ -42,8 +42,17 @@ enum {
 #define CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_MAX_DGRAM_PER_NTB
 #define CDC_NCM_RECV_NTB_MAX_SIZE 2048
 
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+/* Datagrams queued for transmission are aggregated into one NTB */
+#define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB
+#define CDC_NCM_SEND_NTB_MAX_SIZE CONFIG_USBD_CDC_NCM_TX_NTB_MAX_SIZE
+/* One NTB being filled while the previous one is transferred */
+#define CDC_NCM_SEND_NTB_COUNT 2
+#else
 #define CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB 1
 #define CDC_NCM_SEND_NTB_MAX_SIZE 2048
+#define CDC_NCM_SEND_NTB_COUNT 1
+#endif
 
 /* Chapter 6.3 table 6-5 and 6-6 */
 struct cdc_ncm_notification {
@@ -171,12 +180,42 @@ union recv_ntb {
 	uint8_t data[CDC_NCM_RECV_NTB_MAX_SIZE];
 } __packed;
 
+#ifdef CONFIG_USBD_CDC_NCM_RX_ZERO_COPY
+/*
+ * Received datagrams are passed to the network stack as fragments pointing
+ * into the NTB, which stays allocated until all of them are freed. The OUT
+ * transfers use their own pool so that they cannot starve the IN transfers.
+ */
+#define CDC_NCM_RECV_NTB_COUNT 4
+
+UDC_BUF_POOL_DEFINE(cdc_ncm_rx_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CDC_NCM_RECV_NTB_COUNT,
+		    CDC_NCM_RECV_NTB_MAX_SIZE,
+		    sizeof(struct udc_buf_info), NULL);
+
+struct cdc_ncm_rx_frag {
+	const struct device *dev;
+	struct net_buf *ntb;
+};
+
+static void cdc_ncm_rx_frag_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_DEFINE(cdc_ncm_rx_frag_pool,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CDC_NCM_RECV_NTB_COUNT *
+		    MAX(CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB, 1),
+		    0, sizeof(struct cdc_ncm_rx_frag), cdc_ncm_rx_frag_destroy);
+
+#define CDC_NCM_EP_POOL_COUNT CDC_NCM_SEND_NTB_COUNT
+#else
+#define CDC_NCM_EP_POOL_COUNT (CDC_NCM_SEND_NTB_COUNT + 1)
+#endif
+
 /*
  * Transfers through two endpoints proceed in a synchronous manner,
  * with maximum block of CDC_NCM_SEND_NTB_MAX_SIZE.
  */
 UDC_BUF_POOL_DEFINE(cdc_ncm_ep_pool,
-		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * CDC_NCM_EP_POOL_COUNT,
 		    MAX(CDC_NCM_SEND_NTB_MAX_SIZE, CDC_NCM_RECV_NTB_MAX_SIZE),
 		    sizeof(struct udc_buf_info), NULL);
 
@@ -231,6 +270,16 @@ struct cdc_ncm_eth_data {
 
 	struct k_sem sync_sem;
 
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+	/* NTB being filled, sent when full or after the aggregation delay */
+	struct net_buf *tx_ntb;
+	uint16_t tx_dgrams;
+	/* Maximum NTB size accepted by the host */
+	uint32_t ntb_in_max_size;
+	struct k_mutex tx_lock;
+	struct k_work_delayable tx_work;
+#endif
+
 	struct k_work_delayable notif_work;
 };
 
@@ -301,7 +350,15 @@ static struct net_buf *cdc_ncm_buf_alloc(const uint8_t ep)
 	struct net_buf *buf = NULL;
 	struct udc_buf_info *bi;
 
+#ifdef CONFIG_USBD_CDC_NCM_RX_ZERO_COPY
+	if (USB_EP_DIR_IS_OUT(ep)) {
+		buf = net_buf_alloc(&cdc_ncm_rx_pool, K_NO_WAIT);
+	} else {
+		buf = net_buf_alloc(&cdc_ncm_ep_pool, K_NO_WAIT);
+	}
+#else
 	buf = net_buf_alloc(&cdc_ncm_ep_pool, K_NO_WAIT);
+#endif
 	if (!buf) {
 		return NULL;
 	}
@@ -332,6 +389,8 @@ static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 	ep = cdc_ncm_get_bulk_out(c_data);
 	buf = cdc_ncm_buf_alloc(ep);
 	if (buf == NULL) {
+		/* Restarted once a buffer is released */
+		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
 		return -ENOMEM;
 	}
 
@@ -339,6 +398,7 @@ static int cdc_ncm_out_start(struct usbd_class_data *const c_data)
 	if (ret) {
 		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
 		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
 	} else {
 		LOG_DBG("enqueue out %u", buf->size);
 	}
@@ -504,33 +564,74 @@ static int check_frame(struct cdc_ncm_eth_data *data, struct net_buf *const buf)
 
 #define NET_PKT_ALLOC_TIMEOUT 100 /* ms */
 
-static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
-			      struct net_buf *const buf, const int err)
+#ifdef CONFIG_USBD_CDC_NCM_RX_ZERO_COPY
+static void cdc_ncm_rx_frag_destroy(struct net_buf *buf)
 {
-	const struct device *dev = usbd_class_get_private(c_data);
-	const union recv_ntb *ntb = (union recv_ntb *)buf->data;
+	struct cdc_ncm_rx_frag *frag = net_buf_user_data(buf);
+	const struct device *dev = frag->dev;
 	struct cdc_ncm_eth_data *data = dev->data;
-	const struct ndp16_datagram *ndp_datagram;
-	struct net_pkt *pkt, *src;
-	uint16_t start, len;
-	uint16_t count;
-	int ret;
 
-	if (err || buf->len == 0) {
-		net_buf_unref(buf);
-		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
-		return 0;
-	}
+	net_buf_unref(frag->ntb);
+	net_buf_destroy(buf);
 
-	ret = check_frame(data, buf);
-	if (ret < 0) {
-		LOG_DBG("check frame failed (%d)", ret);
-		goto restart_out_transfer;
+	/* The OUT transfer may have stopped for lack of buffers */
+	if (!atomic_test_bit(&data->state, CDC_NCM_OUT_ENGAGED)) {
+		(void)cdc_ncm_out_start(data->c_data);
 	}
+}
 
-	ntb = (union recv_ntb *)buf->data;
-	ndp_datagram = (struct ndp16_datagram *)
-		(ntb->data + sys_le16_to_cpu(ntb->nth.wNdpIndex) + sizeof(struct ndp16));
+/* Passes the datagrams of the NTB to the network stack without copying them */
+static void cdc_ncm_rx_datagrams(const struct device *dev, struct net_buf *const buf,
+				 const struct ndp16_datagram *ndp_datagram, uint16_t count)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct cdc_ncm_rx_frag *frag_data;
+	struct net_buf *frag;
+	struct net_pkt *pkt;
+	uint16_t start, len;
+
+	for (int i = 0; i < count; i++) {
+		start = sys_le16_to_cpu(ndp_datagram[i].wDatagramIndex);
+		len = sys_le16_to_cpu(ndp_datagram[i].wDatagramLength);
+
+		LOG_DBG("[%d] start %u len %u", i, start, len);
+
+		pkt = net_pkt_rx_alloc_on_iface(data->iface, K_MSEC(NET_PKT_ALLOC_TIMEOUT));
+		if (!pkt) {
+			LOG_ERR("No memory for net_pkt");
+			return;
+		}
+
+		frag = net_buf_alloc_with_data(&cdc_ncm_rx_frag_pool, buf->data + start, len,
+					       K_NO_WAIT);
+		if (!frag) {
+			LOG_ERR("No fragment for datagram");
+			net_pkt_unref(pkt);
+			return;
+		}
+
+		frag_data = net_buf_user_data(frag);
+		frag_data->dev = dev;
+		frag_data->ntb = net_buf_ref(buf);
+		net_pkt_frag_add(pkt, frag);
+
+		LOG_DBG("Received packet len %zu", net_pkt_get_len(pkt));
+
+		if (net_recv_data(data->iface, pkt) < 0) {
+			LOG_ERR("Packet %p dropped by network stack", pkt);
+			net_pkt_unref(pkt);
+		}
+	}
+}
+#else
+/* Copies the datagrams of the NTB into network packets */
+static void cdc_ncm_rx_datagrams(const struct device *dev, struct net_buf *const buf,
+				 const struct ndp16_datagram *ndp_datagram, uint16_t count)
+{
+	struct cdc_ncm_eth_data *data = dev->data;
+	struct net_pkt *pkt, *src;
+	uint16_t start, len;
+	int ret;
 
 	/* Temporary source pkt we use to copy one Ethernet frame from
 	 * the list of USB net_buf's.
@@ -538,15 +639,12 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 	src = net_pkt_alloc(K_MSEC(NET_PKT_ALLOC_TIMEOUT));
 	if (src == NULL) {
 		LOG_DBG("src packet alloc fail");
-		goto restart_out_transfer;
+		return;
 	}
 
 	net_pkt_append_buffer(src, buf);
 	net_pkt_set_overwrite(src, true);
 
-	count = (sys_le16_to_cpu(ntb->ndp.wLength) - 12U) / 4U;
-	LOG_DBG("%u Ethernet frame%s received", count, count == 1 ? "" : "s");
-
 	for (int i = 0; i < count; i++) {
 		start = sys_le16_to_cpu(ndp_datagram[i].wDatagramIndex);
 		len = sys_le16_to_cpu(ndp_datagram[i].wDatagramLength);
@@ -586,6 +684,39 @@ static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
 unref_packet:
 	src->buffer = NULL;
 	net_pkt_unref(src);
+}
+#endif /* CONFIG_USBD_CDC_NCM_RX_ZERO_COPY */
+
+static int cdc_ncm_acl_out_cb(struct usbd_class_data *const c_data,
+			      struct net_buf *const buf, const int err)
+{
+	const struct device *dev = usbd_class_get_private(c_data);
+	const union recv_ntb *ntb = (union recv_ntb *)buf->data;
+	struct cdc_ncm_eth_data *data = dev->data;
+	const struct ndp16_datagram *ndp_datagram;
+	uint16_t count;
+	int ret;
+
+	if (err || buf->len == 0) {
+		net_buf_unref(buf);
+		atomic_clear_bit(&data->state, CDC_NCM_OUT_ENGAGED);
+		return 0;
+	}
+
+	ret = check_frame(data, buf);
+	if (ret < 0) {
+		LOG_DBG("check frame failed (%d)", ret);
+		goto restart_out_transfer;
+	}
+
+	ntb = (union recv_ntb *)buf->data;
+	ndp_datagram = (struct ndp16_datagram *)
+		(ntb->data + sys_le16_to_cpu(ntb->nth.wNdpIndex) + sizeof(struct ndp16));
+
+	count = (sys_le16_to_cpu(ntb->ndp.wLength) - 12U) / 4U;
+	LOG_DBG("%u Ethernet frame%s received", count, count == 1 ? "" : "s");
+
+	cdc_ncm_rx_datagrams(dev, buf, ndp_datagram, count);
 
 restart_out_transfer:
 	net_buf_unref(buf);
@@ -611,6 +742,9 @@ static int usbd_cdc_ncm_request(struct usbd_class_data *const c_data,
 	}
 
 	if (bi->ep == cdc_ncm_get_bulk_in(c_data)) {
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+		net_buf_unref(buf);
+#endif
 		k_sem_give(&data->sync_sem);
 		return 0;
 	}
@@ -796,6 +930,9 @@ static void usbd_cdc_ncm_update(struct usbd_class_data *const c_data,
 		LOG_DBG("Skip iface %u alternate %u", iface, alternate);
 
 		data->tx_seq = 0;
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+		data->ntb_in_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+#endif
 	}
 
 	if (data_iface == iface && alternate == 1) {
@@ -858,8 +995,21 @@ static int usbd_cdc_ncm_ctd(struct usbd_class_data *const c_data,
 		}
 
 		if (setup->bRequest == SET_NTB_INPUT_SIZE) {
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+			const struct device *dev = usbd_class_get_private(c_data);
+			struct cdc_ncm_eth_data *data = dev->data;
+
+			if (buf->len >= sizeof(uint32_t)) {
+				/* NTBs are never smaller than one full datagram */
+				data->ntb_in_max_size = CLAMP(sys_get_le32(buf->data),
+							      CDC_NCM_RECV_NTB_MAX_SIZE,
+							      CDC_NCM_SEND_NTB_MAX_SIZE);
+				LOG_DBG("NTB input size %u", data->ntb_in_max_size);
+			}
+#else
 			LOG_DBG("bRequest 0x%02x (%s) not implemented",
 				setup->bRequest, "SetNtbInputSize");
+#endif
 			return 0;
 		}
 
@@ -912,8 +1062,15 @@ static int usbd_cdc_ncm_cth(struct usbd_class_data *const c_data,
 	}
 
 	case GET_NTB_INPUT_SIZE: {
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+		const struct device *dev = usbd_class_get_private(c_data);
+		struct cdc_ncm_eth_data *data = dev->data;
+		const uint32_t ntb_in_max_size = data->ntb_in_max_size;
+#else
+		const uint32_t ntb_in_max_size = CDC_NCM_RECV_NTB_MAX_SIZE;
+#endif
 		struct ntb_input_size input_size = {
-			.dwNtbInMaxSize = sys_cpu_to_le32(CDC_NCM_RECV_NTB_MAX_SIZE),
+			.dwNtbInMaxSize = sys_cpu_to_le32(ntb_in_max_size),
 			.wNtbInMaxDatagrams = sys_cpu_to_le16(CDC_NCM_RECV_MAX_DATAGRAMS_PER_NTB),
 			.wReserved = sys_cpu_to_le16(0),
 		};
@@ -982,6 +1139,150 @@ static void *usbd_cdc_ncm_get_desc(struct usbd_class_data *const c_data,
 	return data->fs_desc;
 }
 
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+static struct net_buf *cdc_ncm_ntb_alloc(struct cdc_ncm_eth_data *const data)
+{
+	struct net_buf *buf;
+	union send_ntb *ntb;
+
+	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(data->c_data));
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	ntb = (union send_ntb *)buf->data;
+
+	ntb->nth.dwSignature = sys_cpu_to_le32(NTH16_SIGNATURE);
+	ntb->nth.wHeaderLength = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->nth.wNdpIndex = sys_cpu_to_le16(sizeof(struct nth16));
+	ntb->ndp.dwSignature = sys_cpu_to_le32(NDP16_SIGNATURE_NCM0);
+	ntb->ndp.wLength = sys_cpu_to_le16(sizeof(struct ndp16) +
+					   (CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB + 1) *
+					   sizeof(struct ndp16_datagram));
+	ntb->ndp.wNextNdpIndex = 0;
+	ntb->ndp_datagram[0].wDatagramIndex = 0;
+	ntb->ndp_datagram[0].wDatagramLength = 0;
+
+	/* The datagrams follow the table of the NDP */
+	net_buf_add(buf, sizeof(struct nth16) + sys_le16_to_cpu(ntb->ndp.wLength));
+	data->tx_dgrams = 0;
+
+	return buf;
+}
+
+/* Copies a datagram behind the previous ones, -ENOSPC if it does not fit */
+static int cdc_ncm_ntb_append(struct cdc_ncm_eth_data *const data,
+			      struct net_buf *const buf, struct net_pkt *const pkt,
+			      const size_t len)
+{
+	union send_ntb *ntb = (union send_ntb *)buf->data;
+	uint16_t start = ROUND_UP(buf->len, CDC_NCM_ALIGNMENT);
+
+	if (data->tx_dgrams == CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB ||
+	    start + len > data->ntb_in_max_size) {
+		return -ENOSPC;
+	}
+
+	if (net_pkt_read(pkt, buf->data + start, len)) {
+		LOG_ERR("Failed copy net_pkt");
+		return -ENOBUFS;
+	}
+
+	net_buf_add(buf, start + len - buf->len);
+
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramIndex = sys_cpu_to_le16(start);
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramLength = sys_cpu_to_le16(len);
+	data->tx_dgrams++;
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramIndex = 0;
+	ntb->ndp_datagram[data->tx_dgrams].wDatagramLength = 0;
+
+	return 0;
+}
+
+/* Sends the NTB being filled, called with the TX lock held */
+static void cdc_ncm_ntb_flush(struct cdc_ncm_eth_data *const data)
+{
+	struct usbd_class_data *c_data = data->c_data;
+	struct net_buf *buf = data->tx_ntb;
+	union send_ntb *ntb;
+
+	if (buf == NULL) {
+		return;
+	}
+
+	data->tx_ntb = NULL;
+	ntb = (union send_ntb *)buf->data;
+	ntb->nth.wSequence = sys_cpu_to_le16(++data->tx_seq);
+	ntb->nth.wBlockLength = sys_cpu_to_le16(buf->len);
+
+	if (buf->len % cdc_ncm_get_bulk_in_mps(c_data) == 0) {
+		udc_ep_buf_set_zlp(buf);
+	}
+
+	LOG_DBG("NTB of %u datagrams, %u bytes", data->tx_dgrams, buf->len);
+
+	/* Wait for the transfer of the previous NTB */
+	k_sem_take(&data->sync_sem, K_FOREVER);
+
+	if (!atomic_test_bit(&data->state, CDC_NCM_CLASS_ENABLED) ||
+	    usbd_ep_enqueue(c_data, buf)) {
+		net_buf_unref(buf);
+		k_sem_give(&data->sync_sem);
+	}
+}
+
+static void cdc_ncm_tx_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct cdc_ncm_eth_data *data = CONTAINER_OF(dwork, struct cdc_ncm_eth_data, tx_work);
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+	cdc_ncm_ntb_flush(data);
+	k_mutex_unlock(&data->tx_lock);
+}
+
+static int cdc_ncm_send_aggregated(struct cdc_ncm_eth_data *const data,
+				   struct net_pkt *const pkt, const size_t len)
+{
+	int ret = 0;
+
+	k_mutex_lock(&data->tx_lock, K_FOREVER);
+
+	for (int i = 0; i < 2; i++) {
+		if (data->tx_ntb == NULL) {
+			data->tx_ntb = cdc_ncm_ntb_alloc(data);
+			if (data->tx_ntb == NULL) {
+				LOG_ERR("Failed to allocate buffer");
+				ret = -ENOMEM;
+				break;
+			}
+		}
+
+		ret = cdc_ncm_ntb_append(data, data->tx_ntb, pkt, len);
+		if (ret != -ENOSPC) {
+			break;
+		}
+
+		/* Full, send it and start a new one */
+		cdc_ncm_ntb_flush(data);
+	}
+
+	if (ret == 0) {
+		if (data->tx_dgrams == CDC_NCM_SEND_MAX_DATAGRAMS_PER_NTB) {
+			cdc_ncm_ntb_flush(data);
+		} else {
+			/* Bound the latency of the first datagram of the NTB */
+			k_work_schedule(&data->tx_work,
+					K_USEC(CONFIG_USBD_CDC_NCM_TX_AGGREGATION_DELAY_US));
+		}
+	}
+
+	k_mutex_unlock(&data->tx_lock);
+
+	return ret;
+}
+#endif /* CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0 */
+
 static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 {
 	struct cdc_ncm_eth_data *const data = dev->data;
@@ -1003,6 +1304,10 @@ static int cdc_ncm_send(const struct device *dev, struct net_pkt *const pkt)
 		return -EACCES;
 	}
 
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+	return cdc_ncm_send_aggregated(data, pkt, len);
+#endif
+
 	buf = cdc_ncm_buf_alloc(cdc_ncm_get_bulk_in(c_data));
 	if (buf == NULL) {
 		LOG_ERR("Failed to allocate buffer");
@@ -1122,6 +1427,13 @@ static int usbd_cdc_ncm_preinit(const struct device *dev)
 	struct cdc_ncm_eth_data *data = dev->data;
 
 	k_work_init_delayable(&data->notif_work, send_notification_work);
+#if CONFIG_USBD_CDC_NCM_TX_MAX_DGRAM_PER_NTB > 0
+	k_work_init_delayable(&data->tx_work, cdc_ncm_tx_work);
+	k_mutex_init(&data->tx_lock);
+	data->ntb_in_max_size = CDC_NCM_SEND_NTB_MAX_SIZE;
+	/* Given while no NTB is being transferred */
+	k_sem_init(&data->sync_sem, 1, 1);
+#endif
 
 	if (sys_get_le48(data->mac_addr) == sys_cpu_to_le48(0)) {
 		gen_random_mac(data->mac_addr, 0, 0, 0);
@@ -67,6 +67,22 @@ UDC_BUF_POOL_DEFINE(msc_ep_pool,
 		    MSC_NUM_INSTANCES * 2, MSC_BUF_SIZE,
 		    sizeof(struct udc_buf_info), NULL);
 
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+#define MSC_DATA_BUF_SIZE ROUND_UP(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE, UDC_BUF_GRANULARITY)
+#define MSC_DATA_BUFS_FREE BIT_MASK(CONFIG_USBD_MSC_DATA_BUFFERS)
+
+/* READ(10) and WRITE(10) data is transferred directly from and to the data
+ * buffers of the instance, the pool only provides the net_buf headers.
+ */
+NET_BUF_POOL_DEFINE(msc_data_pool,
+		    MSC_NUM_INSTANCES * CONFIG_USBD_MSC_DATA_BUFFERS, 0,
+		    sizeof(struct udc_buf_info), NULL);
+
+#define MSC_MSGQ_DEPTH (3 + 2 * CONFIG_USBD_MSC_DATA_BUFFERS)
+#else
+#define MSC_MSGQ_DEPTH 3
+#endif
+
 struct msc_event {
 	struct usbd_class_data *c_data;
 	/* NULL to request Bulk-Only Mass Storage Reset
@@ -76,8 +92,10 @@ struct msc_event {
 	int err;
 };
 
-/* Each instance has 2 endpoints and can receive bulk only reset command */
-K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event), MSC_NUM_INSTANCES * 3, 4);
+/* Each instance has 2 endpoints and can receive bulk only reset command,
+ * and can have all its data buffers queued on top of that.
+ */
+K_MSGQ_DEFINE(msc_msgq, sizeof(struct msc_event), MSC_NUM_INSTANCES * MSC_MSGQ_DEPTH, 4);
 
 /* Make supported vendor request visible for the device stack */
 static const struct usbd_cctx_vendor_req msc_bot_vregs =
@@ -125,6 +143,15 @@ struct msc_bot_ctx {
 	uint32_t transferred_data;
 	size_t scsi_offset;
 	size_t scsi_bytes;
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+	uint8_t (*const data_bufs)[MSC_DATA_BUF_SIZE];
+	/* Bitmask of the data buffers not queued on an endpoint */
+	uint32_t data_free;
+	uint8_t data_in_queued;
+	uint8_t data_out_queued;
+	/* Bytes the queued OUT data buffers can receive */
+	uint32_t data_out_bytes;
+#endif
 };
 
 static struct net_buf *msc_buf_alloc(const uint8_t ep)
@@ -144,6 +171,48 @@ static struct net_buf *msc_buf_alloc(const uint8_t ep)
 	return buf;
 }
 
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+static struct net_buf *msc_data_buf_alloc(struct msc_bot_ctx *ctx,
+					  const uint8_t ep, size_t size)
+{
+	struct net_buf *buf;
+	struct udc_buf_info *bi;
+	unsigned int idx;
+
+	if (ctx->data_free == 0) {
+		return NULL;
+	}
+
+	idx = find_lsb_set(ctx->data_free) - 1;
+	buf = net_buf_alloc_with_data(&msc_data_pool, ctx->data_bufs[idx], size, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	/* Buffer is filled either by the SCSI layer or by the endpoint */
+	net_buf_simple_reset(&buf->b);
+	ctx->data_free &= ~BIT(idx);
+
+	bi = udc_get_buf_info(buf);
+	memset(bi, 0, sizeof(struct udc_buf_info));
+	bi->ep = ep;
+
+	return buf;
+}
+
+static bool msc_is_data_buf(struct net_buf *buf)
+{
+	return net_buf_pool_get(buf->pool_id) == &msc_data_pool;
+}
+
+static void msc_data_buf_release(struct msc_bot_ctx *ctx, struct net_buf *buf)
+{
+	unsigned int idx = (buf->__buf - ctx->data_bufs[0]) / MSC_DATA_BUF_SIZE;
+
+	ctx->data_free |= BIT(idx);
+}
+#endif
+
 static uint8_t msc_get_bulk_in(struct usbd_class_data *const c_data)
 {
 	struct usbd_context *uds_ctx = usbd_class_get_ctx(c_data);
@@ -170,6 +239,46 @@ static uint8_t msc_get_bulk_out(struct usbd_class_data *const c_data)
 	return desc->if0_out_ep.bEndpointAddress;
 }
 
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+static void msc_queue_data_out(struct msc_bot_ctx *ctx)
+{
+	struct net_buf *buf;
+	uint8_t ep;
+	size_t len;
+	int ret;
+
+	ep = msc_get_bulk_out(ctx->class_node);
+
+	while (ctx->data_out_queued < CONFIG_USBD_MSC_DATA_BUFFERS) {
+		/* Never queue more than the host is going to send, otherwise
+		 * the transfer would swallow the next CBW.
+		 */
+		len = MIN(CONFIG_USBD_MSC_SCSI_BUFFER_SIZE,
+			  ctx->cbw.dCBWDataTransferLength - ctx->transferred_data -
+			  ctx->data_out_bytes);
+		if (len == 0) {
+			break;
+		}
+
+		buf = msc_data_buf_alloc(ctx, ep, len);
+		if (!buf) {
+			break;
+		}
+
+		ret = usbd_ep_enqueue(ctx->class_node, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			msc_data_buf_release(ctx, buf);
+			net_buf_unref(buf);
+			break;
+		}
+
+		ctx->data_out_queued++;
+		ctx->data_out_bytes += len;
+	}
+}
+#endif
+
 static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 {
 	struct msc_bot_ctx *ctx = usbd_class_get_private(c_data);
@@ -177,6 +286,14 @@ static void msc_queue_bulk_out_ep(struct usbd_class_data *const c_data)
 	uint8_t ep;
 	int ret;
 
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+	if (ctx->state == MSC_BBB_PROCESS_WRITE) {
+		/* Keep receiving data while the SCSI layer writes the disk */
+		msc_queue_data_out(ctx);
+		return;
+	}
+#endif
+
 	if (atomic_test_and_set_bit(&ctx->bits, MSC_BULK_OUT_QUEUED)) {
 		/* Already queued */
 		return;
@@ -249,6 +366,89 @@ static bool is_cbw_meaningful(struct msc_bot_ctx *const ctx)
 	return true;
 }
 
+static void msc_finish_read(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	if (ctx->csw.dCSWDataResidue > 0) {
+		/* Case (5) Hi > Di
+		 * While we may have sent short packet, device
+		 * shall STALL the Bulk-In pipe (if it does not
+		 * send padding data).
+		 */
+		msc_stall_bulk_in_ep(ctx->class_node);
+	}
+	if (scsi_cmd_get_status(lun) == GOOD) {
+		ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
+	} else {
+		ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
+	}
+	ctx->state = MSC_BBB_SEND_CSW;
+}
+
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+static bool msc_read_done(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+
+	return ctx->data_in_queued == 0 && ctx->scsi_bytes == 0 &&
+	       scsi_cmd_remaining_data_len(lun) == 0;
+}
+
+/* Every free data buffer is filled by the SCSI layer and queued right away,
+ * so that the disk is read while the previously queued buffers are sent.
+ */
+static void msc_process_read(struct msc_bot_ctx *ctx)
+{
+	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
+	struct net_buf *buf;
+	uint8_t ep;
+	size_t len;
+	int ret;
+
+	ep = msc_get_bulk_in(ctx->class_node);
+
+	while (ctx->data_in_queued < CONFIG_USBD_MSC_DATA_BUFFERS &&
+	       (ctx->scsi_bytes > 0 || scsi_cmd_remaining_data_len(lun) > 0)) {
+		buf = msc_data_buf_alloc(ctx, ep, MSC_DATA_BUF_SIZE);
+		if (!buf) {
+			break;
+		}
+
+		if (ctx->scsi_bytes > 0) {
+			/* Command response, e.g. INQUIRY data */
+			net_buf_add_mem(buf, ctx->scsi_buf, ctx->scsi_bytes);
+			ctx->scsi_bytes = 0;
+		} else {
+			len = scsi_read_data(lun, buf->data);
+			net_buf_add(buf, len);
+		}
+
+		if (buf->len == 0) {
+			/* SCSI layer terminated the transfer */
+			msc_data_buf_release(ctx, buf);
+			net_buf_unref(buf);
+			break;
+		}
+
+		ctx->csw.dCSWDataResidue -= buf->len;
+		ret = usbd_ep_enqueue(ctx->class_node, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			msc_data_buf_release(ctx, buf);
+			net_buf_unref(buf);
+			break;
+		}
+
+		ctx->data_in_queued++;
+	}
+
+	if (msc_read_done(ctx)) {
+		/* Nothing was queued, e.g. the disk read failed */
+		msc_finish_read(ctx);
+	}
+}
+#else
 static void msc_process_read(struct msc_bot_ctx *ctx)
 {
 	struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
@@ -307,6 +507,7 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
 	}
 }
+#endif
 
 static void msc_process_cbw(struct msc_bot_ctx *ctx)
 {
@@ -399,6 +600,24 @@ static void msc_process_write(struct msc_bot_ctx *ctx,
 	ctx->transferred_data += len;
 
 	while ((len > 0) && (scsi_cmd_remaining_data_len(lun) > 0)) {
+		if ((ctx->scsi_bytes == 0) &&
+		    ((len >= sizeof(ctx->scsi_buf)) ||
+		     (len >= scsi_cmd_remaining_data_len(lun)))) {
+			/* Received data holds at least one sector, pass it to
+			 * SCSI layer without copying it to SCSI buffer.
+			 */
+			tmp = scsi_write_data(lun, buf, len);
+			__ASSERT(tmp <= len, "Processed more data than requested");
+			if (tmp == 0) {
+				LOG_WRN("SCSI handler didn't process %zu bytes", len);
+			}
+
+			ctx->csw.dCSWDataResidue -= tmp;
+			buf += tmp;
+			len -= tmp;
+			continue;
+		}
+
 		/* Copy received data to the end of SCSI buffer */
 		tmp = MIN(len, sizeof(ctx->scsi_buf) - ctx->scsi_bytes);
 		memcpy(&ctx->scsi_buf[ctx->scsi_bytes], buf, tmp);
@@ -510,24 +729,13 @@ static void msc_handle_bulk_in(struct msc_bot_ctx *ctx,
 		LOG_DBG("CSW sent");
 		ctx->state = MSC_BBB_EXPECT_CBW;
 	} else if (ctx->state == MSC_BBB_PROCESS_READ) {
-		struct scsi_ctx *lun = &ctx->luns[ctx->cbw.bCBWLUN];
-
 		ctx->transferred_data += len;
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+		if (msc_read_done(ctx)) {
+#else
 		if (ctx->scsi_bytes == 0) {
-			if (ctx->csw.dCSWDataResidue > 0) {
-				/* Case (5) Hi > Di
-				 * While we may have sent short packet, device
-				 * shall STALL the Bulk-In pipe (if it does not
-				 * send padding data).
-				 */
-				msc_stall_bulk_in_ep(ctx->class_node);
-			}
-			if (scsi_cmd_get_status(lun) == GOOD) {
-				ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_PASSED;
-			} else {
-				ctx->csw.bCSWStatus = CSW_STATUS_COMMAND_FAILED;
-			}
-			ctx->state = MSC_BBB_SEND_CSW;
+#endif
+			msc_finish_read(ctx);
 		}
 	}
 }
@@ -571,6 +779,18 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	struct udc_buf_info *bi;
 
 	bi = udc_get_buf_info(buf);
+
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+	if (msc_is_data_buf(buf)) {
+		if (bi->ep == msc_get_bulk_out(c_data)) {
+			ctx->data_out_queued--;
+			ctx->data_out_bytes -= buf->size;
+		} else {
+			ctx->data_in_queued--;
+		}
+	}
+#endif
+
 	if (err) {
 		if (err == -ECONNABORTED) {
 			LOG_WRN("request ep 0x%02x, len %u cancelled",
@@ -590,6 +810,14 @@ static void usbd_msc_handle_request(struct usbd_class_data *c_data,
 	}
 
 ep_request_error:
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+	if (msc_is_data_buf(buf)) {
+		msc_data_buf_release(ctx, buf);
+		usbd_ep_buf_free(uds_ctx, buf);
+		return;
+	}
+#endif
+
 	if (bi->ep == msc_get_bulk_out(c_data)) {
 		atomic_clear_bit(&ctx->bits, MSC_BULK_OUT_QUEUED);
 	} else if (bi->ep == msc_get_bulk_in(c_data)) {
@@ -645,7 +873,10 @@ static void usbd_msc_thread(void *arg1, void *arg2, void *arg3)
 			msc_process_read(ctx);
 		} else if (ctx->state == MSC_BBB_PROCESS_WRITE) {
 			msc_queue_bulk_out_ep(evt.c_data);
-		} else if (ctx->state == MSC_BBB_SEND_CSW) {
+		}
+
+		/* Read processing can finish without queuing any data */
+		if (ctx->state == MSC_BBB_SEND_CSW) {
 			msc_send_csw(ctx);
 		}
 	}
@@ -863,11 +1094,25 @@ struct usbd_class_api msc_bot_api = {
 	.init = msc_bot_init,
 };
 
+#if CONFIG_USBD_MSC_DATA_BUFFERS > 0
+#define DEFINE_MSC_BOT_DATA_BUFS(x)					\
+	static uint8_t __aligned(UDC_BUF_ALIGN)				\
+		msc_data_bufs_##x[CONFIG_USBD_MSC_DATA_BUFFERS][MSC_DATA_BUF_SIZE];
+#define MSC_BOT_DATA_BUFS_INIT(x)					\
+	.data_bufs = msc_data_bufs_##x,					\
+	.data_free = MSC_DATA_BUFS_FREE,
+#else
+#define DEFINE_MSC_BOT_DATA_BUFS(x)
+#define MSC_BOT_DATA_BUFS_INIT(x)
+#endif
+
 #define DEFINE_MSC_BOT_CLASS_DATA(x, _)					\
+	DEFINE_MSC_BOT_DATA_BUFS(x)					\
 	static struct msc_bot_ctx msc_bot_ctx_##x = {			\
 		.desc = &msc_bot_desc_##x,				\
 		.fs_desc = msc_bot_fs_desc_##x,				\
 		.hs_desc = msc_bot_hs_desc_##x,				\
+		MSC_BOT_DATA_BUFS_INIT(x)				\
 	};								\
 									\
 	USBD_DEFINE_CLASS(msc_##x, &msc_bot_api, &msc_bot_ctx_##x,	\
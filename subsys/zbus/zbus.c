@@ -8,6 +8,7 @@
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/printk.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/zbus/zbus.h>
 LOG_MODULE_REGISTER(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -50,8 +51,101 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 }
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_DYNAMIC */
 
+#if defined(CONFIG_ZBUS_MSG_SUBSCRIBER_SHARED_BUF)
+
+/* User data of a reference, starting with the channel as the user data of the message buffer */
+struct zbus_msg_ref_user_data {
+	const struct zbus_channel *chan;
+	struct net_buf *msg_buf;
+};
+
+/* Serializes the reference count of the message buffers, shared by the subscriber threads */
+static struct k_spinlock _zbus_msg_ref_slock;
+
+static void _zbus_msg_ref_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_DEFINE(_zbus_msg_refs_pool, CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_SIZE, 0,
+		    sizeof(struct zbus_msg_ref_user_data), _zbus_msg_ref_destroy);
+
+static inline void _zbus_msg_buf_unref(struct net_buf *buf)
+{
+	K_SPINLOCK(&_zbus_msg_ref_slock) {
+		net_buf_unref(buf);
+	}
+}
+
+static void _zbus_msg_ref_destroy(struct net_buf *buf)
+{
+	struct zbus_msg_ref_user_data *ud = net_buf_user_data(buf);
+	struct net_buf *msg_buf = ud->msg_buf;
+
+	net_buf_destroy(buf);
+
+	_zbus_msg_buf_unref(msg_buf);
+}
+
+/* Returns a reference to the message of buf, delivered to one message subscriber */
+static struct net_buf *_zbus_msg_buf_ref(struct net_buf *buf, k_timepoint_t end_time)
+{
+	struct zbus_msg_ref_user_data *ud;
+	struct net_buf *ref;
+
+	ref = net_buf_alloc_with_data(&_zbus_msg_refs_pool, buf->data, buf->len,
+				      sys_timepoint_timeout(end_time));
+	if (ref == NULL) {
+		return NULL;
+	}
+
+	ud = net_buf_user_data(ref);
+	memcpy(&ud->chan, net_buf_user_data(buf), sizeof(struct zbus_channel *));
+
+	K_SPINLOCK(&_zbus_msg_ref_slock) {
+		ud->msg_buf = net_buf_ref(buf);
+	}
+
+	return ref;
+}
+
+#else
+
+static inline void _zbus_msg_buf_unref(struct net_buf *buf)
+{
+	net_buf_unref(buf);
+}
+
+static inline struct net_buf *_zbus_msg_buf_ref(struct net_buf *buf, k_timepoint_t end_time)
+{
+	return net_buf_clone(buf, sys_timepoint_timeout(end_time));
+}
+
+#endif /* CONFIG_ZBUS_MSG_SUBSCRIBER_SHARED_BUF */
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if CONFIG_ZBUS_DISPATCH_THREADS > 0
+
+/* State of the publication being dispatched in parallel */
+static struct {
+	const struct zbus_channel *chan;
+	k_timepoint_t end_time;
+	struct net_buf *buf;
+	/* Next static observation to notify */
+	atomic_t next_idx;
+	atomic_t last_error;
+} _zbus_dispatch;
+
+static K_SEM_DEFINE(_zbus_dispatch_lock, 1, 1);
+static K_SEM_DEFINE(_zbus_dispatch_start, 0, CONFIG_ZBUS_DISPATCH_THREADS);
+static K_SEM_DEFINE(_zbus_dispatch_done, 0, CONFIG_ZBUS_DISPATCH_THREADS);
+
+static K_KERNEL_STACK_ARRAY_DEFINE(_zbus_dispatch_stacks, CONFIG_ZBUS_DISPATCH_THREADS,
+				   CONFIG_ZBUS_DISPATCH_THREAD_STACK_SIZE);
+static struct k_thread _zbus_dispatch_threads[CONFIG_ZBUS_DISPATCH_THREADS];
+
+static void _zbus_dispatch_thread(void *p1, void *p2, void *p3);
+
+#endif /* CONFIG_ZBUS_DISPATCH_THREADS */
+
 int _zbus_init(void)
 {
 
@@ -75,6 +169,16 @@ int _zbus_init(void)
 		++(curr->data->observers_end_idx);
 	}
 
+#if CONFIG_ZBUS_DISPATCH_THREADS > 0
+	for (int i = 0; i < CONFIG_ZBUS_DISPATCH_THREADS; i++) {
+		k_thread_create(&_zbus_dispatch_threads[i], _zbus_dispatch_stacks[i],
+				K_KERNEL_STACK_SIZEOF(_zbus_dispatch_stacks[i]),
+				_zbus_dispatch_thread, NULL, NULL, NULL,
+				ZBUS_MIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&_zbus_dispatch_threads[i], "zbus_dispatch");
+	}
+#endif /* CONFIG_ZBUS_DISPATCH_THREADS */
+
 	return 0;
 }
 SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
@@ -93,7 +197,7 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	}
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		struct net_buf *cloned_buf = _zbus_msg_buf_ref(buf, end_time);
 
 		if (cloned_buf == NULL) {
 			return -ENOMEM;
@@ -111,16 +215,144 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	return 0;
 }
 
+static int _zbus_notify_observation(const struct zbus_channel *chan, int16_t idx,
+				   k_timepoint_t end_time, struct net_buf *buf)
+{
+	struct zbus_channel_observation *observation;
+	struct zbus_channel_observation_mask *observation_mask;
+	int err;
+
+	STRUCT_SECTION_GET(zbus_channel_observation, idx, &observation);
+	STRUCT_SECTION_GET(zbus_channel_observation_mask, idx, &observation_mask);
+
+	_ZBUS_ASSERT(observation != NULL, "observation must be not NULL");
+
+	const struct zbus_observer *obs = observation->obs;
+
+	if (!obs->data->enabled || observation_mask->enabled) {
+		return 0;
+	}
+
+	err = _zbus_notify_observer(chan, obs, end_time, buf);
+
+	if (err) {
+		LOG_ERR("could not deliver notification to observer %s. Error code %d",
+			_ZBUS_OBS_NAME(obs), err);
+	}
+
+	LOG_DBG(" %d -> %s", idx - chan->data->observers_start_idx, _ZBUS_OBS_NAME(obs));
+
+	return err;
+}
+
+#if CONFIG_ZBUS_DISPATCH_THREADS > 0
+
+static void _zbus_dispatch_run(void)
+{
+	const int16_t limit = _zbus_dispatch.chan->data->observers_end_idx;
+	int err;
+
+	for (int16_t i = atomic_inc(&_zbus_dispatch.next_idx); i < limit;
+	     i = atomic_inc(&_zbus_dispatch.next_idx)) {
+		err = _zbus_notify_observation(_zbus_dispatch.chan, i, _zbus_dispatch.end_time,
+					       _zbus_dispatch.buf);
+		if (err == -ENOMEM) {
+			/* Stop every dispatcher, as the sequential dispatch does */
+			atomic_set(&_zbus_dispatch.last_error, err);
+			atomic_set(&_zbus_dispatch.next_idx, limit);
+		} else if (err) {
+			atomic_cas(&_zbus_dispatch.last_error, 0, err);
+		}
+	}
+}
+
+static void _zbus_dispatch_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&_zbus_dispatch_start, K_FOREVER);
+
+		_zbus_dispatch_run();
+
+		k_sem_give(&_zbus_dispatch_done);
+	}
+}
+
+static int _zbus_dispatch_parallel(const struct zbus_channel *chan, k_timepoint_t end_time,
+				   struct net_buf *buf)
+{
+	const int count = chan->data->observers_end_idx - chan->data->observers_start_idx;
+	const int helpers = MIN(CONFIG_ZBUS_DISPATCH_THREADS, count - 1);
+	const int prio = k_thread_priority_get(k_current_get());
+
+	_zbus_dispatch.chan = chan;
+	_zbus_dispatch.end_time = end_time;
+	_zbus_dispatch.buf = buf;
+	atomic_set(&_zbus_dispatch.next_idx, chan->data->observers_start_idx);
+	atomic_set(&_zbus_dispatch.last_error, 0);
+
+	for (int i = 0; i < helpers; i++) {
+		/* Helpers run with the publisher priority, including its priority boost */
+		k_thread_priority_set(&_zbus_dispatch_threads[i], prio);
+		k_sem_give(&_zbus_dispatch_start);
+	}
+
+	_zbus_dispatch_run();
+
+	for (int i = 0; i < helpers; i++) {
+		k_sem_take(&_zbus_dispatch_done, K_FOREVER);
+	}
+
+	return atomic_get(&_zbus_dispatch.last_error);
+}
+
+#endif /* CONFIG_ZBUS_DISPATCH_THREADS */
+
+static int _zbus_notify_static_observers(const struct zbus_channel *chan, k_timepoint_t end_time,
+					 struct net_buf *buf)
+{
+	int err;
+	int last_error = 0;
+
+#if CONFIG_ZBUS_DISPATCH_THREADS > 0
+	/* Publications from ISRs, from a listener being dispatched in parallel or to a single
+	 * observer are dispatched sequentially.
+	 */
+	if (!k_is_in_isr() &&
+	    chan->data->observers_end_idx - chan->data->observers_start_idx > 1 &&
+	    k_sem_take(&_zbus_dispatch_lock, K_NO_WAIT) == 0) {
+		err = _zbus_dispatch_parallel(chan, end_time, buf);
+
+		k_sem_give(&_zbus_dispatch_lock);
+
+		return err;
+	}
+#endif /* CONFIG_ZBUS_DISPATCH_THREADS */
+
+	for (int16_t i = chan->data->observers_start_idx, limit = chan->data->observers_end_idx;
+	     i < limit; ++i) {
+		err = _zbus_notify_observation(chan, i, end_time, buf);
+
+		if (err) {
+			last_error = err;
+			if (err == -ENOMEM) {
+				break;
+			}
+		}
+	}
+
+	return last_error;
+}
+
 static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t end_time)
 {
 	int err = 0;
 	int last_error = 0;
 	struct net_buf *buf = NULL;
 
-	/* Static observer event dispatcher logic */
-	struct zbus_channel_observation *observation;
-	struct zbus_channel_observation_mask *observation_mask;
-
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	struct net_buf_pool *pool =
 		COND_CODE_1(CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_ISOLATION,
@@ -138,36 +370,15 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 
 	LOG_DBG("Notifing %s's observers. Starting VDED:", _ZBUS_CHAN_NAME(chan));
 
-	int __maybe_unused index = 0;
-
-	for (int16_t i = chan->data->observers_start_idx, limit = chan->data->observers_end_idx;
-	     i < limit; ++i) {
-		STRUCT_SECTION_GET(zbus_channel_observation, i, &observation);
-		STRUCT_SECTION_GET(zbus_channel_observation_mask, i, &observation_mask);
-
-		_ZBUS_ASSERT(observation != NULL, "observation must be not NULL");
-
-		const struct zbus_observer *obs = observation->obs;
-
-		if (!obs->data->enabled || observation_mask->enabled) {
-			continue;
-		}
-
-		err = _zbus_notify_observer(chan, obs, end_time, buf);
+	/* Static observer event dispatcher logic */
+	err = _zbus_notify_static_observers(chan, end_time, buf);
 
-		if (err) {
-			last_error = err;
-			LOG_ERR("could not deliver notification to observer %s. Error code %d",
-				_ZBUS_OBS_NAME(obs), err);
-			if (err == -ENOMEM) {
-				if (IS_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER)) {
-					net_buf_unref(buf);
-				}
-				return err;
-			}
+	if (err) {
+		last_error = err;
+		if (err == -ENOMEM) {
+			IF_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER, (_zbus_msg_buf_unref(buf);))
+			return err;
 		}
-
-		LOG_DBG(" %d -> %s", index++, _ZBUS_OBS_NAME(obs));
 	}
 
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS)
@@ -189,7 +400,7 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	}
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 
-	IF_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER, (net_buf_unref(buf);))
+	IF_ENABLED(CONFIG_ZBUS_MSG_SUBSCRIBER, (_zbus_msg_buf_unref(buf);))
 
 	return last_error;
 }
@@ -277,6 +488,61 @@ static inline void update_all_channels_hop(const struct zbus_observer *obs)
 
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 
+#if CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE > 0
+
+/* Called with the channel locked, before changing the message */
+static inline void chan_seq_begin(const struct zbus_channel *chan)
+{
+	atomic_inc(&chan->data->seq);
+	barrier_dmem_fence_full();
+}
+
+/* Called with the channel locked, after changing the message */
+static inline void chan_seq_end(const struct zbus_channel *chan)
+{
+	barrier_dmem_fence_full();
+	atomic_inc(&chan->data->seq);
+}
+
+static bool chan_read_lockless(const struct zbus_channel *chan, void *msg)
+{
+	atomic_val_t seq;
+
+	if (chan->message_size > CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE) {
+		return false;
+	}
+
+	/* A single retry: a writer preempted on this CPU would not finish while spinning */
+	for (int attempt = 0; attempt < 2; attempt++) {
+		seq = atomic_get(&chan->data->seq);
+		if (seq & 1) {
+			continue;
+		}
+
+		memcpy(msg, chan->message, chan->message_size);
+
+		barrier_dmem_fence_full();
+
+		if (atomic_get(&chan->data->seq) == seq) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#else
+
+static inline void chan_seq_begin(const struct zbus_channel *chan)
+{
+}
+
+static inline void chan_seq_end(const struct zbus_channel *chan)
+{
+}
+
+#endif /* CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE */
+
 static inline int chan_lock(const struct zbus_channel *chan, k_timeout_t timeout, int *prio)
 {
 	bool boosting = false;
@@ -360,7 +626,9 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
+	chan_seq_begin(chan);
 	memcpy(chan->message, msg, chan->message_size);
+	chan_seq_end(chan);
 
 	err = _zbus_vded_exec(chan, end_time);
 
@@ -374,6 +642,12 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 	_ZBUS_ASSERT(msg != NULL, "msg is required");
 
+#if CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE > 0
+	if (chan_read_lockless(chan, msg)) {
+		return 0;
+	}
+#endif /* CONFIG_ZBUS_LOCKLESS_READ_MAX_SIZE */
+
 	if (k_is_in_isr()) {
 		timeout = K_NO_WAIT;
 	}
@@ -430,6 +704,9 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The claimer may change the message */
+	chan_seq_begin(chan);
+
 	return 0;
 }
 
@@ -437,6 +714,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_seq_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/ztest.h>
+
+/* Only function_hot() is relocated, using FUNCTIONS */
+__noinline int function_hot(int value)
+{
+	return value * 3;
+}
+
+__noinline int function_cold(int value)
+{
+	return value * 5;
+}
+
+ZTEST(code_relocation, test_function_filter)
+{
+	extern uintptr_t __sram2_text_reloc_start;
+	extern uintptr_t __sram2_text_reloc_end;
+
+	printk("Address of function_hot %p\n", &function_hot);
+	printk("Address of function_cold %p\n\n", &function_cold);
+
+	zassert_between_inclusive((uintptr_t)&function_hot,
+		(uintptr_t)&__sram2_text_reloc_start,
+		(uintptr_t)&__sram2_text_reloc_end,
+		"function_hot not in sram2_text region");
+	zassert_false(IN_RANGE((uintptr_t)&function_cold,
+			       (uintptr_t)&__sram2_text_reloc_start,
+			       (uintptr_t)&__sram2_text_reloc_end),
+		      "function_cold relocated to sram2_text region");
+
+	zassert_equal(function_hot(2) + function_cold(2), 16);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Measure the software CAN RX filter dispatch time of a gateway
+ *
+ * A gateway listens to a few hundred exact identifiers and a handful of
+ * masked ranges. The hashed filter set is compared with a linear scan over
+ * the same filters.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/random/random.h>
+#include <zephyr/drivers/can/can_sw_filter.h>
+
+#define EXACT_FILTERS  500
+#define MASKED_FILTERS 4
+#define MAX_FILTERS    (EXACT_FILTERS + MASKED_FILTERS)
+#define FRAMES         4096
+
+static struct can_sw_filter sw;
+static struct can_sw_filter_entry entries[MAX_FILTERS];
+static uint16_t masked[MAX_FILTERS];
+
+static struct can_filter filters[MAX_FILTERS];
+static struct can_frame frames[FRAMES];
+static uint32_t hits;
+
+static void rx_cb(const struct device *dev, struct can_frame *frame, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(frame);
+	ARG_UNUSED(user_data);
+
+	hits++;
+}
+
+static void linear_dispatch(const struct can_frame *frame)
+{
+	struct can_frame tmp_frame;
+
+	for (int i = 0; i < MAX_FILTERS; i++) {
+		if (can_frame_matches_filter(frame, &filters[i])) {
+			tmp_frame = *frame;
+			rx_cb(NULL, &tmp_frame, NULL);
+		}
+	}
+}
+
+static uint32_t measure(bool hashed)
+{
+	uint32_t start, cycles;
+
+	hits = 0U;
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < FRAMES; i++) {
+		if (hashed) {
+			can_sw_filter_dispatch(&sw, NULL, &frames[i]);
+		} else {
+			linear_dispatch(&frames[i]);
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("%-12s %d filters: %llu ns per frame\n", hashed ? "hashed" : "linear scan",
+	       MAX_FILTERS, k_cyc_to_ns_floor64(cycles) / FRAMES);
+
+	return hits;
+}
+
+ZTEST(can_sw_filter_perf, test_dispatch_time)
+{
+	uint32_t linear_hits, hashed_hits;
+
+	linear_hits = measure(false);
+	hashed_hits = measure(true);
+
+	zassert_true(linear_hits >= FRAMES / 2, "Too few matching frames");
+	zassert_equal(linear_hits, hashed_hits, "Hashed dispatch delivered %u frames, not %u",
+		      hashed_hits, linear_hits);
+}
+
+static void *can_sw_filter_perf_setup(void)
+{
+	const struct can_filter *filter;
+	int filter_id;
+	int i;
+
+	can_sw_filter_init(&sw, entries, masked, ARRAY_SIZE(entries));
+
+	/* Exact filters, half standard and half extended identifiers */
+	for (i = 0; i < EXACT_FILTERS; i++) {
+		if ((i & 1) != 0) {
+			filters[i].flags = CAN_FILTER_IDE;
+			filters[i].id = 0x18fe0000 + i;
+			filters[i].mask = CAN_EXT_ID_MASK;
+		} else {
+			filters[i].flags = 0U;
+			filters[i].id = 0x100 + i;
+			filters[i].mask = CAN_STD_ID_MASK;
+		}
+	}
+
+	/* Masked filters, diagnostic ranges */
+	for (; i < MAX_FILTERS; i++) {
+		filters[i].flags = 0U;
+		filters[i].id = 0x700 + ((i - EXACT_FILTERS) << 4);
+		filters[i].mask = 0x7f0;
+	}
+
+	for (i = 0; i < MAX_FILTERS; i++) {
+		filter_id = can_sw_filter_add(&sw, rx_cb, NULL, &filters[i]);
+		zassert_equal(filter_id, i, "Cannot add filter %d", i);
+	}
+
+	/* Three quarters of the frames hit an exact filter, the rest random */
+	for (i = 0; i < FRAMES; i++) {
+		if ((sys_rand32_get() & 3) != 0) {
+			filter = &filters[sys_rand32_get() % EXACT_FILTERS];
+			frames[i].id = filter->id;
+			frames[i].flags = (filter->flags & CAN_FILTER_IDE) != 0 ? CAN_FRAME_IDE
+										: 0U;
+		} else {
+			frames[i].id = sys_rand32_get() & CAN_STD_ID_MASK;
+			frames[i].flags = 0U;
+		}
+
+		frames[i].dlc = 8U;
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(can_sw_filter_perf, NULL, can_sw_filter_perf_setup, NULL, NULL, NULL);
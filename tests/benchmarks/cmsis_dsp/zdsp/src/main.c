@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Runs the zDSP filtering and transform functions on the selected backend,
+ * the CMSIS-DSP or the portable C one, to compare them on a given target.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/filtering.h>
+#include <zephyr/dsp/transform.h>
+#include "../../common/benchmark_common.h"
+
+#define BLOCK_SIZE 256
+#define NUM_TAPS   32
+#define NUM_STAGES 4
+#define FFT_LEN    256
+
+static q15_t src_q15[BLOCK_SIZE];
+static q15_t dst_q15[BLOCK_SIZE];
+static q15_t coeffs_q15[NUM_TAPS];
+static q15_t state_q15[ZDSP_FIR_STATE_LEN(NUM_TAPS, BLOCK_SIZE)];
+
+static float32_t src_f32[BLOCK_SIZE];
+static float32_t dst_f32[BLOCK_SIZE];
+static float32_t coeffs_f32[NUM_TAPS];
+static float32_t state_f32[ZDSP_FIR_STATE_LEN(NUM_TAPS, BLOCK_SIZE)];
+
+static float32_t fft_buf[2 * FFT_LEN];
+
+static const char *backend_name(void)
+{
+	return IS_ENABLED(CONFIG_DSP_BACKEND_CMSIS) ? "cmsis" : "portable";
+}
+
+ZTEST(zdsp_benchmark, test_benchmark_fir_q15)
+{
+	struct zdsp_fir_q15 fir = {
+		.num_taps = NUM_TAPS,
+		.state = state_q15,
+		.coeffs = coeffs_q15,
+	};
+	uint32_t irq_key, timestamp, timespan;
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_fir_q15(&fir, src_q15, dst_q15, BLOCK_SIZE);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT("%s: " BENCHMARK_TYPE " = %u\n", backend_name(), timespan);
+}
+
+ZTEST(zdsp_benchmark, test_benchmark_fir_f32)
+{
+	struct zdsp_fir_f32 fir = {
+		.num_taps = NUM_TAPS,
+		.state = state_f32,
+		.coeffs = coeffs_f32,
+	};
+	uint32_t irq_key, timestamp, timespan;
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_fir_f32(&fir, src_f32, dst_f32, BLOCK_SIZE);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT("%s: " BENCHMARK_TYPE " = %u\n", backend_name(), timespan);
+}
+
+ZTEST(zdsp_benchmark, test_benchmark_biquad_df2t_f32)
+{
+	static const float32_t coeffs[5 * NUM_STAGES] = {
+		0.2f, 0.4f, 0.2f, 0.5f, -0.3f,
+		0.2f, 0.4f, 0.2f, 0.5f, -0.3f,
+		0.2f, 0.4f, 0.2f, 0.5f, -0.3f,
+		0.2f, 0.4f, 0.2f, 0.5f, -0.3f,
+	};
+	float32_t state[2 * NUM_STAGES] = {0};
+	struct zdsp_biquad_df2t_f32 biquad = {
+		.num_stages = NUM_STAGES,
+		.state = state,
+		.coeffs = coeffs,
+	};
+	uint32_t irq_key, timestamp, timespan;
+
+	benchmark_begin(&irq_key, &timestamp);
+	zdsp_biquad_df2t_f32(&biquad, src_f32, dst_f32, BLOCK_SIZE);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	TC_PRINT("%s: " BENCHMARK_TYPE " = %u\n", backend_name(), timespan);
+}
+
+ZTEST(zdsp_benchmark, test_benchmark_cfft_f32)
+{
+	uint32_t irq_key, timestamp, timespan;
+	int ret;
+
+	benchmark_begin(&irq_key, &timestamp);
+	ret = zdsp_cfft_f32(fft_buf, FFT_LEN, false);
+	timespan = benchmark_end(irq_key, timestamp);
+
+	zassert_ok(ret);
+
+	TC_PRINT("%s: " BENCHMARK_TYPE " = %u\n", backend_name(), timespan);
+}
+
+static void *zdsp_benchmark_setup(void)
+{
+	for (int i = 0; i < NUM_TAPS; i++) {
+		coeffs_q15[i] = (q15_t)(0x7fff / NUM_TAPS);
+		coeffs_f32[i] = 1.0f / NUM_TAPS;
+	}
+
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		src_q15[i] = (q15_t)((i * 2654435761U) >> 16);
+		src_f32[i] = (float32_t)src_q15[i] / 32768.0f;
+	}
+
+	for (int i = 0; i < 2 * FFT_LEN; i++) {
+		fft_buf[i] = src_f32[i % BLOCK_SIZE];
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(zdsp_benchmark, NULL, zdsp_benchmark_setup, NULL, NULL, NULL);
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark comparing the Hashmap implementations on
+ * a table of CONFIG_BENCHMARK_HASH_MAP_ENTRIES entries: insertions, lookups
+ * of present and absent keys, replacements, and removals interleaved with
+ * insertions as in a flow table.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/timing/timing.h>
+
+#define N CONFIG_BENCHMARK_HASH_MAP_ENTRIES
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_OA_GP_DEFINE_STATIC(oa_gp_map);
+
+/* Spread consecutive indices over the key space, as flow identifiers are */
+static inline uint64_t key_of(size_t i)
+{
+	return i * 0x9e3779b97f4a7c15ULL;
+}
+
+static void report(const char *name, const char *op, timing_t *start, timing_t *finish,
+		   size_t n_ops)
+{
+	uint64_t cycles = timing_cycles_get(start, finish);
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	printk("%-6s %-8s %10llu nsec, %6llu cycles / %6llu nsec per operation\n", name, op, ns,
+	       cycles / n_ops, ns / n_ops);
+}
+
+static void benchmark(const char *name, struct sys_hashmap *map)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t value;
+	int ret;
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < N; ++i) {
+		ret = sys_hashmap_insert(map, key_of(i), i, NULL);
+		zassert_equal(1, ret, "%s: failed to insert key %zu: %d", name, i, ret);
+	}
+	finish = timing_counter_get();
+	report(name, "insert", &start, &finish, N);
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < N; ++i) {
+		zassert_true(sys_hashmap_get(map, key_of(i), &value));
+	}
+	finish = timing_counter_get();
+	report(name, "hit", &start, &finish, N);
+
+	start = timing_counter_get();
+	for (size_t i = N; i < 2 * N; ++i) {
+		zassert_false(sys_hashmap_get(map, key_of(i), NULL));
+	}
+	finish = timing_counter_get();
+	report(name, "miss", &start, &finish, N);
+
+	start = timing_counter_get();
+	for (size_t i = 0; i < N; ++i) {
+		zassert_equal(0, sys_hashmap_insert(map, key_of(i), ~i, NULL));
+	}
+	finish = timing_counter_get();
+	report(name, "replace", &start, &finish, N);
+
+	/* expire the oldest flow for every new one, lookups go through removed entries */
+	start = timing_counter_get();
+	for (size_t i = N; i < 2 * N; ++i) {
+		zassert_true(sys_hashmap_remove(map, key_of(i - N), NULL));
+		ret = sys_hashmap_insert(map, key_of(i), i, NULL);
+		zassert_true(ret >= 0, "%s: failed to insert key %zu: %d", name, i, ret);
+	}
+	finish = timing_counter_get();
+	report(name, "churn", &start, &finish, N);
+
+	start = timing_counter_get();
+	for (size_t i = N; i < 2 * N; ++i) {
+		zassert_true(sys_hashmap_get(map, key_of(i), &value));
+		zassert_equal(i, value);
+	}
+	finish = timing_counter_get();
+	report(name, "hit", &start, &finish, N);
+
+	start = timing_counter_get();
+	for (size_t i = N; i < 2 * N; ++i) {
+		zassert_true(sys_hashmap_remove(map, key_of(i), NULL));
+	}
+	finish = timing_counter_get();
+	report(name, "remove", &start, &finish, N);
+
+	zassert_true(sys_hashmap_is_empty(map));
+}
+
+ZTEST(hash_map_perf, test_separate_chaining)
+{
+	benchmark("sc", &sc_map);
+}
+
+ZTEST(hash_map_perf, test_open_addressing_linear_probe)
+{
+	benchmark("oa_lp", &oa_lp_map);
+}
+
+ZTEST(hash_map_perf, test_open_addressing_group_probe)
+{
+	benchmark("oa_gp", &oa_gp_map);
+}
+
+static void *setup(void)
+{
+	timing_init();
+	timing_start();
+
+	printk("%u entries\n", N);
+
+	return NULL;
+}
+
+static void teardown(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	timing_stop();
+}
+
+static void after(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	(void)sys_hashmap_clear(&sc_map, NULL, NULL);
+	(void)sys_hashmap_clear(&oa_lp_map, NULL, NULL);
+	(void)sys_hashmap_clear(&oa_gp_map, NULL, NULL);
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, setup, NULL, after, teardown);
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the cost of decoding a
+ * configuration object with json_obj_parse(), depending on the order
+ * of its keys.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/data/json.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_INTS    28
+#define NUM_BOOLS   6
+#define NUM_STRINGS 6
+#define NUM_FIELDS  (NUM_INTS + NUM_BOOLS + NUM_STRINGS)
+
+struct config {
+	int32_t ints[NUM_INTS];
+	bool bools[NUM_BOOLS];
+	const char *strings[NUM_STRINGS];
+};
+
+#define INT_DESCR(n, name)                                                                         \
+	{                                                                                          \
+		.field_name = name,                                                                \
+		.align_shift = Z_ALIGN_SHIFT(struct config),                                       \
+		.field_name_len = sizeof(name) - 1,                                                \
+		.type = JSON_TOK_NUMBER,                                                           \
+		.offset = offsetof(struct config, ints[n]),                                        \
+	}
+
+#define BOOL_DESCR(n, name)                                                                        \
+	{                                                                                          \
+		.field_name = name,                                                                \
+		.align_shift = Z_ALIGN_SHIFT(struct config),                                       \
+		.field_name_len = sizeof(name) - 1,                                                \
+		.type = JSON_TOK_TRUE,                                                             \
+		.offset = offsetof(struct config, bools[n]),                                       \
+	}
+
+#define STRING_DESCR(n, name)                                                                      \
+	{                                                                                          \
+		.field_name = name,                                                                \
+		.align_shift = Z_ALIGN_SHIFT(struct config),                                       \
+		.field_name_len = sizeof(name) - 1,                                                \
+		.type = JSON_TOK_STRING,                                                           \
+		.offset = offsetof(struct config, strings[n]),                                     \
+	}
+
+/* Names of similar lengths and prefixes, as is common in configurations */
+static const struct json_obj_descr config_descr[] = {
+	INT_DESCR(0, "tx_power"),          INT_DESCR(1, "rx_gain"),
+	INT_DESCR(2, "channel"),           INT_DESCR(3, "channel_mask"),
+	INT_DESCR(4, "scan_interval"),     INT_DESCR(5, "scan_window"),
+	INT_DESCR(6, "conn_interval_min"), INT_DESCR(7, "conn_interval_max"),
+	INT_DESCR(8, "conn_latency"),      INT_DESCR(9, "conn_timeout"),
+	INT_DESCR(10, "adv_interval"),     INT_DESCR(11, "adv_timeout"),
+	INT_DESCR(12, "sample_rate"),      INT_DESCR(13, "sample_count"),
+	INT_DESCR(14, "report_period"),    INT_DESCR(15, "report_retries"),
+	INT_DESCR(16, "batt_low_mv"),      INT_DESCR(17, "batt_crit_mv"),
+	INT_DESCR(18, "temp_low"),         INT_DESCR(19, "temp_high"),
+	INT_DESCR(20, "log_level"),        INT_DESCR(21, "log_backend"),
+	INT_DESCR(22, "watchdog_ms"),      INT_DESCR(23, "sleep_ms"),
+	INT_DESCR(24, "retry_ms"),         INT_DESCR(25, "retry_max"),
+	INT_DESCR(26, "port"),             INT_DESCR(27, "mtu"),
+	BOOL_DESCR(0, "enabled"),          BOOL_DESCR(1, "scan_active"),
+	BOOL_DESCR(2, "adv_connectable"),  BOOL_DESCR(3, "log_timestamps"),
+	BOOL_DESCR(4, "dhcp"),             BOOL_DESCR(5, "tls"),
+	STRING_DESCR(0, "name"),           STRING_DESCR(1, "server"),
+	STRING_DESCR(2, "ssid"),           STRING_DESCR(3, "timezone"),
+	STRING_DESCR(4, "device_id"),      STRING_DESCR(5, "fw_channel"),
+};
+
+BUILD_ASSERT(ARRAY_SIZE(config_descr) == NUM_FIELDS);
+
+static char document[2048];
+static char scratch[sizeof(document)];
+
+static size_t append_field(size_t len, size_t i, const char *prefix)
+{
+	const struct json_obj_descr *descr = &config_descr[i];
+	const char *sep = (len == 1) ? "" : ",";
+
+	switch (descr->type) {
+	case JSON_TOK_NUMBER:
+		return len + snprintk(&document[len], sizeof(document) - len, "%s\"%s%s\":%u",
+				      sep, prefix, descr->field_name, 1000U + i);
+	case JSON_TOK_TRUE:
+		return len + snprintk(&document[len], sizeof(document) - len, "%s\"%s%s\":%s",
+				      sep, prefix, descr->field_name, (i & 1U) ? "true" : "false");
+	default:
+		return len + snprintk(&document[len], sizeof(document) - len, "%s\"%s%s\":\"%s\"",
+				      sep, prefix, descr->field_name, "value-of-a-string");
+	}
+}
+
+enum order {
+	IN_ORDER,
+	REVERSED,
+	INTERLEAVED,
+};
+
+static size_t build_document(enum order order)
+{
+	size_t len = 0;
+
+	document[len++] = '{';
+
+	for (size_t n = 0; n < NUM_FIELDS; n++) {
+		size_t i = (order == REVERSED) ? NUM_FIELDS - 1 - n : n;
+
+		len = append_field(len, i, "");
+
+		/* Fields of another version of the configuration */
+		if (order == INTERLEAVED && (n % 4) == 0) {
+			len = append_field(len, i, "x_");
+		}
+	}
+
+	document[len++] = '}';
+
+	return len;
+}
+
+static int bench(const char *name, enum order order)
+{
+	size_t len = build_document(order);
+	uint64_t cycles = 0;
+	struct config config;
+	int64_t ret = 0;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		timing_t start;
+		timing_t finish;
+
+		/* Parsing terminates strings in place */
+		memcpy(scratch, document, len);
+
+		start = timing_counter_get();
+		ret = json_obj_parse(scratch, len, config_descr, ARRAY_SIZE(config_descr),
+				     &config);
+		finish = timing_counter_get();
+
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	if (ret != (int64_t)BIT64_MASK(NUM_FIELDS)) {
+		printk("%-12s decoding failed: %lld\n", name, (long long)ret);
+		return 1;
+	}
+
+	cycles /= CONFIG_BENCHMARK_NUM_ITERATIONS;
+	printk("%-12s %4zu bytes: %8llu cycles (%8u nsec), %6llu cycles per field\n", name, len,
+	       cycles, (uint32_t)timing_cycles_to_ns(cycles), cycles / NUM_FIELDS);
+
+	return 0;
+}
+
+int main(void)
+{
+	int errors = 0;
+
+	timing_init();
+
+	printk("JSON decoding of %u fields, %u iterations\n", NUM_FIELDS,
+	       CONFIG_BENCHMARK_NUM_ITERATIONS);
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	errors += bench("in order", IN_ORDER);
+	errors += bench("reversed", REVERSED);
+	errors += bench("interleaved", INTERLEAVED);
+
+	timing_stop();
+
+	TC_END_REPORT(errors == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time the kernel needs to
+ * validate a dynamically allocated kernel object, as every system call
+ * taking one does, while a varying number of other dynamic objects are
+ * alive.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+static void *objects[CONFIG_BENCHMARK_NUM_OBJECTS];
+
+static void measure(unsigned int live)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		/* Spread lookups over all live objects, oldest included */
+		void *obj = objects[(i * 7919U) % live];
+		struct k_object *ko;
+
+		start = timing_counter_get();
+		ko = k_object_find(obj);
+		(void)k_object_validate(ko, K_OBJ_SEM, _OBJ_INIT_ANY);
+		finish = timing_counter_get();
+
+		if (ko == NULL) {
+			printk("object %p not found\n", obj);
+			TC_END_REPORT(TC_FAIL);
+			return;
+		}
+
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	cycles /= CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	printk("%5u live objects: validate %7llu cycles (%7u nsec)\n",
+	       live, cycles, (uint32_t)timing_cycles_to_ns(cycles));
+}
+
+int main(void)
+{
+	unsigned int i;
+
+	timing_init();
+
+	printk("Time Measurements for dynamic kernel object lookup\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	k_thread_system_pool_assign(k_current_get());
+
+	timing_start();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_OBJECTS; i++) {
+		objects[i] = k_object_alloc(K_OBJ_SEM);
+		if (objects[i] == NULL) {
+			printk("out of memory after %u objects\n", i);
+			break;
+		}
+
+		if (((i + 1) % CONFIG_BENCHMARK_STEP) == 0) {
+			measure(i + 1);
+		}
+	}
+
+	timing_stop();
+
+	for (unsigned int j = 0; j < i; j++) {
+		k_object_free(objects[j]);
+	}
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -67,6 +67,10 @@ extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
 extern void heap_malloc_free(void);
+#ifdef CONFIG_BENCHMARK_TAIL_LATENCY
+extern void tail_latency(uint32_t num_iterations);
+extern void background_load_start(void);
+#endif
 
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
 static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
@@ -111,6 +115,15 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 
 	timestamp_overhead_init(CONFIG_BENCHMARK_NUM_ITERATIONS);
 
+#ifdef CONFIG_BENCHMARK_TAIL_LATENCY
+	/* Report latency distributions under load instead of averages */
+	background_load_start();
+	tail_latency(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	TC_END_REPORT(error_count);
+	return;
+#endif
+
 	/* Preemptive threads context switching */
 	thread_switch_yield(CONFIG_BENCHMARK_NUM_ITERATIONS, false);
 
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Background load for the latency distribution tests
+ *
+ * The load threads run below the priority of the measuring threads, so they
+ * only get the CPU between iterations. They disturb the measurements through
+ * the interrupts, locked sections and cache misses they cause.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/net/socket.h>
+#include "../utils.h"
+
+LOG_MODULE_REGISTER(background_load, LOG_LEVEL_INF);
+
+#define LOAD_STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LOAD_PRIORITY    K_PRIO_PREEMPT(12)
+/* Never yields, so it must not starve the other load threads */
+#define CACHE_PRIORITY   K_PRIO_PREEMPT(13)
+#define LOAD_BURST       8
+#define LOAD_NET_PORT    4242
+
+#if CONFIG_BENCHMARK_LOAD_CACHE_THREADS > 0
+static K_THREAD_STACK_ARRAY_DEFINE(cache_stacks, CONFIG_BENCHMARK_LOAD_CACHE_THREADS,
+				   LOAD_STACK_SIZE);
+static struct k_thread cache_threads[CONFIG_BENCHMARK_LOAD_CACHE_THREADS];
+static uint8_t cache_bufs[CONFIG_BENCHMARK_LOAD_CACHE_THREADS]
+			 [CONFIG_BENCHMARK_LOAD_CACHE_SIZE] __aligned(64);
+
+static void cache_load(void *p1, void *p2, void *p3)
+{
+	volatile uint8_t *buf = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* Touch every cache line */
+		for (size_t i = 0; i < CONFIG_BENCHMARK_LOAD_CACHE_SIZE; i += 32) {
+			buf[i]++;
+		}
+	}
+}
+#endif /* CONFIG_BENCHMARK_LOAD_CACHE_THREADS > 0 */
+
+#ifdef CONFIG_BENCHMARK_LOAD_LOGGING
+static K_THREAD_STACK_DEFINE(log_stack, LOAD_STACK_SIZE);
+static struct k_thread log_thread;
+
+static void log_load(void *p1, void *p2, void *p3)
+{
+	uint32_t count = 0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		for (int i = 0; i < LOAD_BURST; i++) {
+			LOG_INF("background load message %u", count++);
+		}
+		k_sleep(K_MSEC(1));
+	}
+}
+#endif /* CONFIG_BENCHMARK_LOAD_LOGGING */
+
+#ifdef CONFIG_BENCHMARK_LOAD_FLASH
+static K_THREAD_STACK_DEFINE(flash_stack, LOAD_STACK_SIZE);
+static struct k_thread flash_thread;
+
+static void flash_load(void *p1, void *p2, void *p3)
+{
+	static uint8_t page[256];
+	const struct flash_area *fa;
+	off_t offset = 0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (flash_area_open(FIXED_PARTITION_ID(storage_partition), &fa) != 0) {
+		printk("Flash load: cannot open storage_partition\n");
+		error_count++;
+		return;
+	}
+
+	memset(page, 0x5a, sizeof(page));
+
+	while (true) {
+		if (offset == 0 && flash_area_erase(fa, 0, fa->fa_size) != 0) {
+			printk("Flash load: erase failed\n");
+			error_count++;
+			break;
+		}
+
+		if (flash_area_write(fa, offset, page, sizeof(page)) != 0) {
+			printk("Flash load: write failed\n");
+			error_count++;
+			break;
+		}
+
+		offset += sizeof(page);
+		if (offset + sizeof(page) > fa->fa_size) {
+			offset = 0;
+		}
+
+		k_sleep(K_MSEC(1));
+	}
+
+	flash_area_close(fa);
+}
+#endif /* CONFIG_BENCHMARK_LOAD_FLASH */
+
+#ifdef CONFIG_BENCHMARK_LOAD_NET
+static K_THREAD_STACK_DEFINE(net_stack, LOAD_STACK_SIZE);
+static struct k_thread net_thread;
+
+static void net_load(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(LOAD_NET_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	uint8_t buf[128] = { 0 };
+	int rx_sock;
+	int tx_sock;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	rx_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	tx_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (rx_sock < 0 || tx_sock < 0 ||
+	    zsock_bind(rx_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("Network load: cannot set up sockets\n");
+		error_count++;
+		return;
+	}
+
+	while (true) {
+		for (int i = 0; i < LOAD_BURST; i++) {
+			(void)zsock_sendto(tx_sock, buf, sizeof(buf), 0,
+					   (struct sockaddr *)&addr, sizeof(addr));
+		}
+
+		while (zsock_recv(rx_sock, buf, sizeof(buf), ZSOCK_MSG_DONTWAIT) > 0) {
+		}
+
+		k_sleep(K_MSEC(1));
+	}
+}
+#endif /* CONFIG_BENCHMARK_LOAD_NET */
+
+void background_load_start(void)
+{
+#if CONFIG_BENCHMARK_LOAD_CACHE_THREADS > 0
+	for (int i = 0; i < CONFIG_BENCHMARK_LOAD_CACHE_THREADS; i++) {
+		k_thread_create(&cache_threads[i], cache_stacks[i],
+				K_THREAD_STACK_SIZEOF(cache_stacks[i]), cache_load,
+				cache_bufs[i], NULL, NULL, CACHE_PRIORITY, 0, K_NO_WAIT);
+	}
+#endif /* CONFIG_BENCHMARK_LOAD_CACHE_THREADS > 0 */
+
+#ifdef CONFIG_BENCHMARK_LOAD_LOGGING
+	k_thread_create(&log_thread, log_stack, K_THREAD_STACK_SIZEOF(log_stack),
+			log_load, NULL, NULL, NULL, LOAD_PRIORITY, 0, K_NO_WAIT);
+#endif /* CONFIG_BENCHMARK_LOAD_LOGGING */
+
+#ifdef CONFIG_BENCHMARK_LOAD_FLASH
+	k_thread_create(&flash_thread, flash_stack, K_THREAD_STACK_SIZEOF(flash_stack),
+			flash_load, NULL, NULL, NULL, LOAD_PRIORITY, 0, K_NO_WAIT);
+#endif /* CONFIG_BENCHMARK_LOAD_FLASH */
+
+#ifdef CONFIG_BENCHMARK_LOAD_NET
+	k_thread_create(&net_thread, net_stack, K_THREAD_STACK_SIZEOF(net_stack),
+			net_load, NULL, NULL, NULL, LOAD_PRIORITY, 0, K_NO_WAIT);
+#endif /* CONFIG_BENCHMARK_LOAD_NET */
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure latency distributions
+ *
+ * Averages hide the occasional slow iteration that breaks a real-time loop.
+ * The tests in this file record the latency of every iteration and report
+ * the minimum, median, 99th and 99.9th percentiles and maximum. Iterations
+ * are paced by CONFIG_BENCHMARK_TAIL_LATENCY_PERIOD_US so that the background
+ * load runs in between, as it would around a periodic control loop.
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include "../utils.h"
+#include "../timing_sc.h"
+
+#define PERIOD K_USEC(CONFIG_BENCHMARK_TAIL_LATENCY_PERIOD_US)
+
+static uint32_t samples[CONFIG_BENCHMARK_NUM_ITERATIONS];
+
+static K_SEM_DEFINE(wake_sem, 0, 1);
+
+static void wake_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	timestamp.sample = timing_timestamp_get();
+	k_sem_give(&wake_sem);
+}
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_sem_take(&wake_sem, K_FOREVER);
+
+		finish = timing_timestamp_get();
+		start = timestamp.sample;
+
+		samples[i] = (uint32_t)timing_cycles_get(&start, &finish);
+	}
+}
+
+static void signaller_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	bool      from_isr = (bool)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_sleep(PERIOD);
+
+		if (from_isr) {
+			irq_offload(wake_isr, NULL);
+		} else {
+			timestamp.sample = timing_timestamp_get();
+			k_sem_give(&wake_sem);
+		}
+	}
+
+	k_thread_join(&start_thread, K_FOREVER);
+}
+
+/* Time from giving a semaphore to the higher priority waiter running */
+static void wake_thread(uint32_t num_iterations, bool from_isr)
+{
+	int  priority;
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_sem_reset(&wake_sem);
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			waiter_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 2, 0, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			signaller_entry,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)from_isr, NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+	k_thread_start(&alt_thread);
+
+	k_thread_join(&alt_thread, K_FOREVER);
+}
+
+static K_MUTEX_DEFINE(test_mutex);
+
+static void lock_unlock_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		k_sleep(PERIOD);
+
+		start = timing_timestamp_get();
+		k_mutex_lock(&test_mutex, K_FOREVER);
+		k_mutex_unlock(&test_mutex);
+		finish = timing_timestamp_get();
+
+		samples[i] = (uint32_t)timing_cycles_get(&start, &finish);
+	}
+}
+
+/* Time to lock and unlock an uncontended mutex */
+static void mutex_lock_unlock_dist(uint32_t num_iterations)
+{
+	int  priority;
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			lock_unlock_entry,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	k_thread_join(&start_thread, K_FOREVER);
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void report(uint32_t num_iterations, const char *tag, const char *summary)
+{
+	static const struct {
+		const char *name;
+		uint32_t per_mille;
+	} stats[] = {
+		{ "min", 0 },
+		{ "p50", 500 },
+		{ "p99", 990 },
+		{ "p99.9", 999 },
+		{ "max", 1000 },
+	};
+	/* Every sample includes one timestamp read */
+	uint32_t overhead = (uint32_t)(timestamp_overhead / num_iterations);
+	char description[120];
+	char name[50];
+	uint32_t cycles;
+	uint32_t index;
+
+	qsort(samples, num_iterations, sizeof(samples[0]), compare_samples);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(stats); i++) {
+		index = (uint32_t)(((uint64_t)(num_iterations - 1) * stats[i].per_mille) / 1000);
+		cycles = samples[index] > overhead ? samples[index] - overhead : 0;
+
+		snprintf(name, sizeof(name), "%s.%s", tag, stats[i].name);
+		snprintf(description, sizeof(description), "%-40s - %s (%s)", name, summary,
+			 stats[i].name);
+		PRINT_STATS(description, cycles, false, "");
+	}
+}
+
+void tail_latency(uint32_t num_iterations)
+{
+	__ASSERT_NO_MSG(num_iterations <= CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	timing_start();
+
+	wake_thread(num_iterations, true);
+	report(num_iterations, "tail.isr.wake.thread.kernel",
+	       "Interrupt to woken thread");
+
+	wake_thread(num_iterations, false);
+	report(num_iterations, "tail.semaphore.give.wake+ctx.k_to_k",
+	       "Give a semaphore to woken thread");
+
+	mutex_lock_unlock_dist(num_iterations);
+	report(num_iterations, "tail.mutex.lock+unlock.immediate.kernel",
+	       "Lock and unlock a mutex");
+
+	timing_stop();
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the memory and string
+ * functions of the C library on buffers of 8 bytes to
+ * CONFIG_BENCHMARK_MAX_SIZE bytes, aligned and misaligned.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define MAX_SIZE CONFIG_BENCHMARK_MAX_SIZE
+
+/* Room for a misalignment and a string terminator */
+static uint8_t __aligned(8) src[MAX_SIZE + 8];
+static uint8_t __aligned(8) dst[MAX_SIZE + 8];
+
+/* Keeps the results of the functions alive */
+static volatile uintptr_t sink;
+
+static void op_memcpy(size_t size)
+{
+	sink = (uintptr_t)memcpy(dst, src, size);
+}
+
+static void op_memcpy_misaligned(size_t size)
+{
+	sink = (uintptr_t)memcpy(dst, src + 1, size);
+}
+
+static void op_memmove(size_t size)
+{
+	sink = (uintptr_t)memmove(dst + 1, dst, size);
+}
+
+static void op_memset(size_t size)
+{
+	sink = (uintptr_t)memset(dst, 0x55, size);
+}
+
+static void op_memcmp(size_t size)
+{
+	sink = memcmp(dst, src, size);
+}
+
+static void op_memchr(size_t size)
+{
+	sink = (uintptr_t)memchr(src, 0, size);
+}
+
+static void op_strlen(size_t size)
+{
+	ARG_UNUSED(size);
+
+	sink = strlen((const char *)src);
+}
+
+static void op_strcmp(size_t size)
+{
+	ARG_UNUSED(size);
+
+	sink = strcmp((const char *)dst, (const char *)src);
+}
+
+static const struct {
+	const char *name;
+	void (*op)(size_t size);
+} ops[] = {
+	{"memcpy", op_memcpy},
+	{"memcpy/unalign", op_memcpy_misaligned},
+	{"memmove", op_memmove},
+	{"memset", op_memset},
+	{"memcmp", op_memcmp},
+	{"memchr", op_memchr},
+	{"strlen", op_strlen},
+	{"strcmp", op_strcmp},
+};
+
+static void prepare(size_t size)
+{
+	/* Equal strings of size bytes, without the byte memchr() looks for */
+	memset(src, 'a', sizeof(src));
+	src[size] = '\0';
+	memcpy(dst, src, sizeof(dst));
+}
+
+static void bench(size_t size)
+{
+	const unsigned int iterations = MAX(CONFIG_BENCHMARK_BYTES_PER_SIZE / size, 1);
+
+	for (size_t i = 0; i < ARRAY_SIZE(ops); i++) {
+		timing_t start;
+		timing_t finish;
+		uint64_t cycles;
+		uint64_t ns;
+
+		prepare(size);
+
+		start = timing_counter_get();
+		for (unsigned int n = 0; n < iterations; n++) {
+			ops[i].op(size);
+		}
+		finish = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &finish);
+		ns = timing_cycles_to_ns(cycles);
+
+		printk("%-14s %6zu bytes: %8llu cycles (%8llu nsec) per call, %6llu MB/s\n",
+		       ops[i].name, size, cycles / iterations, ns / iterations,
+		       (ns != 0) ? (uint64_t)size * iterations * 1000U / ns : 0);
+	}
+}
+
+int main(void)
+{
+	timing_init();
+
+	printk("Memory and string functions, %u bytes per size\n",
+	       CONFIG_BENCHMARK_BYTES_PER_SIZE);
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (size_t size = 8; size <= MAX_SIZE; size *= 2) {
+		bench(size);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
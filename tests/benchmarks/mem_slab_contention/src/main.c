@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the cost of allocating and
+ * freeing memory slab blocks while one thread per CPU hammers on the same
+ * slab.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BLOCK_SIZE 32
+
+BUILD_ASSERT(CONFIG_BENCHMARK_NUM_BLOCKS >= (CONFIG_BENCHMARK_BURST * NUM_THREADS),
+	     "slab too small for every thread to hold a full burst");
+
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, CONFIG_BENCHMARK_NUM_BLOCKS, sizeof(void *));
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+static uint64_t thread_cycles[NUM_THREADS];
+static int thread_errors[NUM_THREADS];
+
+static K_SEM_DEFINE(start_sem, 0, NUM_THREADS);
+static K_SEM_DEFINE(done_sem, 0, NUM_THREADS);
+
+static void hammer(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+	void *blocks[CONFIG_BENCHMARK_BURST];
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (unsigned int j = 0; j < CONFIG_BENCHMARK_BURST; j++) {
+			if (k_mem_slab_alloc(&slab, &blocks[j], K_NO_WAIT) != 0) {
+				thread_errors[id]++;
+				blocks[j] = NULL;
+			}
+		}
+		for (unsigned int j = 0; j < CONFIG_BENCHMARK_BURST; j++) {
+			if (blocks[j] != NULL) {
+				k_mem_slab_free(&slab, blocks[j]);
+			}
+		}
+	}
+
+	finish = timing_counter_get();
+	thread_cycles[id] = timing_cycles_get(&start, &finish);
+
+	k_sem_give(&done_sem);
+}
+
+int main(void)
+{
+	uint64_t ops = (uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * CONFIG_BENCHMARK_BURST;
+	uint64_t total = 0;
+	int errors = 0;
+
+	timing_init();
+
+	printk("Memory slab contention with %u threads, per-CPU caches %s\n",
+	       NUM_THREADS, IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "on" : "off");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+				hammer, UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[i], i);
+#endif /* CONFIG_SCHED_CPU_MASK */
+		k_thread_start(&threads[i]);
+	}
+
+	timing_start();
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		uint64_t cycles = thread_cycles[i] / ops;
+
+		printk("thread %u: alloc+free %7llu cycles (%7u nsec)\n", i,
+		       cycles, (uint32_t)timing_cycles_to_ns(cycles));
+		total += thread_cycles[i];
+		errors += thread_errors[i];
+	}
+
+	total /= ops * NUM_THREADS;
+	printk("average:  alloc+free %7llu cycles (%7u nsec)\n",
+	       total, (uint32_t)timing_cycles_to_ns(total));
+
+	if (k_mem_slab_num_used_get(&slab) != 0U) {
+		printk("%u blocks leaked\n", k_mem_slab_num_used_get(&slab));
+		errors++;
+	}
+
+	TC_END_REPORT(errors == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Measure the IPv4 reassembly time of large UDP datagrams against the
+ * order the fragments arrive in
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/random/random.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "udp_internal.h"
+
+#define DATAGRAM_LEN  16384
+#define UDP_LEN       (NET_UDPH_LEN + DATAGRAM_LEN)
+#define FRAG_PAYLOAD  1480
+#define FRAG_COUNT    DIV_ROUND_UP(UDP_LEN, FRAG_PAYLOAD)
+#define INTERLEAVED   CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT
+#define ROUNDS        32
+#define LOCAL_PORT    4242
+
+BUILD_ASSERT(FRAG_COUNT <= CONFIG_NET_IPV4_FRAGMENT_MAX_PKT);
+
+/* Documentation addresses, RFC 5737 */
+static struct in_addr local_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr remote_addr = { { { 192, 0, 2, 2 } } };
+
+enum frag_order {
+	ORDER_IN_ORDER,
+	ORDER_REVERSE,
+	ORDER_SHUFFLED,
+	ORDER_INTERLEAVED,
+};
+
+static const char * const order_names[] = {
+	[ORDER_IN_ORDER] = "in order",
+	[ORDER_REVERSE] = "reverse",
+	[ORDER_SHUFFLED] = "shuffled",
+	[ORDER_INTERLEAVED] = "interleaved",
+};
+
+static struct net_pkt *frags[INTERLEAVED * FRAG_COUNT];
+static uint8_t payload[UDP_LEN];
+static struct net_if *iface;
+static uint16_t next_id = 1;
+static int received;
+
+static int reass_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static void reass_iface_init(struct net_if *net_iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(net_iface, mac, sizeof(mac), NET_LINK_DUMMY);
+}
+
+static int reass_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static struct dummy_api reass_if_api = {
+	.iface_api.init = reass_iface_init,
+	.send = reass_send,
+};
+
+NET_DEVICE_INIT(net_reassembly_perf, "net_reassembly_perf", reass_dev_init, NULL,
+		NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&reass_if_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2),
+		NET_IPV4H_LEN + FRAG_PAYLOAD);
+
+static enum net_verdict udp_received(struct net_conn *conn, struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr, void *user_data)
+{
+	if (net_pkt_get_len(pkt) == NET_IPV4H_LEN + UDP_LEN) {
+		received++;
+	}
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+static struct net_pkt *build_fragment(uint16_t id, int idx)
+{
+	size_t offset = idx * FRAG_PAYLOAD;
+	size_t len = MIN(FRAG_PAYLOAD, UDP_LEN - offset);
+	bool more = offset + len < UDP_LEN;
+	struct net_ipv4_hdr *hdr;
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, NET_IPV4H_LEN + len, AF_INET,
+					   IPPROTO_UDP, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate fragment");
+
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+
+	zassert_ok(net_pkt_write_u8(pkt, 0x45));
+	zassert_ok(net_pkt_memset(pkt, 0, 1));
+	zassert_ok(net_pkt_write_be16(pkt, NET_IPV4H_LEN + len));
+	zassert_ok(net_pkt_write_be16(pkt, id));
+	zassert_ok(net_pkt_write_be16(pkt, (offset / 8) |
+				      (more ? NET_IPV4_MORE_FRAG_MASK : 0)));
+	zassert_ok(net_pkt_write_u8(pkt, 64));
+	zassert_ok(net_pkt_write_u8(pkt, IPPROTO_UDP));
+	zassert_ok(net_pkt_memset(pkt, 0, 2));
+	zassert_ok(net_pkt_write(pkt, &remote_addr, sizeof(remote_addr)));
+	zassert_ok(net_pkt_write(pkt, &local_addr, sizeof(local_addr)));
+	zassert_ok(net_pkt_write(pkt, &payload[offset], len));
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+	hdr = NET_IPV4_HDR(pkt);
+	hdr->chksum = net_calc_chksum_ipv4(pkt);
+	net_pkt_set_overwrite(pkt, false);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+static void shuffle(struct net_pkt **pkts, int count)
+{
+	for (int i = count - 1; i > 0; i--) {
+		int j = sys_rand32_get() % (i + 1);
+		struct net_pkt *tmp = pkts[i];
+
+		pkts[i] = pkts[j];
+		pkts[j] = tmp;
+	}
+}
+
+/* Fragments of the datagrams, placed in the order they are to be fed in */
+static int build_round(enum frag_order order)
+{
+	int datagrams = order == ORDER_INTERLEAVED ? INTERLEAVED : 1;
+	int count = datagrams * FRAG_COUNT;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		uint16_t id = next_id + i / FRAG_COUNT;
+		int idx = i % FRAG_COUNT;
+
+		if (order == ORDER_REVERSE) {
+			idx = FRAG_COUNT - 1 - idx;
+		}
+
+		frags[i] = build_fragment(id, idx);
+	}
+
+	next_id += datagrams;
+
+	if (order == ORDER_SHUFFLED || order == ORDER_INTERLEAVED) {
+		shuffle(frags, count);
+	}
+
+	return count;
+}
+
+static void measure(enum frag_order order)
+{
+	uint64_t cycles = 0;
+	int datagrams = 0;
+	uint32_t start;
+	int count;
+
+	received = 0;
+
+	for (int round = 0; round < ROUNDS; round++) {
+		count = build_round(order);
+		datagrams += count / FRAG_COUNT;
+
+		start = k_cycle_get_32();
+
+		for (int i = 0; i < count; i++) {
+			zassert_ok(net_recv_data(iface, frags[i]), "Cannot feed fragment");
+		}
+
+		cycles += k_cycle_get_32() - start;
+	}
+
+	zassert_equal(received, datagrams, "%s: %d of %d datagrams reassembled",
+		      order_names[order], received, datagrams);
+
+	printk("%-12s %d fragments: %llu ns per datagram\n", order_names[order],
+	       FRAG_COUNT, k_cyc_to_ns_floor64(cycles) / datagrams);
+}
+
+ZTEST(net_reassembly_perf, test_reassembly_time)
+{
+	printk("IPv4 reassembly of %d byte UDP datagrams\n", DATAGRAM_LEN);
+
+	for (int order = ORDER_IN_ORDER; order <= ORDER_INTERLEAVED; order++) {
+		measure(order);
+	}
+}
+
+static void *net_reassembly_perf_setup(void)
+{
+	static struct net_conn_handle *handle;
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "Interface is NULL");
+
+	ifaddr = net_if_ipv4_addr_add(iface, &local_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	for (int i = 0; i < UDP_LEN; i++) {
+		payload[i] = i;
+	}
+
+	/* Source port, destination port, length and a zero (missing) checksum */
+	UNALIGNED_PUT(htons(LOCAL_PORT + 1), (uint16_t *)&payload[0]);
+	UNALIGNED_PUT(htons(LOCAL_PORT), (uint16_t *)&payload[2]);
+	UNALIGNED_PUT(htons(UDP_LEN), (uint16_t *)&payload[4]);
+	UNALIGNED_PUT(0, (uint16_t *)&payload[6]);
+
+	ret = net_udp_register(AF_INET, NULL, NULL, 0, LOCAL_PORT, NULL,
+			       udp_received, NULL, &handle);
+	zassert_ok(ret, "Cannot register UDP handler");
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_reassembly_perf, NULL, net_reassembly_perf_setup, NULL, NULL, NULL);
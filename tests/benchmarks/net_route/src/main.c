@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Measure the IPv6 route lookup time against the number of routes
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/random/random.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+
+#include "ipv6.h"
+#include "nbr.h"
+#include "route.h"
+
+#define MAX_ROUTES   CONFIG_NET_MAX_ROUTES
+#define NEXTHOPS     CONFIG_NET_MAX_NEXTHOPS
+#define LOOKUPS      4096
+
+/* Routes are 2001:db8:0:<i>::/64 */
+static const struct in6_addr route_base = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+						0, 0, 0, 0, 0, 0, 0, 0 } } };
+
+/* Next hops are fe80::<i + 1> */
+static const struct in6_addr nexthop_base = { { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+						  0, 0, 0, 0, 0, 0, 0, 0 } } };
+
+static struct in6_addr nexthops[NEXTHOPS];
+static struct in6_addr dests[LOOKUPS];
+static struct net_if *iface;
+static int route_count;
+
+struct net_route_perf_ctx {
+	uint8_t mac_addr[sizeof(struct net_eth_addr)];
+};
+
+static struct net_route_perf_ctx perf_ctx;
+
+static int perf_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static void perf_iface_init(struct net_if *net_iface)
+{
+	struct net_route_perf_ctx *ctx = net_if_get_device(net_iface)->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	ctx->mac_addr[0] = 0x00;
+	ctx->mac_addr[1] = 0x00;
+	ctx->mac_addr[2] = 0x5E;
+	ctx->mac_addr[3] = 0x00;
+	ctx->mac_addr[4] = 0x53;
+	ctx->mac_addr[5] = 0x01;
+
+	net_if_set_link_addr(net_iface, ctx->mac_addr, sizeof(ctx->mac_addr),
+			     NET_LINK_ETHERNET);
+}
+
+static int perf_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static struct dummy_api perf_if_api = {
+	.iface_api.init = perf_iface_init,
+	.send = perf_send,
+};
+
+NET_DEVICE_INIT(net_route_perf, "net_route_perf", perf_dev_init, NULL,
+		&perf_ctx, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&perf_if_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static void route_prefix(struct in6_addr *addr, int idx)
+{
+	net_ipaddr_copy(addr, &route_base);
+	addr->s6_addr[6] = idx >> 8;
+	addr->s6_addr[7] = idx & 0xff;
+}
+
+static void add_routes(int count)
+{
+	struct net_route_entry *route;
+	struct in6_addr prefix;
+
+	for (; route_count < count; route_count++) {
+		route_prefix(&prefix, route_count);
+
+		route = net_route_add(iface, &prefix, 64,
+				      &nexthops[route_count % NEXTHOPS],
+				      NET_IPV6_ND_INFINITE_LIFETIME,
+				      NET_ROUTE_PREFERENCE_MEDIUM);
+		zassert_not_null(route, "Cannot add route %d", route_count);
+	}
+}
+
+static void measure_lookups(void)
+{
+	struct net_route_entry *route;
+	uint32_t start, cycles;
+	int i;
+
+	for (i = 0; i < LOOKUPS; i++) {
+		route_prefix(&dests[i], sys_rand32_get() % route_count);
+		sys_rand_get(&dests[i].s6_addr[8], 8);
+	}
+
+	start = k_cycle_get_32();
+
+	for (i = 0; i < LOOKUPS; i++) {
+		route = net_route_lookup(iface, &dests[i]);
+		if (route == NULL) {
+			break;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	zassert_equal(i, LOOKUPS, "No route for lookup %d", i);
+
+	printk("%-8d routes: %llu ns per lookup\n", route_count,
+	       k_cyc_to_ns_floor64(cycles) / LOOKUPS);
+
+	/* Check the results outside of the timed loop */
+	for (i = 0; i < LOOKUPS; i++) {
+		route = net_route_lookup(iface, &dests[i]);
+
+		zassert_not_null(route, "No route for lookup %d", i);
+		zassert_equal(route->prefix_len, 64, "Wrong prefix length");
+		zassert_true(net_ipv6_is_prefix(route->addr.s6_addr,
+						dests[i].s6_addr, 64),
+			     "Wrong route for lookup %d", i);
+	}
+}
+
+ZTEST(net_route_perf, test_lookup_time)
+{
+	static const int steps[] = { 16, 64, 256, MAX_ROUTES };
+
+	printk("Route lookup, %s\n",
+	       IS_ENABLED(CONFIG_NET_ROUTE_TRIE) ? "prefix trie" : "linear search");
+
+	ARRAY_FOR_EACH(steps, i) {
+		if (steps[i] > MAX_ROUTES) {
+			break;
+		}
+
+		add_routes(steps[i]);
+		measure_lookups();
+	}
+}
+
+static void *net_route_perf_setup(void)
+{
+	struct net_linkaddr lladdr;
+	uint8_t mac[sizeof(struct net_eth_addr)] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x00 };
+	struct net_nbr *nbr;
+	int i;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "Interface is NULL");
+
+	lladdr.addr = mac;
+	lladdr.len = sizeof(mac);
+	lladdr.type = NET_LINK_ETHERNET;
+
+	for (i = 0; i < NEXTHOPS; i++) {
+		net_ipaddr_copy(&nexthops[i], &nexthop_base);
+		nexthops[i].s6_addr[15] = i + 1;
+		mac[5] = 0x10 + i;
+
+		nbr = net_ipv6_nbr_add(iface, &nexthops[i], &lladdr, false,
+				       NET_IPV6_NBR_STATE_REACHABLE);
+		zassert_not_null(nbr, "Cannot add neighbor %d", i);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_route_perf, NULL, net_route_perf_setup, NULL, NULL, NULL);
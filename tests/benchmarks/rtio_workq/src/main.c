@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the throughput of the RTIO
+ * work-queues against the number of CPUs submitting blocking requests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BURST CONFIG_BENCHMARK_BURST
+
+BUILD_ASSERT(CONFIG_RTIO_WORKQ_POOL_ITEMS >= (BURST * NUM_THREADS),
+	     "work item pool too small for every thread to submit a full batch");
+
+static void bench_iodev_handler(struct rtio_iodev_sqe *iodev_sqe)
+{
+	k_busy_wait(CONFIG_BENCHMARK_WORK_US);
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void bench_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, bench_iodev_handler);
+}
+
+static const struct rtio_iodev_api bench_iodev_api = {
+	.submit = bench_iodev_submit,
+};
+
+RTIO_IODEV_DEFINE(bench_iodev, &bench_iodev_api, NULL);
+
+#define BENCH_RTIO_DEFINE(i, _) RTIO_DEFINE(bench_rtio_##i, BURST, BURST)
+#define BENCH_RTIO_PTR(i, _) &bench_rtio_##i
+
+LISTIFY(NUM_THREADS, BENCH_RTIO_DEFINE, (;));
+
+static struct rtio *const rtios[NUM_THREADS] = {
+	LISTIFY(NUM_THREADS, BENCH_RTIO_PTR, (,))
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+static int thread_errors[NUM_THREADS];
+
+static K_SEM_DEFINE(start_sem, 0, NUM_THREADS);
+static K_SEM_DEFINE(done_sem, 0, NUM_THREADS);
+
+static void submitter(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+	struct rtio *r = rtios[id];
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (unsigned int j = 0; j < BURST; j++) {
+			sqe = rtio_sqe_acquire(r);
+			rtio_sqe_prep_nop(sqe, &bench_iodev, NULL);
+		}
+
+		rtio_submit(r, BURST);
+
+		for (unsigned int j = 0; j < BURST; j++) {
+			cqe = rtio_cqe_consume(r);
+			if (cqe == NULL || cqe->result != 0) {
+				thread_errors[id]++;
+			}
+			if (cqe != NULL) {
+				rtio_cqe_release(r, cqe);
+			}
+		}
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static uint64_t run(unsigned int num_threads)
+{
+	timing_t start;
+	timing_t finish;
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+				submitter, UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		(void)k_thread_cpu_pin(&threads[i], i);
+		k_thread_start(&threads[i]);
+	}
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &finish));
+}
+
+int main(void)
+{
+	uint64_t ops_per_thread = (uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * BURST;
+	int errors = 0;
+
+	timing_init();
+
+	printk("RTIO work-queues, %s\n",
+	       IS_ENABLED(CONFIG_RTIO_WORKQ_PER_CPU) ? "one queue per CPU" : "shared queue");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int n = 1; n <= NUM_THREADS; n++) {
+		uint64_t ns = run(n);
+		uint64_t ops = ops_per_thread * n;
+
+		printk("%u CPUs: %llu requests in %llu usec, %llu requests/s\n", n, ops,
+		       ns / NSEC_PER_USEC, ns > 0 ? ops * NSEC_PER_SEC / ns : 0);
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		errors += thread_errors[i];
+	}
+
+	if (rtio_work_req_used_count_get() != 0U) {
+		printk("%u work items leaked\n", rtio_work_req_used_count_get());
+		errors++;
+	}
+
+	TC_END_REPORT(errors == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the transitions of a
+ * hierarchical state machine eight levels deep: between sibling leaves,
+ * to self, and between the leaves of two branches that only share the
+ * topmost state. States created with SMF_CREATE_STATE() are measured and,
+ * with CONFIG_SMF_STATE_TABLES, the same states in a state table.
+ *
+ *   ROOT -- X1 -- X2 -- ... -- X6 -- X7
+ *   |                           |
+ *   |                           +--- X7B
+ *   |
+ *   +------ Y1 -- Y2 -- ... -- Y6 -- Y7
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/smf.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define ITERATIONS 10000
+
+enum bench_state {
+	ROOT,
+	X1, X2, X3, X4, X5, X6, X7, X7B,
+	Y1, Y2, Y3, Y4, Y5, Y6, Y7,
+	NUM_STATES,
+};
+
+static struct bench_object {
+	struct smf_ctx ctx;
+	const struct smf_state *states;
+	/* states the leaf run actions transition to, in turn */
+	enum bench_state target[2];
+	uint32_t runs;
+	uint32_t actions;
+} bench_obj;
+
+static void action(void *obj)
+{
+	((struct bench_object *)obj)->actions++;
+}
+
+static void run(void *obj)
+{
+	struct bench_object *o = obj;
+
+	smf_set_state(SMF_CTX(o), &o->states[o->target[o->runs++ & 1]]);
+}
+
+#define CREATE_STATE(_state, _parent)                                                              \
+	[_state] = SMF_CREATE_STATE(action, run, action, _parent, NULL)
+
+static const struct smf_state ptr_states[] = {
+	CREATE_STATE(ROOT, NULL),
+	CREATE_STATE(X1, &ptr_states[ROOT]),
+	CREATE_STATE(X2, &ptr_states[X1]),
+	CREATE_STATE(X3, &ptr_states[X2]),
+	CREATE_STATE(X4, &ptr_states[X3]),
+	CREATE_STATE(X5, &ptr_states[X4]),
+	CREATE_STATE(X6, &ptr_states[X5]),
+	CREATE_STATE(X7, &ptr_states[X6]),
+	CREATE_STATE(X7B, &ptr_states[X6]),
+	CREATE_STATE(Y1, &ptr_states[ROOT]),
+	CREATE_STATE(Y2, &ptr_states[Y1]),
+	CREATE_STATE(Y3, &ptr_states[Y2]),
+	CREATE_STATE(Y4, &ptr_states[Y3]),
+	CREATE_STATE(Y5, &ptr_states[Y4]),
+	CREATE_STATE(Y6, &ptr_states[Y5]),
+	CREATE_STATE(Y7, &ptr_states[Y6]),
+};
+
+#ifdef CONFIG_SMF_STATE_TABLES
+#define TABLE_STATE(_state, _parent) SMF_TABLE_STATE(_state, action, run, action, _parent, SMF_NONE)
+
+SMF_STATE_TABLE_DEFINE(table_states,
+		       TABLE_STATE(ROOT, SMF_NONE),
+		       TABLE_STATE(X1, ROOT), TABLE_STATE(X2, X1), TABLE_STATE(X3, X2),
+		       TABLE_STATE(X4, X3), TABLE_STATE(X5, X4), TABLE_STATE(X6, X5),
+		       TABLE_STATE(X7, X6), TABLE_STATE(X7B, X6),
+		       TABLE_STATE(Y1, ROOT), TABLE_STATE(Y2, Y1), TABLE_STATE(Y3, Y2),
+		       TABLE_STATE(Y4, Y3), TABLE_STATE(Y5, Y4), TABLE_STATE(Y6, Y5),
+		       TABLE_STATE(Y7, Y6));
+#endif
+
+static void bench(const char *name, const struct smf_state *states, const char *transition,
+		  enum bench_state from, enum bench_state to)
+{
+	struct bench_object *o = &bench_obj;
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	uint64_t ns;
+
+	o->states = states;
+	o->target[0] = to;
+	o->target[1] = from;
+	o->runs = 0;
+	smf_set_initial(SMF_CTX(o), &states[from]);
+	o->actions = 0;
+
+	start = timing_counter_get();
+	for (unsigned int n = 0; n < ITERATIONS; n++) {
+		(void)smf_run_state(SMF_CTX(o));
+	}
+	finish = timing_counter_get();
+
+	cycles = timing_cycles_get(&start, &finish);
+	ns = timing_cycles_to_ns(cycles);
+
+	printk("%-8s %-8s %3u actions: %8llu cycles (%8llu nsec) per transition\n", name,
+	       transition, o->actions / ITERATIONS, cycles / ITERATIONS, ns / ITERATIONS);
+}
+
+static void bench_states(const char *name, const struct smf_state *states)
+{
+	bench(name, states, "sibling", X7, X7B);
+	bench(name, states, "self", X7, X7);
+	bench(name, states, "branch", X7, Y7);
+}
+
+int main(void)
+{
+	timing_init();
+
+	printk("Hierarchical state machine transitions, %u per measurement\n", ITERATIONS);
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	bench_states("pointers", ptr_states);
+#ifdef CONFIG_SMF_STATE_TABLES
+	bench_states("table", table_states);
+#endif
+
+	timing_stop();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
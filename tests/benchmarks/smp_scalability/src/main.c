@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the throughput and latency of
+ * kernel primitives shared by an increasing number of CPUs.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BLOCK_SIZE 32
+#define NUM_SAMPLES MIN(CONFIG_BENCHMARK_NUM_SAMPLES, CONFIG_BENCHMARK_NUM_ITERATIONS)
+
+static K_SEM_DEFINE(sem, 0, K_SEM_MAX_LIMIT);
+static K_MUTEX_DEFINE(mutex);
+K_MSGQ_DEFINE(msgq, sizeof(uint32_t), NUM_THREADS, sizeof(uint32_t));
+K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, NUM_THREADS, sizeof(void *));
+K_HEAP_DEFINE(heap, 2048);
+
+static K_THREAD_STACK_DEFINE(work_q_stack, STACK_SIZE);
+static struct k_work_q work_q;
+static struct k_work works[NUM_THREADS];
+static struct k_work_sync work_syncs[NUM_THREADS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+static struct k_sem start_sems[NUM_THREADS];
+static K_SEM_DEFINE(done_sem, 0, NUM_THREADS);
+
+static uint32_t samples[NUM_THREADS][NUM_SAMPLES];
+static uint32_t sorted[NUM_THREADS * NUM_SAMPLES];
+static int thread_errors[NUM_THREADS];
+
+static void sem_op(unsigned int id)
+{
+	ARG_UNUSED(id);
+
+	k_sem_give(&sem);
+	k_sem_take(&sem, K_FOREVER);
+}
+
+static void mutex_op(unsigned int id)
+{
+	ARG_UNUSED(id);
+
+	k_mutex_lock(&mutex, K_FOREVER);
+	k_mutex_unlock(&mutex);
+}
+
+static void msgq_op(unsigned int id)
+{
+	uint32_t msg = id;
+
+	k_msgq_put(&msgq, &msg, K_FOREVER);
+	k_msgq_get(&msgq, &msg, K_FOREVER);
+}
+
+static void slab_op(unsigned int id)
+{
+	void *block;
+
+	if (k_mem_slab_alloc(&slab, &block, K_NO_WAIT) != 0) {
+		thread_errors[id]++;
+		return;
+	}
+
+	k_mem_slab_free(&slab, block);
+}
+
+static void heap_op(unsigned int id)
+{
+	void *block = k_heap_alloc(&heap, BLOCK_SIZE, K_NO_WAIT);
+
+	if (block == NULL) {
+		thread_errors[id]++;
+		return;
+	}
+
+	k_heap_free(&heap, block);
+}
+
+static void work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+}
+
+static void work_op(unsigned int id)
+{
+	if (k_work_submit_to_queue(&work_q, &works[id]) < 0) {
+		thread_errors[id]++;
+		return;
+	}
+
+	(void)k_work_flush(&works[id], &work_syncs[id]);
+}
+
+static const struct scenario {
+	const char *name;
+	void (*op)(unsigned int id);
+} scenarios[] = {
+	{ "sem", sem_op },
+	{ "mutex", mutex_op },
+	{ "msgq", msgq_op },
+	{ "slab", slab_op },
+	{ "heap", heap_op },
+	{ "work", work_op },
+};
+
+static const struct scenario *current;
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	unsigned int id = POINTER_TO_UINT(p1);
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&start_sems[id], K_FOREVER);
+
+		for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+			start = timing_counter_get();
+			current->op(id);
+			finish = timing_counter_get();
+
+			samples[id][i % NUM_SAMPLES] = (uint32_t)timing_cycles_get(&start, &finish);
+		}
+
+		k_sem_give(&done_sem);
+	}
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void run(const struct scenario *scenario, unsigned int num_cpus)
+{
+	uint64_t ops = (uint64_t)CONFIG_BENCHMARK_NUM_ITERATIONS * num_cpus;
+	unsigned int count = num_cpus * NUM_SAMPLES;
+	uint64_t spin_ns = 0;
+	timing_t start;
+	timing_t finish;
+	uint64_t ns;
+
+	current = scenario;
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	k_spin_stats_reset();
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_sem_give(&start_sems[i]);
+	}
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+	ns = MAX(timing_cycles_to_ns(timing_cycles_get(&start, &finish)), 1);
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct k_spin_stats stats;
+
+		if (k_spin_stats_get(i, &stats) == 0) {
+			spin_ns += k_cyc_to_ns_floor64(stats.wait_cycles);
+		}
+	}
+	spin_ns /= ops;
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		memcpy(&sorted[i * NUM_SAMPLES], samples[i], sizeof(samples[i]));
+	}
+	qsort(sorted, count, sizeof(sorted[0]), compare_samples);
+
+	printk("%-8s %4u %9llu %8u %8u %8llu\n", scenario->name, num_cpus,
+	       ops * NSEC_PER_SEC / ns,
+	       (uint32_t)timing_cycles_to_ns(sorted[count / 2]),
+	       (uint32_t)timing_cycles_to_ns(sorted[count * 99 / 100]),
+	       spin_ns);
+}
+
+int main(void)
+{
+	unsigned int num_cpus = MIN(arch_num_cpus(), NUM_THREADS);
+	int errors = 0;
+
+	timing_init();
+
+	printk("SMP scalability with up to %u CPUs, %u operations per thread\n",
+	       num_cpus, CONFIG_BENCHMARK_NUM_ITERATIONS);
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   K_PRIO_PREEMPT(0), NULL);
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_sem_init(&start_sems[i], 0, 1);
+		k_work_init(&works[i], work_handler);
+		k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+				worker, UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(&threads[i], i);
+#endif /* CONFIG_SCHED_CPU_MASK */
+		k_thread_start(&threads[i]);
+	}
+
+	timing_start();
+
+	printk("scenario cpus     ops/s   p50 ns   p99 ns  spin ns\n");
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(scenarios); i++) {
+		for (unsigned int n = 1; n <= num_cpus; n++) {
+			run(&scenarios[i], n);
+		}
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		errors += thread_errors[i];
+	}
+
+	if (k_mem_slab_num_used_get(&slab) != 0U) {
+		printk("%u blocks leaked\n", k_mem_slab_num_used_get(&slab));
+		errors++;
+	}
+
+	TC_END_REPORT(errors == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
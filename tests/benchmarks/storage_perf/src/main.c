@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Measure write and read latency, write amplification and mount time
+ * of NVS or ZMS on the timed flash simulator
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/storage/flash_map.h>
+
+#if defined(CONFIG_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_ZMS)
+#include <zephyr/fs/zms.h>
+#else
+#error "Enable CONFIG_NVS or CONFIG_ZMS"
+#endif
+
+#define TEST_AREA       storage_partition
+#define TEST_AREA_ID    FIXED_PARTITION_ID(TEST_AREA)
+#define SECTOR_COUNT    8U
+#define NUM_IDS         16
+#define RECORD_SIZE     32
+#define WRITES          1024
+
+#if defined(CONFIG_NVS)
+#define BACKEND         "NVS"
+static struct nvs_fs fs;
+#define storage_mount   nvs_mount
+#define storage_clear   nvs_clear
+#define storage_write   nvs_write
+#define storage_read    nvs_read
+#else
+#define BACKEND         "ZMS"
+static struct zms_fs fs;
+#define storage_mount   zms_mount
+#define storage_clear   zms_clear
+#define storage_write   zms_write
+#define storage_read    zms_read
+#endif
+
+static uint32_t latency_us[WRITES];
+static uint8_t record[RECORD_SIZE];
+static struct stats_hdr *sim_stats;
+
+static int flash_sim_bytes_written_find(struct stats_hdr *hdr, void *arg, const char *name,
+					uint16_t off)
+{
+	if (!strcmp(name, "bytes_written")) {
+		uint32_t **bytes_written = (uint32_t **)arg;
+		*bytes_written = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static uint32_t flash_bytes_written(void)
+{
+	uint32_t *bytes_written = NULL;
+
+	stats_walk(sim_stats, flash_sim_bytes_written_find, &bytes_written);
+	zassert_not_null(bytes_written, "bytes_written statistic not found");
+
+	return *bytes_written;
+}
+
+static int latency_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+static void print_latency(const char *op, size_t count)
+{
+	qsort(latency_us, count, sizeof(latency_us[0]), latency_cmp);
+
+	printk("%s %s latency (us): p50 %u p90 %u p99 %u max %u\n", BACKEND, op,
+	       latency_us[count / 2], latency_us[count * 90 / 100],
+	       latency_us[count * 99 / 100], latency_us[count - 1]);
+}
+
+static void measure_writes(void)
+{
+	uint32_t start, flash_start, amplification;
+	ssize_t len;
+
+	flash_start = flash_bytes_written();
+
+	for (int i = 0; i < WRITES; i++) {
+		/* Every write changes the value, so none of them is skipped */
+		memset(record, i, sizeof(record));
+
+		start = k_cycle_get_32();
+		len = storage_write(&fs, i % NUM_IDS, record, sizeof(record));
+		latency_us[i] = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+		zassert_equal(len, sizeof(record), "write %d failed: %d", i, (int)len);
+	}
+
+	print_latency("write", WRITES);
+
+	/* In hundredths, as the amplification is close to one */
+	amplification = (flash_bytes_written() - flash_start) * 100U / (WRITES * RECORD_SIZE);
+	printk("%s write amplification: %u.%02u\n", BACKEND, amplification / 100U,
+	       amplification % 100U);
+}
+
+static void measure_reads(void)
+{
+	uint32_t start;
+	ssize_t len;
+
+	for (int i = 0; i < WRITES; i++) {
+		start = k_cycle_get_32();
+		len = storage_read(&fs, i % NUM_IDS, record, sizeof(record));
+		latency_us[i] = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+
+		zassert_equal(len, sizeof(record), "read %d failed: %d", i, (int)len);
+	}
+
+	print_latency("read", WRITES);
+}
+
+static void measure_mount(void)
+{
+	uint32_t start, cycles;
+	int rc;
+
+	/* Forget the state of the mounted file system */
+	fs.ready = false;
+
+	start = k_cycle_get_32();
+	rc = storage_mount(&fs);
+	cycles = k_cycle_get_32() - start;
+
+	zassert_ok(rc, "mount failed: %d", rc);
+
+	printk("%s mount time (us): %u\n", BACKEND, k_cyc_to_us_ceil32(cycles));
+}
+
+ZTEST(storage_perf, test_storage_perf)
+{
+	/* Reads and the mount scan the records left by the writes */
+	measure_writes();
+	measure_reads();
+	measure_mount();
+}
+
+static void *storage_perf_setup(void)
+{
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	int rc;
+
+	sim_stats = stats_group_find("flash_sim_stats");
+	zassert_not_null(sim_stats, "flash_sim_stats not found");
+
+	rc = flash_area_open(TEST_AREA_ID, &fa);
+	zassert_ok(rc, "flash_area_open failed: %d", rc);
+
+	rc = flash_get_page_info_by_offs(flash_area_get_device(fa), fa->fa_off, &info);
+	zassert_ok(rc, "Unable to get page info: %d", rc);
+
+	fs.flash_device = flash_area_get_device(fa);
+	fs.offset = fa->fa_off;
+	fs.sector_size = info.size;
+	fs.sector_count = SECTOR_COUNT;
+
+	rc = storage_mount(&fs);
+	zassert_ok(rc, "mount failed: %d", rc);
+
+	rc = storage_clear(&fs);
+	zassert_ok(rc, "clear failed: %d", rc);
+
+	rc = storage_mount(&fs);
+	zassert_ok(rc, "mount failed: %d", rc);
+
+	printk("%s: %u sectors of %u bytes, %d ids of %d bytes\n", BACKEND, SECTOR_COUNT,
+	       (uint32_t)info.size, NUM_IDS, RECORD_SIZE);
+
+	return NULL;
+}
+
+ZTEST_SUITE(storage_perf, NULL, storage_perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time required to arm and abort
+ * a kernel timeout while a varying number of other timeouts are already
+ * armed. The timeouts are bare _timeout objects handed straight to the
+ * timeout queue, so neither thread nor timer bookkeeping is included in the
+ * measurements.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+static struct _timeout timeouts[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static struct _timeout probe;
+
+static void dummy_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+/*
+ * Spread the expiries pseudo-randomly over a wide range so that insertion
+ * points in a sorted queue vary and all levels of a timing wheel are used.
+ */
+static k_ticks_t duration(unsigned int i)
+{
+	return 1000 + (k_ticks_t)((i * 2654435761U) % 10000000U);
+}
+
+static void measure(unsigned int armed)
+{
+	uint64_t add_cycles = 0;
+	uint64_t abort_cycles = 0;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		k_timeout_t t = K_TICKS(duration(armed + i));
+
+		start = timing_counter_get();
+		z_add_timeout(&probe, dummy_fn, t);
+		mid = timing_counter_get();
+		z_abort_timeout(&probe);
+		finish = timing_counter_get();
+
+		add_cycles += timing_cycles_get(&start, &mid);
+		abort_cycles += timing_cycles_get(&mid, &finish);
+	}
+
+	add_cycles /= CONFIG_BENCHMARK_NUM_ITERATIONS;
+	abort_cycles /= CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	printk("%5u armed: add %7llu cycles (%7u nsec), abort %7llu cycles (%7u nsec)\n",
+	       armed,
+	       add_cycles, (uint32_t)timing_cycles_to_ns(add_cycles),
+	       abort_cycles, (uint32_t)timing_cycles_to_ns(abort_cycles));
+}
+
+int main(void)
+{
+	unsigned int i;
+
+	timing_init();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "timing wheel" : "delta list");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		z_init_timeout(&timeouts[i]);
+	}
+	z_init_timeout(&probe);
+
+	timing_start();
+
+	for (i = 0; i <= CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		if ((i % CONFIG_BENCHMARK_STEP) == 0) {
+			measure(i);
+		}
+
+		if (i < CONFIG_BENCHMARK_NUM_TIMEOUTS) {
+			z_add_timeout(&timeouts[i], dummy_fn, K_TICKS(duration(i)));
+		}
+	}
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		z_abort_timeout(&timeouts[i]);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
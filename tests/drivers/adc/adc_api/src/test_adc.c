@@ -11,6 +11,9 @@
 #include <zephyr/drivers/counter.h>
 #include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
+#if defined(CONFIG_ADC_STREAM)
+#include <zephyr/rtio/rtio.h>
+#endif
 
 /* Invalid value that is not supposed to be written by the driver. It is used
  * to mark the sample buffer entries as empty. If needed, it can be overridden
@@ -401,3 +404,74 @@ ZTEST_USER(adc_basic, test_adc_invalid_request)
 {
 	zassert_true(test_task_invalid_request() == TC_PASS);
 }
+
+#if defined(CONFIG_ADC_STREAM)
+#define STREAM_SAMPLINGS 16
+
+ADC_DT_STREAM_IODEV(adc_stream_iodev, DT_IO_CHANNELS_CTLR_BY_IDX(DT_PATH(zephyr_user), 0),
+		    BIT(DT_IO_CHANNELS_INPUT_BY_IDX(DT_PATH(zephyr_user), 0)), 12, 20,
+		    STREAM_SAMPLINGS);
+RTIO_DEFINE_WITH_MEMPOOL(adc_rtio, 4, 4, 4, 128, 4);
+
+/*
+ * test_adc_stream
+ */
+ZTEST(adc_basic, test_adc_stream)
+{
+	struct adc_stream_config *cfg = adc_stream_iodev.data;
+	const struct adc_stream_header *hdr;
+	struct rtio_sqe *handle;
+	struct rtio_cqe *cqe;
+	int32_t values[STREAM_SAMPLINGS];
+	uint64_t timestamps[STREAM_SAMPLINGS];
+	uint8_t *buf;
+	uint32_t buf_len;
+	uint32_t fit;
+	int ret;
+
+	init_adc();
+	cfg->resolution = adc_channels[0].resolution;
+
+	ret = adc_stream(&adc_stream_iodev, &adc_rtio, NULL, &handle);
+	zassert_equal(ret, 0, "adc_stream() failed with code %d", ret);
+
+	for (int i = 0; i < 2; i++) {
+		cqe = rtio_cqe_consume_block(&adc_rtio);
+		if (cqe->result == -ENOTSUP) {
+			rtio_cqe_release(&adc_rtio, cqe);
+			ztest_test_skip();
+		}
+		zassert_equal(cqe->result, 0, "Stream failed with code %d", cqe->result);
+
+		ret = rtio_cqe_get_mempool_buffer(&adc_rtio, cqe, &buf, &buf_len);
+		zassert_equal(ret, 0, "No buffer in the completion");
+		rtio_cqe_release(&adc_rtio, cqe);
+
+		hdr = (const struct adc_stream_header *)buf;
+		zassert_equal(hdr->count, STREAM_SAMPLINGS, "Buffer should be full");
+
+		fit = 0;
+		ret = adc_stream_decode(buf, adc_channels[0].channel_id, &fit,
+					STREAM_SAMPLINGS, values, timestamps);
+		zassert_equal(ret, STREAM_SAMPLINGS, "Decoded %d samples", ret);
+		zassert_equal(timestamps[1] - timestamps[0], hdr->interval_ns,
+			      "Samplings should be evenly spaced");
+
+		rtio_release_buffer(&adc_rtio, buf, buf_len);
+	}
+
+	rtio_sqe_cancel(handle);
+	k_msleep(1);
+
+	/* Drop the buffers completed before the cancellation */
+	while ((cqe = rtio_cqe_consume(&adc_rtio)) != NULL) {
+		if (rtio_cqe_get_mempool_buffer(&adc_rtio, cqe, &buf, &buf_len) == 0) {
+			rtio_release_buffer(&adc_rtio, buf, buf_len);
+		}
+		rtio_cqe_release(&adc_rtio, cqe);
+	}
+
+	/* The ADC is available again for reads */
+	zassert_true(test_task_one_channel() == TC_PASS);
+}
+#endif /* defined(CONFIG_ADC_STREAM) */
@@ -275,6 +275,107 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#if defined(CONFIG_DISK_ACCESS_CACHE)
+/* Test that repeated reads are served from the block cache */
+ZTEST(disk_driver, test_cache)
+{
+	struct disk_cache_stats before, after;
+	int rc;
+
+	rc = disk_access_cache_stats_get(disk_pdrv, &before);
+	zassert_equal(rc, 0, "Failed to get cache statistics");
+
+	rc = read_sector(scratch_buf[0], 0, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	rc = read_sector(scratch_buf[1], 0, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size,
+			  "Cached read mismatch");
+
+	rc = disk_access_cache_stats_get(disk_pdrv, &after);
+	zassert_equal(rc, 0, "Failed to get cache statistics");
+	zassert_true(after.hits > before.hits, "Read not served from the cache");
+
+#if defined(CONFIG_DISK_ACCESS_CACHE_WRITE_BACK)
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to sync disk");
+
+	rc = disk_access_cache_stats_get(disk_pdrv, &before);
+	zassert_equal(rc, 0, "Failed to get cache statistics");
+
+	rc = write_sector_checked(scratch_buf[0], scratch_buf[1], 0, 1);
+	zassert_equal(rc, 0, "Failed to write to disk");
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Failed to sync disk");
+
+	rc = disk_access_cache_stats_get(disk_pdrv, &after);
+	zassert_equal(rc, 0, "Failed to get cache statistics");
+	zassert_equal(after.write_backs, before.write_backs + 1, "Sector not written back");
+#endif
+}
+#endif
+
+#if defined(CONFIG_DISK_ACCESS_RTIO)
+RTIO_DEFINE(disk_rtio, 8, 8);
+DISK_ACCESS_IODEV_DEFINE(disk_iodev, DISK_NAME);
+
+/* Queue one request per sector, then wait for all of them to complete */
+static int rtio_sectors(uint8_t *buf, uint32_t start, uint32_t num_sectors, bool write)
+{
+	struct rtio_cqe *cqe;
+	int rc = 0;
+
+	for (uint32_t i = 0; i < num_sectors; i++) {
+		uint8_t *sector_buf = &buf[i * disk_sector_size];
+		struct rtio_sqe *sqe;
+
+		if (write) {
+			sqe = disk_access_rtio_write(&disk_rtio, &disk_iodev, sector_buf,
+						     start + i, disk_sector_size, NULL);
+		} else {
+			sqe = disk_access_rtio_read(&disk_rtio, &disk_iodev, sector_buf,
+						    start + i, disk_sector_size, NULL);
+		}
+		zassert_not_null(sqe, "Failed to queue request");
+	}
+
+	rtio_submit(&disk_rtio, num_sectors);
+
+	for (uint32_t i = 0; i < num_sectors; i++) {
+		cqe = rtio_cqe_consume_block(&disk_rtio);
+		if (cqe->result != 0) {
+			rc = cqe->result;
+		}
+		rtio_cqe_release(&disk_rtio, cqe);
+	}
+
+	return rc;
+}
+
+/* Test queued reads and writes of adjacent sectors */
+ZTEST(disk_driver, test_rtio)
+{
+	int rc;
+
+	for (int i = 0; i < 4 * disk_sector_size; i++) {
+		scratch_buf[0][i] = i ^ 0x5a;
+	}
+
+	rc = rtio_sectors(scratch_buf[0], 0, 4, true);
+	zassert_equal(rc, 0, "Failed to write with RTIO");
+
+	memset(scratch_buf[1], 0, 4 * disk_sector_size);
+	rc = rtio_sectors(scratch_buf[1], 0, 4, false);
+	zassert_equal(rc, 0, "Failed to read with RTIO");
+	zassert_mem_equal(scratch_buf[0], scratch_buf[1], 4 * disk_sector_size,
+			  "Read data did not match data written with RTIO");
+
+	rc = rtio_sectors(scratch_buf[1], disk_sector_count, 1, false);
+	zassert_not_equal(rc, 0, "Disk should fail to read out of sector bounds");
+}
+#endif
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
@@ -159,6 +159,42 @@ ZTEST(display_read_write, test_write_to_buffer_head)
 	verify_background_color(width, 0, display_width - width, display_height, 0);
 }
 
+static void write_async_done(const struct device *dev, int result, void *user_data)
+{
+	zassert_ok(result);
+	k_sem_give(user_data);
+}
+
+/*
+ * Verify that display_write_async() writes the data and calls back
+ */
+ZTEST(display_read_write, test_write_async_to_buffer_head)
+{
+	uint8_t data[4] = {0xFA, 0xAF, 0x9F, 0xFA};
+	uint8_t height = (is_tiled ? 8 : 1);
+	uint16_t width = sizeof(data) / bpp;
+	uint16_t buf_size = width * bpp;
+	struct display_buffer_descriptor desc = {
+		.height = height,
+		.pitch = width,
+		.width = width,
+		.buf_size = buf_size,
+	};
+	struct k_sem done;
+
+	k_sem_init(&done, 0, 1);
+
+	zassert_ok(display_write_async(dev, 0, 0, &desc, data, write_async_done, &done));
+	zassert_ok(k_sem_take(&done, K_SECONDS(1)));
+
+	/* check write data and read data are same */
+	verify_bytes_of_area(data, 0, 0, width, height);
+
+	/* check remaining region still black */
+	verify_background_color(0, height, display_width, display_height - height, 0);
+	verify_background_color(width, 0, display_width - width, display_height, 0);
+}
+
 /*
  * Write to the tail of the buffer and check that
  * the same value can be read.
@@ -153,8 +153,54 @@ static int test_sg(void)
 	return TC_PASS;
 }
 
+static int test_sg_chain(void)
+{
+	const struct device *dma = DEVICE_DT_GET(DT_ALIAS(dma0));
+	struct dma_chain chain;
+	int chan_id;
+
+	chan_id = dma_request_channel(dma, NULL);
+	if (chan_id < 0) {
+		chan_id = CONFIG_DMA_SG_CHANNEL_NR;
+	}
+
+	/* the blocks of the previous test are prepared once and submitted twice */
+	if (dma_chain_prepare(&chain, dma, chan_id, &dma_cfg)) {
+		TC_PRINT("ERROR: chain prepare (%d)\n", chan_id);
+		return TC_FAIL;
+	}
+
+	for (int run = 0; run < 2; run++) {
+		memset(rx_data, 0, sizeof(rx_data));
+		k_sem_reset(&xfer_sem);
+
+		if (dma_chain_submit(&chain)) {
+			TC_PRINT("ERROR: chain submit (%d)\n", chan_id);
+			return TC_FAIL;
+		}
+
+		if (k_sem_take(&xfer_sem, K_MSEC(1000)) != 0) {
+			TC_PRINT("Timed out waiting for chain %d\n", run);
+			return TC_FAIL;
+		}
+
+		for (int i = 0; i < XFERS; i++) {
+			if (memcmp(tx_data, rx_data[i], CONFIG_DMA_SG_XFER_SIZE)) {
+				return TC_FAIL;
+			}
+		}
+	}
+
+	dma_stop(dma, chan_id);
+	dma_release_channel(dma, chan_id);
+
+	TC_PRINT("Finished: DMA chain\n");
+	return TC_PASS;
+}
+
 /* export test cases */
 ZTEST(dma_m2m_sg, test_dma_m2m_sg)
 {
 	zassert_true((test_sg() == TC_PASS));
+	zassert_true((test_sg_chain() == TC_PASS));
 }
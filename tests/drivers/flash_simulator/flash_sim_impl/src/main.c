@@ -37,10 +37,11 @@
 		   (0xff & pat)) << 8) | (0xff & pat))
 
 #if (defined(CONFIG_ARCH_POSIX) || defined(CONFIG_BOARD_QEMU_X86))
-static const struct device *const flash_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+#define FLASH_DEV DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller))
 #else
-static const struct device *const flash_dev = DEVICE_DT_GET(DT_NODELABEL(sim_flash_controller));
+#define FLASH_DEV DEVICE_DT_GET(DT_NODELABEL(sim_flash_controller))
 #endif
+static const struct device *const flash_dev = FLASH_DEV;
 static uint8_t test_read_buf[TEST_SIM_FLASH_SIZE];
 
 static uint32_t p32_inc;
@@ -556,6 +557,61 @@ ZTEST(flash_sim_api, test_flash_flatten)
 #endif
 }
 
+#if defined(CONFIG_FLASH_RTIO)
+RTIO_DEFINE(flash_rtio, 4, 4);
+FLASH_IODEV_DEFINE(flash_iodev, FLASH_DEV);
+
+static int test_rtio_wait(void)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&flash_rtio);
+	int rc = cqe->result;
+
+	rtio_cqe_release(&flash_rtio, cqe);
+
+	return rc;
+}
+
+/* Test erase, write and read queued through RTIO */
+ZTEST(flash_sim_api, test_rtio)
+{
+	uint8_t buf[FLASH_SIMULATOR_ERASE_UNIT];
+	struct rtio_sqe *sqe;
+	int rc;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = i ^ 0x5a;
+	}
+
+	sqe = flash_rtio_erase(&flash_rtio, &flash_iodev, FLASH_SIMULATOR_BASE_OFFSET,
+			       FLASH_SIMULATOR_ERASE_UNIT, NULL);
+	zassert_not_null(sqe, "Failed to queue erase");
+	sqe = flash_rtio_write(&flash_rtio, &flash_iodev, FLASH_SIMULATOR_BASE_OFFSET, buf,
+			       sizeof(buf), NULL);
+	zassert_not_null(sqe, "Failed to queue write");
+	rtio_submit(&flash_rtio, 2);
+
+	zassert_equal(0, test_rtio_wait(), "erase through RTIO should succeed");
+	zassert_equal(0, test_rtio_wait(), "write through RTIO should succeed");
+
+	memset(test_read_buf, 0, sizeof(buf));
+	sqe = flash_rtio_read(&flash_rtio, &flash_iodev, FLASH_SIMULATOR_BASE_OFFSET,
+			      test_read_buf, sizeof(buf), NULL);
+	zassert_not_null(sqe, "Failed to queue read");
+	rtio_submit(&flash_rtio, 1);
+
+	zassert_equal(0, test_rtio_wait(), "read through RTIO should succeed");
+	zassert_mem_equal(buf, test_read_buf, sizeof(buf), "Unexpected data read");
+
+	sqe = flash_rtio_read(&flash_rtio, &flash_iodev, TEST_SIM_FLASH_END, test_read_buf, 4,
+			      NULL);
+	zassert_not_null(sqe, "Failed to queue read");
+	rtio_submit(&flash_rtio, 1);
+
+	rc = test_rtio_wait();
+	zassert_equal(-EINVAL, rc, "Unexpected error code (%d)", rc);
+}
+#endif
+
 #include <zephyr/drivers/flash/flash_simulator.h>
 
 ZTEST(flash_sim_api, test_get_mock)
@@ -12,6 +12,7 @@
 #include <zephyr/fff.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -240,3 +241,81 @@ ZTEST_F(icm42688, test_interrupt)
 	/* Verify the handler was called */
 	zassert_equal(test_interrupt_trigger_handler_fake.call_count, 1);
 }
+
+#define TEST_FIFO_FRAMES 4
+
+struct test_fifo_buffer {
+	struct icm42688_fifo_data header;
+	uint8_t packets[TEST_FIFO_FRAMES][16];
+} __packed;
+
+static void test_decode_three_axis_channel(const struct sensor_decoder_api *decoder,
+					   const uint8_t *buffer, enum sensor_channel chan)
+{
+	struct sensor_decode_context aos_ctx = SENSOR_DECODE_CONTEXT_INIT(decoder, buffer, chan, 0);
+	struct sensor_decode_context soa_ctx = SENSOR_DECODE_CONTEXT_INIT(decoder, buffer, chan, 0);
+	uint8_t aos_buf[sizeof(struct sensor_three_axis_data) +
+			(TEST_FIFO_FRAMES - 1) * sizeof(struct sensor_three_axis_sample_data)]
+		__aligned(8);
+	struct sensor_three_axis_data *aos = (struct sensor_three_axis_data *)aos_buf;
+	uint32_t timestamp_delta[TEST_FIFO_FRAMES];
+	q31_t x[TEST_FIFO_FRAMES];
+	q31_t y[TEST_FIFO_FRAMES];
+	q31_t z[TEST_FIFO_FRAMES];
+	struct sensor_three_axis_soa soa = {
+		.timestamp_delta = timestamp_delta,
+		.x = x,
+		.y = y,
+		.z = z,
+	};
+
+	zassert_equal(TEST_FIFO_FRAMES, sensor_decode(&aos_ctx, aos, TEST_FIFO_FRAMES));
+	zassert_equal(TEST_FIFO_FRAMES,
+		      sensor_decode_three_axis(&soa_ctx, &soa, TEST_FIFO_FRAMES));
+	zassert_equal(0, sensor_decode_three_axis(&soa_ctx, &soa, TEST_FIFO_FRAMES));
+
+	zassert_equal(aos->header.base_timestamp_ns, soa.header.base_timestamp_ns);
+	zassert_equal(aos->shift, soa.shift);
+	for (int i = 0; i < TEST_FIFO_FRAMES; i++) {
+		zassert_equal(aos->readings[i].timestamp_delta, timestamp_delta[i]);
+		zassert_equal(aos->readings[i].x, x[i], "frame %d", i);
+		zassert_equal(aos->readings[i].y, y[i], "frame %d", i);
+		zassert_equal(aos->readings[i].z, z[i], "frame %d", i);
+	}
+}
+
+ZTEST_F(icm42688, test_decode_three_axis_fifo)
+{
+	const struct sensor_decoder_api *decoder;
+	struct test_fifo_buffer buf = {
+		.header = {
+			.header = {
+				.timestamp = 123456789,
+				.is_fifo = 1,
+				.gyro_fs = ICM42688_DT_GYRO_FS_500,
+				.accel_fs = ICM42688_DT_ACCEL_FS_4,
+			},
+			.gyro_odr = ICM42688_DT_GYRO_ODR_1000,
+			.accel_odr = ICM42688_DT_ACCEL_ODR_1000,
+			.fifo_count = sizeof(buf.packets),
+		},
+	};
+
+	for (int i = 0; i < TEST_FIFO_FRAMES; i++) {
+		uint8_t *pkt = buf.packets[i];
+
+		pkt[0] = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		/* Accel and gyro axes, big endian */
+		for (int axis = 0; axis < 6; axis++) {
+			int16_t value = (i + 1) * (axis + 1) * ((axis % 2) ? -1000 : 1000);
+
+			sys_put_be16(value, &pkt[1 + axis * 2 + (axis >= 3 ? 1 : 0)]);
+		}
+	}
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_not_null(decoder->decode_three_axis);
+
+	test_decode_three_axis_channel(decoder, (const uint8_t *)&buf, SENSOR_CHAN_ACCEL_XYZ);
+	test_decode_three_axis_channel(decoder, (const uint8_t *)&buf, SENSOR_CHAN_GYRO_XYZ);
+}
@@ -65,6 +65,32 @@ ZTEST(cache_api, test_data_cache_api)
 
 }
 
+ZTEST(cache_api, test_data_cache_ranges_api)
+{
+	/* Unsorted, overlapping, adjoining, empty and separate ranges */
+	struct sys_cache_range ranges[] = {
+		{ &user_buffer[256], 64 },
+		{ &user_buffer[0], 128 },
+		{ &user_buffer[64], 128 },
+		{ &user_buffer[192], 0 },
+		{ &user_buffer[192], 1 },
+		{ &user_buffer[2048], 512 },
+	};
+	int ret;
+
+	ret = sys_cache_data_flush_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	ret = sys_cache_data_invd_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	ret = sys_cache_data_flush_and_invd_ranges(ranges, ARRAY_SIZE(ranges));
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+
+	ret = sys_cache_data_flush_ranges(ranges, 0);
+	zassert_true((ret == 0) || (ret == -ENOTSUP));
+}
+
 ZTEST_USER(cache_api, test_data_cache_api_user)
 {
 	int ret;
@@ -493,6 +493,81 @@ void alloc_and_free_interval(void)
 	}
 }
 
+SYS_BITARRAY_DEFINE_STATIC(ba_frag, 2500);
+
+/* First fit, bit by bit */
+static int first_free_region(sys_bitarray_t *ba, size_t num_bits)
+{
+	for (size_t off = 0; off + num_bits <= ba->num_bits; off++) {
+		if (sys_bitarray_is_region_cleared(ba, num_bits, off)) {
+			return off;
+		}
+	}
+
+	return -1;
+}
+
+void alloc_and_free_fragmented(void)
+{
+	static struct {
+		size_t offset;
+		size_t num_bits;
+	} allocs[256];
+	size_t num_allocs = 0;
+	uint32_t rand = 1;
+	size_t offset;
+	int expected;
+	int ret;
+
+	printk("Testing bit array alloc and free with fragmentation\n");
+
+	for (int i = 0; i < 2000; i++) {
+		rand = rand * 1103515245U + 12345U;
+
+		if (num_allocs == ARRAY_SIZE(allocs) || (num_allocs > 0 && (rand >> 28) < 6)) {
+			/* Free a random region */
+			size_t idx = (rand >> 8) % num_allocs;
+
+			ret = sys_bitarray_free(&ba_frag, allocs[idx].num_bits,
+						allocs[idx].offset);
+			zassert_equal(ret, 0, "sys_bitarray_free() failed: %d", ret);
+			allocs[idx] = allocs[--num_allocs];
+			continue;
+		}
+
+		/* Mostly small regions, some spanning several bundles */
+		allocs[num_allocs].num_bits = ((rand >> 16) % 8 == 0) ? (rand >> 8) % 100 + 1
+								      : (rand >> 8) % 8 + 1;
+		expected = first_free_region(&ba_frag, allocs[num_allocs].num_bits);
+
+		ret = sys_bitarray_alloc(&ba_frag, allocs[num_allocs].num_bits, &offset);
+		if (expected < 0) {
+			zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc() expected to fail: %d",
+				      ret);
+			continue;
+		}
+
+		zassert_equal(ret, 0, "sys_bitarray_alloc() failed: %d", ret);
+		zassert_equal(offset, expected, "sys_bitarray_alloc() offset expected %d, got %d",
+			      expected, offset);
+		allocs[num_allocs++].offset = offset;
+	}
+
+	while (num_allocs > 0) {
+		num_allocs--;
+		ret = sys_bitarray_free(&ba_frag, allocs[num_allocs].num_bits,
+					allocs[num_allocs].offset);
+		zassert_equal(ret, 0, "sys_bitarray_free() failed: %d", ret);
+	}
+
+	/* Everything is free again */
+	ret = sys_bitarray_alloc(&ba_frag, ba_frag.num_bits, &offset);
+	zassert_equal(ret, 0, "sys_bitarray_alloc() of all bits failed: %d", ret);
+	zassert_equal(offset, 0, "sys_bitarray_alloc() offset expected 0, got %d", offset);
+	ret = sys_bitarray_free(&ba_frag, ba_frag.num_bits, 0);
+	zassert_equal(ret, 0, "sys_bitarray_free() failed: %d", ret);
+}
+
 /**
  * @brief Test bitarrays allocation and free
  *
@@ -518,6 +593,8 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	}
 
 	alloc_and_free_interval();
+
+	alloc_and_free_fragmented();
 }
 
 ZTEST(bitarray, test_bitarray_popcount_region)
@@ -390,6 +390,51 @@ ZTEST_USER(condvar_tests, test_multiple_condvar_wait_wake)
 	}
 }
 
+ZTEST_BMEM int wake_order[TOTAL_THREADS_WAITING];
+ZTEST_BMEM atomic_t wake_count;
+
+void condvar_wait_order_task(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+
+	k_mutex_lock(&test_mutex, K_FOREVER);
+	zassert_ok(k_condvar_wait(&simple_condvar, &test_mutex, K_FOREVER));
+	wake_order[atomic_inc(&wake_count)] = idx;
+	k_mutex_unlock(&test_mutex);
+}
+
+/**
+ * @brief Test that broadcast wakes all waiters in priority order
+ */
+ZTEST_USER(condvar_tests, test_condvar_broadcast_prio_order)
+{
+	k_condvar_init(&simple_condvar);
+	atomic_clear(&wake_count);
+
+	/* Lowest priority waiter starts waiting first */
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i], multiple_stack[i],
+				STACK_SIZE, condvar_wait_order_task,
+				INT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(TOTAL_THREADS_WAITING - i),
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(k_condvar_broadcast(&simple_condvar), TOTAL_THREADS_WAITING);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_join(&multiple_tid[i], K_FOREVER);
+	}
+
+	zassert_equal(atomic_get(&wake_count), TOTAL_THREADS_WAITING);
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		zassert_equal(wake_order[i], TOTAL_THREADS_WAITING - 1 - i,
+			      "thread %d woken out of priority order", wake_order[i]);
+	}
+}
+
 #ifdef CONFIG_USERSPACE
 static void cond_init_null(void *p1, void *p2, void *p3)
 {
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT vnd_pinit_device
+
+struct pinit_config {
+	uint32_t delay_ms;
+};
+
+struct pinit_data {
+	int64_t start;
+	int64_t end;
+};
+
+static int pinit_device_init(const struct device *dev)
+{
+	const struct pinit_config *config = dev->config;
+	struct pinit_data *data = dev->data;
+
+	data->start = k_uptime_get();
+	k_sleep(K_MSEC(config->delay_ms));
+	data->end = k_uptime_get();
+
+	return 0;
+}
+
+#define PINIT_DEVICE_DEFINE(inst)						\
+	static const struct pinit_config pinit_config_##inst = {		\
+		.delay_ms = DT_INST_PROP(inst, init_delay_ms),			\
+	};									\
+	static struct pinit_data pinit_data_##inst;				\
+	DEVICE_DT_INST_DEFINE(inst, pinit_device_init, NULL,			\
+			      &pinit_data_##inst, &pinit_config_##inst,		\
+			      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE,	\
+			      NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(PINIT_DEVICE_DEFINE)
+
+#define PINIT_DATA(node) ((struct pinit_data *)DEVICE_DT_GET(DT_NODELABEL(node))->data)
+
+/* A SYS_INIT() hook after the devicetree devices, and a device after it */
+static int64_t hook_start;
+static int64_t hook_end;
+static int64_t late_start;
+
+static int pinit_hook(void)
+{
+	hook_start = k_uptime_get();
+	k_sleep(K_MSEC(10));
+	hook_end = k_uptime_get();
+
+	return 0;
+}
+
+SYS_INIT(pinit_hook, POST_KERNEL, 98);
+
+static int late_device_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	late_start = k_uptime_get();
+
+	return 0;
+}
+
+DEVICE_DEFINE(late_device, "late_device", late_device_init, NULL, NULL, NULL,
+	      POST_KERNEL, 99, NULL);
+
+/**
+ * @brief Independent devices are initialized concurrently
+ */
+ZTEST(device_init_parallel, test_independent_overlap)
+{
+	struct pinit_data *a = PINIT_DATA(pinit_a);
+	struct pinit_data *b = PINIT_DATA(pinit_b);
+
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(pinit_a))));
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(pinit_b))));
+	zassert_true(b->start < a->end, "pinit-b waited for pinit-a");
+}
+
+/**
+ * @brief A device is initialized after the devices it requires
+ */
+ZTEST(device_init_parallel, test_dependency_order)
+{
+	struct pinit_data *a = PINIT_DATA(pinit_a);
+	struct pinit_data *c = PINIT_DATA(pinit_c);
+
+	zassert_true(device_is_ready(DEVICE_DT_GET(DT_NODELABEL(pinit_c))));
+	zassert_true(c->start >= a->end, "pinit-c started before pinit-a was done");
+}
+
+/**
+ * @brief SYS_INIT() hooks wait for and hold back other entries
+ */
+ZTEST(device_init_parallel, test_sys_init_barrier)
+{
+	zassert_true(hook_start >= PINIT_DATA(pinit_b)->end);
+	zassert_true(hook_start >= PINIT_DATA(pinit_c)->end);
+	zassert_true(late_start >= hook_end, "late device started during the hook");
+}
+
+ZTEST_SUITE(device_init_parallel, NULL, NULL, NULL, NULL, NULL);
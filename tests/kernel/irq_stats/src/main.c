@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_stats.h>
+#include <zephyr/ztest.h>
+
+#define BUSY_WAIT_US 500
+
+static void reset_all(void)
+{
+	for (unsigned int irq = 0; irq < IRQ_STATS_NUM_IRQS; irq++) {
+		zassert_ok(irq_stats_reset(irq));
+	}
+}
+
+static uint32_t hist_sum(const uint32_t *hist)
+{
+	uint32_t sum = 0U;
+
+	for (int i = 0; i < CONFIG_IRQ_STATS_BUCKETS; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+
+/* Return the total number of handler calls, checking the histograms */
+static uint32_t check_all(uint32_t *duration_max)
+{
+	struct irq_stats stats;
+	uint32_t total = 0U;
+
+	*duration_max = 0U;
+
+	for (unsigned int irq = 0; irq < IRQ_STATS_NUM_IRQS; irq++) {
+		zassert_ok(irq_stats_query(irq, &stats));
+		zassert_equal(hist_sum(stats.duration), stats.count, "IRQ %u", irq);
+		zassert_equal(hist_sum(stats.latency), stats.count, "IRQ %u", irq);
+		zassert_true(stats.duration_total >= stats.duration_max, "IRQ %u", irq);
+
+		total += stats.count;
+		*duration_max = MAX(*duration_max, stats.duration_max);
+	}
+
+	return total;
+}
+
+ZTEST(irq_stats, test_count)
+{
+	uint32_t duration_max;
+
+	reset_all();
+	zassert_equal(check_all(&duration_max), 0U);
+
+	/* The system timer interrupt at least is handled meanwhile */
+	k_msleep(100);
+
+	zassert_true(check_all(&duration_max) > 0U, "no interrupt accounted for");
+
+	reset_all();
+	zassert_equal(check_all(&duration_max), 0U);
+}
+
+static void busy_expiry(struct k_timer *timer)
+{
+	k_busy_wait(BUSY_WAIT_US);
+}
+
+ZTEST(irq_stats, test_duration)
+{
+	struct k_timer timer;
+	uint32_t duration_max;
+
+	k_timer_init(&timer, busy_expiry, NULL);
+
+	reset_all();
+	k_timer_start(&timer, K_MSEC(10), K_NO_WAIT);
+	k_msleep(50);
+
+	/* The timer expiry function runs in the timer interrupt handler */
+	zassert_true(check_all(&duration_max) > 0U, "no interrupt accounted for");
+	zassert_true(duration_max >= k_us_to_cyc_floor32(BUSY_WAIT_US),
+		     "duration %u cycles shorter than the busy wait", duration_max);
+}
+
+ZTEST(irq_stats, test_invalid)
+{
+	struct irq_stats stats;
+
+	zassert_equal(irq_stats_query(IRQ_STATS_NUM_IRQS, &stats), -EINVAL);
+	zassert_equal(irq_stats_reset(IRQ_STATS_NUM_IRQS), -EINVAL);
+}
+
+ZTEST_SUITE(irq_stats, NULL, NULL, NULL, NULL, NULL);
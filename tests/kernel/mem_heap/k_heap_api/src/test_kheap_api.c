@@ -265,3 +265,94 @@ ZTEST(k_heap_api, test_k_heap_alloc_pending_null)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+#define CACHE_HEAP_SIZE 1024
+#define CACHE_BLOCK_SIZE 24
+
+K_HEAP_DEFINE(cache_heap, CACHE_HEAP_SIZE);
+static void *cache_blocks[CACHE_HEAP_SIZE / CACHE_BLOCK_SIZE];
+
+/* Fill cache_heap with small blocks, returns their number */
+static int cache_heap_fill(void)
+{
+	int n = 0;
+
+	while ((n < ARRAY_SIZE(cache_blocks)) &&
+	       ((cache_blocks[n] = k_heap_alloc(&cache_heap, CACHE_BLOCK_SIZE,
+						K_NO_WAIT)) != NULL)) {
+		n++;
+	}
+	zassert_true(n < ARRAY_SIZE(cache_blocks), "heap not exhausted");
+
+	return n;
+}
+
+/**
+ * @brief Test that a freed small block is reused from the CPU cache
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cpu_cache_reuse)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_KHEAP_CPU_CACHE);
+
+	void *p = k_heap_alloc(&cache_heap, CACHE_BLOCK_SIZE, K_NO_WAIT);
+	void *q;
+
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&cache_heap, p);
+
+	/* Any size of the same class gets the same block */
+	q = k_heap_alloc(&cache_heap, CACHE_BLOCK_SIZE + 4, K_NO_WAIT);
+	zassert_equal(p, q, "cached block not reused %p != %p", p, q);
+	k_heap_free(&cache_heap, q);
+}
+
+/**
+ * @brief Test that cached blocks are flushed back when the heap runs out
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cpu_cache_flush)
+{
+	int n = cache_heap_fill();
+	void *p;
+
+	for (int i = 0; i < n; i++) {
+		k_heap_free(&cache_heap, cache_blocks[i]);
+	}
+
+	p = k_heap_alloc(&cache_heap, CACHE_HEAP_SIZE / 2, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks not given back");
+	k_heap_free(&cache_heap, p);
+}
+
+static void thread_alloc_small(void *p1, void *p2, void *p3)
+{
+	void *p = k_heap_alloc(&cache_heap, CACHE_HEAP_SIZE / 4, K_MSEC(200));
+
+	zassert_not_null(p, "waiter not woken by a cached free");
+	k_heap_free(&cache_heap, p);
+}
+
+/**
+ * @brief Test that blocks freed to a CPU cache wake threads waiting for memory
+ *
+ * @ingroup kernel_heap_tests
+ */
+ZTEST(k_heap_api, test_k_heap_cpu_cache_pending)
+{
+	int n = cache_heap_fill();
+
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      thread_alloc_small, NULL, NULL, NULL,
+				      K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+
+	k_msleep(5);
+
+	for (int i = 0; i < n; i++) {
+		k_heap_free(&cache_heap, cache_blocks[i]);
+	}
+
+	k_thread_join(tid, K_FOREVER);
+}
@@ -113,6 +113,12 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#if CONFIG_DEMAND_PAGING_READ_AHEAD > 0
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
+	printk("    - Read-ahead hits: %lu\n", stats->read_ahead.hits);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 }
 
 static void touch_anon_pages(bool zig, bool zag)
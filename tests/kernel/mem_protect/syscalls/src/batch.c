@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/ztest.h>
+#include "test_syscalls.h"
+
+static K_SEM_DEFINE(batch_sem, 0, 10);
+
+/**
+ * @brief Test that each entry of a batch runs and reports its result
+ */
+ZTEST_USER(syscall_batch, test_batch_results)
+{
+	struct k_syscall_batch_entry batch[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_COUNT_GET, (uintptr_t)&batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_SYSCALL_CONTEXT),
+	};
+
+	k_sem_reset(&batch_sem);
+
+	zassert_ok(k_syscall_batch(batch, ARRAY_SIZE(batch)));
+	zassert_equal(batch[3].ret, 3, "sem count %lu", (unsigned long)batch[3].ret);
+	zassert_true(batch[4].ret, "batch entry not run in syscall context");
+	zassert_equal(k_sem_count_get(&batch_sem), 3);
+}
+
+/**
+ * @brief Test that a failing entry doesn't stop the batch
+ */
+ZTEST_USER(syscall_batch, test_batch_errors)
+{
+	/* K_NO_WAIT is all zeroes, whether it takes one word or two */
+	struct k_syscall_batch_entry batch[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_TAKE, (uintptr_t)&batch_sem, 0, 0),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_TAKE, (uintptr_t)&batch_sem, 0, 0),
+	};
+
+	k_sem_reset(&batch_sem);
+
+	zassert_ok(k_syscall_batch(batch, ARRAY_SIZE(batch)));
+	zassert_equal((int)batch[0].ret, -EBUSY);
+	zassert_equal((int)batch[2].ret, 0);
+	zassert_equal(k_sem_count_get(&batch_sem), 0);
+}
+
+/**
+ * @brief Test that supervisor threads are not offered batching
+ */
+ZTEST(syscall_batch, test_batch_supervisor)
+{
+	struct k_syscall_batch_entry batch[] = {
+		K_SYSCALL_BATCH_ENTRY(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+	};
+
+	k_sem_reset(&batch_sem);
+
+	zassert_equal(k_syscall_batch(batch, ARRAY_SIZE(batch)), -ENOTSUP);
+	zassert_equal(k_sem_count_get(&batch_sem), 0);
+}
+
+/**
+ * @brief Test that oversized batches are rejected
+ */
+ZTEST_USER(syscall_batch, test_batch_too_big)
+{
+	static ZTEST_BMEM struct k_syscall_batch_entry
+		batch[CONFIG_SYSCALL_BATCH_MAX_ENTRIES + 1];
+
+	zassert_equal(k_syscall_batch(batch, ARRAY_SIZE(batch)), -EINVAL);
+}
+
+static void *syscall_batch_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &batch_sem);
+
+	return NULL;
+}
+
+ZTEST_SUITE(syscall_batch, NULL, syscall_batch_setup, NULL, NULL, NULL);
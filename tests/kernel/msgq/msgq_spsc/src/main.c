@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MSGQ_LEN 4
+#define NUM_MSGS 200
+
+static struct k_msgq msgq;
+static char __aligned(4) buffer[MSGQ_LEN * sizeof(uint32_t)];
+
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+static struct k_thread thread;
+
+static uint32_t isr_next;
+
+static void put_entry(void *p1, void *p2, void *p3)
+{
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		zassert_ok(k_msgq_put(&msgq, &i, K_FOREVER));
+	}
+}
+
+static void timer_fn(struct k_timer *timer)
+{
+	/* Put as many messages as fit, from an ISR */
+	while ((isr_next < NUM_MSGS) && (k_msgq_put(&msgq, &isr_next, K_NO_WAIT) == 0)) {
+		isr_next++;
+	}
+
+	if (isr_next == NUM_MSGS) {
+		k_timer_stop(timer);
+	}
+}
+
+static K_TIMER_DEFINE(timer, timer_fn, NULL);
+
+/**
+ * @brief Messages come out in order, and full or empty queues fail
+ */
+ZTEST(msgq_spsc, test_put_get)
+{
+	uint32_t msg;
+
+	zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), -ENOMSG);
+
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_put(&msgq, &i, K_NO_WAIT));
+		zassert_equal(k_msgq_num_used_get(&msgq), i + 1);
+	}
+
+	msg = MSGQ_LEN;
+	zassert_equal(k_msgq_put(&msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+
+	zassert_ok(k_msgq_peek_at(&msgq, &msg, 1));
+	zassert_equal(msg, 1);
+
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_get(&msgq, &msg, K_NO_WAIT));
+		zassert_equal(msg, i);
+	}
+
+	zassert_equal(k_msgq_num_free_get(&msgq), MSGQ_LEN);
+}
+
+/**
+ * @brief A consumer thread waits for messages put from an ISR
+ */
+ZTEST(msgq_spsc, test_isr_producer)
+{
+	uint32_t msg;
+
+	isr_next = 0;
+	k_timer_start(&timer, K_TICKS(1), K_TICKS(1));
+
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		zassert_ok(k_msgq_get(&msgq, &msg, K_FOREVER));
+		zassert_equal(msg, i, "got message %u instead of %u", msg, i);
+	}
+
+	k_timer_stop(&timer);
+}
+
+/**
+ * @brief A producer thread waits for space freed by the consumer
+ */
+ZTEST(msgq_spsc, test_blocking_producer)
+{
+	uint32_t msg;
+
+	k_thread_create(&thread, stack, STACK_SIZE, put_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < NUM_MSGS; i++) {
+		/* Let the producer fill the queue up and wait every so often */
+		if ((i % (MSGQ_LEN * 4)) == 0U) {
+			k_sleep(K_MSEC(1));
+		}
+
+		zassert_ok(k_msgq_get(&msgq, &msg, K_FOREVER));
+		zassert_equal(msg, i, "got message %u instead of %u", msg, i);
+	}
+
+	k_thread_join(&thread, K_FOREVER);
+}
+
+/**
+ * @brief Waiting for a message times out
+ */
+ZTEST(msgq_spsc, test_get_timeout)
+{
+	uint32_t msg;
+
+	zassert_equal(k_msgq_get(&msgq, &msg, K_MSEC(20)), -EAGAIN);
+
+	msg = 42;
+	zassert_ok(k_msgq_put(&msgq, &msg, K_NO_WAIT));
+	msg = 0;
+	zassert_ok(k_msgq_get(&msgq, &msg, K_MSEC(20)));
+	zassert_equal(msg, 42);
+}
+
+/**
+ * @brief Purging drops queued messages, and the queue stays usable
+ */
+ZTEST(msgq_spsc, test_purge)
+{
+	uint32_t msg;
+
+	for (uint32_t i = 0; i < MSGQ_LEN - 1; i++) {
+		zassert_ok(k_msgq_put(&msgq, &i, K_NO_WAIT));
+	}
+
+	k_msgq_purge(&msgq);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), -ENOMSG);
+
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_put(&msgq, &i, K_NO_WAIT));
+	}
+	for (uint32_t i = 0; i < MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_get(&msgq, &msg, K_NO_WAIT));
+		zassert_equal(msg, i);
+	}
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	k_msgq_init_spsc(&msgq, buffer, sizeof(uint32_t), MSGQ_LEN);
+}
+
+ZTEST_SUITE(msgq_spsc, NULL, NULL, before, NULL, NULL);
@@ -62,7 +62,7 @@ ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_2);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_3);
 ZTEST_BMEM SYS_MUTEX_DEFINE(mutex_4);
 
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST)
 static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
@@ -447,8 +447,10 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST)
+	/* coverage for get_k_mutex checks, the fast path would fault on
+	 * these before reaching the kernel
+	 */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -457,7 +459,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_unlock((struct sys_mutex *)k_current_get());
 	zassert_true(rv == -EINVAL, "accepted object that was not a mutex");
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST */
 
 	rv = sys_mutex_unlock(&not_my_mutex);
 	zassert_true(rv == -EPERM, "unlocked a mutex that wasn't owner");
@@ -467,7 +469,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -476,7 +478,7 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
 #else
 	ztest_test_skip();
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST */
 }
 
 /*test case main entry*/
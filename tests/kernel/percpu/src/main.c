@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/percpu.h>
+#include <zephyr/ztest.h>
+
+#define NUM_THREADS 4
+#define NUM_INCREMENTS 10000
+#define STACK_SIZE (640 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct pair {
+	uint32_t a;
+	uint32_t b;
+};
+
+K_PERCPU_DECLARE(uint64_t, test_counter);
+K_PERCPU_DEFINE(test_counter);
+
+K_PERCPU_DEFINE_STATIC(struct pair, test_pair);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static void counter_thread(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_INCREMENTS; i++) {
+		K_PERCPU_ADD(test_counter, 1);
+
+		if ((i % 100) == 0) {
+			k_yield();
+		}
+	}
+}
+
+/**
+ * @brief Concurrent per-CPU increments all show up in the sum
+ */
+ZTEST(percpu, test_sum)
+{
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, counter_thread,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	zassert_equal(K_PERCPU_SUM(test_counter), NUM_THREADS * NUM_INCREMENTS);
+}
+
+/**
+ * @brief Each CPU's instance is separate and suitably aligned
+ */
+ZTEST(percpu, test_layout)
+{
+	unsigned int key = arch_irq_lock();
+	struct pair *mine = K_PERCPU_PTR(test_pair);
+
+	mine->a = 1;
+	mine->b = 2;
+
+#ifdef CONFIG_SMP
+	zassert_equal(mine, K_PERCPU_CPU_PTR(test_pair, arch_curr_cpu()->id));
+#else
+	zassert_equal(mine, K_PERCPU_CPU_PTR(test_pair, 0));
+#endif
+	arch_irq_unlock(key);
+
+	zassert_true(IS_ALIGNED(K_PERCPU_CPU_PTR(test_pair, 0), K_PERCPU_ALIGN));
+
+	if (arch_num_cpus() > 1) {
+		uintptr_t gap = (uintptr_t)K_PERCPU_CPU_PTR(test_pair, 1) -
+				(uintptr_t)K_PERCPU_CPU_PTR(test_pair, 0);
+
+		zassert_true(gap >= K_PERCPU_ALIGN, "instances %u bytes apart",
+			     (unsigned int)gap);
+	}
+}
+
+struct percpu_obj {
+	int id;
+	K_PERCPU_MEMBER(uint32_t, count);
+};
+
+static struct percpu_obj test_obj;
+
+/**
+ * @brief A per-CPU member of a structure works like a per-CPU variable
+ */
+ZTEST(percpu, test_member)
+{
+	K_PERCPU_ADD(test_obj.count, 3);
+	K_PERCPU_ADD(test_obj.count, 4);
+
+	zassert_equal(K_PERCPU_SUM(test_obj.count), 7);
+	zassert_true(IS_ALIGNED(K_PERCPU_CPU_PTR(test_obj.count, 0), K_PERCPU_ALIGN));
+}
+
+ZTEST_SUITE(percpu, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define NUM_SEMS 16
+#define SET_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_sem set_sems[NUM_SEMS];
+static struct k_poll_event set_events[NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event signal_event;
+static struct k_poll_set set;
+
+static K_THREAD_STACK_DEFINE(set_stack, SET_STACK_SIZE);
+static struct k_thread set_thread;
+
+static void set_prepare(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		set_events[i].tag = i;
+		zassert_ok(k_poll_set_add(&set, &set_events[i]));
+	}
+}
+
+static void set_cleanup(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_remove(&set, &set_events[i]));
+	}
+}
+
+static void give_sem(void *p1, void *p2, void *p3)
+{
+	k_msleep(50);
+	k_sem_give(&set_sems[POINTER_TO_INT(p1)]);
+}
+
+/**
+ * @brief Only the events that fired are returned by a poll set
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_prepare();
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&set_sems[3]);
+	k_sem_give(&set_sems[11]);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 2);
+	zassert_equal(ready[0]->tag, 3);
+	zassert_equal(ready[1]->tag, 11);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Level-triggered: still ready until consumed */
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 2);
+	zassert_ok(k_sem_take(&set_sems[3], K_NO_WAIT));
+	zassert_ok(k_sem_take(&set_sems[11], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	/* Events that don't fit are returned by the next call */
+	k_sem_give(&set_sems[0]);
+	k_sem_give(&set_sems[1]);
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 0);
+	zassert_ok(k_sem_take(&set_sems[0], K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 1);
+	zassert_ok(k_sem_take(&set_sems[1], K_NO_WAIT));
+
+	set_cleanup();
+}
+
+/**
+ * @brief A thread waiting on a poll set is woken by any of its events
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_prepare();
+
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			give_sem, INT_TO_POINTER(7), NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_MSEC(1000)), 1);
+	zassert_equal(ready[0]->tag, 7);
+	zassert_ok(k_sem_take(&set_sems[7], K_NO_WAIT));
+	k_thread_join(&set_thread, K_FOREVER);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_MSEC(50)), -EAGAIN);
+
+	/* A thread polling the same semaphore is served first */
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			give_sem, INT_TO_POINTER(5), NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE,
+							     K_POLL_MODE_NOTIFY_ONLY,
+							     &set_sems[5]);
+
+	zassert_ok(k_poll(&event, 1, K_MSEC(1000)));
+	zassert_equal(event.state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_ok(k_sem_take(&set_sems[5], K_NO_WAIT));
+	k_thread_join(&set_thread, K_FOREVER);
+
+	set_cleanup();
+}
+
+/**
+ * @brief Poll signals, removal and ownership of poll set events
+ *
+ * @ingroup kernel_poll_tests
+ */
+ZTEST(poll_api_1cpu, test_poll_set_signal_remove)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_prepare();
+
+	k_poll_signal_init(&set_signal);
+	k_poll_event_init(&signal_event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	zassert_ok(k_poll_set_add(&set, &signal_event));
+	zassert_equal(k_poll_set_add(&set, &signal_event), -EALREADY);
+
+	zassert_ok(k_poll_signal_raise(&set_signal, 42));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &signal_event);
+	zassert_equal(signal_event.state, K_POLL_STATE_SIGNALED);
+	k_poll_signal_reset(&set_signal);
+
+	/* Removed events no longer fire, ready or not */
+	k_sem_give(&set_sems[2]);
+	zassert_ok(k_poll_set_remove(&set, &set_events[2]));
+	zassert_equal(k_poll_set_remove(&set, &set_events[2]), -EINVAL);
+	zassert_ok(k_poll_set_remove(&set, &signal_event));
+	zassert_ok(k_poll_signal_raise(&set_signal, 0));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), -EAGAIN);
+
+	/* Re-adding an already ready event reports it at once */
+	zassert_ok(k_poll_set_add(&set, &set_events[2]));
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 2);
+	zassert_ok(k_sem_take(&set_sems[2], K_NO_WAIT));
+
+	set_cleanup();
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_READERS 2
+#define NUM_UPDATES 20
+#define POISON 0xdeadbeefU
+
+struct item {
+	struct k_rcu_head head;
+	uint32_t value;
+};
+
+static struct item items[NUM_UPDATES + 1];
+static struct item *shared;
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_READERS, STACK_SIZE);
+static struct k_thread threads[NUM_READERS];
+
+static volatile bool stop;
+static volatile bool saw_poison;
+static atomic_t cb_count;
+
+static void count_cb(struct k_rcu_head *head)
+{
+	ARG_UNUSED(head);
+
+	atomic_inc(&cb_count);
+}
+
+/**
+ * @brief A grace period waits for read-side sections active when it began
+ */
+ZTEST(rcu, test_call_waits_for_reader)
+{
+	struct k_rcu_head head;
+
+	atomic_clear(&cb_count);
+
+	k_rcu_read_lock();
+	k_rcu_call(&head, count_cb);
+
+	/* Busy waiting keeps this CPU in the section */
+	k_busy_wait(50 * USEC_PER_MSEC);
+	zassert_equal(atomic_get(&cb_count), 0, "callback ran during a read-side section");
+
+	k_rcu_read_unlock();
+
+	k_rcu_synchronize();
+	zassert_equal(atomic_get(&cb_count), 1);
+}
+
+/**
+ * @brief Read-side sections nest, and the outermost one ends the section
+ */
+ZTEST(rcu, test_nesting)
+{
+	struct k_rcu_head head;
+
+	atomic_clear(&cb_count);
+
+	k_rcu_read_lock();
+	k_rcu_read_lock();
+	k_rcu_call(&head, count_cb);
+	k_rcu_read_unlock();
+
+	k_busy_wait(20 * USEC_PER_MSEC);
+	zassert_equal(atomic_get(&cb_count), 0);
+
+	k_rcu_read_unlock();
+
+	k_rcu_synchronize();
+	zassert_equal(atomic_get(&cb_count), 1);
+}
+
+static K_SEM_DEFINE(wake_sem, 0, 1);
+static volatile bool woken;
+
+static void waker_thread(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&wake_sem, K_FOREVER);
+	woken = true;
+}
+
+/**
+ * @brief A preemption held off by a read-side section happens at its end
+ */
+ZTEST(rcu, test_deferred_preemption)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	woken = false;
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(5));
+
+	k_thread_create(&threads[0], stacks[0], STACK_SIZE, waker_thread,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	k_rcu_read_lock();
+	k_sem_give(&wake_sem);
+	zassert_false(woken, "preempted in a read-side section");
+	k_rcu_read_unlock();
+
+	zassert_true(woken, "preemption not taken at the end of the section");
+
+	k_thread_join(&threads[0], K_FOREVER);
+	k_thread_priority_set(k_current_get(), prio);
+}
+
+static void reader_thread(void *p1, void *p2, void *p3)
+{
+	while (!stop) {
+		k_rcu_read_lock();
+
+		struct item *it = K_RCU_DEREFERENCE(shared);
+
+		/* Give the writer a chance to replace it meanwhile */
+		k_busy_wait(100);
+
+		if (it->value == POISON) {
+			saw_poison = true;
+		}
+		k_rcu_read_unlock();
+
+		k_yield();
+	}
+}
+
+/**
+ * @brief Readers never see an item reclaimed after a grace period
+ */
+ZTEST(rcu, test_replace)
+{
+	stop = false;
+	saw_poison = false;
+
+	items[0].value = 0;
+	shared = &items[0];
+
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, reader_thread,
+				NULL, NULL, NULL, K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+	}
+
+	for (int i = 1; i <= NUM_UPDATES; i++) {
+		struct item *old = shared;
+
+		items[i].value = i;
+		K_RCU_ASSIGN_POINTER(shared, &items[i]);
+
+		k_rcu_synchronize();
+		old->value = POISON;
+
+		k_sleep(K_MSEC(1));
+	}
+
+	stop = true;
+	for (int i = 0; i < NUM_READERS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	zassert_false(saw_poison, "reader saw a reclaimed item");
+}
+
+ZTEST_SUITE(rcu, NULL, NULL, NULL, NULL, NULL);
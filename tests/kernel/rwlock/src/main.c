@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_THREADS 3
+
+/* The test thread runs below the helpers so they run as soon as ready */
+#define TEST_PRIO K_PRIO_PREEMPT(8)
+#define HELPER_PRIO K_PRIO_PREEMPT(4)
+
+static K_RWLOCK_DEFINE(rwlock);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static atomic_t holding;
+static atomic_t order;
+static int got_at[NUM_THREADS];
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+	got_at[idx] = atomic_inc(&order);
+	atomic_inc(&holding);
+	k_sleep(K_MSEC(POINTER_TO_INT(p2)));
+	atomic_dec(&holding);
+	zassert_ok(k_rwlock_unlock(&rwlock));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_FOREVER));
+	got_at[idx] = atomic_inc(&order);
+	zassert_equal(atomic_get(&holding), 0, "writer shares the lock");
+	k_sleep(K_MSEC(POINTER_TO_INT(p2)));
+	zassert_ok(k_rwlock_unlock(&rwlock));
+}
+
+static void timed_writer_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_MSEC(POINTER_TO_INT(p2))), -EAGAIN);
+}
+
+static void unlock_entry(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_rwlock_unlock(&rwlock), -EPERM);
+}
+
+static void spawn(int idx, k_thread_entry_t entry, int hold_ms, int prio)
+{
+	k_thread_create(&threads[idx], stacks[idx], STACK_SIZE, entry,
+			INT_TO_POINTER(idx), INT_TO_POINTER(hold_ms), NULL,
+			prio, 0, K_NO_WAIT);
+}
+
+static void join_all(int n)
+{
+	for (int i = 0; i < n; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+}
+
+/**
+ * @brief Readers hold the lock together, or not at all while a writer does
+ */
+ZTEST(rwlock, test_shared_readers)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT), "readers exclude each other");
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_MSEC(10)), -EAGAIN);
+	zassert_ok(k_rwlock_unlock(&rwlock));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_rwlock_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+	zassert_ok(k_rwlock_unlock(&rwlock));
+
+	zassert_equal(k_rwlock_unlock(&rwlock), -EINVAL);
+}
+
+/**
+ * @brief Waiting readers are all let in together when a writer unlocks
+ */
+ZTEST(rwlock, test_readers_together)
+{
+	atomic_clear(&order);
+	atomic_clear(&holding);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	spawn(0, reader_entry, 50, HELPER_PRIO);
+	spawn(1, reader_entry, 50, HELPER_PRIO);
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&order), 0, "reader got in with a writer");
+
+	zassert_ok(k_rwlock_unlock(&rwlock));
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&holding), 2, "readers not holding the lock together");
+
+	join_all(2);
+}
+
+/**
+ * @brief A waiting writer goes before readers arriving after it
+ */
+ZTEST(rwlock, test_writer_preference)
+{
+	atomic_clear(&order);
+	atomic_clear(&holding);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, writer_entry, 10, HELPER_PRIO);
+	k_sleep(K_MSEC(10));
+
+	/* A new reader has to wait behind the writer */
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	spawn(1, reader_entry, 10, HELPER_PRIO);
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&order), 0);
+
+	zassert_ok(k_rwlock_unlock(&rwlock));
+	join_all(2);
+
+	zassert_equal(got_at[0], 0, "writer did not go first");
+	zassert_equal(got_at[1], 1);
+}
+
+/**
+ * @brief Readers held back by a writer get in when it gives up
+ */
+ZTEST(rwlock, test_writer_timeout)
+{
+	atomic_clear(&order);
+	atomic_clear(&holding);
+
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	/* Writer waiting with a timeout, then a reader behind it */
+	spawn(0, timed_writer_entry, 50, HELPER_PRIO);
+	k_sleep(K_MSEC(10));
+	spawn(1, reader_entry, 0, HELPER_PRIO);
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&order), 0);
+
+	k_thread_join(&threads[0], K_FOREVER);
+	k_thread_join(&threads[1], K_MSEC(100));
+	zassert_equal(atomic_get(&order), 1, "reader still held back");
+
+	zassert_ok(k_rwlock_unlock(&rwlock));
+}
+
+/**
+ * @brief The writer inherits the priority of the threads waiting for it
+ */
+ZTEST(rwlock, test_priority_inheritance)
+{
+	atomic_clear(&order);
+	atomic_clear(&holding);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, reader_entry, 0, K_PRIO_PREEMPT(2));
+	k_sleep(K_MSEC(5));
+	zassert_equal(k_thread_priority_get(k_current_get()), K_PRIO_PREEMPT(2),
+		      "writer not boosted by a waiting reader");
+
+	spawn(1, writer_entry, 0, K_PRIO_PREEMPT(1));
+	k_sleep(K_MSEC(5));
+	zassert_equal(k_thread_priority_get(k_current_get()), K_PRIO_PREEMPT(1),
+		      "writer not boosted by a waiting writer");
+
+	zassert_ok(k_rwlock_unlock(&rwlock));
+	zassert_equal(k_thread_priority_get(k_current_get()), TEST_PRIO,
+		      "priority not restored");
+
+	join_all(2);
+	zassert_equal(got_at[1], 0, "higher priority writer did not go first");
+}
+
+/**
+ * @brief Only the writer holding the lock may unlock it
+ */
+ZTEST(rwlock, test_unlock_not_owner)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, unlock_entry, 0, HELPER_PRIO);
+	k_thread_join(&threads[0], K_FOREVER);
+
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EDEADLK,
+		      "lock released by another thread");
+	zassert_ok(k_rwlock_unlock(&rwlock));
+}
+
+static void before(void *fixture)
+{
+	k_thread_priority_set(k_current_get(), TEST_PRIO);
+}
+
+ZTEST_SUITE(rwlock, NULL, NULL, before, NULL, NULL);
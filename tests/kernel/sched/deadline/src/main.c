@@ -215,4 +215,76 @@ ZTEST(suite_deadline, test_unqueued)
 	}
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+#define CBS_SPIN_US   100
+#define CBS_BUDGET_MS 2
+#define CBS_PERIOD_MS 10
+#define CBS_WINDOW_MS 100
+
+static volatile uint32_t spin_count[2];
+
+static void spinner(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_busy_wait(CBS_SPIN_US);
+		spin_count[idx]++;
+	}
+}
+
+/**
+ * @brief Validate constant bandwidth server reservations
+ *
+ * @details A reserved thread spins with a deadline earlier than that
+ * of a second spinning thread at the same priority.  Without the
+ * reservation it would run for the whole test; with it, its deadline
+ * is pushed back every time it uses up its budget until the other
+ * thread gets the CPU.
+ *
+ * @ingroup kernel_sched_tests
+ */
+ZTEST(suite_deadline, test_cbs)
+{
+	uint32_t budget = k_ms_to_cyc_ceil32(CBS_BUDGET_MS);
+	uint32_t period = k_ms_to_cyc_ceil32(CBS_PERIOD_MS);
+
+	zassert_equal(k_thread_cbs_set(k_current_get(), period + 1, period), -EINVAL);
+	zassert_equal(k_thread_cbs_set(k_current_get(), 1, 0), -EINVAL);
+
+	spin_count[0] = 0;
+	spin_count[1] = 0;
+
+	for (int i = 0; i < 2; i++) {
+		worker_tids[i] = k_thread_create(&worker_threads[i],
+				worker_stacks[i], STACK_SIZE,
+				spinner, INT_TO_POINTER(i), NULL, NULL,
+				K_LOWEST_APPLICATION_THREAD_PRIO,
+				0, K_FOREVER);
+	}
+
+	zassert_ok(k_thread_cbs_set(worker_tids[0], budget, period));
+	k_thread_deadline_set(worker_tids[1],
+			      k_ms_to_cyc_ceil32(CBS_WINDOW_MS / 2));
+
+	k_thread_start(worker_tids[0]);
+	k_thread_start(worker_tids[1]);
+
+	k_sleep(K_MSEC(CBS_WINDOW_MS));
+
+	k_thread_abort(worker_tids[0]);
+	k_thread_abort(worker_tids[1]);
+
+	zassert_true(spin_count[0] > 0, "reserved thread never ran");
+	zassert_true(spin_count[1] > 0, "reserved thread starved its peer");
+	zassert_true(spin_count[0] * CBS_SPIN_US < CBS_WINDOW_MS * USEC_PER_MSEC / 2,
+		     "reserved thread overran its budget (%u spins)", spin_count[0]);
+
+	zassert_ok(k_thread_cbs_set(worker_tids[0], 0, 0));
+}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
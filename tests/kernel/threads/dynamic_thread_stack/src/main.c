@@ -168,6 +168,49 @@ ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_alloc)
 	}
 }
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CACHE
+/** @brief Freed heap stacks are handed out again */
+ZTEST(dynamic_thread_stack, test_dynamic_thread_stack_cache)
+{
+	struct k_thread_stack_cache_stats before;
+	struct k_thread_stack_cache_stats after;
+	static struct k_thread th;
+	k_thread_stack_t *stack;
+	k_thread_stack_t *again;
+	k_tid_t tid;
+
+	stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE, 0);
+	zassert_not_null(stack);
+
+	k_thread_stack_cache_stats_get(&before);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, stack, CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+			      func, &tflag[0], NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(stack));
+
+	/* A smaller stack of the same size class reuses the freed one */
+	again = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE - 8, 0);
+	zassert_equal_ptr(again, stack);
+
+	k_thread_stack_cache_stats_get(&after);
+	zassert_equal(after.hits, before.hits + 1);
+	zassert_equal(after.cached, before.cached);
+
+	tflag[0] = false;
+	tid = k_thread_create(&th, again, CONFIG_DYNAMIC_THREAD_STACK_SIZE - 8,
+			      func, &tflag[0], NULL, NULL, 0, 0, K_NO_WAIT);
+	zassert_ok(k_thread_join(tid, K_MSEC(TIMEOUT_MS)));
+	zassert_true(tflag[0]);
+	zassert_ok(k_thread_stack_free(again));
+
+	k_thread_stack_cache_stats_get(&after);
+	zassert_equal(after.cached, before.cached + 1);
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CACHE */
+
 K_SEM_DEFINE(perm_sem, 0, 1);
 ZTEST_BMEM static volatile bool expect_fault;
 ZTEST_BMEM static volatile unsigned int expected_reason;
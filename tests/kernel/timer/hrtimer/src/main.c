@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/hrtimer.h>
+#include <zephyr/ztest.h>
+
+/* Well below the 10 ms tick */
+#define DELAY_US  200
+#define PERIOD_US 100
+#define WAIT_US   5000
+
+static struct k_hrtimer timer;
+static volatile uint32_t expiries;
+static volatile uint64_t expired_at;
+static volatile uint32_t restarts;
+
+static void expiry_fn(struct k_hrtimer *t)
+{
+	ARG_UNUSED(t);
+
+	expired_at = k_cycle_get_64();
+	expiries++;
+}
+
+static void restart_fn(struct k_hrtimer *t)
+{
+	expiries++;
+
+	if (restarts > 0) {
+		restarts--;
+		k_hrtimer_start(t, k_us_to_cyc_ceil64(DELAY_US), 0);
+	}
+}
+
+ZTEST(hrtimer, test_one_shot)
+{
+	uint64_t target;
+
+	k_hrtimer_init(&timer, expiry_fn);
+
+	/* Start right after a tick, so that the next one is far away */
+	k_sleep(K_TICKS(1));
+	target = k_cycle_get_64() + k_us_to_cyc_ceil64(DELAY_US);
+	k_hrtimer_start_at(&timer, target, 0);
+	zassert_equal(k_hrtimer_expires_cyc(&timer), target);
+
+	k_busy_wait(WAIT_US);
+
+	zassert_equal(expiries, 1, "expired %u times", expiries);
+	zassert_true(expired_at >= target, "expired early");
+	zassert_equal(k_hrtimer_expires_cyc(&timer), 0);
+}
+
+ZTEST(hrtimer, test_periodic)
+{
+	uint32_t count;
+
+	k_hrtimer_init(&timer, expiry_fn);
+
+	k_sleep(K_TICKS(1));
+	k_hrtimer_start(&timer, k_us_to_cyc_ceil64(PERIOD_US), k_us_to_cyc_ceil64(PERIOD_US));
+	k_busy_wait(WAIT_US);
+	k_hrtimer_stop(&timer);
+
+	count = expiries + k_hrtimer_overruns_get(&timer);
+
+	/* Emulated targets are not cycle accurate, only check that the
+	 * period is not quantized to the tick.
+	 */
+	zassert_true(count >= WAIT_US / PERIOD_US / 2 && count <= WAIT_US / PERIOD_US + 1,
+		     "%u periods in %u us", count, WAIT_US);
+
+	count = expiries;
+	k_busy_wait(WAIT_US);
+	zassert_equal(expiries, count, "expired after being stopped");
+}
+
+ZTEST(hrtimer, test_stop)
+{
+	k_hrtimer_init(&timer, expiry_fn);
+
+	k_hrtimer_start(&timer, k_us_to_cyc_ceil64(DELAY_US), 0);
+	k_hrtimer_stop(&timer);
+	zassert_equal(k_hrtimer_expires_cyc(&timer), 0);
+
+	k_busy_wait(WAIT_US);
+	zassert_equal(expiries, 0, "expired after being stopped");
+
+	/* Stopping a stopped timer is harmless */
+	k_hrtimer_stop(&timer);
+}
+
+ZTEST(hrtimer, test_restart_from_expiry)
+{
+	k_hrtimer_init(&timer, restart_fn);
+
+	restarts = 3;
+	k_hrtimer_start(&timer, k_us_to_cyc_ceil64(DELAY_US), 0);
+	k_busy_wait(WAIT_US);
+
+	zassert_equal(expiries, 4, "expired %u times", expiries);
+	zassert_equal(restarts, 0);
+}
+
+static void hrtimer_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	expiries = 0;
+	expired_at = 0;
+}
+
+ZTEST_SUITE(hrtimer, NULL, NULL, hrtimer_before, NULL, NULL);
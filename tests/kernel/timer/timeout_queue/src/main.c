@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_TIMERS 200
+
+/* Long enough to land in the third level of a timing wheel */
+#define FAR_TICKS 270000
+
+struct test_timer {
+	struct k_timer timer;
+	k_ticks_t expected;
+	k_ticks_t fired_at;
+	bool fired;
+};
+
+static struct test_timer timers[NUM_TIMERS];
+static k_ticks_t last_fired;
+static bool out_of_order;
+static K_SEM_DEFINE(done_sem, 0, NUM_TIMERS);
+
+static void expiry_fn(struct k_timer *timer)
+{
+	struct test_timer *t = CONTAINER_OF(timer, struct test_timer, timer);
+
+	t->fired_at = k_uptime_ticks();
+	t->fired = true;
+
+	if (t->fired_at < last_fired) {
+		out_of_order = true;
+	}
+	last_fired = t->fired_at;
+
+	k_sem_give(&done_sem);
+}
+
+/* Spread durations over several wheel levels, in a scrambled order */
+static k_ticks_t duration(unsigned int i)
+{
+	if (i == (NUM_TIMERS - 1)) {
+		return FAR_TICKS;
+	}
+
+	return 1 + (k_ticks_t)((i * 7919U) % 20000U);
+}
+
+static void start_all(void)
+{
+	last_fired = 0;
+	out_of_order = false;
+	k_sem_reset(&done_sem);
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		k_timer_init(&timers[i].timer, expiry_fn, NULL);
+		timers[i].fired = false;
+		k_timer_start(&timers[i].timer, K_TICKS(duration(i)), K_NO_WAIT);
+		timers[i].expected = k_timer_expires_ticks(&timers[i].timer);
+	}
+}
+
+/**
+ * @brief Many concurrent timeouts expire in order on their exact tick
+ */
+ZTEST(timeout_queue, test_exact_expiry)
+{
+	start_all();
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_TICKS(FAR_TICKS * 2)));
+	}
+
+	zassert_false(out_of_order, "timeouts fired out of order");
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		zassert_true(timers[i].fired, "timer %u never fired", i);
+		zassert_equal(timers[i].fired_at, timers[i].expected,
+			      "timer %u fired at %lld, expected %lld", i,
+			      (long long)timers[i].fired_at,
+			      (long long)timers[i].expected);
+	}
+}
+
+/**
+ * @brief Aborted timeouts never fire, the others are unaffected
+ */
+ZTEST(timeout_queue, test_abort)
+{
+	unsigned int expected_fires = 0;
+
+	start_all();
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		if ((i % 2) == 0) {
+			k_timer_stop(&timers[i].timer);
+		} else {
+			expected_fires++;
+		}
+	}
+
+	for (unsigned int i = 0; i < expected_fires; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_TICKS(FAR_TICKS * 2)));
+	}
+	zassert_equal(k_sem_take(&done_sem, K_TICKS(100)), -EAGAIN);
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		zassert_equal(timers[i].fired, (i % 2) != 0, "timer %u", i);
+		if (timers[i].fired) {
+			zassert_equal(timers[i].fired_at, timers[i].expected,
+				      "timer %u fired late", i);
+		}
+	}
+}
+
+/**
+ * @brief Remaining time of pending timeouts stays consistent
+ */
+ZTEST(timeout_queue, test_remaining)
+{
+	start_all();
+
+	k_sleep(K_TICKS(5000));
+
+	for (unsigned int i = 0; i < NUM_TIMERS; i++) {
+		if (!timers[i].fired) {
+			zassert_equal(k_timer_remaining_ticks(&timers[i].timer),
+				      timers[i].expected - k_uptime_ticks(),
+				      "timer %u", i);
+		}
+		k_timer_stop(&timers[i].timer);
+	}
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+static struct k_timer slack_timers[2];
+static uint32_t slack_cycles[2];
+
+static void slack_expiry_fn(struct k_timer *timer)
+{
+	slack_cycles[ARRAY_INDEX(slack_timers, timer)] = k_cycle_get_32();
+	k_sem_give(&done_sem);
+}
+
+static void start_slack_pair(k_ticks_t first, k_ticks_t slack, k_ticks_t second)
+{
+	k_sem_reset(&done_sem);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(slack_timers); i++) {
+		k_timer_init(&slack_timers[i], slack_expiry_fn, NULL);
+	}
+
+	k_timer_slack_set(&slack_timers[0], K_TICKS(slack));
+	k_timer_start(&slack_timers[0], K_TICKS(first), K_NO_WAIT);
+	k_timer_start(&slack_timers[1], K_TICKS(second), K_NO_WAIT);
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(slack_timers); i++) {
+		zassert_ok(k_sem_take(&done_sem, K_TICKS(second * 2)));
+	}
+}
+
+/**
+ * @brief A timeout with slack expires together with a later one in its window
+ */
+ZTEST(timeout_queue, test_slack_coalesced)
+{
+	start_slack_pair(1000, 500, 1300);
+
+	zassert_true(slack_cycles[1] - slack_cycles[0] < k_ticks_to_cyc_ceil32(1),
+		     "timeouts expired %u cycles apart",
+		     slack_cycles[1] - slack_cycles[0]);
+}
+
+/**
+ * @brief A timeout never expires later than its slack allows
+ */
+ZTEST(timeout_queue, test_slack_bounded)
+{
+	start_slack_pair(1000, 100, 1300);
+
+	zassert_true(slack_cycles[1] - slack_cycles[0] >= k_ticks_to_cyc_floor32(200),
+		     "timeout with slack waited for a later one");
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+ZTEST_SUITE(timeout_queue, NULL, NULL, NULL, NULL, NULL);
@@ -541,5 +541,83 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+#define NUM_WAKEUPS 10
+
+static K_SEM_DEFINE(wakeup_sem, 0, 1);
+
+static uint32_t latency_count(const k_thread_runtime_stats_t *stats)
+{
+	uint32_t count = 0U;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_USAGE_LATENCY_BUCKETS; i++) {
+		count += stats->wakeup_latency[i];
+	}
+
+	return count;
+}
+
+/**
+ * @brief Helper thread to test_thread_stats_latency()
+ */
+void helper_wakeup(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		k_sem_take(&wakeup_sem, K_FOREVER);
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+
+/**
+ * @brief Test the wakeup latency histograms
+ *
+ * Wake a lower priority helper thread a number of times and check that
+ * each wakeup lands in its histogram, and in the CPU's.
+ */
+ZTEST(usage_api, test_thread_stats_latency)
+{
+#ifdef CONFIG_SCHED_THREAD_USAGE_LATENCY
+	k_thread_runtime_stats_t  thread_stats;
+	k_thread_runtime_stats_t  cpu_stats1;
+	k_thread_runtime_stats_t  cpu_stats2;
+	k_tid_t  tid;
+	int  priority;
+
+	priority = k_thread_priority_get(_current) + 1;
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper_wakeup, NULL, NULL, NULL,
+			      priority, 0, K_NO_WAIT);
+
+	/* Let the helper block on the semaphore */
+
+	k_sleep(K_TICKS(1));
+
+	k_thread_runtime_stats_get(tid, &thread_stats);
+	zassert_equal(latency_count(&thread_stats), 1, "start not counted");
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats1);
+
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		/* The helper is made ready, then runs once we sleep */
+		k_sem_give(&wakeup_sem);
+		k_sleep(K_TICKS(1));
+	}
+
+	k_thread_runtime_stats_get(tid, &thread_stats);
+	zassert_equal(latency_count(&thread_stats), NUM_WAKEUPS + 1);
+
+	/* Every wakeup of ours, the helper's and idle's don't count */
+
+	k_thread_runtime_stats_cpu_get(0, &cpu_stats2);
+	zassert_true(latency_count(&cpu_stats2) >=
+		     latency_count(&cpu_stats1) + 2 * NUM_WAKEUPS);
+	zassert_true(cpu_stats2.peak_wakeup_latency >= thread_stats.peak_wakeup_latency);
+
+	k_thread_abort(tid);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SCHED_THREAD_USAGE_LATENCY */
+}
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
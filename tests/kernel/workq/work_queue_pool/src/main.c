@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 4
+#define NUM_ITEMS 16
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO 1
+
+/* Long enough for every worker to get a chance to run */
+#define WORK_MS 10
+
+K_WORK_QUEUE_POOL_DEFINE(pool, NUM_WORKERS, STACK_SIZE);
+
+struct test_work {
+	struct k_work work;
+	k_tid_t ran_on;
+	unsigned int runs;
+};
+
+static struct test_work items[NUM_ITEMS];
+static struct k_work_delayable dwork;
+static k_tid_t dwork_ran_on;
+static K_SEM_DEFINE(done_sem, 0, NUM_ITEMS);
+static atomic_t running;
+static atomic_t max_running;
+
+static bool is_worker(k_tid_t tid)
+{
+	for (unsigned int i = 0; i < NUM_WORKERS; i++) {
+		if (tid == k_work_queue_thread_get(&pool.workers[i])) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static unsigned int count_workers_used(void)
+{
+	unsigned int used = 0;
+
+	for (unsigned int w = 0; w < NUM_WORKERS; w++) {
+		k_tid_t tid = k_work_queue_thread_get(&pool.workers[w]);
+
+		for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+			if (items[i].ran_on == tid) {
+				used++;
+				break;
+			}
+		}
+	}
+
+	return used;
+}
+
+static void item_handler(struct k_work *work)
+{
+	struct test_work *t = CONTAINER_OF(work, struct test_work, work);
+	atomic_val_t now = atomic_inc(&running) + 1;
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&max_running);
+	} while ((now > max) && !atomic_cas(&max_running, max, now));
+
+	t->ran_on = k_current_get();
+	t->runs++;
+	k_msleep(WORK_MS);
+
+	atomic_dec(&running);
+	k_sem_give(&done_sem);
+}
+
+/* Submits every item from a worker thread, so they all start out on the
+ * same worker's queue and must be stolen to run anywhere else.
+ */
+static void spawn_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     &items[i].work), 1);
+	}
+}
+
+static K_WORK_DEFINE(spawn_work, spawn_handler);
+
+#define SELF_RUNS 8
+
+static struct k_work self_work;
+static atomic_t self_running;
+static atomic_t self_overlaps;
+static atomic_t self_runs;
+
+/* Resubmits itself while running, then submits another item so that an
+ * idle sibling is woken and looks for work to steal while the resubmitted
+ * item is still pending on this worker.
+ */
+static void self_handler(struct k_work *work)
+{
+	atomic_val_t run;
+
+	if (atomic_inc(&self_running) != 0) {
+		atomic_inc(&self_overlaps);
+	}
+
+	run = atomic_inc(&self_runs);
+	if (run < SELF_RUNS - 1) {
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     work), 2);
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     &items[run].work), 1);
+	}
+
+	k_msleep(WORK_MS);
+
+	atomic_dec(&self_running);
+	k_sem_give(&done_sem);
+}
+
+static void dwork_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	dwork_ran_on = k_current_get();
+	k_sem_give(&done_sem);
+}
+
+static void wait_items(unsigned int n)
+{
+	for (unsigned int i = 0; i < n; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_MSEC(NUM_ITEMS * WORK_MS * 10)));
+	}
+}
+
+/**
+ * @brief Work submitted to a pool is spread across its workers
+ */
+ZTEST(work_queue_pool, test_submit)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     &items[i].work), 1);
+	}
+
+	wait_items(NUM_ITEMS);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(items[i].runs, 1, "item %u ran %u times", i, items[i].runs);
+		zassert_true(is_worker(items[i].ran_on), "item %u", i);
+	}
+
+	zassert_equal(count_workers_used(), NUM_WORKERS);
+	zassert_true(atomic_get(&max_running) > 1);
+}
+
+/**
+ * @brief Idle workers steal work queued to a busy sibling
+ */
+ZTEST(work_queue_pool, test_steal)
+{
+	zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+					     &spawn_work), 1);
+
+	wait_items(NUM_ITEMS);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(items[i].runs, 1, "item %u ran %u times", i, items[i].runs);
+	}
+
+	zassert_true(count_workers_used() > 1, "no work was stolen");
+}
+
+/**
+ * @brief An item resubmitted while running never runs concurrently with
+ * itself
+ */
+ZTEST(work_queue_pool, test_no_self_concurrency)
+{
+	unsigned int submitted = 0;
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		int rc = k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						&items[0].work);
+
+		zassert_true(rc >= 0);
+		if (rc > 0) {
+			submitted++;
+		}
+		k_msleep(WORK_MS / 4);
+	}
+
+	wait_items(submitted);
+	zassert_equal(k_sem_take(&done_sem, K_MSEC(WORK_MS * 4)), -EAGAIN);
+	zassert_equal(items[0].runs, submitted);
+	zassert_equal(atomic_get(&max_running), 1);
+}
+
+/**
+ * @brief An item resubmitted from its own handler is not stolen by an idle
+ * sibling while it is still running
+ */
+ZTEST(work_queue_pool, test_resubmit_from_handler)
+{
+	k_work_init(&self_work, self_handler);
+	atomic_clear(&self_running);
+	atomic_clear(&self_overlaps);
+	atomic_clear(&self_runs);
+
+	zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+					     &self_work), 1);
+
+	/* Every run but the last also submits an item */
+	wait_items(SELF_RUNS + SELF_RUNS - 1);
+
+	zassert_equal(atomic_get(&self_runs), SELF_RUNS);
+	zassert_equal(atomic_get(&self_overlaps), 0, "handler ran concurrently with itself");
+}
+
+/**
+ * @brief Delayable work and flushing work on a pool
+ */
+ZTEST(work_queue_pool, test_delayable_and_flush)
+{
+	struct k_work_sync sync;
+
+	k_work_init_delayable(&dwork, dwork_handler);
+	zassert_equal(k_work_schedule_for_queue(k_work_queue_pool_queue(&pool),
+						&dwork, K_MSEC(WORK_MS)), 1);
+	wait_items(1);
+	zassert_true(is_worker(dwork_ran_on));
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     &items[i].work), 1);
+	}
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_flush(&items[i].work, &sync);
+		zassert_equal(items[i].runs, 1, "item %u not run after flush", i);
+	}
+
+	wait_items(NUM_ITEMS);
+}
+
+/**
+ * @brief Draining and plugging a pool
+ */
+ZTEST(work_queue_pool, test_drain)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+						     &items[i].work), 1);
+	}
+
+	zassert_equal(k_work_queue_pool_drain(&pool, true), 1);
+
+	/* Items may still be finishing on a worker that stole them */
+	wait_items(NUM_ITEMS);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(items[i].runs, 1, "item %u", i);
+	}
+
+	zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+					     &items[0].work), -EBUSY);
+	zassert_ok(k_work_queue_pool_unplug(&pool));
+	zassert_equal(k_work_queue_pool_unplug(&pool), -EALREADY);
+	zassert_equal(k_work_submit_to_queue(k_work_queue_pool_queue(&pool),
+					     &items[0].work), 1);
+	wait_items(1);
+}
+
+static void *pool_setup(void)
+{
+	struct k_work_queue_pool_config cfg = {
+		.worker = {
+			.name = "pool_worker",
+		},
+		.per_cpu = true,
+	};
+
+	k_work_queue_pool_start(&pool, WORKER_PRIO, &cfg);
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i].work, item_handler);
+		items[i].ran_on = NULL;
+		items[i].runs = 0;
+	}
+
+	atomic_clear(&running);
+	atomic_clear(&max_running);
+	k_sem_reset(&done_sem);
+}
+
+ZTEST_SUITE(work_queue_pool, NULL, pool_setup, pool_before, NULL, NULL);
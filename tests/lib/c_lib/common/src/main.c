@@ -625,6 +625,91 @@ ZTEST(libc_common, test_memmove)
 		     "memmove failed");
 }
 
+#define ALIGN_TEST_OFFSETS 8
+#define ALIGN_TEST_LEN	   (8 * sizeof(uintptr_t) + 3)
+
+static uintptr_t align_src[(ALIGN_TEST_LEN + 2 * ALIGN_TEST_OFFSETS) / sizeof(uintptr_t) + 1];
+static uintptr_t align_dst[ARRAY_SIZE(align_src)];
+
+/**
+ * @brief Test memory and string functions at every alignment
+ *
+ * @details Compare the results of memcpy(), memset(), memcmp(),
+ * memchr(), strlen() and strcmp() against byte by byte references, for
+ * all relative alignments of their buffers and lengths up to several
+ * words, checking that no byte around the destination is touched.
+ *
+ * @see memcpy(), memset(), memcmp(), memchr(), strlen(), strcmp().
+ */
+ZTEST(libc_common, test_mem_str_alignment)
+{
+	unsigned char *src = (unsigned char *)align_src;
+	unsigned char *dst = (unsigned char *)align_dst;
+
+	for (size_t i = 0; i < sizeof(align_src); i++) {
+		src[i] = 'A' + i % 26;
+	}
+
+	for (size_t s_off = 0; s_off < ALIGN_TEST_OFFSETS; s_off++) {
+		for (size_t d_off = 0; d_off < ALIGN_TEST_OFFSETS; d_off++) {
+			for (size_t len = 0; len <= ALIGN_TEST_LEN; len++) {
+				(void)memset(dst, 0xaa, sizeof(align_dst));
+				zassert_equal(memcpy(dst + d_off, src + s_off, len), dst + d_off);
+
+				for (size_t i = 0; i < sizeof(align_dst); i++) {
+					bool copied = (i >= d_off) && (i < d_off + len);
+
+					zassert_equal(dst[i], copied ? src[s_off + i - d_off] : 0xaa,
+						      "memcpy %zu bytes from +%zu to +%zu", len,
+						      s_off, d_off);
+				}
+
+				zassert_equal(memcmp(dst + d_off, src + s_off, len), 0);
+				if (len > 0) {
+					dst[d_off + len - 1]++;
+					zassert_true(memcmp(dst + d_off, src + s_off, len) > 0,
+						     "memcmp %zu bytes at +%zu and +%zu", len,
+						     d_off, s_off);
+				}
+			}
+		}
+	}
+
+	for (size_t off = 0; off < ALIGN_TEST_OFFSETS; off++) {
+		for (size_t len = 0; len <= ALIGN_TEST_LEN; len++) {
+			(void)memset(dst, 0xaa, sizeof(align_dst));
+			zassert_equal(memset(dst + off, 0x55, len), dst + off);
+
+			for (size_t i = 0; i < sizeof(align_dst); i++) {
+				bool set = (i >= off) && (i < off + len);
+
+				zassert_equal(dst[i], set ? 0x55 : 0xaa, "memset %zu bytes at +%zu",
+					      len, off);
+			}
+
+			/* a string of len bytes, the byte searched for at its end */
+			(void)memset(dst, 'a', sizeof(align_dst));
+			dst[off + len] = '\0';
+			zassert_equal(strlen((char *)dst + off), len, "strlen at +%zu", off);
+			zassert_equal(memchr(dst + off, '\0', len + 1), dst + off + len);
+			zassert_is_null(memchr(dst + off, '\0', len));
+
+			for (size_t s_off = 0; s_off < ALIGN_TEST_OFFSETS; s_off++) {
+				(void)memset(src, 'a', sizeof(align_src));
+				src[s_off + len] = '\0';
+				zassert_equal(strcmp((char *)dst + off, (char *)src + s_off), 0);
+
+				if (len > 0) {
+					src[s_off + len - 1] = 'b';
+					zassert_true(strcmp((char *)dst + off, (char *)src + s_off) < 0,
+						     "strcmp %zu bytes at +%zu and +%zu", len, off,
+						     s_off);
+				}
+			}
+		}
+	}
+}
+
 /**
  *
  * @brief test str operate functions
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <vector>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/memory_resource.hpp>
+#include <zephyr/ztest.h>
+
+BUILD_ASSERT(__cplusplus == 201703);
+
+#define HEAP_SIZE 2048
+#define SLAB_BLOCK_SIZE 64
+#define SLAB_NUM_BLOCKS 16
+#define ARENA_SIZE 256
+
+K_HEAP_DEFINE(test_k_heap, HEAP_SIZE);
+K_MEM_SLAB_DEFINE_STATIC(test_slab, SLAB_BLOCK_SIZE, SLAB_NUM_BLOCKS, 8);
+
+static char __aligned(8) sys_heap_mem[HEAP_SIZE];
+static struct sys_heap test_sys_heap;
+static char __aligned(8) arena_mem[ARENA_SIZE];
+
+static bool in_buffer(const void *p, const void *buffer, size_t size)
+{
+	return (uintptr_t)p - (uintptr_t)buffer < size;
+}
+
+/* Upstream resource counting what goes through it */
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+	int allocs = 0;
+	int deallocs = 0;
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		allocs++;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+	{
+		deallocs++;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+ZTEST(cpp_memory_resource, test_k_heap_resource)
+{
+	zephyr::pmr::k_heap_resource res(&test_k_heap);
+
+	{
+		std::pmr::vector<int> vec(&res);
+
+		for (int i = 0; i < 100; i++) {
+			vec.push_back(i);
+		}
+		zassert_true(in_buffer(vec.data(), test_k_heap.heap.init_mem,
+				       test_k_heap.heap.init_bytes));
+		zassert_equal(vec[99], 99);
+	}
+
+	/* Everything was given back */
+	void *p = res.allocate(HEAP_SIZE / 2, 16);
+
+	zassert_equal((uintptr_t)p % 16, 0);
+	res.deallocate(p, HEAP_SIZE / 2, 16);
+
+	zassert_true(res.is_equal(res));
+	zassert_false(res.is_equal(*std::pmr::new_delete_resource()));
+
+#ifdef CONFIG_CPP_EXCEPTIONS
+	bool thrown = false;
+
+	try {
+		(void)res.allocate(HEAP_SIZE * 2);
+	} catch (const std::bad_alloc &) {
+		thrown = true;
+	}
+	zassert_true(thrown, "allocation beyond the heap did not throw");
+#endif
+}
+
+ZTEST(cpp_memory_resource, test_sys_heap_resource)
+{
+	sys_heap_init(&test_sys_heap, sys_heap_mem, sizeof(sys_heap_mem));
+	zephyr::pmr::sys_heap_resource res(&test_sys_heap);
+
+	{
+		std::pmr::map<int, int> map(&res);
+
+		for (int i = 0; i < 20; i++) {
+			map[i] = i * i;
+		}
+		zassert_equal(map.size(), 20);
+		zassert_equal(map[7], 49);
+		zassert_true(in_buffer(&map[3], sys_heap_mem, sizeof(sys_heap_mem)));
+	}
+
+	zassert_true(sys_heap_validate(&test_sys_heap));
+
+	/* Everything was given back */
+	void *p = res.allocate(HEAP_SIZE / 2);
+
+	res.deallocate(p, HEAP_SIZE / 2);
+	zassert_true(sys_heap_validate(&test_sys_heap));
+}
+
+ZTEST(cpp_memory_resource, test_mem_slab_resource)
+{
+	counting_resource upstream;
+	zephyr::pmr::mem_slab_resource res(&test_slab, K_NO_WAIT, &upstream);
+
+	{
+		std::pmr::list<int> list(&res);
+
+		for (int i = 0; i < SLAB_NUM_BLOCKS; i++) {
+			list.push_back(i);
+		}
+		zassert_equal(k_mem_slab_num_used_get(&test_slab), SLAB_NUM_BLOCKS);
+		zassert_equal(upstream.allocs, 0);
+		zassert_true(in_buffer(&list.front(), test_slab.buffer,
+				       SLAB_BLOCK_SIZE * SLAB_NUM_BLOCKS));
+
+		/* The slab is full */
+		list.push_back(SLAB_NUM_BLOCKS);
+		zassert_equal(upstream.allocs, 1);
+		zassert_equal(list.back(), SLAB_NUM_BLOCKS);
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+	zassert_equal(upstream.deallocs, 1);
+
+	/* Larger and more aligned requests than blocks go upstream */
+	void *p = res.allocate(SLAB_BLOCK_SIZE + 1);
+	void *q = res.allocate(8, 128);
+
+	zassert_equal(upstream.allocs, 3);
+	zassert_equal(k_mem_slab_num_used_get(&test_slab), 0);
+	res.deallocate(p, SLAB_BLOCK_SIZE + 1);
+	res.deallocate(q, 8, 128);
+	zassert_equal(upstream.deallocs, 3);
+}
+
+ZTEST(cpp_memory_resource, test_monotonic_arena_resource)
+{
+	counting_resource upstream;
+	zephyr::pmr::monotonic_arena_resource res(arena_mem, sizeof(arena_mem), &upstream);
+
+	void *p = res.allocate(1, 1);
+	void *q = res.allocate(8, 8);
+
+	zassert_equal_ptr(p, arena_mem);
+	zassert_equal_ptr(q, arena_mem + 8);
+	zassert_equal(res.used(), 16);
+
+	/* Deallocation does not reclaim anything */
+	res.deallocate(q, 8, 8);
+	zassert_equal(res.used(), 16);
+
+	{
+		std::pmr::vector<uint8_t> vec(&res);
+
+		vec.reserve(ARENA_SIZE - 16);
+		zassert_equal_ptr(vec.data(), arena_mem + 16);
+		zassert_equal(res.used(), ARENA_SIZE);
+		zassert_equal(upstream.allocs, 0);
+
+		/* Growing goes upstream */
+		vec.resize(ARENA_SIZE);
+		zassert_equal(upstream.allocs, 1);
+		zassert_false(in_buffer(vec.data(), arena_mem, sizeof(arena_mem)));
+	}
+	zassert_equal(upstream.deallocs, 1);
+
+	res.release();
+	zassert_equal(res.used(), 0);
+	zassert_equal_ptr(res.allocate(4, 4), arena_mem);
+}
+
+ZTEST_SUITE(cpp_memory_resource, NULL, NULL, NULL, NULL, NULL);
@@ -37,3 +37,31 @@ ZTEST(hash_map, test_remove_false)
 	zassert_equal(1, sys_hashmap_insert(&map, 1, 1, NULL));
 	zassert_false(sys_hashmap_remove(&map, 42, NULL));
 }
+
+ZTEST(hash_map, test_remove_churn)
+{
+	int ret;
+	uint64_t value;
+	const size_t window = MAX(MANY / 2, 1);
+
+	/* slide a window of live keys, leaving removed entries all over the table */
+	for (size_t i = 0; i < 4 * MANY; ++i) {
+		ret = sys_hashmap_insert(&map, i, ~i, NULL);
+		zassert_true(ret >= 0, "failed to insert (%zu, %zu): %d", i, ~i, ret);
+
+		if (i >= window) {
+			zassert_true(sys_hashmap_remove(&map, i - window, NULL));
+		}
+
+		zassert_equal(MIN(i + 1, window), sys_hashmap_size(&map));
+	}
+
+	for (size_t i = 0; i < 4 * MANY; ++i) {
+		if (i < 4 * MANY - window) {
+			zassert_false(sys_hashmap_get(&map, i, NULL), "key %zu was removed", i);
+		} else {
+			zassert_true(sys_hashmap_get(&map, i, &value), "key %zu is missing", i);
+			zassert_equal(~i, value);
+		}
+	}
+}
@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/heap_listener.h>
+#include <zephyr/sys/byteorder.h>
 #include <inttypes.h>
 
 /* Guess at a value for heap size based on available memory on the
@@ -259,6 +260,9 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
+	/* Slab free lists make the heap header too big for this layout */
+	Z_TEST_SKIP_IFDEF(CONFIG_SYS_HEAP_SLABS);
+
 	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
 	if (sizeof(void *) > 4U) {
 		sys_heap_alloc(&heap, 1);
@@ -296,8 +300,9 @@ ZTEST(lib_heap, test_realloc)
 	void *p1, *p2, *p3;
 
 	/* Note whitebox assumption: allocation goes from low address
-	 * to high in an empty heap.
+	 * to high in an empty heap.  Slab batches break it.
 	 */
+	Z_TEST_SKIP_IFDEF(CONFIG_SYS_HEAP_SLABS);
 
 	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
 
@@ -485,4 +490,170 @@ ZTEST(lib_heap, test_heap_listeners)
 #endif /* CONFIG_SYS_HEAP_LISTENER */
 }
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+static struct sys_heap_profile profile;
+
+/* Not tail calls, for the call sites to be in these functions */
+static __attribute__((noinline)) void *profiled_alloc(struct sys_heap *heap, size_t bytes)
+{
+	void *mem = sys_heap_alloc(heap, bytes);
+
+	compiler_barrier();
+	return mem;
+}
+
+static __attribute__((noinline)) void *profiled_k_heap_alloc(struct k_heap *heap, size_t bytes)
+{
+	void *mem = k_heap_alloc(heap, bytes, K_NO_WAIT);
+
+	compiler_barrier();
+	return mem;
+}
+
+static bool caller_in(uintptr_t caller, void *fn)
+{
+	/* The call is somewhere in the function body */
+	return (caller > (uintptr_t)fn) && (caller < (uintptr_t)fn + 256);
+}
+
+static int export_cb(const uint8_t *data, size_t len, void *arg)
+{
+	size_t *total = arg;
+
+	if (*total == 0U) {
+		zassert_true(len >= 4U);
+		zassert_equal(sys_get_le32(data), SYS_HEAP_PROFILE_MAGIC, "bad magic");
+	}
+	*total += len;
+
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_PROFILE */
+
+ZTEST(lib_heap, test_profile)
+{
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	struct sys_heap heap;
+	struct k_heap kheap;
+	struct sys_heap_frag_stats frag;
+	void *p[2 * CONFIG_SYS_HEAP_PROFILE_SAMPLE_RATE];
+	size_t total = 0;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_profile_attach(&heap, &profile);
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		p[i] = profiled_alloc(&heap, 20);
+		zassert_not_null(p[i]);
+	}
+	zassert_is_null(sys_heap_alloc(&heap, SMALL_HEAP_SZ));
+
+	zassert_equal(profile.allocs, ARRAY_SIZE(p));
+	zassert_equal(profile.failures, 1);
+	zassert_equal(profile.size_hist[4], ARRAY_SIZE(p), "20 bytes not in 16+ bucket");
+
+	/* The first allocation is sampled, then one in SAMPLE_RATE */
+	zassert_equal(profile.nsites, 1);
+	zassert_true(caller_in(profile.sites[0].caller, profiled_alloc),
+		     "call site 0x%lx not in caller", (unsigned long)profile.sites[0].caller);
+	zassert_equal(profile.sites[0].allocs, 2);
+	zassert_equal(profile.sites[0].live_bytes, 40);
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		sys_heap_free(&heap, p[i]);
+	}
+
+	zassert_equal(profile.frees, ARRAY_SIZE(p));
+	zassert_equal(profile.sites[0].frees, 2);
+	zassert_equal(profile.sites[0].live_bytes, 0);
+	zassert_equal(profile.sites[0].peak_live_bytes, 40);
+	zassert_equal(profile.lifetime_hist[0], 2, "lifetimes not recorded");
+
+	sys_heap_frag_stats_get(&heap, &frag);
+	if (!IS_ENABLED(CONFIG_SYS_HEAP_SLABS)) {
+		/* Everything merged back */
+		zassert_equal(frag.free_blocks, 1, "free heap fragmented");
+		zassert_equal(frag.largest_free_bytes, frag.free_bytes);
+	}
+
+	zassert_ok(sys_heap_profile_export(&profile, &frag, export_cb, &total));
+	zassert_equal(total, 4 * (12 + SYS_HEAP_PROFILE_SIZE_BUCKETS +
+				  SYS_HEAP_PROFILE_LIFETIME_BUCKETS + 7 + 3));
+
+	sys_heap_profile_attach(&heap, NULL);
+
+	/* k_heap allocations are accounted to the caller of k_heap_alloc() */
+	k_heap_init(&kheap, heapmem, SMALL_HEAP_SZ);
+	sys_heap_profile_attach(&kheap.heap, &profile);
+
+	p[0] = profiled_k_heap_alloc(&kheap, 20);
+	zassert_not_null(p[0]);
+	zassert_equal(profile.nsites, 1);
+	zassert_true(caller_in(profile.sites[0].caller, profiled_k_heap_alloc),
+		     "call site 0x%lx not in caller", (unsigned long)profile.sites[0].caller);
+	k_heap_free(&kheap, p[0]);
+
+	sys_heap_profile_attach(&kheap.heap, NULL);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_PROFILE */
+}
+
+ZTEST(lib_heap, test_slabs)
+{
+#ifdef CONFIG_SYS_HEAP_SLABS
+	struct sys_heap heap;
+	void *p[CONFIG_SYS_HEAP_SLAB_BATCH];
+	static void *small[SMALL_HEAP_SZ / 16];
+	void *big, *q;
+	int n;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	/* A freed small block is handed out again first */
+	p[0] = sys_heap_alloc(&heap, 16);
+	zassert_not_null(p[0]);
+	sys_heap_free(&heap, p[0]);
+	q = sys_heap_alloc(&heap, 16);
+	zassert_equal(q, p[0], "slab block not reused %p != %p", q, p[0]);
+	sys_heap_free(&heap, q);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	/* A batch takes contiguous blocks of the same size */
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		p[i] = sys_heap_alloc(&heap, 16);
+		zassert_not_null(p[i]);
+	}
+	for (int i = 1; i < ARRAY_SIZE(p); i++) {
+		zassert_equal((uint8_t *)p[i] - (uint8_t *)p[i - 1],
+			      (uint8_t *)p[1] - (uint8_t *)p[0],
+			      "batch not contiguous");
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	for (int i = 0; i < ARRAY_SIZE(p); i++) {
+		sys_heap_free(&heap, p[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	/* Cached blocks are given back when the heap runs out */
+	n = 0;
+	while ((n < ARRAY_SIZE(small)) &&
+	       ((small[n] = sys_heap_alloc(&heap, 16)) != NULL)) {
+		n++;
+	}
+	zassert_true(n < ARRAY_SIZE(small), "heap not exhausted");
+	for (int i = 0; i < n; i++) {
+		sys_heap_free(&heap, small[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	big = sys_heap_alloc(&heap, SMALL_HEAP_SZ / 2);
+	zassert_not_null(big, "cached blocks not flushed");
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_HEAP_SLABS */
+}
+
 ZTEST_SUITE(lib_heap, NULL, NULL, NULL, NULL, NULL);
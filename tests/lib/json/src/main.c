@@ -1103,6 +1103,23 @@ ZTEST(lib_json_test, test_json_key_not_in_descr)
 	zassert_equal(ret, 0, "No items should be decoded");
 }
 
+ZTEST(lib_json_test, test_json_key_order)
+{
+	struct test_struct ts;
+	char encoded[] = "{\"some_bool\":true,\"some_int\":1,\"some_string\":\"a\","
+			 "\"some_int\":2,\"some_bool\":false,\"some_int64\":3}";
+	int64_t ret;
+
+	/* Keys in any order, only the first of duplicates is decoded */
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, test_descr,
+			     ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(ret, BIT_MASK(4), "Decoding result %lld", (long long)ret);
+	zassert_str_equal(ts.some_string, "a");
+	zassert_equal(ts.some_int, 1);
+	zassert_true(ts.some_bool);
+	zassert_equal(ts.some_int64, 3);
+}
+
 ZTEST(lib_json_test, test_json_escape)
 {
 	char buf[42];
@@ -1362,4 +1379,174 @@ ZTEST(lib_json_test, test_json_array_alignment)
 	zassert_equal(o.array[1].int3, 6, "Element 1 int3 not decoded correctly");
 }
 
+struct test_raw {
+	struct json_obj_token some_float;
+	struct json_obj_token some_opaque;
+	struct json_obj_token some_obj_array;
+	int some_int;
+};
+
+static const struct json_obj_descr raw_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_raw, some_float, JSON_TOK_FLOAT),
+	JSON_OBJ_DESCR_PRIM(struct test_raw, some_opaque, JSON_TOK_OPAQUE),
+	JSON_OBJ_DESCR_PRIM(struct test_raw, some_obj_array, JSON_TOK_OBJ_ARRAY),
+	JSON_OBJ_DESCR_PRIM(struct test_raw, some_int, JSON_TOK_NUMBER),
+};
+
+static const char stream_encoded[] = "{\"some_string\":\"zephyr \\\"123\\\"\\uABCD\","
+	"\"some_int\":\t-42\n,"
+	"\"some_bool\":true    \t  ,"
+	"\"some_int64\":-4611686018427387904,"
+	"\"some_uint64\":18446744073709551615,"
+	"\"some_nested_struct\":{    "
+	"\"nested_int\":-1234,\n\n"
+	"\"nested_bool\":false,\t"
+	"\"nested_string\":\"this should be escaped: \\t\","
+	"\"extra_nested_array\":[0,-1,{\"a\":[\"]\"]}]},"
+	"\"extra_struct\":{\"nested_bool\":false},"
+	"\"some_array\":[11,22, 33,\t45,\n299],"
+	"\"if\":false,"
+	"\"4nother_ne$+\":{\"nested_int\":1234,"
+	"\"nested_string\":\"\"},"
+	"\"nested_obj_array\":["
+	"{\"nested_int\":1,\"nested_bool\":true,\"nested_string\":\"true\"},"
+	"{\"nested_int\":0,\"nested_bool\":false,\"nested_string\":\"false\"}]"
+	"}\n";
+
+static int64_t stream_parse(const char *json, size_t len, size_t chunk,
+			    const struct json_obj_descr *descr, size_t descr_len, void *val,
+			    char *buf, size_t buf_size)
+{
+	struct json_obj_stream stream;
+	int ret = 0;
+
+	json_obj_stream_init(&stream, descr, descr_len, val, buf, buf_size);
+
+	for (size_t pos = 0; pos < len && ret == 0; pos += chunk) {
+		ret = json_obj_stream_feed(&stream, &json[pos], MIN(chunk, len - pos));
+	}
+
+	return json_obj_stream_finish(&stream);
+}
+
+static void assert_nested_equal(const struct test_nested *a, const struct test_nested *b)
+{
+	zassert_equal(a->nested_int, b->nested_int);
+	zassert_equal(a->nested_bool, b->nested_bool);
+	zassert_str_equal(a->nested_string, b->nested_string);
+}
+
+ZTEST(lib_json_test, test_json_stream_decoding)
+{
+	char encoded[sizeof(stream_encoded)];
+	struct test_struct expected;
+	int64_t expected_ret;
+	char buf[128];
+
+	memcpy(encoded, stream_encoded, sizeof(encoded));
+	memset(&expected, 0, sizeof(expected));
+	expected_ret = json_obj_parse(encoded, sizeof(encoded) - 1, test_descr,
+				      ARRAY_SIZE(test_descr), &expected);
+	zassert_true(expected_ret > 0);
+
+	/* Same results as a whole buffer parse, however the input is split */
+	for (size_t chunk = 1; chunk < sizeof(stream_encoded); chunk++) {
+		struct test_struct ts;
+		int64_t ret;
+
+		memset(&ts, 0, sizeof(ts));
+		ret = stream_parse(stream_encoded, sizeof(stream_encoded) - 1, chunk, test_descr,
+				   ARRAY_SIZE(test_descr), &ts, buf, sizeof(buf));
+
+		zassert_equal(ret, expected_ret, "chunk %zu", chunk);
+		zassert_str_equal(ts.some_string, expected.some_string);
+		zassert_equal(ts.some_int, expected.some_int);
+		zassert_equal(ts.some_bool, expected.some_bool);
+		zassert_equal(ts.some_int64, expected.some_int64);
+		zassert_equal(ts.some_uint64, expected.some_uint64);
+		assert_nested_equal(&ts.some_nested_struct, &expected.some_nested_struct);
+		zassert_equal(ts.some_array_len, expected.some_array_len);
+		zassert_mem_equal(ts.some_array, expected.some_array,
+				  sizeof(ts.some_array[0]) * ts.some_array_len);
+		zassert_equal(ts.if_, expected.if_);
+		zassert_equal(ts.xnother_nexx.nested_int, expected.xnother_nexx.nested_int);
+		zassert_str_equal(ts.xnother_nexx.nested_string,
+				  expected.xnother_nexx.nested_string);
+		zassert_equal(ts.obj_array_len, expected.obj_array_len);
+		assert_nested_equal(&ts.nested_obj_array[0], &expected.nested_obj_array[0]);
+		assert_nested_equal(&ts.nested_obj_array[1], &expected.nested_obj_array[1]);
+
+		/* Strings point to copies */
+		zassert_between_inclusive((uintptr_t)ts.some_string, (uintptr_t)buf,
+					  (uintptr_t)&buf[sizeof(buf) - 1]);
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_raw_tokens)
+{
+	static const char json[] = "{\"some_float\":-12.5,\"some_opaque\":\"x\\\"y\","
+				   "\"some_obj_array\":[{\"a\":\"][\"},[1,[2]]],\"some_int\":7}";
+	struct test_raw tr;
+	char buf[64];
+
+	for (size_t chunk = 1; chunk < sizeof(json); chunk++) {
+		memset(&tr, 0, sizeof(tr));
+		zassert_equal(stream_parse(json, sizeof(json) - 1, chunk, raw_descr,
+					   ARRAY_SIZE(raw_descr), &tr, buf, sizeof(buf)),
+			      BIT_MASK(ARRAY_SIZE(raw_descr)), "chunk %zu", chunk);
+
+		zassert_equal(tr.some_float.length, strlen("-12.5"));
+		zassert_mem_equal(tr.some_float.start, "-12.5", tr.some_float.length);
+		zassert_equal(tr.some_opaque.length, strlen("x\\\"y"));
+		zassert_mem_equal(tr.some_opaque.start, "x\\\"y", tr.some_opaque.length);
+		zassert_equal(tr.some_obj_array.length, strlen("[{\"a\":\"][\"},[1,[2]]]"));
+		zassert_mem_equal(tr.some_obj_array.start, "[{\"a\":\"][\"},[1,[2]]]",
+				  tr.some_obj_array.length);
+		zassert_equal(tr.some_int, 7);
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_errors)
+{
+	struct {
+		const char *str;
+		int64_t result;
+	} encoded[] = {
+		{ "{\"some_string\":\"\\uABC@\"}", -EINVAL },
+		{ "{\"some_string\":\"\\X\"}", -EINVAL },
+		{ "{\"some_bool\":truffle }", -EINVAL },
+		{ "{\"some_string\":null }", -EINVAL },
+		{ "{\"some_int\":xxx }", -EINVAL },
+		{ "{\"some_int\":- }", -EINVAL },
+		{ "{\"some_string\"", -EINVAL },
+		{ "{\"some_string\",}", -EINVAL },
+		{ "{\"some_string\":false}", -EINVAL },
+		{ "{\"some_int\":1 \"some_bool\":true}", -EINVAL },
+		{ "[]", -EINVAL },
+		{ "{\"some_array\":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17]}", -ENOSPC },
+		{ "{\"some_string\":\"0123456789abcdef\"}", -ENOMEM },
+		{ "{\"some_int\":123456789012345678901}", -ENOMEM },
+		/* Keys can't be matched without fitting in the buffer */
+		{ "{\"some_string\":\"0123456789\",\"some_int\":1}", -ENOMEM },
+		/* Unless no field has the same length */
+		{ "{\"some_string\":\"0123456789\",\"unknown_key_1234567890\":1}", 1 },
+		/* Values skipped don't need to fit */
+		{ "{\"unknown_key_1234567890\":\"0123456789abcdef\"}", 0 },
+		{ "{\"unknown_key_1234567890\":[{\"0123456789abcdef\":[]}]}", 0 },
+		/* Trailing data is ignored */
+		{ "{\"some_int\":1} trailing", 2 },
+	};
+	char buf[16];
+
+	for (int i = 0; i < ARRAY_SIZE(encoded); i++) {
+		struct test_struct ts;
+		int64_t ret;
+
+		ret = stream_parse(encoded[i].str, strlen(encoded[i].str), 1, test_descr,
+				   ARRAY_SIZE(test_descr), &ts, buf, sizeof(buf));
+		zassert_equal(ret, encoded[i].result, "Decoding '%s' result %lld, expected %lld",
+			      encoded[i].str, (long long)ret, (long long)encoded[i].result);
+	}
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
@@ -506,6 +506,26 @@ ZTEST(net_buf_tests, test_net_buf_fixed_pool)
 	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_alloc_bulk)
+{
+	struct net_buf *bufs[12];
+	int count;
+
+	destroy_called = 0;
+
+	/* The pool has 10 buffers, the batch stops when it runs out */
+	count = net_buf_alloc_bulk(&fixed_pool, 20, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, 10, "Invalid number of buffers (%d)", count);
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(bufs[i]->size, FIXED_BUFFER_SIZE, "Invalid fixed buffer size");
+		zassert_equal(bufs[i]->len, 0, "Invalid fixed buffer length");
+		net_buf_unref(bufs[i]);
+	}
+
+	zassert_equal(destroy_called, count, "Incorrect destroy callback count");
+}
+
 ZTEST(net_buf_tests, test_net_buf_var_pool)
 {
 	struct net_buf *buf1, *buf2, *buf3;
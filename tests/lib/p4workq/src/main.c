@@ -274,5 +274,102 @@ ZTEST(lib_p4wq_1cpu, test_p4wq_simple)
 	zassert_true(has_run, "high-priority item didn't run");
 }
 
+#define BATCH_SIZE 4
+
+static struct k_p4wq_work batch_items[BATCH_SIZE];
+static int batch_order[BATCH_SIZE];
+static volatile int batch_count;
+
+static void batch_handler(struct k_p4wq_work *work)
+{
+	batch_order[batch_count++] = work - batch_items;
+}
+
+/* Items of a batch run once, by priority */
+ZTEST(lib_p4wq_1cpu, test_p4wq_submit_batch)
+{
+	static const int prios[BATCH_SIZE] = {5, 3, 6, 4};
+	struct k_p4wq_work *batch[BATCH_SIZE];
+	int prio = 2;
+
+	k_thread_priority_set(k_current_get(), prio);
+
+	/* Lower priority items, should not run until we yield */
+	for (int i = 0; i < BATCH_SIZE; i++) {
+		batch_items[i] = (struct k_p4wq_work){};
+		batch_items[i].priority = prios[i];
+		batch_items[i].handler = batch_handler;
+		batch[i] = &batch_items[i];
+	}
+
+	batch_count = 0;
+	k_p4wq_submit_batch(&wq, batch, BATCH_SIZE);
+	zassert_equal(batch_count, 0, "ran too early");
+
+	k_msleep(10);
+	zassert_equal(batch_count, BATCH_SIZE, "%d items ran", batch_count);
+	zassert_equal(batch_order[0], 1, "wrong order");
+	zassert_equal(batch_order[1], 3, "wrong order");
+	zassert_equal(batch_order[2], 0, "wrong order");
+	zassert_equal(batch_order[3], 2, "wrong order");
+
+	/* Higher priority, should preempt us */
+	for (int i = 0; i < BATCH_SIZE; i++) {
+		zassert_equal(k_p4wq_wait(&batch_items[i], K_NO_WAIT), 0);
+		batch_items[i].priority = prio - 1;
+	}
+
+	batch_count = 0;
+	k_p4wq_submit_batch(&wq, batch, BATCH_SIZE);
+	zassert_equal(batch_count, BATCH_SIZE, "high-priority items didn't run");
+}
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+K_P4WQ_ARRAY_DEFINE(steal_wq, 2, 2048, K_P4WQ_WORK_STEALING);
+
+static K_SEM_DEFINE(steal_sem, 0, 1);
+static struct k_p4wq_work steal_items[2];
+static k_tid_t steal_threads[2];
+
+static void steal_handler(struct k_p4wq_work *work)
+{
+	int i = work - steal_items;
+
+	steal_threads[i] = k_current_get();
+	if (i == 0) {
+		k_sem_take(&steal_sem, K_FOREVER);
+	}
+}
+
+/* An item of a queue whose thread is busy runs on the idle thread of the other queue */
+ZTEST(lib_p4wq_1cpu, test_p4wq_work_stealing)
+{
+	k_thread_priority_set(k_current_get(), -1);
+
+	for (int i = 0; i < 2; i++) {
+		steal_items[i] = (struct k_p4wq_work){};
+		steal_items[i].priority = 5 - i;
+		steal_items[i].handler = steal_handler;
+		steal_threads[i] = NULL;
+	}
+
+	/* Keep the thread of the first queue busy */
+	k_p4wq_submit(&steal_wq[0], &steal_items[0]);
+	k_msleep(10);
+	zassert_equal(steal_threads[0], &_p4threads_steal_wq[0]);
+
+	k_p4wq_submit(&steal_wq[0], &steal_items[1]);
+	k_msleep(10);
+	zassert_equal(steal_threads[1], &_p4threads_steal_wq[1], "item wasn't stolen");
+	zassert_equal(k_p4wq_wait(&steal_items[1], K_NO_WAIT), 0);
+	zassert_equal(k_p4wq_wait(&steal_items[0], K_NO_WAIT), -EBUSY);
+	zassert_false(k_p4wq_cancel(&steal_wq[0], &steal_items[1]));
+
+	k_sem_give(&steal_sem);
+	k_msleep(10);
+	zassert_equal(k_p4wq_wait(&steal_items[0], K_NO_WAIT), 0);
+}
+#endif /* CONFIG_P4WQ_WORK_STEALING */
+
 ZTEST_SUITE(lib_p4wq, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(lib_p4wq_1cpu, NULL, NULL, ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
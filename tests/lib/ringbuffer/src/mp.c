@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/ring_buffer_mp.h>
+#include <stdint.h>
+
+#define BLOCK_SIZE	8
+#define N_BLOCKS	16
+#define N_PRODUCERS	3
+/* A record is a struct record followed by up to MAX_PAYLOAD bytes */
+#define MAX_PAYLOAD	23
+
+RING_BUF_MP_DECLARE(mp_ringbuf, BLOCK_SIZE, N_BLOCKS);
+
+struct record {
+	uint32_t id;
+	uint32_t cnt;
+};
+
+static uint32_t sent[N_PRODUCERS];
+static atomic_t received[N_PRODUCERS];
+static uint32_t expected[N_PRODUCERS];
+
+static uint32_t payload_len(uint32_t cnt)
+{
+	return cnt % (MAX_PAYLOAD + 1);
+}
+
+/* Put the next record of producer @p id, return false if it does not fit */
+static bool record_put(uint32_t id)
+{
+	uint32_t len = sizeof(struct record) + payload_len(sent[id]);
+	struct record rec = {.id = id, .cnt = sent[id]};
+	uint8_t *data;
+	uint32_t claimed;
+	int err;
+
+	claimed = ring_buf_mp_put_claim(&mp_ringbuf, &data, len);
+	if (claimed > 0 && claimed < len) {
+		/* the claim was cut by the end of the buffer, try from the start */
+		err = ring_buf_mp_put_finish(&mp_ringbuf, data, 0);
+		zassert_equal(err, 0);
+		claimed = ring_buf_mp_put_claim(&mp_ringbuf, &data, len);
+	}
+
+	if (claimed < len) {
+		if (claimed > 0) {
+			err = ring_buf_mp_put_finish(&mp_ringbuf, data, 0);
+			zassert_equal(err, 0);
+		}
+		return false;
+	}
+
+	memcpy(data, &rec, sizeof(rec));
+	memset(&data[sizeof(rec)], (uint8_t)(id ^ rec.cnt), len - sizeof(rec));
+
+	err = ring_buf_mp_put_finish(&mp_ringbuf, data, len);
+	zassert_equal(err, 0);
+	sent[id]++;
+
+	return true;
+}
+
+/* Get and check a record, in order of production if @p in_order */
+static bool record_get(bool in_order)
+{
+	struct record rec;
+	uint8_t *data;
+	uint32_t len;
+	int err;
+
+	len = ring_buf_mp_get_claim(&mp_ringbuf, &data);
+	if (len == 0) {
+		return false;
+	}
+
+	zassert_true(len >= sizeof(rec));
+	memcpy(&rec, data, sizeof(rec));
+	zassert_true(rec.id < N_PRODUCERS, "Got id %u", rec.id);
+	zassert_equal(len, sizeof(rec) + payload_len(rec.cnt));
+	for (uint32_t i = sizeof(rec); i < len; i++) {
+		zassert_equal(data[i], (uint8_t)(rec.id ^ rec.cnt));
+	}
+
+	if (in_order) {
+		zassert_equal(rec.cnt, expected[rec.id], "Producer %u: got %u, exp: %u",
+			      rec.id, rec.cnt, expected[rec.id]);
+		expected[rec.id]++;
+	}
+
+	err = ring_buf_mp_get_finish(&mp_ringbuf, data);
+	zassert_equal(err, 0);
+	atomic_inc(&received[rec.id]);
+
+	return true;
+}
+
+static void mp_reset(void)
+{
+	memset(sent, 0, sizeof(sent));
+	memset(received, 0, sizeof(received));
+	memset(expected, 0, sizeof(expected));
+	ring_buf_mp_init(&mp_ringbuf, BLOCK_SIZE, N_BLOCKS, _ring_buffer_mp_data_mp_ringbuf,
+			 _ring_buffer_mp_chunks_mp_ringbuf);
+}
+
+static void mp_check(int n_producers, bool in_order)
+{
+	while (record_get(in_order)) {
+	}
+
+	zassert_true(ring_buf_mp_is_empty(&mp_ringbuf));
+	zassert_equal(ring_buf_mp_space_get(&mp_ringbuf), ring_buf_mp_capacity_get(&mp_ringbuf));
+
+	for (int i = 0; i < n_producers; i++) {
+		zassert_true(sent[i] > 0, "Producer %d did not put anything", i);
+		zassert_equal(sent[i], atomic_get(&received[i]), "Producer %d", i);
+	}
+}
+
+ZTEST(ringbuffer_api, test_ringbuffer_mp_claim)
+{
+	uint8_t *data, *data2, *data3;
+	uint8_t out[4 * BLOCK_SIZE];
+	uint32_t len;
+
+	mp_reset();
+
+	zassert_equal(ring_buf_mp_capacity_get(&mp_ringbuf), BLOCK_SIZE * N_BLOCKS);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data), 0);
+
+	/* claims are rounded up to whole blocks */
+	len = ring_buf_mp_put_claim(&mp_ringbuf, &data, BLOCK_SIZE + 1);
+	zassert_equal(len, BLOCK_SIZE + 1);
+	zassert_equal(ring_buf_mp_space_get(&mp_ringbuf), BLOCK_SIZE * (N_BLOCKS - 2));
+	len = ring_buf_mp_put_claim(&mp_ringbuf, &data2, 2);
+	zassert_equal(data2, data + 2 * BLOCK_SIZE);
+
+	/* an unfinished claim holds back the ones after it */
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data2, 2), 0);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 0);
+	zassert_false(ring_buf_mp_is_empty(&mp_ringbuf));
+
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data, 2 * BLOCK_SIZE + 1), -EINVAL);
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data + 1, 1), -EINVAL);
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data, 2 * BLOCK_SIZE), 0);
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data, 1), -EINVAL);
+
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 2 * BLOCK_SIZE);
+	zassert_equal(data3, data);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 2);
+	zassert_equal(data3, data2);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 0);
+
+	/* space comes back once chunks are finished in order, by whoever finishes them */
+	zassert_equal(ring_buf_mp_get_finish(&mp_ringbuf, data2), 0);
+	zassert_equal(ring_buf_mp_get_finish(&mp_ringbuf, data2), -EINVAL);
+	zassert_equal(ring_buf_mp_space_get(&mp_ringbuf), BLOCK_SIZE * (N_BLOCKS - 3));
+	zassert_equal(ring_buf_mp_get_finish(&mp_ringbuf, data), 0);
+	zassert_equal(ring_buf_mp_space_get(&mp_ringbuf), BLOCK_SIZE * N_BLOCKS);
+	zassert_true(ring_buf_mp_is_empty(&mp_ringbuf));
+
+	/* claims do not wrap, cancelled ones are skipped */
+	len = ring_buf_mp_put_claim(&mp_ringbuf, &data, N_BLOCKS * BLOCK_SIZE);
+	zassert_equal(len, (N_BLOCKS - 3) * BLOCK_SIZE);
+	zassert_equal(ring_buf_mp_put_claim(&mp_ringbuf, &data2, 4 * BLOCK_SIZE), 3 * BLOCK_SIZE);
+	zassert_equal(data2, data - 3 * BLOCK_SIZE);
+	zassert_equal(ring_buf_mp_put_claim(&mp_ringbuf, &data3, 1), 0);
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data2, 1), 0);
+	zassert_equal(ring_buf_mp_put_finish(&mp_ringbuf, data, 0), 0);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 1);
+	zassert_equal(data3, data2);
+	zassert_equal(ring_buf_mp_get_claim(&mp_ringbuf, &data3), 0);
+	zassert_equal(ring_buf_mp_get_finish(&mp_ringbuf, data2), 0);
+	zassert_true(ring_buf_mp_is_empty(&mp_ringbuf));
+	zassert_equal(ring_buf_mp_space_get(&mp_ringbuf), BLOCK_SIZE * N_BLOCKS);
+
+	/* copying API */
+	for (int i = 0; i < sizeof(out); i++) {
+		out[i] = i;
+	}
+	zassert_equal(ring_buf_mp_put(&mp_ringbuf, out, 3), 3);
+	zassert_equal(ring_buf_mp_put(&mp_ringbuf, &out[3], 2 * BLOCK_SIZE), 2 * BLOCK_SIZE);
+	memset(out, 0, sizeof(out));
+	zassert_equal(ring_buf_mp_get(&mp_ringbuf, out, 2 * BLOCK_SIZE), 3);
+	zassert_equal(ring_buf_mp_get(&mp_ringbuf, &out[3], 2), 2);
+	for (int i = 0; i < 5; i++) {
+		zassert_equal(out[i], i);
+	}
+	zassert_true(ring_buf_mp_is_empty(&mp_ringbuf));
+}
+
+static bool mpsc_produce(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	(void)record_put((uintptr_t)user_data);
+
+	return true;
+}
+
+static bool mpsc_consume(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	while (record_get(true)) {
+	}
+
+	return true;
+}
+
+/* Producers in an ISR and a thread, consumer preempted by both. Each producer
+ * must be consumed in order.
+ */
+ZTEST(ringbuffer_api, test_ringbuffer_mp_mpsc_stress)
+{
+	mp_reset();
+
+	ztress_set_timeout(K_MSEC(1000));
+	ZTRESS_EXECUTE(ZTRESS_TIMER(mpsc_produce, (void *)0, 0, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(mpsc_produce, (void *)1, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpsc_consume, NULL, 0, 200, Z_TIMEOUT_TICKS(20)));
+
+	mp_check(2, true);
+}
+
+static bool mpmc_handler(void *user_data, uint32_t iter_cnt, bool last, int prio)
+{
+	uint32_t id = (uintptr_t)user_data;
+
+	for (int i = 0; i < 3; i++) {
+		if (!record_put(id)) {
+			break;
+		}
+	}
+	(void)record_get(false);
+
+	return true;
+}
+
+/* Every context produces and consumes. */
+ZTEST(ringbuffer_api, test_ringbuffer_mp_mpmc_stress)
+{
+	mp_reset();
+
+	ztress_set_timeout(K_MSEC(1000));
+	ZTRESS_EXECUTE(ZTRESS_TIMER(mpmc_handler, (void *)0, 0, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(mpmc_handler, (void *)1, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpmc_handler, (void *)2, 0, 200, Z_TIMEOUT_TICKS(20)));
+
+	mp_check(N_PRODUCERS, false);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/seqlock.h>
+#include <zephyr/ztest.h>
+
+struct snapshot {
+	uint32_t value;
+	uint32_t check;
+};
+
+static SYS_SEQLOCK_DEFINE(lock);
+static struct snapshot shared;
+static uint32_t writes;
+
+static void write_snapshot(void)
+{
+	k_spinlock_key_t key = sys_seqlock_write_lock(&lock);
+
+	writes++;
+	shared.value = writes;
+	/* Leave the snapshot torn for a while */
+	k_busy_wait(10);
+	shared.check = ~writes;
+
+	sys_seqlock_write_unlock(&lock, key);
+}
+
+static struct snapshot read_snapshot(void)
+{
+	struct snapshot copy;
+	uint32_t seq;
+
+	do {
+		seq = sys_seqlock_read_begin(&lock);
+		copy.value = shared.value;
+		k_busy_wait(10);
+		copy.check = shared.check;
+	} while (sys_seqlock_read_retry(&lock, seq));
+
+	return copy;
+}
+
+static void timer_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	write_snapshot();
+}
+
+static K_TIMER_DEFINE(timer, timer_fn, NULL);
+
+/**
+ * @brief A read with no concurrent write succeeds at once
+ */
+ZTEST(seqlock, test_read_uncontended)
+{
+	uint32_t seq = sys_seqlock_read_begin(&lock);
+
+	zassert_false(sys_seqlock_read_retry(&lock, seq));
+}
+
+/**
+ * @brief A write between the start and the end of a read forces a retry
+ */
+ZTEST(seqlock, test_read_retry)
+{
+	uint32_t seq = sys_seqlock_read_begin(&lock);
+
+	write_snapshot();
+	zassert_true(sys_seqlock_read_retry(&lock, seq));
+
+	seq = sys_seqlock_read_begin(&lock);
+	zassert_false(sys_seqlock_read_retry(&lock, seq));
+}
+
+/**
+ * @brief Readers never see a snapshot torn by a writer in an ISR
+ */
+ZTEST(seqlock, test_isr_writer)
+{
+	struct snapshot copy;
+	uint32_t start = writes;
+
+	k_timer_start(&timer, K_TICKS(1), K_TICKS(1));
+
+	while (writes - start < 20U) {
+		copy = read_snapshot();
+		zassert_equal(copy.check, ~copy.value, "torn snapshot %u", copy.value);
+	}
+
+	k_timer_stop(&timer);
+}
+
+static void before(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sys_seqlock_init(&lock);
+	write_snapshot();
+}
+
+ZTEST_SUITE(seqlock, NULL, NULL, before, NULL, NULL);
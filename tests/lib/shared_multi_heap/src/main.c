@@ -214,4 +214,73 @@ ZTEST(shared_multi_heap, test_shared_multi_heap)
 	zassert_is_null(block, "wrong attribute accepted as valid");
 }
 
+#define LOC_HEAP_SIZE		0x400
+#define LOC_BLOCK_SIZE		0x200
+
+static uint8_t __aligned(8) remote_heap[LOC_HEAP_SIZE];
+static uint8_t __aligned(8) shared_heap[LOC_HEAP_SIZE];
+static uint8_t __aligned(8) local_heap[LOC_HEAP_SIZE];
+
+static bool in_heap(void *block, uint8_t *heap)
+{
+	return (uint8_t *) block >= heap && (uint8_t *) block < heap + LOC_HEAP_SIZE;
+}
+
+ZTEST(shared_multi_heap, test_shared_multi_heap_locality)
+{
+	uint32_t cpu = arch_curr_cpu()->id;
+	struct shared_multi_heap_region regions[] = {
+		{
+			.attr = SMH_REG_ATTR_EXTERNAL,
+			.addr = (uintptr_t) remote_heap,
+			.size = LOC_HEAP_SIZE,
+			.cpus = ~BIT(cpu),
+		},
+		{
+			.attr = SMH_REG_ATTR_EXTERNAL,
+			.addr = (uintptr_t) shared_heap,
+			.size = LOC_HEAP_SIZE,
+		},
+		{
+			.attr = SMH_REG_ATTR_EXTERNAL,
+			.addr = (uintptr_t) local_heap,
+			.size = LOC_HEAP_SIZE,
+			.cpus = BIT(cpu),
+		},
+	};
+	void *block[3];
+	int ret;
+
+	/* The pool is initialized by test_shared_multi_heap */
+	ret = shared_multi_heap_pool_init();
+	zassert_true(ret == 0 || ret == -EALREADY, "failed initialization");
+
+	/* Regions added from the least to the most local */
+	for (size_t idx = 0; idx < ARRAY_SIZE(regions); idx++) {
+		zassert_ok(shared_multi_heap_add(&regions[idx], NULL));
+	}
+
+	/* Each region holds a single block, filled from the most local */
+	block[0] = shared_multi_heap_alloc(SMH_REG_ATTR_EXTERNAL, LOC_BLOCK_SIZE);
+	zassert_true(in_heap(block[0], local_heap), "local region not preferred");
+
+	block[1] = shared_multi_heap_alloc(SMH_REG_ATTR_EXTERNAL, LOC_BLOCK_SIZE);
+	zassert_true(in_heap(block[1], shared_heap), "no fallback to the shared region");
+
+	block[2] = shared_multi_heap_alloc(SMH_REG_ATTR_EXTERNAL, LOC_BLOCK_SIZE);
+	zassert_true(in_heap(block[2], remote_heap), "no fallback to the remote region");
+
+	zassert_is_null(shared_multi_heap_alloc(SMH_REG_ATTR_EXTERNAL, LOC_BLOCK_SIZE),
+			"regions should be full");
+
+	/* A freed block goes back to its own region */
+	shared_multi_heap_free(block[0]);
+	block[0] = shared_multi_heap_alloc(SMH_REG_ATTR_EXTERNAL, LOC_BLOCK_SIZE);
+	zassert_true(in_heap(block[0], local_heap), "local block not freed");
+
+	for (size_t idx = 0; idx < ARRAY_SIZE(block); idx++) {
+		shared_multi_heap_free(block[idx]);
+	}
+}
+
 ZTEST_SUITE(shared_multi_heap, NULL, NULL, NULL, NULL, NULL);
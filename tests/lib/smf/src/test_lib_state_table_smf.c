@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/smf.h>
+
+/*
+ * State table test:
+ *
+ * The same hierarchy is defined with SMF_CREATE_STATE() and with
+ * SMF_STATE_TABLE_DEFINE(), and both state machines go through the same
+ * transitions, which must execute the same actions in the same order:
+ *
+ *   ROOT ---- P ---- PA ---- A
+ *   |         |      |
+ *   |         |      +------ B
+ *   |         |
+ *   |         +----- PB ---- C
+ *   |
+ *   +-------- Q ---- D
+ *
+ *   T
+ *
+ * with initial transitions from ROOT to P, P to PA, PA to A, PB to C and
+ * Q to D.
+ */
+
+#define TEST_OBJECT(o) ((struct test_object *)o)
+
+#define LOG_SIZE 32
+
+enum test_state {
+	ROOT,
+	P,
+	PA,
+	A,
+	B,
+	PB,
+	C,
+	Q,
+	D,
+	T,
+	NUM_STATES,
+};
+
+enum test_action {
+	ENTRY,
+	RUN,
+	EXIT,
+};
+
+#define ACTION(_action, _state) (((_action) << 4) | (_state))
+
+static struct test_object {
+	struct smf_ctx ctx;
+	const struct smf_state *states;
+	/* state whose run action transitions to target */
+	enum test_state from;
+	enum test_state target;
+	/* state whose entry action terminates the state machine */
+	enum test_state terminate_in;
+	uint8_t log[LOG_SIZE];
+	size_t log_len;
+} ref_obj, table_obj;
+
+static void record(void *obj, enum test_action action, enum test_state state)
+{
+	struct test_object *o = TEST_OBJECT(obj);
+
+	zassert_true(o->log_len < LOG_SIZE, "Too many actions");
+	o->log[o->log_len++] = ACTION(action, state);
+
+	if (action == ENTRY && state == o->terminate_in) {
+		smf_set_terminate(SMF_CTX(obj), -1);
+	}
+
+	if (action == RUN && state == o->from) {
+		o->from = NUM_STATES;
+		smf_set_state(SMF_CTX(obj), &o->states[o->target]);
+	}
+}
+
+#define STATE_ACTIONS(_state)                                                                      \
+	static void entry_##_state(void *obj)                                                      \
+	{                                                                                          \
+		record(obj, ENTRY, _state);                                                        \
+	}                                                                                          \
+	static void run_##_state(void *obj)                                                        \
+	{                                                                                          \
+		record(obj, RUN, _state);                                                          \
+	}                                                                                          \
+	static void exit_##_state(void *obj)                                                       \
+	{                                                                                          \
+		record(obj, EXIT, _state);                                                         \
+	}
+
+FOR_EACH(STATE_ACTIONS, (), ROOT, P, PA, A, B, PB, C, Q, D, T)
+
+#define CREATE_STATE(_state, _parent, _initial)                                                    \
+	[_state] = SMF_CREATE_STATE(entry_##_state, run_##_state, exit_##_state, _parent, _initial)
+
+static const struct smf_state ref_states[];
+
+static const struct smf_state ref_states[] = {
+	CREATE_STATE(ROOT, NULL, &ref_states[P]),
+	CREATE_STATE(P, &ref_states[ROOT], &ref_states[PA]),
+	CREATE_STATE(PA, &ref_states[P], &ref_states[A]),
+	CREATE_STATE(A, &ref_states[PA], NULL),
+	CREATE_STATE(B, &ref_states[PA], NULL),
+	CREATE_STATE(PB, &ref_states[P], &ref_states[C]),
+	CREATE_STATE(C, &ref_states[PB], NULL),
+	CREATE_STATE(Q, &ref_states[ROOT], &ref_states[D]),
+	CREATE_STATE(D, &ref_states[Q], NULL),
+	CREATE_STATE(T, NULL, NULL),
+};
+
+#define TABLE_STATE(_state, _parent, _initial)                                                     \
+	SMF_TABLE_STATE(_state, entry_##_state, run_##_state, exit_##_state, _parent, _initial)
+
+SMF_STATE_TABLE_DEFINE(table_states,
+		       TABLE_STATE(ROOT, SMF_NONE, P),
+		       TABLE_STATE(P, ROOT, PA),
+		       TABLE_STATE(PA, P, A),
+		       TABLE_STATE(A, PA, SMF_NONE),
+		       TABLE_STATE(B, PA, SMF_NONE),
+		       TABLE_STATE(PB, P, C),
+		       TABLE_STATE(C, PB, SMF_NONE),
+		       TABLE_STATE(Q, ROOT, D),
+		       TABLE_STATE(D, Q, SMF_NONE),
+		       TABLE_STATE(T, SMF_NONE, SMF_NONE));
+
+static void obj_init(struct test_object *o, const struct smf_state *states,
+		     enum test_state initial)
+{
+	memset(o, 0, sizeof(*o));
+	o->states = states;
+	o->from = NUM_STATES;
+	o->terminate_in = NUM_STATES;
+	smf_set_initial(SMF_CTX(o), &states[initial]);
+}
+
+/* Run both state machines, the run action of @p from transitioning to @p target */
+static void run_both(enum test_state from, enum test_state target)
+{
+	int32_t ref_ret, table_ret;
+
+	ref_obj.log_len = 0;
+	table_obj.log_len = 0;
+	ref_obj.from = table_obj.from = from;
+	ref_obj.target = table_obj.target = target;
+
+	ref_ret = smf_run_state(SMF_CTX(&ref_obj));
+	table_ret = smf_run_state(SMF_CTX(&table_obj));
+
+	zassert_equal(ref_ret, table_ret, "%d -> %d: termination differs", from, target);
+	zassert_equal(ref_obj.log_len, table_obj.log_len, "%d -> %d: %zu actions, expected %zu",
+		      from, target, table_obj.log_len, ref_obj.log_len);
+	zassert_mem_equal(ref_obj.log, table_obj.log, ref_obj.log_len,
+			  "%d -> %d: actions differ", from, target);
+	zassert_equal(ref_obj.ctx.current - ref_states, table_obj.ctx.current - table_states,
+		      "%d -> %d: current state differs", from, target);
+}
+
+ZTEST(smf_tests, test_smf_state_table_layout)
+{
+	zassert_equal(ARRAY_SIZE(table_states), NUM_STATES);
+
+	for (int i = 0; i < NUM_STATES; i++) {
+		const struct smf_state *state = &table_states[i];
+		const struct smf_state *ref = &ref_states[i];
+		int depth = 0;
+
+		zassert_equal(ref->parent == NULL ? NULL : &table_states[ref->parent - ref_states],
+			      state->parent, "State %d: wrong parent", i);
+		zassert_equal(ref->initial == NULL ? NULL : &table_states[ref->initial - ref_states],
+			      state->initial, "State %d: wrong initial state", i);
+
+		for (const struct smf_state *tmp = state->parent; tmp != NULL; tmp = tmp->parent) {
+			depth++;
+		}
+		zassert_equal(state->depth, depth, "State %d: wrong depth", i);
+
+		for (const struct smf_state *tmp = state; tmp != NULL; tmp = tmp->parent) {
+			zassert_equal_ptr(state->path[depth--], tmp, "State %d: wrong path", i);
+		}
+	}
+
+	/* States created with SMF_CREATE_STATE() have no path */
+	zassert_is_null(ref_states[A].path);
+}
+
+ZTEST(smf_tests, test_smf_state_table_transitions)
+{
+	static const uint8_t expected[] = {
+		ACTION(RUN, A),  ACTION(RUN, PA), ACTION(RUN, P),
+		ACTION(EXIT, A), ACTION(EXIT, PA), ACTION(ENTRY, PB), ACTION(ENTRY, C),
+	};
+	static const struct {
+		enum test_state from;
+		enum test_state target;
+	} steps[] = {
+		/* to a cousin leaf and to a leaf of another branch */
+		{C, A}, {A, D}, {D, C},
+		/* to self, from a leaf and from ancestors */
+		{C, C}, {PB, PB}, {ROOT, ROOT},
+		/* to an ancestor, which transitions to its initial leaf */
+		{A, PA}, {A, P}, {A, ROOT},
+		/* from an ancestor to a descendant */
+		{PA, B}, {P, C}, {ROOT, D},
+		/* to a state without common ancestor and back */
+		{D, T}, {T, B}, {B, T}, {T, T}, {T, ROOT},
+		/* no transition */
+		{NUM_STATES, NUM_STATES},
+	};
+
+	obj_init(&ref_obj, ref_states, ROOT);
+	obj_init(&table_obj, table_states, ROOT);
+	zassert_equal_ptr(table_obj.ctx.current, &table_states[A]);
+	zassert_equal(ref_obj.log_len, table_obj.log_len);
+	zassert_mem_equal(ref_obj.log, table_obj.log, ref_obj.log_len);
+
+	run_both(A, B);
+	run_both(B, A);
+
+	/* the parent of the parent transitions to a cousin branch */
+	run_both(P, PB);
+	zassert_equal(table_obj.log_len, ARRAY_SIZE(expected));
+	zassert_mem_equal(table_obj.log, expected, sizeof(expected));
+	zassert_equal_ptr(table_obj.ctx.current, &table_states[C]);
+
+	for (size_t i = 0; i < ARRAY_SIZE(steps); i++) {
+		run_both(steps[i].from, steps[i].target);
+	}
+}
+
+ZTEST(smf_tests, test_smf_state_table_terminate)
+{
+	obj_init(&ref_obj, ref_states, A);
+	obj_init(&table_obj, table_states, A);
+
+	/* terminate in the entry action of an intermediate state */
+	ref_obj.terminate_in = table_obj.terminate_in = Q;
+	run_both(A, D);
+	zassert_equal(smf_run_state(SMF_CTX(&table_obj)), -1);
+	zassert_equal(table_obj.log[table_obj.log_len - 1], ACTION(ENTRY, Q));
+}
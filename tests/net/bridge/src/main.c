@@ -234,7 +234,7 @@ static void test_iface_setup(void)
 /*
  * Simulate a packet reception from the outside world
  */
-static void _recv_data(struct net_if *iface)
+static void _recv_data_to(struct net_if *iface, const struct net_eth_addr *dst)
 {
 	struct net_pkt *pkt;
 	struct net_eth_hdr eth_hdr;
@@ -259,6 +259,10 @@ static void _recv_data(struct net_if *iface)
 	eth_hdr.dst.addr[4] = net_if_get_by_iface(iface);
 	eth_hdr.dst.addr[5] = 0x55;
 
+	if (dst != NULL) {
+		memcpy(&eth_hdr.dst, dst, sizeof(eth_hdr.dst));
+	}
+
 	eth_hdr.src.addr[0] = 0xa2;
 	eth_hdr.src.addr[1] = 0x11;
 	eth_hdr.src.addr[2] = 0x22;
@@ -279,6 +283,11 @@ static void _recv_data(struct net_if *iface)
 	zassert_equal(ret, 0, "");
 }
 
+static void _recv_data(struct net_if *iface)
+{
+	_recv_data_to(iface, NULL);
+}
+
 static void test_recv_before_bridging(void)
 {
 	/* fake some packet reception */
@@ -364,6 +373,94 @@ static void test_recv_with_bridge(void)
 	check_free_packet_count();
 }
 
+static void clear_sent_packets(void)
+{
+	ARRAY_FOR_EACH(eth_fake_data, i) {
+		if (eth_fake_data[i].sent_pkt != NULL) {
+			net_pkt_unref(eth_fake_data[i].sent_pkt);
+			eth_fake_data[i].sent_pkt = NULL;
+		}
+	}
+}
+
+/* Source address used by _recv_data_to() for frames received on iface */
+static void src_addr(struct net_if *iface, struct net_eth_addr *addr)
+{
+	*addr = (struct net_eth_addr){ { 0xa2, 0x11, 0x22, net_if_get_by_iface(iface),
+					 0x77, 0x88 } };
+}
+
+static void test_recv_with_fdb(void)
+{
+	struct net_eth_addr addr;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_ETHERNET_BRIDGE_FDB)) {
+		return;
+	}
+
+	clear_sent_packets();
+
+	/* The source address of fake_iface[0] has been learned, so the frame
+	 * is forwarded only to fake_iface[0].
+	 */
+	src_addr(fake_iface[0], &addr);
+	_recv_data_to(fake_iface[2], &addr);
+	k_sleep(K_MSEC(100));
+
+	zassert_not_null(eth_fake_data[0].sent_pkt, "");
+	zassert_is_null(eth_fake_data[1].sent_pkt, "");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+	clear_sent_packets();
+
+	/* A frame to an address of its own network is not forwarded */
+	src_addr(fake_iface[2], &addr);
+	_recv_data_to(fake_iface[2], &addr);
+	k_sleep(K_MSEC(100));
+
+	zassert_is_null(eth_fake_data[0].sent_pkt, "");
+	zassert_is_null(eth_fake_data[1].sent_pkt, "");
+	zassert_is_null(eth_fake_data[2].sent_pkt, "");
+
+	/* A static entry overrides the learned one */
+	src_addr(fake_iface[0], &addr);
+	ret = eth_bridge_fdb_add(bridge, &addr, fake_iface[1]);
+	zassert_equal(ret, 0, "");
+
+	_recv_data_to(fake_iface[2], &addr);
+	k_sleep(K_MSEC(100));
+
+	zassert_is_null(eth_fake_data[0].sent_pkt, "");
+	zassert_not_null(eth_fake_data[1].sent_pkt, "");
+	clear_sent_packets();
+
+	/* Learning does not move a static entry */
+	_recv_data(fake_iface[0]);
+	k_sleep(K_MSEC(100));
+	clear_sent_packets();
+
+	_recv_data_to(fake_iface[2], &addr);
+	k_sleep(K_MSEC(100));
+
+	zassert_is_null(eth_fake_data[0].sent_pkt, "");
+	zassert_not_null(eth_fake_data[1].sent_pkt, "");
+	clear_sent_packets();
+
+	ret = eth_bridge_fdb_del(bridge, &addr);
+	zassert_equal(ret, 0, "");
+
+	ret = eth_bridge_fdb_del(bridge, &addr);
+	zassert_equal(ret, -ENOENT, "");
+
+	/* Unknown again, so flooded */
+	_recv_data_to(fake_iface[2], &addr);
+	k_sleep(K_MSEC(100));
+
+	zassert_not_null(eth_fake_data[0].sent_pkt, "");
+	zassert_not_null(eth_fake_data[1].sent_pkt, "");
+	clear_sent_packets();
+}
+
 static void test_recv_after_bridging(void)
 {
 	int ret;
@@ -407,6 +504,7 @@ ZTEST(net_eth_bridge, test_net_eth_bridge)
 	DBG("With bridging\n");
 	test_setup_bridge();
 	test_recv_with_bridge();
+	test_recv_with_fdb();
 	DBG("After bridging\n");
 	test_recv_after_bridging();
 }
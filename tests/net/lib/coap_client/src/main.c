@@ -304,6 +304,100 @@ static ssize_t z_impl_zsock_recvfrom_custom_fake_echo_next_req(int sock, void *b
 	return sizeof(ack_data);
 }
 
+/* Resource of 8 blocks, the last one partial */
+#define WINDOW_RESOURCE_LEN (7 * 256 + 100)
+
+struct window_block_req {
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+	uint16_t id;
+	uint32_t num;
+};
+
+static struct window_block_req window_reqs[CONFIG_COAP_CLIENT_BLOCK_WINDOW + 1];
+static int window_reqs_count;
+static int window_reqs_max;
+static uint8_t window_resource[WINDOW_RESOURCE_LEN];
+static size_t window_received;
+static int window_last_blocks;
+
+static void z_impl_sys_rand_get_custom_fake_counter(void *dst, size_t len)
+{
+	static uint8_t counter;
+
+	for (size_t i = 0; i < len; i++) {
+		((uint8_t *)dst)[i] = counter++;
+	}
+}
+
+static ssize_t z_impl_zsock_sendto_custom_fake_block(int sock, void *buf, size_t len, int flags,
+						     const struct sockaddr *dest_addr,
+						     socklen_t addrlen)
+{
+	struct window_block_req *req = &window_reqs[window_reqs_count];
+	struct coap_packet request;
+	int block2;
+
+	zassert_ok(coap_packet_parse(&request, buf, len, NULL, 0));
+	zassert_true(window_reqs_count < ARRAY_SIZE(window_reqs), "Too many requests in flight");
+
+	req->tkl = coap_header_get_token(&request, req->token);
+	req->id = coap_header_get_id(&request);
+	block2 = coap_get_option_int(&request, COAP_OPTION_BLOCK2);
+	req->num = block2 > 0 ? GET_BLOCK_NUM(block2) : 0;
+
+	window_reqs_count++;
+	window_reqs_max = MAX(window_reqs_max, window_reqs_count);
+
+	set_socket_events(ZSOCK_POLLIN);
+
+	return len;
+}
+
+/* Answer the last request first, so that the blocks arrive out of order */
+static ssize_t z_impl_zsock_recvfrom_custom_fake_block(int sock, void *buf, size_t max_len,
+						       int flags, struct sockaddr *src_addr,
+						       socklen_t *addrlen)
+{
+	struct window_block_req *req = &window_reqs[--window_reqs_count];
+	struct coap_block_context ctx;
+	struct coap_packet response;
+	size_t offset = req->num * 256;
+
+	coap_block_transfer_init(&ctx, COAP_BLOCK_256, WINDOW_RESOURCE_LEN);
+	ctx.current = offset;
+
+	zassert_ok(coap_packet_init(&response, buf, max_len, COAP_VERSION_1, COAP_TYPE_ACK,
+				    req->tkl, req->token, COAP_RESPONSE_CODE_CONTENT, req->id));
+	zassert_ok(coap_append_block2_option(&response, &ctx));
+	zassert_ok(coap_append_size2_option(&response, &ctx));
+	zassert_ok(coap_packet_append_payload_marker(&response));
+
+	for (size_t i = offset; i < MIN(offset + 256, WINDOW_RESOURCE_LEN); i++) {
+		zassert_ok(coap_packet_append_payload(&response, &(uint8_t){i & 0xff}, 1));
+	}
+
+	if (window_reqs_count == 0) {
+		clear_socket_events();
+	}
+
+	return response.offset;
+}
+
+static void coap_callback_block(int16_t code, size_t offset, const uint8_t *payload, size_t len,
+				bool last_block, void *user_data)
+{
+	zassert_equal(code, COAP_RESPONSE_CODE_CONTENT, "Unexpected response");
+	zassert_true(offset + len <= sizeof(window_resource), "Block out of the resource");
+
+	memcpy(&window_resource[offset], payload, len);
+	window_received += len;
+
+	if (last_block) {
+		window_last_blocks++;
+	}
+}
+
 static void *suite_setup(void)
 {
 	coap_client_init(&client, NULL);
@@ -663,3 +757,55 @@ ZTEST(coap_client, test_unmatching_tokens)
 	k_sleep(K_MSEC(MORE_THAN_LONG_EXCHANGE_LIFETIME_MS));
 	zassert_equal(last_response_code, -ETIMEDOUT, "Unexpected response");
 }
+
+ZTEST(coap_client, test_get_block_window)
+{
+	int ret = 0;
+	int retry = MORE_THAN_LONG_EXCHANGE_LIFETIME_MS;
+	struct sockaddr address = {0};
+	struct coap_client_request client_request = {
+		.method = COAP_METHOD_GET,
+		.confirmable = true,
+		.path = test_path,
+		.fmt = COAP_CONTENT_FORMAT_TEXT_PLAIN,
+		.cb = coap_callback_block,
+		.payload = NULL,
+		.len = 0
+	};
+	struct coap_transmission_parameters params = {
+		.ack_timeout = LONG_ACK_TIMEOUT_MS,
+		.coap_backoff_percent = 200,
+		.max_retransmission = 0
+	};
+
+	window_reqs_count = 0;
+	window_reqs_max = 0;
+	window_received = 0;
+	window_last_blocks = 0;
+	memset(window_resource, 0, sizeof(window_resource));
+
+	z_impl_sys_rand_get_fake.custom_fake = z_impl_sys_rand_get_custom_fake_counter;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_custom_fake_block;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_custom_fake_block;
+
+	k_sleep(K_MSEC(1));
+
+	LOG_INF("Send request");
+	ret = coap_client_req(&client, 0, &address, &client_request, &params);
+	zassert_true(ret >= 0, "Sending request failed, %d", ret);
+
+	while (window_last_blocks == 0 && retry > 0) {
+		retry--;
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_equal(window_last_blocks, 1, "Transfer not completed once");
+	zassert_equal(window_received, WINDOW_RESOURCE_LEN, "Unexpected length");
+	zassert_equal(window_reqs_max, CONFIG_COAP_CLIENT_BLOCK_WINDOW,
+		      "Blocks not requested in parallel");
+	zassert_equal(z_impl_zsock_sendto_fake.call_count, 8, "One request per block expected");
+
+	for (size_t i = 0; i < WINDOW_RESOURCE_LEN; i++) {
+		zassert_equal(window_resource[i], i & 0xff, "Invalid data at %zu", i);
+	}
+}
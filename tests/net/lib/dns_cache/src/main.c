@@ -133,3 +133,60 @@ ZTEST(net_dns_cache_test, test_expired_entries_removed)
 	zassert_equal(1, dns_cache_find(&test_dns_cache, query, info_read, 3));
 	zassert_equal(AF_INET, info_read[0].ai_family);
 }
+
+ZTEST(net_dns_cache_test, test_least_recently_used_removed)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *used = "example.com";
+	const char *unused = "example2.com";
+
+	zassert_ok(dns_cache_add(&test_dns_cache, used, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_ok(dns_cache_add(&test_dns_cache, unused, &info_write, TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	k_sleep(K_MSEC(1));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, used, &info_read, 1));
+	k_sleep(K_MSEC(1));
+	for (size_t i = 0; i < TEST_DNS_CACHE_SIZE - 2; i++) {
+		zassert_ok(dns_cache_add(&test_dns_cache, "example3.com", &info_write,
+					 TEST_DNS_CACHE_DEFAULT_TTL),
+			   "Cache entry adding should work.");
+	}
+	/* The cache is full, the entry not looked up is replaced first */
+	zassert_ok(dns_cache_add(&test_dns_cache, "example4.com", &info_write,
+				 TEST_DNS_CACHE_DEFAULT_TTL),
+		   "Cache entry adding should work.");
+	zassert_equal(0, dns_cache_find(&test_dns_cache, unused, &info_read, 1));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, used, &info_read, 1));
+}
+
+ZTEST(net_dns_cache_test, test_refresh_due)
+{
+	struct dns_addrinfo info_write = {.ai_family = AF_INET};
+	struct dns_addrinfo info_read = {0};
+	const char *query = "example.com";
+
+	if (CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME == 0) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write,
+				 CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME + 1),
+		   "Cache entry adding should work.");
+	zassert_false(dns_cache_refresh_due(&test_dns_cache, query, AF_INET));
+
+	k_sleep(K_MSEC(1001));
+	zassert_false(dns_cache_refresh_due(&test_dns_cache, query, AF_INET6));
+	zassert_true(dns_cache_refresh_due(&test_dns_cache, query, AF_INET));
+	/* Reported once per refresh */
+	zassert_false(dns_cache_refresh_due(&test_dns_cache, query, AF_INET));
+
+	/* The new answer renews the entry instead of adding one */
+	zassert_ok(dns_cache_add(&test_dns_cache, query, &info_write,
+				 CONFIG_DNS_RESOLVER_CACHE_PREFETCH_TIME + 1),
+		   "Cache entry adding should work.");
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, &info_read, 1));
+	k_sleep(K_MSEC(1001));
+	zassert_equal(1, dns_cache_find(&test_dns_cache, query, &info_read, 1));
+}
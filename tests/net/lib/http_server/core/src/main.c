@@ -27,6 +27,13 @@
 #define TEST_DYNAMIC_POST_PAYLOAD "Test dynamic POST"
 #define TEST_DYNAMIC_GET_PAYLOAD "Test dynamic GET"
 #define TEST_STATIC_PAYLOAD "Hello, World!"
+/* CRC-32 of TEST_STATIC_PAYLOAD */
+#define TEST_STATIC_ETAG "\"ec4ac3d0\""
+#if defined(CONFIG_HTTP_SERVER_STATIC_ETAG)
+#define TEST_STATIC_ETAG_HEADER "ETag: " TEST_STATIC_ETAG "\r\n"
+#else
+#define TEST_STATIC_ETAG_HEADER ""
+#endif
 
 /* Random base64 encoded data */
 #define TEST_LONG_PAYLOAD_CHUNK_1                                                                  \
@@ -521,11 +528,12 @@ static void expect_contains_header(const uint8_t *buffer, size_t len,
 	size_t consumed = 0;
 
 	while (consumed < len) {
-		ret = http_hpack_decode_header(buffer + consumed, len, &header_buf);
+		ret = http_hpack_decode_header(buffer + consumed, len, &header_buf, NULL);
 		zassert_true(ret >= 0, "Failed to decode header");
 		zassert_true(consumed + ret <= len, "Frame length exceeded");
 
-		if (strncasecmp(header_buf.name, header->name, header_buf.name_len) == 0 &&
+		if (header_buf.name_len > 0 &&
+		    strncasecmp(header_buf.name, header->name, header_buf.name_len) == 0 &&
 		    strncasecmp(header_buf.value, header->value, header_buf.value_len) == 0) {
 			found = true;
 			break;
@@ -699,6 +707,7 @@ ZTEST(server_function_tests, test_http1_static_get)
 		"HTTP/1.1 200 OK\r\n"
 		"Content-Type: text/html\r\n"
 		"Content-Length: 13\r\n"
+		TEST_STATIC_ETAG_HEADER
 		"\r\n"
 		TEST_STATIC_PAYLOAD;
 	size_t offset = 0;
@@ -714,6 +723,32 @@ ZTEST(server_function_tests, test_http1_static_get)
 			  "Received data doesn't match expected response");
 }
 
+ZTEST(server_function_tests, test_http1_static_get_not_modified)
+{
+	static const char http1_request[] =
+		"GET / HTTP/1.1\r\n"
+		"Host: 127.0.0.1:8080\r\n"
+		"If-None-Match: " TEST_STATIC_ETAG "\r\n"
+		"\r\n";
+	static const char expected_response[] =
+		"HTTP/1.1 304 Not Modified\r\n"
+		TEST_STATIC_ETAG_HEADER
+		"\r\n";
+	size_t offset = 0;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_HTTP_SERVER_STATIC_ETAG);
+
+	ret = zsock_send(client_fd, http1_request, strlen(http1_request), 0);
+	zassert_not_equal(ret, -1, "send() failed (%d)", errno);
+
+	memset(buf, 0, sizeof(buf));
+
+	test_read_data(&offset, sizeof(expected_response) - 1);
+	zassert_mem_equal(buf, expected_response, sizeof(expected_response) - 1,
+			  "Received data doesn't match expected response");
+}
+
 static void common_verify_http2_dynamic_post_request(const uint8_t *request,
 						     size_t request_len)
 {
@@ -257,7 +257,7 @@ static void test_hpack_verify_encode(const struct example_headers *example,
 		};
 		int ret;
 
-		ret = http_hpack_encode_header(test_buf, sizeof(test_buf), &hdr);
+		ret = http_hpack_encode_header(test_buf, sizeof(test_buf), &hdr, NULL);
 		zassert_equal(ret, example[i].encoded_len, "Wrong encoding length");
 		zassert_mem_equal(test_buf, example[i].encoded, ret,
 				  "Header wrongly decoded");
@@ -271,7 +271,8 @@ static void test_hpack_verify_decode(const struct example_headers *example,
 		struct http_hpack_header_buf hdr;
 		int ret;
 
-		ret = http_hpack_decode_header(example[i].encoded, example[i].encoded_len, &hdr);
+		ret = http_hpack_decode_header(example[i].encoded, example[i].encoded_len, &hdr,
+					       NULL);
 		zassert_equal(ret, example[i].encoded_len, "Wrong decoding length");
 		zassert_equal(hdr.name_len, strlen(example[i].name),
 			      "Wrong decoded header name length");
@@ -494,4 +495,188 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+struct example_header_block {
+	const char *encoded;
+	size_t encoded_len;
+	struct {
+		const char *name;
+		const char *value;
+	} headers[6];
+	int headers_count;
+	uint16_t table_size;
+};
+
+#define HEADER_BLOCK(_str) .encoded = _str, .encoded_len = sizeof(_str) - 1
+
+/* Examples from RFC7541, responses sharing a 256 bytes dynamic table. */
+static const struct example_header_block test_dynamic_responses[] = {
+	{
+		HEADER_BLOCK("\x48\x03" "302" "\x58\x07" "private"
+			     "\x61\x1d" "Mon, 21 Oct 2013 20:13:21 GMT"
+			     "\x6e\x17" "https://www.example.com"),
+		.headers = {
+			{ ":status", "302" },
+			{ "cache-control", "private" },
+			{ "date", "Mon, 21 Oct 2013 20:13:21 GMT" },
+			{ "location", "https://www.example.com" },
+		},
+		.headers_count = 4,
+		.table_size = 222,
+	},
+	{
+		HEADER_BLOCK("\x48\x03" "307" "\xc1\xc0\xbf"),
+		.headers = {
+			{ ":status", "307" },
+			{ "cache-control", "private" },
+			{ "date", "Mon, 21 Oct 2013 20:13:21 GMT" },
+			{ "location", "https://www.example.com" },
+		},
+		.headers_count = 4,
+		.table_size = 222,
+	},
+	{
+		HEADER_BLOCK("\x88\xc1\x61\x1d" "Mon, 21 Oct 2013 20:13:22 GMT"
+			     "\xc0\x5a\x04" "gzip" "\x77\x38"
+			     "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1"),
+		.headers = {
+			{ ":status", "200" },
+			{ "cache-control", "private" },
+			{ "date", "Mon, 21 Oct 2013 20:13:22 GMT" },
+			{ "location", "https://www.example.com" },
+			{ "content-encoding", "gzip" },
+			{ "set-cookie", "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1" },
+		},
+		.headers_count = 6,
+		.table_size = 215,
+	},
+};
+
+static struct http_hpack_table test_table;
+static struct http_hpack_table test_peer_table;
+
+static void test_hpack_verify_decode_block(const struct example_header_block *block,
+					   const uint8_t *buf, size_t len,
+					   struct http_hpack_table *table)
+{
+	for (int i = 0; i < block->headers_count; i++) {
+		struct http_hpack_header_buf hdr;
+		int ret;
+
+		ret = http_hpack_decode_header(buf, len, &hdr, table);
+		zassert_true(ret > 0, "Failed to decode header");
+		zassert_equal(hdr.name_len, strlen(block->headers[i].name),
+			      "Wrong decoded header name length");
+		zassert_equal(hdr.value_len, strlen(block->headers[i].value),
+			      "Wrong decoded header value length");
+		zassert_mem_equal(hdr.name, block->headers[i].name, hdr.name_len,
+				  "Header name wrongly decoded");
+		zassert_mem_equal(hdr.value, block->headers[i].value, hdr.value_len,
+				  "Header value wrongly decoded");
+
+		buf += ret;
+		len -= ret;
+	}
+
+	zassert_equal(len, 0, "Header block not fully decoded");
+	zassert_equal(table->size, block->table_size, "Wrong dynamic table size");
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_decode)
+{
+	http_hpack_table_init(&test_table, 256);
+
+	ARRAY_FOR_EACH(test_dynamic_responses, i) {
+		const struct example_header_block *block = &test_dynamic_responses[i];
+
+		test_hpack_verify_decode_block(block, (const uint8_t *)block->encoded,
+					       block->encoded_len, &test_table);
+	}
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_encode)
+{
+	http_hpack_table_init(&test_table, 256);
+	http_hpack_table_init(&test_peer_table, 256);
+
+	ARRAY_FOR_EACH(test_dynamic_responses, i) {
+		const struct example_header_block *block = &test_dynamic_responses[i];
+		size_t len = 0;
+
+		for (int j = 0; j < block->headers_count; j++) {
+			struct http_hpack_header_buf hdr = {
+				.name = block->headers[j].name,
+				.value = block->headers[j].value,
+				.name_len = strlen(block->headers[j].name),
+				.value_len = strlen(block->headers[j].value)
+			};
+			int ret;
+
+			ret = http_hpack_encode_header(test_buf + len, sizeof(test_buf) - len,
+						       &hdr, &test_table);
+			zassert_true(ret > 0, "Failed to encode header");
+
+			len += ret;
+		}
+
+		zassert_equal(test_table.size, block->table_size,
+			      "Wrong dynamic table size");
+
+		/* No Huffman savings, repeated headers are indexed. */
+		if (i == 1) {
+			zassert_equal(len, block->encoded_len, "Wrong encoding length");
+			zassert_mem_equal(test_buf, block->encoded, len,
+					  "Header block wrongly encoded");
+		}
+
+		test_hpack_verify_decode_block(block, test_buf, len, &test_peer_table);
+	}
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_size_update)
+{
+	static const uint8_t size_too_large[] = { 0x3f, 0xe1, 0x1f };
+	static const uint8_t size_zero[] = { 0x20 };
+	const struct example_header_block *block = &test_dynamic_responses[0];
+	struct http_hpack_header_buf hdr = {
+		.name = ":status",
+		.value = "200",
+		.name_len = strlen(":status"),
+		.value_len = strlen("200"),
+	};
+	int ret;
+
+	http_hpack_table_init(&test_table, 256);
+	test_hpack_verify_decode_block(block, (const uint8_t *)block->encoded,
+				       block->encoded_len, &test_table);
+
+	/* Decoder can't grow above the advertised size. */
+	ret = http_hpack_decode_header(size_too_large, sizeof(size_too_large),
+				       &hdr, &test_table);
+	zassert_equal(ret, -EBADMSG, "Size update should fail");
+
+	ret = http_hpack_decode_header(size_zero, sizeof(size_zero), &hdr,
+				       &test_table);
+	zassert_equal(ret, sizeof(size_zero), "Wrong decoding length");
+	zassert_equal(hdr.name_len, 0, "No header expected");
+	zassert_equal(test_table.size, 0, "Dynamic table not emptied");
+
+	/* Encoder signals a size change first in the next header block. */
+	hdr.name = ":status";
+	hdr.name_len = strlen(":status");
+	hdr.value = "200";
+	hdr.value_len = strlen("200");
+
+	http_hpack_table_init(&test_table, 0);
+	http_hpack_table_set_max_size(&test_table, 64);
+
+	ret = http_hpack_encode_header(test_buf, sizeof(test_buf), &hdr, &test_table);
+	zassert_equal(ret, 3, "Wrong encoding length");
+	zassert_mem_equal(test_buf, ((uint8_t []){ 0x3f, 0x21, 0x88 }), ret,
+			  "Size update wrongly encoded");
+
+	ret = http_hpack_encode_header(test_buf, sizeof(test_buf), &hdr, &test_table);
+	zassert_equal(ret, 1, "Wrong encoding length");
+	zassert_equal(test_buf[0], 0x88, "Header wrongly encoded");
+}
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
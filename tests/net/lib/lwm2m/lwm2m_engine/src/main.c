@@ -64,6 +64,22 @@ static int lwm2m_get_bool_custom_fake(const struct lwm2m_obj_path *path, bool *v
 	return 0;
 }
 
+#define NOTIFY_OBSERVERS 3
+
+/* Registry lock count at each notification, one lock per check_notifications() pass */
+static size_t notify_pass[NOTIFY_OBSERVERS];
+
+static int generate_notify_message_custom_fake(struct lwm2m_ctx *ctx, struct observe_node *obs,
+					       void *user_data)
+{
+	if (generate_notify_message_fake.call_count <= NOTIFY_OBSERVERS) {
+		notify_pass[generate_notify_message_fake.call_count - 1] =
+			lwm2m_registry_lock_fake.call_count;
+	}
+
+	return 0;
+}
+
 static void test_service(struct k_work *work)
 {
 	k_sleep(K_MSEC(10));
@@ -257,6 +273,70 @@ ZTEST(lwm2m_engine, test_check_notifications)
 		      "Next observe event not scheduled");
 }
 
+ZTEST(lwm2m_engine, test_coalesce_timestamp)
+{
+#if CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW > 0
+	const int64_t window = CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW;
+
+	zassert_equal(engine_observe_coalesce_timestamp(0), 0);
+	zassert_equal(engine_observe_coalesce_timestamp(1), window);
+	zassert_equal(engine_observe_coalesce_timestamp(window - 1), window);
+	zassert_equal(engine_observe_coalesce_timestamp(window), window);
+	zassert_equal(engine_observe_coalesce_timestamp(window + 1), 2 * window);
+	zassert_equal(engine_observe_coalesce_timestamp(100 * window + window / 2), 101 * window);
+#else
+	zassert_equal(engine_observe_coalesce_timestamp(0), 0);
+	zassert_equal(engine_observe_coalesce_timestamp(12345), 12345);
+#endif
+}
+
+ZTEST(lwm2m_engine, test_check_notifications_coalesced)
+{
+	int ret;
+	struct lwm2m_ctx ctx;
+	struct observe_node obs[NOTIFY_OBSERVERS];
+	int64_t window_start;
+
+	(void)memset(&ctx, 0x0, sizeof(ctx));
+	(void)memset(obs, 0x0, sizeof(obs));
+
+	ctx.sock_fd = -1;
+	ctx.load_credentials = NULL;
+	ctx.remote_addr.sa_family = AF_INET;
+	sys_slist_init(&ctx.observer);
+
+	/* Changes at different times of the same window */
+	window_start = engine_observe_coalesce_timestamp(k_uptime_get() + 1000);
+	for (int i = 0; i < NOTIFY_OBSERVERS; i++) {
+		int64_t changed = window_start + 1 + i * 10;
+
+		obs[i].last_timestamp = k_uptime_get();
+		obs[i].event_timestamp = engine_observe_coalesce_timestamp(changed);
+		sys_slist_append(&ctx.observer, &obs[i].node);
+	}
+
+	generate_notify_message_fake.custom_fake = generate_notify_message_custom_fake;
+	lwm2m_rd_client_is_registred_fake.return_val = true;
+	ret = lwm2m_engine_start(&ctx);
+	zassert_equal(ret, 0);
+	/* wait for socket receive thread */
+	k_sleep(K_MSEC(2000));
+	ret = lwm2m_engine_stop(&ctx);
+	zassert_equal(ret, 0);
+	zassert_equal(generate_notify_message_fake.call_count, NOTIFY_OBSERVERS,
+		      "Notify messages not generated");
+
+	for (int i = 1; i < NOTIFY_OBSERVERS; i++) {
+#if CONFIG_LWM2M_ENGINE_NOTIFY_COALESCE_WINDOW > 0
+		zassert_equal(notify_pass[i], notify_pass[0],
+			      "Observer %d not sent in the same pass", i);
+#else
+		zassert_true(notify_pass[i] > notify_pass[i - 1],
+			     "Observer %d sent in the same pass", i);
+#endif
+	}
+}
+
 ZTEST(lwm2m_engine, test_push_queued_buffers)
 {
 	int ret;
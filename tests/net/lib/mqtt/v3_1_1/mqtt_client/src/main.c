@@ -9,6 +9,7 @@
 #include <zephyr/misc/lorem_ipsum.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/mqtt.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/random/random.h>
 
 #include "mqtt_internal.h"
@@ -45,6 +46,8 @@ static struct mqtt_test_ctx {
 	const uint8_t *payload;
 } test_ctx;
 
+NET_BUF_POOL_DEFINE(publish_pool, 2, 16, 0, NULL);
+
 static const uint8_t payload_short[] = "Short payload";
 static const uint8_t payload_long[] = LOREM_IPSUM;
 
@@ -601,7 +604,21 @@ static void test_pingreq(void)
 	zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
 }
 
-static void test_publish(enum mqtt_qos qos)
+static void publish_param_init(struct mqtt_publish_param *param, enum mqtt_qos qos,
+			       uint16_t msg_id)
+{
+	param->message.topic.qos = qos;
+	param->message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
+	param->message.topic.topic.size =
+			strlen(param->message.topic.topic.utf8);
+	param->message.payload.data = (uint8_t *)test_ctx.payload;
+	param->message.payload.len = strlen(test_ctx.payload);
+	param->message_id = msg_id;
+	param->dup_flag = 0U;
+	param->retain_flag = 0U;
+}
+
+static void test_publish_common(enum mqtt_qos qos, bool use_net_buf)
 {
 	int ret;
 	struct mqtt_publish_param param;
@@ -611,17 +628,27 @@ static void test_publish(enum mqtt_qos qos)
 		test_ctx.msg_id = sys_rand16_get();
 	}
 
-	param.message.topic.qos = qos;
-	param.message.topic.topic.utf8 = (uint8_t *)get_mqtt_topic();
-	param.message.topic.topic.size =
-			strlen(param.message.topic.topic.utf8);
-	param.message.payload.data = (uint8_t *)test_ctx.payload;
-	param.message.payload.len = test_ctx.payload_left;
-	param.message_id = test_ctx.msg_id;
-	param.dup_flag = 0U;
-	param.retain_flag = 0U;
+	publish_param_init(&param, qos, test_ctx.msg_id);
+
+	if (use_net_buf) {
+		struct net_buf *head, *frag;
+		size_t half = test_ctx.payload_left / 2;
+
+		head = net_buf_alloc(&publish_pool, K_NO_WAIT);
+		frag = net_buf_alloc(&publish_pool, K_NO_WAIT);
+		zassert_not_null(head, "Failed to allocate net_buf");
+		zassert_not_null(frag, "Failed to allocate net_buf");
+
+		net_buf_add_mem(head, test_ctx.payload, half);
+		net_buf_add_mem(frag, test_ctx.payload + half, test_ctx.payload_left - half);
+		net_buf_frag_add(head, frag);
+
+		ret = mqtt_publish_net_buf(&client_ctx, &param, head);
+		net_buf_unref(head);
+	} else {
+		ret = mqtt_publish(&client_ctx, &param);
+	}
 
-	ret = mqtt_publish(&client_ctx, &param);
 	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
 	broker_process(MQTT_PKT_TYPE_PUBLISH);
 
@@ -638,6 +665,11 @@ static void test_publish(enum mqtt_qos qos)
 	}
 }
 
+static void test_publish(enum mqtt_qos qos)
+{
+	test_publish_common(qos, false);
+}
+
 static void test_subscribe(void)
 {
 	int ret;
@@ -751,6 +783,73 @@ ZTEST(mqtt_client, test_mqtt_publish_qos2)
 	test_disconnect();
 }
 
+ZTEST(mqtt_client, test_mqtt_publish_net_buf)
+{
+	test_ctx.payload = payload_short;
+
+	test_connect();
+	test_publish_common(MQTT_QOS_1_AT_LEAST_ONCE, true);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+	test_disconnect();
+}
+
+ZTEST(mqtt_client, test_mqtt_publish_inflight)
+{
+	static const uint16_t acked_ids[] = { 1, 2, 1 };
+	struct mqtt_publish_param param;
+	int ret;
+
+	if (CONFIG_MQTT_PUBLISH_INFLIGHT_MAX != 2) {
+		ztest_test_skip();
+	}
+
+	test_ctx.payload = payload_short;
+
+	test_connect();
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 1);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 2);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to publish (%d)", ret);
+
+	/* The in-flight window is full */
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 3);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EAGAIN, "Publish should wait for an ack (%d)", ret);
+
+	/* Message ID still in use */
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 1);
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_equal(ret, -EBUSY, "Message ID should be in flight (%d)", ret);
+
+	/* Retransmission of an in-flight message */
+	param.dup_flag = 1U;
+	ret = mqtt_publish(&client_ctx, &param);
+	zassert_ok(ret, "MQTT client failed to retransmit (%d)", ret);
+
+	ARRAY_FOR_EACH(acked_ids, i) {
+		broker_process(MQTT_PKT_TYPE_PUBLISH);
+	}
+
+	ARRAY_FOR_EACH(acked_ids, i) {
+		test_ctx.msg_id = acked_ids[i];
+		test_ctx.puback_handled = false;
+		client_wait(false);
+		ret = mqtt_input(&client_ctx);
+		zassert_ok(ret, "MQTT client input processing failed (%d)", ret);
+		zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+	}
+
+	test_ctx.msg_id = 3;
+	test_publish(MQTT_QOS_1_AT_LEAST_ONCE);
+	zassert_true(test_ctx.puback_handled, "MQTT client should receive puback");
+
+	test_disconnect();
+}
+
 ZTEST(mqtt_client, test_mqtt_subscribe)
 {
 	test_connect();
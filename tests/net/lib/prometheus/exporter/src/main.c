@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/prometheus/exporter.h>
+
+#define CHUNK_SIZE      128
+#define MAX_BUFFER_SIZE 4096
+
+K_MSGQ_DEFINE(test_msgq, sizeof(uint32_t), 4, 4);
+
+static char exposition[MAX_BUFFER_SIZE];
+
+static size_t format_all(size_t chunk_size)
+{
+	struct prometheus_exporter_ctx ctx;
+	size_t len = 0;
+	int ret;
+
+	prometheus_exporter_format_start(&ctx);
+
+	while (true) {
+		zassert_true(len + chunk_size <= sizeof(exposition), "Exposition too large");
+
+		ret = prometheus_exporter_format_next(&ctx, exposition + len, chunk_size);
+		zassert_true(ret >= 0, "Error formatting exposition chunk (%d)", ret);
+		zassert_true(ret < chunk_size, "Chunk overflows the buffer");
+		if (ret == 0) {
+			break;
+		}
+		len += ret;
+	}
+
+	return len;
+}
+
+/**
+ * @brief Test Prometheus system metrics exporter
+ * @details The test shall format the system metrics in small chunks and
+ * check that the message queue and CPU metrics are present.
+ */
+ZTEST(test_exporter, test_prometheus_exporter_chunked)
+{
+	char line[64];
+	uint32_t msg = 0;
+
+	zassert_ok(k_msgq_put(&test_msgq, &msg, K_NO_WAIT));
+
+	format_all(CHUNK_SIZE);
+
+	zassert_not_null(strstr(exposition, "# TYPE zephyr_msgq_used_msgs gauge\n"),
+			 "Message queue metric missing");
+
+	snprintk(line, sizeof(line), "zephyr_msgq_used_msgs{msgq=\"%p\"} 1\n", &test_msgq);
+	zassert_not_null(strstr(exposition, line), "Message queue usage missing");
+
+	snprintk(line, sizeof(line), "zephyr_msgq_max_msgs{msgq=\"%p\"} 4\n", &test_msgq);
+	zassert_not_null(strstr(exposition, line), "Message queue size missing");
+
+	zassert_not_null(strstr(exposition, "zephyr_cpu_busy_cycles_total{cpu=\"0\"} "),
+			 "CPU metric missing");
+}
+
+/**
+ * @brief Test Prometheus exporter with a too small buffer
+ * @details The test shall check that a buffer too small for a single line
+ * is reported as an error.
+ */
+ZTEST(test_exporter, test_prometheus_exporter_small_buffer)
+{
+	struct prometheus_exporter_ctx ctx;
+	char chunk[16];
+
+	prometheus_exporter_format_start(&ctx);
+
+	zassert_equal(prometheus_exporter_format_next(&ctx, chunk, sizeof(chunk)), -ENOMEM,
+		      "Line larger than the buffer not reported");
+}
+
+ZTEST_SUITE(test_exporter, NULL, NULL, NULL, NULL, NULL);
@@ -27,6 +27,24 @@ PROMETHEUS_COUNTER_DEFINE(test_counter_m, &test_counter_metric);
 
 PROMETHEUS_COLLECTOR_DEFINE(test_custom_collector);
 
+struct prometheus_metric test_chunked_metric = {
+	.type = PROMETHEUS_COUNTER,
+	.name = "test_chunked",
+	.description = "Test chunked counter",
+	.num_labels = 2,
+	.labels = {{
+		.key = "test",
+		.value = "first",
+	}, {
+		.key = "test",
+		.value = "second",
+	}},
+};
+
+PROMETHEUS_COUNTER_DEFINE(test_chunked_m, &test_chunked_metric);
+
+PROMETHEUS_COLLECTOR_DEFINE(test_chunked_collector);
+
 /**
  * @brief Test Prometheus formatter
  * @details The test shall increment the counter value by 1 and check if the
@@ -62,4 +80,45 @@ ZTEST(test_formatter, test_prometheus_formatter_simple)
 	zassert_equal(strcmp(formatted, exposed), 0, "Exposition format is not as expected");
 }
 
+/**
+ * @brief Test chunked Prometheus formatter
+ * @details The test shall format the collector in chunks that are too small
+ * for the whole exposition and check that the concatenated chunks match the
+ * output of the one-shot formatter.
+ */
+ZTEST(test_formatter, test_prometheus_formatter_chunked)
+{
+	int ret;
+	size_t next = 0;
+	size_t len = 0;
+	char chunk[48];
+	static char formatted[2 * MAX_BUFFER_SIZE];
+	static char expected[2 * MAX_BUFFER_SIZE];
+
+	/* the same metric twice makes two chunks with a buffer for one */
+	prometheus_collector_register_metric(&test_chunked_collector, test_chunked_m.base);
+	prometheus_collector_register_metric(&test_chunked_collector, test_chunked_m.base);
+
+	ret = prometheus_format_exposition(&test_chunked_collector, expected, sizeof(expected));
+	zassert_ok(ret, "Error formatting exposition data");
+
+	/* a single metric does not fit */
+	ret = prometheus_format_exposition_next(&test_chunked_collector, &next, chunk,
+						sizeof(chunk));
+	zassert_equal(ret, -ENOMEM, "Metric larger than the buffer not reported");
+
+	next = 0;
+	while (true) {
+		ret = prometheus_format_exposition_next(&test_chunked_collector, &next,
+							formatted + len, strlen(expected) / 2 + 1);
+		zassert_true(ret >= 0, "Error formatting exposition chunk");
+		if (ret == 0) {
+			break;
+		}
+		len += ret;
+	}
+
+	zassert_equal(strcmp(formatted, expected), 0, "Chunked exposition differs");
+}
+
 ZTEST_SUITE(test_formatter, NULL, NULL, NULL, NULL, NULL);
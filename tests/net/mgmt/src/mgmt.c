@@ -456,4 +456,46 @@ ZTEST(mgmt_fn_test_suite, test_mgmt_duplicate_handler)
 	net_mgmt_del_event_callback(&cb);
 }
 
+static k_tid_t direct_cb_thread;
+static int direct_cb_call_count;
+
+static void net_mgmt_direct_event_handler(struct net_mgmt_event_callback *cb,
+					  uint32_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(iface);
+	ARG_UNUSED(mgmt_event);
+
+	direct_cb_thread = k_current_get();
+	direct_cb_call_count++;
+}
+
+ZTEST(mgmt_fn_test_suite, test_mgmt_direct_handler)
+{
+	struct net_mgmt_event_callback cb;
+	struct net_mgmt_event_callback other_cb;
+
+	net_mgmt_init_event_callback(&cb, net_mgmt_direct_event_handler,
+				     NET_EVENT_IPV6_ADDR_ADD);
+	net_mgmt_add_direct_event_callback(&cb);
+
+	/* Listening to other events, must not be called */
+	net_mgmt_init_event_callback(&other_cb, net_mgmt_direct_event_handler,
+				     NET_EVENT_IF_UP);
+	net_mgmt_add_direct_event_callback(&other_cb);
+
+	net_mgmt_event_notify(NET_EVENT_IPV6_ADDR_ADD, NULL);
+
+	/* Called before the notification returns, from the notifying thread */
+	zassert_equal(direct_cb_call_count, 1, "Direct callback not called once");
+	zassert_equal(direct_cb_thread, k_current_get(), "Callback called from another thread");
+
+	net_mgmt_del_event_callback(&cb);
+	net_mgmt_del_event_callback(&other_cb);
+
+	net_mgmt_event_notify(NET_EVENT_IPV6_ADDR_ADD, NULL);
+
+	zassert_equal(direct_cb_call_count, 1, "Deleted direct callback called");
+}
+
 ZTEST_SUITE(mgmt_fn_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/ztest_assert.h>
 
 #include <zephyr/posix/fcntl.h>
+#include <zephyr/posix/sys/mman.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/ethernet.h>
 
@@ -594,4 +595,79 @@ ZTEST(socket_packet, test_raw_and_dgram_socket_recv)
 	zsock_close(sock3);
 }
 
+ZTEST(socket_packet, test_packet_rx_ring)
+{
+#if defined(CONFIG_NET_SOCKETS_PACKET_RX_RING) && defined(CONFIG_POSIX_MAPPED_FILES)
+	uint8_t data_to_send[] = { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
+	struct tpacket_req req = {
+		.tp_block_size = 512,
+		.tp_block_nr = 2,
+		.tp_frame_size = 256,
+		.tp_frame_nr = 4,
+	};
+	struct zsock_pollfd pfd;
+	struct tpacket_stats stats;
+	struct sockaddr_in sockaddr;
+	struct tpacket_hdr *hdr;
+	int ret, sock1, sock2, sock3, sock4;
+	socklen_t optlen;
+	uint8_t *ring;
+	ssize_t sent;
+
+	__test_packet_sockets(&sock1, &sock2);
+
+	ret = zsock_setsockopt(sock1, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+	zassert_equal(ret, 0, "Cannot set up the ring (%d)", -errno);
+
+	ret = zsock_setsockopt(sock1, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+	zassert_equal(ret, -1, "Ring set up twice");
+	zassert_equal(errno, EBUSY, "Unexpected errno (%d)", errno);
+
+	ring = mmap(NULL, req.tp_block_size * req.tp_block_nr,
+		    PROT_READ | PROT_WRITE, MAP_SHARED, sock1, 0);
+	zassert_not_equal(ring, MAP_FAILED, "Cannot map the ring (%d)", -errno);
+
+	sock3 = prepare_udp_socket(&sockaddr, DST_PORT);
+	sock4 = prepare_udp_socket(&sockaddr, SRC_PORT);
+	sockaddr.sin_port = htons(DST_PORT);
+
+	sent = zsock_sendto(sock4, data_to_send, sizeof(data_to_send),
+			    0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+	zassert_equal(sent, sizeof(data_to_send), "sendto failed");
+
+	pfd.fd = sock1;
+	pfd.events = ZSOCK_POLLIN;
+	ret = zsock_poll(&pfd, 1, 100);
+	zassert_equal(ret, 1, "Ring not readable (%d)", ret);
+
+	/* The packet is in the first frame, with its IP and UDP headers */
+	hdr = (struct tpacket_hdr *)ring;
+	zassert_true(hdr->tp_status & TP_STATUS_USER, "Frame not filled");
+	zassert_equal(hdr->tp_len, sizeof(data_to_send) + HDR_SIZE,
+		      "Unexpected length (%u)", hdr->tp_len);
+	zassert_equal(hdr->tp_snaplen, hdr->tp_len, "Packet truncated");
+	zassert_mem_equal(ring + hdr->tp_mac + HDR_SIZE, data_to_send,
+			  sizeof(data_to_send), "Sent and received buffers do not match");
+
+	/* Hand the frame back */
+	hdr->tp_status = TP_STATUS_KERNEL;
+
+	ret = zsock_poll(&pfd, 1, 0);
+	zassert_equal(ret, 0, "Ring still readable");
+
+	optlen = sizeof(stats);
+	ret = zsock_getsockopt(sock1, SOL_PACKET, PACKET_STATISTICS, &stats, &optlen);
+	zassert_equal(ret, 0, "Cannot read statistics (%d)", -errno);
+	zassert_equal(stats.tp_packets, 1, "Unexpected packet count (%u)", stats.tp_packets);
+	zassert_equal(stats.tp_drops, 0, "Unexpected drop count (%u)", stats.tp_drops);
+
+	zsock_close(sock1);
+	zsock_close(sock2);
+	zsock_close(sock3);
+	zsock_close(sock4);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(socket_packet, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/zvfs/epoll.h>
+
+#include "../../socket_helpers.h"
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+ZTEST(net_socket_epoll, test_epoll)
+{
+	struct zvfs_epoll_event event;
+	struct zvfs_epoll_event events[2];
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	int c_sock;
+	int s_sock;
+	int epfd;
+	char buf[10];
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = zsock_bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = zsock_connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	event.events = ZVFS_EPOLLIN;
+	event.data.u32 = 42;
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, s_sock, &event);
+	zassert_equal(res, 0, "epoll_ctl add failed (%d)", errno);
+
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, s_sock, &event);
+	zassert_equal(res, -1, "double add should fail");
+	zassert_equal(errno, EEXIST, "unexpected errno (%d)", errno);
+
+	/* Nothing received yet */
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "unexpected event");
+
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	zassert_equal(res, 0, "unexpected event");
+
+	res = zsock_send(c_sock, TEST_STR_SMALL, sizeof(TEST_STR_SMALL) - 1, 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "send failed");
+
+	/* The socket puts itself on the ready list */
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 1000);
+	zassert_equal(res, 1, "no event (%d)", res);
+	zassert_equal(events[0].events, ZVFS_EPOLLIN, "unexpected events");
+	zassert_equal(events[0].data.u32, 42, "unexpected data");
+
+	/* Level-triggered, still ready until the data is read */
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "no event (%d)", res);
+
+	res = zsock_recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "recv failed");
+
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "unexpected event");
+
+	/* Output events are polled */
+	event.events = ZVFS_EPOLLOUT;
+	event.data.u32 = 43;
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, s_sock, &event);
+	zassert_equal(res, 0, "epoll_ctl mod failed (%d)", errno);
+
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "no event (%d)", res);
+	zassert_equal(events[0].events, ZVFS_EPOLLOUT, "unexpected events");
+	zassert_equal(events[0].data.u32, 43, "unexpected data");
+
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl del failed (%d)", errno);
+
+	res = zvfs_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "unexpected event");
+
+	/* A closed socket leaves the interest list */
+	event.events = ZVFS_EPOLLIN;
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, s_sock, &event);
+	zassert_equal(res, 0, "epoll_ctl add failed (%d)", errno);
+
+	res = zsock_close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "socket should have been removed");
+	zassert_equal(errno, ENOENT, "unexpected errno (%d)", errno);
+
+	res = zsock_close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
@@ -2531,6 +2531,131 @@ ZTEST(net_socket_udp, test_37_ipv6_src_addr_select)
 				       &my_addr3, &dest);
 }
 
+#define MMSG_COUNT 3
+
+static ZTEST_BMEM char mmsg_rx_buf[MMSG_COUNT + 1][sizeof(TEST_STR_SMALL)];
+
+ZTEST_USER(net_socket_udp, test_38_v4_sendmmsg_recvmmsg)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct mmsghdr msgvec[MMSG_COUNT + 1];
+	struct iovec tx_io[MMSG_COUNT];
+	struct iovec rx_io[MMSG_COUNT + 1];
+	int i;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(msgvec, 0, sizeof(msgvec));
+
+	for (i = 0; i < MMSG_COUNT; i++) {
+		/* Each datagram is one byte longer than the previous one */
+		tx_io[i].iov_base = TEST_STR_SMALL;
+		tx_io[i].iov_len = i + 1;
+
+		msgvec[i].msg_hdr.msg_iov = &tx_io[i];
+		msgvec[i].msg_hdr.msg_iovlen = 1;
+		msgvec[i].msg_hdr.msg_name = &server_addr;
+		msgvec[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgvec, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", -errno);
+
+	for (i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgvec[i].msg_len, i + 1, "invalid msg_len");
+	}
+
+	/* Let the loopback deliver all the datagrams */
+	k_msleep(100);
+
+	memset(msgvec, 0, sizeof(msgvec));
+
+	for (i = 0; i < MMSG_COUNT + 1; i++) {
+		rx_io[i].iov_base = mmsg_rx_buf[i];
+		rx_io[i].iov_len = sizeof(mmsg_rx_buf[i]);
+
+		msgvec[i].msg_hdr.msg_iov = &rx_io[i];
+		msgvec[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	/* Only the queued datagrams are returned, the call does not wait
+	 * for the last one.
+	 */
+	rv = zsock_recvmmsg(server_sock, msgvec, MMSG_COUNT + 1, 0);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", -errno);
+
+	for (i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgvec[i].msg_len, i + 1, "invalid msg_len");
+		zassert_mem_equal(mmsg_rx_buf[i], TEST_STR_SMALL, i + 1,
+				  "invalid data");
+	}
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_39_v4_recv_pkt)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in src_addr;
+	socklen_t addrlen = sizeof(src_addr);
+	struct net_pkt *pkt;
+	ssize_t len;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	len = zsock_recv_pkt(server_sock, &pkt, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(len, -1, "recv_pkt should fail");
+	zassert_equal(errno, EAGAIN, "unexpected errno (%d)", errno);
+	zassert_is_null(pkt, "no packet expected");
+
+	rv = zsock_sendto(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed");
+
+	len = zsock_recv_pkt(server_sock, &pkt, 0, (struct sockaddr *)&src_addr,
+			     &addrlen);
+	zassert_equal(len, STRLEN(TEST_STR2), "invalid length (%zd)", len);
+	zassert_not_null(pkt, "no packet");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "invalid addrlen");
+	zassert_equal(src_addr.sin_port, htons(CLIENT_PORT), "invalid source port");
+
+	/* The packet cursor points to the payload */
+	zassert_ok(net_pkt_read(pkt, rx_buf, len), "cannot read packet");
+	zassert_mem_equal(rx_buf, TEST_STR2, len, "invalid data");
+
+	zsock_recv_pkt_release(pkt);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -10,6 +10,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_WEBSOCKET_LOG_LEVEL);
 #include <zephyr/ztest_assert.h>
 
 #include <zephyr/misc/lorem_ipsum.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/websocket.h>
@@ -379,6 +380,40 @@ ZTEST(net_websocket, test_send_and_recv_lorem_ipsum)
 	zvfs_free_fd(fd);
 }
 
+NET_BUF_POOL_DEFINE(test_net_buf_pool, 1, sizeof(lorem_ipsum), 0, NULL);
+
+ZTEST(net_websocket, test_send_net_buf_masked_in_place)
+{
+	static struct websocket_context ctx;
+	struct net_buf *buf;
+	int fd, ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.recv_buf.buf = temp_recv_buf;
+	ctx.recv_buf.size = sizeof(temp_recv_buf);
+
+	test_msg_len = sizeof(lorem_ipsum) - 1;
+
+	buf = net_buf_alloc(&test_net_buf_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Cannot allocate buffer");
+	net_buf_add_mem(buf, lorem_ipsum, test_msg_len);
+
+	fd = test_fd_alloc(&ctx);
+	ret = websocket_send_net_buf(fd, buf, WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+				     SYS_FOREVER_MS);
+	zassert_equal(ret, test_msg_len,
+		      "Should have sent %zd bytes but sent %d instead",
+		      test_msg_len, ret);
+
+	/* The payload was masked in the buffer itself */
+	zassert_true(memcmp(buf->data, lorem_ipsum, test_msg_len) != 0,
+		     "Buffer was not masked in place");
+
+	net_buf_unref(buf);
+	zvfs_free_fd(fd);
+}
+
 ZTEST(net_websocket, test_recv_two_large_split_msg)
 {
 	static struct websocket_context ctx;
@@ -276,6 +276,79 @@ ZTEST(mqueue, test_mqueue_notify_errors)
 	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
 }
 
+ZTEST(mqueue, test_mqueue_priority)
+{
+	mqd_t mqd;
+	struct mq_attr attrs = {
+		.mq_msgsize = MESSAGE_SIZE,
+		.mq_maxmsg = MESG_COUNT_PERMQ,
+	};
+	static const unsigned int prios[MESG_COUNT_PERMQ] = {1, 5, 1, 0};
+	/* Indexes of the messages in the expected receive order */
+	static const int order[MESG_COUNT_PERMQ] = {1, 0, 2, 3};
+	unsigned int prio;
+	char msg[MESSAGE_SIZE];
+
+	mqd = mq_open(queue, O_RDWR | O_CREAT | O_NONBLOCK, 0777, &attrs);
+	zassert_not_equal(mqd, (mqd_t)-1, "Unable to open message queue");
+
+	zassert_not_ok(mq_send(mqd, send_data, MESSAGE_SIZE, CONFIG_POSIX_MQ_PRIO_MAX));
+	zassert_equal(errno, EINVAL);
+
+	for (int i = 0; i < MESG_COUNT_PERMQ; i++) {
+		msg[0] = (char)i;
+		zassert_ok(mq_send(mqd, msg, 1, prios[i]), "Unable to send message %d", i);
+	}
+
+	zassert_not_ok(mq_send(mqd, msg, 1, 0), "Queue should be full");
+	zassert_equal(errno, EAGAIN);
+
+	for (int i = 0; i < MESG_COUNT_PERMQ; i++) {
+		zassert_equal(mq_receive(mqd, msg, MESSAGE_SIZE, &prio), 1);
+		zassert_equal(msg[0], order[i], "Message %d received out of order", i);
+		zassert_equal(prio, prios[order[i]]);
+	}
+
+	zassert_not_ok(mq_receive(mqd, msg, MESSAGE_SIZE, NULL), "Queue should be empty");
+	zassert_equal(errno, EAGAIN);
+
+	zassert_ok(mq_close(mqd), "Unable to close message queue descriptor.");
+	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
+}
+
+ZTEST(mqueue, test_mqueue_borrow)
+{
+	mqd_t mqd;
+	struct mq_attr attrs = {
+		.mq_msgsize = MESSAGE_SIZE,
+		.mq_maxmsg = 1,
+	};
+	const char *msg;
+	unsigned int prio;
+
+	mqd = mq_open(queue, O_RDWR | O_CREAT | O_NONBLOCK, 0777, &attrs);
+	zassert_not_equal(mqd, (mqd_t)-1, "Unable to open message queue");
+
+	zassert_ok(mq_send(mqd, send_data, sizeof(send_data), 3), "Unable to send message");
+
+	zassert_equal(mq_borrow_np(mqd, &msg, &prio, NULL), sizeof(send_data));
+	zassert_equal(prio, 3);
+	zassert_mem_equal(msg, send_data, sizeof(send_data));
+
+	/* The borrowed slot is not available to senders */
+	zassert_not_ok(mq_send(mqd, send_data, sizeof(send_data), 0), "Queue should be full");
+	zassert_equal(errno, EAGAIN);
+
+	zassert_not_ok(mq_release_np(mqd, msg + 1), "Invalid message should be rejected");
+	zassert_equal(errno, EINVAL);
+
+	zassert_ok(mq_release_np(mqd, msg), "Unable to release message");
+	zassert_ok(mq_send(mqd, send_data, sizeof(send_data), 0), "Unable to send message");
+
+	zassert_ok(mq_close(mqd), "Unable to close message queue descriptor.");
+	zassert_ok(mq_unlink(queue), "Unable to unlink queue");
+}
+
 static void before(void *arg)
 {
 	ARG_UNUSED(arg);
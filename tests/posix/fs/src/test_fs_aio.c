@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/fcntl.h>
+#include <zephyr/posix/unistd.h>
+#include "test_fs.h"
+
+#define TEST_AIO_FILE FATFS_MNTP "/aio.dat"
+
+static const char aio_data[] = "0123456789abcdef";
+static int aio_fd = -1;
+static K_SEM_DEFINE(aio_done, 0, 1);
+
+static void before_fn(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	aio_fd = open(TEST_AIO_FILE, O_CREAT | O_RDWR, 0660);
+	zassert_true(aio_fd >= 0, "Failed creating test file");
+}
+
+static void after_fn(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	zassert_ok(close(aio_fd));
+	zassert_ok(unlink(TEST_AIO_FILE));
+}
+
+static void aio_wait(struct aiocb *cb)
+{
+	const struct aiocb *const list[] = {cb};
+
+	while (aio_error(cb) == EINPROGRESS) {
+		zassert_ok(aio_suspend(list, 1, NULL));
+	}
+}
+
+static void aio_notify(union sigval val)
+{
+	*(int *)val.sival_ptr += 1;
+	k_sem_give(&aio_done);
+}
+
+ZTEST_SUITE(posix_fs_aio_test, NULL, test_mount, before_fn, after_fn, test_unmount);
+
+/**
+ * @brief Test asynchronous writes and reads at an offset
+ */
+ZTEST(posix_fs_aio_test, test_fs_aio_write_read)
+{
+	char buf[sizeof(aio_data)] = {0};
+	struct aiocb cb = {
+		.aio_fildes = aio_fd,
+		.aio_buf = (void *)aio_data,
+		.aio_nbytes = sizeof(aio_data),
+		.aio_sigevent.sigev_notify = SIGEV_NONE,
+	};
+
+	zassert_ok(aio_write(&cb));
+	aio_wait(&cb);
+	zassert_ok(aio_error(&cb));
+	zassert_equal(aio_return(&cb), sizeof(aio_data));
+
+	cb.aio_buf = buf;
+	cb.aio_offset = 4;
+	cb.aio_nbytes = sizeof(aio_data) - 4;
+	zassert_ok(aio_read(&cb));
+	aio_wait(&cb);
+	zassert_ok(aio_error(&cb));
+	zassert_equal(aio_return(&cb), sizeof(aio_data) - 4);
+	zassert_mem_equal(buf, &aio_data[4], sizeof(aio_data) - 4);
+
+	cb.aio_buf = NULL;
+	zassert_ok(aio_fsync(0, &cb));
+	aio_wait(&cb);
+	zassert_equal(aio_return(&cb), 0);
+}
+
+/**
+ * @brief Test list I/O in both modes and the list completion notification
+ */
+ZTEST(posix_fs_aio_test, test_fs_lio_listio)
+{
+	char buf[sizeof(aio_data)] = {0};
+	struct aiocb cbs[2] = {
+		{
+			.aio_fildes = aio_fd,
+			.aio_buf = (void *)&aio_data[8],
+			.aio_nbytes = 8,
+			.aio_offset = 8,
+			.aio_lio_opcode = LIO_WRITE,
+		},
+		{
+			.aio_fildes = aio_fd,
+			.aio_buf = (void *)aio_data,
+			.aio_nbytes = 8,
+			.aio_lio_opcode = LIO_WRITE,
+		},
+	};
+	struct aiocb *list[] = {&cbs[0], &cbs[1]};
+	int notified = 0;
+	struct sigevent sig = {
+		.sigev_notify = SIGEV_THREAD,
+		.sigev_notify_function = aio_notify,
+		.sigev_value.sival_ptr = &notified,
+	};
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL));
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		zassert_equal(aio_return(&cbs[i]), 8);
+	}
+
+	cbs[0].aio_buf = &buf[8];
+	cbs[0].aio_lio_opcode = LIO_READ;
+	cbs[1].aio_buf = buf;
+	cbs[1].aio_lio_opcode = LIO_READ;
+	zassert_ok(lio_listio(LIO_NOWAIT, list, ARRAY_SIZE(list), &sig));
+	zassert_ok(k_sem_take(&aio_done, K_SECONDS(1)));
+	zassert_equal(notified, 1);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cbs); i++) {
+		zassert_ok(aio_error(&cbs[i]));
+		zassert_equal(aio_return(&cbs[i]), 8);
+	}
+	zassert_mem_equal(buf, aio_data, 16);
+}
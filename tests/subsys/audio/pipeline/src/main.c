@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/audio/pipeline.h>
+
+#define SAMPLES    16
+#define BLOCK_SIZE (SAMPLES * sizeof(int16_t))
+#define DEPTH      2
+#define BLOCK_US   1000
+
+K_MEM_SLAB_DEFINE_STATIC(src_slab, BLOCK_SIZE, 4, 4);
+K_MEM_SLAB_DEFINE_STATIC(out_slab, BLOCK_SIZE, 4, 4);
+
+static int16_t next_value;
+static int sink_blocks;
+static int16_t sink_first[DEPTH + 4];
+static void *sink_data[DEPTH + 4];
+static bool fail_gain;
+
+static int source_fn(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	int16_t *samples;
+
+	zassert_is_null(block->data);
+
+	if (k_mem_slab_alloc(&src_slab, &block->data, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+
+	samples = block->data;
+	for (int i = 0; i < SAMPLES; i++) {
+		samples[i] = next_value;
+	}
+
+	next_value++;
+	block->size = BLOCK_SIZE;
+	block->slab = &src_slab;
+
+	return 0;
+}
+
+/* In place */
+static int gain_fn(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	int16_t *samples = block->data;
+
+	if (fail_gain) {
+		return -EIO;
+	}
+
+	for (int i = 0; i < SAMPLES; i++) {
+		samples[i] *= 2;
+	}
+
+	return 0;
+}
+
+/* Replaces the block */
+static int copy_fn(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	void *out;
+
+	if (k_mem_slab_alloc(&out_slab, &out, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+
+	memcpy(out, block->data, block->size);
+	k_mem_slab_free(block->slab, block->data);
+	block->data = out;
+	block->slab = &out_slab;
+
+	return 0;
+}
+
+/* Keeps every other block, the pipeline frees the others */
+static int sink_fn(struct audio_pipeline_stage *stage, struct audio_block *block)
+{
+	zassert_true(sink_blocks < ARRAY_SIZE(sink_first));
+
+	sink_first[sink_blocks] = *(int16_t *)block->data;
+	if (sink_blocks % 2 == 0) {
+		sink_data[sink_blocks] = block->data;
+		block->data = NULL;
+	}
+
+	sink_blocks++;
+
+	return 0;
+}
+
+static struct audio_pipeline_stage source = AUDIO_PIPELINE_STAGE_INIT("source", source_fn, NULL);
+static struct audio_pipeline_stage gain = AUDIO_PIPELINE_STAGE_INIT("gain", gain_fn, NULL);
+static struct audio_pipeline_stage copy = AUDIO_PIPELINE_STAGE_INIT("copy", copy_fn, NULL);
+static struct audio_pipeline_stage sink = AUDIO_PIPELINE_STAGE_INIT("sink", sink_fn, NULL);
+
+AUDIO_PIPELINE_DEFINE(pipeline, &source, &sink, DEPTH, BLOCK_US, &gain, &copy);
+
+static void release_sink_blocks(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(sink_data); i++) {
+		if (sink_data[i] != NULL) {
+			k_mem_slab_free(&out_slab, sink_data[i]);
+			sink_data[i] = NULL;
+		}
+	}
+}
+
+static void pipeline_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	next_value = 1;
+	sink_blocks = 0;
+	fail_gain = false;
+	audio_pipeline_stats_reset(&pipeline);
+}
+
+static void pipeline_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	release_sink_blocks();
+	zassert_equal(k_mem_slab_num_used_get(&src_slab), 0, "source block leaked");
+	zassert_equal(k_mem_slab_num_used_get(&out_slab), 0, "output block leaked");
+}
+
+ZTEST(audio_pipeline, test_prime)
+{
+	zassert_ok(audio_pipeline_prime(&pipeline, &out_slab, BLOCK_SIZE));
+	zassert_equal(sink_blocks, DEPTH);
+
+	for (int i = 0; i < DEPTH; i++) {
+		zassert_equal(sink_first[i], 0, "priming block not silent");
+	}
+
+	zassert_equal(sink.stats.blocks, 0, "priming counted as processing");
+}
+
+ZTEST(audio_pipeline, test_process)
+{
+	for (int i = 0; i < 4; i++) {
+		zassert_ok(audio_pipeline_process(&pipeline));
+		zassert_equal(sink_first[i], 2 * (i + 1));
+	}
+
+	zassert_equal(pipeline.stats.blocks, 4);
+	zassert_equal(pipeline.stats.dropped, 0);
+	zassert_equal(source.stats.blocks, 4);
+	zassert_equal(gain.stats.blocks, 4);
+	zassert_equal(copy.stats.blocks, 4);
+	zassert_equal(sink.stats.blocks, 4);
+	zassert_true(gain.stats.max_cycles >= gain.stats.last_cycles);
+
+	/* Capture of one block plus the blocks queued at the sink */
+	zassert_true(pipeline.stats.last_us >= (DEPTH + 1) * BLOCK_US);
+	zassert_true(pipeline.stats.max_us >= pipeline.stats.last_us);
+}
+
+ZTEST(audio_pipeline, test_drop)
+{
+	fail_gain = true;
+	zassert_equal(audio_pipeline_process(&pipeline), -EIO);
+
+	zassert_equal(sink_blocks, 0);
+	zassert_equal(gain.stats.errors, 1);
+	zassert_equal(copy.stats.blocks, 0);
+	zassert_equal(pipeline.stats.dropped, 1);
+	zassert_equal(pipeline.stats.blocks, 0);
+}
+
+ZTEST_SUITE(audio_pipeline, NULL, NULL, pipeline_before, pipeline_after, NULL);
@@ -324,6 +324,35 @@ ZTEST(isotp_implementation, test_send_receive_single_block)
 	isotp_unbind(&recv_ctx);
 }
 
+ZTEST(isotp_implementation, test_send_receive_user_buf)
+{
+	/* larger than the net_buf pool, which is not used */
+	static uint8_t msg_buf[CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE + 100];
+	const size_t data_size = sizeof(msg_buf);
+	int ret, i;
+
+	ret = isotp_bind_buf(&recv_ctx, can_dev, &rx_addr, &tx_addr, &fc_opts,
+			     msg_buf, sizeof(msg_buf), K_NO_WAIT);
+	zassert_equal(ret, 0, "Binding failed (%d)", ret);
+
+	send_sf(can_dev);
+	ret = isotp_recv_buf(&recv_ctx, K_MSEC(1000));
+	zassert_equal(ret, DATA_SIZE_SF, "recv returned %d", ret);
+	check_data(msg_buf, random_data, DATA_SIZE_SF);
+
+	for (i = 0; i < NUMBER_OF_REPETITIONS; i++) {
+		send_test_data(can_dev, random_data, data_size);
+		ret = isotp_recv_buf(&recv_ctx, K_MSEC(1000));
+		zassert_equal(ret, data_size, "recv returned %d", ret);
+		check_data(msg_buf, random_data, data_size);
+	}
+
+	ret = isotp_recv_buf(&recv_ctx, K_MSEC(50));
+	zassert_equal(ret, ISOTP_RECV_TIMEOUT, "Expected timeout but got %d", ret);
+
+	isotp_unbind(&recv_ctx);
+}
+
 ZTEST(isotp_implementation, test_bind_unbind)
 {
 	int ret, i;
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+#include <zephyr/ztest.h>
+#include <zephyr/dsp/filtering.h>
+#include <zephyr/dsp/transform.h>
+
+#define NUM_TAPS   8
+#define BLOCK_SIZE 16
+#define LENGTH     64
+#define FFT_LEN    256
+
+/* Time reversed, b[0] = 1/8 ... b[7] = 8/8 */
+static const q15_t fir_coeffs_q15[NUM_TAPS] = {
+	0x7fff, 0x7000, 0x6000, 0x5000, 0x4000, 0x3000, 0x2000, 0x1000,
+};
+
+ZTEST(zdsp_filtering, test_fir_q15_impulse)
+{
+	q15_t state[ZDSP_FIR_STATE_LEN(NUM_TAPS, BLOCK_SIZE)] = {0};
+	struct zdsp_fir_q15 fir = {
+		.num_taps = NUM_TAPS,
+		.state = state,
+		.coeffs = fir_coeffs_q15,
+	};
+	q15_t src[LENGTH] = {0};
+	q15_t dst[LENGTH];
+
+	/* Impulse across a block boundary, to check the state handling */
+	src[BLOCK_SIZE - 2] = 0x7fff;
+
+	for (int i = 0; i < LENGTH; i += BLOCK_SIZE) {
+		zdsp_fir_q15(&fir, &src[i], &dst[i], BLOCK_SIZE);
+	}
+
+	for (int n = 0; n < LENGTH; n++) {
+		int k = n - (BLOCK_SIZE - 2);
+		q15_t expected = 0;
+
+		if (k >= 0 && k < NUM_TAPS) {
+			expected = ((q31_t)fir_coeffs_q15[NUM_TAPS - 1 - k] * 0x7fff) >> 15;
+		}
+
+		zassert_within(dst[n], expected, 1, "sample %d: %d != %d", n, dst[n], expected);
+	}
+}
+
+ZTEST(zdsp_filtering, test_fir_f32_moving_average)
+{
+	static const float32_t coeffs[NUM_TAPS] = {
+		0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f,
+	};
+	float32_t state[ZDSP_FIR_STATE_LEN(NUM_TAPS, BLOCK_SIZE)] = {0};
+	struct zdsp_fir_f32 fir = {
+		.num_taps = NUM_TAPS,
+		.state = state,
+		.coeffs = coeffs,
+	};
+	float32_t buf[LENGTH];
+
+	for (int i = 0; i < LENGTH; i++) {
+		buf[i] = (float32_t)i;
+	}
+
+	/* In place */
+	for (int i = 0; i < LENGTH; i += BLOCK_SIZE) {
+		zdsp_fir_f32(&fir, &buf[i], &buf[i], BLOCK_SIZE);
+	}
+
+	for (int n = NUM_TAPS - 1; n < LENGTH; n++) {
+		zassert_within(buf[n], n - 3.5f, 1e-4f, "sample %d: %f", n, (double)buf[n]);
+	}
+}
+
+ZTEST(zdsp_filtering, test_biquad_df2t_f32)
+{
+	/* One pole low pass y[n] = 0.5 * x[n] + 0.5 * y[n-1], twice */
+	static const float32_t coeffs[10] = {
+		0.5f, 0.0f, 0.0f, 0.5f, 0.0f,
+		0.5f, 0.0f, 0.0f, 0.5f, 0.0f,
+	};
+	float32_t state[4] = {0};
+	struct zdsp_biquad_df2t_f32 biquad = {
+		.num_stages = 2,
+		.state = state,
+		.coeffs = coeffs,
+	};
+	float32_t src[LENGTH];
+	float32_t dst[LENGTH];
+	float32_t y1 = 0.0f, y2 = 0.0f;
+
+	for (int i = 0; i < LENGTH; i++) {
+		src[i] = (i & 4) != 0 ? 1.0f : -1.0f;
+	}
+
+	zdsp_biquad_df2t_f32(&biquad, src, dst, LENGTH / 2);
+	zdsp_biquad_df2t_f32(&biquad, &src[LENGTH / 2], &dst[LENGTH / 2], LENGTH / 2);
+
+	for (int n = 0; n < LENGTH; n++) {
+		y1 = 0.5f * src[n] + 0.5f * y1;
+		y2 = 0.5f * y1 + 0.5f * y2;
+		zassert_within(dst[n], y2, 1e-5f, "sample %d: %f != %f", n, (double)dst[n],
+			       (double)y2);
+	}
+}
+
+ZTEST(zdsp_filtering, test_biquad_df1_q31)
+{
+	/* Same filter in Q31, single stage, no post shift */
+	static const q31_t coeffs[5] = {0x40000000, 0, 0, 0x40000000, 0};
+	q31_t state[4] = {0};
+	struct zdsp_biquad_df1_q31 biquad = {
+		.num_stages = 1,
+		.post_shift = 0,
+		.state = state,
+		.coeffs = coeffs,
+	};
+	q31_t src[LENGTH];
+	q31_t dst[LENGTH];
+	q31_t y = 0;
+
+	for (int i = 0; i < LENGTH; i++) {
+		src[i] = (i & 4) != 0 ? 0x20000000 : -0x20000000;
+	}
+
+	zdsp_biquad_df1_q31(&biquad, src, dst, LENGTH);
+
+	for (int n = 0; n < LENGTH; n++) {
+		y = (q31_t)(((q63_t)0x40000000 * src[n] + (q63_t)0x40000000 * y) >> 31);
+		zassert_within(dst[n], y, 2, "sample %d: %d != %d", n, dst[n], y);
+	}
+}
+
+ZTEST(zdsp_filtering, test_cfft_f32)
+{
+	static float32_t buf[2 * FFT_LEN];
+	const int bin = 5;
+
+	/* Complex exponential at the given bin */
+	for (int i = 0; i < FFT_LEN; i++) {
+		buf[2 * i] = cosf(2.0f * (float32_t)M_PI * bin * i / FFT_LEN);
+		buf[2 * i + 1] = sinf(2.0f * (float32_t)M_PI * bin * i / FFT_LEN);
+	}
+
+	zassert_ok(zdsp_cfft_f32(buf, FFT_LEN, false));
+
+	for (int k = 0; k < FFT_LEN; k++) {
+		float32_t expected = k == bin ? FFT_LEN : 0.0f;
+
+		zassert_within(buf[2 * k], expected, 1e-2f, "bin %d: %f", k, (double)buf[2 * k]);
+		zassert_within(buf[2 * k + 1], 0.0f, 1e-2f, "bin %d: %f", k,
+			       (double)buf[2 * k + 1]);
+	}
+
+	zassert_ok(zdsp_cfft_f32(buf, FFT_LEN, true));
+
+	for (int i = 0; i < FFT_LEN; i++) {
+		zassert_within(buf[2 * i], cosf(2.0f * (float32_t)M_PI * bin * i / FFT_LEN), 1e-4f);
+	}
+
+	zassert_equal(zdsp_cfft_f32(buf, 100, false), -EINVAL);
+}
+
+ZTEST_SUITE(zdsp_filtering, NULL, NULL, NULL, NULL, NULL);
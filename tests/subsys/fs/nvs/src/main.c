@@ -99,6 +99,16 @@ static void after(void *data)
 
 ZTEST_SUITE(nvs, NULL, setup, before, after, NULL);
 
+/* Skip the tests that expect a sector to be closed only when it is full */
+static void skip_if_sector_not_filled(void)
+{
+	Z_TEST_SKIP_IFDEF(CONFIG_NVS_MOUNT_CHECKPOINT);
+
+	if (CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0) {
+		ztest_test_skip();
+	}
+}
+
 ZTEST_F(nvs, test_nvs_mount)
 {
 	int err;
@@ -359,6 +369,8 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 	/* 125th write will trigger 4st GC. */
 	const uint16_t max_writes_4 = 51 + 25 + 25 + 25;
 
+	skip_if_sector_not_filled();
+
 	fixture->fs.sector_count = 3;
 
 	err = nvs_mount(&fixture->fs);
@@ -475,6 +487,8 @@ ZTEST_F(nvs, test_nvs_corrupted_sector_close_operation)
 	/* 25th write will trigger GC. */
 	const uint16_t max_writes = 26;
 
+	skip_if_sector_not_filled();
+
 	/* Get the address of simulator parameters. */
 	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find,
 		   &flash_max_write_calls);
@@ -863,6 +877,8 @@ ZTEST_F(nvs, test_nvs_cache_gc)
 	size_t num;
 	uint16_t data = 0;
 
+	skip_if_sector_not_filled();
+
 	fixture->fs.sector_count = 3;
 	err = nvs_mount(&fixture->fs);
 	zassert_true(err == 0, "nvs_mount call failure: %d", err);
@@ -959,3 +975,92 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+/*
+ * Test that the lookup cache restored from the mount checkpoint matches the
+ * cache before the restart.
+ */
+ZTEST_F(nvs, test_nvs_mount_checkpoint)
+{
+#ifdef CONFIG_NVS_MOUNT_CHECKPOINT
+	const uint16_t max_id = 10;
+	uint32_t cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	struct nvs_ate ate;
+	uint8_t buf[32];
+	uint16_t i = 0;
+	ssize_t len;
+	int err;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* Fill sectors 0 and 1, closing sector 1 writes the checkpoint */
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		write_content(max_id, i, i + 1, &fixture->fs);
+		i++;
+	}
+
+	/* Entries written after the checkpoint */
+	write_content(max_id, i, i + 5, &fixture->fs);
+	err = nvs_delete(&fixture->fs, 3);
+	zassert_true(err == 0, "nvs_delete call failure: %d", err);
+
+	err = flash_read(fixture->fs.flash_device,
+			 fixture->fs.offset + 2 * fixture->fs.sector_size - sizeof(ate),
+			 &ate, sizeof(ate));
+	zassert_true(err == 0, "flash_read failed: %d", err);
+
+	err = flash_read(fixture->fs.flash_device,
+			 fixture->fs.offset + fixture->fs.sector_size + ate.offset,
+			 &ate, sizeof(ate));
+	zassert_true(err == 0, "flash_read failed: %d", err);
+	zassert_equal(ate.part, NVS_CHECKPOINT_PART, "no checkpoint in closed sector");
+
+	memcpy(cache, fixture->fs.lookup_cache, sizeof(cache));
+	memset(fixture->fs.lookup_cache, 0xAA, sizeof(fixture->fs.lookup_cache));
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	zassert_mem_equal(cache, fixture->fs.lookup_cache, sizeof(cache),
+			  "lookup cache not restored from checkpoint");
+
+	len = nvs_read(&fixture->fs, 3, buf, sizeof(buf));
+	zassert_true(len == -ENOENT, "nvs_read shouldn't found the entry: %d", len);
+#endif
+}
+
+/*
+ * Test that the background garbage collection moves to the next sector before
+ * the current one is full.
+ */
+ZTEST_F(nvs, test_nvs_background_gc)
+{
+#if CONFIG_NVS_BACKGROUND_GC_THRESHOLD > 0
+	const uint16_t max_id = 10;
+	struct k_work_sync sync;
+	uint32_t free_space = 0;
+	uint16_t i = 0;
+	int err;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == 0) {
+		free_space = fixture->fs.ate_wra - fixture->fs.data_wra;
+		write_content(max_id, i, i + 1, &fixture->fs);
+		(void)k_work_flush(&fixture->fs.gc_work, &sync);
+		i++;
+	}
+
+	/* The last write still fitted in sector 0 */
+	zassert_true(free_space >= 32 + sizeof(struct nvs_ate),
+		     "sector closed by a write");
+	check_content(max_id, &fixture->fs);
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	check_content(max_id, &fixture->fs);
+#endif
+}
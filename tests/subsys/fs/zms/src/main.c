@@ -96,6 +96,14 @@ static void after(void *data)
 
 ZTEST_SUITE(zms, NULL, setup, before, after, NULL);
 
+/* Skip the tests that expect a sector to be closed only when it is full */
+static void skip_if_sector_not_filled(void)
+{
+	if (CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0) {
+		ztest_test_skip();
+	}
+}
+
 ZTEST_F(zms, test_zms_mount)
 {
 	int err;
@@ -333,6 +341,8 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	/* 101st write will trigger 4th GC. */
 	const uint16_t max_writes_4 = 41 + 20 + 20 + 20;
 
+	skip_if_sector_not_filled();
+
 	fixture->fs.sector_count = 3;
 
 	err = zms_mount(&fixture->fs);
@@ -415,6 +425,8 @@ ZTEST_F(zms, test_zms_corrupted_sector_close_operation)
 	/* 21st write will trigger GC. */
 	const uint16_t max_writes = 21;
 
+	skip_if_sector_not_filled();
+
 	/* Get the address of simulator parameters. */
 	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
 	stats_walk(fixture->sim_thresholds, flash_sim_max_len_find, &flash_max_len);
@@ -790,6 +802,8 @@ ZTEST_F(zms, test_zms_cache_gc)
 	size_t num;
 	uint16_t data = 0;
 
+	skip_if_sector_not_filled();
+
 	fixture->fs.sector_count = 3;
 	err = zms_mount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
@@ -886,3 +900,82 @@ ZTEST_F(zms, test_zms_cache_hash_quality)
 
 #endif
 }
+
+/*
+ * Test that the full lookup cache holds an entry for each ID and that IDs that
+ * do not fit anymore are still found.
+ */
+ZTEST_F(zms, test_zms_cache_full)
+{
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_FULL
+	int err;
+	size_t num;
+	uint32_t id;
+	uint32_t data;
+
+	fixture->fs.sector_count = 3;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (id = 0; id < CONFIG_ZMS_LOOKUP_CACHE_SIZE; id++) {
+		data = id;
+		err = zms_write(&fixture->fs, id * 4, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	num = num_occupied_cache_entries(&fixture->fs);
+	zassert_equal(num, CONFIG_ZMS_LOOKUP_CACHE_SIZE, "ID without cache entry");
+	zassert_false(fixture->fs.lookup_cache_incomplete, "cache should be complete");
+
+	data = id;
+	err = zms_write(&fixture->fs, id * 4, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	zassert_true(fixture->fs.lookup_cache_incomplete, "cache should be incomplete");
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (id = 0; id <= CONFIG_ZMS_LOOKUP_CACHE_SIZE; id++) {
+		err = zms_read(&fixture->fs, id * 4, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+	}
+
+	err = zms_read(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "zms_read should not find the entry: %d", err);
+#endif
+}
+
+/*
+ * Test that the background garbage collection moves to the next sector before
+ * the current one is full.
+ */
+ZTEST_F(zms, test_zms_background_gc)
+{
+#if CONFIG_ZMS_BACKGROUND_GC_THRESHOLD > 0
+	const uint16_t max_id = 10;
+	struct k_work_sync sync;
+	uint64_t free_space = 0;
+	uint32_t i = 0;
+	int err;
+
+	fixture->fs.sector_count = 3;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == 0) {
+		free_space = fixture->fs.ate_wra - fixture->fs.data_wra;
+		write_content(max_id, i, i + 1, &fixture->fs);
+		(void)k_work_flush(&fixture->fs.gc_work, &sync);
+		i++;
+	}
+
+	/* The last write still fitted in sector 0 */
+	zassert_true(free_space >= 32 + fixture->fs.ate_size, "sector closed by a write");
+	check_content(max_id, &fixture->fs);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	check_content(max_id, &fixture->fs);
+#endif
+}
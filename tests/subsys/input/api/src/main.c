@@ -84,6 +84,54 @@ ZTEST(input_api, test_sequence_thread)
 	zassert_equal(message_count_unfiltered, CONFIG_INPUT_QUEUE_MAX_MSGS + 1);
 }
 
+#ifdef CONFIG_INPUT_BATCH
+
+static K_SEM_DEFINE(batch_done, 0, 1);
+static struct input_event batch_evts[4];
+static size_t batch_count;
+
+static void input_cb_batch(const struct input_event *evts, size_t count, void *user_data)
+{
+	batch_count = MIN(count, ARRAY_SIZE(batch_evts));
+	memcpy(batch_evts, evts, batch_count * sizeof(*evts));
+
+	k_sem_give(&batch_done);
+}
+INPUT_BATCH_CALLBACK_DEFINE(&fake_dev, input_cb_batch, NULL);
+
+ZTEST(input_api, test_batch)
+{
+	int ret;
+
+	ret = input_report_abs(&fake_dev, INPUT_ABS_X, 10, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_dev, INPUT_ABS_Y, 20, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_key(&fake_dev, INPUT_BTN_TOUCH, 1, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	/* the three events are delivered at once */
+	zassert_equal(k_sem_take(&batch_done, K_SECONDS(1)), 0);
+	zassert_equal(batch_count, 3);
+	zassert_equal(batch_evts[0].code, INPUT_ABS_X);
+	zassert_equal(batch_evts[0].value, 10);
+	zassert_equal(batch_evts[1].code, INPUT_ABS_Y);
+	zassert_equal(batch_evts[1].value, 20);
+	zassert_equal(batch_evts[2].code, INPUT_BTN_TOUCH);
+	zassert_equal(batch_evts[2].sync, 1);
+
+#ifdef CONFIG_INPUT_QUEUE_STATS
+	struct input_queue_stats stats;
+
+	zassert_equal(input_queue_stats_get(&stats), 0);
+	zassert_true(stats.batches > 0);
+	zassert_true(stats.batch_max >= 3);
+	zassert_true(stats.max_used > 0);
+#endif
+}
+
+#endif /* CONFIG_INPUT_BATCH */
+
 #else /* CONFIG_INPUT_MODE_THREAD */
 
 static void input_cb_filtered(struct input_event *evt, void *user_data)
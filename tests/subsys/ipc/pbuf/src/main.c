@@ -106,6 +106,146 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+/* Claim/free tests. */
+ZTEST(test_pbuf, test_claim)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	char *claimed;
+	int ret;
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	zassert_equal(pbuf_claim(NULL, &claimed), -EINVAL);
+	zassert_equal(pbuf_claim(&pb, NULL), -EINVAL);
+	zassert_equal(pbuf_free(NULL, 0), -EINVAL);
+
+	/* Nothing to claim. */
+	zassert_equal(pbuf_claim(&pb, &claimed), 0);
+
+	ret = pbuf_write(&pb, write_buf, MSGA_SZ);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_write(&pb, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(ret, MSGB_SZ);
+
+	/* The packet is handed over in place. */
+	ret = pbuf_claim(&pb, &claimed);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_equal_ptr(claimed, &cfg.data_loc[PBUF_PACKET_LEN_SZ]);
+	zassert_mem_equal(claimed, write_buf, ret);
+
+	/* Claiming again without freeing returns the same packet. */
+	zassert_equal(pbuf_claim(&pb, &claimed), MSGA_SZ);
+	zassert_equal(pbuf_free(&pb, MSGA_SZ), 0);
+
+	ret = pbuf_claim(&pb, &claimed);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_true(IS_PTR_ALIGNED_BYTES(claimed, sizeof(uint32_t)));
+	zassert_mem_equal(claimed, write_buf+MSGA_SZ, ret);
+	zassert_equal(pbuf_free(&pb, MSGB_SZ), 0);
+
+	zassert_equal(pbuf_claim(&pb, &claimed), 0);
+
+	/* A wrapped packet can only be read. */
+	ret = pbuf_write(&pb, write_buf, MPS);
+	zassert_equal(ret, MPS);
+	zassert_equal(pbuf_claim(&pb, &claimed), -ENOTSUP);
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MPS);
+	zassert_mem_equal(write_buf, read_buf, MPS);
+
+	/* Claimed and read packets can be interleaved. */
+	ret = pbuf_write(&pb, write_buf, MSGA_SZ);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_write(&pb, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_equal(pbuf_claim(&pb, &claimed), MSGA_SZ);
+	zassert_mem_equal(claimed, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_free(&pb, MSGA_SZ), 0);
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MSGB_SZ);
+	zassert_mem_equal(read_buf, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+}
+
+/* Alloc/commit tests. */
+ZTEST(test_pbuf, test_alloc)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	char *allocated = NULL;
+	int ret;
+
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	zassert_equal(pbuf_alloc(NULL, MSGA_SZ, &allocated), -EINVAL);
+	zassert_equal(pbuf_alloc(&pb, MSGA_SZ, NULL), -EINVAL);
+	zassert_equal(pbuf_commit(NULL, allocated, MSGA_SZ), -EINVAL);
+
+	/* The packet is allocated right after its length. */
+	ret = pbuf_alloc(&pb, MSGA_SZ, &allocated);
+	zassert_true(ret >= MSGA_SZ);
+	zassert_equal_ptr(allocated, &cfg.data_loc[PBUF_PACKET_LEN_SZ]);
+	zassert_equal(pbuf_alloc(&pb, cfg.len, &allocated), -ENOMEM);
+
+	/* Nothing is visible to the reader before commit. */
+	ret = pbuf_alloc(&pb, MSGA_SZ, &allocated);
+	memcpy(allocated, write_buf, MSGA_SZ);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+	zassert_equal(pbuf_commit(&pb, allocated + 1, MSGA_SZ), -EINVAL);
+	zassert_equal(pbuf_commit(&pb, allocated, MSGA_SZ), MSGA_SZ);
+
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MSGA_SZ);
+	zassert_mem_equal(read_buf, write_buf, MSGA_SZ);
+
+	/* Bring the indexes close to the end of the buffer. */
+	ret = pbuf_write(&pb, write_buf, MPS - 40);
+	zassert_equal(ret, MPS - 40);
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MPS - 40);
+
+	/* A packet not fitting before the end is allocated at the front and
+	 * wrapped on commit.
+	 */
+	ret = pbuf_alloc(&pb, MSGB_SZ * 2, &allocated);
+	zassert_true(ret >= MSGB_SZ * 2);
+	zassert_equal_ptr(allocated, cfg.data_loc);
+	memcpy(allocated, write_buf, MSGB_SZ * 2);
+	zassert_equal(pbuf_commit(&pb, allocated, MSGB_SZ * 2), MSGB_SZ * 2);
+	zassert_equal(pbuf_claim(&pb, &allocated), -ENOTSUP);
+
+	ret = pbuf_read(&pb, read_buf, sizeof(read_buf));
+	zassert_equal(ret, MSGB_SZ * 2);
+	zassert_mem_equal(read_buf, write_buf, MSGB_SZ * 2);
+
+	/* The longest packet is allocated when no length is given. */
+	ret = pbuf_alloc(&pb, 0, &allocated);
+	zassert_true(ret > 0);
+	zassert_equal(pbuf_alloc(&pb, ret + 1, &allocated), -ENOMEM);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
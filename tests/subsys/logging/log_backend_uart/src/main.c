@@ -38,10 +38,22 @@ static void *uart_emul_setup(void)
 	return &fixture;
 }
 
+/* Wait for the deferred messages to be sent. */
+static void log_flush(void)
+{
+	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+		while (log_process()) {
+		}
+		k_msleep(10);
+	}
+}
+
 static void uart_emul_before(void *f)
 {
 	struct log_backend_uart_fixture *fixture = f;
 
+	log_flush();
+
 	for (size_t i = 0; i < EMUL_UART_NUM; i++) {
 		uart_irq_tx_disable(fixture->dev[i]);
 		uart_irq_rx_disable(fixture->dev[i]);
@@ -58,6 +70,7 @@ ZTEST_F(log_backend_uart, test_log_backend_uart_multi_instance)
 	zassert_equal(log_backend_count_get(), EMUL_UART_NUM, "Unexpected number of instance(s)");
 
 	LOG_RAW(TEST_DATA);
+	log_flush();
 
 	for (size_t i = 0; i < EMUL_UART_NUM; i++) {
 		uint8_t tx_content[SAMPLE_DATA_SIZE] = {0};
@@ -71,4 +84,33 @@ ZTEST_F(log_backend_uart, test_log_backend_uart_multi_instance)
 	}
 }
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_BATCH
+ZTEST_F(log_backend_uart, test_log_backend_uart_async_batch)
+{
+	char expected[SAMPLE_DATA_SIZE];
+	size_t expected_len = 0;
+
+	/* More than what a half of the double buffer holds */
+	BUILD_ASSERT(8 * (sizeof(TEST_DATA) - 1) > CONFIG_LOG_BACKEND_UART_ASYNC_BATCH_SIZE);
+	BUILD_ASSERT(8 * (sizeof(TEST_DATA) - 1) < SAMPLE_DATA_SIZE);
+
+	for (int i = 0; i < 8; i++) {
+		LOG_RAW(TEST_DATA);
+		memcpy(&expected[expected_len], TEST_DATA, strlen(TEST_DATA));
+		expected_len += strlen(TEST_DATA);
+	}
+	log_flush();
+
+	for (size_t i = 0; i < EMUL_UART_NUM; i++) {
+		uint8_t tx_content[SAMPLE_DATA_SIZE] = {0};
+		size_t tx_len;
+
+		tx_len = uart_emul_get_tx_data(fixture->dev[i], tx_content, sizeof(tx_content));
+		zassert_equal(tx_len, expected_len, "%d: Expected %d bytes, got %d", i,
+			      expected_len, tx_len);
+		zassert_mem_equal(tx_content, expected, expected_len);
+	}
+}
+#endif
+
 ZTEST_SUITE(log_backend_uart, NULL, uart_emul_setup, uart_emul_before, NULL, NULL);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+#define BURST CONFIG_LOG_RATE_LIMIT_BURST
+#define TOKEN_PERIOD_MS (MSEC_PER_SEC / CONFIG_LOG_RATE_LIMIT_RATE)
+
+static int msg_cnt;
+static int report_cnt;
+static char output_str[128];
+static char report_str[128];
+static size_t output_len;
+
+static int char_out(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	length = MIN(length, sizeof(output_str) - 1 - output_len);
+	memcpy(&output_str[output_len], data, length);
+	output_len += length;
+
+	return length;
+}
+
+static uint8_t output_buf[64];
+LOG_OUTPUT_DEFINE(test_output, char_out, output_buf, sizeof(output_buf));
+
+static void process(const struct log_backend *const backend, union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+
+	output_len = 0;
+	log_output_msg_process(&test_output, &msg->log, 0);
+	output_str[output_len] = '\0';
+
+	if (strstr(output_str, "messages suppressed") != NULL) {
+		strcpy(report_str, output_str);
+		report_cnt++;
+	} else {
+		msg_cnt++;
+	}
+}
+
+static const struct log_backend_api test_backend_api = {
+	.process = process,
+};
+
+LOG_BACKEND_DEFINE(test_backend, test_backend_api, true);
+
+static void flush(void)
+{
+	while (log_process()) {
+	}
+}
+
+/* Each function is a call site with its own token bucket. */
+#define LOG_CALL_SITE_DEFINE(name)                                                                 \
+	static void name(int cnt)                                                                  \
+	{                                                                                          \
+		for (int i = 0; i < cnt; i++) {                                                    \
+			LOG_INF(#name " %d", i);                                                   \
+		}                                                                                  \
+	}
+
+LOG_CALL_SITE_DEFINE(log_storm)
+LOG_CALL_SITE_DEFINE(log_other)
+LOG_CALL_SITE_DEFINE(log_refill)
+
+ZTEST(log_rate_limit, test_burst)
+{
+	log_storm(BURST + 3);
+	flush();
+	zassert_equal(msg_cnt, BURST);
+	zassert_equal(report_cnt, 0);
+
+	/* Another call site has its own bucket. */
+	log_other(BURST);
+	flush();
+	zassert_equal(msg_cnt, 2 * BURST);
+}
+
+ZTEST(log_rate_limit, test_refill)
+{
+	log_refill(BURST + 3);
+	flush();
+	zassert_equal(msg_cnt, BURST);
+
+	/* Two tokens are back, the suppressed messages are reported first. */
+	k_msleep(2 * TOKEN_PERIOD_MS + TOKEN_PERIOD_MS / 2);
+	log_refill(3);
+	flush();
+	zassert_equal(report_cnt, 1);
+	zassert_not_null(strstr(report_str, "test: 3 messages suppressed"), "%s",
+			 report_str);
+	zassert_equal(msg_cnt, BURST + 2);
+
+	/* A full bucket does not grow beyond the burst. */
+	k_msleep((BURST + 2) * TOKEN_PERIOD_MS);
+	log_refill(BURST + 3);
+	flush();
+	zassert_equal(report_cnt, 2);
+	zassert_not_null(strstr(report_str, "test: 1 messages suppressed"), "%s",
+			 report_str);
+	zassert_equal(msg_cnt, 2 * BURST + 2);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	flush();
+	msg_cnt = 0;
+	report_cnt = 0;
+}
+
+ZTEST_SUITE(log_rate_limit, NULL, NULL, before, NULL, NULL);
@@ -26,6 +26,7 @@ ZTEST(mem_attr, test_mem_attr)
 			zassert_equal(region[idx].dt_attr, DT_MEM_ARM_MPU_FLASH |
 							   DT_MEM_NON_VOLATILE,
 							   "Wrong region address");
+			zassert_equal(region[idx].dt_cpus, BIT(0) | BIT(2), "Wrong region CPUs");
 			zassert_str_equal(region[idx].dt_name,
 					  "memory@10000000", "Wrong name");
 		} else {
@@ -33,6 +34,7 @@ ZTEST(mem_attr, test_mem_attr)
 			zassert_equal(region[idx].dt_size, 0x2000, "Wrong region size");
 			zassert_equal(region[idx].dt_attr, DT_MEM_ARM_MPU_RAM_NOCACHE,
 							   "Wrong region address");
+			zassert_equal(region[idx].dt_cpus, 0, "Wrong region CPUs");
 			zassert_str_equal(region[idx].dt_name,
 					  "memory@20000000", "Wrong name");
 		}
@@ -32,6 +32,7 @@ static const struct device *uart = DEVICE_DT_GET(DT_NODELABEL(dut));
 static struct modem_backend_uart uart_backend;
 static struct modem_pipe *pipe;
 K_SEM_DEFINE(receive_ready_sem, 0, 1);
+K_SEM_DEFINE(transmit_idle_sem, 0, 1);
 
 /*************************************************************************************************/
 /*                                          Buffers                                              */
@@ -51,6 +52,9 @@ static void modem_pipe_callback_handler(struct modem_pipe *pipe, enum modem_pipe
 	case MODEM_PIPE_EVENT_RECEIVE_READY:
 		k_sem_give(&receive_ready_sem);
 		break;
+	case MODEM_PIPE_EVENT_TRANSMIT_IDLE:
+		k_sem_give(&transmit_idle_sem);
+		break;
 	default:
 		break;
 	}
@@ -149,6 +153,30 @@ static int receive_prng(void)
 	return ret;
 }
 
+static int receive_prng_lent(void)
+{
+	uint8_t *buf;
+	int ret = 0;
+
+	if (k_sem_take(&receive_ready_sem, K_NO_WAIT) == 0) {
+		ret = modem_pipe_receive_claim(pipe, &buf);
+		if (ret < 1) {
+			return ret < 0 ? -EFAULT : 0;
+		}
+		for (uint32_t i = 0; i < (uint32_t)ret; i++) {
+			if (receive_prng_random() != buf[i]) {
+				return -EFAULT;
+			}
+		}
+		if (modem_pipe_receive_release(pipe, ret) < 0) {
+			return -EFAULT;
+		}
+		printk("RX LENT: %u\n", (uint32_t)ret);
+	}
+
+	return ret;
+}
+
 /*************************************************************************************************/
 /*                                         Test setup                                            */
 /*************************************************************************************************/
@@ -172,6 +200,7 @@ static void test_modem_backend_uart_before(void *f)
 	prng_reset();
 	ring_buf_reset(&transmit_ring_buf);
 	k_sem_reset(&receive_ready_sem);
+	k_sem_reset(&transmit_idle_sem);
 	__ASSERT_NO_MSG(modem_pipe_open(pipe, K_SECONDS(10)) == 0);
 }
 
@@ -206,5 +235,48 @@ ZTEST(modem_backend_uart_suite, test_transmit_receive)
 	}
 }
 
+ZTEST(modem_backend_uart_suite, test_transmit_receive_lent)
+{
+	struct modem_pipe_buf bufs[2];
+	uint32_t received = 0;
+	uint32_t transmitted = 0;
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	bool idle;
+	int ret;
+
+	while (transmitted < 8192) {
+		/* Transmit in place from the transmit ring buffer, split in two buffers */
+		fill_transmit_ring_buf();
+		reserved_size = ring_buf_get_claim(&transmit_ring_buf, &reserved, 256);
+		bufs[0].buf = reserved;
+		bufs[0].size = reserved_size / 2;
+		bufs[1].buf = &reserved[bufs[0].size];
+		bufs[1].size = reserved_size - bufs[0].size;
+
+		k_sem_reset(&transmit_idle_sem);
+		ret = modem_pipe_transmit_bufs(pipe, bufs, ARRAY_SIZE(bufs));
+		if (ret == -ENOTSUP) {
+			ring_buf_get_finish(&transmit_ring_buf, 0);
+			ztest_test_skip();
+		}
+
+		zassert_equal(ret, reserved_size, "Failed to transmit data");
+		transmitted += (uint32_t)ret;
+
+		/* The buffers are owned by the backend until transmit is idle */
+		idle = false;
+		while (!idle || received < transmitted) {
+			idle = idle || k_sem_take(&transmit_idle_sem, K_NO_WAIT) == 0;
+			ret = receive_prng_lent();
+			zassert(ret > -1, "Received data is corrupted");
+			received += (uint32_t)ret;
+			k_yield();
+		}
+
+		ring_buf_get_finish(&transmit_ring_buf, reserved_size);
+	}
+}
+
 ZTEST_SUITE(modem_backend_uart_suite, NULL, test_modem_backend_uart_setup,
 	    test_modem_backend_uart_before, test_modem_backend_uart_after, NULL);
@@ -297,6 +297,53 @@ ZTEST(device_runtime_api, test_pm_device_runtime_auto)
 	zassert_equal(pm_device_runtime_put(dev), 0, "");
 }
 
+ZTEST(device_runtime_api, test_batch)
+{
+	const struct device *devs[] = {
+		test_dev,
+		DEVICE_DT_GET(DT_NODELABEL(test_dev)),
+	};
+	const struct device *too_many[PM_DEVICE_RUNTIME_BATCH_MAX + 1];
+	enum pm_device_state state;
+	size_t count;
+
+	count = test_driver_pm_count(test_dev);
+
+	/* usage: 0, +1, resume: yes */
+	zassert_equal(pm_device_runtime_get_batch(devs, ARRAY_SIZE(devs)), 0);
+	for (size_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		zassert_equal(pm_device_runtime_usage(devs[i]), 1);
+		(void)pm_device_state_get(devs[i], &state);
+		zassert_equal(state, PM_DEVICE_STATE_ACTIVE);
+	}
+	zassert_equal(test_driver_pm_count(test_dev), count + 1);
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME_STATS
+	struct pm_device_runtime_stats stats;
+
+	zassert_equal(pm_device_runtime_stats_get(test_dev, &stats), 0);
+	zassert_true(stats.resume_count > 0);
+	zassert_true(stats.resume_max_cyc >= stats.resume_last_cyc);
+	zassert_true(stats.resume_total_cyc >= stats.resume_max_cyc);
+#endif
+
+	/* usage: 1, -1, suspend: yes */
+	zassert_equal(pm_device_runtime_put_batch(devs, ARRAY_SIZE(devs)), 0);
+	for (size_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		zassert_equal(pm_device_runtime_usage(devs[i]), 0);
+		(void)pm_device_state_get(devs[i], &state);
+		zassert_equal(state, PM_DEVICE_STATE_SUSPENDED);
+	}
+	zassert_equal(test_driver_pm_count(test_dev), count + 2);
+
+	/* groups larger than the maximum are rejected as a whole */
+	for (size_t i = 0; i < ARRAY_SIZE(too_many); i++) {
+		too_many[i] = test_dev;
+	}
+	zassert_equal(pm_device_runtime_get_batch(too_many, ARRAY_SIZE(too_many)), -EINVAL);
+	zassert_equal(pm_device_runtime_usage(test_dev), 0);
+}
+
 void *device_runtime_api_setup(void)
 {
 	test_dev = device_get_binding("test_driver");
@@ -304,6 +304,62 @@ ZTEST(policy_api, test_pm_policy_next_state_custom)
 }
 #endif /* CONFIG_PM_POLICY_CUSTOM */
 
+#ifdef CONFIG_PM_POLICY_PREDICTIVE
+void pm_policy_predictive_record(uint8_t cpu, uint32_t idle_us);
+
+static void record_idle(uint32_t idle_us, uint32_t alt_idle_us)
+{
+	for (int i = 0; i < CONFIG_PM_POLICY_PREDICTIVE_HISTORY; i++) {
+		pm_policy_predictive_record(0U, (i % 2) ? alt_idle_us : idle_us);
+	}
+}
+
+/**
+ * @brief Test the behavior of pm_policy_next_state() when
+ * CONFIG_PM_POLICY_PREDICTIVE=y.
+ */
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	const struct pm_state_info *next;
+
+	/* the next wakeup still rules out the states it doesn't fit */
+	record_idle(2000000, 2000000);
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(10999));
+	zassert_is_null(next);
+
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* consistent early wakeups: shallowest state fitting the next wakeup */
+	record_idle(20000, 20000);
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(1100000));
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* idle durations long enough for the deepest state */
+	record_idle(1200000, 1300000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_SUSPEND_TO_RAM);
+
+	/* early wakeups mixed with long idle periods, the latter are outliers */
+	record_idle(20000, 2000000);
+	next = pm_policy_next_state(0U, K_TICKS_FOREVER);
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+
+	/* deep enough predicted idle duration with a shallower next wakeup */
+	record_idle(2000000, 2000000);
+	next = pm_policy_next_state(0U, k_us_to_ticks_floor32(110000));
+	zassert_equal(next->state, PM_STATE_RUNTIME_IDLE);
+}
+#else
+ZTEST(policy_api, test_pm_policy_next_state_predictive)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_PREDICTIVE */
+
 #ifdef CONFIG_PM_POLICY_DEFAULT
 /* note: we can't easily mock k_cycle_get_32(), so test is not ideal */
 ZTEST(policy_api, test_pm_policy_events)
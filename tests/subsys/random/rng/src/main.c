@@ -121,4 +121,35 @@ ZTEST(rng_common, test_rand32)
 #endif /* CONFIG_CSPRNG_ENABLED */
 }
 
+#if defined(CONFIG_CSPRNG_ENABLED)
+/* Many small requests, as issued by network stacks, exercise the buffered
+ * path and its refill when CONFIG_CSPRNG_BUFFER is enabled.
+ */
+ZTEST(rng_common, test_csrand_small)
+{
+	uint32_t values[32];
+	int equal_count = 0;
+	int err;
+
+	for (int round = 0; round < 2; round++) {
+		for (int i = 0; i < ARRAY_SIZE(values); i++) {
+			err = sys_csrand_get(&values[i], sizeof(values[i]));
+			zassert_equal(err, 0, "sys_csrand_get returned an error");
+		}
+
+		for (int i = 1; i < ARRAY_SIZE(values); i++) {
+			if (values[i] == values[i - 1]) {
+				equal_count++;
+			}
+		}
+
+		/* let the buffers refill */
+		k_msleep(10);
+	}
+
+	zassert_true(equal_count < ARRAY_SIZE(values) / 2,
+		     "random numbers returned same value with high probability");
+}
+#endif /* CONFIG_CSPRNG_ENABLED */
+
 ZTEST_SUITE(rng_common, NULL, NULL, NULL, NULL, NULL);
@@ -619,3 +619,117 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+SETTINGS_STATIC_HANDLER_DEFINE(lookup_settings, "lookup", NULL, NULL, NULL, NULL);
+SETTINGS_STATIC_HANDLER_DEFINE(lookup_sub_settings, "lookup/sub", NULL, NULL, NULL, NULL);
+
+ZTEST(settings_functional, test_handler_lookup)
+{
+	struct settings_handler_static *ch;
+	const char *next;
+
+	settings_subsys_init();
+
+	ch = settings_parse_and_lookup("lookup", &next);
+	zassert_equal_ptr(ch, &settings_handler_lookup_settings);
+	zassert_is_null(next);
+
+	ch = settings_parse_and_lookup("lookup/val", &next);
+	zassert_equal_ptr(ch, &settings_handler_lookup_settings);
+	zassert_str_equal(next, "val");
+
+	ch = settings_parse_and_lookup("lookup/sub/val=1", &next);
+	zassert_equal_ptr(ch, &settings_handler_lookup_sub_settings);
+	zassert_str_equal(next, "val=1");
+
+	ch = settings_parse_and_lookup("lookup/subval", &next);
+	zassert_equal_ptr(ch, &settings_handler_lookup_settings);
+	zassert_str_equal(next, "subval");
+
+	ch = settings_parse_and_lookup("lookups/sub", &next);
+	zassert_is_null(ch);
+	zassert_is_null(next);
+}
+
+#if defined(CONFIG_SETTINGS_TXN)
+static uint8_t txn_val[2];
+
+static int txn_loader(const char *key, size_t len, settings_read_cb read_cb,
+		      void *cb_arg, void *param)
+{
+	size_t idx;
+
+	if (key == NULL || len != 1) {
+		return 0;
+	}
+
+	idx = key[0] - '1';
+	if (idx < ARRAY_SIZE(txn_val)) {
+		read_cb(cb_arg, &txn_val[idx], 1);
+	}
+
+	return 0;
+}
+
+ZTEST(settings_functional, test_txn)
+{
+	int rc;
+	uint8_t val;
+
+	settings_subsys_init();
+
+	rc = settings_txn_begin();
+	zassert_equal(rc, 0, "can't begin transaction");
+	rc = settings_txn_begin();
+	zassert_equal(rc, -EBUSY, "nested transaction");
+
+	val = 1;
+	rc = settings_txn_save("txn/1", &val, sizeof(val));
+	zassert_equal(rc, 0, "can't stage value");
+	val = 2;
+	rc = settings_txn_save("txn/2", &val, sizeof(val));
+	zassert_equal(rc, 0, "can't stage value");
+	/* Staging a name again keeps the last value */
+	val = 3;
+	rc = settings_txn_save("txn/1", &val, sizeof(val));
+	zassert_equal(rc, 0, "can't stage value");
+
+	rc = settings_txn_commit();
+	zassert_equal(rc, 0, "can't commit transaction");
+
+	memset(txn_val, 0, sizeof(txn_val));
+	rc = settings_load_subtree_direct("txn", txn_loader, NULL);
+	zassert_equal(rc, 0);
+	zassert_equal(txn_val[0], 3);
+	zassert_equal(txn_val[1], 2);
+
+	/* Staged values are dropped by an abort */
+	rc = settings_txn_begin();
+	zassert_equal(rc, 0, "can't begin transaction");
+	val = 4;
+	rc = settings_txn_save("txn/2", &val, sizeof(val));
+	zassert_equal(rc, 0, "can't stage value");
+	settings_txn_abort();
+
+	rc = settings_txn_save("txn/2", &val, sizeof(val));
+	zassert_equal(rc, -EINVAL, "no transaction in progress");
+
+	memset(txn_val, 0, sizeof(txn_val));
+	rc = settings_load_subtree_direct("txn", txn_loader, NULL);
+	zassert_equal(rc, 0);
+	zassert_equal(txn_val[1], 2);
+
+	rc = settings_txn_begin();
+	zassert_equal(rc, 0, "can't begin transaction");
+	rc = settings_txn_delete("txn/1");
+	zassert_equal(rc, 0, "can't stage deletion");
+	rc = settings_txn_commit();
+	zassert_equal(rc, 0, "can't commit transaction");
+
+	memset(txn_val, 0, sizeof(txn_val));
+	rc = settings_load_subtree_direct("txn", txn_loader, NULL);
+	zassert_equal(rc, 0);
+	zassert_equal(txn_val[0], 0);
+	zassert_equal(txn_val[1], 2);
+}
+#endif
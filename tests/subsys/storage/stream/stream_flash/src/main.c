@@ -418,8 +418,13 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, true);
 	zassert_equal(rc, 0, "expected success");
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* Second page is erased ahead, once the flush returns */
+	VERIFY_ERASED(page_size, page_size);
+#else
 	/* Second page should not be erased */
 	VERIFY_WRITTEN(page_size, page_size);
+#endif
 }
 
 /* Erase that never completes successfully */
@@ -129,4 +129,56 @@ ZTEST(lib_base64, test_base64_codec)
 	zassert_equal(rc, -ENOMEM, "Error: dst NULL: decode test return value");
 }
 
+ZTEST(lib_base64, test_base64_decode_lines)
+{
+	uint8_t data[240];
+	uint8_t enc[400];
+	uint8_t wrapped[450];
+	uint8_t buffer[256];
+	size_t enc_len, len;
+	size_t wlen = 0;
+	int rc;
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 37 + 11);
+	}
+
+	rc = base64_encode(enc, sizeof(enc), &enc_len, data, sizeof(data) - 1);
+	zassert_equal(rc, 0, "Encode return value");
+
+	/* PEM style 64 character lines, then one broken in the middle of a group */
+	for (size_t i = 0; i < enc_len; i++) {
+		if (i > 0 && i % 64 == 0) {
+			wrapped[wlen++] = '\r';
+			wrapped[wlen++] = '\n';
+		} else if (i == 198) {
+			wrapped[wlen++] = '\n';
+		}
+		wrapped[wlen++] = enc[i];
+	}
+
+	rc = base64_decode(buffer, sizeof(buffer), &len, wrapped, wlen);
+	zassert_equal(rc, 0, "Decode return value");
+	zassert_equal(len, sizeof(data) - 1, "Decode length");
+	zassert_mem_equal(buffer, data, len, "Decode comparison");
+
+	/* Size query */
+	rc = base64_decode(NULL, 0, &len, wrapped, wlen);
+	zassert_equal(rc, -ENOMEM, "Size query return value");
+	zassert_equal(len, sizeof(data) - 1, "Size query length");
+
+	/* Invalid characters and padding within runs of data characters */
+	wrapped[150] = '.';
+	rc = base64_decode(buffer, sizeof(buffer), &len, wrapped, wlen);
+	zassert_equal(rc, -EINVAL, "Invalid character return value");
+
+	wrapped[150] = 0xC1;
+	rc = base64_decode(buffer, sizeof(buffer), &len, wrapped, wlen);
+	zassert_equal(rc, -EINVAL, "Non-ASCII character return value");
+
+	wrapped[150] = '=';
+	rc = base64_decode(buffer, sizeof(buffer), &len, wrapped, wlen);
+	zassert_equal(rc, -EINVAL, "Padding return value");
+}
+
 ZTEST_SUITE(lib_base64, NULL, NULL, NULL, NULL, NULL);
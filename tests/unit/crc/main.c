@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <time.h>
 #include <zephyr/ztest.h>
 #include <zephyr/sys/crc.h>
 #include "../../../lib/crc/crc8_sw.c"
@@ -51,6 +52,114 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Bit by bit, as a reference for the table-driven implementations */
+static uint32_t crc32_reflected_ref(uint32_t crc, const uint8_t *data, size_t len,
+				    uint32_t poly)
+{
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? poly : 0U);
+		}
+	}
+
+	return crc;
+}
+
+static uint8_t crc32_buf[4096 + 8];
+
+static void crc32_buf_fill(void)
+{
+	uint32_t x = 1U;
+
+	for (size_t i = 0; i < sizeof(crc32_buf); i++) {
+		x = x * 1103515245U + 12345U;
+		crc32_buf[i] = x >> 24;
+	}
+}
+
+ZTEST(crc, test_crc32_lengths)
+{
+	crc32_buf_fill();
+
+	/* Every alignment, and lengths covering the word loops and their tails */
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len <= 64; len++) {
+			const uint8_t *data = &crc32_buf[offset];
+
+			zassert_equal(crc32_ieee(data, len),
+				      ~crc32_reflected_ref(~0U, data, len, 0xedb88320U),
+				      "offset %zu len %zu", offset, len);
+			zassert_equal(crc32_c(0, data, len, true, true),
+				      ~crc32_reflected_ref(~0U, data, len, 0x82f63b78U),
+				      "offset %zu len %zu", offset, len);
+		}
+	}
+
+	/* Streams split anywhere */
+	for (size_t split = 0; split <= 64; split++) {
+		uint32_t crc = crc32_ieee_update(0, crc32_buf, split);
+
+		crc = crc32_ieee_update(crc, &crc32_buf[split], 64 - split);
+		zassert_equal(crc, crc32_ieee(crc32_buf, 64), "split %zu", split);
+
+		crc = crc32_c(0, crc32_buf, split, true, false);
+		crc = crc32_c(crc, &crc32_buf[split], 64 - split, false, true);
+		zassert_equal(crc, crc32_c(0, crc32_buf, 64, true, true), "split %zu", split);
+	}
+}
+
+#define CRC32_THROUGHPUT_ROUNDS 256
+
+static uint64_t crc32_elapsed_ns(const struct timespec *start)
+{
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return (uint64_t)(end.tv_sec - start->tv_sec) * 1000000000U + end.tv_nsec -
+	       start->tv_nsec;
+}
+
+static void crc32_throughput_print(const char *name, uint64_t ns)
+{
+	uint64_t bytes = (uint64_t)CRC32_THROUGHPUT_ROUNDS * 4096U;
+
+	TC_PRINT("%s: %llu MB/s\n", name,
+		 (unsigned long long)(bytes * 1000U / MAX(ns, 1U)));
+}
+
+ZTEST(crc, test_crc32_throughput)
+{
+	struct timespec start;
+	uint32_t ieee = 0;
+	uint32_t c = 0;
+	uint32_t ref_ieee = ~0U;
+	uint32_t ref_c = ~0U;
+
+	crc32_buf_fill();
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (int i = 0; i < CRC32_THROUGHPUT_ROUNDS; i++) {
+		ieee = crc32_ieee_update(ieee, crc32_buf, 4096);
+	}
+	crc32_throughput_print("crc32_ieee", crc32_elapsed_ns(&start));
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (int i = 0; i < CRC32_THROUGHPUT_ROUNDS; i++) {
+		c = crc32_c(c, crc32_buf, 4096, i == 0, i == CRC32_THROUGHPUT_ROUNDS - 1);
+	}
+	crc32_throughput_print("crc32_c", crc32_elapsed_ns(&start));
+
+	for (int i = 0; i < CRC32_THROUGHPUT_ROUNDS; i++) {
+		ref_ieee = crc32_reflected_ref(ref_ieee, crc32_buf, 4096, 0xedb88320U);
+		ref_c = crc32_reflected_ref(ref_c, crc32_buf, 4096, 0x82f63b78U);
+	}
+
+	zassert_equal(ieee, ~ref_ieee);
+	zassert_equal(c, ~ref_c);
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };